@@ -2,56 +2,33 @@
 #define BLACK_BISHOP_H
 
 #include <Arduino.h>
+#include "sprite.h"
 #include "chessPiece.h"
 #include "Square.h"
 
-const uint16_t blackBishopSprite [] PROGMEM = {
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0x2106, 0x2106, 0x0000,   // 0x0010 (16) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (48) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106,   // 0x0040 (64) pixels
-0x2106, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (80) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000,   // 0x0060 (96) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0070 (112) pixels
-0x0000, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0080 (128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106,   // 0x0090 (144) pixels
-0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00A0 (160) pixels
-0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x0000,   // 0x00B0 (176) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0x2106,   // 0x00C0 (192) pixels
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00D0 (208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106,   // 0x00E0 (224) pixels
-0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF,   // 0x00F0 (240) pixels
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106,   // 0x0100 (256) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106,   // 0x0110 (272) pixels
-0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0120 (288) pixels
-0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106,   // 0x0130 (304) pixels
-0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0x2106,   // 0x0140 (320) pixels
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000,   // 0x0150 (336) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106,   // 0x0160 (352) pixels
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0170 (368) pixels
-0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF,   // 0x0180 (384) pixels
-0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106,   // 0x0190 (400) pixels
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01A0 (416) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106,   // 0x01B0 (432) pixels
-0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01C0 (448) pixels
-0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x0000,   // 0x01D0 (464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x01E0 (480) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01F0 (496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF,   // 0x0200 (512) pixels
-0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF,   // 0x0210 (528) pixels
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0220 (544) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106,   // 0x0230 (560) pixels
-0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0240 (576) pixels
-0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x0000,   // 0x0250 (592) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106,   // 0x0260 (608) pixels
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0270 (624) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0280 (640) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106,   // 0x0290 (656) pixels
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x0000,   // 0x02A0 (672) pixels
-0x0000, 0x0000, 0x0000, 0x0000};
+// PAL4 sprite 26x26, 2 colors, 344 bytes (raw: 1352 bytes)
+const uint16_t blackBishopSprite_palette [] PROGMEM = {
+0x0000, 0x2106, 0xFFFF,
+};
+const uint8_t blackBishopSprite_indices [] PROGMEM = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x12, 0x22, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x21,
+0x11, 0x12, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x21, 0x11, 0x11, 0x11,
+0x12, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x11, 0x12, 0x21, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x11, 0x12, 0x21, 0x12,
+0x21, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x12, 0x21, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x12, 0x21, 0x11, 0x12, 0x21, 0x00,
+0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x12, 0x21, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21,
+0x11, 0x11, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x21, 0x11,
+0x12, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x21, 0x11, 0x12, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x21, 0x11, 0x11, 0x11, 0x12,
+0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
+0x00, 0x00,
+};
+const Sprite blackBishopSprite = {SPRITE_PAL4, 26, 26, 3, blackBishopSprite_palette, blackBishopSprite_indices};
 
 chessPiece createBlackBishop(){
-    return chessPiece(Square(4, 7), 0, blackBishopSprite);
+    return chessPiece(Square(4, 7), 0, &blackBishopSprite);
 }
 
 #endif
\ No newline at end of file
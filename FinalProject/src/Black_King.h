@@ -2,40 +2,33 @@
 #define BLACK_KING_H
 
 #include <Arduino.h>
+#include "sprite.h"
 #include "chessPiece.h"
 #include "Square.h"
 
-const uint16_t blackKingSprite [] PROGMEM = {
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
-0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000,   
-0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF,   
-0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 
-0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 
-0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+// PAL4 sprite 26x26, 2 colors, 344 bytes (raw: 1352 bytes)
+const uint16_t blackKingSprite_palette [] PROGMEM = {
+0x0000, 0x2106, 0xFFFF,
 };
+const uint8_t blackKingSprite_indices [] PROGMEM = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x11, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x02, 0x21, 0x11, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x11, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x21, 0x11, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x21, 0x12, 0x22, 0x21, 0x12, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x22, 0x22, 0x21, 0x12,
+0x22, 0x21, 0x12, 0x22, 0x22, 0x20, 0x00, 0x02, 0x21, 0x11, 0x11, 0x12, 0x21, 0x11, 0x12, 0x21, 0x11, 0x11, 0x12, 0x20, 0x02, 0x21, 0x11, 0x11, 0x12, 0x21, 0x11, 0x12,
+0x21, 0x11, 0x11, 0x12, 0x20, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 0x11,
+0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11,
+0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x02, 0x21, 0x12,
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x12, 0x20, 0x02, 0x21, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x12, 0x20, 0x00, 0x02, 0x21, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x20, 0x00, 0x00, 0x02, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x20, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22,
+0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+0x11, 0x12, 0x20, 0x00, 0x00, 0x02, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x20, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
+0x00, 0x00,
+};
+const Sprite blackKingSprite = {SPRITE_PAL4, 26, 26, 3, blackKingSprite_palette, blackKingSprite_indices};
 
 chessPiece createBlackKing(){
-    return chessPiece(Square(4, 7), 0, blackKingSprite);
+    return chessPiece(Square(4, 7), 0, &blackKingSprite);
 }
 
 #endif
\ No newline at end of file
@@ -2,88 +2,58 @@
 #define ICONS
 
 #include <Arduino.h>
+#include "sprite.h"
 
-const uint16_t TIC_TAC_TOE_ICON_BITS[] PROGMEM = {
- 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0010 (16) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0020 (32) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0030 (48) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0040 (64) pixels
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106,   // 0x0050 (80) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0060 (96) pixels
-0xFFFF, 0x5B7C, 0x5B7C, 0xFFFF, 0x2106, 0xFFFF, 0xA986, 0xFFFF, 0xFFFF, 0xA986, 0xFFFF, 0x2106, 0xFFFF, 0x5B7C, 0x5B7C, 0xFFFF,   // 0x0070 (112) pixels
-0x5B7C, 0xFFFF, 0xFFFF, 0x5B7C, 0x2106, 0xFFFF, 0xFFFF, 0xA986, 0xA986, 0xFFFF, 0xFFFF, 0x2106, 0x5B7C, 0xFFFF, 0xFFFF, 0x5B7C,   // 0x0080 (128) pixels
-0x5B7C, 0xFFFF, 0xFFFF, 0x5B7C, 0x2106, 0xFFFF, 0xFFFF, 0xA986, 0xA986, 0xFFFF, 0xFFFF, 0x2106, 0x5B7C, 0xFFFF, 0xFFFF, 0x5B7C,   // 0x0090 (144) pixels
-0xFFFF, 0x5B7C, 0x5B7C, 0xFFFF, 0x2106, 0xFFFF, 0xA986, 0xFFFF, 0xFFFF, 0xA986, 0xFFFF, 0x2106, 0xFFFF, 0x5B7C, 0x5B7C, 0xFFFF,   // 0x00A0 (160) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00B0 (176) pixels
-0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106,   // 0x00C0 (192) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00D0 (208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00E0 (224) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00F0 (240) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0100 (256) pixels
+// PAL4 sprite 16x16, 4 colors, 138 bytes (raw: 512 bytes)
+const uint16_t TIC_TAC_TOE_ICON_BITS_palette [] PROGMEM = {
+0x0000, 0xFFFF, 0x2106, 0x5B7C, 0xA986,
 };
-
-const uint16_t POKEMON_ICON_BITS[] PROGMEM = {
-  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0010 (16) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (48) pixels
-0x0000, 0x0000, 0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000, 0x0000, 0x0000,   // 0x0040 (64) pixels
-0x0000, 0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000, 0x0000,   // 0x0050 (80) pixels
-0x0000, 0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000, 0x0000,   // 0x0060 (96) pixels
-0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000, 0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000,   // 0x0070 (112) pixels
-0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xA986, 0xA986, 0xA986, 0xA986, 0xA986, 0x0000,   // 0x0080 (128) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0090 (144) pixels
-0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000,   // 0x00A0 (160) pixels
-0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000,   // 0x00B0 (176) pixels
-0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000,   // 0x00C0 (192) pixels
-0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000,   // 0x00D0 (208) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00E0 (224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00F0 (240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0100 (256) pixels
-
+const uint8_t TIC_TAC_TOE_ICON_BITS_indices [] PROGMEM = {
+0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11,
+0x11, 0x12, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x13, 0x31, 0x21, 0x41, 0x14, 0x12, 0x13, 0x31,
+0x31, 0x13, 0x21, 0x14, 0x41, 0x12, 0x31, 0x13, 0x31, 0x13, 0x21, 0x14, 0x41, 0x12, 0x31, 0x13, 0x13, 0x31, 0x21, 0x41, 0x14, 0x12, 0x13, 0x31, 0x11, 0x11, 0x21, 0x11,
+0x11, 0x12, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11,
+0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11,
 };
+const Sprite TIC_TAC_TOE_ICON_BITS = {SPRITE_PAL4, 16, 16, 5, TIC_TAC_TOE_ICON_BITS_palette, TIC_TAC_TOE_ICON_BITS_indices};
 
-const uint16_t CHESS_ICON_BITS[] PROGMEM = {
-  
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0010 (16) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0020 (32) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0030 (48) pixels
-0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0040 (64) pixels
-0xFFFF, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0050 (80) pixels
-0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF,   // 0x0060 (96) pixels
-0x2106, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF,   // 0x0070 (112) pixels
-0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF,   // 0x0080 (128) pixels
-0xFFFF, 0xFFFF, 0x2106, 0x2106, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF,   // 0x0090 (144) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00A0 (160) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00B0 (176) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00C0 (192) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x00D0 (208) pixels
-0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF,   // 0x00E0 (224) pixels
-0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2106, 0xFFFF, 0xFFFF,   // 0x00F0 (240) pixels
-0xFFFF, 0xFFFF, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0x2106, 0xFFFF, 0xFFFF,   // 0x0100 (256) pixels
-
+// PAL4 sprite 16x16, 2 colors, 134 bytes (raw: 512 bytes)
+const uint16_t POKEMON_ICON_BITS_palette [] PROGMEM = {
+0x0000, 0xA986, 0xFFFF,
+};
+const uint8_t POKEMON_ICON_BITS_indices [] PROGMEM = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11,
+0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+0x01, 0x11, 0x11, 0x02, 0x20, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x20, 0x02, 0x22, 0x22, 0x20, 0x00, 0x22, 0x22, 0x22,
+0x22, 0x22, 0x22, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
+const Sprite POKEMON_ICON_BITS = {SPRITE_PAL4, 16, 16, 3, POKEMON_ICON_BITS_palette, POKEMON_ICON_BITS_indices};
 
-const uint16_t SETTINGS_ICON_BITS[] PROGMEM = {
-  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0010 (16) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32) pixels
-0x0000, 0x0000, 0x2106, 0x2106, 0x0000, 0x2106, 0x83F0, 0x83F0, 0x83F0, 0x2106, 0x0000, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000,   // 0x0030 (48) pixels
-0x0000, 0x2106, 0x83F0, 0x83F0, 0x2106, 0x2106, 0x83F0, 0x83F0, 0x83F0, 0x2106, 0x2106, 0x83F0, 0x83F0, 0x2106, 0x0000, 0x0000,   // 0x0040 (64) pixels
-0x0000, 0x2106, 0x83F0, 0x83F0, 0x83F0, 0x83F0, 0x83F0, 0x83F0, 0x83F0, 0x83F0, 0x83F0, 0x83F0, 0x83F0, 0x2106, 0x0000, 0x0000,   // 0x0050 (80) pixels
-0x0000, 0x0000, 0x2106, 0x83F0, 0x83F0, 0x83F0, 0x6B4D, 0x6B4D, 0x6B4D, 0x83F0, 0x83F0, 0x83F0, 0x2106, 0x0000, 0x0000, 0x0000,   // 0x0060 (96) pixels
-0x0000, 0x2106, 0x2106, 0x83F0, 0x83F0, 0x6B4D, 0x2106, 0x0000, 0x2106, 0x6B4D, 0x83F0, 0x83F0, 0x2106, 0x2106, 0x0000, 0x0000,   // 0x0070 (112) pixels
-0x2106, 0x83F0, 0x83F0, 0x83F0, 0x5AAA, 0x2106, 0x0000, 0x0000, 0x0000, 0x2106, 0x5AAA, 0x83F0, 0x83F0, 0x6B4D, 0x2106, 0x0000,   // 0x0080 (128) pixels
-0x2106, 0x83F0, 0x83F0, 0x83F0, 0x5AAA, 0x2106, 0x0000, 0x0000, 0x0000, 0x2106, 0x5AAA, 0x83F0, 0x83F0, 0x6B4D, 0x2106, 0x0000,   // 0x0090 (144) pixels
-0x0000, 0x2106, 0x2106, 0x83F0, 0x83F0, 0x6B4D, 0x2106, 0x0000, 0x2106, 0x6B4D, 0x83F0, 0x83F0, 0x2106, 0x2106, 0x0000, 0x0000,   // 0x00A0 (160) pixels
-0x0000, 0x0000, 0x2106, 0x83F0, 0x83F0, 0x83F0, 0x6B4D, 0x6B4D, 0x6B4D, 0x83F0, 0x83F0, 0x83F0, 0x2106, 0x0000, 0x0000, 0x0000,   // 0x00B0 (176) pixels
-0x0000, 0x2106, 0x83F0, 0x83F0, 0x83F0, 0x6B4D, 0x83F0, 0x83F0, 0x83F0, 0x6B4D, 0x83F0, 0x6B4D, 0x6B4D, 0x2106, 0x0000, 0x0000,   // 0x00C0 (192) pixels
-0x0000, 0x2106, 0x83F0, 0x83F0, 0x2106, 0x2106, 0x83F0, 0x83F0, 0x83F0, 0x2106, 0x2106, 0x6B4D, 0x6B4D, 0x2106, 0x0000, 0x0000,   // 0x00D0 (208) pixels
-0x0000, 0x0000, 0x2106, 0x2106, 0x0000, 0x2106, 0x6B4D, 0x83F0, 0x6B4D, 0x2106, 0x0000, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000,   // 0x00E0 (224) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2106, 0x2106, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00F0 (240) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0100 (256) pixels
+// PAL4 sprite 16x16, 2 colors, 134 bytes (raw: 512 bytes)
+const uint16_t CHESS_ICON_BITS_palette [] PROGMEM = {
+0x0000, 0xFFFF, 0x2106,
+};
+const uint8_t CHESS_ICON_BITS_indices [] PROGMEM = {
+0x11, 0x11, 0x11, 0x21, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x22, 0x12, 0x21, 0x11, 0x11, 0x11, 0x12, 0x12, 0x22, 0x22, 0x12, 0x11, 0x11, 0x11, 0x21, 0x21, 0x22,
+0x22, 0x21, 0x21, 0x11, 0x12, 0x12, 0x12, 0x22, 0x12, 0x21, 0x21, 0x11, 0x21, 0x22, 0x22, 0x11, 0x22, 0x21, 0x22, 0x11, 0x21, 0x22, 0x11, 0x21, 0x22, 0x22, 0x12, 0x11,
+0x12, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x11, 0x11, 0x22, 0x11, 0x21, 0x22, 0x22, 0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x22, 0x21, 0x21, 0x11, 0x11, 0x11, 0x21, 0x22,
+0x22, 0x21, 0x21, 0x11, 0x11, 0x12, 0x12, 0x22, 0x22, 0x21, 0x21, 0x11, 0x11, 0x12, 0x12, 0x22, 0x22, 0x21, 0x21, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11,
+0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11,
+};
+const Sprite CHESS_ICON_BITS = {SPRITE_PAL4, 16, 16, 3, CHESS_ICON_BITS_palette, CHESS_ICON_BITS_indices};
 
+// PAL4 sprite 16x16, 4 colors, 138 bytes (raw: 512 bytes)
+const uint16_t SETTINGS_ICON_BITS_palette [] PROGMEM = {
+0x0000, 0x83F0, 0x2106, 0x6B4D, 0x5AAA,
+};
+const uint8_t SETTINGS_ICON_BITS_indices [] PROGMEM = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x11, 0x12, 0x02, 0x20, 0x00, 0x02, 0x11, 0x22, 0x11,
+0x12, 0x21, 0x12, 0x00, 0x02, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x21, 0x11, 0x33, 0x31, 0x11, 0x20, 0x00, 0x02, 0x21, 0x13, 0x20, 0x23, 0x11, 0x22, 0x00,
+0x21, 0x11, 0x42, 0x00, 0x02, 0x41, 0x13, 0x20, 0x21, 0x11, 0x42, 0x00, 0x02, 0x41, 0x13, 0x20, 0x02, 0x21, 0x13, 0x20, 0x23, 0x11, 0x22, 0x00, 0x00, 0x21, 0x11, 0x33,
+0x31, 0x11, 0x20, 0x00, 0x02, 0x11, 0x13, 0x11, 0x13, 0x13, 0x32, 0x00, 0x02, 0x11, 0x22, 0x11, 0x12, 0x23, 0x32, 0x00, 0x00, 0x22, 0x02, 0x31, 0x32, 0x02, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
+const Sprite SETTINGS_ICON_BITS = {SPRITE_PAL4, 16, 16, 5, SETTINGS_ICON_BITS_palette, SETTINGS_ICON_BITS_indices};
 
 #endif
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef BITBASE_H
+#define BITBASE_H
+
+#include <stdint.h>
+#include "chessPosition.h"
+#include "bitbaseData.h"
+
+// Results of probeBitbase().
+#define BITBASE_UNKNOWN -1 // not a position the bitbases cover
+#define BITBASE_DRAW 0
+#define BITBASE_WIN 1      // the side with the pawn or rook wins
+
+// Win/draw bitbases for king and pawn against king (KPK) and king and rook against
+// king (KRK), one bit per position, generated by tools/bitbase_gen.cpp. Positions
+// are stored with the strong side as white; a position with the strong side black
+// is mirrored top to bottom first. Symmetry shrinks the tables further:
+//  - KPK: the board is mirrored left to right so the pawn is on files a-d.
+//    Index ((toMove * 24 + pawn) * 64 + strongKing) * 64 + weakKing, where pawn is
+//    (row - 1) * 4 + file for the pawn's row 1-6 (a8-first numbering).
+//  - KRK: the board is mirrored and reflected so the strong king is in the
+//    a1-d1-d4 triangle. Index ((toMove * 10 + triangle) * 64 + rook) * 64 + weakKing.
+// toMove is 0 when the strong side moves. Illegal placements read as draws.
+namespace bitbase {
+
+constexpr int KPK_POSITIONS = 2 * 24 * 64 * 64;
+constexpr int KRK_POSITIONS = 2 * 10 * 64 * 64;
+
+inline int fileOf(int square) { return square % 8; }
+inline int rankOf(int square) { return 7 - square / 8; } // 0 = rank 1
+inline int squareAt(int file, int rank) { return (7 - rank) * 8 + file; }
+
+// Position of each a1-d1-d4 triangle square in the KRK index, -1 outside it.
+constexpr int8_t triangleIndex(int square) {
+    int file = square % 8, rank = 7 - square / 8, index = 0;
+    for (int r = 0; r < 4; r++) {
+        for (int f = r; f < 4; f++) {
+            if (f == file && r == rank) {
+                return (int8_t)index;
+            }
+            index++;
+        }
+    }
+    return -1;
+}
+
+inline bool bit(const uint8_t *table, uint32_t index) { return (table[index >> 3] >> (index & 7)) & 1; }
+
+/**
+ * @brief Looks up KPK with the strong side as white.
+ * @param whiteToMove Whether the side with the pawn moves.
+ */
+inline bool kpkWins(int strongKing, int pawn, int weakKing, bool whiteToMove) {
+    if (fileOf(pawn) > 3) {
+        strongKing ^= 7;
+        pawn ^= 7;
+        weakKing ^= 7;
+    }
+    uint32_t pawnIndex = (pawn / 8 - 1) * 4 + fileOf(pawn);
+    return bit(kpkBits, ((((whiteToMove ? 0 : 1) * 24 + pawnIndex) * 64 + strongKing) * 64) + weakKing);
+}
+
+/**
+ * @brief Looks up KRK with the strong side as white.
+ */
+inline bool krkWins(int strongKing, int rook, int weakKing, bool whiteToMove) {
+    int squares[3] = {strongKing, rook, weakKing};
+    if (fileOf(strongKing) > 3) {
+        for (int &square : squares) {
+            square ^= 7;
+        }
+    }
+    if (rankOf(squares[0]) > 3) {
+        for (int &square : squares) {
+            square ^= 56;
+        }
+    }
+    if (rankOf(squares[0]) > fileOf(squares[0])) {
+        for (int &square : squares) {
+            square = squareAt(rankOf(square), fileOf(square)); // reflect in the a1-h8 diagonal
+        }
+    }
+    uint32_t triangle = (uint32_t)triangleIndex(squares[0]);
+    return bit(krkBits, ((((whiteToMove ? 0 : 1) * 10 + triangle) * 64 + squares[1]) * 64) + squares[2]);
+}
+
+} // namespace bitbase
+
+/**
+ * @brief Win/draw result for a KPK or KRK position, in O(1).
+ * @return BITBASE_WIN, BITBASE_DRAW, or BITBASE_UNKNOWN for any other material.
+ */
+inline int probeBitbase(const ChessPosition &position) {
+    if (popCount(position.occupied()) != 3) {
+        return BITBASE_UNKNOWN;
+    }
+    for (int strong = 1; strong >= -1; strong -= 2) {
+        Bitboard pawns = position.pieces(CHESS_PAWN * strong);
+        Bitboard rooks = position.pieces(CHESS_ROOK * strong);
+        if (!pawns && !rooks) {
+            continue;
+        }
+        int flip = strong > 0 ? 0 : 56; // mirror so the strong side is white
+        int strongKing = position.kingSquare(strong) ^ flip;
+        int weakKing = position.kingSquare(-strong) ^ flip;
+        bool strongToMove = position.sideToMove() == strong;
+        bool wins = pawns ? bitbase::kpkWins(strongKing, lowestSquare(pawns) ^ flip, weakKing, strongToMove)
+                          : bitbase::krkWins(strongKing, lowestSquare(rooks) ^ flip, weakKing, strongToMove);
+        return wins ? BITBASE_WIN : BITBASE_DRAW;
+    }
+    return BITBASE_UNKNOWN;
+}
+
+#endif
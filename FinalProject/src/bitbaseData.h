@@ -0,0 +1,2189 @@
+#ifndef BITBASEDATA_H
+#define BITBASEDATA_H
+
+#include <stdint.h>
+
+// Generated by tools/bitbase_gen.cpp; layout in bitbase.h. Checksum 99613919. Do not edit.
+const uint8_t kpkBits[24576] = {
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC4, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC4, 0xC4, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x1C, 0x1C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xC4, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x8C, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0x1C, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3C, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFC, 0xFC, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xFC, 0xFC, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x18, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0x18, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFA, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFA, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xFA, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFA, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF8, 0xF8, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xF8, 0xF8, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF8, 0xF8, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xF8, 0xF8, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF4, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC5, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x11, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF5, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF5, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0x11, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF5, 0xF1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF5, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF5, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF5, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF5, 0xF1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x87, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x87, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE3, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xEB, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xEB, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xEB, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xEB, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xEB, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE3, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xE3, 0xE3, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xE3, 0xE3, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xE3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x18, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0x18, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x88, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0x18, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x38, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xFC, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x10, 0x10, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFE, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFA, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xE0, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0x10, 0x10, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x30, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFD, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xFD, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x80, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0x10, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x30, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF0, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF8, 0xF0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC3, 0xC1, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC3, 0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFB, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFB, 0xC1, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFB, 0xF1, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xFB, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xFB, 0xF1, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF0, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF1, 0xF1, 0xE1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xE1, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x03, 0x03, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFB, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xEF, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x83, 0x87, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF7, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF7, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0x87, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0x01, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE3, 0xE1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xE3, 0xE3, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xC3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xE3, 0xE3, 0xC3, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x10, 0x10, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x10, 0x10, 0x10, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0x10, 0x10, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x30, 0x30, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x80, 0x8F, 0x8F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0x10, 0x1F, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x30, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xC7, 0xC7, 0xC7, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0x8F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0x1F, 0x1F, 0x1F, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0x3F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x8F, 0x8F, 0x8F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x1F, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x3F, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x3F, 0x3F,
+0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFC, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xF9, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE0, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x20, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF0, 0xF0, 0xE0, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x80, 0x8F, 0x8F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0x00, 0x1F, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x20, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xC7, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF8, 0xF8, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC3, 0xC3, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xC1, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xF8, 0xF0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC3, 0xC1, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xC3, 0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF9, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF3, 0xC1, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xE1, 0x81, 0x81, 0x8F, 0xFF, 0xFF, 0xFF,
+0xE0, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xE1, 0xE1, 0xE1, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xE1, 0xE1, 0xC1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0x00, 0x1F, 0x1F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x3F, 0x3F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC1, 0xC7, 0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC1, 0x8F, 0x8F, 0x8F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x1F, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF1, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x87, 0xC3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0x03, 0x03, 0x83, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xE1, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC7, 0xC3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x87, 0x83, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+0x03, 0x03, 0x03, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xC7, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x83, 0x87, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE1, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xE0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xE7, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0x87, 0x8F, 0xFF, 0xFF, 0xFF,
+0xE3, 0xC3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0x81, 0x01, 0x01, 0x3F, 0xFF, 0xFF, 0xFF,
+0xE1, 0xE1, 0xE0, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xE1, 0xE1, 0xE1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE1, 0xE1, 0xE1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xC3, 0xC3, 0xC3, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0x87, 0x8F, 0x8F, 0xFF, 0xFF,
+0xC3, 0xC3, 0x83, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x01, 0x3F, 0x3F, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xFC, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xC1, 0xC1, 0xC1, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+0xC1, 0xC1, 0xC1, 0xE3, 0xC7, 0xC7, 0xC7, 0xFF, 0x81, 0x81, 0x81, 0x83, 0x8F, 0x8F, 0x8F, 0xFF,
+0x81, 0x81, 0x81, 0x83, 0x1F, 0x1F, 0x1F, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x3F, 0x3F, 0x3F, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF8, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xF1, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE3, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8F, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0x1F, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x3F, 0x3F,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF,
+0xE0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x20, 0xE0, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x80, 0x80, 0x8F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x20, 0x20, 0x3F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x8F, 0x8F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x20, 0x3F, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F,
+0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE1, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFC, 0xFC, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xE0, 0xF9, 0xFF, 0xFF, 0xFF,
+0xF8, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFE, 0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFB, 0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xE1, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF,
+0xF8, 0xE8, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xD0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFF, 0xFC, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xF9, 0xFF, 0xF9, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xFD, 0xF1, 0xE0, 0xE1, 0xE3, 0xFF, 0xFF,
+0xE0, 0xF8, 0xE0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xC0, 0xF0, 0xC0, 0x80, 0x80, 0x8F, 0xFF, 0xFF,
+0xC0, 0xE0, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xE1, 0xE3, 0xE3, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x8F, 0x8F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x1F, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x3F, 0x3F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x3F,
+0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF1, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF1, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xC3, 0xC3, 0xE1, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xC1, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0xFC, 0xF8, 0xF8, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC3, 0xC3, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xC1, 0xE1, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF8, 0xF8, 0xF0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xFB, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xFB, 0xFF, 0xFF, 0xFF,
+0xFF, 0xC3, 0xC3, 0xC1, 0xF3, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x81, 0xE1, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFA, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF,
+0xFF, 0xEB, 0xC3, 0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xD1, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF,
+0xE0, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xF8, 0xFB, 0xF8, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xF3, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF,
+0xE3, 0xFB, 0xE3, 0xC1, 0xC3, 0xC7, 0xFF, 0xFF, 0xC1, 0xF1, 0xC1, 0x81, 0x81, 0x8F, 0xFF, 0xFF,
+0x80, 0xE0, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0xC0, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xE3, 0xFF,
+0xE1, 0xE1, 0xE1, 0xE1, 0xC3, 0xC7, 0xC7, 0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0x81, 0x8F, 0x8F, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x00, 0x1F, 0x1F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x3F, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF8, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE3, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0x8F, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xE3, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC7, 0xE3, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x87, 0x87, 0xC3, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF,
+0x03, 0x03, 0x83, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x87, 0x87, 0xC3, 0xE3, 0xFF, 0xFF, 0xFF,
+0x03, 0x03, 0x03, 0x83, 0xC3, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x81, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE0, 0xE0, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xF3, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xE1, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x87, 0x83, 0xE7, 0xFF, 0xFF, 0xFF,
+0xE3, 0x03, 0x03, 0x03, 0xC3, 0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x01, 0x81, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE2, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xF0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFB, 0xF1, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xFF, 0xEF, 0xC7, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x87, 0x83, 0x87, 0xFF, 0xFF, 0xFF,
+0xE3, 0xA3, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0x41, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE3, 0xE0, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xF1, 0xF7, 0xF1, 0xE0, 0xF0, 0xF8, 0xFF, 0xFF,
+0xF3, 0xFF, 0xF3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xE7, 0xFF, 0xE7, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xC7, 0xF7, 0xC7, 0x83, 0x87, 0x8F, 0xFF, 0xFF,
+0x83, 0xE3, 0x83, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0x01, 0xC1, 0x01, 0x01, 0x01, 0x3F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xF0, 0xF8, 0xF8, 0xFF,
+0xE1, 0xE1, 0xE1, 0xE1, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0xC7, 0xC7, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0x87, 0x8F, 0x8F, 0xFF,
+0x83, 0x83, 0x83, 0x83, 0x03, 0x1F, 0x1F, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3F, 0x3F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xF8, 0xF8,
+0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xF1, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xE3,
+0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xC7, 0xC7, 0xC7, 0x81, 0x81, 0x81, 0x81, 0x83, 0x8F, 0x8F, 0x8F,
+0x81, 0x81, 0x81, 0x81, 0x83, 0x1F, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3F, 0x3F, 0x3F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8F, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x3F,
+0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF,
+0xF8, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFF, 0xFF,
+0xE0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xFF, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF,
+0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE3, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x8F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F,
+0xFC, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE1, 0xE1, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF8, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE1, 0xE1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+0xC7, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE1, 0xF0, 0xF8, 0xFF, 0xFF,
+0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xE0, 0xF9, 0xFF, 0xFF,
+0xFF, 0xF8, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFB, 0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xE1, 0xE0, 0xE1, 0xFF, 0xFF,
+0xFF, 0xF8, 0xE8, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF0, 0xF0, 0xD0, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xE0, 0xE0, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xFF, 0xFC, 0xFF, 0xFC, 0xF8, 0xFC, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xF9, 0xFF, 0xF9, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xFD, 0xF1, 0xE0, 0xE1, 0xE3, 0xFF,
+0xFF, 0xE0, 0xF8, 0xE0, 0xC0, 0xC0, 0xC7, 0xFF, 0xF0, 0xC0, 0xF0, 0xC0, 0x80, 0x80, 0x8F, 0xFF,
+0xE0, 0x80, 0xE0, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x80, 0xC0, 0x80, 0x00, 0x00, 0x3F, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE1, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F,
+0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0xF1, 0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0xC3, 0xC3, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x81, 0x81, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xE0, 0xE0, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xE0, 0xE0, 0xFF, 0xFF,
+0xC7, 0xC3, 0xC3, 0xE1, 0xE0, 0xE0, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xC1, 0xC0, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xFF, 0xFC, 0xF8, 0xF8, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xFF, 0xFF,
+0xFF, 0xC7, 0xC3, 0xC3, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xC1, 0xE1, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xFB, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xFB, 0xFF, 0xFF,
+0xFF, 0xFF, 0xC3, 0xC3, 0xC1, 0xF3, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x81, 0xE1, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFA, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE1, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEB, 0xC3, 0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xD1, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+0xE0, 0xE0, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xFF, 0xF8, 0xFB, 0xF8, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xF0, 0xF8, 0xF8, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xFF, 0xF3, 0xE1, 0xE3, 0xE3, 0xFF,
+0xFF, 0xE3, 0xFB, 0xE3, 0xC1, 0xC3, 0xC7, 0xFF, 0xFF, 0xC1, 0xF1, 0xC1, 0x81, 0x81, 0x8F, 0xFF,
+0xE0, 0x80, 0xE0, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
+0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xE3,
+0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xC3, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x81, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xF0, 0xF0, 0xC1, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xF1, 0xF1, 0xC1, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xE3, 0xE3, 0xC1, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xC7, 0xC7, 0xC1, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x87, 0x87, 0xC1, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0x03, 0x03, 0x81, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xFC, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xE1, 0xC1, 0xC1, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xE3, 0xC1, 0xC1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xFF, 0xFF,
+0xC7, 0xC7, 0xC7, 0xE3, 0xC1, 0xC1, 0xFF, 0xFF, 0x8F, 0x87, 0x87, 0xC3, 0xC1, 0xC1, 0xFF, 0xFF,
+0x1F, 0x03, 0x03, 0x83, 0x81, 0x81, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF,
+0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xE1, 0xE3, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x87, 0x87, 0xC3, 0xE3, 0xFF, 0xFF,
+0xFF, 0x03, 0x03, 0x03, 0x83, 0xC3, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x01, 0x01, 0x81, 0xFF, 0xFF,
+0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xF3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF, 0xFF,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x87, 0x83, 0xE7, 0xFF, 0xFF,
+0xFF, 0xE3, 0x03, 0x03, 0x03, 0xC3, 0xFF, 0xFF, 0xC1, 0xC1, 0x01, 0x01, 0x01, 0x81, 0xFF, 0xFF,
+0xFF, 0xE3, 0xE2, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xF0, 0xE0, 0xF0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFB, 0xF1, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEF, 0xC7, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x87, 0x83, 0x87, 0xFF, 0xFF,
+0xFF, 0xE3, 0xA3, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xC1, 0xC1, 0x41, 0x01, 0x01, 0x01, 0xFF, 0xFF,
+0xFF, 0xE0, 0xE3, 0xE0, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xF1, 0xF7, 0xF1, 0xE0, 0xF0, 0xF8, 0xFF,
+0xFF, 0xF3, 0xFF, 0xF3, 0xE1, 0xF1, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xE7, 0xFF, 0xE7, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xC7, 0xF7, 0xC7, 0x83, 0x87, 0x8F, 0xFF,
+0xFF, 0x83, 0xE3, 0x83, 0x03, 0x03, 0x1F, 0xFF, 0xC1, 0x01, 0xC1, 0x01, 0x01, 0x01, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xF0, 0xF8, 0xF8,
+0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x87, 0x8F, 0x8F,
+0x83, 0x83, 0x83, 0x83, 0x83, 0x03, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xF8,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xC7, 0xC7, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x8F, 0x8F,
+0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3F, 0x3F,
+0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF,
+0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFE, 0xFF, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xFF,
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF,
+0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFE, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFE, 0xFF,
+0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFE, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFF,
+0xF8, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFE, 0xFF,
+0xE0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xFE, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0xF0, 0xFE, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFE, 0xFF,
+0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFE, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFE, 0xFF,
+0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xF8, 0xFE, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xF0, 0xFE, 0xFF,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0xFE, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFE, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFE, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFE, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFE, 0xFF,
+0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFE, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xFE, 0xFF,
+0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xF0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE2, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x8E, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x1E, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x3E, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE2, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x8E, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x1E, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x3E, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE2, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8E, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1E, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3E, 0x3F,
+0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xFF,
+0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xFF, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xFF,
+0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xFF, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xFD, 0xFF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0xFF,
+0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xFD, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xFD, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFD, 0xFF, 0xE3, 0xE1, 0xE1, 0xF0, 0xF0, 0xF0, 0xFD, 0xFF,
+0xC7, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFD, 0xFF, 0x8F, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFD, 0xFF,
+0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFD, 0xFF,
+0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xFD, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xFD, 0xFF, 0xFF, 0xE3, 0xE1, 0xE1, 0xF0, 0xF8, 0xFD, 0xFF,
+0xFF, 0xC7, 0xC0, 0xC0, 0xE0, 0xF8, 0xFD, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xF0, 0xFD, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFD, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xFD, 0xFF,
+0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE1, 0xF8, 0xFD, 0xFF,
+0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xF8, 0xFD, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x80, 0xF0, 0xFD, 0xFF,
+0xE0, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFD, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFD, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFD, 0xFF,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xE0, 0xFD, 0xFF,
+0xFF, 0xFF, 0xF8, 0xC0, 0xC0, 0xC0, 0xFD, 0xFF, 0xFF, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0xFD, 0xFF,
+0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xE1, 0xE0, 0xE1, 0xFF,
+0xFF, 0xFF, 0xF8, 0xE8, 0xC0, 0xC0, 0xC5, 0xFF, 0xFF, 0xF0, 0xF0, 0xD0, 0x80, 0x80, 0x8D, 0xFF,
+0xE0, 0xE0, 0xE0, 0xA0, 0x00, 0x00, 0x1D, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x3D, 0xFF,
+0xFF, 0xFF, 0xFC, 0xFF, 0xFC, 0xF8, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xFD, 0xF1, 0xE0, 0xE1, 0xE3,
+0xFF, 0xFF, 0xE0, 0xF8, 0xE0, 0xC0, 0xC5, 0xC7, 0xFF, 0xF0, 0xC0, 0xF0, 0xC0, 0x80, 0x8D, 0x8F,
+0xE0, 0xE0, 0x80, 0xE0, 0x80, 0x00, 0x1D, 0x1F, 0xC0, 0xC0, 0x80, 0xC0, 0x80, 0x00, 0x3D, 0x3F,
+0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE1, 0xE3,
+0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC5, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8D, 0x8F,
+0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1D, 0x1F, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3D, 0x3F,
+0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xFB, 0xFF, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xFB, 0xFF,
+0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xFB, 0xFF, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xFB, 0xFF,
+0xC3, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xFB, 0xFF, 0x81, 0x81, 0xC0, 0xC0, 0xC0, 0xC0, 0xFB, 0xFF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+0xFC, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xFB, 0xFF, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xFB, 0xFF,
+0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFB, 0xFF, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xFB, 0xFF,
+0xC7, 0xC3, 0xC3, 0xE0, 0xE0, 0xE0, 0xFB, 0xFF, 0x8F, 0x81, 0x81, 0xC0, 0xC0, 0xC0, 0xFB, 0xFF,
+0x1F, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+0xFF, 0xFC, 0xF8, 0xF8, 0xF0, 0xF1, 0xFB, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xFB, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xFB, 0xFF,
+0xFF, 0xC7, 0xC3, 0xC3, 0xE1, 0xF1, 0xFB, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xC1, 0xF1, 0xFB, 0xFF,
+0xFF, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFB, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFB, 0xFF,
+0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xFB, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xFB, 0xFF,
+0xFF, 0xFF, 0xC7, 0xC3, 0xC3, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xF1, 0xFB, 0xFF,
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFB, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFB, 0xFF,
+0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xFB, 0xFF,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xFB, 0xFF,
+0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0xC1, 0xFB, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x81, 0xFB, 0xFF,
+0xFF, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFB, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFA, 0xF8, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF0, 0xF8, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE1, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFF, 0xEB, 0xC3, 0xC1, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xD1, 0x81, 0x81, 0x8B, 0xFF,
+0xFF, 0xE0, 0xE0, 0xA0, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0xC0, 0xC0, 0x40, 0x00, 0x00, 0x3B, 0xFF,
+0xFF, 0xFF, 0xF8, 0xFB, 0xF8, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xF9, 0xFF, 0xF9, 0xF0, 0xF8, 0xF8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xF3, 0xE1, 0xE3, 0xE3,
+0xFF, 0xFF, 0xE3, 0xFB, 0xE3, 0xC1, 0xC3, 0xC7, 0xFF, 0xFF, 0xC1, 0xF1, 0xC1, 0x81, 0x8B, 0x8F,
+0xFF, 0xE0, 0x80, 0xE0, 0x80, 0x00, 0x1B, 0x1F, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x3B, 0x3F,
+0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3,
+0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xC3, 0xC7, 0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x8B, 0x8F,
+0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1B, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x3F,
+0xE0, 0xE0, 0x80, 0x80, 0x80, 0x80, 0xF7, 0xFF, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0xF7, 0xFF,
+0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0xF7, 0xFF, 0xE3, 0xE3, 0x80, 0x80, 0x80, 0x80, 0xF7, 0xFF,
+0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0xF7, 0xFF, 0x87, 0x87, 0x80, 0x80, 0x80, 0x80, 0xF7, 0xFF,
+0x03, 0x03, 0x80, 0x80, 0x80, 0x80, 0xF7, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+0xFC, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xF7, 0xFF, 0xF8, 0xF0, 0xF0, 0xC1, 0xC1, 0xC1, 0xF7, 0xFF,
+0xF1, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xF7, 0xFF, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xF7, 0xFF,
+0xC7, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xF7, 0xFF, 0x8F, 0x87, 0x87, 0xC1, 0xC1, 0xC1, 0xF7, 0xFF,
+0x1F, 0x03, 0x03, 0x81, 0x81, 0x81, 0xF7, 0xFF, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x01, 0xF7, 0xFF,
+0xFF, 0xFC, 0xE0, 0xE0, 0xE0, 0xE3, 0xF7, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xE1, 0xE3, 0xF7, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xF7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xF7, 0xFF, 0xFF, 0x8F, 0x87, 0x87, 0xC3, 0xE3, 0xF7, 0xFF,
+0xFF, 0x1F, 0x03, 0x03, 0x83, 0xE3, 0xF7, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xC1, 0xF7, 0xFF,
+0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xE3, 0xF7, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0x8F, 0x87, 0x87, 0xE3, 0xF7, 0xFF,
+0xFF, 0xFF, 0x03, 0x03, 0x03, 0xE3, 0xF7, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x01, 0xC1, 0xF7, 0xFF,
+0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xF7, 0xFF,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7, 0xFF,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x87, 0x83, 0xF7, 0xFF,
+0xFF, 0xFF, 0xE3, 0x03, 0x03, 0x03, 0xF7, 0xFF, 0xFF, 0xC1, 0xC1, 0x01, 0x01, 0x01, 0xF7, 0xFF,
+0xFF, 0xFF, 0xE3, 0xE2, 0xE0, 0xE0, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xF0, 0xE0, 0xF0, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFF, 0xEF, 0xC7, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x87, 0x83, 0x87, 0xFF,
+0xFF, 0xFF, 0xE3, 0xA3, 0x03, 0x03, 0x17, 0xFF, 0xFF, 0xC1, 0xC1, 0x41, 0x01, 0x01, 0x37, 0xFF,
+0xFF, 0xFF, 0xE0, 0xE3, 0xE0, 0xE0, 0xF4, 0xFC, 0xFF, 0xFF, 0xF1, 0xF7, 0xF1, 0xE0, 0xF0, 0xF8,
+0xFF, 0xFF, 0xF3, 0xFF, 0xF3, 0xE1, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xE7, 0xFF, 0xE7, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xC7, 0xF7, 0xC7, 0x83, 0x87, 0x8F,
+0xFF, 0xFF, 0x83, 0xE3, 0x83, 0x03, 0x17, 0x1F, 0xFF, 0xC1, 0x01, 0xC1, 0x01, 0x01, 0x37, 0x3F,
+0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF4, 0xFC, 0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xF0, 0xF8,
+0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0xC7, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x87, 0x8F,
+0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0x17, 0x1F, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x37, 0x3F,
+0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x18, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0x18, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x38, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x88, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0x18, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x38, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x10, 0x10, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFA, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFA, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0x10, 0x10, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x30, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x80, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0x10, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x30, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xC1, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x01, 0x01, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC0, 0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEB, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEB, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0x01, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x01, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0x81, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0x01, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0x01, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F,
+0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x10, 0x10, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x10, 0x10, 0x10, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0x10, 0x10, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x30, 0x30, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x80, 0x8F, 0x8F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0x10, 0x1F, 0x1F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0x30, 0x3F, 0x3F, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xC7, 0xC7, 0xC7, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x8F, 0x8F, 0x8F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0x1F, 0x1F, 0x1F, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x3F, 0x3F, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xC7, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x8F, 0x8F, 0x8F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x1F, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x3F, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xC7, 0xC7, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x8F, 0x8F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x1F, 0x1F, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x3F, 0x3F,
+0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFD, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xF5, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x20, 0x3F, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF0, 0xE0, 0xE0, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x80, 0x8F, 0x8F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0x00, 0x1F, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x20, 0x3F, 0x3F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xC7, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xE1, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xC1, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x8F, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF,
+0xE0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xFF, 0xFF, 0xE0, 0xC0, 0xC0, 0x80, 0x8F, 0x8F, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0x00, 0x1F, 0x1F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x3F, 0x3F, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xE3, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x8F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x1F, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF1, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE1, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xC3, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
+0x01, 0x01, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0x01, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xD7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC0, 0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x83, 0x8F, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0x01, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xFF, 0xFF, 0xC1, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xC1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC7, 0xC7, 0xFF, 0xFF, 0xC1, 0x81, 0x81, 0x81, 0x8F, 0x8F, 0xFF, 0xFF,
+0xC1, 0x81, 0x81, 0x01, 0x1F, 0x1F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x3F, 0x3F, 0xFF, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0xFC, 0xFC, 0xFC, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xF8, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0xF1, 0xF1, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xE3, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x1F, 0x1F, 0x1F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x3F, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF8, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xF1, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE3, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8F, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0x1F, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x3F, 0x3F,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF,
+0xE0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x20, 0x20, 0xE0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x80, 0x80, 0x8F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x20, 0x20, 0x3F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC7, 0xC7, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x8F, 0x8F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x1F, 0x1F, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x20, 0x3F, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC7, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1F, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x3F, 0x3F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE3, 0xE3,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xC7, 0xC7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x8F, 0x8F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x1F, 0x1F, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0x3F, 0x3F,
+0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF,
+0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x8F, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x8F, 0x8F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x1F, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x3F, 0x3F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x3F,
+0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xE1, 0xE1, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF1, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xE1, 0xE1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC1, 0xE3, 0xE3, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC7, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x8F, 0xFF, 0xFF,
+0x80, 0x80, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xF8, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE3, 0xE3, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x00, 0x1F, 0x1F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x3F, 0x3F, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F, 0x3F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xFF,
+0xF1, 0xE1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC3, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x81, 0x81, 0xC1, 0xFF, 0xFF, 0xFF,
+0x01, 0x01, 0x01, 0x01, 0x81, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xC3, 0xC3, 0xFF, 0xFF, 0xFF,
+0x01, 0x01, 0x01, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xC1, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xE3, 0xFF, 0xFF, 0xFF,
+0xC1, 0x01, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF,
+0xE1, 0xE1, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xC3, 0xC3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0x83, 0x83, 0x83, 0xFF, 0xFF, 0xFF,
+0x81, 0x81, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xF1, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0x81, 0x81, 0x81, 0x83, 0xC7, 0xC7, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x83, 0x83, 0x8F, 0xFF, 0xFF,
+0x81, 0x01, 0x01, 0x01, 0x01, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0xC0, 0xFC, 0xFC, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xF8, 0xF8, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0xC1, 0xF1, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xE3, 0xE3, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0xC1, 0xC7, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0x8F, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0xE3,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xF8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xE3,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x3F,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE3, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x8F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x8F, 0x8F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x3F,
+0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xF1, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF, 0xFF,
+0xF0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF,
+0xFC, 0xFD, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xFA, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xE8, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF, 0xFF,
+0xC0, 0xD0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0x80, 0xA0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x3F, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x3F, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3F, 0x3F,
+0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE3, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF,
+0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF,
+0xF1, 0xC1, 0xC1, 0xC1, 0xE1, 0xE1, 0xFF, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xF8, 0xFA, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xEB, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xC1, 0xD1, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0x80, 0xA0, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0xFF,
+0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xE3, 0xE3, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xF1, 0xC1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xE3, 0xC1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0xC7, 0xC1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF,
+0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF,
+0xF1, 0xF1, 0xE1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF,
+0xC7, 0xC7, 0xC3, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0x81, 0x81, 0xC1, 0xFF, 0xFF,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xC3, 0xC3, 0xFF, 0xFF,
+0xC1, 0x01, 0x01, 0x01, 0x81, 0x81, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xC0, 0xC1, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xE0, 0xE2, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF,
+0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xEB, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF,
+0xC7, 0xD7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0x83, 0xA3, 0x83, 0x83, 0x83, 0xE3, 0xFF, 0xFF,
+0x01, 0x41, 0x01, 0x01, 0x01, 0xC1, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xE1, 0xE1, 0xE1, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xFF, 0xFF,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF8, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xF1, 0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3, 0xFF,
+0x81, 0x81, 0x81, 0x81, 0x83, 0xC7, 0xC7, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x8F, 0xFF,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xE3, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
+0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFF,
+0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF,
+0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xFC, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF8, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xFF,
+0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x3F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x1F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x3F,
+0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF,
+0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFC, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+0xF1, 0xF1, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF,
+0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFF,
+0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0xFC, 0xFD, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xFA, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xE8, 0xE0, 0xE0, 0xE0, 0xF8, 0xFF,
+0xF0, 0xC0, 0xD0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFF, 0xE0, 0x80, 0xA0, 0x80, 0x80, 0x80, 0xE0, 0xFF,
+0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF,
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+0xF0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xF8, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0xF1, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE3, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0xC1, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xF0, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF,
+0xF1, 0xF1, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE3, 0xE3, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF,
+0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xE0, 0xE0, 0xE0, 0xFF,
+0xFF, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xE0, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFF,
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xF1, 0xC1, 0xC1, 0xC1, 0xE1, 0xE1, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFF,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xF8, 0xFA, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xEB, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xC1, 0xD1, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xE0, 0x80, 0xA0, 0x80, 0x80, 0x80, 0xE0, 0xFF,
+0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xFF,
+0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xE3, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xF1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xC7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0xF1, 0xF1, 0xC1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xE3, 0xE3, 0xC1, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0xC7, 0xC7, 0xC1, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x83, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0xFF,
+0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC1, 0xFF,
+0xFF, 0xF1, 0xF1, 0xE1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC3, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0x81, 0x81, 0xC1, 0xFF,
+0xC1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xC3, 0xC3, 0xFF,
+0xC1, 0xC1, 0x01, 0x01, 0x01, 0x81, 0x81, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xC1, 0xC0, 0xC1, 0xC0, 0xC0, 0xC0, 0xC1, 0xFF, 0xFF, 0xE0, 0xE2, 0xE0, 0xE0, 0xE0, 0xE3, 0xFF,
+0xFF, 0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xEB, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xC7, 0xD7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0x83, 0xA3, 0x83, 0x83, 0x83, 0xE3, 0xFF,
+0xC1, 0x01, 0x41, 0x01, 0x01, 0x01, 0xC1, 0xFF, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xF1, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0xC7, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xFF,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xE3,
+0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0xC7, 0xC7, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x8F,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xE3,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC,
+0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC,
+0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFC,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFC, 0xFC,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xFC,
+0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFC,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC,
+0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xFC, 0xFC,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xFC,
+0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFC, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFC,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xFC, 0xFC,
+0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFC, 0xFC,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xFC,
+0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFC,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xFF,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xFC,
+0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC,
+0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE0,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8C,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x1C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x3C,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8C,
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x1C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x3C,
+0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8,
+0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+0xFC, 0xFC, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8,
+0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+0xFF, 0xFC, 0xFC, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+0xFF, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8,
+0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xF8,
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF8,
+0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8,
+0xFF, 0xF0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF8, 0xF8, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xF8,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF8, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE0, 0xF8, 0xF8,
+0xFF, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xF8,
+0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xF8,
+0xFF, 0xFF, 0xFC, 0xFD, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xFA, 0xF8, 0xF8, 0xF8, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE0, 0xE8, 0xE0, 0xE0, 0xE0, 0xF8,
+0xFF, 0xF0, 0xC0, 0xD0, 0xC0, 0xC0, 0xC0, 0xF8, 0xE0, 0xE0, 0x80, 0xA0, 0x80, 0x80, 0x80, 0xF8,
+0xC0, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xF8,
+0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88,
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1,
+0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1,
+0xC1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1,
+0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0xE3, 0xE3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1,
+0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+0xFF, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1,
+0xFF, 0xF1, 0xF1, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1,
+0xFF, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xF1, 0xF1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF1, 0xF1,
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF1,
+0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xF1, 0xF1, 0xF1, 0xFF, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0xF1, 0xF1,
+0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF1, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xF1,
+0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xF1, 0xC1, 0xC1, 0xC1, 0xF1, 0xF1, 0xFF, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0xF1, 0xF1,
+0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xF1,
+0xFF, 0xFF, 0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xF8, 0xFA, 0xF8, 0xF8, 0xF8, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xEB, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xC1, 0xD1, 0xC1, 0xC1, 0xC1, 0xF1, 0xFF, 0xE0, 0x80, 0xA0, 0x80, 0x80, 0x81, 0xF1,
+0xC0, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF1, 0x80, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF1,
+0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3,
+0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8,
+0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0xF1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xE3,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3,
+0xF1, 0xF1, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0xE3, 0xE3, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3,
+0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0x83, 0x83, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3,
+0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3,
+0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xFF, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3,
+0xFF, 0xF1, 0xF1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3,
+0xFF, 0xC7, 0xC7, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3, 0xFF, 0x83, 0x83, 0x81, 0x81, 0x81, 0xE3, 0xE3,
+0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0xE3, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE3,
+0xFF, 0xC1, 0xC0, 0xC0, 0xC0, 0xC1, 0xE3, 0xE3, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xE3, 0xE3, 0xE3,
+0xFF, 0xC1, 0x01, 0x01, 0x01, 0xC1, 0xE3, 0xE3, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0xE3,
+0xFF, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x83, 0xE3, 0xE3,
+0xFF, 0xC1, 0xC1, 0x01, 0x01, 0x01, 0xE3, 0xE3, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xE3,
+0xFF, 0xC1, 0xC0, 0xC1, 0xC0, 0xC0, 0xE0, 0xE3, 0xFF, 0xFF, 0xE0, 0xE2, 0xE0, 0xE0, 0xE0, 0xE3,
+0xFF, 0xFF, 0xF1, 0xF5, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xEB, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xC7, 0xD7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0x83, 0xA3, 0x83, 0x83, 0x83, 0xE3,
+0xFF, 0xC1, 0x01, 0x41, 0x01, 0x01, 0x03, 0xE3, 0x80, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0xE3,
+0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0xC7, 0xFF, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0,
+0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xE3, 0xE3,
+0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0xC7, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+};
+
+const uint8_t krkBits[10240] = {
+0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC,
+0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF4, 0xF4,
+0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEC, 0xEC, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDC, 0xDC,
+0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBC, 0xBC, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x7C,
+0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC,
+0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF4, 0xF4,
+0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEC, 0xEC, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDC, 0xDC,
+0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBC, 0xBC, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x7C,
+0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC,
+0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF4, 0xF4,
+0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xEC, 0xEC, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xDC, 0xDC,
+0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xBC, 0xBC, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x7C, 0x7C,
+0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xFC, 0xFC,
+0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF4, 0xF4,
+0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xEC, 0xEC, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xDC, 0xDC,
+0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xBC, 0xBC, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x7C, 0x7C,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xFC, 0xFC,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF4, 0xF4,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xEC, 0xEC, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xDC, 0xDC,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xBC, 0xBC, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x7C, 0x7C,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xFC, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xFC, 0xFC,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF4, 0xF4,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xEC, 0xEC, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xDC, 0xDC,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xBC, 0xBC, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x7C, 0x7C,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xFC,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF4,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xEC, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xDC,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xBC, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x7C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0x00,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF4, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEC, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDC, 0x00,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBC, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x00,
+0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF8, 0xF8,
+0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF0, 0xF0,
+0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE8, 0xE8, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD8, 0xD8,
+0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB8, 0xB8, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x78, 0x78,
+0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xF8, 0xF8,
+0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF0, 0xF0,
+0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xE8, 0xE8, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xD8, 0xD8,
+0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xB8, 0xB8, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x78, 0x78,
+0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xF8, 0xF8,
+0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF0, 0xF0,
+0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xE8, 0xE8, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xD8, 0xD8,
+0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xB8, 0xB8, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x78, 0x78,
+0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xF8, 0xF8, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xF8, 0xF8,
+0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF0, 0xF0,
+0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xE8, 0xE8, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xD8, 0xD8,
+0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xB8, 0xB8, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x78, 0x78,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xF8, 0xF8, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xF8, 0xF8,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF0, 0xF0,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xE8, 0xE8, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xD8, 0xD8,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xB8, 0xB8, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x78, 0x78,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF8, 0xF8, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF8, 0xF8,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF0, 0xF0,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE8, 0xE8, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD8, 0xD8,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB8, 0xB8, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x78, 0x78,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF8, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF8,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF0,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE8, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD8,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB8, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x78,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF0, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE8, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD8, 0x00,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB8, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x78, 0x00,
+0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1,
+0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF1, 0xF1, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1,
+0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1,
+0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x71,
+0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1,
+0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xF1, 0xF1, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1,
+0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1,
+0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x71,
+0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1,
+0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xF1, 0xF1, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1,
+0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1,
+0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x71, 0x71,
+0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xF1, 0xF1,
+0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xF1, 0xF1, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF1, 0xF1,
+0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xE1, 0xE1, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xD1, 0xD1,
+0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xB1, 0xB1, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x71, 0x71,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xF1, 0xF1,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xF1, 0xF1, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF1, 0xF1,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xE1, 0xE1, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xD1, 0xD1,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xB1, 0xB1, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x71, 0x71,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF1, 0xF1,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF1, 0xF1, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF1, 0xF1,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE1, 0xE1, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD1, 0xD1,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB1, 0xB1, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x71, 0x71,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF1,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF1, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF1,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE1, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD1,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB1, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x71,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0x01,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0x01, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0x01,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x01,
+0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1,
+0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xE3, 0xE3,
+0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3,
+0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x63,
+0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1,
+0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xE3, 0xE3,
+0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3,
+0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x63,
+0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1,
+0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xE3, 0xE3,
+0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3,
+0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x63, 0x63,
+0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xE2, 0xE2, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xE1, 0xE1,
+0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xE3, 0xE3, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xE3, 0xE3,
+0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xE3, 0xE3, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xC3, 0xC3,
+0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xA3, 0xA3, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x63, 0x63,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xE2, 0xE2, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xE1, 0xE1,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xE3, 0xE3, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xE3, 0xE3,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xE3, 0xE3, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xC3, 0xC3,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xA3, 0xA3, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x63, 0x63,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xE2, 0xE2, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xE1, 0xE1,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xE3, 0xE3, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xE3, 0xE3,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE3, 0xE3, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xC3, 0xC3,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xA3, 0xA3, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x63, 0x63,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xE2, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xE1,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xE3, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xE3,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE3, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xC3,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xA3, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x63,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE0,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0x03, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0x03,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0x03, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x03,
+0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0xF8, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xF8, 0xF8, 0xF8,
+0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF8, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF0, 0xF0, 0xF0,
+0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xE8, 0xE8, 0xE8, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xD8, 0xD8, 0xD8,
+0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xB8, 0xB8, 0xB8, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x78, 0x78, 0x78,
+0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0xF8, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xF8, 0xF8, 0xF8,
+0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0xF8, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF0, 0xF0, 0xF0,
+0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xE8, 0xE8, 0xE8, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xD8, 0xD8, 0xD8,
+0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xB8, 0xB8, 0xB8, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x78, 0x78, 0x78,
+0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xF8, 0xF8, 0xF8, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xF8, 0xF8, 0xF8,
+0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF0, 0xF0, 0xF0,
+0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xE8, 0xE8, 0xE8, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xD8, 0xD8, 0xD8,
+0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xB8, 0xB8, 0xB8, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x78, 0x78, 0x78,
+0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xF8, 0xF8, 0xF8, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xF8, 0xF8, 0xF8,
+0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF0, 0xF0, 0xF0,
+0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xE8, 0xE8, 0xE8, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xD8, 0xD8, 0xD8,
+0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xB8, 0xB8, 0xB8, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x78, 0x78, 0x78,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF8, 0xF8, 0xF8, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF8, 0xF8, 0xF8,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF0, 0xF0, 0xF0,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE8, 0xE8, 0xE8, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD8, 0xD8, 0xD8,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB8, 0xB8, 0xB8, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x78, 0x78, 0x78,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF8, 0xF8, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF8, 0xF8,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF8, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF0, 0xF0,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE8, 0xE8, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD8, 0xD8,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB8, 0xB8, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x78, 0x78,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0x00, 0xF8, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF0, 0x00, 0xF0,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE8, 0x00, 0xE8, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD8, 0x00, 0xD8,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB8, 0x00, 0xB8, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x78, 0x00, 0x78,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x00,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF8, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF0, 0xF0, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE8, 0xE8, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD8, 0xD8, 0x00,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB8, 0xB8, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x78, 0x78, 0x00,
+0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1, 0xF1,
+0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xF1, 0xF1, 0xF1, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1, 0xF1,
+0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0xE1, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1, 0xD1,
+0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0xB1, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x71, 0x71,
+0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1, 0xF1,
+0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xF1, 0xF1, 0xF1, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1, 0xF1,
+0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0xE1, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1, 0xD1,
+0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0xB1, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x71, 0x71, 0x71,
+0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xF1, 0xF1, 0xF1,
+0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xF1, 0xF1, 0xF1, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xF1, 0xF1, 0xF1,
+0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xE1, 0xE1, 0xE1, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xD1, 0xD1, 0xD1,
+0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xB1, 0xB1, 0xB1, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x71, 0x71, 0x71,
+0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xF0, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xF1, 0xF1, 0xF1,
+0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xF1, 0xF1, 0xF1, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xF1, 0xF1, 0xF1,
+0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xE1, 0xE1, 0xE1, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xD1, 0xD1, 0xD1,
+0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xB1, 0xB1, 0xB1, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x71, 0x71, 0x71,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF0, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF1, 0xF1, 0xF1,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF1, 0xF1, 0xF1, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF1, 0xF1, 0xF1,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE1, 0xE1, 0xE1, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD1, 0xD1, 0xD1,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB1, 0xB1, 0xB1, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x71, 0x71, 0x71,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF1, 0xF1,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF1, 0xF1, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF1, 0xF1,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE1, 0xE1, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD1, 0xD1,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB1, 0xB1, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x71, 0x71,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF0, 0xF1,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0x01, 0xF1,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0x01, 0xE1, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0x01, 0xD1,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0x01, 0xB1, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x01, 0x71,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1, 0x00,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x71, 0x00,
+0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1,
+0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xE3, 0xE3, 0xE3,
+0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3,
+0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x63,
+0xFE, 0x00, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0xFD, 0x00, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1,
+0xFB, 0x00, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0xF7, 0x00, 0xF7, 0xF7, 0xF7, 0xE3, 0xE3, 0xE3,
+0xEF, 0x00, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0xDF, 0x00, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3,
+0xBF, 0x00, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0x7F, 0x00, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x63,
+0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1,
+0xFB, 0xFB, 0x00, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0xE3, 0xE3, 0xE3,
+0xEF, 0xEF, 0x00, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0xDF, 0xDF, 0x00, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3,
+0xBF, 0xBF, 0x00, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x63, 0x63, 0x63,
+0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xE2, 0xE2, 0xE2, 0xFD, 0xFD, 0xFD, 0x00, 0xFD, 0xE1, 0xE1, 0xE1,
+0xFB, 0xFB, 0xFB, 0x00, 0xFB, 0xE3, 0xE3, 0xE3, 0xF7, 0xF7, 0xF7, 0x00, 0xF7, 0xE3, 0xE3, 0xE3,
+0xEF, 0xEF, 0xEF, 0x00, 0xEF, 0xE3, 0xE3, 0xE3, 0xDF, 0xDF, 0xDF, 0x00, 0xDF, 0xC3, 0xC3, 0xC3,
+0xBF, 0xBF, 0xBF, 0x00, 0xBF, 0xA3, 0xA3, 0xA3, 0x7F, 0x7F, 0x7F, 0x00, 0x7F, 0x63, 0x63, 0x63,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xE2, 0xE2, 0xE2, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xE1, 0xE1, 0xE1,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xE3, 0xE3, 0xE3, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xE3, 0xE3, 0xE3,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE3, 0xE3, 0xE3, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xC3, 0xC3, 0xC3,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xA3, 0xA3, 0xA3, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x63, 0x63, 0x63,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xE2, 0xE2, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xE1, 0xE1,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xE3, 0xE3, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xE3, 0xE3,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE3, 0xE3, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xC3, 0xC3,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xA3, 0xA3, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x63, 0x63,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE0, 0xE2, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE0, 0xE1,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE0, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0x03, 0xE3, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0x03, 0xC3,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0x03, 0xA3, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x03, 0x63,
+0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0x00,
+0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0x00,
+0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x00,
+0x00, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0xFE, 0x00, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1, 0xF1, 0xFD,
+0x00, 0xFB, 0xFB, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0x00, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1, 0xF1, 0xF7,
+0x00, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0xE1, 0xEF, 0x00, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1, 0xD1, 0xDF,
+0x00, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0xB1, 0xBF, 0x00, 0x7F, 0x7F, 0x7F, 0x71, 0x71, 0x71, 0x7F,
+0xFE, 0x00, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0xFE, 0xFD, 0x00, 0xFD, 0xFD, 0xF1, 0xF1, 0xF1, 0xFD,
+0xFB, 0x00, 0xFB, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xF7, 0x00, 0xF7, 0xF7, 0xF1, 0xF1, 0xF1, 0xF7,
+0xEF, 0x00, 0xEF, 0xEF, 0xE1, 0xE1, 0xE1, 0xEF, 0xDF, 0x00, 0xDF, 0xDF, 0xD1, 0xD1, 0xD1, 0xDF,
+0xBF, 0x00, 0xBF, 0xBF, 0xB1, 0xB1, 0xB1, 0xBF, 0x7F, 0x00, 0x7F, 0x7F, 0x71, 0x71, 0x71, 0x7F,
+0xFE, 0xFE, 0x00, 0xFE, 0xF0, 0xF0, 0xF0, 0xFE, 0xFD, 0xFD, 0x00, 0xFD, 0xF1, 0xF1, 0xF1, 0xFD,
+0xFB, 0xFB, 0x00, 0xFB, 0xF1, 0xF1, 0xF1, 0xFF, 0xF7, 0xF7, 0x00, 0xF7, 0xF1, 0xF1, 0xF1, 0xF7,
+0xEF, 0xEF, 0x00, 0xEF, 0xE1, 0xE1, 0xE1, 0xEF, 0xDF, 0xDF, 0x00, 0xDF, 0xD1, 0xD1, 0xD1, 0xDF,
+0xBF, 0xBF, 0x00, 0xBF, 0xB1, 0xB1, 0xB1, 0xBF, 0x7F, 0x7F, 0x00, 0x7F, 0x71, 0x71, 0x71, 0x7F,
+0xFE, 0xFE, 0xFE, 0x00, 0xF0, 0xF0, 0xF0, 0xFE, 0xFD, 0xFD, 0xFD, 0x00, 0xF1, 0xF1, 0xF1, 0xFD,
+0xFB, 0xFB, 0xFB, 0x00, 0xF1, 0xF1, 0xF1, 0xFF, 0xF7, 0xF7, 0xF7, 0x00, 0xF1, 0xF1, 0xF1, 0xF7,
+0xEF, 0xEF, 0xEF, 0x00, 0xE1, 0xE1, 0xE1, 0xEF, 0xDF, 0xDF, 0xDF, 0x00, 0xD1, 0xD1, 0xD1, 0xDF,
+0xBF, 0xBF, 0xBF, 0x00, 0xB1, 0xB1, 0xB1, 0xBF, 0x7F, 0x7F, 0x7F, 0x00, 0x71, 0x71, 0x71, 0x7F,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xF0, 0xF0, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xF1, 0xF1, 0xFD,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xF1, 0xF1, 0xFF, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xF1, 0xF1, 0xF7,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE1, 0xE1, 0xEF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xD1, 0xD1, 0xDF,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xB1, 0xB1, 0xBF, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x71, 0x71, 0x7F,
+0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF0, 0xF1, 0xFD,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0x01, 0xF1, 0xF7,
+0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0x01, 0xE1, 0xEF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0x01, 0xD1, 0xDF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0x01, 0xB1, 0xBF, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x01, 0x71, 0x7F,
+0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0x00, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1, 0x00, 0xFD,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x00, 0xFB, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1, 0x00, 0xF7,
+0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0x00, 0xEF, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1, 0x00, 0xDF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0x00, 0xBF, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x71, 0x00, 0x7F,
+0xFE, 0xFE, 0xFE, 0xFE, 0xF0, 0xF0, 0xF0, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xF1, 0xF1, 0xF1, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF1, 0xF1, 0xF1, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xE1, 0xE1, 0xE1, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xD1, 0xD1, 0xD1, 0x00,
+0xBF, 0xBF, 0xBF, 0xBF, 0xB1, 0xB1, 0xB1, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x71, 0x71, 0x71, 0x00,
+0x00, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0xFE, 0x00, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1, 0xFD,
+0x00, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0xFB, 0x00, 0xF7, 0xF7, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF,
+0x00, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0xEF, 0x00, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3, 0xDF,
+0x00, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0xBF, 0x00, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x63, 0x7F,
+0xFE, 0x00, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0xFE, 0xFD, 0x00, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1, 0xFD,
+0xFB, 0x00, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0xFB, 0xF7, 0x00, 0xF7, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF,
+0xEF, 0x00, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0xEF, 0xDF, 0x00, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3, 0xDF,
+0xBF, 0x00, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0xBF, 0x7F, 0x00, 0x7F, 0x7F, 0x63, 0x63, 0x63, 0x7F,
+0xFE, 0xFE, 0x00, 0xFE, 0xE2, 0xE2, 0xE2, 0xFE, 0xFD, 0xFD, 0x00, 0xFD, 0xE1, 0xE1, 0xE1, 0xFD,
+0xFB, 0xFB, 0x00, 0xFB, 0xE3, 0xE3, 0xE3, 0xFB, 0xF7, 0xF7, 0x00, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF,
+0xEF, 0xEF, 0x00, 0xEF, 0xE3, 0xE3, 0xE3, 0xEF, 0xDF, 0xDF, 0x00, 0xDF, 0xC3, 0xC3, 0xC3, 0xDF,
+0xBF, 0xBF, 0x00, 0xBF, 0xA3, 0xA3, 0xA3, 0xBF, 0x7F, 0x7F, 0x00, 0x7F, 0x63, 0x63, 0x63, 0x7F,
+0xFE, 0xFE, 0xFE, 0x00, 0xE2, 0xE2, 0xE2, 0xFE, 0xFD, 0xFD, 0xFD, 0x00, 0xE1, 0xE1, 0xE1, 0xFD,
+0xFB, 0xFB, 0xFB, 0x00, 0xE3, 0xE3, 0xE3, 0xFB, 0xF7, 0xF7, 0xF7, 0x00, 0xE3, 0xE3, 0xE3, 0xFF,
+0xEF, 0xEF, 0xEF, 0x00, 0xE3, 0xE3, 0xE3, 0xEF, 0xDF, 0xDF, 0xDF, 0x00, 0xC3, 0xC3, 0xC3, 0xDF,
+0xBF, 0xBF, 0xBF, 0x00, 0xA3, 0xA3, 0xA3, 0xBF, 0x7F, 0x7F, 0x7F, 0x00, 0x63, 0x63, 0x63, 0x7F,
+0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0xE2, 0xE2, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0xE1, 0xE1, 0xFD,
+0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0xE3, 0xE3, 0xFB, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0xE3, 0xE3, 0xFF,
+0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0xE3, 0xE3, 0xEF, 0xDF, 0xDF, 0xDF, 0xDF, 0x00, 0xC3, 0xC3, 0xDF,
+0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0xA3, 0xA3, 0xBF, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x63, 0x63, 0x7F,
+0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE0, 0xE2, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE0, 0xE1, 0xFD,
+0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE0, 0xE3, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0x03, 0xE3, 0xEF, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0x03, 0xC3, 0xDF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0x03, 0xA3, 0xBF, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x03, 0x63, 0x7F,
+0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0x00, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0x00, 0xFD,
+0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x00, 0xF7,
+0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0x00, 0xEF, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0x00, 0xDF,
+0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0x00, 0xBF, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x00, 0x7F,
+0xFE, 0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1, 0x00,
+0xFB, 0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x00,
+0xEF, 0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3, 0x00,
+0xBF, 0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x63, 0x00,
+0x00, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0xFE, 0xFE, 0x00, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1, 0xFD, 0xFD,
+0x00, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0xFB, 0xFB, 0x00, 0xF7, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0x00, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0xEF, 0xEF, 0x00, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3, 0xDF, 0xDF,
+0x00, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0xBF, 0xBF, 0x00, 0x7F, 0x7F, 0x63, 0x63, 0x63, 0x7F, 0x7F,
+0xFE, 0x00, 0xFE, 0xE2, 0xE2, 0xE2, 0xFE, 0xFE, 0xFD, 0x00, 0xFD, 0xE1, 0xE1, 0xE1, 0xFD, 0xFD,
+0xFB, 0x00, 0xFB, 0xE3, 0xE3, 0xE3, 0xFB, 0xFB, 0xF7, 0x00, 0xF7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xEF, 0x00, 0xEF, 0xE3, 0xE3, 0xE3, 0xEF, 0xEF, 0xDF, 0x00, 0xDF, 0xC3, 0xC3, 0xC3, 0xDF, 0xDF,
+0xBF, 0x00, 0xBF, 0xA3, 0xA3, 0xA3, 0xBF, 0xBF, 0x7F, 0x00, 0x7F, 0x63, 0x63, 0x63, 0x7F, 0x7F,
+0xFE, 0xFE, 0x00, 0xE2, 0xE2, 0xE2, 0xFE, 0xFE, 0xFD, 0xFD, 0x00, 0xE1, 0xE1, 0xE1, 0xFD, 0xFD,
+0xFB, 0xFB, 0x00, 0xE3, 0xE3, 0xE3, 0xFB, 0xFB, 0xF7, 0xF7, 0x00, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xEF, 0xEF, 0x00, 0xE3, 0xE3, 0xE3, 0xEF, 0xEF, 0xDF, 0xDF, 0x00, 0xC3, 0xC3, 0xC3, 0xDF, 0xDF,
+0xBF, 0xBF, 0x00, 0xA3, 0xA3, 0xA3, 0xBF, 0xBF, 0x7F, 0x7F, 0x00, 0x63, 0x63, 0x63, 0x7F, 0x7F,
+0xFE, 0xFE, 0xFE, 0x00, 0xE2, 0xE2, 0xFE, 0xFE, 0xFD, 0xFD, 0xFD, 0x00, 0xE1, 0xE1, 0xFD, 0xFD,
+0xFB, 0xFB, 0xFB, 0x00, 0xE3, 0xE3, 0xFB, 0xFB, 0xF7, 0xF7, 0xF7, 0x00, 0xE3, 0xE3, 0xFF, 0xFF,
+0xEF, 0xEF, 0xEF, 0x00, 0xE3, 0xE3, 0xEF, 0xEF, 0xDF, 0xDF, 0xDF, 0x00, 0xC3, 0xC3, 0xDF, 0xDF,
+0xBF, 0xBF, 0xBF, 0x00, 0xA3, 0xA3, 0xBF, 0xBF, 0x7F, 0x7F, 0x7F, 0x00, 0x63, 0x63, 0x7F, 0x7F,
+0xFE, 0xFE, 0xFE, 0xE2, 0xE0, 0xE2, 0xFE, 0xFE, 0xFD, 0xFD, 0xFD, 0xE1, 0xE0, 0xE1, 0xFD, 0xFD,
+0xFB, 0xFB, 0xFB, 0xE3, 0xE0, 0xE3, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xEF, 0xEF, 0xEF, 0xE3, 0x03, 0xE3, 0xEF, 0xEF, 0xDF, 0xDF, 0xDF, 0xC3, 0x03, 0xC3, 0xDF, 0xDF,
+0xBF, 0xBF, 0xBF, 0xA3, 0x03, 0xA3, 0xBF, 0xBF, 0x7F, 0x7F, 0x7F, 0x63, 0x03, 0x63, 0x7F, 0x7F,
+0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0x00, 0xFE, 0xFE, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0x00, 0xFD, 0xFD,
+0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0x00, 0xFB, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x00, 0xF7, 0xF7,
+0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0x00, 0xEF, 0xEF, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0x00, 0xDF, 0xDF,
+0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0x00, 0xBF, 0xBF, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x00, 0x7F, 0x7F,
+0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0x00, 0xFE, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1, 0x00, 0xFD,
+0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x00, 0xF7,
+0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0x00, 0xEF, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3, 0x00, 0xDF,
+0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0x00, 0xBF, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x63, 0x00, 0x7F,
+0xFE, 0xFE, 0xFE, 0xE2, 0xE2, 0xE2, 0xFE, 0x00, 0xFD, 0xFD, 0xFD, 0xE1, 0xE1, 0xE1, 0xFD, 0x00,
+0xFB, 0xFB, 0xFB, 0xE3, 0xE3, 0xE3, 0xFB, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF7, 0x00,
+0xEF, 0xEF, 0xEF, 0xE3, 0xE3, 0xE3, 0xEF, 0x00, 0xDF, 0xDF, 0xDF, 0xC3, 0xC3, 0xC3, 0xDF, 0x00,
+0xBF, 0xBF, 0xBF, 0xA3, 0xA3, 0xA3, 0xBF, 0x00, 0x7F, 0x7F, 0x7F, 0x63, 0x63, 0x63, 0x7F, 0x00,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFC, 0xFC,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFC, 0xFC,
+0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFC, 0xFC,
+0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFC, 0xFC,
+0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFC, 0xFC,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFC, 0xFC,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFC, 0xFC,
+0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFC, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFC, 0xFC,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFC, 0xFC,
+0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFC, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC4, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8C, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1C, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3C, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC4, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8C, 0x8C,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3C, 0x3C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8,
+0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF8, 0xF8,
+0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF8, 0xF8,
+0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x88, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x38, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x88, 0x88,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x38, 0x38,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1,
+0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF1, 0xF1,
+0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF1, 0xF1,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF1, 0xF1,
+0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x81, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x11, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x31, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC1, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0x80,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x11, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x31, 0x30,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3,
+0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xE3, 0xE3,
+0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xE3, 0xE3,
+0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x83, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x23, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x88, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x18, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x38, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x88, 0x88, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x18, 0x18, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x38, 0x38, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x88, 0x88,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x38, 0x38,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x81, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x11, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x31, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x11, 0x11, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x31, 0x31, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0x31,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x31,
+0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F, 0x8F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFF, 0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x83, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x03, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x23, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23,
+0xFC, 0xFC, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xC7, 0xC7, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0x1F, 0x1F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFC, 0xFC, 0xFC, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xF1, 0xF1, 0xF1, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xC7, 0xC7, 0xC7, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0x1F, 0x1F, 0x1F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFC, 0xFC, 0xFC, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC7, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0x1F, 0x1F, 0x1F, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xFC, 0xFC, 0xF0, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF0, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x81, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0x1F, 0x1F, 0x11, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x31, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xFF, 0xC7, 0xC1, 0xC1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x81, 0x81, 0xF1, 0xFF,
+0xFF, 0xFF, 0xFF, 0x1F, 0x11, 0x11, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x31, 0x31, 0xF1, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0x31, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xC1, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x81, 0x81, 0x8F,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x11, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x31, 0x31, 0x3F,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF0, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xC1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x81, 0x8F,
+0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0x31, 0x3F,
+0xFC, 0xFC, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF1, 0xF1, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xC7, 0xC7, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0x1F, 0x1F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFC, 0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xF1, 0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xC7, 0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x8F, 0x8F, 0x8F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0x1F, 0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFC, 0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x83, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0x1F, 0x1F, 0x03, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x23, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFF, 0x1F, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23, 0x3F,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x8F,
+0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x23, 0x3F,
+0xFC, 0xFC, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF1, 0xF1, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xC7, 0xC7, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0x1F, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFC, 0xFC, 0xFC, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xF1, 0xF1, 0xF1, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xC7, 0xC7, 0xC7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x8F, 0x8F, 0x8F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0x1F, 0x1F, 0x1F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x3F, 0x3F, 0x3F, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFC, 0xFC, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xE0, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xC7, 0xC7, 0xC3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0x83, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0x1F, 0x1F, 0x03, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0x23, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFC, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xE0, 0xE0, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0x83, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0x1F, 0x03, 0x03, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x23, 0x23, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0x83, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xF8, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x83, 0x83, 0x8F, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE3, 0x03, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x23, 0x23, 0x3F, 0xFF,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE0, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE1, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xC3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x83, 0x8F, 0x8F,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x03, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0x23, 0x3F, 0x3F,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF8, 0xF8,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x8F, 0x8F,
+0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0x3F, 0x3F,
+};
+
+#endif
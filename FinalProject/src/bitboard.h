@@ -0,0 +1,181 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <stdint.h>
+#include <array>
+
+// Bitboards use the same square numbering as the chess UI: index = row * 8 + col,
+// with row 0 at the top of the screen (black's back rank, a8 = 0) and row 7 at
+// the bottom (white's back rank, h1 = 63). Bit n of a Bitboard is square n.
+// Nothing here depends on Arduino, so the chess code also builds on the host.
+typedef uint64_t Bitboard;
+
+/**
+ * @brief Bitboard with only the given square set.
+ */
+inline constexpr Bitboard squareBit(int square) {
+    return (Bitboard)1 << square;
+}
+
+inline int popCount(Bitboard b) {
+    return __builtin_popcountll(b);
+}
+
+/**
+ * @brief Lowest set square. The bitboard must not be empty.
+ */
+inline int lowestSquare(Bitboard b) {
+    return __builtin_ctzll(b);
+}
+
+/**
+ * @brief Highest set square. The bitboard must not be empty.
+ */
+inline int highestSquare(Bitboard b) {
+    return 63 - __builtin_clzll(b);
+}
+
+/**
+ * @brief Removes the lowest set square and returns it. The bitboard must not be empty.
+ */
+inline int popLowestSquare(Bitboard &b) {
+    int square = lowestSquare(b);
+    b &= b - 1;
+    return square;
+}
+
+// Ray directions. Even entries step to higher square numbers (the first blocker
+// is the lowest set bit), odd entries to lower ones (the highest set bit).
+enum RayDirection {
+    RAY_EAST,       // +1
+    RAY_WEST,       // -1
+    RAY_SOUTH,      // +8, towards white's side
+    RAY_NORTH,      // -8, towards black's side
+    RAY_SOUTH_EAST, // +9
+    RAY_NORTH_WEST, // -9
+    RAY_SOUTH_WEST, // +7
+    RAY_NORTH_EAST, // -7
+    RAY_COUNT
+};
+
+namespace bitboardTables {
+
+constexpr int rayRowStep[RAY_COUNT] = {0, 0, 1, -1, 1, -1, 1, -1};
+constexpr int rayColStep[RAY_COUNT] = {1, -1, 0, 0, 1, -1, -1, 1};
+
+constexpr bool onBoard(int row, int col) {
+    return row >= 0 && row < 8 && col >= 0 && col < 8;
+}
+
+// Squares reachable from each square by one of the given (row, col) offsets.
+template <int N>
+constexpr std::array<Bitboard, 64> leaperTable(const int (&offsets)[N][2]) {
+    std::array<Bitboard, 64> table = {};
+    for (int square = 0; square < 64; square++) {
+        for (int i = 0; i < N; i++) {
+            int row = square / 8 + offsets[i][0];
+            int col = square % 8 + offsets[i][1];
+            if (onBoard(row, col)) {
+                table[square] |= squareBit(row * 8 + col);
+            }
+        }
+    }
+    return table;
+}
+
+constexpr int knightOffsets[8][2] = {{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}};
+constexpr int kingOffsets[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+// White pawns move up the screen (row decreases), black pawns down.
+constexpr int whitePawnOffsets[2][2] = {{-1, -1}, {-1, 1}};
+constexpr int blackPawnOffsets[2][2] = {{1, -1}, {1, 1}};
+
+constexpr std::array<std::array<Bitboard, 64>, RAY_COUNT> rayTable() {
+    std::array<std::array<Bitboard, 64>, RAY_COUNT> table = {};
+    for (int dir = 0; dir < RAY_COUNT; dir++) {
+        for (int square = 0; square < 64; square++) {
+            int row = square / 8 + rayRowStep[dir];
+            int col = square % 8 + rayColStep[dir];
+            while (onBoard(row, col)) {
+                table[dir][square] |= squareBit(row * 8 + col);
+                row += rayRowStep[dir];
+                col += rayColStep[dir];
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr std::array<Bitboard, 64> knight = leaperTable(knightOffsets);
+inline constexpr std::array<Bitboard, 64> king = leaperTable(kingOffsets);
+inline constexpr std::array<std::array<Bitboard, 64>, 2> pawn = {leaperTable(whitePawnOffsets),
+                                                                 leaperTable(blackPawnOffsets)};
+inline constexpr std::array<std::array<Bitboard, 64>, RAY_COUNT> rays = rayTable();
+
+} // namespace bitboardTables
+
+/**
+ * @brief Squares a knight on the given square attacks.
+ */
+inline Bitboard knightAttacks(int square) {
+    return bitboardTables::knight[square];
+}
+
+/**
+ * @brief Squares a king on the given square attacks.
+ */
+inline Bitboard kingAttacks(int square) {
+    return bitboardTables::king[square];
+}
+
+/**
+ * @brief Squares a pawn attacks diagonally.
+ * @param color Pawn color (1 for white, -1 for black).
+ * @param square Square the pawn stands on.
+ */
+inline Bitboard pawnAttacks(int color, int square) {
+    return bitboardTables::pawn[color > 0 ? 0 : 1][square];
+}
+
+/**
+ * @brief Squares along one ray up to and including the first occupied square.
+ * Classical ray attacks: the ray is cut behind the nearest blocker with one bit scan,
+ * which keeps the tables at 4 KB instead of the hundreds of KB magic bitboards need.
+ */
+inline Bitboard rayAttacks(int dir, int square, Bitboard occupied) {
+    Bitboard ray = bitboardTables::rays[dir][square];
+    Bitboard blockers = ray & occupied;
+    if (blockers) {
+        int blocker = (dir & 1) ? highestSquare(blockers) : lowestSquare(blockers);
+        ray ^= bitboardTables::rays[dir][blocker];
+    }
+    return ray;
+}
+
+inline Bitboard rookAttacks(int square, Bitboard occupied) {
+    return rayAttacks(RAY_EAST, square, occupied) | rayAttacks(RAY_WEST, square, occupied) |
+           rayAttacks(RAY_SOUTH, square, occupied) | rayAttacks(RAY_NORTH, square, occupied);
+}
+
+inline Bitboard bishopAttacks(int square, Bitboard occupied) {
+    return rayAttacks(RAY_SOUTH_EAST, square, occupied) | rayAttacks(RAY_NORTH_WEST, square, occupied) |
+           rayAttacks(RAY_SOUTH_WEST, square, occupied) | rayAttacks(RAY_NORTH_EAST, square, occupied);
+}
+
+inline Bitboard queenAttacks(int square, Bitboard occupied) {
+    return rookAttacks(square, occupied) | bishopAttacks(square, occupied);
+}
+
+/**
+ * @brief Squares strictly between two squares on a shared rank, file or diagonal.
+ * @return The squares in between, or 0 if the squares are not aligned (or adjacent).
+ */
+inline Bitboard betweenSquares(int from, int to) {
+    for (int dir = 0; dir < RAY_COUNT; dir++) {
+        if (bitboardTables::rays[dir][from] & squareBit(to)) {
+            return bitboardTables::rays[dir][from] & ~bitboardTables::rays[dir][to] & ~squareBit(to);
+        }
+    }
+    return 0;
+}
+
+#endif
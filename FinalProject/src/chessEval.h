@@ -0,0 +1,86 @@
+#ifndef CHESSEVAL_H
+#define CHESSEVAL_H
+
+#include <stdint.h>
+#include "chessPosition.h"
+#include "bitbase.h"
+
+// Base score of a three-piece ending known to be won, above any material balance
+// but well below mate scores. Winning material is added on top, so keeping a queen
+// beats keeping a rook beats keeping a pawn.
+#define CHESS_KNOWN_WIN 10000
+
+/**
+ * @brief Exact scoring of three-piece endings, from white's point of view.
+ * KPK and KRK come from the bitbases; KQK is always scored as won (the search
+ * sees an immediate capture or stalemate itself), and a lone minor piece draws.
+ * A won ending adds a progress term so the search heads somewhere: the pawn's
+ * advance, or for a rook or queen the defending king near the edge and the two
+ * kings close together.
+ * @return False if the position is not a three-piece ending.
+ */
+inline bool evaluateKnownEnding(const ChessPosition &position, int &score) {
+    if (popCount(position.occupied()) != 3) {
+        return false;
+    }
+    int result = probeBitbase(position);
+    int strong = popCount(position.side(1)) == 2 ? 1 : -1;
+    int piece = lowestSquare(position.side(strong) & ~position.pieces(CHESS_KING * strong));
+    int type = abs(position.pieceAt(piece));
+    if (result == BITBASE_DRAW || (result == BITBASE_UNKNOWN && type != CHESS_QUEEN)) {
+        score = 0;
+        return true;
+    }
+    int progress;
+    if (type == CHESS_PAWN) {
+        progress = 20 * (strong > 0 ? 6 - piece / 8 : piece / 8 - 1);
+    } else {
+        int weakKing = position.kingSquare(-strong);
+        int strongKing = position.kingSquare(strong);
+        int file = weakKing % 8, row = weakKing / 8;
+        int fromCenter = (file < 4 ? 3 - file : file - 4) + (row < 4 ? 3 - row : row - 4);
+        int fileGap = abs(file - strongKing % 8), rowGap = abs(row - strongKing / 8);
+        progress = 10 * fromCenter + 4 * (14 - fileGap - rowGap);
+    }
+    score = strong * (CHESS_KNOWN_WIN + chessEvalTables::pieceValue[type] + progress);
+    return true;
+}
+
+/**
+ * @brief Whether neither side can win: bare kings, a lone minor piece, or a KPK or KRK
+ * position the bitbases score as a draw (the defender holds with best play).
+ */
+inline bool isDrawnEnding(const ChessPosition &position) {
+    int pieces = popCount(position.occupied());
+    int score;
+    return pieces == 2 || (pieces == 3 && evaluateKnownEnding(position, score) && score == 0);
+}
+
+/**
+ * @brief Static evaluation in centipawns from the point of view of the side to move.
+ * Material and piece-square bonuses come from the running totals the position keeps
+ * (ChessPosition::pieceSquareScore()), blended from the middlegame to the endgame
+ * score as pieces come off; three-piece endings are scored by evaluateKnownEnding().
+ * Built with USE_NNUE_EVAL, the network in nnue.h takes the place of the tables; the
+ * three-piece endings still come first.
+ */
+inline int evaluatePosition(const ChessPosition &position) {
+    int score = 0;
+#ifdef USE_NNUE_EVAL
+    if (!evaluateKnownEnding(position, score)) {
+        const NnueAccumulator &accumulator = position.nnueAccumulator();
+        const int us = sideIndex(position.sideToMove());
+        return nnue::evaluate(accumulator.values[us], accumulator.values[1 - us]);
+    }
+#else
+    if (!evaluateKnownEnding(position, score)) {
+        const EvalScore pieceSquare = position.pieceSquareScore();
+        const int phase = position.phase() < CHESS_PHASE_TOTAL ? position.phase() : CHESS_PHASE_TOTAL;
+        score = (evalMiddlegame(pieceSquare) * phase + evalEndgame(pieceSquare) * (CHESS_PHASE_TOTAL - phase)) /
+                CHESS_PHASE_TOTAL;
+    }
+#endif
+    return position.sideToMove() > 0 ? score : -score;
+}
+
+#endif
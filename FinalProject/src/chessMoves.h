@@ -0,0 +1,183 @@
+#ifndef CHESSMOVES_H
+#define CHESSMOVES_H
+
+#include <stdint.h>
+#include "chessPosition.h"
+
+// Upper bound on legal moves in any chess position (the known maximum is 218).
+#define CHESS_MAX_MOVES 256
+
+/**
+ * @brief Fixed-capacity list of moves, filled by generateLegalMoves().
+ */
+struct ChessMoveList {
+    ChessMove moves[CHESS_MAX_MOVES];
+    int count = 0;
+
+    void add(ChessMove move) { moves[count++] = move; }
+    const ChessMove *begin() const { return moves; }
+    const ChessMove *end() const { return moves + count; }
+};
+
+namespace chessMoveGen {
+
+// Pawn moves onto a target, expanded into the four promotions on the last row.
+inline void addPawnMove(ChessMoveList &list, int from, int to) {
+    if (to < 8 || to >= 56) {
+        list.add(makeChessMove(from, to, MOVE_PROMOTION, CHESS_QUEEN));
+        list.add(makeChessMove(from, to, MOVE_PROMOTION, CHESS_KNIGHT));
+        list.add(makeChessMove(from, to, MOVE_PROMOTION, CHESS_ROOK));
+        list.add(makeChessMove(from, to, MOVE_PROMOTION, CHESS_BISHOP));
+    } else {
+        list.add(makeChessMove(from, to));
+    }
+}
+
+} // namespace chessMoveGen
+
+/**
+ * @brief Generates every legal move for one side in a single pass.
+ * Pseudo-legal targets come from the attack tables. They are then filtered by
+ * the check mask (in check, a move must capture the checker or block its ray;
+ * double check leaves king moves only) and by the pin mask (a pinned piece stays
+ * on the line between its king and the pinner). King moves are tested with the
+ * king lifted off the board so it cannot hide behind itself along a slider's
+ * ray. En passant gets a full occupancy test, because it removes two pieces from
+ * one rank. Castling and en passant come from the position's rights and en
+ * passant square.
+ * @param position Position to generate for.
+ * @param color Side to move (1 for white, -1 for black).
+ * @param list Receives the moves; cleared first.
+ */
+inline void generateLegalMoves(const ChessPosition &position, int color, ChessMoveList &list) {
+    using namespace chessMoveGen;
+    list.count = 0;
+
+    const int them = -color;
+    const Bitboard us = position.side(color);
+    const Bitboard enemy = position.side(them);
+    const Bitboard occupied = us | enemy;
+    const int king = position.kingSquare(color);
+    if (king < 0) {
+        return;
+    }
+
+    // King moves first: they are the only ones left in double check. The enemy attack
+    // map already looks through our king.
+    const Bitboard attacked = position.attackMap(them);
+    Bitboard kingTargets = kingAttacks(king) & ~us & ~attacked;
+    while (kingTargets) {
+        list.add(makeChessMove(king, popLowestSquare(kingTargets)));
+    }
+
+    const Bitboard checkers = (attacked & squareBit(king)) ? position.attackersTo(king, them, occupied) : 0;
+    if (popCount(checkers) > 1) {
+        return;
+    }
+    // Squares a non-king move must land on: anywhere, or onto / in front of the single checker.
+    Bitboard targetMask = ~us;
+    if (checkers) {
+        targetMask = checkers | betweenSquares(king, lowestSquare(checkers));
+    }
+
+    // Pinned pieces: exactly one of our pieces between the king and an enemy slider.
+    Bitboard pinned = 0;
+    Bitboard pinLine[64];
+    Bitboard snipers = (rookAttacks(king, enemy) & (position.pieces(CHESS_ROOK * them) | position.pieces(CHESS_QUEEN * them))) |
+                       (bishopAttacks(king, enemy) & (position.pieces(CHESS_BISHOP * them) | position.pieces(CHESS_QUEEN * them)));
+    while (snipers) {
+        int sniper = popLowestSquare(snipers);
+        Bitboard between = betweenSquares(king, sniper);
+        Bitboard blockers = between & occupied;
+        if (blockers && !(blockers & (blockers - 1)) && (blockers & us)) {
+            pinned |= blockers;
+            pinLine[lowestSquare(blockers)] = between | squareBit(sniper);
+        }
+    }
+
+    // Knights, bishops, rooks and queens.
+    Bitboard pieces = us & ~position.pieces(CHESS_KING * color) & ~position.pieces(CHESS_PAWN * color);
+    while (pieces) {
+        int from = popLowestSquare(pieces);
+        Bitboard targets = position.attacksFrom(from) & targetMask;
+        if (pinned & squareBit(from)) {
+            targets &= pinLine[from];
+        }
+        while (targets) {
+            list.add(makeChessMove(from, popLowestSquare(targets)));
+        }
+    }
+
+    // Pawns.
+    const int step = color > 0 ? -8 : 8;
+    const int startRow = color > 0 ? 6 : 1;
+    const int enPassant = position.enPassantSquare();
+    Bitboard pawns = position.pieces(CHESS_PAWN * color);
+    while (pawns) {
+        int from = popLowestSquare(pawns);
+        Bitboard allowed = targetMask;
+        if (pinned & squareBit(from)) {
+            allowed &= pinLine[from];
+        }
+
+        Bitboard targets = pawnAttacks(color, from) & enemy;
+        int single = from + step;
+        if (!(occupied & squareBit(single))) {
+            targets |= squareBit(single);
+            int twice = single + step;
+            if (from / 8 == startRow && !(occupied & squareBit(twice))) {
+                targets |= squareBit(twice);
+            }
+        }
+        targets &= allowed;
+        while (targets) {
+            addPawnMove(list, from, popLowestSquare(targets));
+        }
+
+        if (enPassant >= 0 && (pawnAttacks(color, from) & squareBit(enPassant))) {
+            // The captured pawn sits behind the en passant square. Make the capture on the
+            // occupancy and check the king directly; this also covers the rank pin where
+            // both pawns leave the king's row at once.
+            int captured = enPassant - step;
+            Bitboard after = (occupied ^ squareBit(from) ^ squareBit(captured)) | squareBit(enPassant);
+            if (!(position.attackersTo(king, them, after) & ~squareBit(captured))) {
+                list.add(makeChessMove(from, enPassant, MOVE_EN_PASSANT));
+            }
+        }
+    }
+
+    // Castling: not out of, through or into check, with the squares between king and rook empty.
+    const uint8_t rights = position.castlingRights();
+    if (!checkers && rights) {
+        const int home = color > 0 ? 60 : 4;
+        const uint8_t kingSide = color > 0 ? CASTLE_WHITE_KING : CASTLE_BLACK_KING;
+        const uint8_t queenSide = color > 0 ? CASTLE_WHITE_QUEEN : CASTLE_BLACK_QUEEN;
+        if (king == home && (rights & kingSide) && position.pieceAt(home + 3) == CHESS_ROOK * color &&
+            !(occupied & (squareBit(home + 1) | squareBit(home + 2))) &&
+            !(attacked & (squareBit(home + 1) | squareBit(home + 2)))) {
+            list.add(makeChessMove(home, home + 2, MOVE_CASTLE));
+        }
+        if (king == home && (rights & queenSide) && position.pieceAt(home - 4) == CHESS_ROOK * color &&
+            !(occupied & (squareBit(home - 1) | squareBit(home - 2) | squareBit(home - 3))) &&
+            !(attacked & (squareBit(home - 1) | squareBit(home - 2)))) {
+            list.add(makeChessMove(home, home - 2, MOVE_CASTLE));
+        }
+    }
+}
+
+/**
+ * @brief Finds the legal move from one square to another.
+ * When a pawn move promotes, the queen promotion is returned.
+ * @return True if the list holds such a move.
+ */
+inline bool findChessMove(const ChessMoveList &list, int from, int to, ChessMove &move) {
+    for (ChessMove candidate : list) {
+        if (moveFrom(candidate) == from && moveTo(candidate) == to) {
+            move = candidate; // Queen promotions are generated first
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif
@@ -4,19 +4,20 @@
 #include <Arduino.h>
 #include "Square.h"
 #include "PieceType.h"
+#include "sprite.h"
 //Class for chess pieces
 class chessPiece {
     private:
     Square _location;
     int _color;
     PieceType _pieceType;
-    const uint16_t* _sprite;
+    const Sprite* _sprite;
 
     public:
     chessPiece() {
         _sprite = nullptr;
     }
-    chessPiece(Square location, int color, const uint16_t* sprite) {
+    chessPiece(Square location, int color, const Sprite* sprite) {
         _location = location;
         _color = color;
         //_pieceType = pieceType;
@@ -24,7 +25,7 @@ class chessPiece {
     }
 
 
-    const uint16_t* getSprite(){
+    const Sprite* getSprite(){
         return _sprite;
     }
 };
@@ -0,0 +1,662 @@
+#ifndef CHESSPOSITION_H
+#define CHESSPOSITION_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bitboard.h"
+#include "zobrist.h"
+#include "pieceSquare.h"
+#ifdef USE_NNUE_EVAL
+#include "nnue.h"
+#endif
+
+// Piece codes match the UI board: 0 = empty, pawn 1, bishop 2, knight 3,
+// rook 4, queen 5, king 6, positive for white and negative for black.
+#define CHESS_PAWN 1
+#define CHESS_BISHOP 2
+#define CHESS_KNIGHT 3
+#define CHESS_ROOK 4
+#define CHESS_QUEEN 5
+#define CHESS_KING 6
+
+// Castling rights, one bit per side and wing.
+#define CASTLE_WHITE_KING 1
+#define CASTLE_WHITE_QUEEN 2
+#define CASTLE_BLACK_KING 4
+#define CASTLE_BLACK_QUEEN 8
+
+// Moves kept for unmakeMove(). Older moves drop off the bottom once it is full.
+#define CHESS_UNDO_DEPTH 128
+
+// Move kinds stored in bits 12-13 of a ChessMove.
+#define MOVE_NORMAL 0
+#define MOVE_PROMOTION 1
+#define MOVE_EN_PASSANT 2
+#define MOVE_CASTLE 3
+
+/**
+ * @brief A move packed into 16 bits.
+ * Bits 0-5 source square, 6-11 destination, 12-13 kind (MOVE_*), 14-15 promotion
+ * piece (0 knight, 1 bishop, 2 rook, 3 queen). Castling is stored as the king's move.
+ */
+typedef uint16_t ChessMove;
+
+inline ChessMove makeChessMove(int from, int to, int kind = MOVE_NORMAL, int promotion = CHESS_QUEEN) {
+    static const uint8_t promotionBits[7] = {0, 0, 1, 0, 2, 3, 0}; // indexed by piece type
+    return (ChessMove)(from | (to << 6) | (kind << 12) | (promotionBits[promotion] << 14));
+}
+
+inline int moveFrom(ChessMove move) { return move & 63; }
+inline int moveTo(ChessMove move) { return (move >> 6) & 63; }
+inline int moveKind(ChessMove move) { return (move >> 12) & 3; }
+
+/**
+ * @brief Piece type a promotion move promotes to (CHESS_KNIGHT .. CHESS_QUEEN).
+ */
+inline int movePromotion(ChessMove move) {
+    static const uint8_t promotionPieces[4] = {CHESS_KNIGHT, CHESS_BISHOP, CHESS_ROOK, CHESS_QUEEN};
+    return promotionPieces[move >> 14];
+}
+
+/**
+ * @brief Index of a piece code in the per-piece bitboards: white 0-5, black 6-11.
+ */
+inline int pieceBoardIndex(int piece) {
+    return (piece > 0 ? piece : 6 - piece) - 1;
+}
+
+/**
+ * @brief Index of a color (1 for white, -1 for black) in the per-side bitboards.
+ */
+inline int sideIndex(int color) {
+    return color > 0 ? 0 : 1;
+}
+
+namespace chessPositionTables {
+
+// Castling rights that survive a move touching each square: moving the king or a
+// rook off its home square, or capturing on a rook's home square, drops them.
+constexpr std::array<uint8_t, 64> castlingKeep() {
+    std::array<uint8_t, 64> keep = {};
+    for (int square = 0; square < 64; square++) {
+        keep[square] = 0xF;
+    }
+    keep[0] &= ~CASTLE_BLACK_QUEEN;
+    keep[4] &= ~(CASTLE_BLACK_KING | CASTLE_BLACK_QUEEN);
+    keep[7] &= ~CASTLE_BLACK_KING;
+    keep[56] &= ~CASTLE_WHITE_QUEEN;
+    keep[60] &= ~(CASTLE_WHITE_KING | CASTLE_WHITE_QUEEN);
+    keep[63] &= ~CASTLE_WHITE_KING;
+    return keep;
+}
+
+inline constexpr std::array<uint8_t, 64> castlingMask = castlingKeep();
+
+} // namespace chessPositionTables
+
+/**
+ * @brief Chess position as twelve piece bitboards plus occupancy.
+ * A square-indexed mailbox is kept next to the bitboards so "what is on this
+ * square" stays a single lookup. Attack queries use the precomputed leaper tables
+ * and ray attacks from bitboard.h instead of scanning the board.
+ */
+class ChessPosition {
+  private:
+    Bitboard _pieces[12];
+    Bitboard _sides[2];
+    int8_t _board[64];
+    uint8_t _castling;
+    int8_t _enPassant;
+    int8_t _sideToMove;
+    uint8_t _halfmoveClock;
+    uint64_t _key;
+    // Running sum of chessEvalTables::pieceSquareScores and piecePhase over the board.
+    EvalScore _pieceSquareScore;
+    uint8_t _phase;
+
+    // What makeMove() cannot recover from the board afterwards. The key also
+    // serves as the history that repetitions() looks back through.
+    struct Undo {
+        uint64_t key;
+        ChessMove move;
+        int8_t captured;
+        uint8_t castling;
+        int8_t enPassant;
+        uint8_t halfmoveClock;
+    };
+
+    // Ring of the last CHESS_UNDO_DEPTH moves; _undoCount of them can still be taken back.
+    Undo _undo[CHESS_UNDO_DEPTH];
+    uint8_t _undoTop;
+    uint8_t _undoCount;
+
+    // Attack maps of white and black (see attackMap()), each tagged with the key of the
+    // position it belongs to, so any change to the board makes it stale without extra work.
+    mutable Bitboard _attackMaps[2];
+    mutable uint64_t _attackMapKeys[2];
+
+#ifdef USE_NNUE_EVAL
+    // Network accumulators (see nnueAccumulator()), moved along by setPiece().
+    mutable NnueAccumulator _nnue;
+
+    // Applies a change on one square to both accumulators. Every feature of a side
+    // depends on where its own king stands, so when that king moves the side is
+    // marked stale and rebuilt on its next use instead.
+    void updateNnue(int square, int old, int piece) {
+        for (int side = 0; side < 2; side++) {
+            const int perspective = side == 0 ? 1 : -1;
+            if (old == CHESS_KING * perspective || piece == CHESS_KING * perspective) {
+                _nnue.stale[side] = true;
+            }
+            if (_nnue.stale[side]) {
+                continue;
+            }
+            const int king = kingSquare(perspective);
+            if (old != 0) {
+                nnue::subRow(_nnue.values[side], nnue::featureRow(nnue::featureIndex(perspective, king, old, square)));
+            }
+            if (piece != 0) {
+                nnue::addRow(_nnue.values[side], nnue::featureRow(nnue::featureIndex(perspective, king, piece, square)));
+            }
+        }
+    }
+#endif
+
+    // Zobrist terms for castling rights, en passant file and side to move.
+    uint64_t stateKey() const {
+        uint64_t key = zobrist::castling[_castling];
+        if (_enPassant >= 0) {
+            key ^= zobrist::enPassant[_enPassant % 8];
+        }
+        if (_sideToMove < 0) {
+            key ^= zobrist::blackToMove;
+        }
+        return key;
+    }
+
+  public:
+    ChessPosition() { clear(); }
+
+    /**
+     * @brief Removes every piece, castling rights, the en passant square and the
+     * undo history. White is to move.
+     */
+    void clear() {
+        for (Bitboard &b : _pieces) b = 0;
+        _sides[0] = _sides[1] = 0;
+        for (int8_t &p : _board) p = 0;
+        _castling = 0;
+        _enPassant = -1;
+        _sideToMove = 1;
+        _halfmoveClock = 0;
+        _undoTop = 0;
+        _undoCount = 0;
+        _key = stateKey();
+        _pieceSquareScore = 0;
+        _phase = 0;
+        _attackMapKeys[0] = _attackMapKeys[1] = ~_key;
+#ifdef USE_NNUE_EVAL
+        _nnue.stale[0] = _nnue.stale[1] = true;
+#endif
+    }
+
+    /**
+     * @brief Loads the position from an 8x8 grid of piece codes indexed [row][col].
+     * Castling rights, the en passant square and the undo history are cleared and
+     * white is to move.
+     */
+    template <typename Grid>
+    void setBoard(const Grid &grid) {
+        clear();
+        for (int row = 0; row < 8; row++) {
+            for (int col = 0; col < 8; col++) {
+                if (grid[row][col] != 0) {
+                    setPiece(row * 8 + col, grid[row][col]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Loads the position from a FEN string: placement, side to move, castling,
+     * en passant and, if present, the halfmove clock. The move number is ignored.
+     * @return False if the string is malformed; the position is then left cleared.
+     */
+    bool setFen(const char *fen) {
+        static const char pieceLetters[] = "pbnrqk"; // index + 1 = piece type
+        clear();
+        int square = 0;
+        for (; *fen && *fen != ' '; fen++) {
+            char c = *fen;
+            if (c == '/') {
+                continue;
+            }
+            if (c >= '1' && c <= '8') {
+                square += c - '0';
+                continue;
+            }
+            const char *letter = c ? strchr(pieceLetters, c | 0x20) : nullptr;
+            if (!letter || square >= 64) {
+                clear();
+                return false;
+            }
+            int type = letter - pieceLetters + 1;
+            setPiece(square++, (c & 0x20) ? -type : type);
+        }
+        if (square != 64 || *fen++ != ' ' || (*fen != 'w' && *fen != 'b')) {
+            clear();
+            return false;
+        }
+        _sideToMove = *fen++ == 'w' ? 1 : -1;
+
+        while (*fen == ' ') fen++;
+        for (; *fen && *fen != ' '; fen++) {
+            switch (*fen) {
+                case 'K': _castling |= CASTLE_WHITE_KING; break;
+                case 'Q': _castling |= CASTLE_WHITE_QUEEN; break;
+                case 'k': _castling |= CASTLE_BLACK_KING; break;
+                case 'q': _castling |= CASTLE_BLACK_QUEEN; break;
+            }
+        }
+        while (*fen == ' ') fen++;
+        if (fen[0] >= 'a' && fen[0] <= 'h' && fen[1] >= '1' && fen[1] <= '8') {
+            _enPassant = ('8' - fen[1]) * 8 + (fen[0] - 'a');
+        }
+        while (*fen && *fen != ' ') fen++;
+        while (*fen == ' ') fen++;
+        int halfmoves = atoi(fen);
+        _halfmoveClock = halfmoves > 255 ? 255 : halfmoves;
+        _key = computeKey();
+        return true;
+    }
+
+    /**
+     * @brief Puts a piece on a square, replacing whatever was there. 0 empties the square.
+     */
+    void setPiece(int square, int piece) {
+        int old = _board[square];
+        if (old != 0) {
+            _pieces[pieceBoardIndex(old)] &= ~squareBit(square);
+            _sides[sideIndex(old)] &= ~squareBit(square);
+        }
+        _board[square] = piece;
+        if (piece != 0) {
+            _pieces[pieceBoardIndex(piece)] |= squareBit(square);
+            _sides[sideIndex(piece)] |= squareBit(square);
+        }
+        if (old != 0) {
+            _key ^= zobrist::pieces[pieceBoardIndex(old) * 64 + square];
+            _pieceSquareScore -= chessEvalTables::pieceSquareScores[pieceBoardIndex(old) * 64 + square];
+            _phase -= chessEvalTables::piecePhase[pieceBoardIndex(old)];
+        }
+        if (piece != 0) {
+            _key ^= zobrist::pieces[pieceBoardIndex(piece) * 64 + square];
+            _pieceSquareScore += chessEvalTables::pieceSquareScores[pieceBoardIndex(piece) * 64 + square];
+            _phase += chessEvalTables::piecePhase[pieceBoardIndex(piece)];
+        }
+#ifdef USE_NNUE_EVAL
+        updateNnue(square, old, piece);
+#endif
+    }
+
+    int pieceAt(int square) const { return _board[square]; }
+
+    /**
+     * @brief Castling rights still available (CASTLE_* bits).
+     */
+    uint8_t castlingRights() const { return _castling; }
+    void setCastlingRights(uint8_t rights) {
+        _key ^= stateKey();
+        _castling = rights;
+        _key ^= stateKey();
+    }
+
+    /**
+     * @brief Square a pawn may capture en passant onto, or -1.
+     */
+    int enPassantSquare() const { return _enPassant; }
+    void setEnPassantSquare(int square) {
+        _key ^= stateKey();
+        _enPassant = square;
+        _key ^= stateKey();
+    }
+
+    /**
+     * @brief Color to move (1 for white, -1 for black). makeMove() flips it.
+     */
+    int sideToMove() const { return _sideToMove; }
+    void setSideToMove(int color) {
+        _key ^= stateKey();
+        _sideToMove = color > 0 ? 1 : -1;
+        _key ^= stateKey();
+    }
+
+    /**
+     * @brief Plies since the last capture or pawn move (capped at 255).
+     */
+    int halfmoveClock() const { return _halfmoveClock; }
+
+    /**
+     * @brief Zobrist key of the position, kept up to date by every change.
+     */
+    uint64_t key() const { return _key; }
+
+    /**
+     * @brief Zobrist key recomputed from scratch; equals key() unless something is broken.
+     */
+    uint64_t computeKey() const {
+        uint64_t key = stateKey();
+        for (int square = 0; square < 64; square++) {
+            if (_board[square] != 0) {
+                key ^= zobrist::pieces[pieceBoardIndex(_board[square]) * 64 + square];
+            }
+        }
+        return key;
+    }
+
+    /**
+     * @brief Material plus piece-square score of the board from white's point of view,
+     * middlegame and endgame halves packed together. Kept up to date by every change,
+     * like the key.
+     */
+    EvalScore pieceSquareScore() const { return _pieceSquareScore; }
+
+    /**
+     * @brief Phase weight of the pieces on the board (see CHESS_PHASE_TOTAL). Can exceed
+     * the total after promotions.
+     */
+    int phase() const { return _phase; }
+
+    /**
+     * @brief pieceSquareScore() recomputed from scratch; equal to it unless something is broken.
+     */
+    EvalScore computePieceSquareScore() const {
+        EvalScore score = 0;
+        for (int square = 0; square < 64; square++) {
+            if (_board[square] != 0) {
+                score += chessEvalTables::pieceSquareScores[pieceBoardIndex(_board[square]) * 64 + square];
+            }
+        }
+        return score;
+    }
+
+    /**
+     * @brief phase() recomputed from scratch.
+     */
+    int computePhase() const {
+        int phase = 0;
+        for (int square = 0; square < 64; square++) {
+            if (_board[square] != 0) {
+                phase += chessEvalTables::piecePhase[pieceBoardIndex(_board[square])];
+            }
+        }
+        return phase;
+    }
+
+#ifdef USE_NNUE_EVAL
+    /**
+     * @brief Network accumulators of both sides, rebuilding a stale side from the board
+     * first. A side without a king is left at the biases.
+     */
+    const NnueAccumulator &nnueAccumulator() const {
+        for (int side = 0; side < 2; side++) {
+            if (_nnue.stale[side]) {
+                computeNnueAccumulator(side == 0 ? 1 : -1, _nnue.values[side]);
+                _nnue.stale[side] = kingSquare(side == 0 ? 1 : -1) < 0;
+            }
+        }
+        return _nnue;
+    }
+
+    /**
+     * @brief One side's accumulator computed from scratch; nnueAccumulator() matches it
+     * unless something is broken.
+     */
+    void computeNnueAccumulator(int perspective, int16_t *values) const {
+        memcpy(values, nnue::biases(), NNUE_HIDDEN * sizeof(int16_t));
+        const int king = kingSquare(perspective);
+        if (king < 0) {
+            return;
+        }
+        Bitboard others = occupied() & ~pieces(CHESS_KING * perspective);
+        while (others) {
+            int square = popLowestSquare(others);
+            nnue::addRow(values, nnue::featureRow(nnue::featureIndex(perspective, king, _board[square], square)));
+        }
+    }
+#endif
+
+    /**
+     * @brief How many times the current position occurred before, as far back as
+     * the undo history reaches. Only positions since the last capture or pawn move
+     * can repeat, and only those with the same side to move are compared.
+     * 1 is a repetition inside a search line; 2 means threefold repetition.
+     */
+    int repetitions() const {
+        int count = 0;
+        int reachable = _halfmoveClock < _undoCount ? _halfmoveClock : _undoCount;
+        for (int back = 4; back <= reachable; back += 2) {
+            if (_undo[(_undoTop + CHESS_UNDO_DEPTH - back) % CHESS_UNDO_DEPTH].key == _key) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Plays a move for the piece on its source square.
+     * The move is not checked; it should come from generateLegalMoves() (or at least
+     * be pseudo-legal with the right kind). Captures, the rook hop of castling, the
+     * pawn taken en passant and promotion are applied, castling rights and the en
+     * passant square are updated, the side to move flips, and what is needed to
+     * revert it is pushed on the undo stack. The en passant square is only set when
+     * an enemy pawn can actually capture onto it.
+     */
+    void makeMove(ChessMove move) {
+        const int from = moveFrom(move), to = moveTo(move), kind = moveKind(move);
+        const int piece = _board[from];
+        const int color = piece > 0 ? 1 : -1;
+
+        Undo &undo = _undo[_undoTop];
+        _undoTop = (_undoTop + 1) % CHESS_UNDO_DEPTH;
+        if (_undoCount < CHESS_UNDO_DEPTH) {
+            _undoCount++;
+        }
+        undo.key = _key;
+        undo.move = move;
+        undo.captured = _board[to];
+        undo.castling = _castling;
+        undo.enPassant = _enPassant;
+        undo.halfmoveClock = _halfmoveClock;
+        _key ^= stateKey();
+        if (abs(piece) == CHESS_PAWN || _board[to] != 0) {
+            _halfmoveClock = 0;
+        } else if (_halfmoveClock < 255) {
+            _halfmoveClock++;
+        }
+
+        if (kind == MOVE_EN_PASSANT) {
+            // The captured pawn is beside the mover, one row behind the target.
+            int capturedSquare = to + (color > 0 ? 8 : -8);
+            undo.captured = _board[capturedSquare];
+            setPiece(capturedSquare, 0);
+        } else if (kind == MOVE_CASTLE) {
+            bool kingSide = to > from;
+            setPiece(kingSide ? from + 1 : from - 1, _board[kingSide ? from + 3 : from - 4]);
+            setPiece(kingSide ? from + 3 : from - 4, 0);
+        }
+        setPiece(from, 0);
+        setPiece(to, kind == MOVE_PROMOTION ? movePromotion(move) * color : piece);
+
+        _castling &= chessPositionTables::castlingMask[from] & chessPositionTables::castlingMask[to];
+        _enPassant = -1;
+        if (abs(piece) == CHESS_PAWN && abs(to - from) == 16 &&
+            (pawnAttacks(color, (from + to) / 2) & pieces(-CHESS_PAWN * color))) {
+            _enPassant = (from + to) / 2;
+        }
+        _sideToMove = -_sideToMove;
+        _key ^= stateKey();
+    }
+
+    /**
+     * @brief Takes back the last move played with makeMove().
+     * @return False if there is nothing left to undo (no moves, or the older ones
+     * dropped off the stack).
+     */
+    bool unmakeMove() {
+        if (_undoCount == 0) {
+            return false;
+        }
+        _undoCount--;
+        _undoTop = (_undoTop + CHESS_UNDO_DEPTH - 1) % CHESS_UNDO_DEPTH;
+        const Undo &undo = _undo[_undoTop];
+        const int from = moveFrom(undo.move), to = moveTo(undo.move), kind = moveKind(undo.move);
+        const int color = -_sideToMove;
+        const int piece = kind == MOVE_PROMOTION ? CHESS_PAWN * color : _board[to];
+
+        setPiece(from, piece);
+        if (kind == MOVE_EN_PASSANT) {
+            setPiece(to, 0);
+            setPiece(to + (color > 0 ? 8 : -8), undo.captured);
+        } else {
+            setPiece(to, undo.captured);
+        }
+        if (kind == MOVE_CASTLE) {
+            bool kingSide = to > from;
+            setPiece(kingSide ? from + 3 : from - 4, _board[kingSide ? from + 1 : from - 1]);
+            setPiece(kingSide ? from + 1 : from - 1, 0);
+        }
+
+        _castling = undo.castling;
+        _enPassant = undo.enPassant;
+        _sideToMove = color;
+        _halfmoveClock = undo.halfmoveClock;
+        _key = undo.key;
+        return true;
+    }
+
+    /**
+     * @brief Number of moves unmakeMove() can still take back.
+     */
+    int undoDepth() const { return _undoCount; }
+
+    /**
+     * @brief Squares holding the given piece code.
+     */
+    Bitboard pieces(int piece) const { return _pieces[pieceBoardIndex(piece)]; }
+
+    /**
+     * @brief Squares holding pieces of one color (1 for white, -1 for black).
+     */
+    Bitboard side(int color) const { return _sides[sideIndex(color)]; }
+
+    Bitboard occupied() const { return _sides[0] | _sides[1]; }
+
+    /**
+     * @brief Square of the king of the given color, or -1 if there is none.
+     */
+    int kingSquare(int color) const {
+        Bitboard king = pieces(CHESS_KING * color);
+        return king ? lowestSquare(king) : -1;
+    }
+
+    /**
+     * @brief Pieces of the given color that attack a square, for a given occupancy.
+     * Passing a modified occupancy answers "what if these squares were empty/filled".
+     */
+    Bitboard attackersTo(int square, int color, Bitboard occupied) const {
+        Bitboard rooks = pieces(CHESS_ROOK * color) | pieces(CHESS_QUEEN * color);
+        Bitboard bishops = pieces(CHESS_BISHOP * color) | pieces(CHESS_QUEEN * color);
+        // A pawn of this color attacks the square if a pawn of the other color on
+        // the square would attack the pawn.
+        return (pawnAttacks(-color, square) & pieces(CHESS_PAWN * color)) |
+               (knightAttacks(square) & pieces(CHESS_KNIGHT * color)) |
+               (kingAttacks(square) & pieces(CHESS_KING * color)) |
+               (rookAttacks(square, occupied) & rooks) |
+               (bishopAttacks(square, occupied) & bishops);
+    }
+
+    /**
+     * @brief Whether any piece of the given color attacks a square.
+     */
+    bool isAttacked(int square, int byColor) const {
+        return attackersTo(square, byColor, occupied()) != 0;
+    }
+
+    /**
+     * @brief Every square the pieces of one color attack, looking through the other
+     * side's king (so a king cannot escape a slider by stepping back along its ray).
+     * Computed on the first call for a position and kept until the board changes;
+     * inCheck() and the legal move generator use it when it is there, so check status,
+     * mate detection and king safety all share one computation per position.
+     */
+    Bitboard attackMap(int color) const {
+        const int index = sideIndex(color);
+        if (_attackMapKeys[index] != _key) {
+            const Bitboard occupancy = occupied() & ~pieces(-CHESS_KING * color);
+            const Bitboard queens = pieces(CHESS_QUEEN * color);
+            Bitboard map = 0;
+            Bitboard set = pieces(CHESS_PAWN * color);
+            while (set) {
+                map |= pawnAttacks(color, popLowestSquare(set));
+            }
+            set = pieces(CHESS_KNIGHT * color);
+            while (set) {
+                map |= knightAttacks(popLowestSquare(set));
+            }
+            set = pieces(CHESS_BISHOP * color) | queens;
+            while (set) {
+                map |= bishopAttacks(popLowestSquare(set), occupancy);
+            }
+            set = pieces(CHESS_ROOK * color) | queens;
+            while (set) {
+                map |= rookAttacks(popLowestSquare(set), occupancy);
+            }
+            set = pieces(CHESS_KING * color);
+            if (set) {
+                map |= kingAttacks(lowestSquare(set));
+            }
+            _attackMaps[index] = map;
+            _attackMapKeys[index] = _key;
+        }
+        return _attackMaps[index];
+    }
+
+    /**
+     * @brief Whether the attack map of one color is already computed for this position.
+     */
+    bool hasAttackMap(int color) const { return _attackMapKeys[sideIndex(color)] == _key; }
+
+    /**
+     * @brief Whether the king of the given color is attacked. False if it has no king.
+     * Reads the attack map when it is already there, and otherwise tests the king's
+     * square alone, which is cheaper than building the map.
+     */
+    bool inCheck(int color) const {
+        int king = kingSquare(color);
+        if (king < 0) {
+            return false;
+        }
+        return hasAttackMap(-color) ? (attackMap(-color) & squareBit(king)) != 0 : isAttacked(king, -color);
+    }
+
+    /**
+     * @brief Squares the piece on a square attacks (pawns: their capture squares).
+     * Own pieces are included; mask with ~side(color) for move targets.
+     */
+    Bitboard attacksFrom(int square) const {
+        int piece = _board[square];
+        switch (abs(piece)) {
+            case CHESS_PAWN: return pawnAttacks(piece, square);
+            case CHESS_BISHOP: return bishopAttacks(square, occupied());
+            case CHESS_KNIGHT: return knightAttacks(square);
+            case CHESS_ROOK: return rookAttacks(square, occupied());
+            case CHESS_QUEEN: return queenAttacks(square, occupied());
+            case CHESS_KING: return kingAttacks(square);
+        }
+        return 0;
+    }
+};
+
+#endif
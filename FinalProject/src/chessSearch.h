@@ -0,0 +1,401 @@
+#ifndef CHESSSEARCH_H
+#define CHESSSEARCH_H
+
+#include <stdint.h>
+#include "chessMoves.h"
+#include "chessEval.h"
+#include "transpositionTable.h"
+
+// Scores are centipawns from the side to move's point of view. Mate in n plies
+// scores CHESS_MATE_SCORE - n, so shorter mates are preferred.
+#define CHESS_MATE_SCORE 30000
+#define CHESS_INFINITY 32000
+// Deepest ply the search (including quiescence) can reach. Move lists are kept
+// per ply inside ChessSearch, about 1 KB each, so the search itself needs
+// almost no stack.
+#define CHESS_MAX_PLY 48
+
+struct ChessSearchResult;
+
+/**
+ * @brief Limits for one search. Whichever is reached first ends it.
+ * The node budget is counted exactly, so a search limited by depth and nodes
+ * returns the same move on the ESP32 and on the host. A time limit depends on
+ * the CPU and is only meant as a safety net. shouldStop is polled together with
+ * the clock (every 1024 nodes) so another task can cancel the search, and
+ * onIteration reports each completed depth; both get context passed back.
+ */
+struct ChessSearchLimits {
+    int maxDepth = 32;
+    uint32_t maxNodes = 0;          // 0 = no node limit
+    uint32_t maxMillis = 0;         // 0 = no time limit; needs clock
+    uint32_t (*clock)() = nullptr;  // millisecond clock, e.g. millis()
+    bool (*shouldStop)(void *context) = nullptr;
+    void (*onIteration)(const ChessSearchResult &result, void *context) = nullptr;
+    void *context = nullptr;
+};
+
+/**
+ * @brief Outcome of a search.
+ */
+struct ChessSearchResult {
+    ChessMove move = 0;  // best move, 0 if the side to move has no legal move
+    int score = 0;       // score at the last fully searched depth, side to move's view
+    int depth = 0;       // last fully searched depth
+    uint32_t nodes = 0;  // nodes visited, quiescence included
+    bool stopped = false; // ended by the time limit or shouldStop rather than depth or nodes
+    ChessMove ponder = 0; // expected reply: the second move of the principal variation, 0 if none
+};
+
+/**
+ * @brief Iterative-deepening alpha-beta search with quiescence.
+ * Each iteration searches one ply deeper than the last, following the previous
+ * principal variation first. Moves are ordered PV move, captures by most
+ * valuable victim / least valuable attacker, queen promotions, then the two
+ * killer moves of the ply. With a transposition table attached, positions
+ * reached again through another move order reuse the stored score when it was
+ * searched deep enough, and otherwise try the stored move first. A position that
+ * repeats one earlier in the game or the search line, hits the fifty-move rule,
+ * or is a KPK or KRK draw according to the bitbases, scores as a draw. At the horizon a quiescence search resolves captures
+ * and promotions (and every evasion when in check) so the static evaluation is
+ * never taken in the middle of an exchange. If a limit is hit mid-iteration, the
+ * best root move found so far in that iteration is kept, since the previous best
+ * move is always searched first. Everything is integer arithmetic on a private
+ * copy of the position.
+ */
+class ChessSearch {
+  private:
+    ChessPosition _position;
+    ChessSearchLimits _limits;
+    TranspositionTable *_table = nullptr;
+    uint32_t _nodes;
+    uint32_t _startMillis;
+    bool _stopped;
+    bool _interrupted;
+    bool _followPv;
+
+    ChessMoveList _moves[CHESS_MAX_PLY];
+    int16_t _orders[CHESS_MAX_PLY][CHESS_MAX_MOVES];
+    ChessMove _killers[CHESS_MAX_PLY][2];
+    // Triangular principal variation table: row ply holds the best line from that ply.
+    ChessMove _pv[CHESS_MAX_PLY][CHESS_MAX_PLY];
+    int _pvLength[CHESS_MAX_PLY];
+    // Best line of the last iteration, followed first by the next one.
+    ChessMove _rootPv[CHESS_MAX_PLY];
+    int _rootPvLength;
+
+    // Whether the node or time budget is used up or the search was cancelled.
+    // Time and cancellation are polled every 1024 nodes.
+    bool outOfBudget() {
+        if (_limits.maxNodes && _nodes >= _limits.maxNodes) {
+            return true;
+        }
+        if ((_nodes & 1023) == 0) {
+            if (_limits.shouldStop && _limits.shouldStop(_limits.context)) {
+                _interrupted = true;
+                return true;
+            }
+            if (_limits.maxMillis && _limits.clock && _limits.clock() - _startMillis >= _limits.maxMillis) {
+                _interrupted = true;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool isCapture(ChessMove move) const {
+        return moveKind(move) == MOVE_EN_PASSANT || _position.pieceAt(moveTo(move)) != 0;
+    }
+
+    // Ordering key: higher is searched first.
+    int16_t moveOrder(ChessMove move, int ply, ChessMove pvMove) const {
+        using chessEvalTables::pieceValue;
+        if (move == pvMove) {
+            return 32000;
+        }
+        int order = 0;
+        if (isCapture(move)) {
+            int victim = moveKind(move) == MOVE_EN_PASSANT ? CHESS_PAWN : abs(_position.pieceAt(moveTo(move)));
+            int attacker = abs(_position.pieceAt(moveFrom(move)));
+            order = 10000 + pieceValue[victim] * 2 - pieceValue[attacker] / 10;
+        } else if (move == _killers[ply][0]) {
+            order = 9000;
+        } else if (move == _killers[ply][1]) {
+            order = 8000;
+        }
+        if (moveKind(move) == MOVE_PROMOTION) {
+            order += movePromotion(move) == CHESS_QUEEN ? 9500 : -100;
+        }
+        return order;
+    }
+
+    // Scores the list for ordering, keeping only captures and promotions if tacticalOnly.
+    // The PV move (while still on the previous line) or else the table move goes first.
+    void orderMoves(ChessMoveList &moves, int16_t *orders, int ply, bool tacticalOnly, ChessMove hashMove = 0) {
+        ChessMove pvMove = hashMove;
+        if (_followPv) {
+            _followPv = false;
+            for (ChessMove move : moves) {
+                if (ply < _rootPvLength && move == _rootPv[ply]) {
+                    pvMove = move;
+                    _followPv = true;
+                    break;
+                }
+            }
+        }
+        int kept = 0;
+        for (int i = 0; i < moves.count; i++) {
+            ChessMove move = moves.moves[i];
+            if (tacticalOnly && !isCapture(move) && moveKind(move) != MOVE_PROMOTION) {
+                continue;
+            }
+            moves.moves[kept] = move;
+            orders[kept++] = moveOrder(move, ply, pvMove);
+        }
+        moves.count = kept;
+    }
+
+    // Swaps the best remaining move into slot i (selection sort, one step per move tried).
+    static ChessMove pickMove(ChessMoveList &moves, int16_t *orders, int i) {
+        int best = i;
+        for (int j = i + 1; j < moves.count; j++) {
+            if (orders[j] > orders[best]) {
+                best = j;
+            }
+        }
+        ChessMove move = moves.moves[best];
+        moves.moves[best] = moves.moves[i];
+        moves.moves[i] = move;
+        int16_t order = orders[best];
+        orders[best] = orders[i];
+        orders[i] = order;
+        return move;
+    }
+
+    // Mate scores count plies from the root; the table stores them counted from the entry's own position.
+    static int scoreToTable(int score, int ply) {
+        return score > CHESS_MATE_SCORE - CHESS_MAX_PLY ? score + ply
+               : score < -CHESS_MATE_SCORE + CHESS_MAX_PLY ? score - ply : score;
+    }
+
+    static int scoreFromTable(int score, int ply) {
+        return score > CHESS_MATE_SCORE - CHESS_MAX_PLY ? score - ply
+               : score < -CHESS_MATE_SCORE + CHESS_MAX_PLY ? score + ply : score;
+    }
+
+    void updatePv(int ply, ChessMove move) {
+        _pv[ply][ply] = move;
+        for (int i = ply + 1; i < _pvLength[ply + 1]; i++) {
+            _pv[ply][i] = _pv[ply + 1][i];
+        }
+        _pvLength[ply] = _pvLength[ply + 1];
+    }
+
+    int quiescence(int ply, int alpha, int beta) {
+        _pvLength[ply] = ply;
+        if (outOfBudget()) {
+            _stopped = true;
+            return 0;
+        }
+        _nodes++;
+        if (ply >= CHESS_MAX_PLY - 1) {
+            return evaluatePosition(_position);
+        }
+
+        const int color = _position.sideToMove();
+        const bool inCheck = _position.inCheck(color);
+        ChessMoveList &moves = _moves[ply];
+        int16_t *orders = _orders[ply];
+        generateLegalMoves(_position, color, moves);
+        if (moves.count == 0) {
+            return inCheck ? -CHESS_MATE_SCORE + ply : 0;
+        }
+        int best = -CHESS_INFINITY;
+        if (!inCheck) {
+            best = evaluatePosition(_position);
+            if (best >= beta) {
+                return best;
+            }
+            if (best > alpha) {
+                alpha = best;
+            }
+        }
+
+        orderMoves(moves, orders, ply, !inCheck);
+        for (int i = 0; i < moves.count; i++) {
+            ChessMove move = pickMove(moves, orders, i);
+            _position.makeMove(move);
+            int score = -quiescence(ply + 1, -beta, -alpha);
+            _position.unmakeMove();
+            if (_stopped) {
+                return 0;
+            }
+            if (score > best) {
+                best = score;
+                if (score > alpha) {
+                    alpha = score;
+                    if (alpha >= beta) {
+                        break;
+                    }
+                }
+            }
+        }
+        return best;
+    }
+
+    int alphaBeta(int depth, int ply, int alpha, int beta) {
+        _pvLength[ply] = ply;
+        if (ply > 0 && (_position.repetitions() > 0 || _position.halfmoveClock() >= 100)) {
+            return 0;
+        }
+        if (ply > 0 && probeBitbase(_position) == BITBASE_DRAW) {
+            return 0; // a known draw needs no search
+        }
+        const int color = _position.sideToMove();
+        const bool inCheck = _position.inCheck(color);
+        if (inCheck) {
+            depth++; // Check extension: never stop the search on a forcing move
+        }
+        if (depth <= 0 || ply >= CHESS_MAX_PLY - 1) {
+            return quiescence(ply, alpha, beta);
+        }
+        if (outOfBudget()) {
+            _stopped = true;
+            return 0;
+        }
+        _nodes++;
+
+        ChessMove hashMove = 0;
+        const TTEntry *entry = _table ? _table->probe(_position.key()) : nullptr;
+        if (entry) {
+            hashMove = entry->move;
+            int bound = entry->boundAge & 3;
+            int stored = scoreFromTable(entry->score, ply);
+            if (ply > 0 && entry->depth >= depth &&
+                (bound == TT_EXACT || (bound == TT_LOWER && stored >= beta) || (bound == TT_UPPER && stored <= alpha))) {
+                return stored;
+            }
+        }
+
+        ChessMoveList &moves = _moves[ply];
+        int16_t *orders = _orders[ply];
+        generateLegalMoves(_position, color, moves);
+        if (moves.count == 0) {
+            return inCheck ? -CHESS_MATE_SCORE + ply : 0;
+        }
+
+        orderMoves(moves, orders, ply, false, hashMove);
+        const int originalAlpha = alpha;
+        ChessMove bestMove = 0;
+        int best = -CHESS_INFINITY;
+        for (int i = 0; i < moves.count; i++) {
+            ChessMove move = pickMove(moves, orders, i);
+            _position.makeMove(move);
+            int score = -alphaBeta(depth - 1, ply + 1, -beta, -alpha);
+            _position.unmakeMove();
+            if (_stopped) {
+                return 0;
+            }
+            if (score > best) {
+                best = score;
+                bestMove = move;
+                if (score > alpha) {
+                    alpha = score;
+                    updatePv(ply, move);
+                    if (alpha >= beta) {
+                        if (!isCapture(move) && move != _killers[ply][0]) {
+                            _killers[ply][1] = _killers[ply][0];
+                            _killers[ply][0] = move;
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+        if (_table) {
+            int bound = best >= beta ? TT_LOWER : best > originalAlpha ? TT_EXACT : TT_UPPER;
+            _table->store(_position.key(), bound == TT_UPPER ? 0 : bestMove, scoreToTable(best, ply), depth, bound);
+        }
+        return best;
+    }
+
+  public:
+    /**
+     * @brief Attaches a transposition table shared by later searches (null detaches it).
+     * Results then also depend on what earlier searches left in the table; the host
+     * reproduces the device when it uses the same table size and search sequence.
+     */
+    void setTable(TranspositionTable *table) { _table = table; }
+
+    TranspositionTable *table() const { return _table; }
+
+    /**
+     * @brief Searches a position for the side to move.
+     * @param position Position to search; it is copied, the caller's copy is not touched.
+     * @param limits Depth, node and time limits.
+     * @return Best move found, its score, the depth completed, the nodes used and the expected reply.
+     */
+    ChessSearchResult search(const ChessPosition &position, const ChessSearchLimits &limits) {
+        _position = position;
+        _limits = limits;
+        _nodes = 0;
+        _startMillis = limits.clock ? limits.clock() : 0;
+        _stopped = false;
+        _interrupted = false;
+        _rootPvLength = 0;
+        if (_table) {
+            _table->newSearch();
+        }
+        for (auto &killers : _killers) {
+            killers[0] = killers[1] = 0;
+        }
+
+        ChessSearchResult result;
+        ChessMoveList &rootMoves = _moves[0];
+        generateLegalMoves(_position, _position.sideToMove(), rootMoves);
+        if (rootMoves.count == 0) {
+            return result;
+        }
+        result.move = rootMoves.moves[0];
+
+        for (int depth = 1; depth <= limits.maxDepth && depth < CHESS_MAX_PLY; depth++) {
+            _followPv = true;
+            int score = alphaBeta(depth, 0, -CHESS_INFINITY, CHESS_INFINITY);
+            if (_pvLength[0] > 0) {
+                // Also valid after a stop: the root line only changes once a move is fully searched.
+                _rootPvLength = _pvLength[0];
+                for (int i = 0; i < _rootPvLength; i++) {
+                    _rootPv[i] = _pv[0][i];
+                }
+                result.move = _rootPv[0];
+                if (!_stopped) {
+                    result.score = score;
+                    result.depth = depth;
+                    if (limits.onIteration) {
+                        result.nodes = _nodes;
+                        limits.onIteration(result, limits.context);
+                    }
+                }
+            }
+            if (_stopped || (score > CHESS_MATE_SCORE - CHESS_MAX_PLY || score < -CHESS_MATE_SCORE + CHESS_MAX_PLY)) {
+                break;
+            }
+        }
+        result.nodes = _nodes;
+        result.stopped = _interrupted;
+        result.ponder = _rootPvLength > 1 ? _rootPv[1] : 0;
+        return result;
+    }
+
+    /**
+     * @brief Number of moves in the principal variation of the last search.
+     */
+    int pvLength() const { return _rootPvLength; }
+
+    /**
+     * @brief Move i of the principal variation of the last search.
+     */
+    ChessMove pvMove(int i) const { return _rootPv[i]; }
+};
+
+#endif
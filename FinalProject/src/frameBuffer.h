@@ -0,0 +1,451 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <Arduino.h>
+#include "spiPipeline.h"
+
+// Most separate regions kept per frame. When the list is full the new region is
+// merged into whichever existing one grows the least.
+#define FRAMEBUFFER_MAX_DIRTY 16
+// Two regions are merged when their bounding box costs at most this many extra
+// pixels, which is roughly what opening one more address window costs on the bus.
+#define FRAMEBUFFER_MERGE_SLACK 16
+
+/**
+ * @brief A region of the screen that changed since the last flush (inclusive corners).
+ */
+struct DirtyRect {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+
+    int32_t area() const { return (int32_t)(x1 - x0 + 1) * (y1 - y0 + 1); }
+};
+
+/**
+ * @brief ILI9341 driver that draws into a full-frame RGB565 buffer in PSRAM.
+ * Every GFX primitive, the text renderer and the sprite blitters write into memory
+ * instead of the SPI bus. Only pixels whose value actually changes are recorded, as a
+ * short list of merged dirty rectangles, and flush() pushes those rectangles to the
+ * panel once per frame. Overdraw within a frame (fillScreen() followed by a full scene
+ * redraw) therefore costs nothing on the bus.
+ *
+ * flush() goes out through the strip pipeline of PipelinedTFT, so copying the next rows
+ * out of PSRAM overlaps sending the previous ones.
+ *
+ * If the buffer cannot be allocated, or is switched off with setFrameBufferEnabled(),
+ * every call goes straight to PipelinedTFT.
+ */
+class FrameBufferTFT : public PipelinedTFT {
+  private:
+    uint16_t *_buffer = nullptr;
+    // What the panel currently shows; lets flush() skip pixels that ended the frame unchanged.
+    uint16_t *_front = nullptr;
+    bool _frontValid = false;
+    bool _enabled = false;
+    DirtyRect _dirty[FRAMEBUFFER_MAX_DIRTY];
+    uint8_t _dirtyCount = 0;
+
+    // Window opened by setAddrWindow() for the streaming writes.
+    int16_t _winX0 = 0, _winY0 = 0, _winX1 = 0, _winY1 = 0;
+    int16_t _curX = 0, _curY = 0;
+
+    bool buffered() const { return _enabled && _buffer != nullptr; }
+
+    static DirtyRect unite(const DirtyRect &a, const DirtyRect &b) {
+        return {min(a.x0, b.x0), min(a.y0, b.y0), max(a.x1, b.x1), max(a.y1, b.y1)};
+    }
+
+    static int32_t overlap(const DirtyRect &a, const DirtyRect &b) {
+        int32_t w = min(a.x1, b.x1) - max(a.x0, b.x0) + 1;
+        int32_t h = min(a.y1, b.y1) - max(a.y0, b.y0) + 1;
+        return (w > 0 && h > 0) ? w * h : 0;
+    }
+
+    /**
+     * @brief Adds a changed region, merging it with existing ones when that is cheaper
+     * than sending it as a separate window.
+     */
+    void markDirty(DirtyRect r) {
+        int i = 0;
+        while (i < _dirtyCount) {
+            const DirtyRect &d = _dirty[i];
+            int32_t separate = d.area() + r.area() - overlap(d, r);
+            if (unite(d, r).area() <= separate + FRAMEBUFFER_MERGE_SLACK) {
+                // Take d out and retry with the union, which may now touch others.
+                r = unite(d, r);
+                _dirty[i] = _dirty[--_dirtyCount];
+                i = 0;
+                continue;
+            }
+            i++;
+        }
+        if (_dirtyCount < FRAMEBUFFER_MAX_DIRTY) {
+            _dirty[_dirtyCount++] = r;
+            return;
+        }
+        int best = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for (int k = 0; k < _dirtyCount; k++) {
+            int32_t growth = unite(_dirty[k], r).area() - _dirty[k].area();
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                best = k;
+            }
+        }
+        _dirty[best] = unite(_dirty[best], r);
+    }
+
+    /**
+     * @brief Fills a rectangle that is already clipped to the screen, recording the
+     * bounding box of the pixels that changed.
+     */
+    void fillBuffer(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        DirtyRect changed = {INT16_MAX, INT16_MAX, -1, -1};
+        for (int16_t j = y; j < y + h; j++) {
+            uint16_t *row = &_buffer[(int32_t)j * _width];
+            for (int16_t i = x; i < x + w; i++) {
+                if (row[i] != color) {
+                    row[i] = color;
+                    changed.x0 = min(changed.x0, i);
+                    changed.x1 = max(changed.x1, i);
+                    changed.y0 = min(changed.y0, j);
+                    changed.y1 = j;
+                }
+            }
+        }
+        if (changed.x1 >= 0) {
+            markDirty(changed);
+        }
+    }
+
+    /**
+     * @brief Clips a rectangle to the screen; returns false if nothing is left.
+     */
+    bool clip(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const {
+        if (w < 0) { x += w + 1; w = -w; }
+        if (h < 0) { y += h + 1; h = -h; }
+        int16_t x2 = x + w - 1, y2 = y + h - 1;
+        if (w == 0 || h == 0 || x >= _width || y >= _height || x2 < 0 || y2 < 0) {
+            return false;
+        }
+        x = max(x, (int16_t)0);
+        y = max(y, (int16_t)0);
+        w = min(x2, (int16_t)(_width - 1)) - x + 1;
+        h = min(y2, (int16_t)(_height - 1)) - y + 1;
+        return true;
+    }
+
+    /**
+     * @brief Writes a stream of pixels into the open window, wrapping like the panel does.
+     */
+    void streamBuffer(const uint16_t *colors, uint16_t color, uint32_t len) {
+        DirtyRect changed = {INT16_MAX, INT16_MAX, -1, -1};
+        for (uint32_t k = 0; k < len; k++) {
+            uint16_t c = colors ? colors[k] : color;
+            if (_curX >= 0 && _curY >= 0 && _curX < _width && _curY < _height) {
+                uint16_t &px = _buffer[(int32_t)_curY * _width + _curX];
+                if (px != c) {
+                    px = c;
+                    changed.x0 = min(changed.x0, _curX);
+                    changed.x1 = max(changed.x1, _curX);
+                    changed.y0 = min(changed.y0, _curY);
+                    changed.y1 = max(changed.y1, _curY);
+                }
+            }
+            if (++_curX > _winX1) {
+                _curX = _winX0;
+                if (++_curY > _winY1) {
+                    _curY = _winY0;
+                }
+            }
+        }
+        if (changed.x1 >= 0) {
+            markDirty(changed);
+        }
+    }
+
+    /**
+     * @brief Sends one rectangle of the buffer to the panel and records it as shown.
+     */
+    void pushRect(const DirtyRect &r) {
+        int16_t w = r.x1 - r.x0 + 1;
+        int16_t h = r.y1 - r.y0 + 1;
+        PipelinedTFT::setAddrWindow(r.x0, r.y0, w, h);
+        if (w == _width) {
+            // Full-width rows are contiguous in the buffer.
+            PipelinedTFT::writePixels(&_buffer[(int32_t)r.y0 * _width], (uint32_t)w * h);
+        } else {
+            for (int16_t j = r.y0; j <= r.y1; j++) {
+                PipelinedTFT::writePixels(&_buffer[(int32_t)j * _width + r.x0], w);
+            }
+        }
+        if (_front != nullptr) {
+            for (int16_t j = r.y0; j <= r.y1; j++) {
+                int32_t offset = (int32_t)j * _width + r.x0;
+                memcpy(&_front[offset], &_buffer[offset], w * sizeof(uint16_t));
+            }
+        }
+    }
+
+    /**
+     * @brief Sends only the rows of a dirty rectangle that differ from the panel, grouped
+     * into bands. A row joins the current band when widening the band costs no more than a
+     * separate window would.
+     */
+    void flushChanged(const DirtyRect &r) {
+        DirtyRect band = {0, 0, -1, -1};
+        for (int16_t j = r.y0; j <= r.y1; j++) {
+            const uint16_t *back = &_buffer[(int32_t)j * _width];
+            const uint16_t *front = &_front[(int32_t)j * _width];
+            int16_t lo = r.x0, hi = r.x1;
+            while (lo <= hi && back[lo] == front[lo]) {
+                lo++;
+            }
+            if (lo > hi) {
+                continue;
+            }
+            while (back[hi] == front[hi]) {
+                hi--;
+            }
+
+            if (band.x1 >= 0) {
+                DirtyRect grown = {min(band.x0, lo), band.y0, max(band.x1, hi), j};
+                if (grown.area() <= band.area() + (hi - lo + 1) + FRAMEBUFFER_MERGE_SLACK) {
+                    band = grown;
+                    continue;
+                }
+                pushRect(band);
+            }
+            band = {lo, j, hi, j};
+        }
+        if (band.x1 >= 0) {
+            pushRect(band);
+        }
+    }
+
+  public:
+    FrameBufferTFT(int8_t cs, int8_t dc, int8_t rst = -1) : PipelinedTFT(cs, dc, rst) {}
+
+    /**
+     * @brief Initializes the panel and allocates the frame buffer (and its front copy) in PSRAM.
+     * Falls back to drawing directly if the allocation fails; without the front copy every
+     * dirty rectangle is sent whole.
+     */
+    void begin(uint32_t freq = 0) override {
+        PipelinedTFT::begin(freq);
+        size_t bytes = (size_t)WIDTH * HEIGHT * sizeof(uint16_t);
+        if (_buffer == nullptr) {
+            _buffer = (uint16_t *)ps_malloc(bytes);
+            if (_buffer != nullptr) {
+                memset(_buffer, 0, bytes);
+                _front = (uint16_t *)ps_malloc(bytes);
+            }
+        }
+        setFrameBufferEnabled(_buffer != nullptr);
+    }
+
+    /**
+     * @brief Switches between buffered and direct drawing.
+     * Turning the buffer on marks the whole screen dirty, since the panel may have been
+     * drawn to directly in the meantime; turning it off flushes anything pending first.
+     */
+    void setFrameBufferEnabled(bool enabled) {
+        if (!enabled && buffered()) {
+            flush();
+        }
+        _enabled = enabled && _buffer != nullptr;
+        if (_enabled) {
+            _frontValid = false;
+            _dirtyCount = 0;
+            markDirty({0, 0, (int16_t)(_width - 1), (int16_t)(_height - 1)});
+        }
+    }
+
+    bool frameBufferEnabled() const { return buffered(); }
+
+    /**
+     * @brief Number of regions waiting for the next flush().
+     */
+    uint8_t dirtyCount() const { return _dirtyCount; }
+
+    /**
+     * @brief Pushes every dirty rectangle to the panel in one SPI transaction and clears the list.
+     * Each rectangle is first compared against the copy of what the panel shows, so pixels
+     * that were drawn over and then restored within the frame are not sent again.
+     */
+    void flush() {
+        if (!buffered() || _dirtyCount == 0) {
+            return;
+        }
+        PipelinedTFT::startWrite();
+        for (int k = 0; k < _dirtyCount; k++) {
+            if (_front != nullptr && _frontValid) {
+                flushChanged(_dirty[k]);
+            } else {
+                pushRect(_dirty[k]);
+            }
+        }
+        PipelinedTFT::endWrite();
+        _dirtyCount = 0;
+        _frontValid = (_front != nullptr);
+    }
+
+    void setRotation(uint8_t r) override {
+        PipelinedTFT::setRotation(r);
+        if (buffered()) {
+            // The buffer layout follows the rotation, so its contents no longer match the panel.
+            _frontValid = false;
+            _dirtyCount = 0;
+            markDirty({0, 0, (int16_t)(_width - 1), (int16_t)(_height - 1)});
+        }
+    }
+
+    void startWrite() override {
+        if (!buffered()) {
+            PipelinedTFT::startWrite();
+        }
+    }
+
+    void endWrite() override {
+        if (!buffered()) {
+            PipelinedTFT::endWrite();
+        }
+    }
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override {
+        if (!buffered()) {
+            PipelinedTFT::setAddrWindow(x, y, w, h);
+            return;
+        }
+        _winX0 = x;
+        _winY0 = y;
+        _winX1 = x + w - 1;
+        _winY1 = y + h - 1;
+        _curX = x;
+        _curY = y;
+    }
+
+    void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool bigEndian = false) {
+        if (!buffered()) {
+            PipelinedTFT::writePixels(colors, len, block, bigEndian);
+            return;
+        }
+        streamBuffer(colors, 0, len);
+    }
+
+    void writeColor(uint16_t color, uint32_t len) {
+        if (!buffered()) {
+            PipelinedTFT::writeColor(color, len);
+            return;
+        }
+        streamBuffer(nullptr, color, len);
+    }
+
+    void writePixel(uint16_t color) {
+        if (!buffered()) {
+            PipelinedTFT::writePixel(color);
+            return;
+        }
+        streamBuffer(nullptr, color, 1);
+    }
+
+    void pushColor(uint16_t color) {
+        if (!buffered()) {
+            PipelinedTFT::pushColor(color);
+            return;
+        }
+        streamBuffer(nullptr, color, 1);
+    }
+
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h) {
+        if (!buffered()) {
+            PipelinedTFT::drawRGBBitmap(x, y, pcolors, w, h);
+            return;
+        }
+        int16_t x0 = x, y0 = y, stride = w;
+        if (w <= 0 || h <= 0 || !clip(x, y, w, h)) {
+            return;
+        }
+        pcolors += (int32_t)(y - y0) * stride + (x - x0);
+        setAddrWindow(x, y, w, h);
+        for (int16_t j = 0; j < h; j++, pcolors += stride) {
+            streamBuffer(pcolors, 0, w);
+        }
+    }
+
+    void writePixel(int16_t x, int16_t y, uint16_t color) override {
+        if (!buffered()) {
+            PipelinedTFT::writePixel(x, y, color);
+            return;
+        }
+        if (x >= 0 && x < _width && y >= 0 && y < _height) {
+            fillBuffer(x, y, 1, 1, color);
+        }
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (!buffered()) {
+            PipelinedTFT::drawPixel(x, y, color);
+            return;
+        }
+        writePixel(x, y, color);
+    }
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        if (!buffered()) {
+            PipelinedTFT::writeFillRect(x, y, w, h, color);
+            return;
+        }
+        if (clip(x, y, w, h)) {
+            fillBuffer(x, y, w, h, color);
+        }
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        if (!buffered()) {
+            PipelinedTFT::fillRect(x, y, w, h, color);
+            return;
+        }
+        writeFillRect(x, y, w, h, color);
+    }
+
+    void fillScreen(uint16_t color) override {
+        fillRect(0, 0, _width, _height, color);
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        if (!buffered()) {
+            PipelinedTFT::writeFastHLine(x, y, w, color);
+            return;
+        }
+        writeFillRect(x, y, w, 1, color);
+    }
+
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+        if (!buffered()) {
+            PipelinedTFT::writeFastVLine(x, y, h, color);
+            return;
+        }
+        writeFillRect(x, y, 1, h, color);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        if (!buffered()) {
+            PipelinedTFT::drawFastHLine(x, y, w, color);
+            return;
+        }
+        writeFillRect(x, y, w, 1, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+        if (!buffered()) {
+            PipelinedTFT::drawFastVLine(x, y, h, color);
+            return;
+        }
+        writeFillRect(x, y, 1, h, color);
+    }
+};
+
+#endif
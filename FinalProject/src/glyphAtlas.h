@@ -0,0 +1,153 @@
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+// Printable ASCII range of the classic font that the atlas caches.
+#define GLYPH_ATLAS_FIRST ' '
+#define GLYPH_ATLAS_COUNT 95
+
+// Distinct (size, foreground, background) combinations kept at once. When a new
+// one is needed the least recently used face is dropped.
+#define GLYPH_ATLAS_MAX_FACES 12
+
+/**
+ * @brief Cache of classic-font glyphs already scaled and colored, for opaque text.
+ * Adafruit GFX paints every dot of a scaled glyph as its own fillRect, so one
+ * size-2 character costs dozens of address windows. The atlas rasterizes each
+ * glyph once per face (text size plus foreground/background pair) with the
+ * library's own drawChar() into an RGB565 cell, and a whole string then goes out
+ * as one address window of those cells. Glyphs are rasterized on first use, so
+ * only characters that actually appear take memory (PSRAM when available).
+ */
+class GlyphAtlas {
+  private:
+    struct Face {
+        uint8_t size = 0; // 0 = unused slot
+        uint16_t fg = 0;
+        uint16_t bg = 0;
+        uint32_t lastUse = 0;
+        uint16_t *glyphs[GLYPH_ATLAS_COUNT] = {};
+    };
+
+    Face _faces[GLYPH_ATLAS_MAX_FACES];
+    uint32_t _useCounter = 0;
+
+    static void release(Face &face) {
+        for (int i = 0; i < GLYPH_ATLAS_COUNT; i++) {
+            free(face.glyphs[i]);
+            face.glyphs[i] = nullptr;
+        }
+        face.size = 0;
+    }
+
+    Face &face(uint8_t size, uint16_t fg, uint16_t bg) {
+        Face *victim = &_faces[0];
+        for (Face &f : _faces) {
+            if (f.size == size && f.fg == fg && f.bg == bg) {
+                f.lastUse = ++_useCounter;
+                return f;
+            }
+            if (victim->size != 0 && (f.size == 0 || f.lastUse < victim->lastUse)) {
+                victim = &f;
+            }
+        }
+        release(*victim);
+        victim->size = size;
+        victim->fg = fg;
+        victim->bg = bg;
+        victim->lastUse = ++_useCounter;
+        return *victim;
+    }
+
+    // Cell of one glyph, rasterized on first use. Null outside the printable range
+    // or if memory ran out.
+    static uint16_t *glyph(Face &face, char c) {
+        int index = (uint8_t)c - GLYPH_ATLAS_FIRST;
+        if (index < 0 || index >= GLYPH_ATLAS_COUNT) {
+            return nullptr;
+        }
+        if (!face.glyphs[index]) {
+            int16_t w = 6 * face.size, h = 8 * face.size;
+            uint16_t *cell = (uint16_t *)ps_malloc((size_t)w * h * sizeof(uint16_t));
+            if (!cell) {
+                return nullptr;
+            }
+            GFXcanvas16 canvas(w, h);
+            if (!canvas.getBuffer()) {
+                free(cell);
+                return nullptr;
+            }
+            canvas.drawChar(0, 0, GLYPH_ATLAS_FIRST + index, face.fg, face.bg, face.size);
+            memcpy(cell, canvas.getBuffer(), (size_t)w * h * sizeof(uint16_t));
+            face.glyphs[index] = cell;
+        }
+        return face.glyphs[index];
+    }
+
+  public:
+    GlyphAtlas() = default;
+    ~GlyphAtlas() { clear(); }
+
+    GlyphAtlas(const GlyphAtlas &) = delete;
+    GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+
+    /**
+     * @brief Frees every cached glyph.
+     */
+    void clear() {
+        for (Face &f : _faces) {
+            release(f);
+        }
+    }
+
+    /**
+     * @brief Draws a single line of opaque text as one address window.
+     * The character cells are filled with bg, exactly as GFX prints with
+     * setTextColor(fg, bg). The text is not drawn (and false is returned) if it
+     * would not fit on one line inside [x, right), contains a character outside
+     * printable ASCII, or a glyph could not be cached; the caller then prints it
+     * the regular way.
+     * @param display Display to draw on (Adafruit_ILI9341 or anything with the same write API).
+     * @param x Left edge of the first character.
+     * @param y Top edge of the line.
+     * @param text Characters to draw.
+     * @param size Text size as passed to setTextSize().
+     * @param fg Glyph color.
+     * @param bg Cell background color.
+     * @param right First column the cells must not reach.
+     * @return True if the text was drawn.
+     */
+    template <typename Display>
+    bool drawText(Display &display, int16_t x, int16_t y, const char *text, uint8_t size, uint16_t fg, uint16_t bg,
+                  int16_t right) {
+        const int16_t cellW = 6 * size, cellH = 8 * size;
+        const size_t length = strlen(text);
+        right = min(right, display.width());
+        if (size == 0 || length == 0 || x < 0 || y < 0 || y + cellH > display.height() ||
+            x + (int32_t)length * cellW > right) {
+            return false;
+        }
+
+        Face &f = face(size, fg, bg);
+        for (size_t i = 0; i < length; i++) {
+            if (!glyph(f, text[i])) {
+                return false;
+            }
+        }
+
+        display.startWrite();
+        display.setAddrWindow(x, y, length * cellW, cellH);
+        for (int16_t row = 0; row < cellH; row++) {
+            for (size_t i = 0; i < length; i++) {
+                // Cells live in writable RAM: the library may byte-swap them in place while sending.
+                display.writePixels(glyph(f, text[i]) + row * cellW, cellW);
+            }
+        }
+        display.endWrite();
+        return true;
+    }
+};
+
+#endif
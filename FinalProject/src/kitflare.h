@@ -2,210 +2,74 @@
 #ifndef KITFLARE_H
 #define KITFLARE_H
 #include <Arduino.h>
+#include "sprite.h"
 #include "pokemon.h"
 #include "move.h"
 
 // Insert converted hex data from PokemonSprite7.png here
-const uint16_t kitflare_sprite [] PROGMEM = { 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0xF79E, 0x31AA,  
-0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x86EB,  
-0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0xF79E,  
-0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA,  
-0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x31AA, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x31AA,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB,  
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x31AA, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E,  
-0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x31AA,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB,  
-0x86EB, 0x86EB, 0x31AA, 0x0000, 0x31AA, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x31AA, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB,  
-0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x31AA, 0xF79E, 0xF79E, 0x31AA, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0xF79E, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB,  
-0x31AA, 0x0000, 0x0000, 0x31AA, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0xF79E,  
-0xF79E, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB,  
-0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  
-0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x31AA, 0xF79E, 0xF79E, 0x31AA, 0x31AA,  
-0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0xF79E, 0xF79E, 0xF79E, 0x86EB, 0x31AA, 0x0000, 0x31AA, 0x4431, 0x86EB, 0x4431,  
-0x4431, 0x31AA, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x31AA, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E,   
-0x86EB, 0x31AA, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x86EB, 0x86EB,   
-0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x31AA, 0x31AA, 0x4431, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x4431,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x31AA, 0x4431, 0x86EB, 0x86EB, 0x4431, 0x4431,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x0000,   
-0x31AA, 0x4431, 0x4431, 0x31AA, 0x86EB, 0xF79E, 0xF79E, 0x86EB, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x31AA,   
-0x31AA, 0x0000, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB, 0x31AA, 0x31AA, 0x86EB, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x4431, 0x4431, 0x31AA, 0x86EB, 0xF79E, 0xF79E, 0x86EB,   
-0xF79E, 0xF79E, 0xF79E, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431,   
-0x4431, 0x4431, 0x86EB, 0x31AA, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA,   
-0x31AA, 0x31AA, 0x4431, 0x31AA, 0x31AA, 0xF79E, 0xF79E, 0x86EB, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0x4431, 0x31AA, 0x31AA, 0x31AA,   
-0x31AA, 0x4431, 0x31AA, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB,   
-0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x31AA, 0x4431, 0x31AA, 0xF79E, 0x86EB,   
-0xF79E, 0xF79E, 0xF79E, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x31AA, 0x4431, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB,   
-0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA,   
-0x0000, 0x0000, 0x31AA, 0x31AA, 0xF79E, 0x31AA, 0x86EB, 0x4431, 0x86EB, 0x86EB, 0x31AA, 0x4431, 0xF79E, 0x4431, 0x31AA, 0x86EB,   
-0x31AA, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x31AA,   
-0x86EB, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000, 0x0000, 0x0000, 0x31AA, 0x4431, 0x31AA, 0x86EB, 0x4431,   
-0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x4431, 0x31AA, 0x4431, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431,   
-0x31AA, 0x0000, 0x0000, 0x31AA, 0x4431, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x86EB, 0x4431, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x86EB, 0x31AA,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x4431,   
-0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x4431,   
-0x86EB, 0x86EB, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA,   
-0x0000, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000,   
-0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x86EB, 0x31AA, 0x4431, 0x4431,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x4431, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0x4431, 0x4431,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA,   
-0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x4431, 0x4431, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA,   
-0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x0000,   
-0x0000, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x4431, 0x31AA, 0x31AA,   
-0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0xF79E, 0x31AA, 0x31AA,   
-0x31AA, 0x31AA, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x31AA, 0x4431, 0x31AA, 0x86EB, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x4431, 0x31AA,   
-0x4431, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000,   
-0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0xF79E, 0x31AA, 0xF79E, 0xF79E, 0xF79E, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB,   
-0x86EB, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x4431, 0x31AA, 0x4431, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0xF79E, 0x31AA, 0xF79E,   
-0xF79E, 0x4431, 0x31AA, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB,   
-0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0xF79E, 0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x4431,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000,   
-0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x86EB, 0x31AA, 0x86EB, 0x31AA, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000,   
-0x31AA, 0x31AA, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x86EB, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x4431,   
-0x4431, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x31AA,   
-0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x86EB, 0xF79E, 0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0x31AA, 0x31AA, 0x4431,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000,   
-0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x4431, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0xF79E,   
-0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x31AA, 0xF79E, 0x86EB, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431,   
-0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0xF79E, 0xF79E, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x4431,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000,   
-0x31AA, 0xF79E, 0xF79E, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x31AA, 0x86EB, 0x86EB,   
-0x86EB, 0x86EB, 0x86EB, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x31AA, 0xF79E, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x4431, 0x31AA, 0x31AA, 0x4431, 0x4431,   
-0x4431, 0x4431, 0x4431, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x31AA, 0xF79E, 0x31AA, 0xF79E,   
-0x31AA, 0xF79E, 0xF79E, 0x86EB, 0x31AA, 0x4431, 0x86EB, 0x86EB, 0x86EB, 0x86EB, 0x4431, 0xF79E, 0xF79E, 0xF79E, 0x31AA, 0x0000,   
-0x0000, 0x31AA, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x31AA, 0x4431, 0x86EB, 0x86EB, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x31AA,   
-0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0xF79E, 0x31AA, 0xF79E, 0x4431, 0xF79E, 0xF79E, 0x86EB, 0x31AA, 0x86EB, 0x86EB, 0x4431,   
-0x86EB, 0x4431, 0x86EB, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x4431, 0x4431, 0x31AA,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA,   
-0x86EB, 0x31AA, 0x86EB, 0x86EB, 0x31AA, 0x4431, 0x4431, 0x86EB, 0x4431, 0xF79E, 0xF79E, 0x86EB, 0x31AA, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x31AA, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x4431, 0x4431, 0xF79E,   
-0xF79E, 0xF79E, 0xF79E, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x4431, 0x4431, 0x31AA, 0x31AA,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x31AA, 0x86EB, 0x86EB, 0x31AA, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x86EB, 0x86EB, 0x31AA, 0xF79E, 0xF79E, 0xF79E, 0x31AA,   
-0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x31AA, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x4431, 0x4431, 0x4431, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x31AA, 0x4431, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x4431, 0x31AA, 0x31AA, 0x31AA, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA,   
-0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA,   
-0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x4431, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x31AA, 0x4431, 0x31AA, 0x31AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x31AA, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
- };
+// PAL4 sprite 56x56, 4 colors, 1578 bytes (raw: 6272 bytes)
+const uint16_t kitflare_sprite_palette [] PROGMEM = {
+0x0000, 0x31AA, 0x86EB, 0x4431, 0xF79E,
+};
+const uint8_t kitflare_sprite_indices [] PROGMEM = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x22, 0x10, 0x00, 0x00, 0x12, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x22, 0x21, 0x10, 0x00, 0x00, 0x01, 0x22, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x22, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x22, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x22, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x22, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x01, 0x22, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x11, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x12, 0x22, 0x24, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x21, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x41, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x10, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x44, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x21, 0x01, 0x44, 0x10, 0x00, 0x00, 0x00, 0x01, 0x24, 0x21, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x24, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x10, 0x01, 0x44, 0x10, 0x00, 0x00, 0x00, 0x14, 0x42, 0x10, 0x01, 0x11, 0x10, 0x00, 0x12, 0x22, 0x24, 0x41, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x21, 0x00, 0x01, 0x44, 0x11, 0x11, 0x11, 0x11, 0x44, 0x42, 0x10, 0x13, 0x23, 0x31, 0x00, 0x12, 0x22, 0x22, 0x41, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x10, 0x00, 0x11, 0x42, 0x22, 0x32, 0x22, 0x22, 0x44, 0x21, 0x01, 0x22, 0x33, 0x33, 0x11, 0x13, 0x22, 0x22, 0x44, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x10, 0x11, 0x31, 0x22, 0x23, 0x22, 0x22, 0x24, 0x22, 0x10, 0x13, 0x22, 0x33, 0x33, 0x33, 0x11, 0x22, 0x22, 0x44, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x21, 0x10, 0x13, 0x31, 0x24, 0x42, 0x44, 0x44, 0x22, 0x21, 0x10, 0x13, 0x33, 0x33, 0x33, 0x32, 0x11, 0x22, 0x22, 0x24, 0x41, 0x00,
+0x00, 0x00, 0x01, 0x22, 0x22, 0x23, 0x33, 0x31, 0x13, 0x31, 0x24, 0x42, 0x44, 0x44, 0x22, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x21, 0x01, 0x22, 0x22, 0x24, 0x41, 0x00,
+0x00, 0x00, 0x14, 0x22, 0x22, 0x33, 0x33, 0x31, 0x11, 0x31, 0x14, 0x42, 0x44, 0x44, 0x31, 0x11, 0x13, 0x12, 0x33, 0x33, 0x22, 0x10, 0x01, 0x22, 0x22, 0x24, 0x41, 0x00,
+0x00, 0x00, 0x12, 0x22, 0x23, 0x33, 0x33, 0x31, 0x11, 0x31, 0x31, 0x42, 0x44, 0x41, 0x11, 0x13, 0x13, 0x11, 0x22, 0x22, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x44, 0x10,
+0x00, 0x01, 0x42, 0x22, 0x32, 0x23, 0x33, 0x31, 0x00, 0x11, 0x41, 0x23, 0x22, 0x13, 0x43, 0x12, 0x13, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x44, 0x10,
+0x00, 0x01, 0x22, 0x21, 0x22, 0x23, 0x33, 0x31, 0x00, 0x01, 0x31, 0x23, 0x22, 0x11, 0x31, 0x31, 0x33, 0x33, 0x33, 0x33, 0x10, 0x01, 0x33, 0x22, 0x22, 0x22, 0x44, 0x10,
+0x00, 0x14, 0x22, 0x13, 0x22, 0x23, 0x33, 0x10, 0x00, 0x00, 0x11, 0x23, 0x22, 0x11, 0x13, 0x21, 0x33, 0x33, 0x33, 0x33, 0x10, 0x13, 0x33, 0x32, 0x22, 0x22, 0x22, 0x10,
+0x00, 0x12, 0x22, 0x13, 0x22, 0x33, 0x33, 0x10, 0x00, 0x00, 0x12, 0x23, 0x22, 0x12, 0x22, 0x13, 0x33, 0x33, 0x33, 0x31, 0x01, 0x33, 0x33, 0x32, 0x22, 0x22, 0x44, 0x10,
+0x01, 0x42, 0x21, 0x33, 0x33, 0x33, 0x33, 0x10, 0x00, 0x00, 0x01, 0x23, 0x22, 0x23, 0x21, 0x33, 0x33, 0x33, 0x33, 0x31, 0x13, 0x22, 0x33, 0x32, 0x22, 0x22, 0x22, 0x10,
+0x01, 0x42, 0x21, 0x33, 0x33, 0x33, 0x33, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x13, 0x33, 0x23, 0x33, 0x33, 0x31, 0x12, 0x22, 0x33, 0x32, 0x22, 0x22, 0x22, 0x10,
+0x01, 0x22, 0x21, 0x33, 0x33, 0x33, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x11, 0x22, 0x33, 0x33, 0x11, 0x32, 0x22, 0x33, 0x32, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x22, 0x14, 0x11, 0x11, 0x33, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x12, 0x33, 0x11, 0x31, 0x32, 0x23, 0x33, 0x32, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x22, 0x14, 0x14, 0x44, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x22, 0x21, 0x11, 0x13, 0x31, 0x32, 0x23, 0x33, 0x32, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x22, 0x14, 0x14, 0x43, 0x14, 0x41, 0x00, 0x01, 0x11, 0x22, 0x22, 0x33, 0x11, 0x11, 0x24, 0x42, 0x22, 0x22, 0x13, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x22, 0x11, 0x21, 0x21, 0x22, 0x10, 0x00, 0x11, 0x32, 0x22, 0x23, 0x23, 0x33, 0x11, 0x13, 0x31, 0x11, 0x12, 0x13, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x22, 0x21, 0x11, 0x11, 0x11, 0x00, 0x00, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x24, 0x42, 0x22, 0x31, 0x13, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x22, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x24, 0x42, 0x22, 0x22, 0x13, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x33, 0x33, 0x33, 0x11, 0x11, 0x24, 0x42, 0x22, 0x22, 0x13, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x33, 0x33, 0x33, 0x11, 0x11, 0x22, 0x22, 0x22, 0x21, 0x11, 0x31, 0x11, 0x31, 0x22, 0x22, 0x22, 0x44, 0x10,
+0x14, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x11, 0x33, 0x33, 0x33, 0x11, 0x12, 0x22, 0x22, 0x14, 0x14, 0x14, 0x42, 0x13, 0x22, 0x22, 0x34, 0x44, 0x10,
+0x01, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x23, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x14, 0x14, 0x34, 0x42, 0x12, 0x23, 0x23, 0x24, 0x41, 0x00,
+0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x23, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x21, 0x22, 0x13, 0x32, 0x34, 0x42, 0x10, 0x00,
+0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x13, 0x34, 0x44, 0x41, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x44, 0x44, 0x41, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x44, 0x41, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x11, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const Sprite kitflare_sprite = {SPRITE_PAL4, 56, 56, 5, kitflare_sprite_palette, kitflare_sprite_indices};
 
 Pokemon createKitflare(int level){
     Move moves[4] = {
@@ -215,6 +79,6 @@ Pokemon createKitflare(int level){
         Move(15, "QuickAttack", 15)
     };
     int hp = 40 + (level * 2); // Fragile but fast
-    return Pokemon("Kitflare", hp, level, moves, kitflare_sprite, 56, 56);
+    return Pokemon("Kitflare", hp, level, moves, &kitflare_sprite);
 }
 #endif
\ No newline at end of file
@@ -44,6 +44,21 @@
 #include "Black_Knight.h"
 #include "Black_Pawn.h"
 #include "Icons.h"
+#include "chessPosition.h"
+#include "chessMoves.h"
+#include "chessSearch.h"
+#include "searchWorker.h"
+#include "openingBook.h"
+#include "openingBookData.h"
+//Drawing helpers
+#include "spriteBlit.h"
+#include "spanBackdrop.h"
+#include "glyphAtlas.h"
+#ifdef USE_FRAMEBUFFER
+#include "frameBuffer.h"
+#else
+#include "spiPipeline.h"
+#endif
 
 // ==============================================================================
 // 1. PIN DEFINITIONS (ADJUST THESE FOR YOUR WIRING)
@@ -85,7 +100,13 @@
 // 2. DISPLAY SETUP & GLOBAL VARIABLES
 // ==============================================================================
 
-Adafruit_ILI9341 tft = Adafruit_ILI9341(TFT_CS, TFT_DC, TFT_RST);
+#ifdef USE_FRAMEBUFFER
+// Drawing goes to a PSRAM frame buffer; presentFrame() sends the changed regions.
+FrameBufferTFT tft = FrameBufferTFT(TFT_CS, TFT_DC, TFT_RST);
+#else
+// Pixel output is double-buffered: the next strip is composed while the last one is sent.
+PipelinedTFT tft = PipelinedTFT(TFT_CS, TFT_DC, TFT_RST);
+#endif
 
 // --- GAME STATE MANAGEMENT ---
 enum GameState {
@@ -112,6 +133,7 @@ const int numMenuItems = sizeof(menuItems) / sizeof(menuItems[0]);
 #define MAIN_MENU_COLOR BLACK
 #define CHESS_BOARD_LIGHT_COLOR 0xDEFB 
 #define CHESS_BOARD_DARK_COLOR 0x7D1F
+#define CHESS_DESTINATION_COLOR 0x2E45 // Markers on the squares the selected piece can move to
 
 
 // Pokemon Battle Specific Colors
@@ -178,6 +200,7 @@ void pokemonBattlerSelected();
 void chessSelected();
 void resetPokemonBattler();
 void resetChess();
+void cancelChessSearch();
 void resetSettings();
 void settingsSelected();
 
@@ -186,26 +209,45 @@ void settingsSelected();
 // ==============================================================================
 
 /**
- * @brief Draws a sprite to the TFT screen, ignoring pixels of a specific color to create transparency.
- * * @param x Horizontal starting position.
+ * @brief Draws a sprite to the TFT screen from its handle. Transparent pixels are skipped.
+ * Sprites in the headers are stored paletted (see sprite.h and tools/sprite_encode.py).
+ * @param x Horizontal starting position.
  * @param y Vertical starting position.
- * @param bitmap Pointer to the 16-bit color bitmap array.
- * @param w Width of the sprite.
- * @param h Height of the sprite.
- * @param transparentColor The color value to be treated as transparent (not drawn).
+ * @param sprite Sprite handle.
  */
-void drawSpriteWithTransparency(int x, int y, const uint16_t *bitmap, int w, int h, uint16_t transparentColor) {
-    for (int j = 0; j < h; j++) {
-        for (int i = 0; i < w; i++) {
-            
-            uint16_t color = pgm_read_word(&bitmap[j * w + i]);
-            
-            // Only draw if it matches your transparency key
-            if (color != transparentColor) {
-                tft.drawPixel(x + i, y + j, color);
-            }
-        }
-    }
+void drawSprite(int x, int y, const Sprite *sprite) {
+    blitSprite(tft, x, y, *sprite);
+}
+
+/**
+ * @brief Sends everything drawn since the last call to the screen and waits for it to get there.
+ * Called once per loop() and before any blocking delay that should show the new frame.
+ */
+void presentFrame() {
+#ifdef USE_FRAMEBUFFER
+  tft.flush();
+#endif
+  tft.dmaWait();
+}
+
+GlyphAtlas textAtlas;
+
+/**
+ * @brief Prints one line of text as a single opaque window of pre-rasterized glyphs.
+ * For text on a solid background: the character cells are filled with bg, so it
+ * must be the color already underneath. Text that would wrap or reach right is
+ * printed the regular (transparent) way instead. The text cursor ends up after
+ * the last character, as with print().
+ */
+void drawLabel(int x, int y, const char *text, uint8_t size, uint16_t fg, uint16_t bg, int right = 320) {
+  tft.setTextSize(size);
+  tft.setTextColor(fg);
+  if (textAtlas.drawText(tft, x, y, text, size, fg, bg, right)) {
+    tft.setCursor(x + strlen(text) * 6 * size, y);
+    return;
+  }
+  tft.setCursor(x, y);
+  tft.print(text);
 }
 
 /**
@@ -217,8 +259,10 @@ void displayStatus(const char* message, uint16_t color) {
   tft.setTextColor(color, BLACK);
   // Clear previous message area
   tft.fillRect(10, statusY, tft.width() - 20, 30, BLACK);
-  tft.setCursor(10, statusY);
-  tft.print(message);
+  if (!textAtlas.drawText(tft, 10, statusY, message, 2, color, BLACK, tft.width())) {
+    tft.setCursor(10, statusY);
+    tft.print(message);
+  }
 }
 
 /**
@@ -236,18 +280,17 @@ void drawMenuItemIcon(int itemIndex, int xPos, int yPos, uint16_t color) {
   
   if (itemIndex == 0) {
     // Icon for Tic-Tac-Toe: Draw a 16x16 Bitmap
-    // x, y, bitmap array, width, height, color
-    drawSpriteWithTransparency(xPos, yPos, TIC_TAC_TOE_ICON_BITS, iconSize, iconSize, 0x0000);
+    drawSprite(xPos, yPos, &TIC_TAC_TOE_ICON_BITS);
     
   }else if(itemIndex == 1) {
     // draw Pokemon Icon
-    drawSpriteWithTransparency(xPos, yPos, POKEMON_ICON_BITS, iconSize, iconSize, 0x0000);
+    drawSprite(xPos, yPos, &POKEMON_ICON_BITS);
   }else if (itemIndex == 2) {
     // draw Chess Icon
-    drawSpriteWithTransparency(xPos, yPos, CHESS_ICON_BITS, iconSize, iconSize, 0x0000);
+    drawSprite(xPos, yPos, &CHESS_ICON_BITS);
   }else if (itemIndex == 3) {
     // draw Settings Icon
-    drawSpriteWithTransparency(xPos, yPos, SETTINGS_ICON_BITS, iconSize, iconSize, 0x0000);
+    drawSprite(xPos, yPos, &SETTINGS_ICON_BITS);
   }
    else {
     // Icon for "Coming Soon...": Placeholder box with '?'
@@ -266,12 +309,8 @@ void drawMenuItemIcon(int itemIndex, int xPos, int yPos, uint16_t color) {
  */
 void drawMenu() {
   tft.fillScreen(MAIN_MENU_COLOR);
-  tft.setTextSize(3);
-  tft.setTextColor(WHITE);
-  tft.setCursor(50, 20);
-  tft.print("HANDHELD MENU");
+  drawLabel(50, 20, "HANDHELD MENU", 3, WHITE, MAIN_MENU_COLOR);
 
-  tft.setTextSize(2);
   for (int i = 0; i < numMenuItems; i++) {
     int yPos = 80 + i * 40;
 
@@ -279,9 +318,7 @@ void drawMenu() {
     drawMenuItemIcon(i, 15, yPos, WHITE);
 
     // Draw Text
-    tft.setCursor(50, 80 + i * 40);
-    tft.setTextColor(WHITE);
-    tft.print(menuItems[i]);
+    drawLabel(50, 80 + i * 40, menuItems[i], 2, WHITE, MAIN_MENU_COLOR);
   }
 }
 
@@ -302,10 +339,7 @@ void drawMenuCursor(int prevSelection, int newSelection) {
     tft.fillRect(xPos, prevYPos -2, width, height, BLACK);
     
     // Redraw Text (WHITE)
-    tft.setCursor(50, prevYPos);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.print(menuItems[prevSelection]);
+    drawLabel(50, prevYPos, menuItems[prevSelection], 2, WHITE, BLACK);
     
     // Redraw Icon (WHITE) (Icon position: x=5, centered vertically around text line)
     //drawMenuItemIcon(prevSelection, 15, prevYPos, WHITE);
@@ -318,10 +352,7 @@ void drawMenuCursor(int prevSelection, int newSelection) {
   tft.fillRect(xPos, newYPos - 2, width, height, CURSOR_COLOR);
   
   // Redraw Text (BLACK on the colored cursor)
-  tft.setCursor(50, newYPos);
-  tft.setTextColor(BLACK); 
-  tft.setTextSize(2);
-  tft.print(menuItems[newSelection]);
+  drawLabel(50, newYPos, menuItems[newSelection], 2, BLACK, CURSOR_COLOR);
   
   // Redraw Icon (BLACK on the colored cursor)
   //drawMenuItemIcon(newSelection, 15, newYPos, WHITE);
@@ -370,9 +401,11 @@ void playTone(int freq, int duration) {
 
 void goHome(){
   //playTone(1000, 50);
+  cancelChessSearch();
   currentState = STATE_MENU;
   drawMenu();
   drawMenuCursor(-1, menuSelection); // Draw cursor at current selection
+  presentFrame();
   delay(300); // Debounce
 }
 
@@ -497,6 +530,7 @@ void handleMenuInput() {
       // Placeholder for other games
       displayStatus("Game unavailable", RED);
     }
+    presentFrame();
     delay(300); // Debounce select press
   }
 }
@@ -704,6 +738,7 @@ void ticTacToeGameOver(int winner) {
   }
   if(digitalRead(PIN_SELECT) == LOW) {
       resetTicTacToe();
+      presentFrame();
       delay(300);
   }
   
@@ -782,6 +817,7 @@ void handleTicTacToeInput() {
       }
 
       // Debounce the select press
+      presentFrame();
       delay(300);
     }
   }
@@ -820,6 +856,22 @@ enum BattlePhase {
 BattlePhase battlePhase = PHASE_PLAYER_CHOICE;
 
 void executeTurn(Move playerMove);
+void updateBattleTurn();
+
+// How long each step of an attack stays on screen.
+#define BATTLE_MESSAGE_MS 1500 // "X used Y!" before the damage lands
+#define BATTLE_HP_HOLD_MS 1000 // Shortest time from the damage to the next step
+#define BATTLE_FAINT_MS 2000   // "X fainted!" before the result screen
+
+// Steps of the attack being played out, advanced by updateBattleTurn().
+enum AttackStep {
+  ATTACK_ANNOUNCE, // Move name on screen, damage not applied yet
+  ATTACK_HP,       // HP bars moving towards the new health
+  ATTACK_FAINTED   // Faint message on screen
+};
+AttackStep attackStep = ATTACK_ANNOUNCE;
+unsigned long attackStepStart = 0;
+Move attackMove;
 
 int pokemonMenuSelection = 0; 
 int pokemonSubMenuSelection = 0; 
@@ -912,17 +964,12 @@ void drawPokemonBattlerUI() {
       opt3 = pokemonMenuItems.at(pokemonMenuSelection).at(3);
   }
 
-  tft.setTextSize(2);
-  tft.setTextColor(BLACK);
-  
-  tft.setCursor(pokemonMenuRow1StartingX, pokemonMenuRow1StartingY);
-  tft.print(opt0.c_str());
-  tft.setCursor(pokemonMenuRow1StartingX + 100, pokemonMenuRow1StartingY);
-  tft.print(opt1.c_str());
-  tft.setCursor(pokemonMenuRow2StartingX, pokemonMenuRow2StartingY);
-  tft.print(opt2.c_str());
-  tft.setCursor(pokemonMenuRow2StartingX + 100, pokemonMenuRow2StartingY);
-  tft.print(opt3.c_str());
+  // Right column first: a long left label then falls back to transparent text
+  // instead of covering the start of its neighbour with background cells.
+  drawLabel(pokemonMenuRow1StartingX + 100, pokemonMenuRow1StartingY, opt1.c_str(), 2, BLACK, WHITE);
+  drawLabel(pokemonMenuRow2StartingX + 100, pokemonMenuRow2StartingY, opt3.c_str(), 2, BLACK, WHITE);
+  drawLabel(pokemonMenuRow1StartingX, pokemonMenuRow1StartingY, opt0.c_str(), 2, BLACK, WHITE, pokemonMenuRow1StartingX + 100);
+  drawLabel(pokemonMenuRow2StartingX, pokemonMenuRow2StartingY, opt2.c_str(), 2, BLACK, WHITE, pokemonMenuRow2StartingX + 100);
 
   drawPokemonMenuCursor(-1, pokemonSubMenuSelection);
 }
@@ -940,6 +987,7 @@ void handlePokemonBattlerInput() {
        currentState = STATE_MENU;
        drawMenu();
        drawMenuCursor(-1, 0);
+       presentFrame();
        delay(500);
     }else if (digitalRead(PIN_SELECT) == LOW) {
        resetPokemonBattler();
@@ -947,9 +995,10 @@ void handlePokemonBattlerInput() {
     return; // Stop processing other inputs
   }
 
-  // 2. IF EXECUTING TURN, IGNORE INPUTS (Blocking)
-  if (battlePhase == PHASE_EXECUTING_TURN) {
-    return; 
+  // 2. IF EXECUTING TURN, PLAY IT OUT AND IGNORE INPUTS
+  if (battlePhase == PHASE_EXECUTING_TURN || battlePhase == PHASE_ENEMY_EXECUTING_TURN) {
+    updateBattleTurn();
+    return;
   }
 
   // 3. MENU NAVIGATION (Only if in Player Choice Phase)
@@ -1011,22 +1060,123 @@ void handlePokemonBattlerInput() {
 
 // --- HELPER: Draw Filled Ellipse ---
 void drawFilledEllipse(int cx, int cy, int rx, int ry, uint16_t color) {
-  for (int y = -ry; y <= ry; y++) {
-    // Calculate the width of the ellipse at this y-level
-    int width = (int)(2.0 * rx * sqrt(1.0 - ((float)(y * y) / (float)(ry * ry))));
-    
-    tft.drawFastHLine(cx - width / 2, cy + y, width, color);
+  fillEllipseSpans(tft, cx, cy, rx, ry, color);
+}
+
+// --- BATTLE BACKDROP ---
+// Platform centers; the Pokemon sprites are placed relative to them.
+#define ENEMY_BASE_X 230
+#define ENEMY_BASE_Y 90
+#define PLAYER_BASE_X 90
+#define PLAYER_BASE_Y 180
+#define BATTLE_BACKDROP_HEIGHT 190 // The menu starts here
+
+SpanBackdrop *battleBackdrop = nullptr;
+
+/**
+ * @brief Draws the sky, the grass and both platforms into any target with fillRect() and fillEllipse().
+ */
+template <typename Target>
+void paintBattleBackdrop(Target &target) {
+  // Sky (Top ~40%)
+  target.fillRect(0, 0, 320, 80, SKY_BLUE);
+  // Grass (Bottom ~60% until the menu starts at 190)
+  target.fillRect(0, 80, 320, 110, GRASS_GREEN);
+  // Enemy Platform (Top Right) and Player Platform (Bottom Left)
+  target.fillEllipse(ENEMY_BASE_X, ENEMY_BASE_Y, 70, 25, PLATFORM_COL);
+  target.fillEllipse(PLAYER_BASE_X, PLAYER_BASE_Y, 80, 30, PLATFORM_COL);
+}
+
+/**
+ * @brief Puts the battle background back over a region, e.g. behind a sprite or HUD box.
+ * The backdrop is rasterized once into a span list; after that any region is one
+ * address window of solid-color runs. If the cache cannot be built the whole
+ * backdrop is drawn directly instead.
+ */
+void restoreBattleBackdrop(int x, int y, int w, int h) {
+  if (!battleBackdrop) {
+    battleBackdrop = new SpanBackdrop(320, BATTLE_BACKDROP_HEIGHT);
+    paintBattleBackdrop(*battleBackdrop);
   }
+  if (battleBackdrop->valid()) {
+    battleBackdrop->restore(tft, x, y, w, h);
+    return;
+  }
+  struct Screen {
+    void fillRect(int x, int y, int w, int h, uint16_t color) { tft.fillRect(x, y, w, h, color); }
+    void fillEllipse(int cx, int cy, int rx, int ry, uint16_t color) { drawFilledEllipse(cx, cy, rx, ry, color); }
+  } screen;
+  paintBattleBackdrop(screen);
+}
+
+// --- HP BAR STATE ---
+#define HUD_W 140
+#define HUD_H 45
+#define HP_BAR_X 30 // Offsets inside the HUD box
+#define HP_BAR_Y 25
+#define HP_BAR_W 100
+#define HP_BAR_H 6
+#define HP_BAR_EMPTY 0x52AA // Dark grey empty bar
+#define HP_TEXT_X 50
+#define HP_TEXT_Y 35
+#define HP_TEXT_W 42 // "999/999" at text size 1
+#define HP_BAR_FRAME_MS 20 // Animation frame period (50 fps)
+#define HP_BAR_STEP 1 // Bar columns drained or refilled per frame
+
+// What one HUD box currently shows, so HP changes only repaint what differs.
+struct HUDState {
+  int x, y;
+  bool isPlayer;
+  int barFill;      // Filled bar columns on screen
+  int shownHP;      // Number on screen (player only)
+  int targetHP;     // Health the bar is moving towards
+  int maxHP;
+};
+
+HUDState enemyHUD = {10, 15, false, 0, 0, 0, 1};
+HUDState playerHUD = {170, 135, true, 0, 0, 0, 1};
+unsigned long lastHPFrame = 0;
+bool hpBarsMoving = false;
+
+int hpBarFill(int hp, int maxHP) {
+  return constrain(HP_BAR_W * hp / maxHP, 0, HP_BAR_W);
+}
+
+// Determine color (Green > 50%, Yellow > 20%, Red otherwise)
+uint16_t hpBarColor(int fill) {
+  if (fill * 5 < HP_BAR_W) return RED;
+  if (fill * 2 < HP_BAR_W) return YELLOW;
+  return HP_GREEN;
+}
+
+/**
+ * @brief Paints bar columns [from, to) filled or empty for the given fill level.
+ */
+void paintHPBarColumns(const HUDState &hud, int from, int to, int fill) {
+  int split = constrain(fill, from, to);
+  if (split > from) tft.fillRect(hud.x + HP_BAR_X + from, hud.y + HP_BAR_Y, split - from, HP_BAR_H, hpBarColor(fill));
+  if (to > split) tft.fillRect(hud.x + HP_BAR_X + split, hud.y + HP_BAR_Y, to - split, HP_BAR_H, HP_BAR_EMPTY);
+}
+
+void drawHPText(HUDState &hud, int hp) {
+  tft.fillRect(hud.x + HP_TEXT_X, hud.y + HP_TEXT_Y, HP_TEXT_W, 8, HUD_BG);
+  tft.setTextColor(BLACK);
+  tft.setTextSize(1);
+  tft.setCursor(hud.x + HP_TEXT_X, hud.y + HP_TEXT_Y);
+  tft.print(hp);
+  tft.print("/");
+  tft.print(hud.maxHP);
+  hud.shownHP = hp;
 }
 
 // --- HELPER: Draw HP Bar and Text Box ---
-void drawHUD(int x, int y, const char* name, int level, int currentHP, int maxHP, bool isPlayer) {
-  int w = 140;
-  int h = 45;
+void drawHUD(HUDState &hud, const char* name, int level, int currentHP, int maxHP) {
+  int x = hud.x;
+  int y = hud.y;
   
   // Draw Box Background (with black outline)
-  tft.fillRect(x, y, w, h, HUD_BG); // Gray background
-  tft.drawRect(x, y, w, h, BLACK);  // Border
+  tft.fillRect(x, y, HUD_W, HUD_H, HUD_BG); // Gray background
+  tft.drawRect(x, y, HUD_W, HUD_H, BLACK);  // Border
   
   // Text Settings
   tft.setTextColor(BLACK);
@@ -1050,115 +1200,145 @@ void drawHUD(int x, int y, const char* name, int level, int currentHP, int maxHP
   tft.print("Lv");
   tft.print(level);
 
-  // 3. HP Bar Background
-  int barX = x + 30;
-  int barY = y + 25;
-  int barW = 100;
-  int barH = 6;
-  
-  tft.fillRect(barX, barY, barW, barH, 0x52AA); // Dark grey empty bar
-  
-  // 4. HP Bar Fill (Calculate percentage)
-  float hpPercent = (float)currentHP / maxHP;
-  int fillW = (int)(barW * hpPercent);
-  
-  // Determine color (Green > 50%, Yellow > 20%, Red otherwise)
-  uint16_t hpColor = HP_GREEN;
-  if(hpPercent < 0.2) hpColor = RED;
-  else if(hpPercent < 0.5) hpColor = YELLOW;
-  
-  tft.fillRect(barX, barY, fillW, barH, hpColor);
+  // 3. HP Bar
+  hud.maxHP = maxHP;
+  hud.targetHP = currentHP;
+  hud.barFill = hpBarFill(currentHP, maxHP);
+  paintHPBarColumns(hud, 0, HP_BAR_W, hud.barFill);
 
-  // 5. Numeric HP (Only for Player)
-  if (isPlayer) {
-    tft.setCursor(x + 50, y + 35);
-    tft.print(currentHP);
-    tft.print("/");
-    tft.print(maxHP);
+  // 4. Numeric HP (Only for Player)
+  if (hud.isPlayer) {
+    drawHPText(hud, currentHP);
   }
 }
 
 void drawHPUI(){
   // 4. Draw Enemy HUD (Top Left)
-  drawHUD(10, 15, enemyPokemon.getName(), enemyPokemon.getLevel(), enemyPokemon.getHealth(), enemyPokemon.getMaxHealth(), false);
+  drawHUD(enemyHUD, enemyPokemon.getName(), enemyPokemon.getLevel(), enemyPokemon.getHealth(), enemyPokemon.getMaxHealth());
 
   // 5. Draw Player HUD (Right side, above menu)
-  drawHUD(170, 135, playerPokemon.getName(), playerPokemon.getLevel(), playerPokemon.getHealth(), playerPokemon.getMaxHealth(), true); // Player
+  drawHUD(playerHUD, playerPokemon.getName(), playerPokemon.getLevel(), playerPokemon.getHealth(), playerPokemon.getMaxHealth()); // Player
+  hpBarsMoving = false;
 }
 
-// --- MAIN SCENE DRAW FUNCTION ---
-void drawBattleScene() {
-  // 1. Draw Background (Split Screen)
-  // Sky (Top ~40%)
-  tft.fillRect(0, 0, 320, 80, SKY_BLUE);
-  // Grass (Bottom ~60% until the menu starts at 190)
-  tft.fillRect(0, 80, 320, 110, GRASS_GREEN); // Ends at y=190
+/**
+ * @brief Moves one HUD's bar a step towards its target and repaints only what changed.
+ * Only the bar columns whose color differs are filled; the number is redrawn when its
+ * value changes. While the bar moves the number follows it, and it lands on the exact
+ * health once the bar arrives.
+ * @return True while the bar still has to move.
+ */
+bool stepHUD(HUDState &hud) {
+  int target = hpBarFill(hud.targetHP, hud.maxHP);
+  int oldFill = hud.barFill;
+  int newFill = oldFill < target ? min(oldFill + HP_BAR_STEP, target) : max(oldFill - HP_BAR_STEP, target);
+
+  if (newFill != oldFill) {
+    if (hpBarColor(newFill) != hpBarColor(oldFill)) {
+      // Crossing a color threshold recolors the whole filled part.
+      paintHPBarColumns(hud, 0, max(oldFill, newFill), newFill);
+    } else {
+      paintHPBarColumns(hud, min(oldFill, newFill), max(oldFill, newFill), newFill);
+    }
+    hud.barFill = newFill;
+  }
+
+  if (hud.isPlayer) {
+    int hp = hud.targetHP;
+    if (newFill != target) {
+      // Health the bar currently stands for, never past the target.
+      int barHP = (newFill * hud.maxHP + HP_BAR_W - 1) / HP_BAR_W;
+      hp = oldFill > target ? max(barHP, hud.targetHP) : min(barHP, hud.targetHP);
+    }
+    if (hp != hud.shownHP) drawHPText(hud, hp);
+  }
+  return newFill != target;
+}
+
+/**
+ * @brief Starts both HP bars moving towards the Pokemon's current health.
+ * The bars are advanced by tickHPUI(); nothing is drawn here.
+ */
+void updateHPUI() {
+  enemyHUD.targetHP = enemyPokemon.getHealth();
+  playerHUD.targetHP = playerPokemon.getHealth();
+  hpBarsMoving = true;
+}
 
-  // 2. Draw Enemy Platform (Top Right)
-  int enemyBaseX = 230;
-  int enemyBaseY = 90;
+/**
+ * @brief Advances both HP bars by one frame. Does not wait.
+ * @return True while either bar is still moving.
+ */
+bool stepHPUI() {
+  bool enemyMoving = stepHUD(enemyHUD);
+  bool playerMoving = stepHUD(playerHUD);
+  hpBarsMoving = enemyMoving || playerMoving;
+  return hpBarsMoving;
+}
 
-  drawFilledEllipse(enemyBaseX, enemyBaseY, 70, 25, PLATFORM_COL);
+/**
+ * @brief Advances the HP bars if a frame is due, so the drain runs at HP_BAR_FRAME_MS per step.
+ * Safe to call every loop(); idle bars cost nothing.
+ * @return True while either bar is still moving.
+ */
+bool tickHPUI() {
+  unsigned long now = millis();
+  if (!hpBarsMoving || now - lastHPFrame < HP_BAR_FRAME_MS) {
+    return hpBarsMoving;
+  }
+  lastHPFrame = now;
+  return stepHPUI();
+}
 
-  
+// Top-left corner of a battler's sprite: the enemy stands on the top-right platform,
+// the player on the bottom-left one.
+int battlerX(bool enemy) { return enemy ? ENEMY_BASE_X - 30 : PLAYER_BASE_X - 30; }
+int battlerY(bool enemy) { return enemy ? ENEMY_BASE_Y - 30 : PLAYER_BASE_Y - 60; }
 
-  // 3. Draw Player Platform (Bottom Left)
-  int playerBaseX = 90;
-  int playerBaseY = 180;
-  drawFilledEllipse(playerBaseX, playerBaseY, 80, 30, PLATFORM_COL);
+void drawBattler(bool enemy) {
+  Pokemon &pokemon = enemy ? enemyPokemon : playerPokemon;
+  drawSprite(battlerX(enemy), battlerY(enemy), pokemon.getSprite());
+}
+
+/**
+ * @brief Takes a battler off the screen by putting the backdrop back under its sprite.
+ * Only the sprite's own rectangle is sent; the HUD boxes never overlap it.
+ */
+void eraseBattler(bool enemy) {
+  const Sprite *sprite = (enemy ? enemyPokemon : playerPokemon).getSprite();
+  restoreBattleBackdrop(battlerX(enemy), battlerY(enemy), sprite->width, sprite->height);
+}
+
+// --- MAIN SCENE DRAW FUNCTION ---
+void drawBattleScene() {
+  // 1. Background and platforms, from the backdrop cache
+  restoreBattleBackdrop(0, 0, 320, BATTLE_BACKDROP_HEIGHT);
 
   drawHPUI();
   
 
   // 6. Draw Pokemon SpritesS
-  // Enemy
-  drawSpriteWithTransparency(enemyBaseX - 30, enemyBaseY - 30, enemyPokemon.getSprite(), enemyPokemon.getSpriteWidth(), enemyPokemon.getSpriteHeight(), 0x0000); 
-
-  // Player  
-  drawSpriteWithTransparency(playerBaseX - 30, playerBaseY - 60, playerPokemon.getSprite(), playerPokemon.getSpriteWidth(), playerPokemon.getSpriteHeight(), 0x0000);
+  drawBattler(true);
+  drawBattler(false);
 }
 
 // BATTLE MECHANICS
 void drawBattleMessage(const char* message) {
   tft.fillRect(0,190,tft.width(),tft.height() - 190,WHITE);
   tft.drawRect(10,200,300,35,BLACK);
-  tft.setCursor(20,210);
-  tft.setTextSize(2);
-  tft.print(message);
+  drawLabel(20, 210, message, 2, BLACK, WHITE, 309); // Inside the box border
 }
 
-bool performAttack(Pokemon &attacker, Pokemon &defender, Move move) {
+/**
+ * @brief Shows an attack's message and starts playing it out. Does not wait; updateBattleTurn()
+ * takes it from there.
+ */
+void startAttack(Pokemon &attacker, Move move) {
   String msg = String(attacker.getName()) + " used " + move.getName() + "!";
   drawBattleMessage(msg.c_str());
-  
-  delay(1500); // Wait for message to be read
-
-  int damage = move.getDamage();
-
-  if (damage < 0) {
-    attacker.heal(abs(damage));
-  }else{
-    defender.takeDamage(damage);
-  }
-
-  if(defender.getHealth() < 0){
-    defender.heal(abs(defender.getHealth()));
-  }
-
-  drawHPUI();
-  delay(1000);
-
-  
-
-  if (defender.getHealth() <= 0) {
-    char * defenderName = defender.getNonConstName();
-    msg = String(defenderName) + " fainted!";
-    drawBattleMessage(msg.c_str());
-    delay(2000);
-    return true; // Battle Ends
-  }
-  return false; // Battle Continues
-  
+  attackMove = move;
+  attackStep = ATTACK_ANNOUNCE;
+  attackStepStart = millis();
 }
 
 void endBattle(bool playerWon){
@@ -1191,30 +1371,66 @@ void endBattle(bool playerWon){
 }
 void executeTurn(Move playerMove) {
   battlePhase = PHASE_EXECUTING_TURN; // Lock inputs
+  startAttack(playerPokemon, playerMove);
+}
 
-  // --- PLAYER TURN ---
-  bool enemyFainted = performAttack(playerPokemon, enemyPokemon, playerMove);
-
-  if (enemyFainted) {
-    endBattle(true); // Player wins
+/**
+ * @brief Plays out the attack in progress, one step per loop() pass: the message is held, then
+ * the damage lands and the HP bars drain (one tickHPUI() per pass), and only once the bars are
+ * idle does the turn move on to the enemy's attack, the faint message or the player's menu.
+ * The attacker is the player during PHASE_EXECUTING_TURN and the enemy during
+ * PHASE_ENEMY_EXECUTING_TURN.
+ */
+void updateBattleTurn() {
+  bool playerAttacks = (battlePhase == PHASE_EXECUTING_TURN);
+  Pokemon &attacker = playerAttacks ? playerPokemon : enemyPokemon;
+  Pokemon &defender = playerAttacks ? enemyPokemon : playerPokemon;
+  unsigned long elapsed = millis() - attackStepStart;
+
+  if (attackStep == ATTACK_ANNOUNCE) {
+    if (elapsed < BATTLE_MESSAGE_MS) return; // Wait for message to be read
+
+    int damage = attackMove.getDamage();
+    if (damage < 0) {
+      attacker.heal(abs(damage));
+    }else{
+      defender.takeDamage(damage);
+    }
+    if(defender.getHealth() < 0){
+      defender.heal(abs(defender.getHealth()));
+    }
+    updateHPUI();
+    attackStep = ATTACK_HP;
+    attackStepStart = millis();
     return;
   }
 
-  // --- ENEMY TURN ---
-  // Simple AI: Pick a random move (0-3)
-  int randIndex = random(0, 4);
-  Move enemyMove = enemyPokemon.getMove(randIndex);
-
-  bool playerFainted = performAttack(enemyPokemon, playerPokemon, enemyMove);
-
-  if (playerFainted) {
-    endBattle(false); // Player loses
+  if (attackStep == ATTACK_HP) {
+    // Let the bars drain, and hold the result for at least BATTLE_HP_HOLD_MS.
+    if (tickHPUI() || elapsed < BATTLE_HP_HOLD_MS) return;
+
+    if (defender.getHealth() <= 0) {
+      eraseBattler(playerAttacks); // The fainted Pokemon leaves the field
+      String msg = String(defender.getNonConstName()) + " fainted!";
+      drawBattleMessage(msg.c_str());
+      attackStep = ATTACK_FAINTED;
+      attackStepStart = millis();
+    } else if (playerAttacks) {
+      // --- ENEMY TURN ---
+      // Simple AI: Pick a random move (0-3)
+      battlePhase = PHASE_ENEMY_EXECUTING_TURN;
+      startAttack(enemyPokemon, enemyPokemon.getMove(random(0, 4)));
+    } else {
+      // --- RETURN TO MENU ---
+      battlePhase = PHASE_PLAYER_CHOICE;
+      drawPokemonBattlerUI(); // Redraw the menu options
+    }
     return;
   }
 
-  // --- RETURN TO MENU ---
-  battlePhase = PHASE_PLAYER_CHOICE;
-  drawPokemonBattlerUI(); // Redraw the menu options
+  if (elapsed >= BATTLE_FAINT_MS) {
+    endBattle(playerAttacks); // Battle Ends
+  }
 }
 
 void resetPokemonBattler() {
@@ -1227,7 +1443,7 @@ void resetPokemonBattler() {
   playerPokemon = createRandomPokemon(1);
   enemyPokemon = createRandomPokemon(1);
 
-  tft.fillScreen(BLACK);
+  // The backdrop and the menu cover the whole screen, so nothing is cleared first.
   drawBattleScene();
   drawPokemonBattlerUI();
 }
@@ -1272,6 +1488,9 @@ std::array<std::array<int, 8>, 8> chessBoard = {{
   {1, 1, 1, 1, 1, 1, 1, 1},
   {4, 3, 2, 5, 6, 2, 3, 4},
 }};
+// Bitboard copy of chessBoard that answers the rule queries (attacks, check, move geometry).
+// chessBoard stays what gets drawn; moves go through playChessMove() to keep the two in step.
+ChessPosition chessPosition;
 // Chess board cursor. Represents the current location of the cursor on the chess board. Numbered from left to right and top to bottom.
 int chessBoardCursorLocation = 0;
 int chessBoardPreviousCursorLocation = -1;
@@ -1307,128 +1526,116 @@ int numConnMenu = 3;
 int connMenuSelection = 0;
 
 int getPieceAt(int index){
-  int row = index / 8;
-  int col = index % 8;
-  return chessBoard[row][col];
-}
-
-bool isPathClear(int startIdx, int endIdx){
-  int startRow = startIdx / 8;
-  int startCol = startIdx % 8;
-  int endRow = endIdx / 8;
-  int endCol = endIdx % 8;
- 
-  int dRow = (endRow - startRow) == 0 ? 0 : (endRow - startRow) > 0 ? 1 : -1;
-  int dCol = (endCol - startCol) == 0 ? 0 : (endCol - startCol) > 0 ? 1 : -1;
-  
-  int currentRow = startRow + dRow;
-  int currentCol = startCol + dCol;
-  
-  while (currentRow != endRow || currentCol != endCol){
-    if (chessBoard[currentRow][currentCol] != 0){
-      return false;
+  return chessPosition.pieceAt(index);
+}
+
+/**
+ * @brief Reloads the bitboards from chessBoard, white to move.
+ * Castling rights are given for every king and rook still on its home square.
+ */
+void syncChessPosition(){
+  chessPosition.setBoard(chessBoard);
+  uint8_t rights = 0;
+  if (chessPosition.pieceAt(60) == CHESS_KING) {
+    if (chessPosition.pieceAt(63) == CHESS_ROOK) rights |= CASTLE_WHITE_KING;
+    if (chessPosition.pieceAt(56) == CHESS_ROOK) rights |= CASTLE_WHITE_QUEEN;
+  }
+  if (chessPosition.pieceAt(4) == -CHESS_KING) {
+    if (chessPosition.pieceAt(7) == -CHESS_ROOK) rights |= CASTLE_BLACK_KING;
+    if (chessPosition.pieceAt(0) == -CHESS_ROOK) rights |= CASTLE_BLACK_QUEEN;
+  }
+  chessPosition.setCastlingRights(rights);
+}
+
+/**
+ * @brief Builds the move a piece makes from one square to another.
+ * The kind comes from the board: a king stepping two columns castles, a pawn
+ * moving diagonally onto the en passant square captures en passant, and a pawn
+ * reaching the last rank promotes to a queen (auto-queen for simplicity).
+ */
+ChessMove chessMoveFor(int fromIdx, int toIdx){
+  int piece = abs(chessPosition.pieceAt(fromIdx));
+  if (piece == CHESS_KING && abs(toIdx - fromIdx) == 2) {
+    return makeChessMove(fromIdx, toIdx, MOVE_CASTLE);
+  }
+  if (piece == CHESS_PAWN) {
+    if (toIdx < 8 || toIdx >= 56) {
+      return makeChessMove(fromIdx, toIdx, MOVE_PROMOTION, CHESS_QUEEN);
+    }
+    if (toIdx == chessPosition.enPassantSquare() && (toIdx - fromIdx) % 8 != 0) {
+      return makeChessMove(fromIdx, toIdx, MOVE_EN_PASSANT);
     }
-    currentRow += dRow;
-    currentCol += dCol;
   }
-  return true;
+  return makeChessMove(fromIdx, toIdx);
 }
 
+/**
+ * @brief Plays a move on the bitboards and copies the result to chessBoard.
+ * The move can be taken back with chessPosition.unmakeMove() followed by a
+ * resync of chessBoard.
+ */
+void playChessMove(ChessMove move){
+  chessPosition.makeMove(move);
+  for (int square = 0; square < 64; square++) {
+    chessBoard[square / 8][square % 8] = chessPosition.pieceAt(square);
+  }
+}
+
+/**
+ * @brief Plays the move from one square to another.
+ * Castling also moves the rook, en passant removes the passed pawn, and pawns
+ * reaching the last rank become queens.
+ */
+void playChessMove(int fromIdx, int toIdx){
+  playChessMove(chessMoveFor(fromIdx, toIdx));
+}
+
+/*
+* @brief Checks the move geometry of the piece on fromIdx: its movement pattern, blocked
+* paths and not landing on its own piece. Castling needs the right and an empty path, en
+* passant the position's en passant square. Does not check whether the king is left in check.
+*/
 bool isValidMove(int fromIdx, int toInx){
-  int piece = getPieceAt(fromIdx);
-  int target = getPieceAt(toInx);
+  int piece = chessPosition.pieceAt(fromIdx);
+  if (piece == 0) {
+    return false;
+  }
+  int color = (piece > 0) ? 1 : -1;
 
   // check if target is own piece
-  if (target != 0)
-  {
-    bool sameColor = (piece > 0 && target > 0) || (piece < 0 && target < 0);
-    if(sameColor)
-    {
-      return false;
-    }
+  if (chessPosition.side(color) & squareBit(toInx)) {
+    return false;
   }
-  
-  int startRow = fromIdx / 8;
-  int startCol = fromIdx % 8;
-  int endRow = toInx / 8;
-  int endCol = toInx % 8;
-  int dRow = endRow - startRow;
-  int dCol = endCol - startCol;
-  int absRow = abs(dRow);
-  int absCol = abs(dCol);
-
-  int type = abs(piece);
-
-  switch(type){
-    case 1: // Pawns
-    {
-      // White Pieces are Positive (>0). Black are Negative (<0).
-      // Row 0 is Top. Row 7 is Bottom.
-      // White moves UP (Row decreases: 6 -> 5). Direction = -1.
-      // Black moves DOWN (Row increases: 1 -> 2). Direction = 1.
-      int direction = (piece > 0) ? -1 : 1; 
-      int startRowLimit = (piece > 0) ? 6 : 1;
-
-      // 1. Move Forward 1 space (Non-Capture)
-      if (dCol == 0 && dRow == direction && target == 0) {
-        return true;
-      }
 
-      // 2. Move forward 2 (First move only, Non-Capture)
-      if (dCol == 0 && dRow == direction * 2 && startRow == startRowLimit && target == 0) {
-        // Check obstruction
-        if (chessBoard[startRow + direction][startCol] == 0) {
-          return true;
-        }
-      }
-      if (absCol == 1 && dRow == direction) {
-          
-          // Ideally, we split this, but for simplicity:
-          if (target != 0) return true; 
-          
-          // Hack: if target is 0, this returns false, which is correct for moving
-          // BUT incorrect for "is square attacked".
-          // For now, let's leave it as returning true ONLY if target != 0.
-          // *Correction*: We need a slight modification to isSquareAttacked to handle pawn captures specifically 
-          // or we modify this logic.
-          // Simplest fix: Just check target != 0.
-          return false;
-      }
-      return false;
+  if (abs(piece) == CHESS_PAWN) {
+    // White moves UP (index - 8), Black moves DOWN (index + 8).
+    int step = (piece > 0) ? -8 : 8;
+    int startRow = (piece > 0) ? 6 : 1;
+    bool targetEmpty = chessPosition.pieceAt(toInx) == 0;
+
+    // 1. Move Forward 1 space (Non-Capture)
+    if (toInx == fromIdx + step && targetEmpty) {
+      return true;
     }
-    case 2: // Bishops
-      if (absRow == absCol)
-      {
-        return isPathClear(fromIdx, toInx);
-      }
-      return false;
-      
-    case 3: // Knights
-      if((absRow == 2 && absCol == 1) || (absRow == 1 && absCol == 2)){
-        return true;
-      }
-      return false;
-    case 4: // Rooks
-      if (dRow == 0 || dCol == 0)
-      {
-        return isPathClear(fromIdx, toInx);
-      }
-      return false;
-      
-    case 5: // Queens
-      if (dRow == 0 || dCol == 0 || absRow == absCol)
-      {
-        return isPathClear(fromIdx, toInx);
-      }
-      return false;
-    case 6: // Kings
-      if (absRow <= 1 && absCol <= 1)
-      {
-        return true;
-      }
-      return false;
+    // 2. Move forward 2 (First move only, Non-Capture, not jumping over a piece)
+    if (toInx == fromIdx + 2 * step && fromIdx / 8 == startRow && targetEmpty &&
+        chessPosition.pieceAt(fromIdx + step) == 0) {
+      return true;
+    }
+    // 3. Diagonal capture, or en passant onto the square the enemy pawn skipped
+    return (!targetEmpty || toInx == chessPosition.enPassantSquare()) &&
+           (pawnAttacks(color, fromIdx) & squareBit(toInx));
   }
-  return false;
+  if (abs(piece) == CHESS_KING && fromIdx == (color > 0 ? 60 : 4) && abs(toInx - fromIdx) == 2) {
+    // Castling: the king moves two squares towards a rook that has not moved.
+    bool kingSide = toInx > fromIdx;
+    uint8_t right = color > 0 ? (kingSide ? CASTLE_WHITE_KING : CASTLE_WHITE_QUEEN)
+                              : (kingSide ? CASTLE_BLACK_KING : CASTLE_BLACK_QUEEN);
+    int rook = kingSide ? fromIdx + 3 : fromIdx - 4;
+    return (chessPosition.castlingRights() & right) && chessPosition.pieceAt(rook) == CHESS_ROOK * color &&
+           !(betweenSquares(fromIdx, rook) & chessPosition.occupied());
+  }
+  return (chessPosition.attacksFrom(fromIdx) & squareBit(toInx)) != 0;
 }
 
 
@@ -1451,8 +1658,8 @@ void drawChessUI(){
     tft.print("Black");
   }
 
-  //print check if needed
-  if(isInCheck(1) || isInCheck(-1)){
+  //print check if needed (only the side to move can be in check)
+  if(isInCheck(chessPosition.sideToMove())){
     tft.setTextSize(1);
     tft.setCursor(leftJustified, chessUIStartingY + 18);
     tft.print("Check!");
@@ -1464,29 +1671,17 @@ void drawChessUI(){
 void drawChessMenu(int previousSelection, int selection, int menuType){
   //Menu type is 0 for connection menu and 1 for color menu
   tft.fillScreen(BLACK);
-  tft.setTextColor(WHITE);
-  tft.setTextSize(3);
-  tft.setCursor(50,20);
-  tft.print("CHESS");
+  drawLabel(50, 20, "CHESS", 3, WHITE, BLACK);
 
-  tft.setTextSize(2);
   if(menuType == 0){
     for (int i = 0; i < numConnMenu; i++) {
-      int yPos = 80 + i * 40;
-
       // Draw Text
-      tft.setCursor(50, 80 + i * 40);
-      tft.setTextColor(WHITE);
-      tft.print(connMenu[i]);
+      drawLabel(50, 80 + i * 40, connMenu[i], 2, WHITE, BLACK);
     }
   }else{
     for (int i = 0; i < numChessMenu; i++) {
-      int yPos = 80 + i * 40;
-
       // Draw Text
-      tft.setCursor(50, 80 + i * 40);
-      tft.setTextColor(WHITE);
-      tft.print(chessMenu[i]);
+      drawLabel(50, 80 + i * 40, chessMenu[i], 2, WHITE, BLACK);
     }
   }
 }
@@ -1508,13 +1703,10 @@ void drawChessMenuCursor(int prevSelection, int newSelection, int menuType) {
     tft.fillRect(xPos, prevYPos, width, height, BLACK);
     
     // Redraw Text (WHITE)
-    tft.setCursor(50, prevYPos);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
     if(menuType == 0){
-      tft.print(connMenu[prevSelection]);
+      drawLabel(50, prevYPos, connMenu[prevSelection], 2, WHITE, BLACK);
     }else{
-      tft.print(chessMenu[prevSelection]);
+      drawLabel(50, prevYPos, chessMenu[prevSelection], 2, WHITE, BLACK);
     }
     
     
@@ -1527,13 +1719,10 @@ void drawChessMenuCursor(int prevSelection, int newSelection, int menuType) {
   tft.fillRect(xPos, newYPos, width, height, CURSOR_COLOR);
   
   // Redraw Text (BLACK on the colored cursor)
-  tft.setCursor(50, newYPos);
-  tft.setTextColor(BLACK); 
-  tft.setTextSize(2);
   if(menuType == 0){
-    tft.print(connMenu[newSelection]);
+    drawLabel(50, newYPos, connMenu[newSelection], 2, BLACK, CURSOR_COLOR);
   }else{
-    tft.print(chessMenu[newSelection]);
+    drawLabel(50, newYPos, chessMenu[newSelection], 2, BLACK, CURSOR_COLOR);
   }
 }
 
@@ -1615,65 +1804,113 @@ chessPiece MY_BLACK_BISHOP = createBlackBishop();
 chessPiece MY_BLACK_KNIGHT = createBlackKnight();
 chessPiece MY_BLACK_PAWN = createBlackPawn();
 
+/**
+ * @brief Looks up the sprite for a piece code (1-6 white, -1 to -6 black).
+ * @return The sprite, or nullptr for an empty square.
+ */
+const Sprite *getChessPieceSprite(int pieceType) {
+  // Indexed by pieceType + 6.
+  static const Sprite *sprites[13] = {
+    MY_BLACK_KING.getSprite(), MY_BLACK_QUEEN.getSprite(), MY_BLACK_ROOK.getSprite(),
+    MY_BLACK_KNIGHT.getSprite(), MY_BLACK_BISHOP.getSprite(), MY_BLACK_PAWN.getSprite(),
+    nullptr,
+    MY_WHITE_PAWN.getSprite(), MY_WHITE_BISHOP.getSprite(), MY_WHITE_KNIGHT.getSprite(),
+    MY_WHITE_ROOK.getSprite(), MY_WHITE_QUEEN.getSprite(), MY_WHITE_KING.getSprite(),
+  };
+  if (pieceType < -6 || pieceType > 6) {
+    return nullptr;
+  }
+  return sprites[pieceType + 6];
+}
+
 void drawChessPiece(int posX, int posY, int squareSize, int color, int pieceType) {
 
   int offSet = 2;
-  int pieceSize = 26;
-  chessPiece pieceToDraw;
+  const Sprite *sprite = getChessPieceSprite(pieceType);
+  if (sprite != nullptr) {
+    drawSprite(posX + offSet, posY + offSet, sprite);
+  }
+}
 
-  if (pieceType > 0) {
-    switch (pieceType)
-    {
-    case 1:
-      pieceToDraw = MY_WHITE_PAWN;
-      break;
-    case 2:
-      pieceToDraw = MY_WHITE_BISHOP;
-      break;
-    case 3:
-      pieceToDraw = MY_WHITE_KNIGHT;
-      break;
-    case 4:
-      pieceToDraw = MY_WHITE_ROOK;
-      break;
-    case 5:
-      pieceToDraw = MY_WHITE_QUEEN;
-      break;
-    case 6:
-      pieceToDraw = MY_WHITE_KING;
-      break;
-    }
-  }else if(pieceType < 0){
-    pieceType = pieceType * -1;
-    switch (pieceType)
-    {
-    case 1:
-      pieceToDraw = MY_BLACK_PAWN;
-      break;
-    case 2:
-      pieceToDraw = MY_BLACK_BISHOP;
-      break;
-    case 3:
-      pieceToDraw = MY_BLACK_KNIGHT;
-      break;
-    case 4:
-      pieceToDraw = MY_BLACK_ROOK;
-      break;
-    case 5:
-      pieceToDraw = MY_BLACK_QUEEN;
-      break;
-    case 6:
-      pieceToDraw = MY_BLACK_KING;
-      break;
+// Pre-composited squares: each of the 12 pieces on a light and a dark square, plus the two
+// empty squares. Built once when a game starts so drawing a square is one opaque push with
+// no transparency test. Stays nullptr (and squares are drawn the slow way) if the
+// allocation fails.
+#define CHESS_TILE_COUNT 26
+uint16_t *chessTiles = nullptr;
+
+/**
+ * @brief Index of a square's tile in chessTiles.
+ * @param pieceType Piece code (0 for empty).
+ * @param lightSquare True for CHESS_BOARD_LIGHT_COLOR squares.
+ */
+int getChessTileIndex(int pieceType, bool lightSquare) {
+  // White 1-6 -> 0-5, black -1 to -6 -> 6-11, empty -> 12.
+  int piece = (pieceType > 0) ? pieceType - 1 : (pieceType < 0) ? 5 - pieceType : 12;
+  return piece * 2 + (lightSquare ? 0 : 1);
+}
+
+/**
+ * @brief Composites every chess tile into PSRAM (or RAM). Does nothing if already built.
+ */
+void buildChessTiles() {
+  if (chessTiles != nullptr) {
+    return;
+  }
+  int tilePixels = squareSize * squareSize;
+  chessTiles = (uint16_t *)ps_malloc((size_t)CHESS_TILE_COUNT * tilePixels * sizeof(uint16_t));
+  if (chessTiles == nullptr) {
+    return;
+  }
+  for (int pieceType = -6; pieceType <= 6; pieceType++) {
+    for (int light = 0; light < 2; light++) {
+      SpriteCanvas tile(&chessTiles[getChessTileIndex(pieceType, light) * tilePixels], squareSize, squareSize);
+      tile.fill(light ? CHESS_BOARD_LIGHT_COLOR : CHESS_BOARD_DARK_COLOR);
+      const Sprite *sprite = getChessPieceSprite(pieceType);
+      if (sprite != nullptr) {
+        blitSprite(tile, 2, 2, *sprite);
+      }
     }
   }
+}
 
-  drawSpriteWithTransparency(posX + offSet, posY + offSet, pieceToDraw.getSprite(), pieceSize, pieceSize, 0x0000);
-    
+/**
+ * @brief Draws a square with its piece, from the tile cache when it is available.
+ * @param x Left edge of the square on screen.
+ * @param y Top edge of the square on screen.
+ * @param pieceType Piece code (0 for empty).
+ * @param color Square color (CHESS_BOARD_LIGHT_COLOR or CHESS_BOARD_DARK_COLOR).
+ */
+void drawChessTile(int x, int y, int pieceType, uint16_t color) {
+  if (chessTiles == nullptr) {
+    tft.fillRect(x, y, squareSize, squareSize, color);
+    if (pieceType != 0) {
+      uint16_t pieceColor = (pieceType > 0) ? WHITE : BLACK;
+      drawChessPiece(x, y, squareSize, pieceColor, pieceType);
+    }
+    return;
+  }
+  int tilePixels = squareSize * squareSize;
+  tft.startWrite();
+  tft.setAddrWindow(x, y, squareSize, squareSize);
+  tft.writePixels(&chessTiles[getChessTileIndex(pieceType, color == CHESS_BOARD_LIGHT_COLOR) * tilePixels], tilePixels);
+  tft.endWrite();
 }
 
+// Pieces as last drawn on screen, so updateChessBoard() only repaints squares that changed.
+// CHESS_SQUARE_STALE marks a square that was drawn over and must be repainted.
+#define CHESS_SQUARE_STALE 127
+std::array<std::array<int, 8>, 8> drawnChessBoard;
+// Legal destinations of one square's piece, cached until the position or the square changes.
+Bitboard cachedDestinations = 0;
+int cachedDestinationSquare = -1;
+uint64_t cachedDestinationKey = 0;
+// Squares that currently carry a destination marker.
+Bitboard shownDestinations = 0;
+
 void drawChessBoard() {
   tft.fillScreen(BLACK);
+  shownDestinations = 0;
 
   chessSquareStartPosX = (tft.width() - (squareSize * 8)) / 2; 
   chessSquareStartPosY = (tft.height() - (squareSize * 8)) / 2;
@@ -1687,17 +1924,133 @@ void drawChessBoard() {
       int y = chessSquareStartPosY + (i * squareSize);
 
       uint16_t color = ((i + j) % 2 == 0) ? CHESS_BOARD_LIGHT_COLOR : CHESS_BOARD_DARK_COLOR;
-      
-      tft.fillRect(x, y, squareSize, squareSize, color);
 
-      // Draw the piece if it exists
-      int squareValue = chessBoard[i][j];
-      if (squareValue != 0) {
-        uint16_t pieceColor = (squareValue > 0) ? WHITE : BLACK;
-        drawChessPiece(x, y, squareSize, pieceColor, squareValue);
+      // Square and the piece on it, if any
+      drawChessTile(x, y, chessBoard[i][j], color);
+    }
+  }
+  drawnChessBoard = chessBoard;
+}
+
+/**
+ * @brief Repaints one square (background and piece) from chessBoard. Clears any cursor or
+ * selection outline on it.
+ * @param square Square index (0-63), numbered left to right and top to bottom.
+ */
+void drawChessSquare(int square) {
+  int row = square / 8;
+  int col = square % 8;
+  int x = getChessSquareLocationX(square);
+  int y = getChessSquareLocationY(square);
+
+  drawChessTile(x, y, chessBoard[row][col], getChessSquareColor(square));
+  drawnChessBoard[row][col] = chessBoard[row][col];
+}
+
+/**
+ * @brief Squares the piece on a square can legally move to, as a bitmask (bit n = square n).
+ * The moves are generated once per position and square; later calls are a lookup.
+ */
+Bitboard legalDestinations(int square){
+  if (square < 0 || chessPosition.pieceAt(square) == 0) {
+    return 0;
+  }
+  if (square != cachedDestinationSquare || chessPosition.key() != cachedDestinationKey) {
+    ChessMoveList moves;
+    generateLegalMoves(chessPosition, chessPosition.pieceAt(square) > 0 ? 1 : -1, moves);
+    cachedDestinations = 0;
+    for (ChessMove move : moves) {
+      if (moveFrom(move) == square) {
+        cachedDestinations |= squareBit(moveTo(move));
       }
     }
+    cachedDestinationSquare = square;
+    cachedDestinationKey = chessPosition.key();
   }
+  return cachedDestinations;
+}
+
+/**
+ * @brief Marks the given destination squares and removes the markers of all others.
+ * Empty squares get a dot in the middle and occupied ones (captures) a frame inside the
+ * border, so the cursor and selection outlines stay visible. All markers are drawn in one
+ * write transaction; squares that lose their marker are repainted from their tile.
+ */
+void showChessDestinations(Bitboard destinations){
+  Bitboard removed = shownDestinations & ~destinations;
+  while (removed) {
+    drawChessSquare(popLowestSquare(removed));
+  }
+  shownDestinations = destinations;
+
+  const int dot = squareSize / 5;
+  tft.startWrite();
+  while (destinations) {
+    int square = popLowestSquare(destinations);
+    int x = getChessSquareLocationX(square);
+    int y = getChessSquareLocationY(square);
+    if (chessPosition.pieceAt(square) == 0) {
+      tft.writeFillRect(x + (squareSize - dot) / 2, y + (squareSize - dot) / 2, dot, dot, CHESS_DESTINATION_COLOR);
+    } else {
+      for (int inset = 2; inset <= 3; inset++) {
+        int size = squareSize - 2 * inset;
+        tft.writeFastHLine(x + inset, y + inset, size, CHESS_DESTINATION_COLOR);
+        tft.writeFastHLine(x + inset, y + squareSize - 1 - inset, size, CHESS_DESTINATION_COLOR);
+        tft.writeFastVLine(x + inset, y + inset, size, CHESS_DESTINATION_COLOR);
+        tft.writeFastVLine(x + squareSize - 1 - inset, y + inset, size, CHESS_DESTINATION_COLOR);
+      }
+    }
+  }
+  tft.endWrite();
+}
+
+/**
+ * @brief Brings the board on screen up to date with chessBoard by repainting only the squares
+ * whose piece changed since the last draw (2 for a normal move). The side panel is redrawn
+ * when anything changed, since the turn has moved on. Cursor and selection outlines are left
+ * to drawChessCursor().
+ */
+void updateChessBoard() {
+  bool changed = false;
+  for (int square = 0; square < 64; square++) {
+    int row = square / 8;
+    int col = square % 8;
+    if (chessBoard[row][col] != drawnChessBoard[row][col]) {
+      drawChessSquare(square);
+      changed = true;
+    }
+  }
+  if (changed) {
+    drawChessUI();
+    if (shownDestinations) {
+      showChessDestinations(legalDestinations(selectedSourceSquare)); // the position moved on
+    }
+  }
+}
+
+/**
+ * @brief Marks every square overlapping a screen rectangle as needing a repaint, for text
+ * such as displayStatus() that is drawn on top of the board.
+ */
+void invalidateChessSquares(int x, int y, int w, int h) {
+  for (int square = 0; square < 64; square++) {
+    int squareX = getChessSquareLocationX(square);
+    int squareY = getChessSquareLocationY(square);
+    if (squareX < x + w && x < squareX + squareSize && squareY < y + h && y < squareY + squareSize) {
+      drawnChessBoard[square / 8][square % 8] = CHESS_SQUARE_STALE;
+    }
+  }
+}
+
+/**
+ * @brief Removes the cursor or selection outline from a square by drawing its border in the
+ * square's own color. Pieces never reach the border, so nothing else needs repainting.
+ */
+void eraseChessSquareOutline(int square) {
+  if (square < 0) {
+    return;
+  }
+  tft.drawRect(getChessSquareLocationX(square), getChessSquareLocationY(square), squareSize, squareSize, getChessSquareColor(square));
 }
 
 
@@ -1707,15 +2060,7 @@ void drawChessBoard() {
 * @return The location of the king in the chessBoard array (0-63), or -1 if not found.
 */
 int findKingLocation(int color) {
-  int targetKing = (color > 0) ? 6 : -6;
-  for (int i = 0; i < 8; i++) {
-    for (int j = 0; j < 8; j++) {
-      if (chessBoard[i][j] == targetKing) {
-        return i * 8 + j;
-      }
-    }
-  }
-  return -1;
+  return chessPosition.kingSquare(color);
 }
 
 /*
@@ -1725,95 +2070,36 @@ int findKingLocation(int color) {
 * @return True if the square is attacked, false otherwise.
 */
 bool isSquareAttacked(int targetIdx, int defenderColor){
-  int row = targetIdx / 8;
-  int col = targetIdx % 8;
-
-  for (int i = 0; i < 64; i++){
-    int r = i / 8;
-    int c = i % 8;
-    int piece = chessBoard[r][c];
-
-    if (piece == 0){
-      continue;
-    }
-    bool isFriendly = (defenderColor > 0 && piece > 0) || (defenderColor < 0 && piece < 0);
-    if (isFriendly){
-      continue;
-    }
-
-    if(isValidMove(i, targetIdx)){
-      return true;
-    }
-  }
-  return false;
+  return chessPosition.isAttacked(targetIdx, -defenderColor);
 }
 
 /*
 * @brief Checks if the king of the given color is in check.
+* Reads the opponent's attack map, which the position keeps until the next move, so the
+* check indicator, checkGameState() and the legal move list all share one computation.
 * @param color The color of the king to check (1 for white, -1 for black).
 * @return True if the king is in check, false otherwise.
 */
 bool isInCheck(int color){
-  int kingIdx = findKingLocation(color);
-  if(kingIdx == -1){
-    return false;
-  }
-  return isSquareAttacked(kingIdx, color);
-}
-
-bool isMoveSafe(int fromIdx, int toIdx){
-  int rSrc = fromIdx / 8;
-  int cSrc = fromIdx % 8;
-
-  int rDst = toIdx / 8;
-  int cDst = toIdx % 8;
-
-  int movingPiece = chessBoard[rSrc][cSrc];
-  int capturedPiece = chessBoard[rDst][cDst];
-
-  int turnColor = (movingPiece > 0) ? 1 : -1;
-  int inCheck = isInCheck(turnColor);
-
-  chessBoard[rSrc][cSrc] = movingPiece;
-  chessBoard[rDst][cDst] = capturedPiece;
-
-  return !inCheck;
+  int king = chessPosition.kingSquare(color);
+  return king >= 0 && (chessPosition.attackMap(-color) & squareBit(king)) != 0;
 }
 
+/*
+* @brief Checks whether the given side can still move.
+* @param color The side to check (1 for white, -1 for black).
+* @return 0 if the game goes on, 1 for checkmate, 2 for stalemate, 3 for a draw by threefold repetition,
+* 4 for an ending neither side can win (isDrawnEnding(), which reads the KPK/KRK bitbases).
+*/
 int checkGameState(int color){
-  bool hasLegalMoves = false;
-
-  for(int src = 0; src < 64; src++){
-    int r = src / 8;
-    int c = src % 8;
-    int piece = chessBoard[r][c];
-
-    if (piece == 0){
-      continue;
-    }
-    if ((color == 1 && piece < 0) || (color == -1 && piece > 0)){
-      continue;
-    }
-
-    for(int dst = 0; dst < 64; dst++){
-      if (src == dst){
-        continue;
-      }
-
-      if(isValidMove(src, dst)){
-        if(isMoveSafe(src, dst)){
-          hasLegalMoves = true;
-          break;
-        }
-      }
-    }
-    if(hasLegalMoves){
-      break;
-    }
+  if (chessPosition.repetitions() >= 2) {
+    return 3; // Same position for the third time
   }
-  if (hasLegalMoves)
+  ChessMoveList moves;
+  generateLegalMoves(chessPosition, color, moves);
+  if (moves.count > 0)
   {
-    return 0;
+    return isDrawnEnding(chessPosition) ? 4 : 0;
   }
 
   if(isInCheck(color)){
@@ -1871,6 +2157,230 @@ bool receiveChessMove(int &outFrom, int &outTo){
 }
 
 
+// Single Player engine. Moves are limited by node count, so the device and a host
+// build play exactly the same game; 60000 nodes take a second or two on the S3.
+// The time limit is only a safety net in case a search runs slower than that.
+#define CHESS_ENGINE_NODES 60000
+#define CHESS_ENGINE_MAX_MILLIS 8000
+// Transposition table in PSRAM: 131072 two-entry buckets, far more than one
+// search fills, so deep results from earlier moves are still there next turn.
+#define CHESS_TT_BYTES (3u << 20)
+
+ChessSearch chessEngine;
+TranspositionTable chessTable;
+// Runs chessEngine on core 0 so the UI loop on core 1 keeps drawing and reading buttons.
+SearchWorker chessWorker;
+// Opening moves come from the book in flash (tools/book_gen.cpp) without any search.
+OpeningBook chessBook(openingBookData, sizeof(openingBookData));
+// Set for a new game; the next search request asks the worker to clear the table.
+bool chessTableStale = true;
+// While the player thinks, the worker searches the position after the reply the engine
+// expects (pondering). chessPonderKey is that position's Zobrist key.
+bool chessPondering = false;
+uint64_t chessPonderKey = 0;
+// Scratch for startPondering(); a position and a move list are too big for the loop stack.
+ChessPosition chessPonderPosition;
+ChessMoveList chessPonderMoves;
+
+/**
+ * @brief Gives the engine an empty transposition table for a new game.
+ * The table is allocated in PSRAM and the search worker started on first use; without the
+ * table the engine searches without one.
+ */
+void resetChessEngine(){
+  static bool tableAllocated = false;
+  if (!tableAllocated) {
+    tableAllocated = true; // the worker may own the engine from here on, so attach only once
+    chessTable.attach(ps_malloc(CHESS_TT_BYTES), CHESS_TT_BYTES);
+    chessEngine.setTable(chessTable.enabled() ? &chessTable : nullptr);
+  }
+  chessWorker.begin(&chessEngine);
+  chessWorker.cancel();
+  chessTableStale = true;
+}
+
+uint32_t chessEngineClock(){
+  return millis();
+}
+
+/**
+ * @brief Stops the engine's search, if any, and drops its result. Used by Home and reset.
+ */
+void cancelChessSearch(){
+  chessWorker.cancel();
+  chessPondering = false;
+}
+
+/**
+ * @brief Limits of the engine's own search. Without timeLimit the node budget alone ends it.
+ */
+ChessSearchLimits chessEngineLimits(bool timeLimit){
+  ChessSearchLimits limits;
+  limits.maxNodes = CHESS_ENGINE_NODES;
+  if (timeLimit) {
+    limits.maxMillis = CHESS_ENGINE_MAX_MILLIS;
+    limits.clock = chessEngineClock;
+  }
+  return limits;
+}
+
+/**
+ * @brief Starts pondering on the player's time: searches the position after the expected
+ * reply with the engine's own limits. If the player makes that move, the search already
+ * running (or finished) is the one the engine would have started, so it answers as soon as
+ * it is done. Otherwise it is cancelled, and the next search still finds its work in the
+ * transposition table. The ponder search has no time limit, since the clock would be
+ * running on the player's time; the node budget still bounds it.
+ *
+ * Only Single Player ponders. In wired and wireless games both sides are people: while
+ * receiveChessMove() waits for the remote move there is no engine move to prepare, so a
+ * search would only cost power and heat on core 0.
+ */
+void startPondering(ChessMove reply){
+  ChessMove found;
+  generateLegalMoves(chessPosition, chessPosition.sideToMove(), chessPonderMoves);
+  if (reply == 0 || !findChessMove(chessPonderMoves, moveFrom(reply), moveTo(reply), found) || found != reply) {
+    return; // also skips under-promotions, which the player's controls never make
+  }
+  chessPonderPosition = chessPosition;
+  chessPonderPosition.makeMove(reply);
+  if (chessWorker.start(chessPonderPosition, chessEngineLimits(false)) != 0) {
+    chessPondering = true;
+    chessPonderKey = chessPonderPosition.key();
+  }
+}
+
+/**
+ * @brief Whether the built-in engine is to move: Single Player mode, on the color the player did not pick.
+ */
+bool isEngineTurn(){
+  if (connectionMode != 2 || (chessPhase != WHITE_TURN && chessPhase != BLACK_TURN)) {
+    return false;
+  }
+  bool whiteToMove = (turnNumber % 2 == 0);
+  return whiteToMove != playingAsWhite;
+}
+
+/**
+ * @brief Shows the engine's progress (depth completed and best move so far) in the side panel.
+ */
+void drawChessSearchProgress(const SearchProgress &progress){
+  int x = chessUIStartingX + 2;
+  int y = chessUIStartingY + 30;
+  tft.fillRect(chessUIStartingX, y, chessUIWidth, 18, WHITE);
+  if (progress.depth == 0) {
+    return;
+  }
+  char line[8];
+  tft.setTextSize(1);
+  tft.setTextColor(BLACK);
+  snprintf(line, sizeof(line), "D%d", progress.depth);
+  tft.setCursor(x, y);
+  tft.print(line);
+  int from = moveFrom(progress.move);
+  int to = moveTo(progress.move);
+  snprintf(line, sizeof(line), "%c%c%c%c", 'a' + from % 8, '8' - from / 8, 'a' + to % 8, '8' - to / 8);
+  tft.setCursor(x, y + 8);
+  tft.print(line);
+}
+
+/**
+ * @brief Plays the move the engine chose, then checks whether the player can still move.
+ */
+void playEngineMove(const ChessSearchResult &result){
+  if (result.move == 0) {
+    return; // No legal move: the game was already decided by the player's last move
+  }
+
+  playChessMove(result.move);
+  turnNumber++;
+  updateChessBoard();
+  drawChessCursor(chessBoardCursorLocation, -1);
+
+  int playerColor = playingAsWhite ? 1 : -1;
+  int status = checkGameState(playerColor);
+  if (status == 1) {
+    displayStatus("CHECKMATE!", RED);
+    chessPhase = GAME_OVER;
+  } else if (status == 2) {
+    displayStatus("STALEMATE!", YELLOW);
+    chessPhase = GAME_OVER;
+  } else if (status == 3) {
+    displayStatus("DRAW: REPETITION", YELLOW);
+    chessPhase = GAME_OVER;
+  } else if (status == 4) {
+    displayStatus("DRAWN ENDING", YELLOW);
+    chessPhase = GAME_OVER;
+  } else {
+    chessPhase = playingAsWhite ? WHITE_TURN : BLACK_TURN;
+    startPondering(result.ponder);
+  }
+}
+
+/**
+ * @brief Drives the engine's turn without blocking: the first call plays a book move if the
+ * position is in the opening book, and otherwise hands the position to the search worker;
+ * later calls show its progress and play the move once the result arrives. A ponder search of
+ * the position actually reached (a ponder hit) is kept and becomes the engine's search. If the
+ * worker could not be started the search runs here instead.
+ */
+void updateEngineTurn(){
+  static uint32_t shownId = 0;
+  static int shownDepth = -1;
+  static ChessMove shownMove = 0;
+
+  if (chessPondering || !chessWorker.pending()) {
+    ChessSearchResult book;
+    book.move = chessBook.probe(chessPosition, (uint32_t)random(0x7FFFFFFF));
+    if (book.move != 0) {
+      cancelChessSearch();
+      playEngineMove(book);
+      return;
+    }
+  }
+
+  if (chessPondering) {
+    chessPondering = false;
+    if (chessPosition.key() == chessPonderKey && chessWorker.pending()) {
+      displayStatus("Thinking...", YELLOW);
+      invalidateChessSquares(10, 220, tft.width() - 20, 30);
+    } else {
+      chessWorker.cancel();
+    }
+  }
+
+  if (!chessWorker.pending()) {
+    displayStatus("Thinking...", YELLOW);
+    invalidateChessSquares(10, 220, tft.width() - 20, 30);
+    ChessSearchLimits limits = chessEngineLimits(true);
+    if (chessWorker.start(chessPosition, limits, chessTableStale) == 0) {
+      if (chessTableStale) {
+        chessTable.clear();
+      }
+      chessTableStale = false;
+      presentFrame();
+      playEngineMove(chessEngine.search(chessPosition, limits));
+      return;
+    }
+    chessTableStale = false;
+    return;
+  }
+
+  ChessSearchResult result;
+  if (chessWorker.poll(result)) {
+    playEngineMove(result);
+    return;
+  }
+
+  SearchProgress progress = chessWorker.progress();
+  if (progress.id != shownId || progress.depth != shownDepth || progress.move != shownMove) {
+    shownId = progress.id;
+    shownDepth = progress.depth;
+    shownMove = progress.move;
+    drawChessSearchProgress(progress);
+  }
+}
+
 void handleChessInputs(){
   int rxFrom, rxTo;
 
@@ -1905,6 +2415,7 @@ void handleChessInputs(){
 
   if(Serial.available() > 0){
     displayStatus("Serial Available!", YELLOW);
+    invalidateChessSquares(10, 220, tft.width() - 20, 30);
   }
   
 
@@ -1923,6 +2434,11 @@ void handleChessInputs(){
     }
   }
 
+  if (isEngineTurn()) {
+    updateEngineTurn();
+    return;
+  }
+
   //if ((chessPhase == WHITE_TURN && playingAsWhite) || (chessPhase == BLACK_TURN && !playingAsWhite)) {
   if (chessPhase == WHITE_TURN || chessPhase == BLACK_TURN) { //place holder while we fix serial issue
     
@@ -1972,6 +2488,7 @@ void handleChessInputs(){
         if(isOwnPiece){
           selectedSourceSquare = chessBoardCursorLocation;
           drawChessCursor(chessBoardCursorLocation, chessBoardCursorLocation);
+          showChessDestinations(legalDestinations(selectedSourceSquare));
         }
       }
 
@@ -1979,86 +2496,78 @@ void handleChessInputs(){
       else {
         // If clicked the same piece deselect it
         if (chessBoardCursorLocation == selectedSourceSquare) {
+          showChessDestinations(0);
+          eraseChessSquareOutline(selectedSourceSquare);
           selectedSourceSquare = -1;
-          drawChessBoard();
           drawChessCursor(chessBoardCursorLocation, -1);
         }
         // If clicking a different square, try to move
         else {
-          // 1. Check GEOMETRY (L-shape, Diagonal, etc)
-          if (isValidMove(selectedSourceSquare, chessBoardCursorLocation)) {
-             
-             // 2. Check SAFETY (Does this put/leave me in check?)
-             if (isMoveSafe(selectedSourceSquare, chessBoardCursorLocation)) {
-                
-                // EXECUTE MOVE
-                int rSrc = selectedSourceSquare / 8;
-                int cSrc = selectedSourceSquare % 8;
-                int rDst = chessBoardCursorLocation / 8;
-                int cDst = chessBoardCursorLocation % 8;
-
-                chessBoard[rDst][cDst] = chessBoard[rSrc][cSrc];
-                chessBoard[rSrc][cSrc] = 0;
-
-                // --- PAWN PROMOTION (Auto-Queen for simplicity) ---
-                // If a pawn reaches the last rank, turn it into a Queen (5 or -5)
-                int movedPiece = chessBoard[rDst][cDst];
-                if (abs(movedPiece) == 1) {
-                    if ((movedPiece > 0 && rDst == 0) || (movedPiece < 0 && rDst == 7)) {
-                        chessBoard[rDst][cDst] = (movedPiece > 0) ? 5 : -5;
-                    }
-                }
-                if(connectionMode != 2){
-                  sendChessMove(selectedSourceSquare, chessBoardCursorLocation);
-                }
-                //sendRemoteMove(selectedSourceSquare, chessBoardCursorLocation, true);
-                //Serial.println("Move sent.");
-                // End Turn
-                
-                turnNumber++;
-                if(turnNumber % 2 == 0){
-                  isWhiteTurn = true;
-                  selectedSourceSquare = chessCursorStartLocationWhite;
-                }else{
-                  isWhiteTurn = false;
-                  selectedSourceSquare = chessCursorStartLocationBlack;
-                }
+          // Legal destinations were worked out once when the piece was selected
+          if (legalDestinations(selectedSourceSquare) & squareBit(chessBoardCursorLocation)) {
+            showChessDestinations(0);
+
+            // EXECUTE MOVE (castling, en passant, and queen promotion on the last rank)
+            playChessMove(selectedSourceSquare, chessBoardCursorLocation);
+            if(connectionMode != 2){
+              sendChessMove(selectedSourceSquare, chessBoardCursorLocation);
+            }
+            //sendRemoteMove(selectedSourceSquare, chessBoardCursorLocation, true);
+            //Serial.println("Move sent.");
+            // End Turn
+            
+            turnNumber++;
+            if(turnNumber % 2 == 0){
+              isWhiteTurn = true;
+              selectedSourceSquare = chessCursorStartLocationWhite;
+            }else{
+              isWhiteTurn = false;
+              selectedSourceSquare = chessCursorStartLocationBlack;
+            }
+            
+            updateChessBoard(); // Repaint the squares the move changed
+
+            // --- CHECK GAME OVER STATUS ---
+            // We just moved. Check the status of the OPPONENT.
+            int opponentColor = (isWhiteTurn) ? -1 : 1;
+            int status = checkGameState(opponentColor);
+
+            if (status == 1) {
+                // Checkmate
+                displayStatus("CHECKMATE!", RED);
+                chessPhase = GAME_OVER;
+            } else if (status == 2) {
+                // Stalemate
+                displayStatus("STALEMATE!", YELLOW);
+                chessPhase = GAME_OVER;
+            } else if (status == 3) {
+                // Threefold repetition
+                displayStatus("DRAW: REPETITION", YELLOW);
+                chessPhase = GAME_OVER;
+            } else if (status == 4) {
+                // Bare kings, a lone minor piece, or a drawn KPK/KRK ending
+                displayStatus("DRAWN ENDING", YELLOW);
+                chessPhase = GAME_OVER;
+            } else {
+                // Game Continues
+                chessPhase = (isWhiteTurn) ? BLACK_TURN : WHITE_TURN;
                 
-                drawChessBoard(); // Redraw immediately to show the move
-
-                // --- CHECK GAME OVER STATUS ---
-                // We just moved. Check the status of the OPPONENT.
-                int opponentColor = (isWhiteTurn) ? -1 : 1;
-                int status = checkGameState(opponentColor);
-
-                if (status == 1) {
-                    // Checkmate
-                    displayStatus("CHECKMATE!", RED);
-                    chessPhase = GAME_OVER;
-                } else if (status == 2) {
-                    // Stalemate
-                    displayStatus("STALEMATE!", YELLOW);
-                    chessPhase = GAME_OVER;
+                // Optional: Visual feedback if opponent is in Check
+                if (isInCheck(opponentColor)) {
+                    //displayStatus("CHECK!", RED);
                 } else {
-                    // Game Continues
-                    chessPhase = (isWhiteTurn) ? BLACK_TURN : WHITE_TURN;
-                    
-                    // Optional: Visual feedback if opponent is in Check
-                    if (isInCheck(opponentColor)) {
-                        //displayStatus("CHECK!", RED);
-                    } else {
-                        // Clear status bar or show turn
-                        // if (opponentColor == 1) displayStatus("White's Turn", WHITE);
-                        // else displayStatus("Black's Turn", WHITE);
-                    }
+                    // Clear status bar or show turn
+                    // if (opponentColor == 1) displayStatus("White's Turn", WHITE);
+                    // else displayStatus("Black's Turn", WHITE);
                 }
-                
-                drawChessCursor(chessBoardCursorLocation, -1);
-             } 
-             else {
-                 // Move was geometrically valid, but illegal (King in check)
-                 displayStatus("Invalid: King in Check", RED);
-             }
+            }
+            
+            drawChessCursor(chessBoardCursorLocation, -1);
+          }
+          else if (isValidMove(selectedSourceSquare, chessBoardCursorLocation)) {
+            // Move was geometrically valid, but illegal (King in check)
+            displayStatus("Invalid: King in Check", RED);
+            invalidateChessSquares(10, 220, tft.width() - 20, 30);
           }
           else {
             // Invalid Geometry (e.g. Knight moving straight)
@@ -2070,9 +2579,10 @@ void handleChessInputs(){
             if (!isWhiteTurn && clickedPiece < 0) isOwnPiece = true;
 
             if (isOwnPiece) {
+              eraseChessSquareOutline(selectedSourceSquare);
               selectedSourceSquare = chessBoardCursorLocation;
-              drawChessBoard();
               drawChessCursor(chessBoardCursorLocation, chessBoardCursorLocation);
+              showChessDestinations(legalDestinations(selectedSourceSquare));
             }
           }
         }
@@ -2081,26 +2591,27 @@ void handleChessInputs(){
 
   }
   else if ((chessPhase == WHITE_TURN || chessPhase == BLACK_TURN) && receiveChessMove(rxFrom, rxTo)){
-    int rSrc = rxFrom / 8; int cSrc = rxFrom % 8;
-    int rDst = rxTo / 8;   int cDst = rxTo % 8;
-
-    chessBoard[rDst][cDst] = chessBoard[rSrc][cSrc];
-    chessBoard[rSrc][cSrc] = 0;
-    
-    // Handle Promotion
-    if (abs(chessBoard[rDst][cDst]) == 1) {
-        if (rDst == 0 || rDst == 7) chessBoard[rDst][cDst] *= 5; 
-    }
+    // Apply the move (castling, en passant, and auto-queen promotion)
+    playChessMove(rxFrom, rxTo);
       turnNumber++;
 
-      drawChessBoard();
+      updateChessBoard();
+      drawChessCursor(chessBoardCursorLocation, -1);
 
       int myColor = (playingAsWhite) ? 1 : -1;
       int gameState = checkGameState(myColor);
 
       if(gameState == 1){
+        displayStatus("CHECKMATE!", RED);
         chessPhase = GAME_OVER;
       }else if(gameState == 2){
+        displayStatus("STALEMATE!", YELLOW);
+        chessPhase = GAME_OVER;
+      }else if(gameState == 3){
+        displayStatus("DRAW: REPETITION", YELLOW);
+        chessPhase = GAME_OVER;
+      }else if(gameState == 4){
+        displayStatus("DRAWN ENDING", YELLOW);
         chessPhase = GAME_OVER;
       }else if(isInCheck(myColor)){
         //displayStatus("Check!", YELLOW);
@@ -2132,6 +2643,7 @@ void handleChessInputs(){
         tft.fillScreen(BLACK);              // Clear for next menu
         drawChessMenu(previousChessMenuSelection, chessMenuSelection, 1);
         drawChessMenuCursor(previousChessMenuSelection, 0, 1);
+        presentFrame();
         delay(300);
     }
   }
@@ -2170,6 +2682,7 @@ void handleChessInputs(){
         playingAsWhite = false;
         chessPhase = START_GAME;
       }
+      presentFrame();
       delay(300); // Debounce select press
     }
     
@@ -2177,6 +2690,11 @@ void handleChessInputs(){
     // start the game and reset the move array
     chessPhase = WHITE_TURN;
     chessBoardCursorLocation = 0;
+    syncChessPosition();
+    if (connectionMode == 2) {
+      resetChessEngine();
+    }
+    buildChessTiles();
     drawChessBoard();
     drawChessCursor(chessBoardCursorLocation, -1);
     chessBoardPreviousCursorLocation = chessBoardCursorLocation;
@@ -2218,6 +2736,7 @@ void handleChessInputs(){
 }
 
 void resetChess(){
+  cancelChessSearch();
   gameOverScreenDrawn = false;
   turnNumber = 0;
   tft.fillScreen(BLACK);
@@ -2360,7 +2879,18 @@ void setup() {
   drawMenu();
   drawMenuCursor(-1, 0); // Draw cursor on the first item
   //chessSelected();
+  presentFrame();
   Serial.println("Starting up...");
+#ifdef USE_NNUE_EVAL
+  // Built with NNUE_PIE_KERNELS, the vector kernels must give the scalar results
+  // bit for bit; any difference switches the evaluator to the scalar kernels for good.
+  if (!nnue::networkMatches()) {
+    Serial.println("NNUE: network blob does not match nnue.h");
+  }
+  int nnueMismatches = nnue::checkKernels();
+  Serial.print(nnue::simdEnabled ? "NNUE: vector kernels, mismatches " : "NNUE: scalar kernels, mismatches ");
+  Serial.println(nnueMismatches);
+#endif
 }
 
 void loop() {
@@ -2385,5 +2915,6 @@ void loop() {
       handleSettingsInput();
       break;
   }
+  presentFrame();
   //delay(10);
 }
\ No newline at end of file
@@ -0,0 +1,283 @@
+#ifndef NNUE_H
+#define NNUE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+// The accumulator and output kernels are portable scalar code. Versions for the
+// ESP32-S3's 128-bit PIE vector unit are opt-in with -DNNUE_PIE_KERNELS (on top of
+// USE_NNUE_EVAL) and have not been assembled or run on a device yet. Before they
+// become the default, an S3 build with the flag has to assemble, checkKernels() has
+// to report 0 mismatches at boot, and perft --keys and engine_bench results have
+// to match a scalar build. Both give the same integers in principle: no value in
+// the network can overflow an int16 lane, so the saturating vector adds never
+// saturate.
+#if defined(NNUE_PIE_KERNELS) && defined(CONFIG_IDF_TARGET_ESP32S3)
+#define NNUE_SIMD 1
+#endif
+
+// Network shape. Each side ("perspective") has its own accumulator of NNUE_HIDDEN
+// int16 values: a bias plus one int8 weight row per active input feature. Features
+// are HalfKP-style, relative to that side's own king:
+//   (king bucket, piece kind, square)
+// with the board turned so the perspective plays up the board, and mirrored left to
+// right so its king stands on files e-h. Piece kinds are its own pawn, bishop,
+// knight, rook and queen, then the same for the opponent plus the opponent's king
+// (its own king is the bucket). The output clamps both accumulators to 0..127, takes
+// the dot product with int8 output weights (side to move's accumulator first), adds
+// the bias and shifts right by NNUE_OUTPUT_SHIFT to get centipawns.
+#define NNUE_HIDDEN 32
+#define NNUE_KING_BUCKETS 4
+#define NNUE_PIECE_KINDS 11
+#define NNUE_FEATURES (NNUE_KING_BUCKETS * NNUE_PIECE_KINDS * 64)
+#define NNUE_ACTIVATION_MAX 127
+#define NNUE_OUTPUT_SHIFT 6
+
+// Network blob, little-endian, every section starting on a 16-byte boundary:
+//   header   16 bytes: "NNUE", version, hidden size, king buckets, piece kinds,
+//                      output shift, 3 zero bytes, output bias (int32)
+//   biases   int16[NNUE_HIDDEN]
+//   weights  int8[NNUE_FEATURES][NNUE_HIDDEN], one row per feature
+//   output   int8[2 * NNUE_HIDDEN]
+#define NNUE_VERSION 1
+#define NNUE_HEADER_BYTES 16
+#define NNUE_BIAS_OFFSET NNUE_HEADER_BYTES
+#define NNUE_WEIGHT_OFFSET (NNUE_BIAS_OFFSET + NNUE_HIDDEN * 2)
+#define NNUE_OUTPUT_OFFSET (NNUE_WEIGHT_OFFSET + NNUE_FEATURES * NNUE_HIDDEN)
+#define NNUE_NETWORK_BYTES (NNUE_OUTPUT_OFFSET + 2 * NNUE_HIDDEN)
+
+#include "nnueData.h"
+
+/**
+ * @brief The two accumulators of a position, indexed by sideIndex() of the
+ * perspective. A stale side is rebuilt from the board before its next use.
+ */
+struct NnueAccumulator {
+    alignas(16) int16_t values[2][NNUE_HIDDEN];
+    bool stale[2];
+};
+
+namespace nnue {
+
+// Whether the vector kernels are in use. Cleared by checkKernels() if they ever
+// disagree with the scalar ones.
+#ifdef NNUE_SIMD
+inline bool simdEnabled = true;
+#else
+inline bool simdEnabled = false;
+#endif
+
+// King bucket of each square for a king on files e-h of the turned board (a8 = 0):
+// corner, other back-rank squares, second rank, anywhere further up.
+constexpr uint8_t kingBucket(int square) {
+    return square >= 56 ? (square % 8 >= 6 ? 0 : 1) : square >= 48 ? 2 : 3;
+}
+
+/**
+ * @brief Input feature of a piece as seen from one side.
+ * @param perspective 1 for white's accumulator, -1 for black's.
+ * @param king Square of the perspective's own king.
+ * @param piece Piece code (not that side's own king).
+ * @param square Square of the piece.
+ */
+inline int featureIndex(int perspective, int king, int piece, int square) {
+    int flip = perspective > 0 ? 0 : 56;
+    if (((king ^ flip) & 7) < 4) {
+        flip ^= 7;
+    }
+    const int type = piece > 0 ? piece : -piece;
+    const int kind = (piece > 0) == (perspective > 0) ? type - 1 : 4 + type;
+    return (kingBucket(king ^ flip) * NNUE_PIECE_KINDS + kind) * 64 + (square ^ flip);
+}
+
+inline const int16_t *biases() { return (const int16_t *)(nnueNetworkData + NNUE_BIAS_OFFSET); }
+
+inline const int8_t *featureRow(int feature) {
+    return (const int8_t *)(nnueNetworkData + NNUE_WEIGHT_OFFSET) + feature * NNUE_HIDDEN;
+}
+
+inline const int8_t *outputWeights() { return (const int8_t *)(nnueNetworkData + NNUE_OUTPUT_OFFSET); }
+
+inline int32_t outputBias() {
+    int32_t bias;
+    memcpy(&bias, nnueNetworkData + 12, sizeof(bias));
+    return bias;
+}
+
+/**
+ * @brief Whether the blob has the header this code was built for.
+ */
+inline bool networkMatches() {
+    const uint8_t *header = nnueNetworkData;
+    return memcmp(header, "NNUE", 4) == 0 && header[4] == NNUE_VERSION && header[5] == NNUE_HIDDEN &&
+           header[6] == NNUE_KING_BUCKETS && header[7] == NNUE_PIECE_KINDS && header[8] == NNUE_OUTPUT_SHIFT;
+}
+
+inline void addRowScalar(int16_t *accumulator, const int8_t *row) {
+    for (int i = 0; i < NNUE_HIDDEN; i++) {
+        accumulator[i] += row[i];
+    }
+}
+
+inline void subRowScalar(int16_t *accumulator, const int8_t *row) {
+    for (int i = 0; i < NNUE_HIDDEN; i++) {
+        accumulator[i] -= row[i];
+    }
+}
+
+inline int32_t outputSumScalar(const int16_t *us, const int16_t *them, const int8_t *weights) {
+    int32_t sum = 0;
+    for (int i = 0; i < NNUE_HIDDEN; i++) {
+        int a = us[i] < 0 ? 0 : us[i] > NNUE_ACTIVATION_MAX ? NNUE_ACTIVATION_MAX : us[i];
+        int b = them[i] < 0 ? 0 : them[i] > NNUE_ACTIVATION_MAX ? NNUE_ACTIVATION_MAX : them[i];
+        sum += a * weights[i] + b * weights[NNUE_HIDDEN + i];
+    }
+    return sum;
+}
+
+#ifdef NNUE_SIMD
+static_assert(NNUE_HIDDEN == 32, "the PIE kernels are unrolled for 32 hidden values");
+
+// Vector registers the kernels overwrite, declared so the compiler keeps nothing
+// of its own in them. A toolchain that does not know them by name rejects the
+// clobber list, so the kernels fail to build instead of corrupting state.
+#define NNUE_PIE_ROW_CLOBBERS "q0", "q1", "q4", "q5", "q7", "memory"
+#define NNUE_PIE_DOT_CLOBBERS "q0", "q1", "q2", "q6", "q7", "memory"
+
+// One 16-weight half of a row: the int8 weights are widened to int16 by zipping
+// them with their sign bytes (all ones where negative), then added to or
+// subtracted from sixteen accumulator values in place.
+#define NNUE_PIE_ROW_HALF(op)                                                                                       \
+    "ee.vld.128.ip q4, %[row], 16\n"                                                                                \
+    "ee.vcmp.lt.s8 q5, q4, q7\n"                                                                                    \
+    "ee.vzip.8 q4, q5\n"                                                                                            \
+    "ee.vld.128.ip q0, %[acc], 16\n"                                                                                \
+    "ee.vld.128.ip q1, %[acc], -16\n"                                                                               \
+    op " q0, q0, q4\n" op " q1, q1, q5\n"                                                                           \
+    "ee.vst.128.ip q0, %[acc], 16\n"                                                                                \
+    "ee.vst.128.ip q1, %[acc], 16\n"
+
+inline void addRowSimd(int16_t *accumulator, const int8_t *row) {
+    asm volatile("ee.zero.q q7\n" NNUE_PIE_ROW_HALF("ee.vadds.s16") NNUE_PIE_ROW_HALF("ee.vadds.s16")
+                 : [acc] "+r"(accumulator), [row] "+r"(row)
+                 :
+                 : NNUE_PIE_ROW_CLOBBERS);
+}
+
+inline void subRowSimd(int16_t *accumulator, const int8_t *row) {
+    asm volatile("ee.zero.q q7\n" NNUE_PIE_ROW_HALF("ee.vsubs.s16") NNUE_PIE_ROW_HALF("ee.vsubs.s16")
+                 : [acc] "+r"(accumulator), [row] "+r"(row)
+                 :
+                 : NNUE_PIE_ROW_CLOBBERS);
+}
+
+// Sixteen accumulator values clamped to 0..127 and narrowed to bytes (the low byte
+// of each lane), multiplied with sixteen output weights into ACCX.
+#define NNUE_PIE_DOT_16(values)                                                                                     \
+    "ee.vld.128.ip q0, %[" values "], 16\n"                                                                         \
+    "ee.vld.128.ip q1, %[" values "], 16\n"                                                                         \
+    "ee.vmax.s16 q0, q0, q6\n"                                                                                      \
+    "ee.vmax.s16 q1, q1, q6\n"                                                                                      \
+    "ee.vmin.s16 q0, q0, q7\n"                                                                                      \
+    "ee.vmin.s16 q1, q1, q7\n"                                                                                      \
+    "ee.vunzip.8 q0, q1\n"                                                                                          \
+    "ee.vld.128.ip q2, %[weights], 16\n"                                                                            \
+    "ee.vmulas.s8.accx q0, q2\n"
+
+inline int32_t outputSumSimd(const int16_t *us, const int16_t *them, const int8_t *weights) {
+    static const int16_t activationMax = NNUE_ACTIVATION_MAX;
+    int32_t sum;
+    asm volatile("ee.zero.accx\n"
+                 "ee.zero.q q6\n"
+                 "ee.vldbc.16 q7, %[max]\n" NNUE_PIE_DOT_16("us") NNUE_PIE_DOT_16("us") NNUE_PIE_DOT_16("them")
+                     NNUE_PIE_DOT_16("them") "rur.accx_0 %[sum]\n"
+                 : [sum] "=r"(sum), [us] "+r"(us), [them] "+r"(them), [weights] "+r"(weights)
+                 : [max] "r"(&activationMax)
+                 : NNUE_PIE_DOT_CLOBBERS);
+    return sum;
+}
+#endif
+
+inline void addRow(int16_t *accumulator, const int8_t *row) {
+#ifdef NNUE_SIMD
+    if (simdEnabled) {
+        addRowSimd(accumulator, row);
+        return;
+    }
+#endif
+    addRowScalar(accumulator, row);
+}
+
+inline void subRow(int16_t *accumulator, const int8_t *row) {
+#ifdef NNUE_SIMD
+    if (simdEnabled) {
+        subRowSimd(accumulator, row);
+        return;
+    }
+#endif
+    subRowScalar(accumulator, row);
+}
+
+/**
+ * @brief Network output in centipawns for the side whose accumulator is us.
+ */
+inline int evaluate(const int16_t *us, const int16_t *them) {
+    int32_t sum;
+#ifdef NNUE_SIMD
+    if (simdEnabled) {
+        sum = outputSumSimd(us, them, outputWeights());
+    } else
+#endif
+        sum = outputSumScalar(us, them, outputWeights());
+    return (sum + outputBias()) >> NNUE_OUTPUT_SHIFT;
+}
+
+/**
+ * @brief Compares the vector kernels with the scalar ones on every weight row and on
+ * a spread of accumulator values, and falls back to scalar for good on any mismatch.
+ * Meant to run once at startup. Without the vector kernels (NNUE_PIE_KERNELS on an
+ * ESP32-S3) there is nothing to compare.
+ * @return Number of mismatches found.
+ */
+inline int checkKernels() {
+    int mismatches = 0;
+#ifdef NNUE_SIMD
+    alignas(16) int16_t vector[2][NNUE_HIDDEN];
+    alignas(16) int16_t scalar[2][NNUE_HIDDEN];
+    uint32_t seed = 12345;
+    for (int i = 0; i < NNUE_HIDDEN; i++) {
+        seed = seed * 1664525 + 1013904223;
+        scalar[0][i] = vector[0][i] = (int16_t)((seed >> 16) % 600) - 300;
+        scalar[1][i] = vector[1][i] = (int16_t)((seed >> 8) % 600) - 300;
+    }
+    for (int feature = 0; feature < NNUE_FEATURES; feature++) {
+        // Add the row and take it away again, so the values stay in range.
+        const int8_t *row = featureRow(feature);
+        const int side = feature & 1;
+        addRowSimd(vector[side], row);
+        addRowScalar(scalar[side], row);
+        if ((feature & 63) == 0 &&
+            outputSumSimd(vector[0], vector[1], outputWeights()) != outputSumScalar(scalar[0], scalar[1], outputWeights())) {
+            mismatches++;
+        }
+        subRowSimd(vector[side], row);
+        subRowScalar(scalar[side], row);
+        if (memcmp(vector, scalar, sizeof(scalar)) != 0) {
+            mismatches++;
+            memcpy(vector, scalar, sizeof(scalar));
+        }
+    }
+    if (mismatches) {
+        simdEnabled = false;
+    }
+#endif
+    return mismatches;
+}
+
+} // namespace nnue
+
+#endif
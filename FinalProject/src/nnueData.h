@@ -0,0 +1,5652 @@
+#ifndef NNUEDATA_H
+#define NNUEDATA_H
+
+#include <stdint.h>
+
+// Generated by tools/nnue_gen.cpp from 1000000 positions (held-out mean error 7.4 cp);
+// layout in nnue.h. Do not edit.
+alignas(16) const uint8_t nnueNetworkData[90256] = {
+0x4E, 0x4E, 0x55, 0x45, 0x01, 0x20, 0x04, 0x0B, 0x06, 0x00, 0x00, 0x00, 0x87, 0xFE, 0xFF, 0xFF,
+0x44, 0x00, 0x43, 0x00, 0x39, 0x00, 0x42, 0x00, 0x38, 0x00, 0x42, 0x00, 0x3D, 0x00, 0x41, 0x00,
+0x3E, 0x00, 0x40, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x40, 0x00, 0x39, 0x00,
+0x40, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x40, 0x00, 0x39, 0x00, 0x3F, 0x00, 0x41, 0x00,
+0x3F, 0x00, 0x68, 0x00, 0x39, 0x00, 0x37, 0x00, 0x36, 0x00, 0x0B, 0x00, 0x41, 0x00, 0x1F, 0x00,
+0x01, 0x03, 0x05, 0xFF, 0xFD, 0xFE, 0x00, 0xFE, 0x00, 0xFA, 0xFD, 0x03, 0x04, 0x05, 0xFB, 0xFD,
+0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFD, 0xFD, 0xFA, 0x01, 0xFC, 0x02, 0x04, 0x01, 0xFB, 0xFC, 0x01,
+0x05, 0x03, 0x03, 0x05, 0xFC, 0x05, 0x06, 0xFF, 0xFC, 0xFB, 0x01, 0x04, 0x05, 0xFF, 0x05, 0xFA,
+0x06, 0xFB, 0xFC, 0xFD, 0x04, 0x03, 0xFC, 0x02, 0x05, 0x01, 0x04, 0xFD, 0xFB, 0x00, 0xFE, 0x05,
+0xFD, 0x02, 0x03, 0x03, 0x06, 0x02, 0xFA, 0xFD, 0x03, 0xFB, 0x04, 0xFF, 0x00, 0xFA, 0xFA, 0x06,
+0xFE, 0x04, 0xFC, 0xFC, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0xFE, 0xFB, 0x03, 0xFA, 0xFC, 0x06,
+0x04, 0xFE, 0x00, 0xFE, 0x01, 0x01, 0x05, 0xFE, 0x00, 0xFB, 0x03, 0xFA, 0xFB, 0x00, 0x05, 0xFA,
+0xFA, 0x05, 0x06, 0x02, 0xFD, 0xFB, 0xFD, 0xFB, 0xFA, 0x02, 0x00, 0x01, 0x05, 0xFE, 0x06, 0xFA,
+0x02, 0xFD, 0xFB, 0x00, 0x05, 0xFF, 0x05, 0xFF, 0x01, 0xFB, 0x02, 0xFF, 0x06, 0x00, 0xFD, 0x03,
+0x00, 0x01, 0xFD, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0xFA, 0xFE, 0x03, 0xFE, 0xFB,
+0xFE, 0x02, 0x00, 0xFD, 0xFB, 0x00, 0x02, 0x00, 0xFB, 0xFB, 0xFA, 0x02, 0x01, 0xFA, 0x05, 0x05,
+0xFE, 0xFC, 0x03, 0xFE, 0xFE, 0x05, 0x00, 0x01, 0x03, 0x06, 0x01, 0x02, 0x02, 0x02, 0x00, 0xFE,
+0xFC, 0xFC, 0xFF, 0x02, 0x06, 0x01, 0xFE, 0x06, 0x05, 0x02, 0xFD, 0x06, 0x02, 0xFF, 0x00, 0xFC,
+0x01, 0x04, 0x03, 0xFE, 0x03, 0xFF, 0x01, 0x06, 0x00, 0x06, 0xFB, 0x00, 0xFA, 0x01, 0x05, 0x01,
+0x01, 0x06, 0x06, 0xFD, 0x06, 0x01, 0xFE, 0xFC, 0x05, 0xFC, 0x00, 0xFE, 0x00, 0x05, 0x06, 0xFA,
+0x01, 0xFC, 0xFA, 0xFF, 0xFD, 0x03, 0x01, 0x05, 0xFA, 0x01, 0xFB, 0xFE, 0x01, 0x01, 0x03, 0x00,
+0xFF, 0xF9, 0x01, 0xFC, 0x01, 0xF8, 0xFF, 0x01, 0x02, 0xF2, 0x00, 0xFA, 0xF8, 0x01, 0x00, 0x05,
+0xF7, 0x02, 0xFC, 0x03, 0xF7, 0x00, 0xFF, 0xFA, 0xFE, 0x08, 0xFF, 0x00, 0x01, 0xFD, 0xFF, 0xFF,
+0xF8, 0xFC, 0x03, 0xF9, 0xFE, 0xFB, 0x00, 0xFA, 0x00, 0xFD, 0x00, 0xFC, 0xF7, 0x02, 0xFE, 0x01,
+0xFF, 0x06, 0xF8, 0x02, 0xFD, 0x04, 0xFB, 0xFB, 0xFE, 0x01, 0x00, 0x09, 0xFC, 0xF9, 0xFE, 0xFF,
+0xF7, 0x00, 0x05, 0xF8, 0x09, 0xF9, 0x00, 0xFD, 0xFD, 0x04, 0x01, 0xF7, 0x01, 0x04, 0x00, 0xFC,
+0xFF, 0x02, 0xF7, 0x02, 0x00, 0x02, 0x01, 0xFA, 0x08, 0xFB, 0x03, 0x08, 0x05, 0xFC, 0xFC, 0x09,
+0xF7, 0x00, 0x04, 0x01, 0x04, 0xFE, 0xFC, 0xF9, 0xFE, 0xF8, 0x05, 0xFF, 0xFE, 0xFE, 0xFE, 0x00,
+0xFA, 0x05, 0xF4, 0xFA, 0xFC, 0x03, 0xFD, 0xFB, 0x04, 0x03, 0x01, 0xFA, 0xFF, 0x01, 0x06, 0x04,
+0x00, 0xF4, 0x0A, 0xFE, 0xFF, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x00, 0xFC, 0xF7, 0xFD, 0xFF, 0x06,
+0x06, 0x00, 0xF7, 0x03, 0xFE, 0x03, 0xF7, 0xF8, 0x01, 0xFC, 0x02, 0xFF, 0xFA, 0xFE, 0xF5, 0x02,
+0xFD, 0xFE, 0xFE, 0x06, 0x01, 0xF6, 0xFC, 0xFC, 0x02, 0x02, 0x06, 0xFC, 0xF7, 0x04, 0x05, 0xFE,
+0xFC, 0xFD, 0xFF, 0xFB, 0x01, 0x00, 0xFF, 0x01, 0x07, 0x0B, 0xFD, 0x02, 0xF9, 0xF9, 0xF7, 0xFE,
+0xFE, 0xF3, 0xFF, 0xF7, 0xFE, 0x00, 0xFC, 0xFC, 0x01, 0xFA, 0x10, 0x06, 0x01, 0x01, 0x02, 0x01,
+0x07, 0x0A, 0x02, 0xFC, 0xF5, 0x0C, 0xFD, 0xFC, 0xF9, 0xFE, 0x02, 0xFF, 0x08, 0xF8, 0xF6, 0x08,
+0xFB, 0xFC, 0xFE, 0xFE, 0x08, 0x01, 0xFA, 0xFC, 0x06, 0xFA, 0x02, 0xFF, 0xF9, 0xFD, 0x06, 0x00,
+0xFA, 0x05, 0x00, 0xFE, 0xFD, 0x08, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x03, 0xFD, 0xFA, 0xF5, 0xFF,
+0xF9, 0xFE, 0x03, 0xFC, 0xFC, 0xFC, 0xFA, 0xFE, 0xFB, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x06, 0xFD,
+0xFD, 0xFF, 0x00, 0xFE, 0xFA, 0x08, 0x00, 0x03, 0x06, 0xFF, 0xFD, 0x05, 0xF0, 0xEB, 0xFC, 0x02,
+0xFF, 0x02, 0x05, 0xF8, 0x04, 0xFC, 0x07, 0x01, 0x08, 0xFE, 0x02, 0xFB, 0x01, 0x07, 0xFC, 0x01,
+0xF8, 0x04, 0x03, 0xFF, 0xFD, 0x04, 0xF3, 0x01, 0x01, 0x03, 0xFB, 0xFE, 0xFC, 0xFB, 0xFE, 0xFB,
+0x01, 0xFB, 0x02, 0x03, 0xFE, 0xFE, 0xF8, 0xFD, 0x0A, 0xFD, 0x00, 0xFB, 0xFE, 0x00, 0xFF, 0x02,
+0xFD, 0x00, 0x00, 0xFE, 0xFA, 0x05, 0x01, 0xFF, 0x00, 0x04, 0xFA, 0xFD, 0xF6, 0xF8, 0xFC, 0x00,
+0xFD, 0xFF, 0x07, 0xFF, 0x00, 0xFC, 0xFE, 0x02, 0x04, 0xFF, 0x02, 0x03, 0xFB, 0xFD, 0x06, 0x01,
+0x01, 0x08, 0xFD, 0xFA, 0x00, 0x02, 0xF7, 0xFD, 0xFD, 0xF9, 0x02, 0xFE, 0xF6, 0x00, 0xF8, 0x08,
+0xF9, 0xF9, 0xFC, 0x02, 0x02, 0xFF, 0xFE, 0x02, 0x06, 0xF7, 0x03, 0xFF, 0x02, 0x05, 0x03, 0x06,
+0x04, 0xFF, 0x02, 0x01, 0xFA, 0x05, 0x00, 0xFE, 0x04, 0x00, 0x05, 0xFF, 0x02, 0x0D, 0xFB, 0x08,
+0x02, 0xFD, 0x08, 0x02, 0x01, 0x04, 0x02, 0xFE, 0xF9, 0x01, 0x06, 0xFD, 0xFE, 0x03, 0x09, 0x01,
+0xFF, 0x06, 0x01, 0x01, 0xFA, 0x03, 0xF8, 0xF8, 0xFD, 0x05, 0x02, 0x03, 0xFE, 0xF1, 0x00, 0x01,
+0x03, 0x02, 0x05, 0xFA, 0xFE, 0x04, 0xFF, 0xFB, 0xFA, 0xFF, 0xFD, 0xFE, 0x01, 0x01, 0x04, 0x05,
+0x00, 0x00, 0xFC, 0xFC, 0xFF, 0x08, 0xFA, 0xFB, 0xFB, 0x04, 0x05, 0x01, 0xF2, 0xEC, 0x00, 0x0A,
+0x01, 0xFB, 0x03, 0xFF, 0x04, 0xFA, 0xFE, 0xFC, 0xFF, 0xFC, 0x01, 0xF9, 0xFF, 0xFF, 0x02, 0x00,
+0x03, 0x01, 0xFF, 0xFB, 0xFA, 0x04, 0xFC, 0xFE, 0x00, 0x00, 0x02, 0x00, 0xFB, 0xF6, 0x00, 0x02,
+0xFD, 0xFF, 0x07, 0x02, 0xFF, 0xF8, 0x01, 0x00, 0x04, 0x01, 0x03, 0xFC, 0xFE, 0xFE, 0x01, 0x05,
+0xF6, 0x05, 0x01, 0xFB, 0x02, 0xFF, 0xFB, 0x03, 0x04, 0x02, 0xFF, 0xFF, 0xFB, 0xEA, 0xFB, 0x01,
+0x04, 0xF4, 0x02, 0x01, 0x02, 0xFB, 0xFD, 0xFE, 0xF8, 0xFF, 0xFE, 0xFB, 0xF3, 0xFB, 0x03, 0x03,
+0xFE, 0x03, 0xF8, 0x02, 0xF5, 0x03, 0xF6, 0xFE, 0xFC, 0xFE, 0x00, 0xFD, 0xFB, 0xE2, 0xF8, 0x01,
+0x01, 0xFF, 0xFF, 0x03, 0x07, 0xF9, 0xFC, 0xFB, 0x04, 0xFF, 0xFF, 0xF9, 0x00, 0xFB, 0xFD, 0x05,
+0xF5, 0x06, 0xFD, 0x01, 0x01, 0x02, 0xFF, 0x02, 0x03, 0xFF, 0x07, 0x00, 0x01, 0xEE, 0xFA, 0x00,
+0xFC, 0x01, 0x02, 0xFC, 0x00, 0x02, 0xF9, 0xFA, 0xFA, 0x03, 0x02, 0x09, 0xF1, 0x01, 0x01, 0x03,
+0xFF, 0x05, 0x03, 0xFD, 0xFD, 0x03, 0xFA, 0xFB, 0x04, 0xFB, 0xFF, 0xFE, 0xF7, 0x11, 0xFF, 0x09,
+0x00, 0xFE, 0x05, 0xFC, 0x03, 0x02, 0xF6, 0xFC, 0x01, 0xFA, 0xFE, 0xFE, 0xFB, 0x02, 0x00, 0xFE,
+0x01, 0xFA, 0x03, 0xFC, 0xFE, 0x02, 0xF8, 0xF9, 0x03, 0x02, 0xFC, 0x00, 0x01, 0xF9, 0x02, 0x04,
+0xFC, 0xFB, 0xFD, 0xF6, 0x01, 0x00, 0x01, 0xFC, 0x01, 0x02, 0x06, 0xFE, 0xFE, 0xFD, 0x00, 0x08,
+0xF9, 0x0A, 0x00, 0xFF, 0x03, 0x04, 0xFD, 0xF8, 0x01, 0xFE, 0xFE, 0xFE, 0xF2, 0xEF, 0x04, 0xFA,
+0x01, 0xFD, 0x00, 0xFA, 0x00, 0x00, 0x03, 0xFE, 0x02, 0xFF, 0x05, 0xFC, 0xFC, 0x04, 0x05, 0xFC,
+0x04, 0x06, 0x00, 0xFC, 0xFC, 0x02, 0xFA, 0x00, 0xFE, 0x07, 0x04, 0x03, 0xFB, 0xFD, 0xF8, 0xFA,
+0xFE, 0x03, 0x02, 0x00, 0x02, 0xFD, 0x00, 0xFA, 0xFF, 0xFC, 0x09, 0xFE, 0xFD, 0xFF, 0x07, 0x02,
+0x00, 0x02, 0xFD, 0x03, 0xFE, 0x05, 0xF5, 0xFA, 0xFD, 0xF9, 0xFE, 0x01, 0xFF, 0xE3, 0xFD, 0x07,
+0xFB, 0x05, 0x02, 0xFF, 0x05, 0x01, 0xF7, 0xFE, 0x01, 0x02, 0x03, 0x00, 0xFC, 0x00, 0xFF, 0x02,
+0xFC, 0x0A, 0xFE, 0xFE, 0xFF, 0x03, 0x01, 0x00, 0x08, 0xFB, 0xFF, 0x02, 0xF7, 0xE9, 0x00, 0xFD,
+0x00, 0xFA, 0xFE, 0xF8, 0x05, 0xFA, 0xF8, 0xFA, 0x00, 0x02, 0x01, 0xFD, 0xFE, 0x03, 0xFB, 0x04,
+0xFC, 0x06, 0xFC, 0x01, 0x00, 0x03, 0x03, 0xFE, 0xFB, 0x01, 0x04, 0xFA, 0x00, 0xF5, 0xFB, 0x01,
+0xF5, 0x00, 0x00, 0x00, 0x05, 0xFD, 0xFB, 0xFE, 0x00, 0xFA, 0xFC, 0xF4, 0xFF, 0x01, 0x02, 0xFF,
+0xFF, 0x03, 0x02, 0xFE, 0xFB, 0x01, 0x00, 0x01, 0x09, 0xFB, 0xFD, 0x06, 0xFC, 0xF6, 0x00, 0xFC,
+0x04, 0x01, 0x07, 0x00, 0x01, 0x03, 0xFB, 0xFF, 0x02, 0x00, 0x01, 0xFB, 0xFB, 0xFE, 0xFE, 0x01,
+0x01, 0x03, 0x00, 0xFA, 0xFB, 0xFC, 0x02, 0xFF, 0x01, 0x02, 0x00, 0xFF, 0xF3, 0x05, 0xF4, 0x09,
+0xFD, 0xFE, 0xFA, 0x00, 0x04, 0xFF, 0x01, 0xFE, 0x01, 0xF8, 0x06, 0xFD, 0xFF, 0x06, 0x04, 0x03,
+0x04, 0x03, 0x02, 0x01, 0xFD, 0xFF, 0xFC, 0xFD, 0x05, 0x05, 0x00, 0xFD, 0x00, 0xFC, 0x05, 0x0A,
+0x04, 0x01, 0x03, 0xFA, 0x04, 0xFC, 0xFA, 0xFE, 0xFE, 0xFF, 0x04, 0xFE, 0xFD, 0xFB, 0x08, 0x06,
+0xFE, 0x03, 0xFF, 0x03, 0xFC, 0x0B, 0xFC, 0xFF, 0xFD, 0xF9, 0xFD, 0x01, 0xFC, 0xE5, 0xF6, 0x01,
+0xFC, 0xFE, 0x01, 0xFD, 0xFE, 0x02, 0x02, 0x00, 0x03, 0xFC, 0x05, 0x04, 0x04, 0x04, 0x07, 0x00,
+0xFB, 0x03, 0x03, 0xFC, 0xFC, 0x07, 0xFC, 0xFD, 0x03, 0xF9, 0xFE, 0x03, 0xFF, 0xD9, 0xFD, 0x09,
+0x00, 0xFE, 0x03, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x01, 0x05, 0x03, 0xFB, 0xF8, 0x03, 0xFD, 0xFF,
+0x01, 0x03, 0x00, 0x02, 0xFE, 0x07, 0xFF, 0x03, 0x01, 0x02, 0xFF, 0x03, 0xF6, 0x00, 0xF9, 0x08,
+0x00, 0xFF, 0x05, 0xF9, 0xFF, 0xFE, 0x00, 0x01, 0x05, 0xFE, 0x04, 0xFF, 0xFB, 0x00, 0x01, 0x00,
+0xFC, 0x04, 0x05, 0xFE, 0xFD, 0xFA, 0xFF, 0xF8, 0x01, 0xFF, 0x02, 0x00, 0xF7, 0xF7, 0x00, 0x06,
+0xFE, 0x00, 0x02, 0xFA, 0x00, 0x01, 0xF9, 0xFF, 0xFC, 0x01, 0x02, 0xFD, 0x02, 0xFC, 0x04, 0x03,
+0x00, 0x01, 0xFE, 0x04, 0x00, 0x09, 0x00, 0xFA, 0x02, 0xFD, 0x05, 0x05, 0xF8, 0xF8, 0xFC, 0x07,
+0xFF, 0xFA, 0x04, 0x03, 0xFF, 0x01, 0xFA, 0x01, 0x05, 0xFC, 0x04, 0x02, 0xFC, 0xFF, 0xFF, 0x02,
+0xF7, 0x06, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFB, 0x06, 0xFA, 0x03, 0xFD, 0xFE, 0xEA, 0xFC, 0xFD,
+0xFB, 0x04, 0x01, 0xFC, 0xFE, 0x03, 0x01, 0xFF, 0xFE, 0x06, 0x05, 0xFD, 0xFF, 0x00, 0x09, 0x03,
+0x01, 0x07, 0x07, 0xF8, 0xFA, 0x01, 0x00, 0xFB, 0xFE, 0x02, 0x03, 0x06, 0xFA, 0xF3, 0xFD, 0x09,
+0x00, 0xF8, 0xFF, 0x05, 0x05, 0xFB, 0x04, 0xFC, 0x00, 0x04, 0x04, 0xFA, 0xF9, 0x01, 0x00, 0x03,
+0x04, 0x05, 0x00, 0xFE, 0xFB, 0x07, 0xF8, 0xFB, 0xFC, 0xFA, 0x04, 0x03, 0x04, 0xFB, 0xFE, 0x07,
+0xFC, 0xFD, 0x00, 0x03, 0x02, 0xFC, 0xFA, 0xF9, 0xFD, 0xFE, 0x00, 0x04, 0x00, 0x07, 0x04, 0xFE,
+0xF8, 0x02, 0xFF, 0x02, 0xFE, 0x04, 0xFB, 0xFF, 0x06, 0xFD, 0xFF, 0xFD, 0xFF, 0xEA, 0xFD, 0x05,
+0xFA, 0x02, 0x03, 0x00, 0x02, 0x02, 0xF9, 0x01, 0x07, 0x02, 0x06, 0xF8, 0xF8, 0xFB, 0x05, 0x00,
+0x00, 0xFE, 0xFE, 0xFA, 0xFF, 0xFF, 0x05, 0xFF, 0x02, 0xFE, 0x00, 0x06, 0xFE, 0xD4, 0x01, 0x09,
+0xFE, 0xF8, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x02, 0x03, 0xFF, 0x00, 0xFE, 0xFE, 0x03, 0x01,
+0xFF, 0x05, 0xFF, 0x02, 0xFD, 0x02, 0xF7, 0xFC, 0x00, 0xFB, 0x01, 0x08, 0xFD, 0xEB, 0xFE, 0x03,
+0xFD, 0x01, 0xFF, 0x02, 0x03, 0x01, 0x01, 0xFF, 0x04, 0xFA, 0x03, 0x02, 0x00, 0x02, 0x01, 0x05,
+0xFC, 0xFF, 0xFE, 0xFC, 0x00, 0x03, 0xFD, 0xFE, 0x04, 0xFE, 0x04, 0xFD, 0xFE, 0xE7, 0xFB, 0x05,
+0x02, 0x03, 0x01, 0xFC, 0x05, 0xFD, 0x01, 0x00, 0x00, 0x00, 0x04, 0x03, 0xFB, 0x02, 0x02, 0xFF,
+0xFC, 0x00, 0x01, 0xFE, 0xFC, 0xFD, 0xFA, 0xFC, 0x00, 0x00, 0x07, 0x03, 0xFE, 0xFC, 0xFC, 0x03,
+0xFE, 0xFA, 0x04, 0x01, 0x03, 0xFB, 0xF6, 0x01, 0xFD, 0x00, 0xFD, 0xFC, 0xFF, 0x06, 0x00, 0x05,
+0x02, 0xFE, 0x00, 0xFB, 0x00, 0x06, 0x01, 0x01, 0x02, 0xFD, 0x01, 0x04, 0xFB, 0xFE, 0xFC, 0x03,
+0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xFA, 0xFC, 0xFF, 0x04, 0xFD, 0x00, 0x02, 0x07, 0xFB,
+0xFE, 0x0B, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0x02, 0x04, 0x05, 0x04, 0xFE, 0xFF, 0xFF, 0xF9, 0xFC,
+0xFF, 0xF8, 0x05, 0xFB, 0xFA, 0x02, 0xF9, 0xF9, 0xFD, 0xFE, 0x05, 0x07, 0x05, 0xFE, 0x08, 0xFD,
+0xFC, 0x09, 0xFD, 0xF7, 0x04, 0x05, 0x01, 0xFE, 0x01, 0xF7, 0xFC, 0x01, 0xFE, 0xFB, 0x02, 0x07,
+0xF7, 0xFE, 0xFE, 0xFB, 0x04, 0xFB, 0xFE, 0xFC, 0xFE, 0xFA, 0x02, 0xF6, 0x03, 0x02, 0x03, 0xFD,
+0x01, 0x06, 0xFB, 0x01, 0xFF, 0x03, 0xFF, 0xFF, 0x05, 0xFE, 0x00, 0x01, 0x08, 0xF4, 0x01, 0x00,
+0xFD, 0xFD, 0xFF, 0xFF, 0x07, 0x02, 0xFB, 0xFE, 0x05, 0xF6, 0xFB, 0xFB, 0x02, 0x02, 0x02, 0x02,
+0x03, 0x01, 0x00, 0xFE, 0xFE, 0x04, 0xFF, 0x01, 0x06, 0x04, 0xFD, 0xFD, 0x04, 0xFD, 0x04, 0x05,
+0xFA, 0xFA, 0x00, 0xFE, 0xFD, 0xF8, 0x00, 0xFC, 0x01, 0x05, 0x05, 0xFB, 0xF9, 0x01, 0xFE, 0x05,
+0xFD, 0x01, 0x01, 0x00, 0xFF, 0x06, 0xFA, 0x03, 0xFE, 0xF9, 0x02, 0x04, 0x01, 0xEE, 0xFA, 0x04,
+0x01, 0x06, 0xFE, 0xFA, 0x02, 0x00, 0xFC, 0x02, 0x05, 0xFD, 0xFE, 0x04, 0x01, 0xFF, 0xFD, 0x05,
+0x04, 0xFA, 0xFE, 0x05, 0x01, 0x05, 0x01, 0xFC, 0x05, 0x06, 0x02, 0xFB, 0xFF, 0xFB, 0x02, 0x06,
+0x05, 0x00, 0xFD, 0xFF, 0xFB, 0x06, 0x06, 0xFE, 0x01, 0x06, 0xFA, 0xFF, 0x05, 0x03, 0xFC, 0x06,
+0xFE, 0xFE, 0x03, 0xFA, 0xFC, 0x04, 0x01, 0xFB, 0x04, 0xFE, 0xFD, 0xFD, 0x00, 0x00, 0xFD, 0x04,
+0xFE, 0x05, 0xFC, 0x06, 0x00, 0xFC, 0x03, 0x01, 0x01, 0x04, 0xFF, 0x03, 0xFC, 0x02, 0x05, 0xFA,
+0x01, 0xFC, 0x05, 0xFB, 0x01, 0xFB, 0x06, 0xFD, 0xFA, 0x01, 0x02, 0x05, 0x03, 0xFC, 0x02, 0xFC,
+0xFB, 0x05, 0xFA, 0x01, 0x04, 0xFB, 0xFF, 0x05, 0xFC, 0xFE, 0xFC, 0x04, 0xFC, 0xFA, 0xFE, 0xFE,
+0x06, 0xFE, 0xFF, 0xFC, 0xFC, 0xFA, 0x06, 0x00, 0x02, 0xFD, 0x03, 0xFA, 0x05, 0xFD, 0x01, 0x01,
+0x01, 0xFD, 0x05, 0xFE, 0x04, 0x02, 0xFD, 0x00, 0xFB, 0xFE, 0x03, 0xFC, 0xFD, 0x03, 0x01, 0x01,
+0x03, 0xFD, 0x01, 0xFE, 0xFB, 0xFE, 0xFD, 0x00, 0x05, 0xFD, 0xFC, 0x04, 0x05, 0x02, 0x02, 0xFC,
+0x00, 0x06, 0xFC, 0x05, 0xFF, 0xFD, 0xFB, 0x04, 0xFD, 0x06, 0x02, 0x05, 0x05, 0x01, 0xFD, 0x05,
+0x03, 0xFA, 0x01, 0xFC, 0x06, 0xFF, 0xFC, 0x04, 0xFC, 0xFE, 0xFA, 0xFE, 0xFD, 0x02, 0x02, 0xFD,
+0xFE, 0x04, 0x03, 0xFD, 0x00, 0x05, 0xFA, 0x00, 0xFD, 0x06, 0xFC, 0xFB, 0xFC, 0xFD, 0x05, 0xFF,
+0x03, 0xFF, 0x05, 0x01, 0x01, 0x04, 0x02, 0xFB, 0x01, 0x03, 0x05, 0x03, 0x04, 0xFB, 0xFC, 0xFE,
+0xFD, 0x05, 0x02, 0xFF, 0x00, 0x04, 0xFF, 0x01, 0xFB, 0x04, 0x00, 0x03, 0xFE, 0x03, 0x06, 0xFD,
+0x04, 0x01, 0x05, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFE, 0x04, 0x02, 0xFF, 0x02, 0x01, 0xFA, 0xFA,
+0xF8, 0x00, 0x07, 0xFA, 0x04, 0xFA, 0xFF, 0xF8, 0x05, 0x00, 0x0A, 0xFA, 0xF4, 0x04, 0x08, 0x02,
+0xFE, 0x09, 0xFE, 0x00, 0xFD, 0x00, 0xFB, 0xFD, 0x05, 0xF7, 0xFF, 0x04, 0xFA, 0x08, 0x00, 0x09,
+0xFE, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xF5, 0x03, 0xF8, 0x00, 0xF7, 0xFD, 0x03, 0x0A, 0x0A,
+0xFC, 0x02, 0xF9, 0xFC, 0xFD, 0x0B, 0xFF, 0xF6, 0x02, 0x03, 0x06, 0x08, 0xFE, 0x00, 0xFE, 0x0A,
+0xF6, 0xF8, 0x04, 0xF9, 0x01, 0xFE, 0xFD, 0xFE, 0x01, 0xF9, 0x0D, 0x02, 0xF6, 0x04, 0x05, 0x05,
+0xFE, 0x08, 0xFF, 0xFE, 0xF8, 0x03, 0xFA, 0xFE, 0xFF, 0x05, 0x07, 0x05, 0xF9, 0x04, 0xF6, 0x07,
+0xFB, 0x02, 0x04, 0xFB, 0x07, 0xFF, 0xFB, 0xFB, 0x03, 0xF6, 0x01, 0xF5, 0xFC, 0x07, 0x01, 0xFF,
+0xFA, 0x07, 0xFA, 0xFF, 0xFA, 0x06, 0xF8, 0xFA, 0xFE, 0x04, 0x05, 0x05, 0x05, 0x06, 0xFB, 0x03,
+0x01, 0xFC, 0x05, 0xF9, 0x03, 0xF8, 0xF7, 0x01, 0x07, 0x01, 0x02, 0xFD, 0xFC, 0x05, 0x09, 0x0A,
+0x01, 0x0A, 0xF6, 0xF6, 0xF9, 0x07, 0xFC, 0xFF, 0x05, 0xFD, 0x05, 0x00, 0x01, 0xF7, 0xF8, 0x01,
+0xF7, 0xF8, 0x09, 0xFD, 0x0B, 0xF6, 0xFC, 0xF5, 0xFD, 0xF7, 0x04, 0x03, 0xFF, 0x01, 0x01, 0x02,
+0xFB, 0x04, 0xFF, 0xFC, 0xFE, 0x05, 0xF9, 0xF7, 0x01, 0x06, 0x05, 0x02, 0x00, 0x06, 0xF6, 0x06,
+0xF9, 0xFF, 0x02, 0xF7, 0x04, 0xFF, 0xFA, 0xF6, 0xFF, 0xFC, 0x01, 0xF6, 0xFF, 0x03, 0x0B, 0x09,
+0x01, 0x0C, 0xFD, 0xF6, 0xFC, 0x05, 0xF4, 0xFD, 0x06, 0xF5, 0x01, 0x04, 0xF7, 0x0C, 0xFE, 0x04,
+0xF7, 0xF8, 0x02, 0x01, 0x08, 0xFA, 0xFA, 0xFD, 0x05, 0x02, 0x05, 0xF9, 0xFC, 0x00, 0x03, 0xFF,
+0x01, 0x0B, 0xF7, 0xFF, 0xFF, 0x00, 0xF8, 0xF8, 0x08, 0xFB, 0x09, 0x07, 0xFF, 0x04, 0x00, 0x04,
+0xFE, 0xFC, 0x02, 0xF7, 0x01, 0xFA, 0xF5, 0xF2, 0xFA, 0xF7, 0x0C, 0xFB, 0xF4, 0xFD, 0x03, 0x05,
+0x00, 0x05, 0xFA, 0xF5, 0xFC, 0x08, 0xF5, 0xF5, 0x02, 0x00, 0x08, 0xFF, 0xFC, 0xFA, 0x00, 0x08,
+0xF7, 0xF7, 0x03, 0xF7, 0x04, 0xF4, 0xFA, 0xF7, 0x00, 0x04, 0x06, 0xF9, 0xFA, 0xF8, 0x08, 0x09,
+0xFC, 0x03, 0x00, 0xFD, 0x00, 0x0A, 0xF5, 0xF8, 0x03, 0xFC, 0x0A, 0x00, 0xFA, 0xFF, 0xFA, 0x0C,
+0xFD, 0xFB, 0x05, 0xFE, 0x05, 0xF8, 0xFC, 0xFE, 0x04, 0xFA, 0x03, 0x01, 0xFC, 0x07, 0x09, 0xFF,
+0xFB, 0x07, 0xFD, 0xFE, 0xFE, 0x01, 0xFF, 0xF8, 0x0D, 0xFF, 0x09, 0x0B, 0xF6, 0x02, 0xF6, 0x02,
+0xFB, 0xFA, 0x09, 0xF6, 0xFF, 0x00, 0xF4, 0xF3, 0xFE, 0xFC, 0x04, 0xFE, 0xF8, 0xFB, 0x04, 0xFF,
+0xFF, 0x05, 0xF9, 0x01, 0xFC, 0x05, 0xF9, 0xF8, 0x08, 0x03, 0x04, 0x07, 0xFC, 0xFE, 0xFA, 0x05,
+0xF9, 0xF7, 0x05, 0xF8, 0x05, 0xF9, 0x04, 0xFD, 0x00, 0xF8, 0x04, 0xFD, 0xF5, 0x00, 0x02, 0x01,
+0xF5, 0x06, 0xFE, 0xFA, 0xFD, 0x04, 0x02, 0xFC, 0x03, 0x03, 0x07, 0x04, 0xF7, 0x00, 0xFE, 0x0F,
+0xFE, 0xF5, 0x06, 0xF5, 0x0E, 0xFD, 0xF9, 0xFC, 0x01, 0x02, 0x03, 0xF9, 0x00, 0xFF, 0x07, 0x06,
+0xFE, 0x07, 0xF7, 0x01, 0x02, 0x0D, 0xF8, 0xF9, 0x00, 0xFF, 0x01, 0x0B, 0xFD, 0x00, 0xF4, 0xFE,
+0xFA, 0xFC, 0x03, 0xF9, 0xFE, 0xF6, 0xF9, 0xF6, 0x03, 0x03, 0x07, 0xF8, 0xFF, 0x03, 0x05, 0x03,
+0xFD, 0x09, 0xFC, 0xF7, 0xFA, 0x08, 0xFF, 0xFF, 0x06, 0xFF, 0x05, 0x0B, 0xF5, 0x05, 0xF7, 0xFE,
+0x00, 0xF5, 0x09, 0xFE, 0x09, 0xFB, 0xF6, 0xFA, 0x00, 0x01, 0x05, 0xF9, 0xFA, 0xFB, 0x04, 0x01,
+0xF8, 0x03, 0xFB, 0xF5, 0xF8, 0x05, 0xFB, 0xFA, 0x03, 0x09, 0x09, 0x06, 0xF3, 0x04, 0xFE, 0x01,
+0xFE, 0xFA, 0x05, 0xFB, 0x03, 0xF9, 0xFE, 0xF8, 0x03, 0xFA, 0x07, 0x04, 0xF9, 0x0C, 0x03, 0x03,
+0xF9, 0x03, 0xFA, 0xFD, 0xFD, 0x02, 0xFF, 0xFD, 0x02, 0x05, 0x04, 0x0A, 0xEE, 0x1A, 0xFA, 0xFE,
+0xFC, 0xF3, 0x0C, 0xFA, 0x04, 0xFB, 0xF7, 0xFF, 0x05, 0xFD, 0x0B, 0xFE, 0xF6, 0x01, 0x00, 0xFE,
+0xFA, 0x03, 0xFB, 0xFE, 0x00, 0x0C, 0x00, 0xFB, 0x04, 0xFF, 0x07, 0x01, 0xF2, 0x09, 0xFD, 0x09,
+0xFD, 0xF6, 0x06, 0xF4, 0x03, 0xF9, 0xFE, 0xFF, 0xFF, 0xFE, 0x08, 0xFD, 0xFD, 0x06, 0x04, 0x07,
+0x01, 0x01, 0xF8, 0xFE, 0xFB, 0x09, 0xFB, 0xF8, 0x08, 0x02, 0x04, 0x08, 0xFF, 0xFF, 0xF9, 0x05,
+0xFB, 0xFC, 0x02, 0xFD, 0x04, 0xF5, 0xFC, 0xFC, 0xFF, 0xFD, 0x0A, 0xFE, 0xFB, 0x08, 0x02, 0x09,
+0x00, 0x0D, 0xF9, 0xF7, 0xF9, 0x08, 0xF8, 0xF4, 0x02, 0xFE, 0x09, 0x05, 0xFD, 0xFA, 0xFA, 0x09,
+0xFC, 0xF8, 0x0D, 0xF8, 0x06, 0xFD, 0xF3, 0xFD, 0x09, 0x00, 0x0B, 0xFE, 0xF7, 0x03, 0x0A, 0xFB,
+0xFB, 0x0B, 0xFD, 0xFB, 0xF5, 0x09, 0xFF, 0xFC, 0x0C, 0xFE, 0x05, 0x00, 0xFB, 0xFE, 0xFC, 0xFF,
+0xF9, 0xFC, 0x04, 0xF6, 0x03, 0xF9, 0xF7, 0xFE, 0x05, 0xF3, 0x01, 0x06, 0xFE, 0x01, 0x07, 0x03,
+0x00, 0x03, 0xFA, 0xF8, 0xF5, 0x08, 0xFC, 0xFA, 0x03, 0x02, 0x08, 0x05, 0xFD, 0x0B, 0xF7, 0x01,
+0xFF, 0xFC, 0x07, 0xFA, 0x04, 0xFA, 0xFC, 0xF6, 0x0B, 0xFE, 0x04, 0xFB, 0xF7, 0xFE, 0x08, 0x03,
+0xF6, 0x02, 0xFA, 0xF9, 0xF9, 0x01, 0xFE, 0xF8, 0xFE, 0x09, 0x08, 0x07, 0xFA, 0x00, 0xFA, 0xFD,
+0xFC, 0xFE, 0x00, 0xFC, 0x07, 0xFE, 0xF6, 0xFE, 0x00, 0xFD, 0x02, 0xF7, 0xF6, 0xFD, 0x04, 0x09,
+0xFF, 0x05, 0xF5, 0xF7, 0xFF, 0x02, 0xF8, 0xF7, 0x02, 0x0A, 0x05, 0x07, 0xF6, 0x00, 0xFD, 0x03,
+0xFD, 0xFA, 0x0D, 0xFB, 0x00, 0xF4, 0xFC, 0xFA, 0x06, 0x06, 0x05, 0xFB, 0xF6, 0x00, 0x05, 0x04,
+0x00, 0x07, 0xFF, 0xF4, 0xF9, 0x0A, 0xF5, 0xF7, 0xFD, 0xFD, 0x06, 0x02, 0x00, 0xFC, 0xFC, 0x05,
+0x01, 0xFD, 0x0D, 0xFC, 0x07, 0xFE, 0xF4, 0xFD, 0x03, 0x02, 0x09, 0xFD, 0xF5, 0xFE, 0x04, 0x04,
+0x00, 0x0D, 0xFC, 0xF7, 0xFE, 0x05, 0xFE, 0xF9, 0x0C, 0xFC, 0x04, 0x0A, 0xFF, 0xFD, 0xF8, 0x02,
+0xFF, 0xFC, 0x07, 0xFD, 0x03, 0xFD, 0xFB, 0xFC, 0x04, 0xFB, 0x04, 0xFC, 0xF6, 0xFA, 0x0C, 0x0A,
+0xF9, 0x0A, 0xFC, 0xF9, 0x00, 0x08, 0xFC, 0xF4, 0x03, 0x04, 0x01, 0x07, 0xFB, 0xF8, 0xFC, 0x03,
+0xF4, 0xFF, 0x03, 0xFA, 0x03, 0xFD, 0xFC, 0xFC, 0x03, 0xFC, 0x03, 0xF7, 0xF9, 0x06, 0x03, 0x05,
+0xFE, 0x03, 0xFA, 0xF3, 0xFC, 0x07, 0xF7, 0xF5, 0x03, 0x0A, 0x05, 0x00, 0xFB, 0x02, 0xFF, 0x01,
+0x01, 0xF1, 0x06, 0x02, 0x0B, 0xF8, 0xF7, 0xFA, 0x09, 0xFF, 0x0A, 0xF9, 0xF7, 0x06, 0x05, 0x05,
+0xFE, 0x00, 0xFF, 0xFA, 0xFC, 0x08, 0x00, 0xF8, 0x04, 0xFF, 0x09, 0xFE, 0xFA, 0x03, 0xFB, 0x04,
+0x02, 0xF8, 0x06, 0xF7, 0xFF, 0xFE, 0xFB, 0xFC, 0x08, 0x01, 0x02, 0xFE, 0xF9, 0x0B, 0xFF, 0x09,
+0xFC, 0x06, 0xFA, 0xF7, 0xFE, 0x07, 0xFF, 0xFE, 0x07, 0xFE, 0x0A, 0x07, 0xF5, 0xFF, 0xF7, 0x08,
+0x01, 0xEE, 0x09, 0xFA, 0x02, 0xFD, 0xFD, 0xFF, 0x07, 0xF7, 0x0B, 0x04, 0xFC, 0x03, 0x04, 0x06,
+0xF7, 0x09, 0xFA, 0xFB, 0xFD, 0x05, 0xF5, 0xFE, 0x08, 0xFC, 0x06, 0x05, 0x05, 0xEC, 0xFF, 0x04,
+0xFE, 0xF6, 0x03, 0xFA, 0x04, 0xF7, 0xF9, 0xF4, 0x00, 0xFD, 0x0A, 0xFE, 0xFA, 0xFD, 0x0A, 0x07,
+0x00, 0x09, 0xFE, 0xF9, 0xFF, 0x03, 0xFD, 0xFC, 0x00, 0x03, 0x00, 0x02, 0xFA, 0xF8, 0xFE, 0x0C,
+0xF9, 0xFE, 0x0A, 0xFB, 0xFF, 0xFD, 0xF6, 0xF8, 0x09, 0x04, 0x0C, 0x05, 0x00, 0xFF, 0x08, 0x05,
+0x02, 0x08, 0xF8, 0xFA, 0xFC, 0x07, 0xFB, 0xFC, 0x08, 0xF7, 0x08, 0x04, 0x01, 0xFC, 0xFC, 0x0C,
+0xF9, 0xEF, 0x00, 0xFC, 0x0A, 0x01, 0xFD, 0x00, 0x07, 0x01, 0x05, 0xF9, 0xF9, 0x02, 0x00, 0x08,
+0x02, 0x03, 0xF6, 0xF7, 0xF5, 0x00, 0xFE, 0xF5, 0x06, 0x01, 0x00, 0x07, 0xFF, 0xF7, 0xF3, 0x02,
+0xFB, 0xFF, 0x03, 0xFC, 0x04, 0xF8, 0xFF, 0xFD, 0x0A, 0xFA, 0x0C, 0xF7, 0xFB, 0x03, 0xFF, 0x03,
+0xF5, 0x00, 0xF7, 0xFB, 0xFE, 0x03, 0xFE, 0xF7, 0x01, 0x04, 0x09, 0x09, 0xFF, 0x19, 0xFE, 0x06,
+0xFB, 0xF6, 0x03, 0xFB, 0x05, 0x02, 0x00, 0xFF, 0x05, 0xF1, 0x08, 0xFF, 0xFE, 0x07, 0x11, 0x0A,
+0x01, 0x05, 0xF9, 0x00, 0xFA, 0x06, 0xFE, 0x00, 0x08, 0x08, 0x00, 0x04, 0x00, 0x18, 0xFB, 0x05,
+0x00, 0xFC, 0x03, 0xF1, 0x01, 0xF7, 0xF3, 0xFB, 0x02, 0x01, 0x04, 0xFF, 0xF7, 0x03, 0x0B, 0x06,
+0xFA, 0x05, 0xFD, 0xFE, 0xFF, 0x0A, 0xF6, 0xF9, 0x01, 0xFF, 0x06, 0x06, 0xFE, 0xF8, 0xFE, 0x07,
+0xF8, 0xFA, 0x05, 0xFB, 0x02, 0xFC, 0x01, 0xFE, 0x06, 0xFC, 0x04, 0xFC, 0xFE, 0x01, 0x0B, 0x09,
+0xFB, 0x07, 0xFF, 0x01, 0xFE, 0x03, 0xF9, 0xF6, 0x01, 0x03, 0x07, 0x04, 0xFD, 0x13, 0xF7, 0x0F,
+0xFC, 0xFA, 0x08, 0xF6, 0x01, 0xF7, 0xFA, 0xFD, 0x00, 0xFD, 0x09, 0xFD, 0xF5, 0x02, 0x0B, 0x06,
+0xFE, 0x0B, 0xFD, 0xFD, 0xFD, 0x07, 0xF1, 0x01, 0xFE, 0x00, 0x06, 0x06, 0x00, 0x00, 0x01, 0x03,
+0xFA, 0xFE, 0x04, 0xFA, 0x07, 0xFD, 0xF9, 0xF8, 0xFA, 0xFD, 0x00, 0xFD, 0xFC, 0x03, 0x01, 0x09,
+0xFC, 0x0C, 0x01, 0x01, 0xF9, 0x08, 0xF9, 0xF5, 0xFF, 0x01, 0x07, 0x0A, 0x04, 0x09, 0xFA, 0x0A,
+0xFA, 0xF9, 0x09, 0xFC, 0x03, 0xFB, 0xFD, 0xFB, 0x07, 0xFA, 0xFF, 0xFC, 0xF9, 0x06, 0x05, 0x05,
+0xFD, 0x04, 0x01, 0xF6, 0xFE, 0x0A, 0xF9, 0xFB, 0x08, 0x04, 0x02, 0x01, 0xFD, 0xFB, 0xFC, 0x05,
+0xFB, 0xF8, 0x02, 0xFA, 0xFF, 0xF7, 0xF8, 0xF7, 0x0A, 0x02, 0x0B, 0xF6, 0xFB, 0x03, 0x0C, 0x01,
+0xFB, 0x02, 0xFD, 0xFF, 0xF6, 0x00, 0xFF, 0xF8, 0x03, 0xFC, 0x01, 0x07, 0xF3, 0x00, 0xFB, 0x0D,
+0xF6, 0x00, 0x08, 0xF7, 0x04, 0xFA, 0xFA, 0xFC, 0x06, 0x00, 0x03, 0x01, 0xF8, 0x06, 0x06, 0x03,
+0xF9, 0x06, 0xFE, 0xFB, 0xF3, 0x00, 0xFA, 0xF7, 0x02, 0xFB, 0x06, 0x02, 0xFC, 0xFA, 0xF9, 0x0A,
+0xF8, 0xFF, 0x05, 0xFE, 0xFF, 0xFC, 0xF8, 0xF9, 0xFE, 0xF9, 0x08, 0xFD, 0xF8, 0x07, 0x03, 0x07,
+0xF7, 0x06, 0xFC, 0xFC, 0xF6, 0x08, 0x02, 0xF8, 0x04, 0x04, 0x02, 0x03, 0xFB, 0x06, 0xFB, 0x07,
+0xF8, 0xFA, 0x08, 0xFA, 0x04, 0xF7, 0xFE, 0x01, 0x05, 0xF8, 0x01, 0xFA, 0x01, 0x04, 0x0E, 0x02,
+0xFD, 0x01, 0xFB, 0xF7, 0xFC, 0x0A, 0xF6, 0xFE, 0x02, 0x00, 0x03, 0x07, 0xFA, 0xF8, 0xFB, 0x03,
+0xF9, 0xFF, 0x07, 0xF8, 0x03, 0xFB, 0xF9, 0xF9, 0x00, 0xFB, 0x05, 0xFE, 0xFB, 0x06, 0x04, 0x09,
+0xFA, 0xFF, 0xF9, 0xF9, 0xFD, 0x07, 0xF8, 0xFA, 0x03, 0x00, 0x05, 0x05, 0xF9, 0xFC, 0xFB, 0x03,
+0xFB, 0xF9, 0x06, 0xFD, 0x05, 0xFE, 0x01, 0xFB, 0x04, 0xFD, 0x06, 0xF8, 0xF9, 0x0C, 0x02, 0x0B,
+0xF8, 0x04, 0xFF, 0xFC, 0xFC, 0x09, 0xFD, 0xFC, 0x05, 0x0A, 0x02, 0x02, 0x01, 0x06, 0xF7, 0x0B,
+0xFF, 0xFB, 0x0B, 0xFA, 0x06, 0xFE, 0xF6, 0xF7, 0x02, 0x03, 0x06, 0x04, 0xF2, 0xFF, 0x08, 0x08,
+0x01, 0x04, 0xFE, 0xFF, 0x00, 0x0B, 0x00, 0xF8, 0x09, 0xFE, 0x08, 0x09, 0xFD, 0x04, 0xFB, 0x09,
+0xFB, 0xF6, 0xFF, 0xFE, 0x01, 0xF6, 0xF5, 0xFB, 0x06, 0xFE, 0x06, 0x02, 0xFF, 0x01, 0xFF, 0x02,
+0xFB, 0x02, 0xF8, 0x00, 0xF6, 0x06, 0xF7, 0x00, 0x07, 0x03, 0x08, 0x02, 0xF7, 0xF7, 0xF7, 0x07,
+0xFC, 0xF8, 0x07, 0xF9, 0x07, 0xF3, 0xFB, 0xFB, 0x09, 0x02, 0x0D, 0xF4, 0x01, 0xFC, 0x0B, 0x0A,
+0xFE, 0x0A, 0xFB, 0xFD, 0xF8, 0x01, 0xFE, 0xFC, 0x05, 0xF5, 0x02, 0x07, 0xF6, 0xF8, 0xF8, 0xFC,
+0x03, 0xFF, 0x01, 0xFD, 0x03, 0xF9, 0xFB, 0xF8, 0x0A, 0x04, 0x01, 0xF7, 0xFD, 0x02, 0x06, 0x07,
+0xF6, 0x09, 0xF6, 0x01, 0xFB, 0x01, 0x00, 0xF8, 0x0B, 0x00, 0x09, 0x04, 0xF8, 0xFB, 0xF8, 0x05,
+0xF8, 0xFE, 0x04, 0xFA, 0x08, 0xFC, 0xFC, 0xFF, 0x05, 0xFD, 0x09, 0xFD, 0xF8, 0x00, 0x03, 0x0A,
+0xF7, 0x02, 0xFA, 0xFB, 0x00, 0x03, 0xF4, 0xFD, 0x03, 0x00, 0x09, 0x04, 0xFD, 0xEB, 0xF6, 0x06,
+0x00, 0xF6, 0x04, 0x00, 0x06, 0xF8, 0xF8, 0xFA, 0xFC, 0x03, 0x09, 0xFD, 0xFC, 0x04, 0x07, 0x08,
+0xFF, 0x0A, 0xFC, 0xF8, 0xFB, 0x06, 0xFA, 0xF6, 0xFD, 0x02, 0x08, 0x03, 0xFD, 0x04, 0xF9, 0x08,
+0xFF, 0xFE, 0x07, 0xF8, 0x0A, 0x00, 0xFC, 0xF2, 0x05, 0x03, 0x03, 0x00, 0xFF, 0x02, 0x05, 0x03,
+0xFD, 0x05, 0x01, 0xF7, 0xF9, 0x0A, 0xFC, 0xF2, 0x03, 0x04, 0x01, 0x02, 0xF3, 0xF7, 0xFF, 0x07,
+0xF2, 0xFA, 0x06, 0xFF, 0x05, 0xF9, 0xFC, 0xFD, 0x09, 0x00, 0x05, 0xFC, 0xF7, 0x06, 0x03, 0x04,
+0xFE, 0x02, 0xF9, 0xFA, 0xFA, 0x04, 0xFC, 0xFE, 0x04, 0x07, 0x01, 0x04, 0xF9, 0x13, 0x02, 0x08,
+0xFE, 0xF4, 0x0A, 0xFB, 0x03, 0x01, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0x00, 0xFD, 0x06, 0x09, 0x09,
+0xFC, 0x0A, 0xFC, 0xF6, 0x00, 0x0A, 0x00, 0xFB, 0x02, 0xFF, 0x0B, 0x01, 0xFF, 0xFC, 0xFC, 0x08,
+0xFA, 0xF5, 0x0D, 0xFC, 0x09, 0xF8, 0xFD, 0xFC, 0x01, 0xF9, 0x0C, 0xF9, 0xFC, 0x00, 0x02, 0x01,
+0xF8, 0x01, 0xFF, 0xFB, 0xFE, 0x06, 0x00, 0xFB, 0x05, 0xFB, 0x00, 0x01, 0xFC, 0x04, 0xFB, 0x01,
+0x03, 0xFC, 0x00, 0xFE, 0x02, 0xF4, 0xF9, 0xF1, 0x07, 0x01, 0x01, 0xF9, 0xFC, 0xFC, 0x00, 0x0A,
+0xF8, 0x07, 0xF6, 0xF5, 0xFC, 0x05, 0xF9, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x08, 0xF3, 0x04,
+0x01, 0xF9, 0x04, 0xFA, 0x04, 0xFD, 0xFB, 0xFC, 0x01, 0xF7, 0x05, 0xFE, 0x00, 0x06, 0x03, 0x01,
+0xFC, 0x0A, 0xF7, 0xFE, 0xFD, 0x08, 0xFF, 0xF8, 0x07, 0x03, 0x02, 0xFD, 0xFA, 0x0A, 0xFF, 0x0C,
+0x00, 0x00, 0x0C, 0xFD, 0x04, 0xFB, 0xF6, 0xF6, 0x06, 0x02, 0x06, 0xF5, 0xFF, 0x05, 0x0B, 0x07,
+0xFB, 0x01, 0xFF, 0xFF, 0xFF, 0x06, 0xFD, 0xF8, 0x06, 0xFA, 0x0A, 0x04, 0xFF, 0x07, 0xF7, 0x0A,
+0xFA, 0xFD, 0x0B, 0xF4, 0x07, 0xFD, 0xFC, 0xFB, 0x09, 0xFB, 0x05, 0xF8, 0x00, 0xFD, 0x07, 0x08,
+0xFE, 0x07, 0xF7, 0xFE, 0xF5, 0x00, 0xFA, 0xF7, 0x01, 0x02, 0x06, 0x00, 0xFE, 0x02, 0x01, 0x00,
+0xFF, 0xF8, 0x02, 0xF5, 0x02, 0xFD, 0xF5, 0xF6, 0x00, 0x00, 0x02, 0x04, 0xFE, 0x04, 0x0A, 0x01,
+0xF7, 0x08, 0xF9, 0xFF, 0x01, 0x03, 0xFB, 0xFF, 0x07, 0x00, 0x05, 0x08, 0xF9, 0x00, 0xFD, 0x07,
+0xFF, 0xF6, 0x08, 0xF5, 0x06, 0xF8, 0xFE, 0xFE, 0x08, 0x03, 0x04, 0xF5, 0x00, 0x01, 0x05, 0x0A,
+0xF4, 0x0C, 0xF6, 0xFD, 0xF7, 0x04, 0xF9, 0xFE, 0xFF, 0xFE, 0x07, 0x07, 0x00, 0x05, 0xF9, 0x05,
+0x01, 0xFE, 0x00, 0xF9, 0x07, 0xFE, 0xFD, 0xF7, 0x04, 0x01, 0x09, 0xFF, 0xFB, 0x06, 0x09, 0xFF,
+0x00, 0x01, 0x00, 0xFC, 0xF5, 0x07, 0xF9, 0xFD, 0xFC, 0x03, 0x07, 0x0A, 0xFB, 0x0C, 0xF6, 0x08,
+0xFE, 0x01, 0xFE, 0xFA, 0x06, 0xFE, 0xFC, 0xF9, 0x06, 0x03, 0x0B, 0xFE, 0xF5, 0x08, 0x07, 0xFA,
+0xF8, 0xFF, 0xFE, 0x06, 0x01, 0xFF, 0xF6, 0xFA, 0x0A, 0x04, 0x07, 0x08, 0xFF, 0x05, 0xFD, 0x02,
+0xF9, 0xFF, 0x03, 0xFC, 0x01, 0xF9, 0xFC, 0xFD, 0x08, 0xFB, 0x06, 0xFB, 0xFE, 0x02, 0xFF, 0x01,
+0xFF, 0x06, 0xFF, 0xF7, 0xFC, 0x09, 0x01, 0xFA, 0x00, 0x01, 0x02, 0x01, 0xFB, 0x08, 0x00, 0x06,
+0x01, 0xFD, 0xFF, 0xF7, 0x03, 0x00, 0xFE, 0xFD, 0x02, 0x00, 0x06, 0xFC, 0xFA, 0x0A, 0x06, 0x03,
+0xFB, 0x08, 0xF6, 0xFF, 0xF7, 0x07, 0xFC, 0xFB, 0x07, 0xF8, 0x01, 0x04, 0xF4, 0x0D, 0xF8, 0x05,
+0xF6, 0xF5, 0x09, 0xF9, 0x05, 0xFA, 0xF9, 0x00, 0x04, 0xFE, 0x02, 0xF8, 0x02, 0x08, 0x02, 0x06,
+0xFA, 0x01, 0xF7, 0xF7, 0x01, 0xFE, 0x00, 0x01, 0x07, 0xFF, 0x0A, 0x01, 0xFE, 0x07, 0xF6, 0x01,
+0xFC, 0xFA, 0x02, 0xF5, 0x09, 0x00, 0xF5, 0x00, 0x05, 0xFA, 0x06, 0xFA, 0x00, 0x04, 0x08, 0x06,
+0x01, 0x06, 0xF9, 0xFE, 0xFF, 0x0A, 0xFF, 0xFF, 0x00, 0x05, 0x0A, 0x03, 0xFE, 0x0A, 0xF8, 0x07,
+0xFD, 0xFE, 0x07, 0xF9, 0xFD, 0xFC, 0xF6, 0xFC, 0x06, 0x00, 0x02, 0xF7, 0x00, 0x03, 0x04, 0x08,
+0xFF, 0x03, 0xF9, 0xFA, 0xF9, 0x0A, 0xF9, 0x01, 0x09, 0xFC, 0x07, 0x02, 0xF9, 0x10, 0xFE, 0xFF,
+0xF8, 0xFC, 0x07, 0xFE, 0x04, 0x00, 0xF8, 0xFC, 0xFF, 0xF7, 0x06, 0xFF, 0xFE, 0x01, 0x02, 0xFF,
+0x01, 0x08, 0xFF, 0xFF, 0xFE, 0x0A, 0xFF, 0xF9, 0x0B, 0xFF, 0x02, 0x06, 0xF6, 0x02, 0xFE, 0x02,
+0xFA, 0xF8, 0x07, 0xFB, 0x04, 0xFA, 0xFC, 0x00, 0xFE, 0xFC, 0x05, 0xFC, 0xF5, 0x01, 0x04, 0x00,
+0xFB, 0x08, 0x03, 0xFF, 0x02, 0x0A, 0xF8, 0x02, 0x05, 0x05, 0x01, 0x07, 0x01, 0x01, 0xFF, 0x05,
+0xF7, 0xF8, 0x08, 0xFF, 0x06, 0xFF, 0xF9, 0xFA, 0x04, 0x02, 0x07, 0x05, 0xF6, 0xFE, 0x08, 0x01,
+0xFA, 0x04, 0xFD, 0xFA, 0xF9, 0x07, 0xFC, 0x00, 0xFA, 0x07, 0x02, 0x01, 0xF8, 0x03, 0xF6, 0xFE,
+0xF8, 0xF7, 0x0A, 0xFF, 0xFE, 0x00, 0xF8, 0xF7, 0xFC, 0xFA, 0x0A, 0xFE, 0xFE, 0xF5, 0x01, 0x04,
+0x01, 0x04, 0x01, 0x02, 0x03, 0x0C, 0xFB, 0xF4, 0x05, 0x07, 0x03, 0x04, 0xF2, 0xFF, 0xF9, 0x02,
+0xF9, 0xFB, 0x01, 0xFC, 0x00, 0xFD, 0xFA, 0xF7, 0x04, 0xFD, 0x08, 0x00, 0xF9, 0xFD, 0x05, 0x0B,
+0xFA, 0x02, 0xF8, 0xF8, 0xFB, 0x08, 0xF8, 0xFE, 0x06, 0x02, 0x0A, 0x06, 0xFE, 0x06, 0x00, 0x01,
+0xFE, 0xFD, 0x09, 0xF1, 0x04, 0xFE, 0xF7, 0xFB, 0xF7, 0xF8, 0x05, 0x07, 0xFE, 0xF9, 0x06, 0x05,
+0x03, 0x0C, 0xFE, 0xFB, 0xF5, 0x02, 0xF9, 0xF6, 0xFC, 0x07, 0x00, 0x07, 0xF3, 0xFA, 0xFA, 0x0E,
+0x00, 0xFE, 0x02, 0xF6, 0x01, 0xF8, 0xF8, 0xFB, 0x08, 0x01, 0x07, 0xF7, 0xFE, 0x07, 0x01, 0x05,
+0xFC, 0x00, 0xFA, 0xFA, 0xF6, 0x0C, 0xFE, 0xFC, 0x08, 0xFE, 0xFF, 0x04, 0xF7, 0x0B, 0xFD, 0x06,
+0xF7, 0x00, 0x02, 0x00, 0x02, 0xFD, 0xFF, 0xFE, 0x07, 0xF8, 0x04, 0xF3, 0xF6, 0x09, 0x06, 0xFE,
+0xFC, 0x0A, 0xFD, 0xF6, 0xF9, 0x09, 0x01, 0xFD, 0x01, 0x03, 0x06, 0xFF, 0xFD, 0x0B, 0xFD, 0x01,
+0xFA, 0x00, 0x05, 0xF9, 0x07, 0x04, 0x01, 0x02, 0x0E, 0xF9, 0x03, 0xF2, 0xF9, 0x05, 0xFE, 0x05,
+0xF9, 0x00, 0xF4, 0xF4, 0x02, 0xFD, 0xFB, 0x01, 0x06, 0x04, 0x06, 0x06, 0x03, 0x0C, 0x04, 0x04,
+0xFB, 0xF9, 0x06, 0x02, 0x09, 0xFB, 0xF7, 0xF7, 0x01, 0xFD, 0x06, 0xFE, 0xF6, 0xFC, 0xFE, 0x04,
+0xFD, 0x03, 0xFF, 0x01, 0xFF, 0xFE, 0xFC, 0xF7, 0x01, 0x07, 0xFD, 0x09, 0xFF, 0x04, 0xFE, 0x0A,
+0xF8, 0xF9, 0x05, 0xFE, 0xFF, 0xF9, 0xFB, 0xFB, 0xFD, 0xFE, 0x07, 0xFC, 0xF8, 0xFE, 0x06, 0x02,
+0xF9, 0x04, 0xF8, 0xFE, 0xF7, 0x00, 0xFF, 0xFA, 0x01, 0x05, 0x07, 0x04, 0xFB, 0x0D, 0xFC, 0x03,
+0xF7, 0x00, 0x07, 0xFA, 0x05, 0xFE, 0xF8, 0xFE, 0x04, 0xF7, 0x07, 0xFF, 0xFA, 0xFE, 0x0B, 0x03,
+0xF7, 0x07, 0xFE, 0xFC, 0xFF, 0x0B, 0xFA, 0xF9, 0x04, 0x05, 0x01, 0xFD, 0xFF, 0x02, 0xFF, 0x07,
+0xFD, 0xF5, 0x04, 0xF2, 0x03, 0xF8, 0xF9, 0xF9, 0x00, 0xFB, 0x01, 0x03, 0xF3, 0xFA, 0x07, 0x09,
+0xF8, 0x06, 0xF9, 0xF6, 0xF7, 0x03, 0xFB, 0xFF, 0x00, 0x00, 0x08, 0x0A, 0xF8, 0xF4, 0xFC, 0x02,
+0xFD, 0xFA, 0x06, 0xF5, 0x08, 0x02, 0xFD, 0x00, 0x04, 0xF9, 0x03, 0xFA, 0xFB, 0xFF, 0x04, 0x00,
+0xF9, 0x09, 0xFD, 0xF3, 0xFE, 0x05, 0x02, 0xFD, 0xFF, 0x0B, 0x04, 0x0A, 0xFF, 0x04, 0xF6, 0x05,
+0xFB, 0xFE, 0x02, 0xF7, 0x04, 0xFF, 0xFC, 0xF9, 0xFB, 0xF5, 0x01, 0xFA, 0xFF, 0xFF, 0x07, 0x08,
+0x00, 0x03, 0xFE, 0xFF, 0xFB, 0x09, 0xF7, 0xF9, 0x02, 0x07, 0x07, 0x01, 0xF0, 0xFD, 0xF3, 0x02,
+0xF9, 0xFB, 0x09, 0xF9, 0x04, 0xF8, 0xF7, 0xFC, 0xFC, 0xFD, 0x09, 0xFA, 0xFD, 0xFD, 0x09, 0x06,
+0xFC, 0x09, 0xFF, 0xFD, 0xF9, 0x05, 0xF5, 0xF9, 0x06, 0x06, 0x04, 0x02, 0xF8, 0x01, 0x01, 0x01,
+0xF6, 0xFE, 0x0A, 0xFE, 0x04, 0xF5, 0xF2, 0xF5, 0x08, 0x02, 0xFF, 0x01, 0xF8, 0xFF, 0x02, 0x08,
+0xFD, 0x03, 0xF6, 0xF9, 0xFE, 0x03, 0x01, 0xFE, 0xFE, 0xFF, 0x09, 0x06, 0x00, 0x0C, 0xF7, 0x09,
+0xFB, 0xF8, 0x05, 0xFC, 0x00, 0xFB, 0x00, 0xF8, 0x06, 0xFB, 0x07, 0xF7, 0xFE, 0x07, 0x05, 0x00,
+0xFC, 0x02, 0x02, 0xF9, 0xFB, 0x05, 0xFB, 0xFD, 0x05, 0x04, 0x06, 0x03, 0xFD, 0x06, 0x01, 0xFD,
+0xFE, 0xF9, 0x02, 0xFD, 0x03, 0x02, 0xF5, 0xF3, 0x02, 0x05, 0x02, 0xFE, 0xFE, 0x06, 0x00, 0x07,
+0x02, 0x0B, 0xFC, 0xFA, 0xFD, 0x07, 0xFD, 0xF5, 0x04, 0x01, 0x06, 0x03, 0xFC, 0x01, 0xF2, 0x01,
+0xF9, 0xFD, 0x08, 0xF8, 0x0B, 0xF6, 0xFF, 0xFC, 0x00, 0xFE, 0x04, 0xFD, 0xF7, 0xFD, 0x07, 0x08,
+0xFA, 0x0B, 0xF8, 0xFD, 0xFF, 0x03, 0xFC, 0xFF, 0x04, 0x04, 0x06, 0x03, 0xF9, 0x08, 0xFD, 0x06,
+0xF2, 0xFB, 0x09, 0xFC, 0x05, 0xFB, 0xF7, 0xFF, 0x0B, 0xFB, 0xFE, 0xF9, 0xFE, 0x03, 0x06, 0x04,
+0xF7, 0xFF, 0xF7, 0xFA, 0xF7, 0xFE, 0xFD, 0xFD, 0xFD, 0xFF, 0x0B, 0x0A, 0xFC, 0x0A, 0xFA, 0x00,
+0x01, 0xF9, 0x0B, 0xF7, 0x06, 0xFF, 0xFD, 0xF7, 0x04, 0xF9, 0x00, 0xF8, 0xFF, 0x05, 0x01, 0xFE,
+0xFB, 0x0A, 0xF9, 0xF8, 0xFA, 0x06, 0xFC, 0xFE, 0x07, 0xFD, 0x03, 0x0B, 0xFA, 0x07, 0x00, 0x07,
+0xFE, 0xFB, 0x05, 0xFC, 0x00, 0xFB, 0xFA, 0xFC, 0x06, 0xFD, 0x06, 0xF7, 0xFA, 0x05, 0x02, 0x02,
+0xFA, 0x05, 0xFB, 0xFE, 0xFC, 0x06, 0xFE, 0x00, 0x06, 0x0C, 0x02, 0x07, 0xF8, 0x0B, 0xFA, 0x05,
+0xFD, 0x00, 0x04, 0xFE, 0xFB, 0xF8, 0xF6, 0xF7, 0x09, 0x04, 0x0B, 0xFE, 0xF8, 0x00, 0x0D, 0x08,
+0x00, 0x0C, 0xF7, 0xFF, 0xFB, 0x01, 0xF9, 0xF5, 0x07, 0xF7, 0x08, 0x08, 0xFF, 0x0C, 0xF9, 0x08,
+0xF9, 0xFF, 0x0A, 0xFE, 0x08, 0xFB, 0xF7, 0xF7, 0xFC, 0x08, 0x09, 0x02, 0xF5, 0xFE, 0x08, 0x08,
+0xF8, 0x06, 0xF8, 0xFE, 0xFB, 0x08, 0xF5, 0x00, 0x09, 0xFF, 0x0A, 0x05, 0x00, 0xFE, 0xFA, 0xFE,
+0xF6, 0xFD, 0x01, 0xFB, 0x01, 0xFB, 0xF6, 0xF4, 0x02, 0xFA, 0x0C, 0x02, 0xF8, 0xFB, 0x07, 0x05,
+0xFE, 0x08, 0xF8, 0x01, 0xFB, 0x06, 0xF4, 0xFF, 0x02, 0xFD, 0x05, 0x06, 0xFE, 0x0C, 0xFD, 0x06,
+0xFB, 0xFE, 0x00, 0x01, 0x08, 0xF9, 0xFD, 0xFD, 0x05, 0xFA, 0x0C, 0x01, 0xFA, 0x04, 0x01, 0x01,
+0xFF, 0x0A, 0xF7, 0x01, 0xFE, 0x08, 0x00, 0x01, 0x07, 0xFE, 0x06, 0x04, 0xFF, 0x05, 0xFA, 0x08,
+0xFB, 0xF8, 0xFE, 0xF8, 0x0A, 0x03, 0xFC, 0xFC, 0x09, 0xFA, 0x08, 0xFF, 0xF7, 0x09, 0x08, 0x00,
+0xF8, 0x01, 0xFB, 0xFB, 0xF7, 0x0A, 0xFC, 0xFA, 0xFF, 0x02, 0x04, 0xFD, 0x01, 0xFD, 0xFD, 0x00,
+0xFA, 0xFB, 0x02, 0xFD, 0x07, 0xFD, 0xFE, 0xFD, 0x01, 0x04, 0x04, 0xF7, 0xF3, 0xFE, 0x06, 0x03,
+0xF7, 0x09, 0xFB, 0xF8, 0x00, 0x0B, 0xF8, 0xF8, 0x04, 0x05, 0x01, 0x07, 0xFD, 0xFB, 0xF9, 0x0A,
+0xFE, 0xFD, 0x07, 0xFC, 0x09, 0xF5, 0xFA, 0xFC, 0x01, 0xFE, 0x01, 0xFD, 0xFD, 0x05, 0x07, 0x02,
+0xF7, 0x08, 0xF9, 0xF9, 0xFC, 0x01, 0x00, 0xFD, 0x03, 0x05, 0x07, 0x03, 0xF9, 0x09, 0xF7, 0x03,
+0xFE, 0xF9, 0x07, 0xFB, 0xFF, 0xF8, 0xF9, 0x00, 0x05, 0xFA, 0x02, 0xFC, 0xFD, 0x07, 0x09, 0x08,
+0xFC, 0x06, 0xFE, 0xFB, 0xFD, 0x05, 0xFD, 0xFA, 0x07, 0xFE, 0x06, 0x09, 0xFA, 0x13, 0xF9, 0x07,
+0xF9, 0xFD, 0x03, 0xFD, 0x06, 0xFE, 0xFB, 0xF8, 0x06, 0xFC, 0x01, 0xF7, 0xFD, 0x0E, 0x01, 0x04,
+0x04, 0x07, 0x00, 0xFB, 0xFB, 0x05, 0xFB, 0xFA, 0x03, 0x04, 0x00, 0x0B, 0xFA, 0x0E, 0xFB, 0x09,
+0xFB, 0xFA, 0x0A, 0xFA, 0x03, 0xFB, 0xFA, 0xF8, 0x09, 0xFE, 0x0A, 0xF9, 0xF8, 0x00, 0x04, 0x0A,
+0xFC, 0x07, 0xF5, 0x02, 0xF7, 0x05, 0xFB, 0x01, 0x03, 0xF2, 0x02, 0x08, 0xFF, 0x15, 0xFC, 0x03,
+0xFA, 0xFA, 0x07, 0xFC, 0xFA, 0xFB, 0xFE, 0x02, 0x03, 0xF9, 0x01, 0xFC, 0xFA, 0x0B, 0x0A, 0x04,
+0x00, 0x06, 0xFB, 0xFE, 0xFD, 0x05, 0xF6, 0x04, 0x07, 0x06, 0x01, 0x04, 0xFF, 0x04, 0xF9, 0xFD,
+0xFA, 0xFA, 0x01, 0xFE, 0x05, 0xFF, 0xFE, 0xF9, 0x03, 0xF9, 0xFF, 0xF7, 0xF8, 0x00, 0x01, 0x01,
+0xF9, 0x05, 0xFC, 0xF9, 0x04, 0x07, 0xFF, 0xF9, 0x01, 0x00, 0x07, 0x07, 0xFF, 0x00, 0xFD, 0x02,
+0x02, 0xF5, 0x04, 0xF9, 0x08, 0x00, 0xFE, 0xFA, 0x0B, 0xFD, 0x02, 0x00, 0xF8, 0x05, 0x07, 0x01,
+0xF8, 0x05, 0xF8, 0xFB, 0x00, 0xFF, 0x01, 0x00, 0x03, 0x09, 0x0B, 0x01, 0xF6, 0x05, 0xF6, 0x05,
+0xFB, 0xFB, 0x02, 0xFB, 0x06, 0x00, 0xFA, 0xF9, 0x08, 0xFF, 0x07, 0x01, 0xF6, 0x06, 0x04, 0x05,
+0xFB, 0x09, 0xFC, 0xFE, 0xFF, 0x02, 0xFC, 0xF9, 0x07, 0xFC, 0x04, 0x02, 0xF0, 0xFE, 0xFC, 0x07,
+0x01, 0x05, 0x01, 0x00, 0x03, 0xF7, 0xFB, 0xFF, 0x0E, 0xFB, 0x01, 0xF5, 0x00, 0x08, 0x08, 0xFF,
+0xFC, 0x06, 0xF6, 0xF9, 0xFF, 0x03, 0xF9, 0xF5, 0x03, 0x06, 0x00, 0x02, 0xF4, 0x00, 0xFD, 0x05,
+0x03, 0xF7, 0x04, 0xFC, 0x0C, 0x05, 0xF9, 0xFA, 0x06, 0x00, 0x05, 0xFD, 0xF7, 0x02, 0x07, 0x08,
+0xFB, 0x07, 0xFC, 0xF9, 0xFD, 0xFF, 0xF5, 0x01, 0x04, 0x08, 0x04, 0x06, 0xFD, 0x0F, 0xFC, 0x02,
+0x02, 0xFE, 0x05, 0xFC, 0x04, 0x00, 0x00, 0xFB, 0x00, 0xFD, 0x07, 0x03, 0xF7, 0x08, 0x0D, 0x05,
+0xFD, 0x0C, 0xF6, 0xFB, 0xFA, 0x0B, 0xFE, 0xFB, 0x00, 0x01, 0x06, 0x07, 0xFB, 0xFC, 0xFD, 0x08,
+0xF9, 0xFA, 0x01, 0xF8, 0x0A, 0xFA, 0xF8, 0xFD, 0x04, 0xFF, 0xFF, 0x00, 0xF9, 0x04, 0x04, 0x02,
+0xF9, 0x05, 0x01, 0xF9, 0xF7, 0x0B, 0x01, 0xF9, 0x06, 0xFE, 0x07, 0x04, 0xFC, 0xFD, 0xFA, 0x07,
+0xF7, 0xFF, 0x06, 0xFD, 0x09, 0xF9, 0xF9, 0xFA, 0x04, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x02, 0x03,
+0xF8, 0x05, 0xFD, 0xFD, 0xF5, 0x01, 0xFC, 0x02, 0x05, 0x00, 0x01, 0x08, 0xFF, 0x04, 0xFC, 0xFE,
+0xFE, 0x02, 0x05, 0xFC, 0x07, 0xF6, 0xFE, 0xFA, 0x02, 0xFF, 0x06, 0xFA, 0xF6, 0xFD, 0xFF, 0x06,
+0xFC, 0x08, 0xF7, 0xF6, 0xF6, 0x00, 0xF8, 0xFA, 0x0A, 0xFE, 0x03, 0xFF, 0xFB, 0x0D, 0xFB, 0x08,
+0xFA, 0xF9, 0x02, 0xFC, 0x04, 0xF7, 0xF7, 0xFC, 0x08, 0xF8, 0x00, 0xFF, 0xFD, 0x00, 0xFD, 0x05,
+0x03, 0xFF, 0xF9, 0xFC, 0xFA, 0x00, 0xFA, 0xF9, 0x05, 0x04, 0xFD, 0x08, 0xFB, 0xFD, 0x01, 0x09,
+0x01, 0xFD, 0x07, 0xFA, 0x09, 0xFF, 0xF6, 0x01, 0x09, 0xF7, 0x09, 0xF7, 0xFC, 0xFB, 0x02, 0x0A,
+0xF6, 0xFE, 0xFA, 0x01, 0xF7, 0x08, 0xFD, 0x03, 0x06, 0x03, 0x07, 0x05, 0x00, 0xFD, 0xF5, 0x08,
+0xFA, 0xFD, 0x08, 0xF6, 0x05, 0xFA, 0xFA, 0xF9, 0x03, 0xFB, 0x0A, 0xFE, 0xF7, 0x02, 0x04, 0x08,
+0xFB, 0x04, 0xF9, 0xF9, 0x00, 0x01, 0xF7, 0xFF, 0x02, 0x07, 0x01, 0x03, 0x01, 0xFC, 0xFE, 0x0C,
+0xFC, 0x01, 0x06, 0xFF, 0x07, 0xFB, 0xFD, 0xFA, 0x04, 0xFE, 0x0A, 0xF7, 0x01, 0x04, 0x05, 0x0D,
+0xFC, 0x09, 0xFA, 0xF7, 0xF8, 0x08, 0xFA, 0xFA, 0x01, 0xFB, 0x0A, 0x08, 0xF9, 0x00, 0xFE, 0x03,
+0xFD, 0xF4, 0x06, 0xF7, 0x01, 0xFD, 0xFB, 0xFC, 0x07, 0x06, 0x03, 0xFD, 0xFC, 0xFE, 0x07, 0x01,
+0xF7, 0x02, 0xF9, 0xF8, 0xFA, 0x08, 0xF8, 0xF6, 0x04, 0x05, 0x00, 0x0B, 0xF6, 0x00, 0xFA, 0x01,
+0x04, 0xF9, 0x0B, 0x01, 0x00, 0xFC, 0xFC, 0xFD, 0x0B, 0xF8, 0x02, 0xFD, 0xFA, 0x01, 0x07, 0x00,
+0xFD, 0xFD, 0x01, 0xFE, 0x01, 0x05, 0xFD, 0xF6, 0x0B, 0x01, 0x06, 0xFF, 0xF5, 0x09, 0xF8, 0x04,
+0xFC, 0xF2, 0x03, 0xFA, 0x06, 0xFE, 0xF5, 0xFC, 0x01, 0x00, 0x04, 0x05, 0xF8, 0xFC, 0x03, 0x09,
+0x04, 0x09, 0xF7, 0xF7, 0xFC, 0x0B, 0xF6, 0x00, 0xFC, 0x03, 0x04, 0x09, 0x01, 0xFC, 0xF6, 0x05,
+0xF6, 0x00, 0x0B, 0x01, 0xFF, 0xF8, 0xFD, 0x01, 0x07, 0xFB, 0x07, 0xFE, 0xFD, 0x01, 0x03, 0x00,
+0x01, 0x09, 0xFE, 0xFF, 0xFA, 0x0A, 0xFE, 0xFB, 0x03, 0x00, 0x08, 0xFE, 0x01, 0x02, 0xFA, 0x09,
+0xFF, 0xF8, 0x03, 0xF9, 0x05, 0xF6, 0xF9, 0xFB, 0xFB, 0x01, 0x08, 0x07, 0x01, 0x01, 0x05, 0x04,
+0xFC, 0x05, 0xFD, 0xF9, 0xF9, 0x05, 0xFC, 0xFA, 0x08, 0xFA, 0x07, 0x07, 0xF8, 0x04, 0x00, 0x04,
+0xFC, 0xF5, 0x03, 0x01, 0x06, 0x01, 0xF3, 0x01, 0x0B, 0xFF, 0x02, 0xFD, 0xFA, 0x01, 0x06, 0x04,
+0xF8, 0x07, 0xF8, 0xF7, 0xF8, 0x08, 0x01, 0xFC, 0xFE, 0x00, 0x0A, 0x01, 0x02, 0x07, 0x01, 0x09,
+0xF8, 0xF7, 0x04, 0x04, 0x02, 0xFD, 0x04, 0xF9, 0x05, 0xFD, 0x06, 0x0B, 0x01, 0x06, 0x08, 0x04,
+0xF4, 0x03, 0xFC, 0xFB, 0xFB, 0x08, 0xFF, 0xF7, 0x03, 0x05, 0x0A, 0xFE, 0xF6, 0x02, 0xFA, 0x0A,
+0xF8, 0xF7, 0x00, 0xF5, 0x01, 0xFE, 0xFE, 0xF7, 0x06, 0x03, 0x0A, 0xFE, 0x00, 0x04, 0x0B, 0x01,
+0x03, 0x0D, 0xFD, 0xF8, 0xFB, 0x05, 0xF6, 0x00, 0x01, 0xF9, 0x05, 0xFE, 0xF7, 0xF3, 0xFA, 0x0A,
+0xFF, 0xF6, 0x06, 0xFD, 0xFF, 0xFA, 0xFC, 0xF9, 0x06, 0xF8, 0x01, 0xF9, 0xF4, 0x08, 0x05, 0x09,
+0xFC, 0xFD, 0xFB, 0xF6, 0xFE, 0x05, 0xFE, 0xFD, 0x06, 0x03, 0x00, 0x01, 0x01, 0x0A, 0xFF, 0xFF,
+0xF9, 0xFF, 0x08, 0xFF, 0xFC, 0xFD, 0xFD, 0x02, 0x04, 0xFA, 0x04, 0xFB, 0x03, 0x01, 0x07, 0x02,
+0xFA, 0xFF, 0xF9, 0x01, 0xFD, 0x06, 0xF7, 0x00, 0x00, 0xFF, 0x07, 0xFC, 0x02, 0x0B, 0xF9, 0x09,
+0xF8, 0xFA, 0x02, 0xFC, 0x08, 0xF9, 0x00, 0xF7, 0x0A, 0x01, 0x02, 0xF6, 0xFE, 0x09, 0x09, 0x02,
+0xF9, 0x00, 0xFB, 0xF8, 0xFA, 0xFF, 0xFD, 0xFC, 0x06, 0x08, 0x02, 0x09, 0xF7, 0xFA, 0x01, 0x04,
+0xF5, 0xF8, 0x0D, 0xF4, 0x0A, 0xF3, 0xF8, 0xF3, 0x04, 0xFE, 0x03, 0xF7, 0xFB, 0x03, 0x02, 0x07,
+0xF4, 0x08, 0xFA, 0xF5, 0xF6, 0x04, 0xF5, 0xF1, 0x02, 0x00, 0x0B, 0x09, 0xFC, 0x0E, 0xF8, 0x08,
+0xF5, 0xFC, 0x06, 0xEF, 0x07, 0xF0, 0xF5, 0xF1, 0xFC, 0xFC, 0x07, 0xF7, 0xF1, 0xFB, 0x07, 0x06,
+0xFE, 0x05, 0xF8, 0xF8, 0xF8, 0x10, 0xF7, 0xF7, 0x07, 0x00, 0x05, 0x10, 0xEF, 0x03, 0xF3, 0x09,
+0xF2, 0xF9, 0x0A, 0xF8, 0x05, 0xFB, 0xFA, 0xF5, 0x07, 0x00, 0x07, 0xF5, 0xF7, 0x06, 0x08, 0x10,
+0xF9, 0x09, 0xF9, 0xF7, 0xF4, 0x05, 0xF3, 0xF7, 0x02, 0x03, 0x02, 0x09, 0xF1, 0x04, 0xF8, 0x08,
+0xF1, 0xFB, 0x04, 0xF2, 0x08, 0xF5, 0xF4, 0xF4, 0x04, 0xF8, 0x04, 0xFE, 0xF9, 0xFE, 0x09, 0x0C,
+0xF9, 0x0C, 0xF1, 0xF6, 0xF5, 0x0A, 0xF6, 0xFC, 0x00, 0x0A, 0x01, 0x04, 0xF7, 0x02, 0xFB, 0x09,
+0xF7, 0xF9, 0x0A, 0xFC, 0x0C, 0xFF, 0xF8, 0xF3, 0x08, 0xF8, 0x0C, 0xF7, 0xFE, 0xFC, 0x06, 0x0B,
+0xFC, 0x0D, 0xF4, 0xFB, 0xF6, 0x0F, 0xF8, 0xF7, 0x04, 0x02, 0x0C, 0x0B, 0xF8, 0xFF, 0xF1, 0x01,
+0xF3, 0xF0, 0x09, 0xFE, 0x05, 0xF7, 0xF0, 0xFE, 0x06, 0xF9, 0x0E, 0xF9, 0xFE, 0x08, 0x0B, 0x09,
+0xF5, 0x0E, 0xFB, 0xF9, 0xF6, 0x05, 0xFD, 0xF5, 0x05, 0x07, 0x04, 0x07, 0xF9, 0x07, 0xF5, 0x07,
+0xF3, 0xF0, 0x0B, 0xF5, 0x06, 0xFB, 0xF3, 0xF0, 0x0C, 0x01, 0x10, 0xF2, 0xFB, 0x03, 0x04, 0x05,
+0xF5, 0x08, 0xF5, 0xF5, 0xFB, 0x04, 0xF1, 0xF8, 0x02, 0xFB, 0x0B, 0x04, 0xF8, 0x09, 0xFB, 0x0B,
+0xF1, 0xF2, 0x0B, 0xFB, 0x05, 0xF6, 0xFB, 0xF5, 0x09, 0x04, 0x0B, 0xFC, 0xFD, 0x04, 0x11, 0x08,
+0xFC, 0x0A, 0xF2, 0xF8, 0xFC, 0x0B, 0xFA, 0xFC, 0x07, 0xFF, 0x0D, 0x06, 0xF0, 0x07, 0xFB, 0x0E,
+0xFA, 0xF1, 0x0A, 0xFC, 0x0C, 0xFC, 0xFE, 0xFF, 0x01, 0xFC, 0x0C, 0xF4, 0xFE, 0x0A, 0x09, 0x0D,
+0xFC, 0x13, 0xFE, 0xFA, 0xF7, 0x0F, 0xF4, 0xF9, 0x0A, 0x05, 0x02, 0x06, 0xF8, 0xF7, 0xF9, 0x08,
+0xF4, 0xFA, 0x07, 0xF7, 0x0E, 0xFC, 0xFF, 0xF6, 0x09, 0xF9, 0x05, 0xF8, 0xFC, 0x0B, 0x0D, 0x03,
+0xF8, 0x07, 0xF6, 0xF8, 0xFE, 0x06, 0xF8, 0xF5, 0x06, 0x07, 0x08, 0x05, 0xFB, 0x01, 0xFC, 0x0C,
+0xFA, 0xFB, 0x0C, 0xF8, 0x09, 0xFC, 0xF1, 0xFD, 0x01, 0xFE, 0x08, 0xF8, 0xFD, 0x0C, 0x0E, 0x09,
+0xFB, 0x10, 0xFA, 0xF7, 0xEF, 0x03, 0xF4, 0xFA, 0x06, 0x0C, 0x05, 0x00, 0xF8, 0x00, 0xFE, 0x09,
+0xF5, 0xF6, 0x02, 0xF7, 0x0B, 0xF8, 0xF9, 0xF8, 0x06, 0xFC, 0x0C, 0xF4, 0xF5, 0x06, 0x08, 0x0A,
+0xFF, 0x0E, 0xFE, 0xFB, 0xF4, 0x0B, 0xF7, 0xF2, 0x04, 0x03, 0x05, 0x08, 0xFD, 0xF7, 0xFB, 0x05,
+0xFD, 0xFE, 0x08, 0xF4, 0x05, 0xF5, 0xFD, 0xF4, 0x06, 0xFD, 0x09, 0xFE, 0xFC, 0x08, 0x05, 0x08,
+0xF7, 0x04, 0xF9, 0xF8, 0xFC, 0x04, 0xF5, 0xF7, 0x05, 0x10, 0x0C, 0x0B, 0xF9, 0x09, 0xF6, 0x0E,
+0xF2, 0xF3, 0x0A, 0xF3, 0x01, 0xFB, 0xF1, 0xF9, 0x02, 0xF9, 0x0A, 0xF8, 0xFC, 0x02, 0x05, 0x03,
+0xFB, 0x09, 0xF7, 0xF7, 0xFA, 0x06, 0xF6, 0xF9, 0x04, 0xFF, 0x0D, 0x07, 0xF3, 0xF9, 0xF3, 0x0F,
+0xF5, 0xFC, 0x09, 0xFC, 0x09, 0xF8, 0xF7, 0xF9, 0x04, 0xF3, 0x04, 0xF7, 0xFC, 0x08, 0x01, 0x03,
+0xFE, 0x08, 0xFC, 0xF7, 0xFC, 0x06, 0xF7, 0xF6, 0x09, 0x0A, 0x0A, 0x05, 0xF0, 0x0E, 0xF8, 0x0D,
+0xFE, 0xF5, 0x0B, 0xF5, 0x06, 0xF9, 0xF3, 0xF9, 0x07, 0xFA, 0x06, 0xF9, 0xF5, 0x04, 0x09, 0x0B,
+0xF9, 0x05, 0xF1, 0xFB, 0xF5, 0x06, 0xF5, 0xF6, 0x05, 0x01, 0x05, 0x05, 0xF9, 0xFA, 0xFA, 0x0B,
+0xF5, 0xF6, 0x0B, 0xF7, 0x05, 0xFB, 0xFB, 0xFD, 0x04, 0x00, 0x0D, 0xFC, 0xF4, 0x09, 0x0F, 0x03,
+0xF6, 0x03, 0xF5, 0xFC, 0xFB, 0x04, 0xF3, 0xF6, 0x06, 0x07, 0x10, 0x04, 0xFE, 0xFB, 0xF7, 0x09,
+0xF7, 0xFB, 0x0F, 0xF6, 0x02, 0xF9, 0xF8, 0xF7, 0x08, 0xFE, 0x0A, 0xFE, 0xF5, 0x04, 0x06, 0x0A,
+0xFD, 0x05, 0xF3, 0xF2, 0xFD, 0x0A, 0xF9, 0xF4, 0x0A, 0x02, 0x0D, 0x01, 0xFC, 0x07, 0xFA, 0x07,
+0xF5, 0xF9, 0x04, 0xFB, 0x06, 0xF5, 0xF8, 0xF4, 0x08, 0x00, 0x0E, 0xFE, 0xF6, 0x04, 0x0A, 0x04,
+0xF9, 0x05, 0xF9, 0xF6, 0xF5, 0x08, 0xFC, 0xF3, 0x05, 0x03, 0x06, 0x0B, 0xFC, 0x05, 0xFA, 0x09,
+0xF4, 0xF7, 0x07, 0xFB, 0x0C, 0xFC, 0xF6, 0xF9, 0x10, 0xFD, 0x05, 0xF6, 0xF5, 0x04, 0x06, 0x0B,
+0xF6, 0x0B, 0xFC, 0xFE, 0xF5, 0x06, 0xFD, 0xF6, 0x07, 0x03, 0x02, 0x04, 0xF6, 0xFF, 0xFB, 0x01,
+0xF8, 0xF4, 0x0A, 0xFA, 0x07, 0xFA, 0xF9, 0xFD, 0x08, 0x04, 0x04, 0xFB, 0xFB, 0x08, 0x0B, 0x05,
+0xF4, 0x0D, 0xFB, 0xF9, 0xF6, 0x0C, 0xF6, 0xFE, 0x0B, 0x03, 0x08, 0x06, 0xFD, 0x05, 0xF9, 0x0A,
+0xFE, 0xF0, 0x0F, 0xF4, 0x02, 0xFC, 0xF3, 0xF7, 0x0B, 0xFA, 0x08, 0xF8, 0xF7, 0x04, 0x06, 0x08,
+0xF6, 0x08, 0xFC, 0xFC, 0xF2, 0x0C, 0xFD, 0xF3, 0x01, 0xF9, 0x01, 0x08, 0xF9, 0x01, 0xF9, 0x07,
+0xFF, 0xF7, 0x0B, 0xF8, 0x0B, 0xF8, 0xF7, 0xF0, 0x0B, 0x02, 0x0D, 0xF6, 0xF1, 0x01, 0x0B, 0x02,
+0xFB, 0x0B, 0xFA, 0xFC, 0xFD, 0x0E, 0xF9, 0xF5, 0x0A, 0xF6, 0x03, 0x08, 0xF8, 0x06, 0xF2, 0x04,
+0xFC, 0xFC, 0x05, 0xFA, 0x0D, 0xF0, 0xF7, 0xF4, 0x00, 0xFC, 0x0D, 0x05, 0xF5, 0x00, 0x07, 0x10,
+0xFB, 0x08, 0xF2, 0xF0, 0xF6, 0x0A, 0xFF, 0xFB, 0x05, 0x00, 0x06, 0x04, 0xF2, 0xF5, 0xF6, 0x11,
+0xFC, 0xFC, 0x0C, 0xF0, 0x07, 0xF0, 0xF8, 0xFB, 0x00, 0xFA, 0x0C, 0xFB, 0xF4, 0xFB, 0x0B, 0x07,
+0xF2, 0x06, 0xF8, 0xF8, 0xFA, 0x0B, 0xFD, 0xF3, 0x04, 0xFD, 0x05, 0x06, 0xF6, 0xF6, 0xF4, 0x08,
+0xF4, 0xFA, 0x06, 0xF9, 0x0F, 0xF6, 0xF7, 0xF6, 0x01, 0xF7, 0x0C, 0x00, 0xF8, 0x0A, 0x00, 0x0C,
+0xF7, 0x0A, 0xFC, 0xF9, 0xF8, 0x09, 0xF6, 0xFA, 0x0C, 0xFF, 0x03, 0x0F, 0xFD, 0xFE, 0xF3, 0x06,
+0xF4, 0xFA, 0x06, 0xF0, 0x07, 0xFD, 0xF7, 0xFA, 0x00, 0xFC, 0x07, 0x00, 0xFB, 0x00, 0x04, 0x09,
+0xF7, 0x0A, 0xF8, 0xF7, 0xFA, 0x0A, 0xF8, 0xF1, 0x05, 0x04, 0x08, 0x0A, 0xF3, 0xFA, 0xF6, 0x05,
+0xFB, 0xFF, 0x0C, 0xF5, 0x04, 0xF6, 0xF5, 0xF9, 0x0C, 0xF7, 0x0D, 0xF5, 0xF6, 0x05, 0x0B, 0x0D,
+0xFD, 0x09, 0xFB, 0x00, 0xF8, 0x08, 0xF6, 0xFC, 0x0B, 0xFE, 0x08, 0x01, 0xFD, 0xFF, 0xFD, 0x0B,
+0xF7, 0xF6, 0x05, 0xEF, 0x0A, 0xF6, 0xF7, 0xF9, 0x07, 0xFB, 0x07, 0xF8, 0xFC, 0x01, 0x05, 0x03,
+0xFD, 0x07, 0xF6, 0xF1, 0xFC, 0x06, 0xF8, 0xF5, 0x04, 0x06, 0x06, 0x05, 0xF5, 0x02, 0x01, 0x0B,
+0xF8, 0xF7, 0x0B, 0xF9, 0x06, 0xF9, 0xF5, 0xF6, 0x06, 0x01, 0x0B, 0xFC, 0xF9, 0x02, 0x06, 0x0C,
+0xF7, 0x04, 0xF7, 0xFC, 0xF5, 0x05, 0xF6, 0xFA, 0x07, 0x0A, 0x01, 0x0B, 0xFD, 0xFA, 0xFE, 0x0A,
+0xF8, 0xF8, 0x0D, 0xF1, 0x0D, 0xF4, 0xF3, 0xFB, 0x0A, 0xF6, 0x05, 0xF9, 0xF8, 0x02, 0x01, 0x03,
+0xFE, 0x09, 0xF4, 0xF7, 0xFA, 0x0D, 0xF7, 0xFB, 0x06, 0x01, 0x04, 0x0A, 0xF6, 0x00, 0xF9, 0x07,
+0xFB, 0xF6, 0x03, 0xF4, 0x01, 0xF3, 0xF8, 0xF4, 0xFF, 0x03, 0x0B, 0xFB, 0xF5, 0x01, 0x0D, 0x0B,
+0xFD, 0x04, 0xF8, 0xF6, 0xFA, 0x0E, 0xF1, 0xFB, 0x04, 0xFE, 0x0E, 0x0C, 0xF3, 0x08, 0xFC, 0x0B,
+0xF8, 0xFC, 0x07, 0xF9, 0x05, 0xF0, 0xFA, 0xFB, 0x08, 0xF9, 0x0E, 0xF4, 0xEF, 0x00, 0x0E, 0x09,
+0xFE, 0x0D, 0xF7, 0xFC, 0xF2, 0x0F, 0xF9, 0xFD, 0x04, 0xFE, 0x03, 0x0C, 0xF8, 0x08, 0xFA, 0x06,
+0xF1, 0xFC, 0x08, 0xFC, 0x06, 0xF7, 0xFC, 0xF5, 0x0A, 0xF6, 0x04, 0xF9, 0xFA, 0x0E, 0x0D, 0x0A,
+0xFD, 0x0B, 0xF5, 0xFB, 0xFB, 0x01, 0xF8, 0xFC, 0x06, 0x08, 0x05, 0x0A, 0xFB, 0x12, 0xF9, 0x0B,
+0xF1, 0xF6, 0xFF, 0xFA, 0x03, 0xFE, 0xFB, 0xF9, 0x02, 0xF3, 0x03, 0xFC, 0xFB, 0x02, 0x0B, 0x0A,
+0xF7, 0x08, 0xFA, 0xF4, 0xFA, 0x0D, 0xF5, 0xF6, 0x08, 0x09, 0x06, 0x0A, 0xF6, 0x04, 0xFA, 0x05,
+0xFA, 0xFC, 0x0A, 0xF4, 0x09, 0xF9, 0xFB, 0xF9, 0x09, 0xFE, 0x07, 0xFE, 0xF2, 0x05, 0x03, 0x04,
+0xF9, 0x0E, 0xF5, 0xF6, 0xF4, 0x05, 0xF8, 0xFD, 0x06, 0x04, 0x02, 0x06, 0xF3, 0x02, 0xFC, 0x0C,
+0xF8, 0xFC, 0x0D, 0xF9, 0x01, 0xFA, 0xFB, 0xFA, 0x07, 0xFE, 0x09, 0xFA, 0xF3, 0x0A, 0x07, 0x06,
+0xFC, 0x0B, 0xFB, 0xFA, 0xF3, 0x0B, 0xF5, 0xF7, 0x09, 0x02, 0x0D, 0x05, 0xFC, 0xFF, 0xFC, 0x01,
+0x00, 0xF4, 0x0D, 0xF8, 0x04, 0xF5, 0xFB, 0xF9, 0xFF, 0x03, 0x0B, 0xFD, 0xF7, 0xFE, 0x0F, 0x04,
+0xF5, 0x0C, 0xF3, 0xF4, 0xF8, 0x06, 0xFB, 0xF9, 0x09, 0x05, 0x0D, 0x08, 0xF3, 0x02, 0xFA, 0x06,
+0xFD, 0xFA, 0x05, 0xFA, 0x0A, 0xF9, 0xF5, 0xF6, 0x09, 0x01, 0x0B, 0xF8, 0xF5, 0x08, 0x0C, 0x04,
+0xFA, 0x05, 0xF7, 0xFA, 0xFC, 0x0E, 0xF3, 0xFB, 0x0D, 0xF8, 0x0D, 0x07, 0xF2, 0x02, 0xF7, 0x07,
+0xFD, 0xFC, 0x04, 0xFB, 0x09, 0xF8, 0xF1, 0xFB, 0x0C, 0xF6, 0x07, 0xF4, 0xFA, 0x08, 0x0B, 0x0C,
+0xF6, 0x07, 0xFE, 0xF9, 0xFB, 0x08, 0xFA, 0xF2, 0x06, 0x00, 0x04, 0x05, 0xF3, 0x06, 0xFD, 0x10,
+0xF6, 0xF1, 0x06, 0xF2, 0x06, 0x00, 0xF2, 0xFC, 0x00, 0xFA, 0x09, 0xFA, 0xF3, 0xFF, 0x05, 0x0E,
+0xF4, 0x08, 0xFA, 0xFC, 0xF8, 0x04, 0xF7, 0xF0, 0x05, 0x00, 0x0B, 0x04, 0xF4, 0xFC, 0xF6, 0x00,
+0xFD, 0xF7, 0x0E, 0xFC, 0x06, 0xF5, 0xF2, 0xFB, 0x0B, 0xF9, 0x0B, 0xFE, 0xF7, 0x01, 0x08, 0x03,
+0xFF, 0x0E, 0xF3, 0xF9, 0xFF, 0x0A, 0xF6, 0xF9, 0x0A, 0xFC, 0x0B, 0x09, 0xFC, 0xFD, 0xF7, 0x06,
+0xFB, 0xF3, 0x04, 0xF2, 0x01, 0xF6, 0xF2, 0xF1, 0x06, 0xFD, 0x0E, 0xFA, 0xFC, 0xFC, 0x05, 0x07,
+0xF4, 0x0A, 0xF6, 0xF6, 0xFE, 0x08, 0xF5, 0xF3, 0x02, 0x08, 0x01, 0x07, 0xFB, 0x00, 0xFD, 0x06,
+0xF9, 0xF6, 0x03, 0xF4, 0x06, 0xF9, 0xF7, 0xF3, 0x04, 0xFB, 0x0E, 0xF6, 0xFB, 0x06, 0x04, 0x04,
+0xF9, 0x0A, 0xF9, 0xFE, 0xF4, 0x0C, 0xF8, 0xF4, 0x0A, 0xF8, 0x03, 0x0B, 0xFB, 0xF6, 0xF6, 0x06,
+0xFB, 0xF4, 0x07, 0xF2, 0x08, 0xF8, 0xFF, 0xF6, 0x06, 0x00, 0x0E, 0xFD, 0xFA, 0x01, 0x08, 0x0B,
+0xFD, 0x01, 0xF7, 0xF8, 0xFA, 0x07, 0xF5, 0xF7, 0x06, 0x08, 0x07, 0x09, 0xFC, 0x00, 0xF3, 0x0E,
+0x00, 0xF7, 0x08, 0xF3, 0x04, 0xF4, 0xF5, 0xF2, 0x09, 0xFD, 0x0D, 0x02, 0xF5, 0x00, 0x05, 0x09,
+0xF4, 0x04, 0xFA, 0xF8, 0xF6, 0x0C, 0xF4, 0xF9, 0x07, 0xF7, 0x01, 0x0C, 0xFC, 0xFA, 0xF8, 0x0E,
+0xFA, 0xF2, 0x09, 0xF5, 0x05, 0xFC, 0xF9, 0xF4, 0x09, 0xFC, 0x04, 0xFB, 0xF6, 0x0A, 0x0D, 0x05,
+0xF4, 0x04, 0xF6, 0xFB, 0xFD, 0x0B, 0xF9, 0xF9, 0x02, 0x07, 0x02, 0x07, 0xF9, 0x02, 0xFC, 0x0B,
+0xFA, 0xFA, 0x03, 0x00, 0x07, 0xF6, 0xF5, 0x00, 0x0B, 0xF6, 0x09, 0xF7, 0xF7, 0x04, 0x08, 0x08,
+0xF7, 0x09, 0xF4, 0xFB, 0xFC, 0x07, 0xFA, 0xF9, 0x06, 0x0C, 0x0B, 0x07, 0xF3, 0x04, 0xFF, 0x0A,
+0xF7, 0xF7, 0x0A, 0xF9, 0x05, 0xF5, 0xFB, 0xF9, 0x03, 0x08, 0x0E, 0xFE, 0xF4, 0x02, 0x10, 0x0E,
+0xF9, 0x0E, 0xF5, 0xF9, 0xF5, 0x09, 0xFB, 0xF1, 0x02, 0xF6, 0x0A, 0x03, 0xF0, 0xED, 0xFA, 0x0D,
+0xF7, 0xFB, 0x09, 0xF8, 0x03, 0xF8, 0xF3, 0xF9, 0x05, 0x02, 0x0B, 0xFF, 0xEC, 0x07, 0x06, 0x0C,
+0xF9, 0x0F, 0xF6, 0xF6, 0xFB, 0x0C, 0xFB, 0xFB, 0x05, 0x03, 0x07, 0x01, 0xF6, 0xFF, 0xFA, 0x0D,
+0xFC, 0xF8, 0x06, 0xF6, 0x04, 0xFC, 0xFB, 0xF0, 0x03, 0xFD, 0x05, 0xF5, 0xF3, 0x00, 0x09, 0x11,
+0xFA, 0x06, 0xFD, 0xF5, 0xF2, 0x0A, 0xF7, 0xF6, 0x02, 0x07, 0x06, 0x03, 0xF8, 0xFB, 0xFB, 0x0A,
+0xF8, 0xF9, 0x08, 0xF2, 0x03, 0xF8, 0xFB, 0xF3, 0x0C, 0xF5, 0x09, 0xFC, 0xF7, 0x03, 0x02, 0x08,
+0xFC, 0x04, 0xF2, 0xF5, 0xFB, 0x08, 0xF6, 0xF4, 0x06, 0x03, 0x08, 0x09, 0xF8, 0x00, 0xF9, 0x02,
+0xFC, 0xF5, 0x0E, 0xFA, 0x02, 0xF6, 0xFA, 0xF8, 0x0B, 0xF4, 0x02, 0xFC, 0x01, 0x04, 0x0B, 0x05,
+0xFD, 0x07, 0xF6, 0xF4, 0xFB, 0x0D, 0xF5, 0xF4, 0x0A, 0x03, 0x00, 0x09, 0xFC, 0x02, 0xFD, 0x10,
+0xFB, 0xF5, 0x08, 0xF8, 0x04, 0xF5, 0xF7, 0xFB, 0x01, 0x00, 0x04, 0xFB, 0xF2, 0x02, 0x0C, 0x0B,
+0xF7, 0x0A, 0xF9, 0xFB, 0xFC, 0x09, 0xF8, 0xF7, 0x00, 0x01, 0x06, 0x0E, 0xF1, 0xF5, 0xF7, 0x0D,
+0xF7, 0xFB, 0x0C, 0xF5, 0x09, 0xFB, 0xF6, 0xF7, 0x09, 0x02, 0x05, 0xFE, 0xFB, 0x06, 0x02, 0x0C,
+0xF7, 0x0A, 0xF5, 0xFC, 0xF4, 0x0B, 0xFA, 0xFB, 0x04, 0x04, 0x0C, 0x09, 0xF1, 0x00, 0xF8, 0x06,
+0xF9, 0xFA, 0x03, 0xF6, 0x04, 0xF9, 0xFA, 0xF8, 0x06, 0xF6, 0x0A, 0x01, 0xF4, 0x0A, 0x05, 0x0B,
+0xF9, 0x06, 0xF9, 0xFC, 0xFB, 0x0D, 0xF4, 0xF3, 0x08, 0x08, 0x04, 0x02, 0xFA, 0x0E, 0xF9, 0x0D,
+0xF7, 0xF6, 0x0B, 0xF9, 0x01, 0xF7, 0xFA, 0xFB, 0x08, 0xF6, 0x04, 0xFE, 0xFB, 0x08, 0x0B, 0x06,
+0xF8, 0x05, 0xF7, 0xF6, 0xFB, 0x0A, 0xF7, 0xF5, 0x07, 0x05, 0x07, 0x04, 0xF7, 0x03, 0xFF, 0x0D,
+0xF7, 0xF4, 0x09, 0xFD, 0x00, 0xF9, 0xFD, 0xF7, 0x0D, 0xF7, 0x08, 0xFC, 0xFF, 0x08, 0x0C, 0x06,
+0xF3, 0x0A, 0xFB, 0xFC, 0xFA, 0x07, 0xF7, 0xF9, 0x06, 0x00, 0x0A, 0x07, 0xF3, 0x08, 0xFC, 0x0A,
+0xF4, 0xF6, 0x0A, 0xF7, 0x03, 0xFB, 0xF9, 0xF7, 0x02, 0xFC, 0x06, 0xFA, 0xFD, 0x02, 0x10, 0x0A,
+0xF7, 0x03, 0xF5, 0xF7, 0xF9, 0x09, 0xF3, 0xF7, 0x03, 0x00, 0x0A, 0x08, 0xF2, 0x02, 0xF6, 0x06,
+0xF6, 0xFB, 0x07, 0xF9, 0x06, 0xF0, 0xFE, 0xF9, 0x09, 0xF8, 0x0A, 0xF6, 0xFB, 0x0A, 0x05, 0x0B,
+0xF7, 0x09, 0xF7, 0xF8, 0xFC, 0x07, 0xFB, 0xFE, 0x08, 0x04, 0x0C, 0x08, 0xF3, 0xFC, 0xFD, 0x06,
+0xF5, 0xFB, 0x0B, 0xFD, 0x0A, 0xFD, 0xFF, 0xFD, 0x09, 0xF8, 0x04, 0xFA, 0xF5, 0x05, 0x0B, 0x09,
+0xFB, 0x05, 0xF8, 0xFB, 0xF9, 0x06, 0xF9, 0xF6, 0x08, 0x0C, 0x09, 0x05, 0xEB, 0x09, 0xFC, 0x0E,
+0xFC, 0xF5, 0x08, 0xF8, 0x02, 0xFD, 0xF9, 0xF7, 0x0A, 0xF6, 0x0A, 0xFB, 0xFA, 0x09, 0x05, 0x09,
+0xF8, 0x07, 0xF5, 0xF9, 0xF9, 0x0C, 0xF8, 0xF8, 0x06, 0x07, 0x07, 0x07, 0xFF, 0x02, 0xF8, 0x05,
+0xF9, 0xF1, 0x0D, 0xFB, 0x09, 0xF9, 0xF0, 0xF3, 0x06, 0xFD, 0x09, 0xF7, 0xFC, 0xFF, 0x05, 0x0E,
+0xFB, 0x03, 0xFF, 0xF2, 0xFD, 0x07, 0xFB, 0xFC, 0x09, 0x01, 0x04, 0x0A, 0xFA, 0xF7, 0xF6, 0x0E,
+0xFF, 0xF8, 0x07, 0xFB, 0x04, 0xFD, 0xF9, 0xF8, 0x06, 0xF9, 0x05, 0xFC, 0xFA, 0x0A, 0x04, 0x07,
+0xF9, 0x0C, 0xF6, 0xFB, 0xF7, 0x06, 0xFA, 0xFA, 0x0A, 0x03, 0x0B, 0x0B, 0xF2, 0x04, 0xF4, 0x0C,
+0xF4, 0xF7, 0x0D, 0xEC, 0x0B, 0xF3, 0xF0, 0xF1, 0x0E, 0xF6, 0x13, 0xF4, 0xF4, 0x07, 0x08, 0x0F,
+0xF1, 0x12, 0xF5, 0xEE, 0xEF, 0x0B, 0xF6, 0xF3, 0x07, 0x10, 0x0E, 0x0F, 0xF1, 0x14, 0xF1, 0x0A,
+0xEA, 0xF7, 0x0D, 0xF6, 0x0B, 0xF2, 0xEF, 0xF5, 0x0B, 0xF3, 0x0D, 0xEC, 0xF3, 0x09, 0x12, 0x11,
+0xF2, 0x09, 0xF1, 0xF1, 0xF4, 0x0B, 0xF6, 0xF7, 0x0C, 0x0E, 0x0D, 0x11, 0xEE, 0x15, 0xF3, 0x10,
+0xED, 0xF2, 0x12, 0xF4, 0x08, 0xF1, 0xF4, 0xF2, 0x0A, 0xF9, 0x0F, 0xF2, 0xF1, 0x0D, 0x0F, 0x13,
+0xEE, 0x0F, 0xF4, 0xF3, 0xEE, 0x14, 0xF0, 0xEF, 0x07, 0xFD, 0x0B, 0x13, 0xE9, 0xFB, 0xEE, 0x0B,
+0xF0, 0xF1, 0x0C, 0xF5, 0x10, 0xED, 0xF6, 0xF4, 0x07, 0xF8, 0x10, 0xFE, 0xF7, 0x0A, 0x11, 0x11,
+0xF3, 0x0A, 0xEF, 0xEF, 0xEC, 0x10, 0xED, 0xEB, 0x09, 0x08, 0x0E, 0x0A, 0xED, 0x0B, 0xE9, 0x0E,
+0xF9, 0xF5, 0x0C, 0xF0, 0x0C, 0xF6, 0xF6, 0xF1, 0x15, 0xF7, 0x10, 0xF1, 0xF5, 0x09, 0x09, 0x14,
+0xED, 0x0D, 0xF5, 0xEF, 0xF2, 0x14, 0xF8, 0xED, 0x08, 0x0B, 0x14, 0x0D, 0xF6, 0x13, 0xF2, 0x12,
+0xF0, 0xF5, 0x10, 0xF5, 0x10, 0xF1, 0xF2, 0xEE, 0x13, 0xF3, 0x0D, 0xF2, 0xEE, 0x10, 0x12, 0x0F,
+0xEB, 0x0E, 0xF8, 0xF0, 0xF4, 0x08, 0xF4, 0xF7, 0x0E, 0x06, 0x11, 0x0C, 0xFA, 0x11, 0xF3, 0x11,
+0xF9, 0xEF, 0x0D, 0xF4, 0x09, 0xEE, 0xF1, 0xEE, 0x10, 0xF8, 0x10, 0xF4, 0xF0, 0x0D, 0x18, 0x0F,
+0xEF, 0x0C, 0xEE, 0xF9, 0xF1, 0x11, 0xEE, 0xF4, 0x0A, 0x03, 0x0E, 0x0F, 0xF7, 0x06, 0xF1, 0x0A,
+0xEF, 0xF4, 0x0D, 0xF0, 0x0F, 0xEF, 0xF4, 0xEE, 0x0F, 0xFE, 0x0D, 0xF4, 0xEE, 0x09, 0x0B, 0x0B,
+0xF4, 0x0E, 0xEF, 0xF4, 0xF5, 0x12, 0xF2, 0xF5, 0x0A, 0x0F, 0x0F, 0x11, 0xF6, 0x15, 0xF3, 0x10,
+0xF2, 0xF6, 0x10, 0xF3, 0x0C, 0xF9, 0xEF, 0xF5, 0x0F, 0xF3, 0x08, 0xF5, 0xEF, 0x10, 0x09, 0x0F,
+0xF4, 0x15, 0xF6, 0xF1, 0xF4, 0x14, 0xF1, 0xF4, 0x13, 0x05, 0x0A, 0x0A, 0xFB, 0x08, 0xF0, 0x0B,
+0xF3, 0xEF, 0x09, 0xF3, 0x0C, 0xF2, 0xED, 0xF5, 0x0E, 0xF7, 0x0D, 0xEA, 0xF6, 0x08, 0x14, 0x0D,
+0xF5, 0x0A, 0xF3, 0xEF, 0xF3, 0x0C, 0xF7, 0xF1, 0x0D, 0x0E, 0x0E, 0x10, 0xFB, 0x14, 0xF1, 0x11,
+0xF4, 0xF7, 0x12, 0xEC, 0x0D, 0xF0, 0xF0, 0xEE, 0x08, 0xF7, 0x0D, 0xF7, 0xF7, 0x09, 0x14, 0x0F,
+0xF3, 0x10, 0xF4, 0xF3, 0xF4, 0x0C, 0xEE, 0xF5, 0x0E, 0x08, 0x0B, 0x0E, 0xF0, 0x0F, 0xEB, 0x0C,
+0xF0, 0xF5, 0x0F, 0xF2, 0x0E, 0xF3, 0xF4, 0xF1, 0x0E, 0xF5, 0x0A, 0xF3, 0xF3, 0x09, 0x0C, 0x0C,
+0xF0, 0x0B, 0xEF, 0xF2, 0xF0, 0x0D, 0xF4, 0xED, 0x0C, 0x14, 0x0B, 0x0C, 0xF5, 0x14, 0xF0, 0x0C,
+0xF9, 0xF6, 0x11, 0xF3, 0x0F, 0xF0, 0xF3, 0xF2, 0x0E, 0xF5, 0x0B, 0xEF, 0xF4, 0x0C, 0x14, 0x13,
+0xED, 0x0A, 0xF1, 0xF7, 0xF1, 0x09, 0xF0, 0xF7, 0x0E, 0x0F, 0x11, 0x10, 0xF5, 0x0E, 0xEE, 0x0C,
+0xF7, 0xEE, 0x13, 0xF2, 0x07, 0xFA, 0xF3, 0xF1, 0x11, 0xF2, 0x0E, 0xF3, 0xEE, 0x0E, 0x0F, 0x11,
+0xF4, 0x0A, 0xF3, 0xF8, 0xEE, 0x0A, 0xEE, 0xF5, 0x0E, 0x02, 0x0A, 0x12, 0xF1, 0x0E, 0xF1, 0x0D,
+0xF7, 0xF7, 0x0F, 0xF1, 0x11, 0xF3, 0xED, 0xF8, 0x12, 0xF5, 0x0C, 0xF5, 0xF5, 0x0D, 0x0B, 0x0F,
+0xF1, 0x11, 0xF2, 0xF2, 0xF2, 0x0D, 0xF1, 0xF1, 0x08, 0x08, 0x10, 0x14, 0xF8, 0x0F, 0xEF, 0x11,
+0xFA, 0xF1, 0x0B, 0xEE, 0x0C, 0xF1, 0xEF, 0xF5, 0x0E, 0xFE, 0x0C, 0xF3, 0xE9, 0x0B, 0x0F, 0x0F,
+0xF1, 0x11, 0xF2, 0xF0, 0xF2, 0x0C, 0xF2, 0xF5, 0x11, 0x03, 0x0E, 0x10, 0xF4, 0x08, 0xEF, 0x09,
+0xF6, 0xF2, 0x10, 0xF4, 0x08, 0xF4, 0xF3, 0xF3, 0x06, 0xF4, 0x08, 0xF4, 0xF9, 0x05, 0x0B, 0x12,
+0xF4, 0x10, 0xF7, 0xEC, 0xED, 0x12, 0xEF, 0xF0, 0x0F, 0x05, 0x14, 0x0D, 0xEC, 0x04, 0xEB, 0x0B,
+0xF3, 0xEC, 0x11, 0xF4, 0x0E, 0xF3, 0xF7, 0xF2, 0x0E, 0xF7, 0x07, 0xF1, 0xF6, 0x0E, 0x0C, 0x0F,
+0xF3, 0x11, 0xF3, 0xF7, 0xF3, 0x15, 0xF3, 0xF6, 0x11, 0x08, 0x0D, 0x0E, 0xF2, 0x0D, 0xF3, 0x10,
+0xF1, 0xF2, 0x0D, 0xF9, 0x13, 0xF3, 0xF5, 0xF3, 0x0E, 0xF2, 0x0E, 0xF2, 0xF8, 0x0A, 0x0F, 0x0C,
+0xF0, 0x0B, 0xF5, 0xF5, 0xF2, 0x0B, 0xF7, 0xF1, 0x0D, 0x13, 0x11, 0x12, 0xF9, 0x11, 0xF4, 0x11,
+0xF8, 0xF3, 0x0E, 0xF5, 0x11, 0xF1, 0xFA, 0xF0, 0x09, 0xF2, 0x0D, 0xF3, 0xF6, 0x0C, 0x0E, 0x0E,
+0xF0, 0x0D, 0xF3, 0xF5, 0xED, 0x0E, 0xF2, 0xF4, 0x0D, 0x14, 0x0D, 0x0C, 0xF8, 0x1B, 0xF2, 0x10,
+0xF4, 0xF0, 0x0D, 0xF4, 0x0D, 0xF3, 0xF6, 0xF0, 0x10, 0xF5, 0x09, 0xF2, 0xF1, 0x0D, 0x14, 0x0E,
+0xF5, 0x0B, 0xF0, 0xF7, 0xF4, 0x0C, 0xF7, 0xF4, 0x0D, 0x13, 0x11, 0x0C, 0xF9, 0x13, 0xF2, 0x0D,
+0xF2, 0xF1, 0x0C, 0xF6, 0x0E, 0xF4, 0xF7, 0xEC, 0x0F, 0xF1, 0x0B, 0xF6, 0xF6, 0x0B, 0x0F, 0x0C,
+0xF0, 0x0D, 0xF4, 0xF4, 0xF5, 0x09, 0xF5, 0xF1, 0x0D, 0x14, 0x0E, 0x0D, 0xF5, 0x13, 0xF0, 0x0E,
+0xF3, 0xF2, 0x16, 0xF6, 0x0C, 0xEF, 0xF3, 0xEE, 0x0E, 0xF5, 0x0E, 0xF5, 0xED, 0x09, 0x10, 0x11,
+0xF7, 0x0F, 0xF8, 0xF8, 0xF0, 0x0A, 0xF9, 0xEE, 0x0E, 0x03, 0x0D, 0x13, 0xF7, 0x13, 0xEF, 0x0E,
+0xEA, 0xEB, 0x09, 0xEE, 0x10, 0xEB, 0xEE, 0xED, 0x0B, 0xF4, 0x0E, 0xF4, 0xEF, 0x08, 0x09, 0x15,
+0xF7, 0x0A, 0xF7, 0xEF, 0xF2, 0x0A, 0xF4, 0xF8, 0x08, 0x05, 0x08, 0x0C, 0xF4, 0x0F, 0xF3, 0x0F,
+0xF4, 0xF5, 0x10, 0xF0, 0x0E, 0xF1, 0xF3, 0xEA, 0x0D, 0xF5, 0x12, 0xF9, 0xF1, 0x0A, 0x09, 0x0D,
+0xF3, 0x13, 0xF6, 0xF3, 0xF3, 0x0D, 0xF0, 0xF3, 0x06, 0x06, 0x0C, 0x0C, 0xE3, 0x10, 0xF5, 0x0F,
+0xF2, 0xF2, 0x0C, 0xF4, 0x0F, 0xF6, 0xEC, 0xF6, 0x0C, 0xF2, 0x0F, 0xF6, 0xEE, 0x12, 0x0D, 0x0A,
+0xF5, 0x0D, 0xEA, 0xF4, 0xF4, 0x0C, 0xF1, 0xF3, 0x0D, 0x10, 0x0D, 0x0D, 0xF1, 0x0A, 0xF0, 0x09,
+0xF2, 0xF1, 0x0B, 0xF1, 0x0F, 0xF6, 0xF7, 0xF2, 0x0C, 0xF3, 0x0A, 0xF2, 0xF1, 0x0E, 0x0C, 0x0C,
+0xF1, 0x0D, 0xEE, 0xF3, 0xF2, 0x0E, 0xF3, 0xF4, 0x11, 0x11, 0x0D, 0x0F, 0xF7, 0x05, 0xF4, 0x0E,
+0xF6, 0xF4, 0x0B, 0xF4, 0x12, 0xF5, 0xF2, 0xF1, 0x10, 0xF5, 0x0D, 0xF5, 0xEE, 0x0F, 0x09, 0x0F,
+0xF5, 0x12, 0xF4, 0xF6, 0xEE, 0x11, 0xF5, 0xEE, 0x0E, 0x08, 0x0C, 0x0F, 0xFB, 0x0F, 0xF3, 0x13,
+0xF4, 0xF0, 0x10, 0xF8, 0x0E, 0xF7, 0xF5, 0xEF, 0x10, 0xF4, 0x13, 0xF3, 0xF5, 0x0B, 0x0C, 0x0D,
+0xF5, 0x11, 0xEF, 0xF1, 0xF0, 0x10, 0xF5, 0xF8, 0x0C, 0x0F, 0x0A, 0x0B, 0xF1, 0x14, 0xF1, 0x0D,
+0xF2, 0xF6, 0x0B, 0xEE, 0x0A, 0xF3, 0xF5, 0xEF, 0x08, 0xF4, 0x13, 0xF2, 0xF4, 0x0D, 0x0C, 0x10,
+0xF1, 0x0E, 0xF8, 0xF1, 0xF1, 0x0E, 0xF8, 0xF0, 0x0B, 0x11, 0x0C, 0x0B, 0xFA, 0x11, 0xED, 0x11,
+0xF4, 0xF4, 0x0F, 0xF3, 0x0E, 0xF2, 0xF1, 0xF6, 0x0A, 0xF1, 0x0B, 0xF6, 0xF8, 0x0A, 0x13, 0x0C,
+0xF3, 0x13, 0xF2, 0xF0, 0xEF, 0x0F, 0xF2, 0xF3, 0x0F, 0x0B, 0x10, 0x11, 0xF3, 0x11, 0xF0, 0x0F,
+0xF5, 0xF0, 0x0C, 0xF4, 0x09, 0xF0, 0xED, 0xF1, 0x0A, 0xF6, 0x11, 0xEF, 0xF0, 0x02, 0x15, 0x08,
+0xF6, 0x15, 0xF8, 0xF6, 0xF0, 0x11, 0xF6, 0xF2, 0x09, 0x05, 0x14, 0x08, 0xEE, 0x05, 0xED, 0x0E,
+0xF5, 0xF4, 0x11, 0xF1, 0x0E, 0xF5, 0xF3, 0xF3, 0x06, 0xF1, 0x0D, 0xF4, 0xF6, 0x08, 0x14, 0x0E,
+0xF0, 0x14, 0xF1, 0xEF, 0xF2, 0x0F, 0xF0, 0xF2, 0x0F, 0x07, 0x0C, 0x0D, 0xF4, 0x11, 0xF4, 0x0F,
+0xF5, 0xF8, 0x0F, 0xEB, 0x09, 0xF3, 0xEE, 0xF0, 0x08, 0xF3, 0x0B, 0xF6, 0xEF, 0x0E, 0x17, 0x11,
+0xEF, 0x0F, 0xF6, 0xF0, 0xF6, 0x0B, 0xF7, 0xEC, 0x08, 0x03, 0x0D, 0x0D, 0xEF, 0x07, 0xEC, 0x0E,
+0xF2, 0xF5, 0x09, 0xF5, 0x0D, 0xF0, 0xEF, 0xF1, 0x12, 0xF3, 0x10, 0xF2, 0xED, 0x0D, 0x0A, 0x0D,
+0xF2, 0x0D, 0xF7, 0xEF, 0xF1, 0x0A, 0xF7, 0xF2, 0x0D, 0x0D, 0x10, 0x0D, 0xF2, 0x0B, 0xF5, 0x10,
+0xF1, 0xF3, 0x0E, 0xF7, 0x14, 0xF4, 0xF4, 0xF7, 0x0D, 0xEF, 0x0C, 0xF6, 0xEC, 0x0C, 0x0B, 0x0F,
+0xF0, 0x09, 0xF1, 0xF5, 0xF3, 0x11, 0xF6, 0xF8, 0x0B, 0x14, 0x0D, 0x0F, 0xF8, 0x09, 0xF4, 0x16,
+0xF3, 0xF8, 0x0C, 0xF4, 0x0A, 0xEF, 0xF0, 0xF0, 0x0C, 0xF1, 0x0E, 0xF4, 0xF0, 0x0D, 0x10, 0x0C,
+0xF8, 0x13, 0xF6, 0xF1, 0xF6, 0x13, 0xF6, 0xF2, 0x0F, 0x11, 0x0F, 0x09, 0xF7, 0x04, 0xF0, 0x0E,
+0xF2, 0xF7, 0x0A, 0xEF, 0x0F, 0xF1, 0xEF, 0xF0, 0x0E, 0xF0, 0x0D, 0xF3, 0xFB, 0x0B, 0x08, 0x0F,
+0xF3, 0x11, 0xF9, 0xEB, 0xF0, 0x09, 0xF4, 0xF1, 0x10, 0x0D, 0x0C, 0x0C, 0xF7, 0x11, 0xF0, 0x14,
+0xF5, 0xF4, 0x13, 0xF1, 0x0C, 0xF2, 0xF0, 0xF6, 0x0B, 0xF3, 0x0D, 0xF2, 0xF0, 0x0E, 0x13, 0x0D,
+0xF6, 0x11, 0xF3, 0xF1, 0xF3, 0x0E, 0xF8, 0xEF, 0x0B, 0x0A, 0x0B, 0x0B, 0xF5, 0x12, 0xF4, 0x12,
+0xF6, 0xF5, 0x0C, 0xF8, 0x0F, 0xF0, 0xF3, 0xF0, 0x14, 0xF3, 0x0B, 0xF1, 0xEF, 0x08, 0x14, 0x10,
+0xF5, 0x0A, 0xF1, 0xF3, 0xF6, 0x09, 0xF5, 0xF7, 0x10, 0x0C, 0x10, 0x12, 0xF7, 0x07, 0xEB, 0x0F,
+0xF7, 0xF3, 0x09, 0xF3, 0x0D, 0xEB, 0xF0, 0xEE, 0x0A, 0xF6, 0x09, 0xF5, 0xF5, 0x0D, 0x0C, 0x11,
+0xEF, 0x0E, 0xF9, 0xF1, 0xEE, 0x0E, 0xFA, 0xEF, 0x10, 0x0C, 0x0A, 0x0D, 0xF9, 0x0C, 0xF4, 0x0C,
+0xF2, 0xF1, 0x0C, 0xF2, 0x0D, 0xF3, 0xF1, 0xEE, 0x0C, 0xEF, 0x0C, 0xF1, 0xF5, 0x06, 0x10, 0x0F,
+0xF7, 0x0F, 0xF4, 0xF4, 0xED, 0x11, 0xF1, 0xF3, 0x0C, 0x11, 0x0A, 0x12, 0xF7, 0x0D, 0xED, 0x0B,
+0xF5, 0xF1, 0x0F, 0xF4, 0x0F, 0xF0, 0xEE, 0xF0, 0x0D, 0xF0, 0x0F, 0xFB, 0xF6, 0x0C, 0x11, 0x10,
+0xF5, 0x13, 0xF6, 0xF3, 0xF1, 0x11, 0xF0, 0xF2, 0x0C, 0x0D, 0x0C, 0x0E, 0xF8, 0x03, 0xF7, 0x0A,
+0xF7, 0xF1, 0x0F, 0xF0, 0x12, 0xFB, 0xF6, 0xF2, 0x0C, 0xF2, 0x0E, 0xF6, 0xF4, 0x0F, 0x11, 0x0F,
+0xF7, 0x0A, 0xF6, 0xF4, 0xF0, 0x08, 0xED, 0xF5, 0x0E, 0x19, 0x0E, 0x10, 0xF3, 0x13, 0xF8, 0x14,
+0xF2, 0xF3, 0x0E, 0xF3, 0x0F, 0xEF, 0xF1, 0xF5, 0x0E, 0xF7, 0x11, 0xF6, 0xF2, 0x0E, 0x14, 0x0C,
+0xF2, 0x0D, 0xF4, 0xF0, 0xF4, 0x0D, 0xF4, 0xEE, 0x09, 0x0E, 0x09, 0x0B, 0xF7, 0x12, 0xF2, 0x11,
+0xEF, 0xF3, 0x0C, 0xF1, 0x0A, 0xF0, 0xEB, 0xF6, 0x09, 0xF5, 0x0E, 0xF4, 0xF1, 0x09, 0x0E, 0x0F,
+0xF7, 0x0F, 0xF4, 0xF4, 0xF5, 0x0C, 0xED, 0xF5, 0x0D, 0x11, 0x11, 0x0F, 0xF0, 0x10, 0xF3, 0x0F,
+0xF2, 0xF4, 0x11, 0xEB, 0x0C, 0xED, 0xF2, 0xED, 0x0A, 0xF4, 0x08, 0xF4, 0xF4, 0x0D, 0x0E, 0x0F,
+0xF2, 0x0E, 0xF2, 0xF3, 0xF2, 0x0E, 0xED, 0xF1, 0x0F, 0x0C, 0x0D, 0x11, 0xFA, 0x06, 0xF6, 0x09,
+0xF6, 0xF5, 0x0A, 0xF0, 0x14, 0xF6, 0xF2, 0xF6, 0x12, 0xEA, 0x0C, 0xF5, 0xF6, 0x0F, 0x0A, 0x0D,
+0xF0, 0x10, 0xF8, 0xF8, 0xEF, 0x0D, 0xF5, 0xF3, 0x06, 0x0F, 0x08, 0x0C, 0xEE, 0x0B, 0xF6, 0x0B,
+0xF5, 0xF6, 0x0D, 0xF8, 0x0A, 0xF7, 0xF3, 0xEC, 0x0E, 0xF7, 0x13, 0xF5, 0xF3, 0x08, 0x0C, 0x0B,
+0xED, 0x12, 0xF6, 0xF4, 0xF8, 0x0D, 0xF2, 0xEC, 0x0C, 0x0B, 0x0A, 0x14, 0xF2, 0x10, 0xF0, 0x0C,
+0xF5, 0xF0, 0x0E, 0xEE, 0x11, 0xEE, 0xF2, 0xF5, 0x08, 0xED, 0x13, 0xFB, 0xF6, 0x0B, 0x10, 0x0D,
+0xF7, 0x0C, 0xF1, 0xF5, 0xF6, 0x10, 0xEF, 0xF4, 0x0C, 0x0D, 0x0C, 0x10, 0xEF, 0x0E, 0xF3, 0x0E,
+0xF6, 0xF0, 0x0E, 0xED, 0x0D, 0xF1, 0xF0, 0xF0, 0x09, 0xF4, 0x0E, 0xF8, 0xF4, 0x0E, 0x16, 0x0F,
+0xEF, 0x0B, 0xF8, 0xEE, 0xF3, 0x0F, 0xF1, 0xF2, 0x0D, 0x0C, 0x0C, 0x0D, 0xEF, 0x10, 0xF2, 0x10,
+0xF5, 0xF4, 0x0F, 0xEF, 0x08, 0xEE, 0xF0, 0xF2, 0x0A, 0xFB, 0x11, 0xF9, 0xF1, 0x0B, 0x0D, 0x10,
+0xF0, 0x12, 0xEF, 0xF5, 0xF7, 0x0A, 0xED, 0xED, 0x0B, 0x01, 0x0B, 0x08, 0xEB, 0x05, 0xF0, 0x11,
+0xF7, 0xF5, 0x0B, 0xF0, 0x12, 0xF2, 0xEE, 0xF1, 0x0A, 0xF1, 0x08, 0xF2, 0xF8, 0x09, 0x14, 0x0A,
+0xF4, 0x11, 0xF4, 0xF1, 0xF3, 0x0C, 0xEF, 0xF0, 0x0A, 0x0B, 0x0B, 0x0C, 0xF6, 0x1C, 0xF8, 0x11,
+0xF8, 0xEC, 0x10, 0xEF, 0x0D, 0xF1, 0xEC, 0xF3, 0x0D, 0xF0, 0x0F, 0xF3, 0xF4, 0x06, 0x14, 0x0E,
+0xF6, 0x0D, 0xF6, 0xF2, 0xF0, 0x0B, 0xF6, 0xF5, 0x10, 0x0C, 0x13, 0x13, 0xF0, 0x10, 0xF6, 0x0C,
+0xF4, 0xF2, 0x13, 0xF0, 0x0C, 0xF8, 0xF7, 0xF3, 0x0F, 0xF8, 0x0C, 0xF9, 0xF3, 0x0F, 0x08, 0x0F,
+0xF2, 0x10, 0xF0, 0xF0, 0xF3, 0x0E, 0xED, 0xED, 0x10, 0x05, 0x09, 0x0F, 0xEF, 0x0E, 0xF1, 0x0D,
+0xEE, 0xEE, 0x0B, 0xF4, 0x15, 0xF7, 0xEE, 0xEE, 0x12, 0xEB, 0x10, 0xF1, 0xF7, 0x0A, 0x0C, 0x15,
+0xED, 0x15, 0xF4, 0xEA, 0xF5, 0x0B, 0xEA, 0xF2, 0x0E, 0x12, 0x09, 0x11, 0xF6, 0x0C, 0xF7, 0x0A,
+0xF6, 0xF6, 0x0E, 0xF8, 0x0B, 0xF9, 0xEC, 0xF1, 0x0A, 0xF2, 0x0F, 0xF0, 0xF6, 0x09, 0x13, 0x0B,
+0xEC, 0x0E, 0xF5, 0xEF, 0xF2, 0x0F, 0xF8, 0xF4, 0x0E, 0x07, 0x0E, 0x0C, 0xF1, 0x07, 0xF5, 0x11,
+0xF5, 0xF3, 0x10, 0xF6, 0x0E, 0xF1, 0xF3, 0xF3, 0x09, 0xF5, 0x0E, 0xF1, 0xED, 0x04, 0x11, 0x11,
+0xF4, 0x0A, 0xF7, 0xF6, 0xF2, 0x0D, 0xF9, 0xF1, 0x0A, 0x04, 0x0C, 0x0D, 0xF4, 0x05, 0xF5, 0x0D,
+0xF6, 0xF1, 0x0E, 0xF3, 0x0D, 0xEE, 0xF2, 0xEC, 0x05, 0xF9, 0x11, 0xF1, 0xF6, 0x06, 0x12, 0x10,
+0xEF, 0x0D, 0xF9, 0xEF, 0xF0, 0x09, 0xF1, 0xF6, 0x11, 0x0B, 0x0D, 0x0B, 0xF4, 0x08, 0xF3, 0x0A,
+0xF7, 0xF8, 0x0E, 0xF0, 0x0A, 0xF5, 0xF5, 0xF2, 0x0B, 0xF7, 0x14, 0xF7, 0xEE, 0x08, 0x0D, 0x14,
+0xF6, 0x11, 0xF3, 0xF0, 0xF4, 0x0F, 0xF5, 0xF4, 0x0C, 0x04, 0x10, 0x0B, 0xEE, 0x09, 0xF6, 0x0F,
+0xF0, 0xEE, 0x0A, 0xED, 0x08, 0xF0, 0xF0, 0xF2, 0x0A, 0xF3, 0x07, 0xF9, 0xF4, 0x08, 0x0E, 0x0F,
+0xF4, 0x08, 0xF7, 0xF6, 0xEF, 0x12, 0xF6, 0xF3, 0x0B, 0x04, 0x15, 0x0C, 0xF2, 0x06, 0xF1, 0x0E,
+0xF9, 0xF1, 0x0B, 0xF2, 0x11, 0xEB, 0xF1, 0xF2, 0x0B, 0xF7, 0x09, 0xFA, 0xF7, 0x0A, 0x10, 0x0F,
+0xEE, 0x12, 0xF1, 0xF7, 0xF3, 0x0B, 0xF1, 0xF2, 0x0A, 0x06, 0x12, 0x0F, 0xF4, 0x09, 0xEE, 0x0C,
+0xF5, 0xFC, 0x0B, 0xFB, 0x0B, 0xF4, 0xF7, 0xF3, 0x0D, 0xF7, 0x06, 0xFA, 0xF7, 0x0B, 0x07, 0x04,
+0xF5, 0x0C, 0xFC, 0xFD, 0xFE, 0x0D, 0xF7, 0xFB, 0x0D, 0x07, 0x0B, 0x06, 0xFA, 0xFF, 0xFE, 0x0E,
+0xF6, 0xF4, 0x0A, 0xF4, 0x0D, 0xEE, 0xF0, 0xF4, 0x12, 0xF7, 0x0B, 0xF0, 0xF8, 0x0A, 0x14, 0x0C,
+0xF8, 0x13, 0xEB, 0xF4, 0xF4, 0x0B, 0xF3, 0xEE, 0x07, 0x10, 0x0D, 0x10, 0xF7, 0x07, 0xF4, 0x0A,
+0x01, 0xFA, 0x03, 0xFB, 0xFB, 0x03, 0x06, 0x06, 0xFB, 0xFE, 0x06, 0xFD, 0x04, 0x04, 0xFD, 0xFD,
+0x03, 0x03, 0xFA, 0xFE, 0xFD, 0x03, 0x02, 0x02, 0x01, 0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0xFC, 0xFF,
+0xFA, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0x03, 0x00, 0x04, 0xFF, 0xFF, 0x04, 0x05, 0xFC, 0xFE, 0xFD,
+0x05, 0xFD, 0x05, 0x02, 0x01, 0xFF, 0x01, 0xFB, 0xFA, 0x01, 0x02, 0xFC, 0x04, 0x02, 0x00, 0xFE,
+0x06, 0x02, 0x03, 0xFB, 0xFE, 0xFD, 0x02, 0xFE, 0xFA, 0xFC, 0x03, 0xFD, 0x00, 0xFB, 0xFD, 0xFA,
+0xFC, 0x00, 0x03, 0x01, 0xFC, 0x02, 0x04, 0xFB, 0xFC, 0xFB, 0x02, 0x03, 0x04, 0xFD, 0xFA, 0xFD,
+0xFE, 0x00, 0xFF, 0xFE, 0x05, 0xFE, 0xFD, 0xFF, 0xFD, 0xFD, 0xFE, 0x01, 0x03, 0xFB, 0x06, 0x01,
+0x00, 0xFC, 0x06, 0xFB, 0xFB, 0xFF, 0xFC, 0xFD, 0xFF, 0x02, 0x03, 0xFC, 0xFC, 0x02, 0x01, 0x04,
+0xFB, 0x03, 0x03, 0xFF, 0xFD, 0x05, 0xFB, 0x06, 0xFB, 0xFD, 0x04, 0x00, 0x01, 0xFD, 0x04, 0x04,
+0xFD, 0xFD, 0xFC, 0x01, 0x05, 0x02, 0xFA, 0x02, 0xFE, 0xFC, 0xFF, 0x03, 0x03, 0x06, 0x01, 0xFC,
+0x04, 0x03, 0xFF, 0x04, 0xFD, 0xFF, 0x06, 0xFA, 0x02, 0x06, 0x03, 0xFD, 0x05, 0xFC, 0xFF, 0xFC,
+0xFF, 0xFA, 0x02, 0xFF, 0x01, 0x06, 0xFB, 0x02, 0x02, 0x05, 0xFC, 0x04, 0xFB, 0xFC, 0x04, 0xFC,
+0x02, 0x01, 0x03, 0x02, 0xFD, 0xFF, 0xFD, 0x05, 0xFC, 0xFE, 0xFC, 0xFB, 0xFE, 0x01, 0x03, 0x00,
+0xFB, 0x05, 0xFF, 0xFB, 0x02, 0x04, 0xFD, 0x03, 0x00, 0xFD, 0x00, 0xFA, 0xFC, 0xFC, 0x02, 0x01,
+0x00, 0x00, 0x00, 0x01, 0xFD, 0xFB, 0xFE, 0x00, 0x05, 0xFA, 0x02, 0x03, 0x04, 0xFC, 0xFE, 0x01,
+0x03, 0xFF, 0xFF, 0x02, 0x03, 0xFD, 0x02, 0xFF, 0x05, 0xFB, 0x01, 0x02, 0x04, 0x05, 0xFC, 0xFD,
+0x03, 0x02, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0xFF, 0xFD,
+0xFF, 0xFC, 0xFF, 0x00, 0xFF, 0x00, 0x06, 0x03, 0xFD, 0x01, 0xFD, 0x01, 0x00, 0xEF, 0x06, 0x01,
+0x03, 0xFF, 0xFD, 0x04, 0xFF, 0x03, 0x03, 0x01, 0xFD, 0x05, 0x00, 0x02, 0x01, 0xFE, 0xFD, 0x00,
+0x02, 0x02, 0x00, 0x01, 0xFF, 0xFE, 0x03, 0x00, 0xFC, 0xFD, 0xFF, 0x01, 0xFE, 0x06, 0x05, 0x02,
+0x00, 0x02, 0xFF, 0x05, 0xFE, 0x01, 0x03, 0xFF, 0xFE, 0x04, 0x00, 0x03, 0x00, 0xFD, 0x02, 0x01,
+0x02, 0x00, 0xFF, 0x01, 0x02, 0xFD, 0x01, 0x01, 0xFD, 0xF6, 0x00, 0x00, 0x03, 0xF4, 0xFE, 0x06,
+0x00, 0x00, 0xFB, 0x04, 0xFD, 0x00, 0xFF, 0x03, 0xFC, 0xF7, 0xFA, 0xFF, 0x00, 0xFF, 0xFA, 0xFD,
+0xFE, 0xFE, 0xFC, 0x03, 0x04, 0x03, 0x05, 0xFE, 0xFF, 0x04, 0xFD, 0xFD, 0x06, 0xF1, 0x08, 0xF9,
+0x04, 0x01, 0xFD, 0x01, 0x00, 0xFE, 0xFC, 0x01, 0xFD, 0xFB, 0xFD, 0x02, 0x07, 0xFD, 0x02, 0xFE,
+0x02, 0xFD, 0x02, 0x00, 0x02, 0xFE, 0x00, 0x05, 0xFF, 0xFC, 0xFF, 0xFD, 0x06, 0xF0, 0xFD, 0xFD,
+0x02, 0x03, 0x02, 0x01, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0x01, 0xFE, 0x02, 0x02, 0xFC, 0x01, 0xFF,
+0xFF, 0xFD, 0x01, 0x03, 0x00, 0xFD, 0x02, 0x00, 0xFE, 0xF8, 0xFE, 0xFF, 0x02, 0xF1, 0x02, 0x02,
+0x01, 0x02, 0xFF, 0x01, 0xFB, 0x03, 0xFE, 0x02, 0xFC, 0x00, 0xFF, 0x05, 0x01, 0xFC, 0xFF, 0xFF,
+0x00, 0x02, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0xFF, 0xFE, 0x00, 0xF7, 0x05, 0x01,
+0x00, 0x04, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0x02, 0x00, 0x03, 0xFC, 0x02, 0x01, 0xFE, 0xFB, 0xFF,
+0xFF, 0xFF, 0x03, 0x01, 0xFE, 0xFE, 0x00, 0x04, 0xFF, 0xFB, 0xFF, 0x00, 0xFF, 0xED, 0x00, 0xFE,
+0x02, 0x00, 0xFE, 0x01, 0xFF, 0x04, 0xFF, 0x00, 0xFF, 0x02, 0xFE, 0x02, 0x00, 0xFC, 0xFD, 0xFB,
+0xFF, 0x02, 0x01, 0x00, 0xFE, 0xFD, 0xFF, 0x00, 0xFD, 0xFB, 0xFD, 0xFE, 0x04, 0xED, 0x03, 0xFF,
+0x01, 0x00, 0xFF, 0x03, 0xFD, 0x01, 0x00, 0x04, 0xFD, 0x00, 0x02, 0x01, 0x00, 0xFE, 0xFD, 0x01,
+0xFE, 0x01, 0x08, 0xFF, 0x02, 0xFC, 0x00, 0xFF, 0xFD, 0x00, 0x02, 0xFD, 0x06, 0xED, 0x01, 0xFE,
+0xFD, 0x02, 0xFF, 0x06, 0xFB, 0xFC, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x03, 0x04, 0xF8, 0x01, 0xFF,
+0xFF, 0xFF, 0xFD, 0x03, 0x04, 0xFE, 0x02, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x04, 0xE9, 0x05, 0x05,
+0x07, 0x05, 0xFF, 0x00, 0x04, 0x01, 0x04, 0x03, 0x04, 0x01, 0xFF, 0x03, 0x06, 0x02, 0xFF, 0xFC,
+0x00, 0x02, 0x05, 0xFE, 0x01, 0xFF, 0x04, 0x05, 0xFC, 0x03, 0xFF, 0xFE, 0x02, 0xF1, 0x00, 0x03,
+0xFB, 0x05, 0xFF, 0xFE, 0xFE, 0x02, 0xFF, 0x05, 0x00, 0x00, 0xFB, 0x05, 0xFF, 0xFB, 0xFC, 0xFE,
+0x00, 0xFF, 0xFF, 0x01, 0x06, 0xFE, 0x05, 0x04, 0x01, 0x00, 0x02, 0xFA, 0x01, 0xE2, 0xFE, 0x03,
+0x01, 0x04, 0x01, 0x01, 0xFC, 0x04, 0x01, 0xFE, 0x00, 0x04, 0xFE, 0x03, 0x05, 0x01, 0xFF, 0xFF,
+0x03, 0xFF, 0x05, 0x02, 0x00, 0x01, 0xFF, 0x01, 0xFC, 0xFC, 0x00, 0x01, 0x03, 0xE8, 0xFF, 0x02,
+0x03, 0x00, 0x01, 0x03, 0xFE, 0xFE, 0x04, 0x01, 0x00, 0x02, 0xFA, 0x01, 0x06, 0xFF, 0xFF, 0x00,
+0xFC, 0x02, 0x05, 0x05, 0x00, 0x00, 0x03, 0x0A, 0x02, 0xFE, 0x00, 0x01, 0xFE, 0xED, 0xFE, 0xFD,
+0x00, 0x04, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x02, 0xFF, 0x04, 0x01, 0x01, 0xFD, 0x00, 0xFF, 0xFF,
+0x03, 0xFF, 0x03, 0x03, 0x01, 0x00, 0x02, 0x01, 0xFC, 0xF7, 0xFF, 0xFE, 0x00, 0xEF, 0x01, 0xFF,
+0xFF, 0x01, 0x00, 0x02, 0xFD, 0x04, 0x04, 0x00, 0xFC, 0x02, 0xFE, 0x00, 0xFE, 0xFC, 0xFF, 0x00,
+0xFF, 0xFD, 0x01, 0x02, 0x01, 0xFE, 0x01, 0xFF, 0xFE, 0xFC, 0xFE, 0xFD, 0x03, 0xFF, 0x01, 0xFC,
+0x03, 0xFB, 0x00, 0x04, 0xFF, 0x03, 0x02, 0x02, 0xFD, 0x03, 0xFF, 0x01, 0x00, 0xF9, 0xFF, 0xFB,
+0xFF, 0x02, 0x04, 0x02, 0x02, 0xFC, 0x00, 0xFE, 0xFE, 0xFB, 0x00, 0x00, 0x02, 0xEA, 0x03, 0x03,
+0x01, 0x02, 0xFC, 0xFF, 0x01, 0x05, 0x02, 0xFF, 0x01, 0x02, 0xFC, 0x04, 0x01, 0xFE, 0xFF, 0xFF,
+0xFD, 0xFC, 0xFF, 0x01, 0xFE, 0xFE, 0x05, 0x07, 0x00, 0xFA, 0x00, 0xFF, 0x02, 0xF2, 0x03, 0x03,
+0x04, 0xFE, 0xFF, 0x05, 0xFE, 0x03, 0xFF, 0xFE, 0xFB, 0x07, 0xFF, 0x00, 0x01, 0xFA, 0xFC, 0xFF,
+0x05, 0x04, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0xFA, 0xFD, 0x01, 0x00, 0xEE, 0xFE, 0xFB,
+0x03, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x02, 0xFC, 0x06, 0x01, 0xFD, 0x02, 0x02,
+0x00, 0x00, 0x02, 0x04, 0x03, 0xFD, 0x03, 0x00, 0xFC, 0xFA, 0xFC, 0xFC, 0x01, 0xF3, 0xFD, 0x01,
+0x04, 0xFE, 0xFF, 0xFF, 0xFD, 0x03, 0x01, 0x02, 0xFE, 0x04, 0xFD, 0x05, 0x01, 0xFD, 0xFF, 0x02,
+0xFE, 0xFD, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0xFC, 0xFA, 0x03, 0xFE, 0x05, 0xDA, 0xFF, 0x03,
+0xFF, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x04, 0xFA, 0x04, 0x01, 0x03, 0x02, 0xFD, 0x00, 0xFD,
+0x03, 0x00, 0x02, 0x03, 0x01, 0x00, 0x00, 0x02, 0xFC, 0xFC, 0xFD, 0xFF, 0x05, 0xE2, 0x01, 0xFF,
+0x00, 0x06, 0x01, 0x00, 0xFD, 0xFF, 0x02, 0x04, 0xFF, 0x03, 0x00, 0x01, 0x03, 0xFE, 0x00, 0xFE,
+0x02, 0xFF, 0x05, 0x02, 0x03, 0x01, 0x00, 0x01, 0xFF, 0xFA, 0xFD, 0xFF, 0x04, 0xEB, 0xFF, 0x01,
+0x01, 0x05, 0x00, 0x06, 0xFE, 0xFE, 0x04, 0x01, 0xFF, 0x03, 0x02, 0x02, 0x01, 0xFE, 0x02, 0xFF,
+0x02, 0x00, 0x00, 0x02, 0x00, 0xFE, 0xFD, 0x06, 0xFD, 0xFB, 0xFF, 0x02, 0x02, 0xDF, 0x03, 0xF8,
+0x06, 0x00, 0xFD, 0x08, 0x00, 0x03, 0x04, 0x02, 0xFD, 0x03, 0x01, 0x04, 0x04, 0xFC, 0x01, 0xFD,
+0xFF, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0x02, 0x03, 0x01, 0xFB, 0x02, 0x03, 0x04, 0xEF, 0x01, 0x02,
+0x04, 0x02, 0x02, 0x03, 0xFD, 0xFD, 0x05, 0x01, 0xFE, 0x06, 0xFE, 0x06, 0x00, 0xFE, 0x04, 0x01,
+0x00, 0x00, 0x02, 0x01, 0x03, 0x01, 0x03, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x08, 0xF5, 0x03, 0x01,
+0xFF, 0x02, 0xFD, 0x04, 0xFE, 0x03, 0x04, 0x01, 0xFD, 0x06, 0x01, 0x02, 0x01, 0xFD, 0x00, 0xFF,
+0xFF, 0x02, 0x03, 0x00, 0x02, 0xFC, 0x02, 0x00, 0xFC, 0xFD, 0xFD, 0xFD, 0x04, 0xEF, 0x02, 0xFD,
+0x03, 0x03, 0xFE, 0xFE, 0xFA, 0x02, 0x00, 0x02, 0xFC, 0x03, 0x00, 0x03, 0x01, 0xFE, 0xFC, 0xFF,
+0xFF, 0xFF, 0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0xFC, 0xFD, 0xFF, 0xFF, 0x07, 0xF0, 0x00, 0xFD,
+0x07, 0x03, 0x04, 0x02, 0xFF, 0x03, 0xFD, 0xFF, 0xFF, 0x04, 0x00, 0x01, 0x03, 0xFD, 0x01, 0xF8,
+0x02, 0x00, 0xFE, 0x05, 0x03, 0xFE, 0xFF, 0xFF, 0xF9, 0xFA, 0x03, 0x03, 0x07, 0xF2, 0x02, 0xFB,
+0xFE, 0x05, 0xFE, 0x05, 0xFC, 0xFF, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0x04, 0xFE, 0x00, 0x01,
+0xFF, 0xFE, 0x02, 0x00, 0xFE, 0xFD, 0x01, 0x08, 0xFC, 0xFB, 0x02, 0x00, 0x01, 0xEC, 0xFF, 0xFD,
+0x03, 0x01, 0xFF, 0x00, 0x00, 0x02, 0x01, 0x01, 0x00, 0x02, 0x00, 0x03, 0x04, 0xFE, 0xFC, 0x02,
+0x03, 0xFE, 0x03, 0x02, 0xFE, 0x03, 0x02, 0x02, 0xFC, 0xF7, 0x00, 0xFD, 0x02, 0xE0, 0x03, 0xFE,
+0x01, 0x00, 0xFD, 0x05, 0x00, 0x01, 0x02, 0x00, 0xFA, 0x06, 0x02, 0x02, 0x05, 0xFE, 0xFF, 0x00,
+0xFF, 0xFD, 0xFF, 0xFD, 0x02, 0xFA, 0x01, 0x02, 0xFD, 0xFB, 0x01, 0xFE, 0x05, 0xF3, 0x0B, 0xFD,
+0x00, 0x03, 0xFE, 0x04, 0x00, 0x02, 0x05, 0x02, 0xFD, 0x07, 0x02, 0x02, 0x07, 0xFB, 0xFF, 0xFD,
+0xFE, 0x01, 0xFF, 0x02, 0x05, 0x00, 0x02, 0x03, 0xFA, 0xF7, 0x00, 0x00, 0xFC, 0xF1, 0x03, 0xFA,
+0x08, 0x06, 0xFE, 0xFF, 0x00, 0xFF, 0x01, 0x06, 0xFE, 0x00, 0xFA, 0x05, 0x06, 0xFB, 0xFF, 0xFF,
+0xFD, 0xFC, 0x01, 0x04, 0x04, 0x03, 0x05, 0x05, 0xFE, 0xF9, 0xFF, 0x02, 0x02, 0xF8, 0x01, 0x03,
+0x02, 0x02, 0xF7, 0x02, 0x03, 0x07, 0xFF, 0x06, 0x00, 0x02, 0xF9, 0xFF, 0x03, 0xFF, 0xF8, 0x02,
+0x02, 0xFF, 0x06, 0x03, 0x02, 0xFA, 0x05, 0x03, 0xFF, 0x02, 0xFD, 0xFF, 0x01, 0xF2, 0x02, 0x01,
+0x06, 0x05, 0xFA, 0x03, 0x01, 0xFE, 0x08, 0x01, 0x01, 0x03, 0x00, 0x03, 0x05, 0xFD, 0xFD, 0x01,
+0xFE, 0x00, 0x03, 0x03, 0x00, 0xFC, 0x01, 0x02, 0xFC, 0x00, 0xFB, 0xFD, 0x00, 0xF9, 0x01, 0xFD,
+0x02, 0xFD, 0x00, 0x09, 0xFE, 0x02, 0x06, 0x02, 0x00, 0x03, 0xFD, 0x03, 0x03, 0xFB, 0xFF, 0x01,
+0xFD, 0xFA, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x02, 0xFD, 0xFA, 0xFD, 0x00, 0x06, 0xEC, 0x07, 0xFF,
+0x03, 0x04, 0xFA, 0x0E, 0xFF, 0x02, 0x01, 0x04, 0x02, 0x03, 0xFE, 0x04, 0x00, 0xF9, 0x00, 0x04,
+0xFD, 0xFA, 0x00, 0x00, 0x03, 0xFC, 0xFD, 0x04, 0xFD, 0xFA, 0x02, 0xFD, 0x02, 0xF4, 0x05, 0x03,
+0x03, 0xFE, 0xFF, 0x06, 0xFA, 0xFE, 0x03, 0x00, 0xFC, 0x02, 0x02, 0xFF, 0x02, 0x01, 0xFF, 0x00,
+0x05, 0xFF, 0x05, 0xFF, 0x06, 0x05, 0x05, 0x08, 0xFC, 0xFC, 0xFB, 0xFB, 0x00, 0xEF, 0x01, 0xF7,
+0x02, 0xFF, 0xFF, 0x04, 0xFF, 0x04, 0x02, 0x01, 0xFB, 0x07, 0x02, 0x05, 0xFF, 0xFB, 0xFF, 0xFF,
+0x06, 0xFA, 0xFE, 0x01, 0x08, 0x02, 0x01, 0x04, 0xFD, 0xFC, 0xFE, 0xFE, 0x02, 0xFA, 0xFD, 0xFD,
+0x07, 0x00, 0xFA, 0x09, 0x00, 0x08, 0x02, 0xFE, 0x00, 0x02, 0x02, 0x02, 0x09, 0x02, 0xFC, 0xFD,
+0xFD, 0xFC, 0xFF, 0x05, 0x05, 0x00, 0xFF, 0x00, 0xFB, 0xFB, 0xFF, 0x00, 0x06, 0xFD, 0x00, 0xFA,
+0x04, 0x01, 0xFD, 0x05, 0xF7, 0xFE, 0x06, 0x08, 0xFE, 0xFF, 0xFC, 0x02, 0x00, 0xFC, 0xFA, 0x02,
+0xFE, 0xFB, 0x03, 0x06, 0x05, 0xF8, 0x02, 0x04, 0x00, 0x03, 0x01, 0xFE, 0x03, 0xF9, 0x06, 0x05,
+0xFF, 0x00, 0xFA, 0x0B, 0xFD, 0x01, 0x00, 0x08, 0xFE, 0x02, 0x02, 0x04, 0x04, 0x02, 0xFF, 0xF7,
+0x05, 0x01, 0x05, 0x03, 0x07, 0xFA, 0xFF, 0x03, 0x01, 0x08, 0xFF, 0xFA, 0x00, 0xF7, 0x09, 0xFF,
+0x02, 0x01, 0x00, 0xFE, 0x01, 0x04, 0x00, 0x04, 0xFC, 0x02, 0xFA, 0x01, 0x00, 0xFD, 0x02, 0xFA,
+0x07, 0xF9, 0x01, 0x00, 0x00, 0xFD, 0x01, 0x07, 0xFD, 0xFB, 0x00, 0xFF, 0x03, 0xFC, 0x02, 0xF9,
+0xFF, 0x02, 0xFC, 0x08, 0xFD, 0x00, 0x03, 0x02, 0xFD, 0x00, 0xFB, 0x05, 0x01, 0xF8, 0xF7, 0xF8,
+0x03, 0xFA, 0x04, 0x08, 0x02, 0xFD, 0x02, 0xFD, 0xFD, 0x0B, 0xFB, 0xFE, 0x06, 0xFA, 0x00, 0x01,
+0xFD, 0x07, 0xF7, 0x01, 0xFE, 0xFC, 0x05, 0x05, 0x04, 0xFF, 0x03, 0x02, 0x04, 0xFA, 0x00, 0xFF,
+0x02, 0xF8, 0xFB, 0x02, 0x01, 0xF9, 0x04, 0x00, 0x00, 0xFA, 0x04, 0xFD, 0x08, 0xF8, 0x05, 0xF9,
+0x06, 0x00, 0xFF, 0x06, 0xFC, 0xFD, 0x01, 0x03, 0xF2, 0xFE, 0xFF, 0x06, 0x01, 0xF7, 0xFD, 0x01,
+0x01, 0xF9, 0x01, 0x03, 0xFE, 0x03, 0x01, 0x02, 0xFB, 0x04, 0xFE, 0x04, 0x0B, 0xF3, 0x00, 0xFC,
+0x03, 0x01, 0xFA, 0x05, 0xFD, 0x02, 0x01, 0x05, 0xFC, 0xFF, 0x04, 0x02, 0x04, 0xFE, 0x00, 0x00,
+0x02, 0x05, 0xFD, 0xFB, 0x02, 0xFA, 0xFA, 0x04, 0x02, 0xFF, 0xFF, 0x03, 0x01, 0xFB, 0x01, 0xFA,
+0xFD, 0x01, 0xFF, 0xFE, 0xFF, 0x03, 0x00, 0xFC, 0x04, 0xFB, 0x01, 0xFE, 0xFB, 0xFC, 0xFC, 0xFE,
+0xFF, 0x04, 0x02, 0xFF, 0x02, 0xFF, 0x01, 0xFE, 0x01, 0x02, 0x01, 0x06, 0x06, 0x00, 0x01, 0xFA,
+0x05, 0x02, 0xFE, 0xFF, 0x04, 0x03, 0xFE, 0x03, 0xFB, 0xFF, 0xFC, 0xFA, 0x04, 0xFA, 0xFB, 0xFC,
+0xFB, 0xFE, 0xFB, 0x05, 0xFF, 0x04, 0xFB, 0x02, 0x00, 0x06, 0x00, 0xFC, 0xFD, 0xFE, 0x04, 0xFD,
+0xFE, 0xFF, 0xFF, 0xFD, 0xFC, 0xFC, 0x01, 0xFD, 0xFC, 0xFC, 0xFF, 0xFE, 0x06, 0x01, 0xFF, 0xFB,
+0xFE, 0x03, 0x05, 0x06, 0x02, 0x04, 0x03, 0xFA, 0xFF, 0xFE, 0xFC, 0x02, 0x01, 0xFD, 0x04, 0x00,
+0x05, 0xFF, 0x02, 0x00, 0x01, 0xFA, 0xFB, 0x06, 0xFE, 0x01, 0xFB, 0xFD, 0x05, 0x00, 0x04, 0x05,
+0xFC, 0x04, 0x02, 0xFA, 0x02, 0x04, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x01, 0xFF, 0xFE, 0x00, 0xFE,
+0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0x04, 0xFD, 0x01, 0xFD, 0x05, 0x04, 0x04, 0x05, 0xFB, 0x04,
+0x02, 0xFD, 0x04, 0x01, 0x01, 0xFE, 0x02, 0xFF, 0xFD, 0xFD, 0x02, 0xFF, 0xFE, 0xFA, 0xFE, 0xFF,
+0x00, 0xFE, 0xFB, 0x04, 0x03, 0x05, 0xFB, 0x05, 0xFA, 0x06, 0x06, 0x06, 0xFC, 0x03, 0x05, 0xFC,
+0xFC, 0x00, 0xFF, 0xFF, 0x01, 0x01, 0x05, 0xFE, 0xFA, 0xFB, 0xFB, 0xFE, 0x04, 0xFE, 0x03, 0x01,
+0xFC, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xFE, 0x03, 0xFB, 0xFF, 0x01, 0x00, 0x02, 0x06, 0xFB, 0xFA,
+0xFB, 0x04, 0xFF, 0x00, 0x04, 0x06, 0xFA, 0x03, 0x04, 0x06, 0xFE, 0x06, 0xFA, 0xFF, 0x02, 0xFD,
+0xFC, 0x02, 0xF9, 0x0D, 0xFC, 0x04, 0x02, 0x03, 0xFA, 0xFD, 0xF6, 0x02, 0x02, 0xFE, 0xF8, 0xF7,
+0x03, 0xFA, 0x06, 0x04, 0x06, 0xF6, 0x02, 0x05, 0xF5, 0x06, 0xFC, 0xF9, 0xFE, 0xEF, 0x09, 0xFD,
+0x06, 0x06, 0xFC, 0x04, 0xFA, 0x01, 0x07, 0x09, 0x00, 0x07, 0xFA, 0x02, 0xFF, 0xFE, 0x02, 0xF8,
+0x02, 0xF7, 0x02, 0x03, 0x08, 0xFD, 0x00, 0x06, 0x00, 0xF1, 0xFD, 0xF8, 0x03, 0x00, 0x01, 0xFD,
+0x04, 0x06, 0xF9, 0x00, 0xFD, 0x05, 0x03, 0x04, 0x01, 0x05, 0xFD, 0x0B, 0x00, 0xFE, 0xFD, 0xFC,
+0x02, 0xFB, 0x03, 0x05, 0x08, 0xF7, 0x04, 0x04, 0xF8, 0x00, 0xFD, 0xF9, 0x08, 0xE8, 0x08, 0xFD,
+0x08, 0x07, 0xFC, 0x0A, 0xFB, 0x02, 0x01, 0x08, 0xFE, 0xFA, 0xFF, 0xFF, 0x0D, 0x03, 0xF4, 0xF8,
+0xFF, 0xFA, 0x05, 0x01, 0x00, 0xFB, 0x04, 0x0C, 0xFF, 0x04, 0xFD, 0xFA, 0xFE, 0xF2, 0x09, 0xF8,
+0x0A, 0x06, 0xF6, 0x03, 0x02, 0x0A, 0x0A, 0x00, 0xFE, 0x03, 0xF8, 0x05, 0xFF, 0x04, 0x00, 0xFE,
+0x05, 0x01, 0x09, 0xFD, 0x09, 0xF8, 0x05, 0x0B, 0xFD, 0x00, 0xF8, 0xFE, 0xFF, 0xFE, 0x02, 0xF8,
+0x05, 0x05, 0xF8, 0x08, 0xF9, 0x04, 0x06, 0x03, 0xFE, 0x00, 0xF7, 0x00, 0x02, 0xFB, 0xFE, 0xFC,
+0x01, 0xFB, 0x04, 0x06, 0x04, 0xF9, 0x07, 0x05, 0xF9, 0xFA, 0xFA, 0xFA, 0x06, 0xFA, 0x02, 0x01,
+0x03, 0x09, 0xF9, 0x08, 0x00, 0xFF, 0xFF, 0x05, 0xF8, 0x09, 0x02, 0x04, 0x01, 0x01, 0xF9, 0xFA,
+0x0B, 0xFF, 0x07, 0x08, 0x0A, 0xFD, 0x06, 0xFF, 0xFA, 0x01, 0xFA, 0xF7, 0x07, 0xF7, 0x01, 0xF8,
+0x04, 0x07, 0xFE, 0x08, 0xF7, 0x08, 0x08, 0x04, 0xFC, 0x08, 0x00, 0x06, 0x05, 0xFE, 0xFB, 0xF9,
+0x01, 0xF6, 0x01, 0x06, 0x04, 0x02, 0x08, 0x03, 0xFF, 0xFC, 0xFD, 0xF6, 0xFD, 0xFA, 0x02, 0x02,
+0x05, 0x08, 0xFB, 0x00, 0xF4, 0x0A, 0xFF, 0x08, 0xF8, 0x02, 0xF5, 0xFD, 0x0C, 0x03, 0xF5, 0x01,
+0x08, 0x00, 0x02, 0xFD, 0x02, 0xF7, 0x03, 0x04, 0x05, 0xFB, 0xF7, 0xFA, 0x05, 0xEF, 0x07, 0x01,
+0x03, 0x05, 0xFB, 0x02, 0xFC, 0x01, 0x03, 0x04, 0xFB, 0x05, 0xF9, 0x02, 0x03, 0xF9, 0xFC, 0xFC,
+0x03, 0xF8, 0x0A, 0x02, 0x02, 0xF7, 0x07, 0xFF, 0xFF, 0xF4, 0xF7, 0xFC, 0x04, 0xF2, 0xFF, 0xFC,
+0x0B, 0x04, 0xFC, 0x08, 0xF6, 0x08, 0x01, 0x01, 0xF8, 0x08, 0xFE, 0x01, 0x03, 0x03, 0xF9, 0xF9,
+0x03, 0xFE, 0x00, 0x0A, 0x03, 0xFE, 0x06, 0x00, 0x01, 0x00, 0xF9, 0xFA, 0x0B, 0xF4, 0x08, 0xF8,
+0x02, 0x0B, 0xFD, 0x07, 0xFD, 0x07, 0x08, 0x02, 0xF9, 0xFD, 0xFC, 0x01, 0x01, 0x00, 0xF7, 0xFA,
+0x02, 0xF5, 0x07, 0x06, 0x07, 0xFF, 0x02, 0x01, 0xFC, 0x00, 0x00, 0xF7, 0x0A, 0xF7, 0x01, 0xF8,
+0x05, 0x06, 0xFD, 0x00, 0xF8, 0x05, 0x06, 0x04, 0xF9, 0xFF, 0xF9, 0x06, 0x07, 0xFA, 0xFA, 0xFE,
+0x00, 0xF9, 0x03, 0x02, 0x03, 0xF7, 0x03, 0x04, 0xFF, 0x01, 0xFA, 0xF7, 0x02, 0x00, 0x07, 0xFE,
+0x08, 0x02, 0x01, 0x06, 0xFA, 0x02, 0x03, 0x05, 0xFF, 0x0B, 0xF9, 0x08, 0x08, 0x02, 0xFB, 0xFB,
+0x05, 0xFC, 0x01, 0x04, 0xFF, 0xFC, 0x04, 0x03, 0xF7, 0xFC, 0xFB, 0xFB, 0x08, 0xFA, 0x06, 0xF9,
+0x03, 0x04, 0xFC, 0x03, 0xF8, 0x00, 0x04, 0x03, 0xF8, 0x03, 0xFB, 0x05, 0x04, 0xF7, 0xFA, 0xF8,
+0x03, 0x00, 0x03, 0x01, 0x02, 0xFA, 0x07, 0x02, 0xFD, 0xFB, 0xF5, 0xFB, 0x01, 0xFB, 0x05, 0xFA,
+0x09, 0xFF, 0xF8, 0x02, 0xF5, 0x05, 0xFF, 0xFE, 0xF8, 0x07, 0xF8, 0x03, 0x04, 0xFF, 0xF7, 0xFA,
+0x08, 0xF9, 0x09, 0xFE, 0x07, 0x03, 0x07, 0x00, 0x03, 0xF5, 0xFC, 0xFD, 0x04, 0xFA, 0x04, 0xFE,
+0x06, 0x00, 0xF6, 0x04, 0xFC, 0x0B, 0x08, 0x03, 0x01, 0xFC, 0xF5, 0x08, 0x0D, 0x03, 0xFB, 0xF7,
+0xFF, 0xFD, 0x09, 0xFE, 0x07, 0xFD, 0x09, 0x00, 0xF9, 0x06, 0x01, 0xFF, 0x00, 0xF6, 0x08, 0xF9,
+0x06, 0x0A, 0xFA, 0xFF, 0xF8, 0xFF, 0x07, 0x05, 0xFB, 0x04, 0xFC, 0x09, 0x04, 0xFA, 0x02, 0xF9,
+0x03, 0xFC, 0x01, 0x01, 0x06, 0xF9, 0x00, 0x03, 0xF7, 0xFF, 0xFD, 0x00, 0x04, 0xF7, 0x05, 0xFE,
+0x01, 0x08, 0xFD, 0x02, 0xFB, 0x04, 0x06, 0x05, 0xFC, 0x04, 0xFD, 0x0A, 0x06, 0xFC, 0xFB, 0xFD,
+0x04, 0xF6, 0x06, 0x02, 0x03, 0xFB, 0x03, 0x04, 0xFB, 0xF9, 0xFD, 0xFB, 0x03, 0xFC, 0x04, 0x00,
+0x04, 0x03, 0xFC, 0x05, 0xFB, 0x03, 0x05, 0x05, 0xFC, 0x04, 0xF8, 0x04, 0x08, 0xFB, 0xFB, 0xFE,
+0x05, 0xFA, 0x05, 0x04, 0x02, 0x00, 0x01, 0x05, 0xFC, 0xF8, 0xFE, 0xFB, 0x08, 0xF8, 0x02, 0xFB,
+0x03, 0x03, 0xFC, 0x08, 0xFC, 0x05, 0x01, 0x07, 0xFC, 0x02, 0xFD, 0x05, 0x05, 0xF9, 0xF9, 0xFA,
+0x03, 0xFF, 0x04, 0x03, 0x05, 0xFE, 0x06, 0x03, 0xFC, 0xF9, 0xFE, 0xFA, 0x0A, 0xF1, 0x07, 0xFD,
+0x02, 0x04, 0xFC, 0x04, 0xFC, 0x03, 0x04, 0x05, 0xFA, 0x07, 0xFD, 0x05, 0x03, 0xFC, 0xFC, 0xFD,
+0x05, 0xFD, 0x04, 0x03, 0x06, 0xFE, 0x07, 0x04, 0xF8, 0xF4, 0xFB, 0xFB, 0x04, 0xF6, 0x02, 0x00,
+0x06, 0x04, 0xFB, 0x08, 0xFD, 0x04, 0x04, 0x03, 0xFD, 0x05, 0xFB, 0x04, 0xFF, 0xFC, 0xFA, 0xF8,
+0x05, 0xFB, 0x01, 0x03, 0x03, 0xFF, 0x05, 0x00, 0xFB, 0xF7, 0xF9, 0xFD, 0x04, 0xFE, 0x07, 0x01,
+0x05, 0x04, 0xF6, 0x01, 0x01, 0x08, 0x07, 0x09, 0xFB, 0x06, 0xF5, 0x03, 0x0A, 0x01, 0xFC, 0x01,
+0x05, 0xF7, 0x01, 0x00, 0x0A, 0xF7, 0x01, 0x02, 0xFA, 0x0B, 0xFF, 0xFD, 0x02, 0xF9, 0x02, 0xFD,
+0x02, 0x03, 0xF9, 0x06, 0x00, 0x0B, 0x07, 0x04, 0xFA, 0x09, 0x00, 0xFF, 0x01, 0xFF, 0xF9, 0xFD,
+0x06, 0xFF, 0x08, 0x04, 0x03, 0xFF, 0x08, 0x0A, 0xFD, 0x08, 0xF9, 0xF7, 0x0C, 0xF9, 0x02, 0xF9,
+0x04, 0x0A, 0xF8, 0x04, 0xFB, 0x06, 0x0A, 0x03, 0xFE, 0x00, 0xF8, 0x00, 0x06, 0x04, 0xF4, 0xF8,
+0x02, 0xF8, 0x05, 0x03, 0x07, 0xFF, 0x02, 0x07, 0xFC, 0xFD, 0x01, 0x00, 0x03, 0xFF, 0x07, 0xF9,
+0x06, 0x03, 0xFE, 0x04, 0xFE, 0x05, 0x0B, 0x08, 0x00, 0x02, 0xFB, 0x05, 0x08, 0xFB, 0xFB, 0xFD,
+0x00, 0xFA, 0x05, 0x04, 0x0A, 0xFE, 0x01, 0x06, 0xFA, 0xF7, 0xFD, 0xFB, 0x04, 0xF8, 0x03, 0xFC,
+0x04, 0x03, 0xFC, 0x05, 0xFE, 0x06, 0x03, 0x02, 0xFA, 0x07, 0xFA, 0x03, 0x03, 0xFB, 0xF9, 0xFC,
+0x04, 0xFE, 0x05, 0x06, 0x06, 0xF8, 0x02, 0x04, 0xFF, 0xF8, 0xFE, 0xF8, 0x00, 0xF4, 0x09, 0xFE,
+0x02, 0x01, 0xFB, 0x08, 0xFB, 0x03, 0x08, 0x04, 0xFB, 0x08, 0xFA, 0x05, 0x05, 0xFA, 0xFC, 0xFD,
+0x03, 0xFE, 0x07, 0x05, 0x04, 0xFE, 0x07, 0x04, 0xFE, 0xF7, 0xFB, 0xFF, 0x07, 0xF6, 0x01, 0x00,
+0x04, 0x06, 0xFC, 0x08, 0xFC, 0x03, 0x03, 0x07, 0xFB, 0x02, 0xF9, 0x03, 0x04, 0xFE, 0xFB, 0xFD,
+0x05, 0xFB, 0x03, 0x03, 0x06, 0xFD, 0x06, 0x05, 0xFB, 0xF7, 0xFB, 0xFD, 0x00, 0xF7, 0x05, 0xFC,
+0x06, 0x06, 0xF9, 0xFF, 0xFC, 0x06, 0x03, 0x05, 0xFF, 0x00, 0xFA, 0x03, 0x00, 0xFE, 0xFD, 0xFC,
+0x07, 0xFA, 0x07, 0x07, 0x08, 0xFA, 0x01, 0x08, 0xFA, 0x05, 0xF8, 0xF6, 0x01, 0xF2, 0x07, 0xF9,
+0x04, 0x09, 0xFA, 0x03, 0xFA, 0x01, 0x01, 0x02, 0xFF, 0x01, 0xF9, 0x02, 0x03, 0xFB, 0xFF, 0xFA,
+0x0B, 0xFE, 0x0A, 0x05, 0x04, 0xFA, 0x06, 0x05, 0xF8, 0xFE, 0xFB, 0xFC, 0x01, 0xF8, 0x09, 0x01,
+0xFE, 0x07, 0xF7, 0x04, 0xFE, 0x03, 0x02, 0x04, 0xFA, 0x08, 0xFE, 0x05, 0x02, 0x03, 0xFE, 0xF7,
+0x08, 0xFD, 0x05, 0x02, 0x01, 0xF9, 0x08, 0x06, 0xFA, 0xF7, 0xFC, 0x01, 0x06, 0xF5, 0x00, 0xFD,
+0x00, 0x08, 0xF8, 0x07, 0xFB, 0x03, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x04, 0x01, 0xF7, 0xFC, 0xFA,
+0x0B, 0xFB, 0x04, 0x04, 0x02, 0x00, 0x04, 0x02, 0xFC, 0xFB, 0xF9, 0xFB, 0x09, 0xEF, 0x09, 0xFE,
+0x04, 0x06, 0xF9, 0x01, 0xFE, 0x01, 0x04, 0x01, 0xFB, 0x04, 0xFC, 0x01, 0x02, 0xFC, 0xFD, 0xF9,
+0x06, 0xFC, 0x02, 0x03, 0x0A, 0xF9, 0x09, 0x04, 0xFE, 0xFD, 0xFB, 0x03, 0x06, 0xFC, 0x08, 0xFA,
+0x08, 0x00, 0xF8, 0x04, 0xFE, 0x06, 0x06, 0x01, 0xF9, 0x06, 0xFC, 0x03, 0xFF, 0xFC, 0xFD, 0xF8,
+0x07, 0xFC, 0x06, 0x05, 0x00, 0xFA, 0x05, 0x00, 0xFD, 0xFB, 0xFD, 0xFB, 0x03, 0xFC, 0x08, 0xFC,
+0x04, 0x04, 0xFD, 0x04, 0xFD, 0x0C, 0xFF, 0x04, 0xFB, 0x02, 0xFC, 0x02, 0x02, 0xFE, 0xF6, 0xF8,
+0x00, 0xFD, 0x02, 0x07, 0x07, 0xF5, 0x04, 0x03, 0xFC, 0x02, 0xFA, 0xFD, 0x03, 0xFD, 0x07, 0xF7,
+0x02, 0x03, 0xF9, 0x02, 0xFA, 0x04, 0x08, 0x06, 0xFB, 0x00, 0xFC, 0xFF, 0x01, 0xFA, 0xF9, 0xFE,
+0x00, 0xFD, 0x03, 0x06, 0x08, 0xF8, 0x09, 0x08, 0xFD, 0x00, 0xFD, 0xFB, 0x04, 0xFC, 0x08, 0x00,
+0x02, 0x08, 0xF9, 0x03, 0xFE, 0x01, 0x08, 0x05, 0xFF, 0x02, 0xF7, 0x01, 0x06, 0xFB, 0xF9, 0xF9,
+0x00, 0xFB, 0x08, 0x02, 0x07, 0xFB, 0x05, 0x00, 0xFB, 0xFB, 0xFC, 0x00, 0x02, 0xF4, 0x06, 0xF9,
+0x07, 0x05, 0xFB, 0x02, 0xFE, 0x08, 0x08, 0x0B, 0xF9, 0x01, 0xFB, 0xFF, 0x06, 0xF9, 0xFE, 0xFE,
+0xFF, 0xF7, 0x01, 0x0B, 0x03, 0xF9, 0x01, 0x03, 0xFD, 0x04, 0xFF, 0x01, 0x04, 0xEF, 0x09, 0xF9,
+0x02, 0x05, 0xFB, 0x03, 0xFE, 0x06, 0x02, 0x01, 0xFE, 0x03, 0xFE, 0x01, 0x07, 0xF9, 0xFA, 0x00,
+0x03, 0xF8, 0x06, 0x07, 0x09, 0xFB, 0x02, 0x02, 0xFD, 0xFB, 0xFE, 0xFF, 0x08, 0xF2, 0x06, 0xFE,
+0x07, 0x0A, 0xFD, 0x09, 0xFD, 0x08, 0x0B, 0x05, 0x03, 0x08, 0x00, 0xFD, 0x05, 0xFD, 0xFC, 0xF8,
+0x00, 0xF8, 0x00, 0x04, 0x0A, 0x00, 0x02, 0x05, 0xFA, 0xFD, 0xFB, 0xFD, 0xFE, 0xFA, 0x09, 0xFF,
+0x00, 0x05, 0xF9, 0x04, 0xFE, 0x04, 0x05, 0x04, 0xFB, 0x05, 0xFC, 0x01, 0x05, 0xFB, 0xFA, 0xFC,
+0x0A, 0xFB, 0x07, 0x06, 0x06, 0xFD, 0x07, 0x00, 0xFC, 0xFB, 0xFD, 0xF9, 0x00, 0x01, 0x05, 0xFD,
+0x01, 0x05, 0xFD, 0x07, 0xFD, 0x02, 0x05, 0x06, 0xF9, 0x01, 0xFD, 0x06, 0x04, 0xFB, 0xFE, 0xFB,
+0x04, 0xF9, 0x02, 0xFF, 0x04, 0xFE, 0x02, 0x04, 0xFD, 0xF8, 0xFF, 0xFE, 0x07, 0xF6, 0x02, 0xF9,
+0xFF, 0x04, 0xF9, 0x04, 0xFD, 0x03, 0x06, 0x06, 0x01, 0x08, 0xFB, 0x05, 0x07, 0xFD, 0x00, 0xF9,
+0x00, 0xFC, 0x04, 0x08, 0x02, 0xF9, 0x07, 0x02, 0xFB, 0xFB, 0x02, 0xFE, 0x00, 0xF9, 0x05, 0xFA,
+0x04, 0x00, 0xFB, 0x02, 0x01, 0x01, 0x08, 0x03, 0xFC, 0x00, 0xF5, 0x05, 0x05, 0x02, 0xFC, 0xF7,
+0x06, 0xFC, 0x0B, 0x03, 0x06, 0xFE, 0x0B, 0x06, 0xFF, 0xF9, 0xFD, 0xFA, 0x05, 0xF5, 0x01, 0xF9,
+0x03, 0x01, 0xF7, 0x07, 0xFF, 0x08, 0x05, 0x01, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0xFB, 0x00, 0xFD,
+0x09, 0xFE, 0x05, 0x02, 0x06, 0xF8, 0x0A, 0x09, 0xFA, 0xFD, 0xFE, 0xF6, 0x04, 0xFE, 0x00, 0xFE,
+0x05, 0x03, 0xFA, 0xFF, 0xFF, 0x02, 0x02, 0x06, 0xFB, 0x05, 0xFE, 0x01, 0x06, 0xFC, 0xFE, 0xF4,
+0x0A, 0xFF, 0x09, 0x07, 0x02, 0xFD, 0x00, 0x05, 0xFD, 0xFC, 0xFD, 0xFF, 0x0A, 0xF6, 0x06, 0xFD,
+0x03, 0x09, 0xFB, 0xFF, 0xFF, 0x07, 0x00, 0x0A, 0xFD, 0x02, 0xFD, 0x03, 0xFF, 0x04, 0x00, 0xFF,
+0x07, 0x01, 0x08, 0x05, 0x07, 0xFB, 0x08, 0x01, 0xFF, 0xFC, 0xFD, 0x00, 0x04, 0xFB, 0x0A, 0xF5,
+0x04, 0xFF, 0xF8, 0x06, 0xFE, 0x06, 0x0A, 0x07, 0xFC, 0xFA, 0xF8, 0x03, 0x02, 0x02, 0xFF, 0xF9,
+0xFC, 0xF9, 0x06, 0x06, 0x03, 0xFB, 0x09, 0x06, 0xFA, 0x01, 0xFF, 0xFC, 0x0E, 0xF9, 0x07, 0xFA,
+0x02, 0x06, 0xFF, 0x05, 0x02, 0x01, 0x07, 0x05, 0xFD, 0x09, 0xF9, 0x02, 0x0A, 0xFA, 0xF7, 0xFA,
+0x00, 0xFE, 0x08, 0x06, 0x02, 0xFC, 0x05, 0x03, 0x00, 0x02, 0xFE, 0xFE, 0x0A, 0xFD, 0x0B, 0xFA,
+0xFF, 0x07, 0xFF, 0x0C, 0x02, 0x06, 0x0D, 0x05, 0x04, 0x08, 0xFD, 0xFD, 0x03, 0xFF, 0xFB, 0xF8,
+0x04, 0xF4, 0x06, 0x0B, 0x00, 0xF9, 0x03, 0x01, 0x02, 0xFC, 0xF6, 0xFB, 0x09, 0xFF, 0x09, 0x01,
+0x01, 0x03, 0xF9, 0x03, 0xFD, 0x0B, 0x09, 0x0A, 0xFB, 0x06, 0x01, 0x01, 0x0C, 0xFE, 0xFD, 0x01,
+0x0A, 0x01, 0x06, 0xFF, 0x04, 0xFC, 0x05, 0x05, 0xF8, 0xFC, 0xFC, 0xFC, 0x08, 0xFB, 0x03, 0x01,
+0x01, 0x09, 0xF6, 0x0B, 0xFE, 0x08, 0x01, 0x05, 0xF6, 0xFB, 0xFF, 0x00, 0x08, 0xF9, 0xFC, 0xFE,
+0x09, 0xF5, 0x08, 0xFF, 0x07, 0xFA, 0x03, 0x00, 0xFE, 0x04, 0xF6, 0xF7, 0x00, 0xFA, 0x00, 0xF9,
+0x00, 0x01, 0xF9, 0x03, 0xFE, 0x06, 0x01, 0x03, 0xF6, 0xFC, 0xF7, 0x01, 0x08, 0xFA, 0xFB, 0xF9,
+0x01, 0xFA, 0x03, 0xFF, 0x00, 0xF9, 0x06, 0x0A, 0xFB, 0x00, 0xFC, 0xF9, 0x07, 0xF6, 0x0A, 0x01,
+0x08, 0x02, 0xFF, 0x00, 0xF7, 0xFF, 0x00, 0x05, 0xFA, 0xFD, 0xFA, 0x09, 0x01, 0xF9, 0xFB, 0xF9,
+0x0A, 0xFC, 0x08, 0x09, 0x08, 0xF9, 0x03, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x0A, 0xFA, 0x04, 0xFB,
+0x04, 0x03, 0xFE, 0x07, 0xFB, 0x07, 0x0B, 0x04, 0x02, 0x02, 0xF6, 0x01, 0x0A, 0x04, 0xFA, 0xFF,
+0x01, 0xF6, 0xFE, 0x06, 0x0B, 0xF5, 0x04, 0x07, 0xF8, 0x09, 0xFC, 0xF8, 0x08, 0xF8, 0x09, 0xFE,
+0x01, 0x08, 0x00, 0x08, 0xFA, 0xFF, 0x08, 0x08, 0xFE, 0x01, 0xFE, 0x05, 0x04, 0xFA, 0xF8, 0xFF,
+0x03, 0xF6, 0x09, 0x07, 0x0B, 0xF8, 0x0A, 0x01, 0x01, 0x03, 0xFB, 0xF8, 0x03, 0xFE, 0x01, 0x01,
+0x02, 0x08, 0x00, 0x09, 0xFE, 0x06, 0x06, 0x00, 0xFF, 0xFD, 0xF8, 0x03, 0x0B, 0xFC, 0xFA, 0xFC,
+0xFF, 0xFF, 0x03, 0x07, 0x0A, 0xFB, 0x08, 0xFF, 0xFB, 0xFE, 0xFA, 0xF8, 0x07, 0xF6, 0xFF, 0xFB,
+0x06, 0x04, 0xFC, 0x02, 0xF9, 0x01, 0x0A, 0x08, 0xFB, 0x03, 0xF6, 0xFD, 0x02, 0x02, 0xF6, 0x01,
+0x00, 0xF3, 0x03, 0x04, 0x05, 0xFE, 0x04, 0x06, 0xFD, 0xFF, 0xF9, 0xFB, 0x05, 0xFD, 0x0A, 0xF9,
+0x06, 0x05, 0xFC, 0x04, 0xFC, 0x07, 0x05, 0x05, 0xFA, 0x00, 0x00, 0x03, 0x09, 0x00, 0xF7, 0x00,
+0x02, 0xF9, 0x06, 0x00, 0x08, 0xFD, 0x06, 0x02, 0xFD, 0xFC, 0xFC, 0xFA, 0x0D, 0xF9, 0x01, 0xF8,
+0xFF, 0x01, 0xFB, 0x09, 0xF8, 0x03, 0x00, 0x00, 0xFC, 0x04, 0xFE, 0x00, 0x00, 0xFC, 0xF8, 0xF9,
+0x08, 0xFF, 0x03, 0x06, 0x02, 0xF9, 0x09, 0x05, 0xFD, 0xFC, 0xFB, 0xFB, 0x08, 0xF0, 0x06, 0xFF,
+0x00, 0x05, 0x00, 0x01, 0xF4, 0x01, 0x08, 0x07, 0xFD, 0x02, 0xFE, 0x05, 0x04, 0x05, 0xFF, 0xFB,
+0x0C, 0xFC, 0x03, 0x04, 0x0D, 0xFC, 0x00, 0x09, 0x04, 0xFB, 0xF7, 0xF5, 0x09, 0xF8, 0x04, 0xF9,
+0x0B, 0x01, 0xF7, 0x0C, 0xF7, 0x04, 0x01, 0x01, 0xF9, 0xFD, 0xF4, 0xFA, 0x0E, 0x07, 0xFF, 0x00,
+0x06, 0xF5, 0x04, 0x07, 0x08, 0xF5, 0x08, 0x08, 0x01, 0xFC, 0x01, 0xFB, 0x00, 0xFE, 0x09, 0xFE,
+0x03, 0x07, 0xF7, 0xFF, 0xFA, 0x02, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x08, 0xFF, 0xF5, 0xF8, 0xFD,
+0x04, 0xFF, 0xFF, 0xFE, 0x09, 0xFD, 0x01, 0x07, 0xF9, 0xF8, 0x00, 0xFE, 0x00, 0xF7, 0x01, 0xF6,
+0x07, 0x0A, 0xFF, 0x04, 0x03, 0x07, 0x02, 0x07, 0xF7, 0xFB, 0x00, 0x02, 0x0A, 0x00, 0xF6, 0xF4,
+0x0C, 0x00, 0x02, 0x03, 0x06, 0xFE, 0x01, 0x00, 0x01, 0x05, 0xF2, 0xFC, 0x0A, 0xFB, 0x08, 0xFE,
+0x00, 0x09, 0xF7, 0x05, 0xFF, 0x09, 0x09, 0x06, 0xF7, 0xFF, 0xFA, 0xFC, 0x04, 0x05, 0xF8, 0x00,
+0x07, 0xF9, 0xFD, 0x03, 0x02, 0xFA, 0xFF, 0x01, 0x04, 0xF9, 0x03, 0xFB, 0x06, 0xF8, 0x09, 0xF9,
+0xFF, 0xFE, 0xFC, 0x01, 0xFF, 0xFE, 0x02, 0x05, 0xF7, 0x03, 0xF9, 0x0B, 0x02, 0xF8, 0xFA, 0xFF,
+0x08, 0xF5, 0x01, 0x01, 0x04, 0xFF, 0x04, 0x05, 0xF6, 0x06, 0xF6, 0xFE, 0x0A, 0xF0, 0x00, 0xFD,
+0x0A, 0xFD, 0xF7, 0x07, 0xF8, 0x05, 0xFE, 0x00, 0xFC, 0x0A, 0xFB, 0x01, 0xFF, 0xFF, 0xFA, 0xF9,
+0x07, 0xFB, 0xFA, 0x09, 0x02, 0xFB, 0x06, 0x00, 0xF9, 0xFB, 0x01, 0xFD, 0x09, 0xF0, 0x03, 0xFD,
+0x03, 0x02, 0xFD, 0x07, 0xF6, 0x05, 0x05, 0x00, 0x01, 0x05, 0x01, 0xFD, 0x06, 0xF9, 0xFC, 0xFD,
+0x00, 0xF8, 0xFE, 0x02, 0x08, 0xFC, 0x04, 0x0B, 0xF9, 0x00, 0x01, 0xFC, 0x09, 0xFD, 0x00, 0xFF,
+0x07, 0x09, 0xFE, 0x04, 0xFC, 0x01, 0x00, 0x04, 0xF6, 0x06, 0xFB, 0x02, 0x06, 0xFF, 0xFE, 0xFC,
+0x0A, 0xFE, 0x07, 0x09, 0x03, 0xFD, 0x03, 0x02, 0xFF, 0xFF, 0xFB, 0xFD, 0x07, 0xFF, 0x02, 0x00,
+0x06, 0x09, 0xF9, 0x09, 0x00, 0xFF, 0x02, 0x05, 0xFD, 0xFE, 0x02, 0x08, 0x06, 0xFF, 0xF9, 0xFB,
+0x09, 0xFB, 0x00, 0x08, 0xFE, 0x00, 0xFF, 0x01, 0xF8, 0xFF, 0xF7, 0x01, 0x03, 0xF4, 0xFF, 0x02,
+0x04, 0x06, 0xFC, 0x07, 0xF8, 0x04, 0x07, 0x05, 0xFF, 0x09, 0xFE, 0x02, 0x04, 0x05, 0xFF, 0xFF,
+0x01, 0xFE, 0x06, 0x04, 0x06, 0xFF, 0x07, 0xFE, 0x04, 0x00, 0xFC, 0xFD, 0x01, 0xF9, 0x09, 0xF9,
+0x08, 0x04, 0xF8, 0xFE, 0xFA, 0x02, 0x09, 0xFF, 0xFD, 0xFA, 0xFF, 0x09, 0x08, 0xFD, 0xF7, 0xFA,
+0x0A, 0xF9, 0x08, 0xFF, 0x01, 0x00, 0x04, 0x08, 0x02, 0xFF, 0xF7, 0xF5, 0x03, 0xFE, 0x09, 0x00,
+0x02, 0x01, 0xFC, 0x07, 0xFE, 0x03, 0x02, 0x03, 0xFB, 0x00, 0xFE, 0x04, 0x06, 0x03, 0xF6, 0xF7,
+0x00, 0xF5, 0x03, 0x0D, 0x01, 0xF7, 0x02, 0x07, 0xF9, 0xFB, 0xFC, 0xFF, 0x01, 0xFC, 0xFF, 0xFC,
+0x05, 0x01, 0xF5, 0x09, 0xF8, 0x03, 0x07, 0x02, 0x04, 0xFA, 0xFD, 0x02, 0x07, 0x03, 0xFD, 0xF9,
+0x06, 0x01, 0x06, 0x08, 0x0B, 0xF6, 0x0A, 0x08, 0x05, 0x05, 0xF8, 0xFA, 0x06, 0xFB, 0x02, 0xF7,
+0x03, 0x07, 0xFA, 0x01, 0x00, 0x01, 0x05, 0x05, 0xFB, 0xFF, 0xFF, 0x0D, 0x01, 0xFF, 0xFD, 0xFF,
+0x02, 0xFE, 0x07, 0x04, 0x09, 0xFF, 0x00, 0x03, 0xFA, 0xF8, 0xFA, 0xF7, 0x04, 0xF6, 0x04, 0xFC,
+0x00, 0x04, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0x00, 0x03, 0xFF, 0xF6, 0x03, 0x00, 0x05, 0xFB, 0xF9,
+0x07, 0xF7, 0x0A, 0x07, 0x03, 0xFF, 0x02, 0x07, 0xFF, 0xFA, 0xF7, 0xFA, 0x05, 0xF2, 0x0A, 0xFC,
+0x07, 0x01, 0xF4, 0x00, 0x00, 0x0A, 0x0B, 0x09, 0xFF, 0x00, 0xFC, 0xFA, 0x06, 0x04, 0xFC, 0xFE,
+0x05, 0xF5, 0x08, 0x03, 0x09, 0xFD, 0x04, 0x09, 0x06, 0xF5, 0xFB, 0xF5, 0x03, 0xF8, 0x08, 0x01,
+0xFE, 0x04, 0xF7, 0x0A, 0xFE, 0x02, 0x09, 0x00, 0xFB, 0xF7, 0x02, 0x08, 0x0A, 0x04, 0xF6, 0x00,
+0x05, 0xFE, 0x0A, 0x03, 0x01, 0xFA, 0x0A, 0x05, 0xFE, 0x0E, 0xFC, 0xF8, 0x04, 0xF2, 0x04, 0xF7,
+0x04, 0x03, 0xFB, 0x0B, 0xFA, 0x04, 0x04, 0x06, 0xFF, 0x00, 0xF8, 0x00, 0x0A, 0x00, 0xF6, 0xF9,
+0xFB, 0xF8, 0x06, 0x03, 0x09, 0xF6, 0x07, 0x0C, 0xFF, 0x0D, 0xF8, 0xF9, 0x01, 0xFD, 0x05, 0x00,
+0xFF, 0xFD, 0xF9, 0x03, 0xF9, 0x04, 0x05, 0x08, 0xF7, 0x04, 0xF7, 0x07, 0xFF, 0xFC, 0xF7, 0xF9,
+0x07, 0xFD, 0x00, 0xFC, 0x03, 0xFA, 0x05, 0x06, 0xFB, 0xFD, 0xFB, 0xFB, 0x02, 0xF8, 0x05, 0xFA,
+0x03, 0x08, 0xFE, 0x02, 0xF6, 0x06, 0x04, 0x05, 0xFC, 0x02, 0xFE, 0x06, 0x03, 0xFB, 0xF8, 0xFC,
+0x04, 0x02, 0x06, 0x02, 0x09, 0xFD, 0x05, 0x03, 0xF8, 0xFA, 0xFC, 0xFB, 0xFE, 0xFC, 0x09, 0xFC,
+0x09, 0x03, 0xF9, 0x03, 0xFB, 0x07, 0x03, 0x07, 0xFD, 0x03, 0xFB, 0x04, 0x09, 0x02, 0xFC, 0xF8,
+0x03, 0xFC, 0x06, 0x07, 0x02, 0xFB, 0x06, 0x0A, 0xFB, 0xFF, 0xF8, 0xFE, 0x06, 0xF8, 0x06, 0x01,
+0x0B, 0x06, 0xFD, 0x06, 0xFE, 0x03, 0x01, 0x0A, 0xFB, 0x06, 0xFC, 0x02, 0x03, 0xF7, 0xF9, 0x00,
+0x02, 0xF7, 0x00, 0x06, 0x01, 0xFB, 0x06, 0x02, 0xF7, 0xF8, 0xFB, 0x00, 0x05, 0xF9, 0x03, 0x00,
+0x05, 0x05, 0xFC, 0x03, 0xFC, 0x04, 0x04, 0x03, 0x01, 0x01, 0x01, 0x03, 0x0A, 0xF9, 0xF7, 0xF8,
+0x01, 0xF8, 0xFF, 0x09, 0x0D, 0xF7, 0x04, 0x0B, 0xFF, 0xFE, 0x00, 0xF9, 0x04, 0xF1, 0x01, 0xFC,
+0x07, 0x03, 0xFE, 0xFF, 0xF7, 0x0A, 0x04, 0xFF, 0xF8, 0x03, 0xF5, 0x01, 0xFD, 0xFE, 0xFF, 0x00,
+0x09, 0xFA, 0x05, 0x06, 0x0B, 0xFA, 0x01, 0x05, 0xFB, 0xFC, 0xFD, 0xF4, 0x00, 0xF5, 0x03, 0xFC,
+0x0B, 0x05, 0xF7, 0x05, 0xFC, 0x09, 0x0A, 0x01, 0xFC, 0xFF, 0xFB, 0x05, 0x02, 0x05, 0xF6, 0xFB,
+0xFF, 0xF7, 0x02, 0x07, 0x01, 0xFC, 0x07, 0x0B, 0xFA, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF5,
+0x0B, 0x00, 0xFA, 0xFE, 0x03, 0x09, 0x06, 0x09, 0xFA, 0xFF, 0x04, 0x04, 0xFF, 0xFC, 0x00, 0xF9,
+0x09, 0xF7, 0x00, 0x05, 0x0A, 0xFD, 0xFE, 0x07, 0xF9, 0xFC, 0xFA, 0xF8, 0xFF, 0xF9, 0x02, 0xFB,
+0x05, 0x05, 0xF4, 0x05, 0x03, 0x06, 0x01, 0x08, 0x00, 0x0A, 0xFE, 0xFF, 0x08, 0x04, 0xFB, 0xFA,
+0x07, 0xFD, 0x08, 0x0A, 0x05, 0xFB, 0x03, 0x00, 0xFE, 0x03, 0xF7, 0xF7, 0x06, 0x00, 0x04, 0xFA,
+0x06, 0x05, 0xFF, 0x01, 0xFD, 0x05, 0x01, 0x02, 0xFA, 0x00, 0xF6, 0x04, 0x05, 0xFA, 0xFF, 0xF9,
+0x03, 0xF9, 0x0A, 0x05, 0x03, 0xFC, 0x01, 0x03, 0xFC, 0xFB, 0xF9, 0xFC, 0x05, 0xFA, 0x06, 0xFB,
+0x04, 0x03, 0xFD, 0x04, 0xFB, 0x04, 0x06, 0x03, 0xFD, 0x08, 0xFC, 0x07, 0x09, 0xFD, 0xFC, 0xFA,
+0x04, 0xFE, 0x06, 0x05, 0x03, 0xFE, 0x05, 0x05, 0xFD, 0xF7, 0xFB, 0xFC, 0x05, 0xFC, 0x02, 0xFD,
+0x06, 0x00, 0xFE, 0x04, 0xFB, 0x04, 0x07, 0x05, 0xFC, 0x03, 0xFB, 0x05, 0x03, 0xFB, 0xFD, 0xFC,
+0x04, 0xFF, 0x07, 0x05, 0x07, 0xF9, 0x06, 0xFF, 0xFB, 0xF4, 0xFA, 0xFE, 0x0B, 0xF9, 0x01, 0x00,
+0xFF, 0x03, 0xFA, 0x03, 0xFE, 0x0A, 0x05, 0x05, 0xF9, 0x00, 0xF7, 0x03, 0x04, 0xFA, 0xFA, 0xFA,
+0x03, 0xFE, 0x05, 0x05, 0x03, 0xF5, 0x03, 0x07, 0x01, 0xFD, 0xFF, 0xFB, 0x07, 0xF9, 0x01, 0xFD,
+0x08, 0x06, 0xF5, 0x07, 0xFD, 0x06, 0x06, 0x04, 0xFB, 0xFB, 0xF6, 0x01, 0x0A, 0xF5, 0xFB, 0xFB,
+0x09, 0xFC, 0x08, 0x04, 0x07, 0xF9, 0x01, 0x03, 0xFC, 0x0B, 0xFC, 0x02, 0x04, 0xFF, 0x00, 0x00,
+0x01, 0x02, 0xF9, 0x09, 0xFB, 0x04, 0x08, 0x05, 0xF7, 0x00, 0xFE, 0x01, 0x06, 0xFB, 0xFC, 0xFC,
+0xFF, 0x02, 0x02, 0x08, 0x03, 0xF9, 0x03, 0x01, 0xFC, 0xFA, 0xF7, 0x01, 0x00, 0x04, 0x08, 0xFA,
+0x02, 0x0A, 0xF7, 0x0A, 0x03, 0xFF, 0x07, 0x02, 0xF8, 0xFB, 0xFC, 0x02, 0x02, 0xFB, 0xFD, 0xF6,
+0x03, 0xF6, 0x03, 0x03, 0x05, 0xF8, 0x05, 0x01, 0xFB, 0x0B, 0xFA, 0x02, 0x0B, 0xF1, 0x03, 0x00,
+0x03, 0x03, 0xF7, 0x03, 0xFD, 0x0B, 0x07, 0x04, 0xFE, 0x00, 0xFD, 0x07, 0x0B, 0x01, 0xFA, 0xFE,
+0xFE, 0xF9, 0x00, 0x05, 0x07, 0xFC, 0xFF, 0x03, 0xFB, 0x01, 0xF7, 0xFD, 0x07, 0xF3, 0x07, 0xF6,
+0x01, 0x09, 0xFB, 0x08, 0x01, 0x05, 0x03, 0x08, 0x02, 0xFD, 0xFD, 0x00, 0x07, 0x05, 0xFD, 0xF8,
+0x02, 0xF5, 0x09, 0x07, 0x08, 0xF7, 0x09, 0x01, 0xFA, 0xFC, 0xFB, 0xFA, 0x05, 0xF7, 0x04, 0xFB,
+0x03, 0x02, 0xFD, 0x04, 0xFD, 0x03, 0x03, 0x03, 0xFA, 0x06, 0xFE, 0x07, 0x05, 0xFD, 0xFD, 0xFB,
+0x05, 0xFA, 0x06, 0x04, 0x04, 0xFB, 0x05, 0x05, 0xFA, 0xF6, 0xFA, 0xFC, 0x05, 0xF5, 0x09, 0x01,
+0x05, 0x03, 0xFA, 0xFE, 0xFC, 0x02, 0x01, 0x01, 0xFA, 0x07, 0x00, 0x07, 0x04, 0xFB, 0xFD, 0xFF,
+0x04, 0xFC, 0x08, 0x08, 0x05, 0xF9, 0x07, 0x05, 0xFA, 0xF7, 0xFC, 0xFC, 0x05, 0xF0, 0x07, 0xFE,
+0x02, 0x02, 0xFB, 0x05, 0xFD, 0x06, 0x09, 0x09, 0xFB, 0x02, 0xF9, 0x06, 0x08, 0xFC, 0xFA, 0xFC,
+0x00, 0xF7, 0x03, 0x06, 0x08, 0xFA, 0x02, 0x04, 0x02, 0xFF, 0x01, 0xFD, 0x01, 0xF8, 0x08, 0xFF,
+0x09, 0x01, 0xF7, 0x0C, 0x00, 0x04, 0x02, 0x02, 0xFE, 0x08, 0xFE, 0x08, 0x05, 0xF9, 0xFF, 0xFF,
+0x03, 0xFF, 0x07, 0x04, 0x09, 0x01, 0x01, 0x04, 0xFC, 0xFA, 0xF9, 0xFB, 0x04, 0xF8, 0x05, 0xFE,
+0x00, 0x03, 0xF9, 0x05, 0x02, 0x03, 0x02, 0xFD, 0xFA, 0x09, 0x01, 0x08, 0xFF, 0xFC, 0xFC, 0xFF,
+0x01, 0x00, 0x0B, 0x08, 0xFF, 0x01, 0x07, 0x01, 0xF4, 0xFE, 0xF5, 0xFD, 0x04, 0xF0, 0x06, 0xF8,
+0x01, 0x06, 0xFF, 0x00, 0xFC, 0x04, 0x02, 0x05, 0xFF, 0x09, 0xF6, 0x01, 0x08, 0xFE, 0xFE, 0xFC,
+0x06, 0xF6, 0x04, 0x05, 0x07, 0xFB, 0x02, 0x01, 0xFE, 0x03, 0x02, 0xF9, 0xFF, 0xFA, 0x0B, 0xF8,
+0xFF, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0x0D, 0x04, 0xFE, 0xFB, 0xF9, 0x05, 0x02, 0xFB, 0xF5, 0xFE,
+0x07, 0xFB, 0x0B, 0x02, 0x05, 0xFA, 0x04, 0x04, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0xFA, 0x06, 0xF9,
+0x05, 0x09, 0xFD, 0x07, 0x00, 0x02, 0x09, 0x06, 0xFB, 0x00, 0xFE, 0x06, 0x0A, 0xFE, 0xFC, 0xFC,
+0x05, 0xFB, 0x04, 0x01, 0x05, 0xFE, 0x02, 0x01, 0xFE, 0xFD, 0xF8, 0x02, 0x03, 0xF2, 0x05, 0xF7,
+0x01, 0x08, 0xF9, 0x07, 0xFA, 0x01, 0x06, 0x09, 0x00, 0x03, 0xF9, 0x02, 0x09, 0xFF, 0xFD, 0xFA,
+0x07, 0xF9, 0x07, 0x08, 0x07, 0xFD, 0x05, 0x04, 0xFD, 0xF9, 0xFD, 0xFD, 0xFF, 0xF7, 0x04, 0x00,
+0x06, 0x09, 0xF9, 0x09, 0xFA, 0x05, 0x07, 0x04, 0xFD, 0x00, 0xF9, 0x03, 0x07, 0xFD, 0xF9, 0xFA,
+0x06, 0xFB, 0x05, 0xFF, 0x01, 0xFB, 0x04, 0x08, 0xFC, 0xFE, 0xFE, 0xFD, 0x04, 0xF8, 0x04, 0xFE,
+0x07, 0x09, 0xFA, 0x05, 0x05, 0x07, 0x00, 0x09, 0xFD, 0xFA, 0xFE, 0x08, 0x03, 0xF9, 0xFF, 0xF7,
+0xFF, 0xF8, 0x06, 0x08, 0x0A, 0x01, 0x08, 0x05, 0xF6, 0x01, 0x01, 0xF9, 0xFF, 0xF2, 0x01, 0xFA,
+0x01, 0x02, 0xFE, 0xFD, 0xFE, 0x03, 0x01, 0xFE, 0xFE, 0x07, 0xF8, 0x06, 0xFF, 0x00, 0xF5, 0xFD,
+0x05, 0xFA, 0x0A, 0x07, 0x0B, 0xF7, 0x01, 0x05, 0xF9, 0x04, 0xF9, 0xF7, 0x06, 0xF1, 0x04, 0xF9,
+0x02, 0xFF, 0xFB, 0xFA, 0x04, 0x05, 0xFB, 0xFD, 0xFD, 0xFF, 0x00, 0x06, 0x05, 0xFE, 0x01, 0x00,
+0xFA, 0xFD, 0xFF, 0x04, 0xFB, 0xFF, 0xFC, 0x00, 0xFA, 0xFA, 0x06, 0x06, 0x04, 0xFC, 0x03, 0x05,
+0xFF, 0x05, 0xFB, 0x04, 0x02, 0x00, 0x0B, 0x09, 0x04, 0x05, 0xFF, 0x07, 0xFF, 0xF9, 0xF6, 0xF8,
+0x06, 0xF9, 0x08, 0x01, 0x07, 0xFD, 0x01, 0x01, 0xFF, 0x03, 0xFE, 0xF9, 0x06, 0xFD, 0x06, 0xFD,
+0x04, 0x02, 0xF6, 0x04, 0x01, 0x03, 0x02, 0x09, 0xF9, 0x02, 0xFD, 0x05, 0x03, 0xFB, 0x00, 0x00,
+0x08, 0xF7, 0x07, 0x01, 0x03, 0xF9, 0x03, 0x04, 0xFE, 0x04, 0xF4, 0xFB, 0x03, 0xF9, 0x04, 0xF7,
+0x00, 0x0B, 0xFB, 0x0A, 0xF9, 0x08, 0x02, 0x0A, 0x01, 0x05, 0xF6, 0x01, 0x08, 0x02, 0xF7, 0xFB,
+0x03, 0x00, 0x03, 0x00, 0x03, 0xFC, 0x04, 0x05, 0xFF, 0xFF, 0xFA, 0x01, 0x08, 0x00, 0x09, 0xFE,
+0x03, 0x07, 0x02, 0x01, 0xF7, 0x08, 0x04, 0x05, 0xFE, 0x01, 0xFA, 0x01, 0x0A, 0xFF, 0xF8, 0xFA,
+0x04, 0xFA, 0x06, 0x05, 0x04, 0xFB, 0x06, 0x09, 0xFF, 0xFA, 0x01, 0xF6, 0x08, 0xFB, 0x00, 0x00,
+0x03, 0x04, 0x00, 0xFD, 0x02, 0x06, 0x0B, 0x06, 0x00, 0x07, 0xFE, 0x07, 0x04, 0xF7, 0xF8, 0xFA,
+0xFF, 0xFC, 0x07, 0x04, 0x05, 0xFC, 0x01, 0x09, 0xF8, 0x04, 0xFB, 0xFA, 0x08, 0xF9, 0x05, 0xFB,
+0x01, 0x07, 0xFD, 0x05, 0xFD, 0x02, 0x05, 0x03, 0xF9, 0x08, 0x00, 0x00, 0x03, 0x00, 0xFB, 0xFB,
+0xFE, 0xF7, 0x06, 0x0A, 0x0B, 0xFF, 0x0C, 0x05, 0x04, 0x02, 0xF6, 0xFF, 0x06, 0xF7, 0x0C, 0xF9,
+0x04, 0x01, 0xFD, 0x0C, 0x02, 0x05, 0x08, 0x00, 0xFC, 0x06, 0xFF, 0x03, 0x05, 0x02, 0xF6, 0xF8,
+0x0B, 0xF9, 0x0B, 0x06, 0x03, 0x01, 0x04, 0x0C, 0xFE, 0x04, 0xF5, 0xF6, 0x00, 0xEE, 0x01, 0x01,
+0xFD, 0x09, 0xFB, 0x09, 0x03, 0x05, 0x0A, 0x04, 0xF9, 0xF8, 0xF5, 0x01, 0x0A, 0xFF, 0x00, 0x02,
+0x05, 0xF7, 0x04, 0x00, 0x03, 0xF7, 0x09, 0x00, 0xFF, 0x06, 0xF7, 0xF8, 0x05, 0xFA, 0x05, 0xF9,
+0x04, 0x09, 0xFE, 0x02, 0xF7, 0x02, 0x09, 0x05, 0xFE, 0x05, 0xFC, 0x00, 0x02, 0x03, 0xFD, 0xFD,
+0x07, 0xFE, 0x07, 0x03, 0x00, 0xFF, 0x09, 0x00, 0xFA, 0xFC, 0xFB, 0x00, 0x07, 0xF9, 0x03, 0xFC,
+0x0A, 0x02, 0xFF, 0x01, 0xF9, 0x0A, 0x0A, 0x03, 0xFC, 0x00, 0xF7, 0x02, 0x04, 0x01, 0xFD, 0xFC,
+0x04, 0xFD, 0x01, 0x00, 0x07, 0xF6, 0x07, 0x07, 0xF9, 0xFE, 0x02, 0x01, 0x03, 0xFD, 0x07, 0x00,
+0xFD, 0x03, 0xFE, 0x0C, 0xFA, 0x04, 0x08, 0x0A, 0x00, 0xFE, 0xF5, 0x00, 0x09, 0x07, 0xF8, 0xFD,
+0x0A, 0xF6, 0x08, 0x09, 0x0A, 0xFD, 0x07, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x02, 0xF1, 0x02, 0x02,
+0x0B, 0x07, 0xFB, 0x03, 0xFF, 0xFF, 0x00, 0x05, 0x03, 0x03, 0xF7, 0x00, 0x02, 0x00, 0xF6, 0x01,
+0x00, 0xF6, 0xFF, 0x06, 0x0B, 0xFC, 0x04, 0x05, 0x05, 0xFD, 0xFA, 0xFE, 0x05, 0xF5, 0x08, 0x00,
+0x01, 0x03, 0xFD, 0xFE, 0xFB, 0x02, 0x04, 0x02, 0xFF, 0x06, 0xF8, 0xFE, 0x0B, 0x02, 0xFF, 0xFB,
+0x03, 0xF9, 0x09, 0x04, 0x0A, 0x00, 0x00, 0x01, 0xF9, 0xFD, 0xFB, 0xFA, 0xFE, 0xF4, 0x00, 0xF7,
+0xFF, 0x05, 0xF6, 0x03, 0xF9, 0x07, 0x04, 0x01, 0xFC, 0xFF, 0xF7, 0xFC, 0x06, 0x05, 0xF6, 0xFE,
+0x05, 0xF9, 0x06, 0x01, 0x05, 0xFD, 0x07, 0x09, 0x00, 0xFF, 0xF8, 0xFC, 0x01, 0xFC, 0x04, 0xFC,
+0xFF, 0x05, 0xFD, 0xFB, 0xFE, 0x04, 0x04, 0x00, 0xFC, 0x02, 0x01, 0xFB, 0xFD, 0x05, 0x02, 0xFF,
+0xFA, 0x06, 0x02, 0xFD, 0xFB, 0x05, 0x06, 0x00, 0xFE, 0x04, 0xFD, 0xFF, 0x02, 0x05, 0xFF, 0x00,
+0x09, 0x0A, 0xFE, 0x03, 0xFC, 0x06, 0x05, 0x05, 0x04, 0x08, 0xFE, 0xFE, 0x06, 0xFF, 0xFF, 0xF7,
+0x00, 0xF7, 0xFF, 0x02, 0x08, 0xFC, 0x03, 0x02, 0x00, 0x00, 0xFD, 0xF6, 0x08, 0xF4, 0x05, 0xFE,
+0x05, 0x05, 0xFA, 0x04, 0xF9, 0x04, 0x07, 0x06, 0xFB, 0x05, 0xF8, 0x06, 0x08, 0xFC, 0xFB, 0xF8,
+0x0B, 0xF9, 0x06, 0x07, 0x0A, 0xFD, 0x06, 0x06, 0xF8, 0xFB, 0xF9, 0xFB, 0x09, 0xF0, 0x07, 0xF9,
+0x06, 0x08, 0xF8, 0x0C, 0xFB, 0x04, 0x09, 0x06, 0xF9, 0x04, 0xFB, 0x06, 0x0A, 0xFA, 0xFB, 0xFC,
+0x0A, 0xFA, 0x06, 0x06, 0x07, 0xFC, 0x04, 0x05, 0xFA, 0xFC, 0xF9, 0xF8, 0x09, 0xF0, 0x08, 0xFA,
+0x08, 0x06, 0xFA, 0x04, 0xFE, 0x05, 0x07, 0x05, 0xF7, 0x08, 0xFC, 0x06, 0x09, 0xF8, 0xF9, 0xF9,
+0x0B, 0xF9, 0x05, 0x08, 0x05, 0xFD, 0x06, 0x05, 0xFB, 0xF8, 0xFA, 0xFA, 0x0A, 0xE9, 0x07, 0xFC,
+0x05, 0x03, 0xFA, 0x06, 0xFC, 0x05, 0x09, 0x03, 0xF8, 0x09, 0xFB, 0x03, 0x08, 0xF6, 0xFA, 0xF9,
+0x08, 0xFA, 0x05, 0x09, 0x03, 0xFB, 0x04, 0x06, 0xF8, 0xF1, 0xFB, 0xF9, 0x06, 0xF0, 0x04, 0xFE,
+0x07, 0x03, 0xFA, 0x08, 0xFB, 0x03, 0x05, 0x06, 0xF8, 0x07, 0xFB, 0x07, 0x07, 0xFA, 0xFB, 0xF9,
+0x09, 0xFA, 0x06, 0x07, 0x07, 0xFE, 0x04, 0x07, 0xFB, 0xF4, 0xFB, 0xF9, 0x07, 0xFA, 0x07, 0xFC,
+0x06, 0x04, 0xF7, 0x07, 0xFA, 0x03, 0x06, 0x08, 0xF7, 0x06, 0xFC, 0x07, 0x07, 0xFE, 0xFA, 0xFB,
+0x0A, 0xFD, 0x08, 0x06, 0x07, 0xF9, 0x05, 0x08, 0xFA, 0xFA, 0xF8, 0xF9, 0x07, 0xFF, 0x07, 0xFB,
+0x07, 0x03, 0xFC, 0x06, 0xFA, 0x06, 0x05, 0x07, 0xF9, 0x08, 0xFB, 0x07, 0x07, 0xFA, 0xFC, 0xFB,
+0x0B, 0xFA, 0x09, 0x05, 0x06, 0xF9, 0x02, 0x08, 0xFA, 0xF8, 0xFA, 0xFB, 0x08, 0xF6, 0x07, 0xF9,
+0x08, 0x03, 0xFC, 0x09, 0xFB, 0x03, 0x09, 0x05, 0xF8, 0x07, 0xF8, 0x08, 0x08, 0xF9, 0xFD, 0xF9,
+0x08, 0xFD, 0x07, 0x06, 0x09, 0xF9, 0x04, 0x05, 0xFB, 0xF5, 0xFB, 0xFC, 0x0A, 0xE4, 0x06, 0xFA,
+0x07, 0x07, 0xF8, 0x08, 0xFB, 0x04, 0x09, 0x04, 0xFD, 0x03, 0xF5, 0x04, 0x09, 0xFB, 0xF7, 0xF7,
+0x09, 0xFD, 0x01, 0x09, 0x0B, 0xFE, 0x04, 0x08, 0xF9, 0xFC, 0xFC, 0xFD, 0x08, 0xED, 0x08, 0xF7,
+0x06, 0x09, 0xFA, 0x06, 0xF8, 0x05, 0x05, 0x0E, 0xFC, 0xFD, 0xFC, 0x0B, 0x0B, 0xFE, 0xF9, 0xF5,
+0x05, 0xF9, 0x03, 0x04, 0x08, 0xFC, 0x09, 0x0B, 0xF6, 0x03, 0xFD, 0xF9, 0x07, 0xF1, 0x09, 0xF9,
+0x03, 0x09, 0xF9, 0x05, 0xFC, 0x0B, 0x0C, 0x0C, 0xFC, 0x02, 0xF7, 0x05, 0x05, 0xFD, 0xF6, 0xFB,
+0x05, 0xF2, 0x08, 0x09, 0x09, 0xF7, 0x05, 0x07, 0xF7, 0x05, 0xFE, 0xFC, 0x01, 0xEE, 0x06, 0xFB,
+0x01, 0x05, 0xFA, 0x08, 0xF6, 0x07, 0x02, 0x0A, 0xFA, 0x05, 0xFB, 0x09, 0x0C, 0xFD, 0xFC, 0xFE,
+0x05, 0xF4, 0x09, 0x06, 0x0B, 0xF6, 0x0A, 0x04, 0xF7, 0xFC, 0xF8, 0xFB, 0x03, 0xF8, 0x03, 0xFE,
+0x06, 0x04, 0xFD, 0x0C, 0xFA, 0x09, 0x09, 0x06, 0xFB, 0x03, 0xFD, 0x0D, 0x02, 0xF8, 0xFC, 0xF9,
+0x08, 0xF6, 0x07, 0x04, 0x06, 0xF6, 0x08, 0x05, 0xFB, 0x01, 0xFD, 0xFD, 0x08, 0xF6, 0x06, 0xF5,
+0x08, 0x04, 0xFA, 0x06, 0xFA, 0x08, 0x06, 0x03, 0xF8, 0x04, 0xF5, 0x0A, 0x02, 0xF2, 0xFE, 0xFC,
+0x05, 0xF7, 0x06, 0x01, 0x09, 0xFD, 0x03, 0x08, 0xF8, 0xF7, 0xFD, 0xFB, 0x07, 0xF7, 0x09, 0xFA,
+0x07, 0x08, 0xFE, 0x08, 0xFA, 0x04, 0x08, 0x03, 0xF9, 0x06, 0xF8, 0x01, 0x08, 0xFA, 0xF7, 0xFC,
+0x09, 0xFE, 0x09, 0x04, 0x07, 0xF8, 0x0B, 0x06, 0xFD, 0xF4, 0xF9, 0xFE, 0x04, 0xF6, 0x06, 0xFC,
+0x04, 0x06, 0xFB, 0x09, 0xF9, 0x03, 0x06, 0x07, 0xF5, 0x01, 0xFB, 0x06, 0x05, 0xFB, 0xF7, 0xFA,
+0x09, 0xFA, 0x07, 0x03, 0x05, 0xF9, 0x06, 0x04, 0xFA, 0xF7, 0xF8, 0xF8, 0x09, 0xF0, 0x09, 0xFE,
+0x0D, 0x08, 0xF8, 0x08, 0xFC, 0x04, 0x02, 0x0A, 0xFA, 0x04, 0xF9, 0x05, 0x07, 0xFF, 0xF8, 0xFC,
+0x0A, 0xF4, 0x04, 0x08, 0x0C, 0xF7, 0x08, 0x09, 0xFF, 0x03, 0xF8, 0xFD, 0x05, 0xF0, 0x07, 0xF8,
+0x05, 0x0A, 0xFC, 0x05, 0xF8, 0x09, 0x07, 0x07, 0xFB, 0x05, 0xFA, 0x0A, 0x02, 0xFD, 0xFC, 0xF9,
+0x09, 0xF9, 0x05, 0x08, 0x06, 0xFA, 0x04, 0x05, 0xFA, 0xF7, 0xFA, 0xF8, 0x05, 0xF1, 0x0B, 0xF7,
+0x05, 0x08, 0xF8, 0x09, 0xFF, 0x06, 0x0A, 0x08, 0xFE, 0x05, 0xF9, 0x07, 0x02, 0xFB, 0xF7, 0xFE,
+0x07, 0xF8, 0x05, 0x0A, 0x08, 0xF6, 0x08, 0x05, 0xF8, 0xF9, 0xF9, 0xF9, 0x09, 0xF9, 0x07, 0xFC,
+0x0B, 0x06, 0xF3, 0x08, 0xF6, 0x05, 0x05, 0x0E, 0xF9, 0x05, 0xF3, 0x05, 0x06, 0xFF, 0xF8, 0xFA,
+0x00, 0xFA, 0x07, 0x05, 0x09, 0xF8, 0x08, 0x06, 0xFD, 0xFF, 0xFC, 0xFE, 0x01, 0xF2, 0x09, 0xFB,
+0x08, 0x05, 0xF5, 0x0E, 0xFD, 0x04, 0x07, 0x0E, 0x01, 0x06, 0xF6, 0x05, 0x0B, 0xF9, 0xF3, 0xFE,
+0x03, 0xFE, 0x0E, 0x05, 0x09, 0xFD, 0x08, 0x08, 0xFB, 0x00, 0xFE, 0xFC, 0x0B, 0xF6, 0x06, 0xFF,
+0x04, 0x03, 0xF5, 0x0A, 0xF6, 0x05, 0x08, 0x07, 0xFC, 0x0A, 0xFA, 0x05, 0x0D, 0xFB, 0xFF, 0xF6,
+0x08, 0xFE, 0x0B, 0x04, 0x08, 0xFD, 0x06, 0x08, 0xFF, 0xF6, 0xF6, 0xF6, 0x05, 0xF9, 0x09, 0x01,
+0x02, 0x07, 0xF7, 0x0B, 0x02, 0x07, 0x09, 0x0E, 0xFD, 0x00, 0xFC, 0x0A, 0x0A, 0xFD, 0xF7, 0xF8,
+0x06, 0xFB, 0x0C, 0x05, 0x01, 0xF3, 0x07, 0x10, 0xFB, 0x02, 0xFE, 0xFA, 0x02, 0xFA, 0x07, 0xF6,
+0x03, 0x07, 0xFB, 0x0C, 0xF8, 0x03, 0x07, 0x03, 0xFE, 0x05, 0xF3, 0x04, 0x08, 0xFE, 0xFC, 0xF6,
+0x0A, 0xF4, 0x06, 0x07, 0x03, 0xFA, 0x06, 0x01, 0xF9, 0xFA, 0xFC, 0xF7, 0x0B, 0xF2, 0x0A, 0xFB,
+0x08, 0x03, 0xFA, 0x06, 0xFF, 0x0A, 0x06, 0x0D, 0xF9, 0x03, 0xFD, 0x05, 0x05, 0xF3, 0xFA, 0xFF,
+0x0C, 0xFA, 0x05, 0x07, 0x0B, 0xFE, 0x0C, 0x01, 0xFF, 0xFF, 0xF5, 0xF4, 0x06, 0xF3, 0x02, 0xFD,
+0x05, 0x09, 0xF6, 0x08, 0x00, 0x06, 0x03, 0x03, 0xFA, 0x06, 0xF8, 0x09, 0x03, 0xF8, 0xF7, 0xFE,
+0x05, 0xF6, 0x07, 0x06, 0x06, 0xFF, 0x05, 0x07, 0xF9, 0xF4, 0xFE, 0xF7, 0x05, 0xF4, 0x06, 0xFE,
+0x06, 0x08, 0xF5, 0x05, 0xFA, 0x05, 0x05, 0x02, 0xF9, 0x0D, 0xF9, 0x06, 0x02, 0xF9, 0xF8, 0xFB,
+0x09, 0xF7, 0x02, 0x04, 0x06, 0xFB, 0x07, 0x06, 0xF6, 0xFD, 0xF8, 0xFC, 0x08, 0xF4, 0x0C, 0xFC,
+0x05, 0x08, 0xF5, 0x07, 0xF8, 0x05, 0x05, 0x06, 0xF7, 0x04, 0xFC, 0x08, 0x04, 0xF9, 0xFC, 0xFC,
+0x0A, 0xF7, 0x09, 0x04, 0x0D, 0xF5, 0x04, 0x05, 0xF8, 0xFC, 0xFD, 0xF9, 0x08, 0xF4, 0x06, 0xFE,
+0xFF, 0x03, 0xF8, 0x09, 0xF7, 0x0B, 0x06, 0x08, 0xFC, 0x00, 0xF2, 0x06, 0x08, 0xFB, 0xFD, 0xFE,
+0x08, 0xF6, 0x0A, 0x0B, 0x04, 0xFA, 0x0B, 0x02, 0xF4, 0xFD, 0xF8, 0xFA, 0x05, 0xF2, 0x05, 0xF4,
+0x05, 0x06, 0xF5, 0x08, 0xF8, 0x09, 0x09, 0x0B, 0xFE, 0x02, 0xF8, 0x01, 0x03, 0xFF, 0xF7, 0xFD,
+0x04, 0xF7, 0x0D, 0x0C, 0x06, 0xF0, 0x08, 0x03, 0xF8, 0xFD, 0xF9, 0xF8, 0x06, 0xF3, 0x05, 0x00,
+0x07, 0x08, 0xFD, 0x06, 0xFE, 0x05, 0x06, 0x07, 0xFA, 0x02, 0xF6, 0x03, 0x07, 0xFE, 0xFF, 0xF5,
+0x03, 0xF9, 0x06, 0x0B, 0x0A, 0xF4, 0x0A, 0x06, 0x01, 0xFD, 0xF5, 0xF6, 0x03, 0xFC, 0x03, 0xF5,
+0x08, 0x0C, 0xFB, 0x09, 0xFA, 0x04, 0x04, 0x0A, 0xFA, 0xFE, 0xF9, 0x03, 0x04, 0x01, 0xF3, 0xFA,
+0x03, 0xF4, 0x02, 0x00, 0x06, 0xF4, 0x05, 0x0B, 0xF8, 0xFD, 0xFA, 0xFE, 0x02, 0xF3, 0x0A, 0xF8,
+0x0B, 0x07, 0xFA, 0x0C, 0xF5, 0x03, 0x03, 0x00, 0xF9, 0x07, 0xF5, 0x02, 0x03, 0xFA, 0xF6, 0xFE,
+0x0A, 0xFC, 0x02, 0x09, 0x0A, 0xF8, 0x07, 0x07, 0xF8, 0xFF, 0xFC, 0xFD, 0x0A, 0xF1, 0x06, 0xF6,
+0x08, 0x03, 0xFD, 0x07, 0xFB, 0x06, 0x02, 0x07, 0xF8, 0x08, 0xFB, 0x00, 0x0A, 0xFC, 0xF8, 0xFC,
+0x07, 0xFB, 0x09, 0x03, 0x09, 0xFC, 0x01, 0x0A, 0xF9, 0xFA, 0xFB, 0xFA, 0x0B, 0xF6, 0x0D, 0xFE,
+0x04, 0x07, 0xFE, 0x0E, 0xF6, 0x04, 0x0B, 0x04, 0xF9, 0x08, 0xF9, 0x02, 0x07, 0xFC, 0xF3, 0xFA,
+0x09, 0xF4, 0x04, 0x05, 0x04, 0xFA, 0x06, 0x05, 0xF8, 0xFC, 0xFB, 0xF9, 0x09, 0xF6, 0x05, 0xF9,
+0x07, 0x09, 0xF4, 0x08, 0xFA, 0x0E, 0x0A, 0x04, 0xFC, 0xFF, 0xF7, 0x08, 0x03, 0xFC, 0xFD, 0xFA,
+0x0C, 0xFA, 0x05, 0x04, 0x0B, 0xF6, 0x00, 0x03, 0xF7, 0xFF, 0xFA, 0xF8, 0x08, 0xF3, 0x08, 0xF9,
+0x09, 0x07, 0xFD, 0x0B, 0xF7, 0x05, 0x0B, 0x0C, 0xFC, 0x04, 0x00, 0x03, 0x09, 0xF7, 0xFB, 0xFF,
+0x0A, 0xFD, 0x07, 0x0B, 0x0B, 0xF7, 0x0A, 0x00, 0xF7, 0xF7, 0xFD, 0xF8, 0xFE, 0xF1, 0x08, 0xFF,
+0x0A, 0x08, 0xFA, 0x0A, 0xFC, 0x07, 0x09, 0x09, 0xFA, 0x05, 0xF7, 0x00, 0x0D, 0xFD, 0xF3, 0xF9,
+0x03, 0xFB, 0x05, 0x0B, 0x05, 0xF7, 0x05, 0x06, 0x00, 0x01, 0xF5, 0xF8, 0x06, 0xEE, 0x0A, 0xF9,
+0x08, 0x04, 0xFA, 0x02, 0xFB, 0x06, 0x06, 0x09, 0xFA, 0x04, 0xF9, 0x05, 0x02, 0xF7, 0xF5, 0xFA,
+0x09, 0xFA, 0x06, 0x0D, 0x02, 0xF8, 0x09, 0x0D, 0xFC, 0xFD, 0x01, 0xFD, 0x08, 0xF1, 0x06, 0x01,
+0x06, 0x05, 0xF5, 0x05, 0xFF, 0x08, 0x09, 0x06, 0xFD, 0x06, 0xFA, 0x02, 0x0C, 0xFF, 0xFB, 0xFA,
+0x09, 0xF8, 0x07, 0x0F, 0x05, 0xFB, 0x05, 0x06, 0xFD, 0x00, 0xF6, 0xFA, 0x11, 0xEB, 0x08, 0xF8,
+0x06, 0x02, 0xF9, 0x05, 0xFD, 0x03, 0x0A, 0x0B, 0xFA, 0x06, 0xF6, 0x0A, 0xFE, 0xFD, 0xFE, 0xFD,
+0x02, 0xF9, 0x03, 0x00, 0x08, 0xF7, 0x08, 0x0C, 0xFD, 0xFC, 0xF5, 0xFB, 0x0D, 0xF1, 0x09, 0xF2,
+0x05, 0x08, 0xFD, 0x08, 0xFC, 0x05, 0x05, 0x05, 0xFD, 0x03, 0xF5, 0x06, 0x0C, 0xFE, 0xF2, 0xF4,
+0x05, 0xF1, 0x07, 0x08, 0x05, 0xF2, 0x06, 0x07, 0xFF, 0xFF, 0xFD, 0xFA, 0x02, 0xF3, 0x0B, 0xF9,
+0x06, 0x07, 0xF3, 0x0C, 0xFC, 0x05, 0x0C, 0x0B, 0xFF, 0x05, 0xF5, 0x00, 0x06, 0xFB, 0xFD, 0xFC,
+0x06, 0xFA, 0x0A, 0x09, 0x0B, 0xFC, 0x06, 0x05, 0xFE, 0xF7, 0xF7, 0xF7, 0x07, 0xF9, 0x02, 0xFD,
+0x07, 0x07, 0xF9, 0x07, 0xFB, 0x02, 0x09, 0x0B, 0xF8, 0x00, 0xFB, 0x0E, 0x06, 0xFD, 0xFA, 0xF5,
+0x0B, 0xF5, 0x03, 0x04, 0x0A, 0xFC, 0x07, 0x07, 0xFB, 0x01, 0xF9, 0xF6, 0x06, 0xF1, 0x0B, 0xF8,
+0x0A, 0x05, 0xF4, 0x09, 0xF9, 0x0B, 0x08, 0x0C, 0xF9, 0x02, 0xFA, 0x08, 0x09, 0xFB, 0xFA, 0xF8,
+0x03, 0xFA, 0x03, 0x02, 0x05, 0xFD, 0x05, 0x0A, 0xF4, 0x07, 0xFB, 0xF4, 0x06, 0xF9, 0x06, 0xF5,
+0x02, 0x07, 0xF9, 0x05, 0xFD, 0x0C, 0x08, 0x06, 0xFA, 0x0A, 0xF4, 0x0A, 0x05, 0xFB, 0xF9, 0xF9,
+0x03, 0xFC, 0x06, 0x07, 0x01, 0xFA, 0x08, 0x06, 0xFC, 0x01, 0xFA, 0xF0, 0x08, 0xF4, 0x04, 0xF4,
+0x08, 0x06, 0xFA, 0x05, 0xF8, 0x05, 0x0B, 0x09, 0xF6, 0x04, 0xF9, 0x01, 0xFF, 0xF8, 0xF5, 0xFA,
+0x07, 0xFC, 0x05, 0x06, 0x0C, 0xF7, 0x07, 0x01, 0xFA, 0xF7, 0xFB, 0xF8, 0x04, 0xEF, 0x03, 0xF8,
+0x06, 0x0C, 0xF7, 0x0C, 0xFA, 0x0E, 0x06, 0x0A, 0xFA, 0x03, 0xF4, 0x08, 0x04, 0xFB, 0xFB, 0x01,
+0x04, 0xFD, 0x05, 0x00, 0x05, 0xF8, 0x08, 0x09, 0xFD, 0xFE, 0xFB, 0xFE, 0xFF, 0xF5, 0x0D, 0xF9,
+0x05, 0x06, 0xFA, 0x07, 0xF9, 0x04, 0x04, 0x07, 0xF9, 0x08, 0xFB, 0x06, 0x06, 0xFB, 0xFA, 0xFB,
+0x0A, 0xF8, 0x09, 0x07, 0x08, 0xF9, 0x03, 0x07, 0xFA, 0xFD, 0xF8, 0xFB, 0x0B, 0xF4, 0x04, 0xFA,
+0x05, 0x08, 0xFC, 0x07, 0xF9, 0x05, 0x09, 0x05, 0xF9, 0x08, 0xFA, 0x08, 0x04, 0xFA, 0xFD, 0xFB,
+0x07, 0xFA, 0x06, 0x08, 0x07, 0xFB, 0x06, 0x04, 0xF8, 0xF4, 0xFB, 0xF7, 0x09, 0xF5, 0x09, 0xFA,
+0x05, 0x08, 0xFA, 0x08, 0xFA, 0x07, 0x09, 0x07, 0xFB, 0x05, 0xFA, 0x06, 0x05, 0xFC, 0xF9, 0xFC,
+0x08, 0xF8, 0x05, 0x06, 0x08, 0xF8, 0x06, 0x07, 0xFA, 0xF9, 0xFB, 0xFB, 0x07, 0xED, 0x09, 0xFC,
+0x03, 0x0A, 0xFB, 0x06, 0xF8, 0x04, 0x08, 0x0A, 0xFD, 0x09, 0xFA, 0x04, 0x0C, 0xF7, 0xF8, 0xFB,
+0x04, 0xF6, 0x0B, 0x04, 0x05, 0xFB, 0x05, 0x07, 0xF8, 0xFC, 0xFA, 0xFB, 0x04, 0xF4, 0x09, 0xFD,
+0x07, 0x06, 0xFC, 0x05, 0xFC, 0x07, 0x07, 0x07, 0xFA, 0x06, 0xFA, 0x06, 0x05, 0xF9, 0xFB, 0xF8,
+0x0A, 0xFA, 0x07, 0x07, 0x08, 0xFB, 0x06, 0x07, 0xFB, 0xF9, 0xF6, 0xFB, 0x08, 0xF7, 0x08, 0xFB,
+0x07, 0x08, 0xFA, 0x03, 0xFB, 0x07, 0x07, 0x06, 0xFD, 0x07, 0xFA, 0x08, 0x07, 0xF6, 0xF8, 0xFE,
+0x07, 0xF9, 0x05, 0x09, 0x09, 0xF9, 0x05, 0x06, 0xF8, 0xF4, 0xFA, 0xFD, 0x06, 0xF3, 0x07, 0x02,
+0x0B, 0x09, 0xF7, 0x09, 0xF5, 0x08, 0x05, 0x09, 0xF6, 0x06, 0xFA, 0x00, 0x02, 0xF7, 0xFE, 0x00,
+0x09, 0xFE, 0x04, 0x0A, 0x09, 0xF9, 0x09, 0x04, 0xF6, 0xFE, 0xFD, 0xFC, 0x08, 0xFA, 0x07, 0xF8,
+0x08, 0x0A, 0xF6, 0x05, 0xFE, 0x08, 0x03, 0x0B, 0xFC, 0xFF, 0xF8, 0x09, 0x0B, 0x01, 0xFE, 0xFB,
+0x06, 0xFB, 0x05, 0x0B, 0x04, 0xF8, 0x0C, 0x0A, 0xF6, 0x00, 0xF8, 0xF5, 0x09, 0xF2, 0x03, 0xFB,
+0x00, 0x0C, 0xF9, 0x00, 0xFC, 0x04, 0x0A, 0x06, 0xF6, 0x01, 0xF9, 0x05, 0x03, 0xF8, 0xF7, 0xF4,
+0x07, 0xF7, 0x04, 0x0C, 0x05, 0xFA, 0x09, 0x01, 0xF3, 0x05, 0xFC, 0xF6, 0x09, 0xE7, 0x06, 0xFC,
+0x02, 0x06, 0xF9, 0x04, 0xFD, 0x09, 0x09, 0x01, 0xFB, 0x05, 0xF9, 0x0C, 0x08, 0xFF, 0xFC, 0xFE,
+0x08, 0xFF, 0x07, 0x0C, 0x06, 0xF6, 0x03, 0x05, 0xF6, 0x04, 0xFA, 0xFA, 0x05, 0xEE, 0x05, 0xF5,
+0x04, 0x0C, 0xF8, 0x08, 0xFE, 0x0B, 0x05, 0x09, 0xFC, 0x04, 0xFC, 0x01, 0x02, 0xF6, 0xFA, 0xFE,
+0x0C, 0xFB, 0x0B, 0x0D, 0x07, 0xFD, 0x0F, 0x07, 0xFD, 0x11, 0xF7, 0xFC, 0x0C, 0xF8, 0x05, 0x00,
+0x02, 0x07, 0xF3, 0x0A, 0x01, 0x0D, 0x02, 0x0C, 0xFC, 0x08, 0xF4, 0x0A, 0x09, 0xF8, 0xFA, 0x01,
+0x04, 0xFF, 0x06, 0x04, 0x00, 0xF5, 0x00, 0x09, 0xF9, 0x00, 0xF9, 0xF8, 0x03, 0xF6, 0x08, 0xFA,
+0x0B, 0x0A, 0xF4, 0x05, 0xF5, 0x00, 0xFF, 0x0B, 0xFF, 0x0B, 0xF9, 0x08, 0x03, 0x01, 0xF5, 0xFC,
+0x0B, 0xF8, 0x03, 0x05, 0x01, 0xFB, 0x08, 0x05, 0xFC, 0xFD, 0xFB, 0xF8, 0x06, 0xEB, 0x09, 0xF8,
+0x01, 0x08, 0xFC, 0x09, 0xFF, 0x03, 0x02, 0x06, 0xF5, 0x02, 0xFC, 0x0C, 0x06, 0xFF, 0x00, 0xFB,
+0x02, 0xF8, 0x00, 0x05, 0x06, 0xFF, 0x06, 0x07, 0xF5, 0xF8, 0xFA, 0xFA, 0x01, 0x02, 0x06, 0xF9,
+0xFA, 0xFD, 0x04, 0xFD, 0x05, 0x06, 0x00, 0x02, 0x03, 0xFB, 0x06, 0xFB, 0x01, 0xFE, 0x01, 0x01,
+0xFE, 0xFF, 0xFC, 0xFD, 0xFE, 0xFE, 0x00, 0xFF, 0x00, 0xFC, 0xFE, 0xFA, 0x01, 0x00, 0x02, 0x01,
+0x03, 0x00, 0xFF, 0xFE, 0xFD, 0x05, 0xFB, 0xFD, 0xFA, 0x03, 0x03, 0x04, 0xFD, 0x02, 0xFF, 0xFD,
+0x04, 0x06, 0xFE, 0xFD, 0x06, 0x01, 0x03, 0x05, 0xFA, 0x01, 0xFD, 0x05, 0x02, 0x04, 0xFD, 0x05,
+0x09, 0x07, 0xF4, 0x06, 0xF1, 0x0B, 0x12, 0x13, 0xF7, 0x04, 0xF1, 0x0D, 0x0C, 0xF8, 0xF2, 0xF6,
+0x0F, 0xF7, 0x08, 0x07, 0x0E, 0xF7, 0x10, 0x10, 0xFA, 0xFD, 0xF3, 0xF0, 0x0C, 0xED, 0x12, 0xF6,
+0x0B, 0x11, 0xEE, 0x13, 0xF2, 0x08, 0x0A, 0x10, 0xFB, 0x0B, 0xF3, 0x08, 0x09, 0xFE, 0xF0, 0xED,
+0x08, 0xF1, 0x0E, 0x10, 0x09, 0xEE, 0x0B, 0x0B, 0xF2, 0xFB, 0xF3, 0xF3, 0x10, 0xF5, 0x12, 0xF2,
+0x07, 0x08, 0xEF, 0x13, 0xF7, 0x0F, 0x0B, 0x0A, 0xFD, 0x06, 0xEE, 0x09, 0x11, 0x01, 0xED, 0xEB,
+0x05, 0xF8, 0x0A, 0x0D, 0x0C, 0xEE, 0x09, 0x12, 0xFE, 0xF7, 0xF1, 0xF1, 0x0D, 0xF7, 0x06, 0xED,
+0x0B, 0x0E, 0xEE, 0x0A, 0xF6, 0x0C, 0x0E, 0x11, 0xF4, 0x02, 0xF3, 0x09, 0x0F, 0xF9, 0xF2, 0xF2,
+0x08, 0xF0, 0x0C, 0x0C, 0x10, 0xF2, 0x0A, 0x0E, 0xFA, 0xFB, 0xF7, 0xF2, 0x10, 0xF2, 0x0E, 0xED,
+0x10, 0x0D, 0xF1, 0x15, 0xF6, 0x0A, 0x0C, 0x0B, 0xF5, 0x04, 0xF4, 0x09, 0x0F, 0xFD, 0xF0, 0xEA,
+0x08, 0xED, 0x0E, 0x0C, 0x12, 0xF6, 0x13, 0x0B, 0xF8, 0x03, 0xF3, 0xF8, 0x0A, 0xF0, 0x0F, 0xF1,
+0x0E, 0x11, 0xF1, 0x0D, 0xF5, 0x0D, 0x0C, 0x08, 0xFB, 0x09, 0xFA, 0x04, 0x0E, 0xF8, 0xF5, 0xEC,
+0x0B, 0xF6, 0x16, 0x0D, 0x08, 0xF1, 0x0B, 0x08, 0xF3, 0xFA, 0xF5, 0xF3, 0x12, 0xF0, 0x10, 0xF7,
+0x0D, 0x09, 0xF1, 0x0C, 0xF0, 0x13, 0x12, 0x0A, 0xF7, 0x09, 0xF5, 0x0D, 0x0B, 0xF5, 0xF8, 0xF9,
+0x0F, 0xF3, 0x11, 0x06, 0x0F, 0xF2, 0x12, 0x0D, 0xFD, 0xF5, 0xEE, 0xF2, 0x10, 0xEF, 0x10, 0xF7,
+0x09, 0x14, 0xF4, 0x07, 0xF4, 0x11, 0x0B, 0x06, 0xF9, 0x07, 0xF3, 0x0C, 0x06, 0xF1, 0xFA, 0xF5,
+0x08, 0xEF, 0x0F, 0x11, 0x08, 0xF3, 0x06, 0x0D, 0xF2, 0xF9, 0xF4, 0xF7, 0x10, 0xF3, 0x09, 0xF0,
+0x07, 0x0F, 0xF7, 0x12, 0xF5, 0x0D, 0x09, 0x0D, 0xFB, 0x0A, 0xF4, 0x11, 0x0B, 0xF1, 0xEE, 0xF0,
+0x07, 0xF7, 0x10, 0x10, 0x11, 0xEF, 0x0F, 0x0D, 0xF0, 0xFE, 0xFA, 0xF2, 0x05, 0xED, 0x09, 0xF5,
+0x09, 0x0A, 0xF3, 0x10, 0xF5, 0x0C, 0x10, 0x0B, 0xF8, 0x0E, 0xF0, 0x0C, 0x09, 0xFC, 0xF0, 0xF2,
+0x0C, 0xF7, 0x07, 0x07, 0x09, 0xF8, 0x0C, 0x0F, 0xF6, 0xF3, 0xF7, 0xF2, 0x0E, 0xF9, 0x0C, 0xF8,
+0x0C, 0x0C, 0xF5, 0x08, 0xF6, 0x0E, 0x0E, 0x0B, 0xF7, 0x08, 0xF5, 0x0B, 0x0B, 0xF7, 0xF5, 0xF7,
+0x0C, 0xF2, 0x0D, 0x0A, 0x09, 0xF6, 0x0C, 0x0E, 0xF5, 0xF6, 0xF4, 0xF6, 0x0A, 0xF4, 0x0C, 0xFB,
+0x0E, 0x0D, 0xF3, 0x0B, 0xF4, 0x0D, 0x0E, 0x10, 0xF6, 0x08, 0xF2, 0x07, 0x0C, 0xFA, 0xF0, 0xF8,
+0x09, 0xF4, 0x0C, 0x0C, 0x0D, 0xF7, 0x0C, 0x0E, 0xF6, 0xF4, 0xF8, 0xF3, 0x11, 0xF3, 0x07, 0xF1,
+0x0A, 0x0D, 0xF0, 0x0F, 0xF4, 0x08, 0x0F, 0x08, 0xF5, 0x07, 0xF1, 0x06, 0x0D, 0xF5, 0xF3, 0xF2,
+0x0D, 0xF3, 0x0C, 0x0D, 0x09, 0xF5, 0x0C, 0x0F, 0xF6, 0xF6, 0xF6, 0xF1, 0x09, 0xF7, 0x08, 0xF6,
+0x0C, 0x0B, 0xF1, 0x0B, 0xF5, 0x07, 0x0C, 0x0F, 0xF9, 0x0A, 0xF4, 0x0B, 0x0F, 0xF9, 0xF3, 0xF5,
+0x09, 0xF4, 0x0F, 0x0C, 0x0A, 0xF4, 0x0E, 0x09, 0xF9, 0xFB, 0xF6, 0xF4, 0x0F, 0xF1, 0x09, 0xF5,
+0x13, 0x09, 0xF1, 0x0E, 0xF6, 0x12, 0x0D, 0x0B, 0xFB, 0x0C, 0xF5, 0x09, 0x0B, 0xFE, 0xF7, 0xF5,
+0x0E, 0xF2, 0x11, 0x0A, 0x0F, 0xF4, 0x0A, 0x0E, 0xFB, 0xFA, 0xF4, 0xF8, 0x11, 0xEB, 0x11, 0xFA,
+0x0F, 0x0E, 0xF8, 0x0E, 0xF1, 0x10, 0x0E, 0x0B, 0xF3, 0x08, 0xF7, 0x09, 0x0F, 0xF7, 0xF2, 0xF4,
+0x0A, 0xF0, 0x0D, 0x09, 0x07, 0xF4, 0x0E, 0x0E, 0xF4, 0xF9, 0xF7, 0xF4, 0x11, 0xEF, 0x07, 0xF2,
+0x0E, 0x0C, 0xF6, 0x0E, 0xF2, 0x0B, 0x09, 0x0A, 0xF6, 0x0A, 0xFA, 0x0E, 0x08, 0xF4, 0xF5, 0xEF,
+0x0F, 0xF5, 0x0E, 0x09, 0x0E, 0xF4, 0x0F, 0x0D, 0xF7, 0xFB, 0xF4, 0xF4, 0x0F, 0xF1, 0x0B, 0xF2,
+0x0B, 0x0B, 0xF6, 0x0B, 0xF5, 0x0A, 0x0C, 0x07, 0xF7, 0x10, 0xF6, 0x0B, 0x09, 0xF2, 0xF7, 0xF3,
+0x0C, 0xF4, 0x0E, 0x0B, 0x0A, 0xF7, 0x0C, 0x0B, 0xF6, 0xF0, 0xF5, 0xF8, 0x0E, 0xF0, 0x0C, 0xFD,
+0x0B, 0x0B, 0xF6, 0x0C, 0xF4, 0x0B, 0x0A, 0x09, 0xF3, 0x0A, 0xF5, 0x0B, 0x0F, 0xF8, 0xF5, 0xF8,
+0x0B, 0xF2, 0x0E, 0x0A, 0x0B, 0xF7, 0x0C, 0x0B, 0xF5, 0xF2, 0xF5, 0xF6, 0x0C, 0xF1, 0x0F, 0xF7,
+0x09, 0x0C, 0xF3, 0x0C, 0xF8, 0x0A, 0x0A, 0x0A, 0xF5, 0x0E, 0xF8, 0x0D, 0x0E, 0xF8, 0xF4, 0xF4,
+0x0D, 0xF7, 0x0D, 0x0D, 0x0C, 0xF5, 0x0B, 0x0E, 0xF7, 0xEF, 0xF8, 0xF8, 0x0B, 0xF9, 0x0C, 0xF7,
+0x0A, 0x09, 0xF6, 0x0C, 0xF5, 0x09, 0x0C, 0x0A, 0xF5, 0x0B, 0xF4, 0x0C, 0x0C, 0xF5, 0xF4, 0xF7,
+0x0A, 0xF4, 0x0B, 0x0B, 0x0C, 0xF5, 0x0D, 0x0C, 0xF3, 0xF2, 0xF4, 0xF5, 0x0A, 0xF3, 0x0A, 0xF7,
+0x0B, 0x0A, 0xF4, 0x0D, 0xF3, 0x0D, 0x0E, 0x0B, 0xF7, 0x0B, 0xF8, 0x0B, 0x0C, 0xF7, 0xF5, 0xF5,
+0x0B, 0xF6, 0x09, 0x0C, 0x0B, 0xF5, 0x0C, 0x0E, 0xF5, 0xF3, 0xF6, 0xF5, 0x0C, 0xF5, 0x0E, 0xF8,
+0x0F, 0x09, 0xF8, 0x0B, 0xF3, 0x0A, 0x10, 0x0A, 0xF4, 0x09, 0xF6, 0x09, 0x10, 0xF8, 0xF4, 0xF2,
+0x09, 0xEF, 0x0B, 0x0A, 0x0A, 0xF4, 0x08, 0x0C, 0xF4, 0xFA, 0xF8, 0xF6, 0x0C, 0xF2, 0x07, 0xF3,
+0x06, 0x08, 0xF0, 0x13, 0xF6, 0x0C, 0x0D, 0x0B, 0xF8, 0x03, 0xF4, 0x0A, 0x09, 0xF9, 0xEF, 0xF3,
+0x11, 0xF1, 0x0E, 0x0F, 0x0D, 0xEE, 0x12, 0x0D, 0xFC, 0xFB, 0xF4, 0xF6, 0x08, 0xF1, 0x0C, 0xEF,
+0x0B, 0x09, 0xF5, 0x06, 0xF4, 0x0D, 0x08, 0x0F, 0xF5, 0x0E, 0xF7, 0x0B, 0x0F, 0xF2, 0xF4, 0xF6,
+0x09, 0xF4, 0x09, 0x0D, 0x0C, 0xF7, 0x0E, 0x0C, 0xF5, 0xF0, 0xF6, 0xF9, 0x11, 0xF3, 0x0A, 0xFA,
+0x0C, 0x0B, 0xF2, 0x0B, 0xF7, 0x0C, 0x0D, 0x09, 0xF6, 0x0C, 0xF2, 0x06, 0x0E, 0xF7, 0xF1, 0xF2,
+0x0A, 0xF2, 0x0E, 0x0B, 0x0D, 0xF8, 0x0C, 0x0A, 0xF5, 0xFC, 0xF7, 0xF9, 0x0C, 0xF3, 0x0D, 0xF4,
+0x0A, 0x0D, 0xF5, 0x0C, 0xF7, 0x0B, 0x0A, 0x0E, 0xF4, 0x05, 0xF5, 0x0C, 0x0A, 0xF6, 0xF7, 0xF3,
+0x0B, 0xF6, 0x0C, 0x0B, 0x0D, 0xF7, 0x0C, 0x0E, 0xF6, 0xF4, 0xF7, 0xF5, 0x0E, 0xF1, 0x0B, 0xF4,
+0x0C, 0x0C, 0xF3, 0x0B, 0xF5, 0x0D, 0x0B, 0x0D, 0xF8, 0x0A, 0xF5, 0x0A, 0x0C, 0xF3, 0xF4, 0xF7,
+0x09, 0xF3, 0x0B, 0x0A, 0x0C, 0xF6, 0x0D, 0x0B, 0xF3, 0xF4, 0xF5, 0xF6, 0x0E, 0xF1, 0x0A, 0xF6,
+0x0B, 0x0C, 0xF3, 0x0A, 0xF2, 0x0A, 0x0C, 0x0D, 0xF6, 0x09, 0xF3, 0x0F, 0x09, 0xF6, 0xF4, 0xF5,
+0x09, 0xF2, 0x0C, 0x0C, 0x0B, 0xF8, 0x0B, 0x0D, 0xF4, 0xF3, 0xF3, 0xF6, 0x0D, 0xEF, 0x09, 0xF9,
+0x0B, 0x0B, 0xF2, 0x0E, 0xF5, 0x0C, 0x0C, 0x09, 0xF3, 0x09, 0xF6, 0x0F, 0x0D, 0xF5, 0xF3, 0xF6,
+0x08, 0xF5, 0x0B, 0x0A, 0x0D, 0xF7, 0x0C, 0x0D, 0xF5, 0xF1, 0xF4, 0xF4, 0x0C, 0xF4, 0x09, 0xFD,
+0x0A, 0x13, 0xF7, 0x0F, 0xF8, 0x08, 0x0C, 0x0E, 0xF8, 0x0C, 0xF4, 0x0A, 0x09, 0xFA, 0xF6, 0xF6,
+0x08, 0xF7, 0x0B, 0x07, 0x10, 0xF2, 0x0E, 0x12, 0xFA, 0x00, 0xF0, 0xF6, 0x10, 0xF1, 0x10, 0xF1,
+0x0F, 0x0A, 0xF6, 0x0D, 0xF3, 0x0E, 0x0F, 0x0B, 0xF4, 0x08, 0xF5, 0x06, 0x0E, 0xFD, 0xF4, 0xF8,
+0x0E, 0xF2, 0x08, 0x0F, 0x0D, 0xEF, 0x11, 0x0A, 0xF7, 0x00, 0xF9, 0xF1, 0x0D, 0xF6, 0x0F, 0xF7,
+0x0E, 0x08, 0xED, 0x0C, 0xF2, 0x11, 0x0C, 0x0D, 0xF5, 0x0F, 0xF5, 0x07, 0x0A, 0xF9, 0xEE, 0xF5,
+0x09, 0xF3, 0x07, 0x0C, 0x0B, 0xF4, 0x11, 0x09, 0xF5, 0xFB, 0xF6, 0xF9, 0x0B, 0xF4, 0x06, 0xF5,
+0x09, 0x0E, 0xF6, 0x09, 0xF5, 0x0B, 0x0C, 0x0F, 0xF7, 0x0B, 0xF8, 0x0B, 0x0A, 0xF6, 0xF4, 0xF4,
+0x0C, 0xF5, 0x0C, 0x0D, 0x0C, 0xF9, 0x0A, 0x0C, 0xF6, 0xF2, 0xF6, 0xF6, 0x10, 0xF3, 0x0A, 0xF7,
+0x0C, 0x0C, 0xF5, 0x0A, 0xF4, 0x0C, 0x0C, 0x0C, 0xF6, 0x0A, 0xF5, 0x0A, 0x0C, 0xF4, 0xF0, 0xF4,
+0x0B, 0xF6, 0x0B, 0x0C, 0x0D, 0xF3, 0x0D, 0x0A, 0xF5, 0xF2, 0xF6, 0xF5, 0x0B, 0xFC, 0x0A, 0xFA,
+0x07, 0x08, 0xF6, 0x0B, 0xF7, 0x0E, 0x0E, 0x0F, 0xF6, 0x07, 0xF1, 0x0A, 0x0A, 0xF5, 0xF2, 0xF7,
+0x09, 0xF2, 0x0B, 0x0B, 0x0D, 0xF4, 0x0A, 0x0A, 0xF5, 0xF8, 0xF2, 0xF4, 0x0D, 0xF3, 0x0C, 0xF0,
+0x0A, 0x0D, 0xF5, 0x0E, 0xF5, 0x0C, 0x0C, 0x0D, 0xF4, 0x09, 0xF7, 0x0A, 0x0A, 0xF5, 0xF1, 0xF6,
+0x0C, 0xF5, 0x0B, 0x0C, 0x0A, 0xF6, 0x0B, 0x0C, 0xF5, 0xF7, 0xF5, 0xF6, 0x0C, 0xF3, 0x0D, 0xF6,
+0x09, 0x0E, 0xF6, 0x0A, 0xF6, 0x0C, 0x0E, 0x0B, 0xF7, 0x0B, 0xF4, 0x0B, 0x0D, 0xF6, 0xF6, 0xF8,
+0x07, 0xF2, 0x0D, 0x09, 0x0F, 0xF0, 0x11, 0x0C, 0xF6, 0xF5, 0xF6, 0xF8, 0x0B, 0xF0, 0x0D, 0xF4,
+0x11, 0x0D, 0xF6, 0x0E, 0xF6, 0x0F, 0x0B, 0x07, 0xF4, 0x03, 0xF0, 0x05, 0x0D, 0xFB, 0xEC, 0xF8,
+0x03, 0xF5, 0x0D, 0x12, 0x08, 0xF9, 0x11, 0x0F, 0xF7, 0xF5, 0xF8, 0xF4, 0x0A, 0xF8, 0x0E, 0xF7,
+0x0C, 0x0A, 0xF6, 0x08, 0xF7, 0x0B, 0x10, 0x0C, 0xF8, 0x09, 0xEE, 0x0C, 0x0C, 0xFB, 0xF1, 0xF4,
+0x09, 0xF0, 0x0D, 0x0F, 0x0C, 0xF2, 0x09, 0x0E, 0xF4, 0xFE, 0xF3, 0xF3, 0x08, 0xF2, 0x0E, 0xF3,
+0x0C, 0x0B, 0xF6, 0x0A, 0xFB, 0x0C, 0x07, 0x0D, 0xF7, 0x04, 0xF5, 0x0C, 0x10, 0xF6, 0xF5, 0xF1,
+0x11, 0xF3, 0x12, 0x0A, 0x11, 0xF2, 0x0D, 0x0C, 0xF7, 0x00, 0xF4, 0xF7, 0x10, 0xF6, 0x0F, 0xF0,
+0x0C, 0x08, 0xF5, 0x0D, 0xF6, 0x0C, 0x0C, 0x09, 0xF3, 0x0C, 0xF6, 0x09, 0x0C, 0xF6, 0xF2, 0xF4,
+0x0C, 0xF2, 0x0C, 0x0B, 0x09, 0xF2, 0x0F, 0x09, 0xF8, 0xF5, 0xF1, 0xF7, 0x0C, 0xF0, 0x10, 0xFB,
+0x0B, 0x0D, 0xF5, 0x0B, 0xF5, 0x0A, 0x0D, 0x0D, 0xF6, 0x0E, 0xF6, 0x0C, 0x0D, 0xF7, 0xF5, 0xF5,
+0x0B, 0xF2, 0x0D, 0x0A, 0x0C, 0xF6, 0x0C, 0x0A, 0xF2, 0xEE, 0xF5, 0xF6, 0x0C, 0xF2, 0x0A, 0xF8,
+0x0C, 0x0B, 0xF3, 0x0F, 0xF9, 0x0A, 0x0E, 0x0D, 0xF4, 0x09, 0xF4, 0x0A, 0x0A, 0xF5, 0xF3, 0xF5,
+0x0B, 0xF3, 0x0C, 0x0C, 0x0C, 0xF1, 0x0C, 0x0B, 0xF6, 0xF3, 0xF4, 0xF6, 0x0E, 0xF3, 0x09, 0xFA,
+0x0A, 0x0D, 0xF6, 0x09, 0xF1, 0x0D, 0x09, 0x0E, 0xF4, 0x0C, 0xF4, 0x0C, 0x0B, 0xF4, 0xF5, 0xF6,
+0x08, 0xF2, 0x0A, 0x0C, 0x08, 0xF7, 0x0A, 0x10, 0xF5, 0xF2, 0xF7, 0xF4, 0x0B, 0xF6, 0x0B, 0xF6,
+0x0B, 0x0C, 0xF1, 0x0C, 0xF5, 0x0D, 0x0E, 0x0E, 0xF6, 0x08, 0xF3, 0x0C, 0x0D, 0xFA, 0xF3, 0xF4,
+0x0D, 0xF3, 0x0E, 0x0B, 0x0D, 0xF2, 0x0D, 0x0A, 0xF7, 0xF8, 0xF5, 0xF5, 0x0B, 0xF0, 0x0B, 0xF8,
+0x12, 0x14, 0xF7, 0x10, 0xF5, 0x0C, 0x0A, 0x0D, 0xFD, 0x0F, 0xEF, 0xFC, 0x0E, 0xFE, 0xF1, 0xF0,
+0x08, 0xF0, 0x0F, 0x0D, 0x10, 0xF1, 0x0A, 0x0C, 0xFC, 0xFB, 0xF5, 0xF2, 0x0C, 0xF8, 0x0A, 0xF4,
+0x08, 0x0E, 0xF5, 0x0D, 0xF8, 0x10, 0x0F, 0x10, 0xF4, 0x0D, 0xF8, 0x0A, 0x10, 0xF8, 0xF8, 0xF2,
+0x0C, 0xF4, 0x09, 0x0D, 0x0C, 0xF4, 0x0C, 0x0B, 0xF7, 0xF8, 0xF3, 0xF7, 0x0F, 0xF9, 0x0C, 0xF6,
+0x07, 0x0F, 0xF3, 0x0E, 0xFA, 0x0A, 0x11, 0x0A, 0xF7, 0x0A, 0xF2, 0x08, 0x0B, 0xF6, 0xF2, 0xF2,
+0x09, 0xF2, 0x0A, 0x07, 0x0D, 0xF0, 0x0C, 0x09, 0xF0, 0xF4, 0xF9, 0xF9, 0x0C, 0xED, 0x0B, 0xF6,
+0x09, 0x0D, 0xF3, 0x09, 0xF5, 0x0C, 0x0D, 0x10, 0xF4, 0x08, 0xF6, 0x05, 0x10, 0xFA, 0xF3, 0xF3,
+0x0E, 0xF5, 0x10, 0x09, 0x08, 0xF2, 0x0B, 0x06, 0xF6, 0xF7, 0xF4, 0xF4, 0x0C, 0xF4, 0x0C, 0xF4,
+0x0A, 0x0A, 0xF7, 0x0E, 0xF5, 0x0A, 0x0B, 0x0C, 0xF2, 0x0C, 0xF7, 0x0B, 0x0E, 0xF7, 0xF5, 0xF6,
+0x0D, 0xF6, 0x09, 0x0D, 0x0C, 0xF5, 0x0E, 0x0A, 0xF5, 0xF4, 0xF3, 0xF4, 0x0B, 0xF7, 0x0B, 0xF6,
+0x0E, 0x09, 0xF7, 0x0C, 0xF5, 0x0A, 0x10, 0x0B, 0xF8, 0x0A, 0xF4, 0x05, 0x0B, 0xFC, 0xF2, 0xF4,
+0x0C, 0xF2, 0x12, 0x0F, 0x09, 0xF0, 0x0B, 0x0A, 0xF7, 0xF8, 0xF0, 0xF5, 0x0A, 0xF5, 0x0A, 0xF7,
+0x0C, 0x10, 0xF3, 0x09, 0xF3, 0x0D, 0x10, 0x0E, 0xF6, 0x09, 0xF7, 0x04, 0x0A, 0xF5, 0xF0, 0xF8,
+0x09, 0xF4, 0x0F, 0x0D, 0x0A, 0xF6, 0x0E, 0x0F, 0xF7, 0xFF, 0xF4, 0xF6, 0x0C, 0xF9, 0x0C, 0xF5,
+0x09, 0x09, 0xF2, 0x12, 0xFA, 0x07, 0x0E, 0x0D, 0xF4, 0x0E, 0xF2, 0x09, 0x10, 0xFC, 0xF3, 0xF5,
+0x09, 0xF3, 0x08, 0x0A, 0x0C, 0xF5, 0x0B, 0x09, 0xF8, 0xF9, 0xEE, 0xF2, 0x12, 0xF4, 0x0E, 0xF6,
+0x01, 0xFA, 0xFE, 0x00, 0x02, 0xFF, 0xFA, 0x04, 0x04, 0x05, 0xFD, 0x03, 0xFD, 0xFB, 0x03, 0x00,
+0x06, 0xFD, 0x00, 0x00, 0x01, 0x01, 0x06, 0x03, 0xFB, 0x04, 0xFF, 0xFD, 0xFE, 0x06, 0x00, 0x05,
+0x02, 0xFD, 0xFD, 0x03, 0xFB, 0x01, 0x03, 0x04, 0x02, 0x02, 0xFF, 0x06, 0xFF, 0x06, 0x06, 0x06,
+0x06, 0xFC, 0xFB, 0x01, 0xFC, 0x04, 0xFD, 0xFC, 0xFF, 0xFA, 0x06, 0x00, 0x00, 0xFD, 0xFD, 0xFF,
+0x0D, 0x08, 0xF6, 0x13, 0xF9, 0x0E, 0x0B, 0x09, 0xF6, 0x08, 0xF3, 0x06, 0x11, 0xFC, 0xF6, 0xF6,
+0x08, 0xF4, 0x12, 0x0D, 0x10, 0xF3, 0x08, 0x12, 0xF6, 0x02, 0xF9, 0xF3, 0x0C, 0xEC, 0x07, 0xF0,
+0x0D, 0x09, 0xFB, 0x0D, 0xF3, 0x0E, 0x08, 0x12, 0xF5, 0x0D, 0xF0, 0x00, 0x10, 0xF4, 0xF1, 0xF3,
+0x0D, 0xF9, 0x08, 0x09, 0x07, 0xF6, 0x0E, 0x11, 0xF2, 0xFC, 0xF1, 0xFC, 0x08, 0xF5, 0x0B, 0xF2,
+0x10, 0x0A, 0xF8, 0x0A, 0xF2, 0x0E, 0x07, 0x0D, 0xFB, 0x07, 0xEE, 0x06, 0x0B, 0xFE, 0xF1, 0xF2,
+0x06, 0xF3, 0x0D, 0x08, 0x12, 0xF4, 0x0D, 0x0A, 0xF4, 0xFC, 0xF2, 0xF4, 0x0C, 0xF6, 0x0E, 0xF7,
+0x0C, 0x0A, 0xF1, 0x10, 0xFB, 0x10, 0x0B, 0x11, 0xF4, 0x05, 0xF4, 0x09, 0x08, 0xF8, 0xF5, 0xFB,
+0x06, 0xF4, 0x0E, 0x07, 0x0F, 0xF5, 0x07, 0x12, 0xF1, 0xFA, 0xF4, 0xEF, 0x0B, 0xF4, 0x0C, 0xF6,
+0x10, 0x06, 0xF4, 0x09, 0xF3, 0x03, 0x0F, 0x10, 0xF3, 0x04, 0xF2, 0x10, 0x08, 0xF0, 0xF2, 0xF2,
+0x0B, 0xEF, 0x06, 0x10, 0x0F, 0xF9, 0x10, 0x0C, 0xFC, 0xFB, 0xF5, 0xF4, 0x0E, 0xF7, 0x0D, 0xF8,
+0x0C, 0x04, 0xF8, 0x0C, 0xF4, 0x07, 0x04, 0x04, 0xFA, 0x03, 0xF8, 0x0B, 0x02, 0xF4, 0xF8, 0xF9,
+0x0E, 0xF6, 0x03, 0x04, 0x02, 0xF9, 0x05, 0x03, 0xFB, 0xFD, 0xFD, 0xF7, 0x09, 0xFF, 0x0E, 0xF3,
+0x05, 0x01, 0xFD, 0xFE, 0x06, 0xFF, 0x05, 0x01, 0x03, 0xFF, 0x04, 0xFF, 0x06, 0x00, 0x03, 0x01,
+0xFB, 0xFF, 0x03, 0xFE, 0x03, 0xFD, 0x02, 0x00, 0xFE, 0x01, 0x06, 0x02, 0xFC, 0xFA, 0x01, 0x03,
+0x06, 0x04, 0x05, 0xFC, 0xFD, 0x03, 0x01, 0xFD, 0x03, 0xFA, 0x04, 0x02, 0x04, 0x02, 0xFC, 0x05,
+0xFC, 0x01, 0xFD, 0x05, 0xFB, 0xFB, 0x00, 0xFF, 0xFC, 0x05, 0xFD, 0xFE, 0xFF, 0xFF, 0xFB, 0x03,
+0x02, 0xFF, 0x05, 0xFD, 0x04, 0xFF, 0xFD, 0xFC, 0xFB, 0x03, 0xFE, 0xFD, 0x01, 0xFA, 0x03, 0xFB,
+0x06, 0x00, 0xFC, 0x05, 0xFF, 0xFF, 0xFB, 0xF8, 0x01, 0xFF, 0x00, 0x01, 0x02, 0x00, 0xF9, 0x04,
+0xFF, 0x03, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x01, 0x01, 0xFB, 0x03, 0x01, 0xFB, 0xFD, 0xFF, 0xFF,
+0x02, 0x02, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x02, 0x02, 0x00, 0xF9, 0x04, 0x02,
+0x02, 0x00, 0x03, 0x01, 0xFE, 0x02, 0x03, 0x03, 0xFE, 0xFE, 0xFE, 0xFD, 0x00, 0x02, 0xFE, 0xFB,
+0x02, 0x04, 0xFF, 0x04, 0x04, 0xFF, 0x04, 0xFD, 0x01, 0x04, 0x01, 0x01, 0x08, 0xE9, 0x03, 0xFB,
+0xFF, 0x01, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0xFE, 0xFD, 0x04, 0xFF, 0x01, 0x01, 0xFF, 0x00, 0xFD,
+0x02, 0x02, 0x03, 0xFF, 0xFE, 0xFE, 0xFB, 0x03, 0xFC, 0xFC, 0x03, 0x03, 0x0B, 0xE3, 0x05, 0x04,
+0x04, 0x02, 0x00, 0xFF, 0x00, 0x05, 0x05, 0x06, 0xFF, 0x01, 0x02, 0x05, 0x00, 0xFF, 0xFA, 0xFD,
+0x05, 0xFF, 0x05, 0x02, 0xFF, 0xFF, 0x04, 0x04, 0x02, 0xFE, 0xFA, 0xFB, 0x00, 0xE0, 0x05, 0xFA,
+0x00, 0x06, 0x00, 0x06, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x04, 0xFD, 0x06, 0x05, 0xFB, 0x01, 0xFF,
+0x05, 0x03, 0x02, 0x01, 0xFD, 0xFF, 0x04, 0x03, 0x01, 0xF6, 0xFE, 0xFA, 0x07, 0xDA, 0x01, 0xF9,
+0xFE, 0x03, 0x01, 0x01, 0x02, 0x05, 0x05, 0x01, 0xFE, 0xFC, 0xFE, 0x00, 0xFF, 0x01, 0x05, 0xFA,
+0x02, 0xF9, 0x02, 0x02, 0x01, 0xFB, 0x03, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x06, 0xEE, 0x02, 0x06,
+0xFD, 0x02, 0xFF, 0x07, 0xFC, 0xFD, 0x01, 0x01, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x03, 0x01, 0xFE,
+0x02, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02, 0x00, 0x01, 0x05, 0x00, 0xFE, 0xFF, 0x02, 0xFB, 0xFA,
+0x05, 0xFF, 0xFC, 0x02, 0xFF, 0x0B, 0xFE, 0x07, 0xFF, 0xFA, 0xFB, 0xFF, 0x02, 0xFE, 0x00, 0xFD,
+0x01, 0x04, 0x03, 0x01, 0xFF, 0xFE, 0x01, 0xFE, 0xFD, 0x06, 0xFB, 0x00, 0xFC, 0xF7, 0x00, 0x01,
+0x00, 0x06, 0xFF, 0x07, 0xFB, 0x00, 0x03, 0x01, 0xFE, 0x02, 0xFB, 0xFE, 0xFF, 0xFE, 0xFC, 0x04,
+0x03, 0x04, 0x03, 0x01, 0xFF, 0x02, 0xFE, 0x01, 0xFC, 0x05, 0xFF, 0x01, 0xF8, 0xF7, 0x02, 0xFB,
+0x01, 0x02, 0x00, 0x0A, 0x01, 0x02, 0x06, 0xFE, 0x00, 0x00, 0xFF, 0x01, 0x01, 0xFF, 0x02, 0xFF,
+0x01, 0xFF, 0x04, 0x04, 0xFF, 0xFD, 0x01, 0x02, 0x00, 0xFA, 0x00, 0x00, 0x02, 0xE7, 0x03, 0x00,
+0x00, 0xFF, 0x00, 0x05, 0x00, 0x04, 0x03, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+0x02, 0x01, 0x02, 0x05, 0x01, 0xFD, 0x03, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xFF, 0xE7, 0x02, 0x03,
+0xFF, 0x04, 0xFF, 0x07, 0xFF, 0x00, 0x01, 0x03, 0xFC, 0xFD, 0x01, 0xFE, 0xFF, 0xFE, 0xFD, 0xFE,
+0x02, 0xFE, 0x02, 0x03, 0x02, 0x00, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xEA, 0x01, 0x00,
+0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x01, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFC,
+0x01, 0x00, 0xFF, 0x01, 0x00, 0xFC, 0x03, 0x01, 0x01, 0xFD, 0x00, 0xFF, 0x05, 0xEE, 0x02, 0x04,
+0x01, 0x04, 0x00, 0x03, 0xFE, 0x02, 0x00, 0x02, 0x00, 0x03, 0x04, 0x04, 0xFC, 0x00, 0xFB, 0xFD,
+0xFF, 0x00, 0xFE, 0xFE, 0x01, 0xFD, 0x05, 0x03, 0x02, 0xFF, 0x02, 0x01, 0xFD, 0xEF, 0x00, 0xFE,
+0xFE, 0x04, 0x05, 0x05, 0x03, 0xFF, 0x00, 0xFF, 0x06, 0x04, 0xFB, 0x03, 0x00, 0x03, 0xFE, 0xFB,
+0x01, 0xFC, 0x02, 0x02, 0x07, 0xFC, 0x05, 0x01, 0x03, 0x0A, 0xFF, 0xFD, 0xFF, 0x03, 0x00, 0x00,
+0xF9, 0xFD, 0x04, 0xF7, 0xFC, 0x03, 0xFC, 0x00, 0xFC, 0x0F, 0x04, 0x02, 0x01, 0xFA, 0x0A, 0xFB,
+0x02, 0x04, 0xFC, 0x02, 0x06, 0x01, 0xFB, 0xF4, 0xFB, 0xF8, 0x05, 0xFE, 0x01, 0xFC, 0xFE, 0x02,
+0xFD, 0x02, 0xFD, 0x06, 0xFE, 0x04, 0x01, 0x05, 0x00, 0xFF, 0x01, 0x00, 0x07, 0x07, 0xFB, 0xFF,
+0xFC, 0xFF, 0x00, 0xFE, 0x02, 0x01, 0x01, 0x03, 0x01, 0x0D, 0x00, 0x06, 0xFC, 0xF9, 0x05, 0x01,
+0xFF, 0x00, 0xFF, 0x03, 0x01, 0x05, 0xFE, 0x05, 0x04, 0xFD, 0x00, 0x02, 0xFE, 0x03, 0x03, 0xFB,
+0xFF, 0xFD, 0x00, 0x04, 0x02, 0xFD, 0xFF, 0x03, 0x03, 0xFE, 0xFD, 0x00, 0xFE, 0xDE, 0x03, 0xFF,
+0x01, 0x01, 0xFF, 0x06, 0x02, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0xFF, 0x00,
+0x00, 0xFE, 0x01, 0x00, 0x02, 0xFD, 0x01, 0x01, 0x01, 0xFA, 0x01, 0x01, 0xFF, 0xDD, 0x02, 0x04,
+0x00, 0xFF, 0xFD, 0x01, 0xFF, 0x02, 0x01, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+0x03, 0x02, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0xFE, 0xF9, 0xFF, 0x00, 0xFD, 0xD8, 0x05, 0x03,
+0x01, 0x00, 0x00, 0x03, 0xFE, 0x02, 0x04, 0x05, 0x02, 0x01, 0xFC, 0xFC, 0x02, 0x01, 0xFC, 0xFF,
+0x01, 0xFF, 0x01, 0x03, 0xFE, 0xFC, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x01, 0xFC, 0xD4, 0x05, 0x01,
+0xFE, 0x04, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x00, 0xFA, 0xFB, 0x03, 0x00, 0xFE, 0xFB, 0x03, 0xFB,
+0x05, 0x01, 0x03, 0x03, 0xFF, 0x03, 0xFD, 0x03, 0x00, 0x04, 0x02, 0xFE, 0x00, 0xE8, 0x03, 0x09,
+0x01, 0x00, 0x00, 0x05, 0x04, 0xFF, 0xFF, 0x09, 0x06, 0xFF, 0xFC, 0xFA, 0x05, 0x09, 0xF9, 0xF9,
+0xF8, 0xF9, 0xFF, 0x06, 0x07, 0xF6, 0x00, 0x02, 0x04, 0x0F, 0x01, 0x05, 0xFA, 0x01, 0xFD, 0xFE,
+0xF7, 0x03, 0xF6, 0x04, 0x02, 0x03, 0x03, 0xF5, 0x05, 0xFD, 0x02, 0xFF, 0xFF, 0x02, 0xF2, 0xFA,
+0x04, 0x00, 0x02, 0xF9, 0x08, 0x04, 0x09, 0x01, 0x02, 0x0F, 0xFF, 0x04, 0xFC, 0xF7, 0xF9, 0xFF,
+0x00, 0xFC, 0x01, 0x06, 0xFD, 0x03, 0xFB, 0xFB, 0xFF, 0x05, 0x04, 0x02, 0x07, 0x03, 0xFF, 0x00,
+0x02, 0xFD, 0x01, 0x00, 0x00, 0x03, 0xFD, 0xF9, 0x01, 0x01, 0xFD, 0x02, 0x08, 0xEF, 0xFE, 0x04,
+0xFF, 0xFF, 0xFF, 0x04, 0x01, 0xFF, 0x03, 0x06, 0x02, 0xFB, 0xFB, 0x02, 0xFE, 0x05, 0x00, 0xF8,
+0xFC, 0xFD, 0x02, 0x02, 0x01, 0xFE, 0xFE, 0x04, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xD9, 0x02, 0xFE,
+0xFE, 0x01, 0xFD, 0x05, 0x00, 0x03, 0x04, 0x01, 0x05, 0xFC, 0xFC, 0xFF, 0xFE, 0xFF, 0xFC, 0x03,
+0xFD, 0xFF, 0xFC, 0xFF, 0xFE, 0xF8, 0x02, 0x04, 0xFE, 0xF9, 0x02, 0x00, 0xFF, 0xDB, 0x03, 0xFF,
+0x01, 0x01, 0xFC, 0x05, 0x01, 0x04, 0x02, 0x01, 0x02, 0xFF, 0xFD, 0xFE, 0x04, 0x00, 0x00, 0xFF,
+0x01, 0xFE, 0x07, 0x01, 0xFF, 0xF8, 0xFE, 0xFF, 0xFE, 0xFA, 0xFF, 0x01, 0xFE, 0xD2, 0x01, 0x07,
+0x01, 0x02, 0xFE, 0x02, 0x01, 0xFC, 0x02, 0x01, 0xFF, 0xFD, 0xFD, 0xFC, 0xFF, 0x02, 0xFE, 0xFB,
+0xFE, 0xFD, 0xFF, 0x02, 0x03, 0xFB, 0x03, 0x00, 0x01, 0xFE, 0xFF, 0xFE, 0x01, 0xDF, 0x00, 0xFD,
+0xFC, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0xFE, 0xFC, 0x03, 0xFD, 0x03, 0x03, 0x03, 0x08, 0x00,
+0x03, 0x00, 0x00, 0xFE, 0x00, 0x02, 0x02, 0x03, 0xFF, 0x09, 0xFF, 0xF8, 0xFF, 0xEB, 0xFD, 0xFF,
+0x00, 0xFE, 0xFD, 0xFF, 0x05, 0xFB, 0x03, 0x01, 0xFA, 0x00, 0xFE, 0x05, 0x02, 0xFB, 0x0A, 0xFB,
+0x05, 0x02, 0xFC, 0x02, 0x04, 0xFC, 0xFE, 0xFB, 0x01, 0x07, 0x03, 0x05, 0xFD, 0xFE, 0xFF, 0x01,
+0xFB, 0xFA, 0x07, 0xFD, 0x01, 0x02, 0xFF, 0xF9, 0xFC, 0xFF, 0xFE, 0x08, 0xFA, 0x00, 0x01, 0x01,
+0x00, 0xFD, 0x07, 0x0A, 0x01, 0x03, 0x01, 0x08, 0xFC, 0x06, 0xFC, 0x08, 0x03, 0x02, 0x00, 0x04,
+0xFC, 0x04, 0x02, 0x02, 0xFD, 0x04, 0xFF, 0x05, 0x01, 0x01, 0x06, 0xFE, 0x00, 0xFA, 0x04, 0xFD,
+0x01, 0x03, 0x05, 0x03, 0x03, 0x03, 0xFB, 0x04, 0x00, 0x09, 0xFE, 0x05, 0xFC, 0xEE, 0xFE, 0x01,
+0x00, 0xFE, 0x04, 0xFC, 0xFE, 0xFD, 0x04, 0xFD, 0x03, 0x05, 0x01, 0x02, 0x01, 0x03, 0xFF, 0xFB,
+0xF8, 0xFD, 0x03, 0x01, 0x05, 0xFC, 0x02, 0x00, 0xFC, 0x01, 0x04, 0x02, 0x02, 0xDC, 0x05, 0xF8,
+0x05, 0x0A, 0x03, 0x10, 0x03, 0xFE, 0x08, 0x07, 0x08, 0xF9, 0x00, 0x05, 0xFB, 0x05, 0x04, 0x02,
+0xF9, 0x01, 0xFF, 0xFE, 0xFF, 0xF7, 0x03, 0x02, 0x01, 0xFE, 0xFC, 0x00, 0x02, 0xE2, 0x02, 0xFB,
+0xFE, 0x02, 0xFE, 0x03, 0x01, 0xFB, 0x02, 0x06, 0xFF, 0xFF, 0xFD, 0x05, 0xFE, 0x04, 0xFF, 0x04,
+0xFF, 0xFE, 0x07, 0xFD, 0x02, 0xF7, 0x02, 0x08, 0x04, 0x01, 0xFF, 0xF9, 0xFF, 0xDF, 0xFD, 0x01,
+0x04, 0x05, 0xFB, 0x04, 0xFC, 0x05, 0xFE, 0x05, 0x04, 0xFC, 0x02, 0x05, 0xFF, 0x01, 0xFD, 0xFF,
+0x04, 0x02, 0xFE, 0x05, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xF8, 0xDD, 0xFD, 0x0A,
+0xFF, 0x00, 0xFF, 0x04, 0xF9, 0xFF, 0xFD, 0xFA, 0xFE, 0xFF, 0x00, 0xFE, 0x02, 0x00, 0xFE, 0x03,
+0x05, 0x09, 0xFC, 0x04, 0xFE, 0xFD, 0x04, 0x03, 0x03, 0x0D, 0xFA, 0x04, 0x07, 0xF3, 0x02, 0xFE,
+0xFA, 0xFF, 0x06, 0x04, 0x01, 0x01, 0x00, 0xF8, 0xF7, 0x06, 0x07, 0xFC, 0x03, 0xF8, 0xFB, 0xFB,
+0xFD, 0x01, 0x06, 0x06, 0xFB, 0x06, 0xFB, 0x02, 0xFE, 0x03, 0x04, 0x05, 0x00, 0xF0, 0xF8, 0xFC,
+0x07, 0xFA, 0xFB, 0xF8, 0xF9, 0xFE, 0x01, 0xFC, 0xFA, 0x06, 0x03, 0xFC, 0xFE, 0x05, 0x06, 0x00,
+0x02, 0xFF, 0x01, 0x03, 0x02, 0x06, 0xFC, 0xF7, 0xFD, 0xFD, 0xFA, 0xFC, 0x02, 0x04, 0x05, 0xFD,
+0xFA, 0x00, 0xF8, 0xFD, 0x04, 0x04, 0x02, 0xFE, 0xFA, 0xF8, 0xFD, 0x00, 0xFE, 0x03, 0xFF, 0xF5,
+0x01, 0x01, 0xFA, 0x04, 0x05, 0x05, 0x06, 0x00, 0x05, 0x09, 0xFD, 0x01, 0x03, 0x03, 0x01, 0xFD,
+0x02, 0x08, 0x05, 0xFF, 0x03, 0x01, 0x03, 0x06, 0x08, 0xFD, 0xFE, 0x05, 0x06, 0x04, 0xFB, 0xFE,
+0xFB, 0x02, 0x01, 0x03, 0x00, 0xFD, 0x03, 0x05, 0x01, 0x02, 0xFF, 0x05, 0x04, 0xEE, 0xFF, 0xFF,
+0x00, 0x02, 0x03, 0xFF, 0x03, 0x04, 0x02, 0x00, 0xFC, 0x04, 0x02, 0x02, 0x02, 0x02, 0xFC, 0xFB,
+0x02, 0x00, 0xFD, 0xFB, 0x00, 0x01, 0x04, 0x02, 0xFD, 0x02, 0xFE, 0x01, 0x03, 0xF0, 0x03, 0x03,
+0x04, 0x08, 0x06, 0xFB, 0x03, 0x08, 0x02, 0xFC, 0xF9, 0x07, 0x07, 0x00, 0xFF, 0xFC, 0xFD, 0x05,
+0xFB, 0xFC, 0x04, 0x01, 0x06, 0x06, 0xFB, 0x05, 0xF7, 0xFB, 0xFE, 0xFE, 0xF4, 0xEA, 0xFA, 0xFD,
+0xFA, 0xFF, 0x01, 0x06, 0xFD, 0xFF, 0x06, 0x03, 0x02, 0xFE, 0xF6, 0xFE, 0xFF, 0x03, 0x04, 0xFB,
+0xF9, 0xFE, 0xFD, 0xFF, 0x0A, 0xFF, 0xFD, 0x02, 0xFA, 0x06, 0xF9, 0xFE, 0x00, 0xE6, 0xFD, 0xFF,
+0xFD, 0x03, 0x01, 0xFC, 0x05, 0xFC, 0x01, 0xF9, 0xF6, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0x00, 0xFC,
+0x03, 0xFE, 0x05, 0x08, 0x03, 0x08, 0x00, 0xFC, 0x05, 0x00, 0xFC, 0x0A, 0x04, 0xF4, 0xFC, 0xFE,
+0xFB, 0x02, 0x09, 0xFE, 0x09, 0xFE, 0x00, 0xFC, 0xF7, 0x04, 0x04, 0xFF, 0xFF, 0xF7, 0x01, 0xFB,
+0x08, 0x09, 0x06, 0x04, 0xFA, 0xFE, 0x06, 0xFC, 0xFE, 0x0A, 0xFA, 0x07, 0xFC, 0xF4, 0xFE, 0xFC,
+0x02, 0x00, 0xFD, 0xFA, 0xF4, 0x09, 0xFD, 0x07, 0xFF, 0xFE, 0x02, 0x00, 0x00, 0xFF, 0x04, 0xFF,
+0xFE, 0xFF, 0xFC, 0x03, 0x03, 0x05, 0x01, 0xF6, 0x03, 0xFA, 0xFD, 0xFB, 0xFC, 0x05, 0xF6, 0xFD,
+0xFD, 0xFD, 0x03, 0x00, 0xFE, 0x05, 0xFA, 0x02, 0xFE, 0xFD, 0xFE, 0x06, 0x05, 0xFD, 0x04, 0xFE,
+0x02, 0xFF, 0xFB, 0x06, 0x01, 0x08, 0xFB, 0x05, 0x06, 0x02, 0xFE, 0x00, 0xFF, 0xF9, 0xF9, 0xF9,
+0x06, 0x02, 0xFF, 0xFC, 0xFD, 0xFE, 0xFF, 0x04, 0xFE, 0xFD, 0xFF, 0xFC, 0x04, 0xFC, 0xFA, 0x00,
+0x00, 0xFE, 0xFB, 0x00, 0xFB, 0x05, 0x03, 0xFC, 0x02, 0x05, 0xFC, 0xFF, 0x00, 0xFB, 0x00, 0x01,
+0x06, 0x02, 0xFF, 0xFD, 0x03, 0xFB, 0xFC, 0xFC, 0xF8, 0xFE, 0x04, 0x06, 0xFE, 0xFA, 0xFD, 0x02,
+0x05, 0xFC, 0xFC, 0x02, 0xFF, 0x02, 0x00, 0x01, 0x01, 0xFD, 0x01, 0x03, 0xFF, 0xF6, 0x00, 0x06,
+0x02, 0x03, 0xFE, 0xF6, 0x04, 0x05, 0x02, 0xFE, 0xFB, 0x08, 0x01, 0xFC, 0xFC, 0xFE, 0x05, 0xFA,
+0xFF, 0x03, 0x06, 0x07, 0x01, 0x07, 0xFB, 0xF8, 0xFF, 0xFA, 0xF9, 0xFD, 0xFE, 0xF6, 0xF9, 0xFC,
+0x02, 0xFC, 0xFD, 0xFF, 0x02, 0x01, 0x06, 0x03, 0x01, 0xFC, 0xFD, 0xFB, 0x02, 0xFE, 0x01, 0x06,
+0xFB, 0xFF, 0x04, 0xFD, 0x06, 0x04, 0x03, 0x02, 0xFB, 0x06, 0xFD, 0x04, 0xFF, 0xFB, 0xFB, 0x04,
+0xFA, 0x03, 0xFD, 0xFD, 0xFC, 0x01, 0x02, 0xFD, 0xFF, 0x01, 0x06, 0x02, 0x00, 0x05, 0x02, 0x03,
+0xFF, 0x05, 0xFE, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x01, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0x06, 0xFD,
+0xFE, 0xFE, 0x04, 0x03, 0x03, 0x06, 0x03, 0x05, 0x01, 0xFE, 0x00, 0xFF, 0x05, 0xFE, 0xFF, 0x03,
+0x04, 0xFC, 0x00, 0x04, 0x06, 0x00, 0x03, 0x03, 0x02, 0x02, 0xFC, 0x06, 0xFF, 0x03, 0x06, 0xFF,
+0xF7, 0x00, 0x05, 0xFE, 0x09, 0xFC, 0x03, 0x05, 0x05, 0xF5, 0xF3, 0xF8, 0xFF, 0x04, 0x05, 0xF8,
+0x06, 0x07, 0x06, 0xFA, 0x08, 0x0A, 0xF7, 0x0F, 0x05, 0x0C, 0x01, 0xF8, 0x0E, 0xFB, 0xFC, 0xF0,
+0xFB, 0x01, 0xFD, 0x00, 0x04, 0x03, 0x01, 0xFE, 0x03, 0x03, 0x00, 0x03, 0xFB, 0xFD, 0x07, 0xFB,
+0x06, 0x03, 0xFF, 0x01, 0xFB, 0xFC, 0xFB, 0x02, 0xFA, 0xFE, 0xFF, 0x04, 0xFA, 0xFE, 0x02, 0xFE,
+0x06, 0xFF, 0x02, 0xF9, 0xF6, 0xF8, 0xF8, 0xFE, 0x03, 0x0D, 0x07, 0x03, 0xF8, 0x01, 0x07, 0xFA,
+0x00, 0x02, 0xF9, 0xFC, 0x04, 0xFD, 0xFB, 0x00, 0x04, 0xE7, 0xFD, 0xFF, 0x09, 0x01, 0x03, 0x04,
+0xFF, 0x01, 0xFF, 0x00, 0xFE, 0x03, 0x03, 0xFE, 0x00, 0x03, 0x03, 0x00, 0xFF, 0x06, 0xFE, 0xF8,
+0xFB, 0xF9, 0xFF, 0x07, 0xFB, 0x06, 0xFC, 0xFE, 0x06, 0x05, 0xFB, 0x03, 0x06, 0x01, 0x05, 0x00,
+0xFE, 0x00, 0x07, 0xF9, 0xFB, 0xFF, 0xFA, 0x02, 0xF4, 0x07, 0x02, 0xFF, 0xFF, 0xFC, 0x06, 0x03,
+0x06, 0xFF, 0x04, 0x05, 0xFB, 0x09, 0x02, 0xFE, 0x01, 0x01, 0x00, 0xFC, 0xFD, 0xF8, 0x01, 0xFA,
+0x06, 0x04, 0xF8, 0x08, 0xFC, 0xF9, 0xFC, 0xF9, 0xF7, 0x03, 0x0C, 0xFA, 0x05, 0xF6, 0xFF, 0xFD,
+0x00, 0x08, 0xFF, 0x00, 0xF7, 0xF6, 0xF7, 0xFC, 0x02, 0xF6, 0x09, 0xFE, 0x05, 0x01, 0xFF, 0xFE,
+0x04, 0x02, 0x00, 0xFA, 0x06, 0x02, 0xFE, 0x03, 0x01, 0x00, 0xFF, 0x03, 0x06, 0x04, 0x05, 0x02,
+0xFF, 0x06, 0x05, 0xFC, 0x04, 0x03, 0x00, 0xFE, 0xFC, 0xFF, 0x03, 0x00, 0xFD, 0xFB, 0x06, 0xFE,
+0xFE, 0x05, 0x06, 0x01, 0xFC, 0x04, 0x03, 0xFE, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x04, 0x03,
+0xFD, 0xFA, 0x02, 0xFC, 0x00, 0x03, 0x01, 0x02, 0x04, 0x04, 0x01, 0xFC, 0x03, 0x00, 0x01, 0x05,
+0x00, 0x06, 0x02, 0xFD, 0x01, 0x02, 0xFD, 0x03, 0x03, 0x05, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x03,
+0x02, 0xFE, 0x00, 0x05, 0x04, 0xFB, 0xFF, 0xFF, 0x02, 0xFB, 0xFE, 0xFA, 0x02, 0x02, 0xFC, 0xFE,
+0x02, 0xFF, 0xFA, 0x04, 0xFD, 0xFB, 0x03, 0x02, 0x00, 0x06, 0xFC, 0x06, 0x01, 0x04, 0xFB, 0xFB,
+0xFB, 0x05, 0x06, 0x02, 0x06, 0x06, 0x04, 0xFB, 0x02, 0x05, 0xFD, 0x04, 0x02, 0x01, 0xFE, 0xFE,
+0xFE, 0x03, 0x05, 0x00, 0x04, 0xFD, 0x04, 0xFE, 0xFB, 0xFF, 0xFA, 0xFC, 0xFD, 0xFB, 0xFB, 0x04,
+0x06, 0xFD, 0x01, 0xFB, 0xFC, 0x04, 0x00, 0x04, 0xFB, 0x00, 0xFE, 0xFF, 0xFC, 0x02, 0x05, 0x04,
+0xFD, 0x05, 0x03, 0xFD, 0xFB, 0x03, 0x01, 0xFF, 0x01, 0x05, 0xFC, 0x01, 0xFC, 0x05, 0x02, 0xFE,
+0x02, 0xFC, 0x00, 0xFC, 0x02, 0x00, 0xFD, 0x00, 0xFE, 0xFE, 0xFA, 0x01, 0xFE, 0x04, 0x05, 0xFF,
+0xFB, 0x00, 0x04, 0x02, 0x01, 0xFD, 0xFC, 0xFD, 0xFE, 0x06, 0xFB, 0x06, 0x06, 0x02, 0xFD, 0x01,
+0x03, 0xFF, 0x05, 0x05, 0xFE, 0xFD, 0xFA, 0xFD, 0xFE, 0x05, 0x02, 0xFF, 0x02, 0x05, 0x00, 0x02,
+0x05, 0x03, 0x06, 0x02, 0x03, 0x02, 0x06, 0x00, 0xFC, 0x04, 0x00, 0xFA, 0x01, 0xFA, 0x05, 0x04,
+0x00, 0xFC, 0xFD, 0xFE, 0x01, 0x03, 0xFA, 0x02, 0x06, 0xFD, 0xFA, 0x04, 0xFE, 0x04, 0x02, 0xFC,
+0x02, 0x00, 0xFC, 0x03, 0x06, 0x06, 0xFC, 0xFC, 0xFA, 0x02, 0xFC, 0xFE, 0x02, 0x06, 0xFB, 0x06,
+0xFF, 0xFE, 0x01, 0x00, 0xFE, 0x03, 0xFF, 0x06, 0xFD, 0x04, 0x05, 0x01, 0xFD, 0x02, 0x03, 0x02,
+0xFA, 0x05, 0xFF, 0x00, 0xFA, 0xFD, 0x02, 0xFE, 0x02, 0x01, 0x00, 0xFA, 0x03, 0x00, 0x04, 0xFD,
+0xFA, 0xFE, 0x06, 0x00, 0xFC, 0x02, 0x05, 0xFA, 0x00, 0x02, 0xFC, 0x02, 0xFA, 0x02, 0x02, 0xFD,
+0xFE, 0xFF, 0x09, 0xFD, 0x01, 0xFB, 0xFB, 0xFC, 0xFA, 0x06, 0x06, 0x02, 0xFE, 0xF9, 0x0A, 0x09,
+0x01, 0x04, 0xFF, 0x00, 0xF7, 0x03, 0xFA, 0xFD, 0x03, 0x07, 0x07, 0x01, 0xF4, 0x01, 0xFA, 0xFD,
+0xFC, 0xFB, 0x05, 0xF8, 0xFC, 0x00, 0x01, 0xF9, 0xFD, 0x02, 0x02, 0x03, 0xFB, 0xFF, 0xFE, 0x05,
+0xFD, 0xFF, 0xFB, 0xFD, 0xFA, 0x09, 0xF9, 0xFE, 0x03, 0x0B, 0x02, 0x04, 0xFF, 0x08, 0xFF, 0x0B,
+0x02, 0xFF, 0x07, 0xFB, 0xFE, 0xFD, 0x00, 0xFA, 0x00, 0x01, 0x06, 0xFE, 0x01, 0x00, 0x03, 0xFF,
+0x02, 0x04, 0xF7, 0xFC, 0xFA, 0x03, 0xFE, 0xFF, 0x01, 0x10, 0x05, 0x04, 0xFD, 0x01, 0xFF, 0x04,
+0xF9, 0xFE, 0x02, 0x06, 0x06, 0x01, 0x00, 0x04, 0x09, 0xFD, 0x00, 0xF6, 0xFB, 0x04, 0xFE, 0x00,
+0xFC, 0x05, 0x01, 0xFF, 0xFB, 0x00, 0x04, 0xFC, 0x09, 0x0E, 0x00, 0x03, 0x00, 0x09, 0x04, 0xFE,
+0xFF, 0xFA, 0xFD, 0xFE, 0x01, 0x00, 0xFD, 0xFA, 0xFB, 0x05, 0x02, 0xFE, 0x02, 0xF9, 0x06, 0x04,
+0xF9, 0x08, 0xFA, 0xF7, 0xF9, 0x03, 0xFB, 0xFE, 0x02, 0x0D, 0x03, 0x01, 0xFD, 0x06, 0xFD, 0x02,
+0x00, 0xF9, 0xFD, 0xF8, 0x05, 0xFD, 0xFB, 0x00, 0xFC, 0xFE, 0xFF, 0xFA, 0xF7, 0xFC, 0xFF, 0x00,
+0xFA, 0x03, 0xFE, 0xF9, 0xFA, 0x01, 0xFA, 0xFC, 0x03, 0x0C, 0x05, 0x06, 0x06, 0xFF, 0x02, 0x00,
+0xFC, 0xFE, 0xFF, 0xFD, 0x02, 0xFA, 0x00, 0xF9, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0xFF, 0x06, 0x00,
+0xFA, 0x05, 0xF8, 0xFA, 0xF9, 0x06, 0x04, 0xFF, 0xFE, 0x0D, 0x06, 0xFF, 0xFE, 0x02, 0x00, 0x00,
+0x02, 0xF8, 0xFF, 0x01, 0x01, 0xF6, 0xF7, 0xFF, 0x03, 0x05, 0x00, 0x00, 0xFB, 0xF9, 0x04, 0x03,
+0xF5, 0x00, 0xF8, 0xF9, 0xFE, 0x03, 0xF9, 0xF7, 0x07, 0x06, 0x05, 0x04, 0x05, 0x07, 0x02, 0xF7,
+0x01, 0xFF, 0xFE, 0x02, 0xFD, 0x00, 0xFA, 0xFD, 0x00, 0x05, 0xFE, 0x01, 0xFB, 0x02, 0x08, 0x02,
+0xFD, 0x02, 0xFE, 0xF9, 0xFE, 0x07, 0xF8, 0x00, 0xFE, 0x07, 0x02, 0x04, 0xF2, 0x00, 0x02, 0xE8,
+0x00, 0xFA, 0x02, 0xFD, 0xFA, 0xFC, 0x00, 0xFC, 0x01, 0xFD, 0x00, 0xFD, 0xFD, 0x05, 0x0A, 0x01,
+0x04, 0xFD, 0xFF, 0xFB, 0x01, 0x01, 0x02, 0x02, 0xFE, 0x0B, 0x02, 0x04, 0xF7, 0x05, 0xFE, 0xFD,
+0xFE, 0x00, 0x03, 0xFD, 0xFF, 0xFA, 0xFB, 0xFD, 0x04, 0xFE, 0xFD, 0xFB, 0xFD, 0x00, 0x05, 0xFA,
+0x02, 0xFE, 0xFF, 0x04, 0xFB, 0x04, 0xFB, 0xFD, 0x02, 0x0E, 0xFD, 0x02, 0x00, 0x04, 0x00, 0x00,
+0x00, 0x03, 0x08, 0xFF, 0xFD, 0x00, 0xFC, 0xFF, 0x05, 0xFD, 0x09, 0xFE, 0xFE, 0x07, 0xFD, 0xFC,
+0x01, 0x02, 0xFD, 0x01, 0x02, 0x08, 0x00, 0xFC, 0x03, 0x0B, 0xFD, 0x01, 0x04, 0x03, 0xFC, 0x06,
+0xFF, 0x00, 0x03, 0xFC, 0x01, 0xFA, 0xF9, 0xFF, 0x02, 0x03, 0x00, 0xFF, 0xF8, 0xFA, 0x02, 0x08,
+0xFB, 0xFD, 0xFD, 0xFA, 0x01, 0x05, 0xFE, 0xFD, 0xFB, 0x0A, 0x05, 0x01, 0x00, 0x03, 0xFF, 0xFA,
+0x00, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xF7, 0xFA, 0xFC, 0x00, 0x00, 0x02, 0xFB, 0x03, 0xFF, 0x00,
+0xFE, 0x06, 0xF9, 0xFA, 0x01, 0x00, 0x00, 0xF7, 0x05, 0x0D, 0xFE, 0x02, 0x01, 0xFF, 0x02, 0xF6,
+0x03, 0xFE, 0x01, 0xFD, 0x02, 0xFC, 0xFA, 0xFB, 0x00, 0x04, 0x05, 0xFD, 0x01, 0x02, 0x07, 0xFF,
+0x00, 0x03, 0xFE, 0x00, 0xFC, 0x03, 0xFF, 0xFB, 0xFD, 0x07, 0x06, 0xFE, 0x02, 0x04, 0xFE, 0xF8,
+0x03, 0xFF, 0xFE, 0x01, 0xFD, 0x03, 0xFE, 0xFC, 0x03, 0xFF, 0xFF, 0x04, 0x00, 0x03, 0x03, 0x06,
+0xF8, 0x04, 0xFB, 0xFB, 0x02, 0xFF, 0x00, 0xFE, 0x03, 0x07, 0x06, 0x05, 0xFA, 0x03, 0xFC, 0x0D,
+0xFF, 0x00, 0x03, 0xFD, 0x01, 0x02, 0xFF, 0xFD, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0x05,
+0xFD, 0x05, 0xFC, 0x01, 0xFC, 0x07, 0x03, 0x01, 0x01, 0x0B, 0x04, 0x00, 0xFB, 0x01, 0x01, 0xDA,
+0xFD, 0x00, 0x03, 0xF8, 0x02, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x03, 0x00, 0xFD, 0x01, 0x02, 0x01,
+0x03, 0xFE, 0x02, 0xFF, 0xFE, 0x02, 0xFC, 0x00, 0x08, 0x09, 0x06, 0x03, 0x05, 0x05, 0x01, 0xE5,
+0xFE, 0xFD, 0x08, 0x00, 0x01, 0x01, 0xFD, 0xFD, 0x00, 0xFD, 0x00, 0xFB, 0x02, 0x04, 0x02, 0x05,
+0xFD, 0x03, 0x02, 0xFE, 0xFF, 0xFE, 0x00, 0x01, 0x02, 0x0A, 0x01, 0xFF, 0xFF, 0x02, 0xFE, 0xD2,
+0xFE, 0xFC, 0x00, 0xFB, 0x00, 0xFF, 0xFC, 0xF9, 0xFF, 0x02, 0x00, 0xFE, 0xFD, 0xFF, 0x02, 0x02,
+0x01, 0x01, 0x01, 0xFD, 0xFB, 0x01, 0xFA, 0x00, 0x03, 0x07, 0x01, 0x05, 0xFF, 0x00, 0xFF, 0xEF,
+0xFA, 0xFF, 0x01, 0x01, 0x01, 0x02, 0xFE, 0xFB, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x01, 0x05, 0x05,
+0xFC, 0x01, 0xFE, 0xFB, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0x01, 0xFD, 0xFF, 0xFF, 0xDC,
+0xFE, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0xFB, 0xFD, 0x05, 0xFF, 0xFE, 0x00, 0xFF, 0x01, 0x05, 0x01,
+0x04, 0x00, 0xFF, 0xFD, 0x01, 0x04, 0x01, 0xFC, 0xFF, 0x0A, 0x02, 0xFE, 0xFB, 0x04, 0xFC, 0xE8,
+0xFD, 0xFF, 0x04, 0xFD, 0x03, 0xFB, 0x02, 0xFE, 0xFF, 0x02, 0xFC, 0xFB, 0xFD, 0xFD, 0x04, 0x05,
+0x00, 0xFF, 0xFF, 0xFC, 0xF9, 0x03, 0xFF, 0x00, 0x06, 0x0A, 0x01, 0x01, 0xFD, 0x04, 0x00, 0xDF,
+0xFB, 0x00, 0xFF, 0xFB, 0x02, 0x01, 0x00, 0xFD, 0x01, 0x02, 0x01, 0xFD, 0xFC, 0xFD, 0x01, 0x04,
+0xFD, 0x01, 0xFF, 0xFB, 0xFA, 0x06, 0xFB, 0xFD, 0x00, 0x09, 0xFD, 0x03, 0x03, 0x02, 0xFE, 0xD0,
+0xFD, 0x00, 0x02, 0xFB, 0x00, 0x00, 0xFE, 0xFE, 0xFF, 0x01, 0xFF, 0xFE, 0xFE, 0x00, 0xFE, 0xFF,
+0x01, 0x02, 0x01, 0xFB, 0xFD, 0x05, 0xFC, 0xFC, 0xFF, 0x09, 0x05, 0xFE, 0x00, 0x05, 0xFE, 0xEB,
+0xFC, 0xFF, 0x01, 0xFC, 0x03, 0x00, 0xFD, 0xFF, 0xFE, 0xFB, 0x01, 0xFB, 0xFD, 0x03, 0x03, 0xFE,
+0xFE, 0x00, 0x02, 0xFD, 0xFD, 0x00, 0x00, 0x02, 0x06, 0x09, 0x03, 0x00, 0xFF, 0x01, 0x00, 0xC9,
+0xFE, 0x00, 0x03, 0x02, 0xFE, 0xFA, 0x01, 0xFD, 0x02, 0x01, 0x03, 0x03, 0xFF, 0x06, 0xFF, 0x03,
+0xFF, 0x02, 0xFF, 0xFE, 0xFE, 0x04, 0xFB, 0x01, 0x00, 0x09, 0x00, 0x02, 0xFD, 0x04, 0xFA, 0xC9,
+0x00, 0x01, 0x00, 0x01, 0x03, 0xFE, 0xFF, 0x00, 0x02, 0xFB, 0x01, 0xFE, 0xFA, 0x01, 0x02, 0x04,
+0xFE, 0x01, 0xFD, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x03, 0x04, 0xFE, 0x05, 0xFD, 0x02, 0xFE, 0xF0,
+0xFD, 0xFE, 0x03, 0x01, 0x02, 0xFE, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0xFD, 0x05, 0x03, 0x01,
+0xFC, 0x01, 0xFD, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0xFF, 0x04, 0xFF, 0x03, 0xFE, 0x05, 0x02, 0xCF,
+0x00, 0xFD, 0x02, 0x01, 0x04, 0xFD, 0xFF, 0xFD, 0x03, 0xFD, 0x00, 0xFF, 0x02, 0x01, 0x02, 0xFF,
+0x03, 0x01, 0xFC, 0x00, 0xFA, 0x03, 0xFE, 0x01, 0x03, 0x09, 0x01, 0x02, 0xFC, 0x04, 0x01, 0xD1,
+0xFF, 0x00, 0x02, 0xFD, 0x03, 0x00, 0x01, 0xFC, 0xFF, 0xFE, 0x06, 0xFC, 0xFE, 0x02, 0x00, 0x02,
+0x02, 0x04, 0x00, 0xFD, 0xFE, 0x03, 0x00, 0x01, 0x04, 0x09, 0xFE, 0x01, 0xFD, 0x04, 0x00, 0xC6,
+0xFD, 0xFE, 0x02, 0xFF, 0x01, 0x01, 0xFF, 0x00, 0xFE, 0xFF, 0x02, 0xFC, 0x01, 0x00, 0x01, 0x05,
+0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x02, 0xFC, 0xFC, 0x00, 0x09, 0x01, 0x00, 0xFE, 0x06, 0xFD, 0xDA,
+0xFB, 0xFD, 0x02, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0xFD, 0x01, 0x00, 0x00,
+0xFD, 0x01, 0x00, 0xFE, 0xFE, 0x02, 0xFE, 0xFE, 0x03, 0x06, 0x01, 0x00, 0x01, 0x05, 0xFF, 0xCD,
+0xFC, 0xFE, 0x01, 0xFA, 0x04, 0xFD, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFC, 0xFD, 0x04, 0x01, 0xFE,
+0x00, 0x02, 0x03, 0xFE, 0xFF, 0xFF, 0x00, 0xFD, 0x04, 0x08, 0x02, 0x02, 0x02, 0x03, 0xFD, 0xC3,
+0xFE, 0xFE, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x02, 0xFC, 0xFD, 0xFE, 0x02, 0x01,
+0xFE, 0x03, 0xFF, 0xFE, 0xFB, 0x03, 0x00, 0xFF, 0x03, 0x09, 0x02, 0x01, 0xFD, 0x03, 0x01, 0xCA,
+0xFC, 0xFB, 0x05, 0xFC, 0x02, 0xFF, 0xFE, 0xFD, 0x02, 0xFE, 0xFE, 0x00, 0xFE, 0xFF, 0x00, 0xFE,
+0x01, 0x02, 0xFB, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x06, 0x07, 0x00, 0x01, 0xFD, 0x04, 0x01, 0xD9,
+0xFD, 0xFF, 0x04, 0xFF, 0x02, 0xFF, 0xFD, 0x02, 0x07, 0xF7, 0x03, 0x00, 0x00, 0x07, 0xFE, 0xFD,
+0xFF, 0xFF, 0xFD, 0xFB, 0x00, 0xFE, 0xFF, 0x00, 0x02, 0x06, 0x00, 0x02, 0x00, 0x03, 0x00, 0xDB,
+0x00, 0xFE, 0x02, 0x02, 0x01, 0xFC, 0x01, 0x02, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0x01, 0xFE,
+0xFE, 0x02, 0xFC, 0xFE, 0xFD, 0x03, 0x00, 0xFE, 0x00, 0x09, 0x00, 0x05, 0xFD, 0x06, 0xFF, 0xFC,
+0x02, 0xFD, 0x04, 0xFF, 0x05, 0xFE, 0xFF, 0xFC, 0x05, 0xFF, 0x03, 0xFF, 0x04, 0xFE, 0xFD, 0x01,
+0x00, 0x00, 0xFC, 0xFD, 0xFD, 0x02, 0xFD, 0xFE, 0x02, 0x08, 0x02, 0xFF, 0xFC, 0x04, 0x00, 0xF0,
+0x02, 0xFE, 0x03, 0x02, 0x02, 0xFF, 0xFD, 0xFD, 0x02, 0xFF, 0x01, 0xFC, 0xFD, 0x00, 0xFF, 0x00,
+0xFE, 0x01, 0x00, 0xFD, 0xFD, 0x01, 0x01, 0xFF, 0x04, 0x06, 0x03, 0x02, 0x01, 0x06, 0xFA, 0xF3,
+0xFD, 0xFD, 0x01, 0x00, 0x03, 0x01, 0xFE, 0x02, 0x00, 0xFB, 0x01, 0xFE, 0xFC, 0x04, 0x02, 0x00,
+0x00, 0x01, 0xFE, 0xFF, 0xFB, 0x02, 0xFD, 0x00, 0x01, 0x03, 0x03, 0x00, 0x01, 0x07, 0x02, 0xEB,
+0xFC, 0xFF, 0x03, 0xFC, 0x02, 0x00, 0x01, 0x02, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x05, 0xFF, 0xFE,
+0xFE, 0x01, 0x01, 0xFD, 0xFC, 0xFE, 0xFF, 0x02, 0x03, 0x02, 0x03, 0x03, 0x00, 0x06, 0x01, 0xFA,
+0xFE, 0xFF, 0x01, 0x01, 0x01, 0xFC, 0x02, 0xFE, 0x05, 0xFD, 0x02, 0x00, 0x01, 0x07, 0xFF, 0x00,
+0xFC, 0x02, 0xFD, 0xFF, 0xFF, 0x02, 0xFF, 0x00, 0x05, 0x02, 0xFF, 0x04, 0x03, 0x07, 0xFD, 0xF1,
+0xFD, 0xFF, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFE, 0x01, 0xFD, 0x05, 0xFF, 0xFD, 0x01, 0xFE, 0xFF,
+0xFF, 0xFE, 0xFF, 0x01, 0xFC, 0x02, 0xFB, 0x01, 0x03, 0x09, 0xFE, 0x03, 0x01, 0x04, 0x02, 0xE0,
+0xFE, 0x01, 0x00, 0xFD, 0x01, 0x01, 0xFF, 0x00, 0x02, 0xFA, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+0xFD, 0x03, 0xFE, 0x01, 0xFD, 0xFE, 0x01, 0xFD, 0x04, 0x09, 0x00, 0x04, 0xFF, 0x02, 0x01, 0xEA,
+0xFD, 0xFD, 0x02, 0x00, 0x04, 0xFE, 0xFF, 0x01, 0x04, 0xF9, 0xFC, 0xFF, 0x02, 0x08, 0x04, 0xFF,
+0x02, 0x01, 0xFC, 0x01, 0xFF, 0x02, 0xFF, 0xFE, 0x03, 0x02, 0xFE, 0x03, 0x01, 0x07, 0xFF, 0xE7,
+0x00, 0x00, 0xFE, 0x01, 0x03, 0x00, 0x00, 0xFD, 0x06, 0xF7, 0x00, 0xFC, 0x02, 0x06, 0xFE, 0xFF,
+0x00, 0x01, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0xFF, 0x03, 0x02, 0x02, 0x01, 0x00, 0x06, 0xFE, 0xF6,
+0xFD, 0xFF, 0x02, 0x00, 0x01, 0x04, 0xFD, 0xFE, 0x01, 0xFD, 0x03, 0x00, 0x01, 0x03, 0x02, 0x02,
+0x01, 0x02, 0xFF, 0xFD, 0xFF, 0x01, 0xFB, 0xFD, 0x03, 0x03, 0x00, 0x03, 0xFE, 0x05, 0x00, 0xF8,
+0x01, 0x00, 0xFA, 0x04, 0x00, 0xFA, 0x01, 0xFD, 0x01, 0x05, 0xFE, 0xFE, 0x03, 0x02, 0xFE, 0xFE,
+0x03, 0x03, 0x02, 0xFF, 0x01, 0x06, 0x05, 0x04, 0xFC, 0xFC, 0x01, 0xFD, 0xFA, 0x02, 0xFD, 0x03,
+0xFE, 0x06, 0xFD, 0x01, 0x05, 0x03, 0xFE, 0x04, 0xFB, 0xFB, 0xFE, 0xFD, 0xFE, 0x02, 0xFB, 0xFC,
+0x06, 0x01, 0x02, 0x01, 0x00, 0x03, 0xFD, 0xFB, 0xFF, 0xFD, 0x01, 0x00, 0xFF, 0x02, 0x02, 0xFE,
+0x06, 0xFA, 0x06, 0x04, 0xFE, 0xFE, 0x02, 0xFD, 0xFA, 0xFE, 0xFF, 0x01, 0xFB, 0xFC, 0x00, 0x02,
+0x01, 0xFC, 0xFD, 0xFC, 0xFF, 0x03, 0x04, 0xFA, 0x00, 0xFB, 0x02, 0x05, 0xFD, 0x05, 0xFA, 0x01,
+0xFB, 0xFF, 0x00, 0xFC, 0x04, 0xFC, 0xFB, 0xFB, 0x06, 0x01, 0xFB, 0x01, 0xFD, 0xFC, 0xFB, 0xFB,
+0x01, 0xFD, 0x04, 0x02, 0xFC, 0x04, 0xFF, 0xFE, 0x00, 0x02, 0x06, 0x01, 0xFE, 0xFF, 0x00, 0x06,
+0xFE, 0xFF, 0x04, 0xFC, 0x06, 0xFB, 0x00, 0x04, 0xFF, 0x03, 0x03, 0x05, 0x05, 0xFF, 0x05, 0x05,
+0xFD, 0x02, 0x06, 0xFB, 0xFE, 0x05, 0xFB, 0xFC, 0x00, 0xFC, 0x04, 0xFE, 0xFC, 0x04, 0x04, 0xFA,
+0xFB, 0xFB, 0x06, 0xFD, 0xFC, 0xFC, 0xFF, 0x00, 0xFC, 0x04, 0x03, 0xFB, 0xFE, 0x05, 0x06, 0xFC,
+0x06, 0xFF, 0xFA, 0x05, 0xFB, 0x03, 0xFE, 0xFB, 0x05, 0x05, 0x00, 0xFE, 0x02, 0x05, 0xFA, 0xFA,
+0x03, 0xFB, 0x03, 0x04, 0xFC, 0x02, 0xFF, 0xFE, 0xFE, 0x06, 0x04, 0xFC, 0xFC, 0xFC, 0x00, 0x02,
+0x04, 0xFD, 0xFC, 0xFE, 0x05, 0xFB, 0xFA, 0xFD, 0xFC, 0xFF, 0xFC, 0x01, 0x01, 0xFC, 0xFD, 0xFF,
+0xFD, 0x04, 0xFA, 0x06, 0xFC, 0x04, 0xFA, 0xFC, 0xFD, 0x01, 0xFC, 0x04, 0x01, 0x02, 0xFD, 0x02,
+0xFD, 0xFF, 0x03, 0xFD, 0xFB, 0x00, 0x02, 0xFF, 0x00, 0xFC, 0x04, 0xFD, 0xFE, 0xFB, 0x01, 0x02,
+0xFB, 0xF9, 0x08, 0xF9, 0x04, 0xFC, 0xFA, 0xFC, 0xFC, 0x01, 0x08, 0x00, 0xFE, 0x03, 0x01, 0x04,
+0x02, 0x05, 0xFC, 0xFB, 0xFC, 0x03, 0xFF, 0xFB, 0x08, 0x05, 0x07, 0x06, 0xFC, 0x03, 0xFC, 0xF6,
+0xFD, 0xF9, 0x04, 0xF8, 0x07, 0x01, 0xF8, 0xF7, 0x04, 0x02, 0x01, 0xFF, 0xF9, 0xFD, 0x04, 0x04,
+0xFF, 0x08, 0x00, 0xFA, 0xFD, 0x06, 0xF9, 0xF5, 0x07, 0x04, 0x05, 0x05, 0xFD, 0x05, 0xFC, 0x0C,
+0xFC, 0xFA, 0x06, 0xF4, 0x00, 0xF4, 0xFB, 0xFA, 0x02, 0x00, 0x09, 0xFE, 0xF9, 0x01, 0x04, 0x08,
+0xFB, 0x09, 0xF7, 0xFD, 0xF4, 0x02, 0xFF, 0xF6, 0x02, 0x04, 0x02, 0x02, 0xFB, 0xFA, 0xFD, 0xFE,
+0xFB, 0xF9, 0x06, 0xF6, 0x02, 0xFE, 0xF8, 0xF7, 0xFF, 0x02, 0x04, 0xFF, 0xF9, 0xFD, 0x08, 0x02,
+0xFB, 0x0A, 0xFD, 0xFB, 0xF9, 0x0C, 0xF3, 0xFE, 0x02, 0x02, 0xFF, 0xFF, 0xFA, 0x01, 0xFD, 0x06,
+0xFF, 0xFD, 0x07, 0xFF, 0x02, 0xF7, 0xFD, 0xF8, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x09, 0x0B, 0x05,
+0xF6, 0x02, 0xFA, 0xFC, 0xFB, 0x09, 0xFA, 0xF6, 0x00, 0x03, 0x01, 0xFF, 0xFC, 0x00, 0xF6, 0x03,
+0x00, 0xFD, 0x08, 0xFA, 0x06, 0xF7, 0xFE, 0xFE, 0x05, 0x00, 0x06, 0xFF, 0xF9, 0x06, 0x07, 0x03,
+0xFE, 0x04, 0xF5, 0xFE, 0xF7, 0x04, 0xFA, 0xF8, 0x01, 0x02, 0x02, 0x0A, 0xF7, 0xFF, 0xFA, 0x03,
+0xFD, 0xFD, 0x05, 0xF8, 0x02, 0xFE, 0xFA, 0xFB, 0x0A, 0xFA, 0x08, 0xFE, 0xF9, 0x08, 0x04, 0x02,
+0x01, 0x0B, 0xF9, 0xFF, 0x00, 0x04, 0xFB, 0xFC, 0x03, 0x03, 0x02, 0x06, 0xFE, 0x05, 0xFF, 0x04,
+0xFC, 0xF5, 0x08, 0xFB, 0x04, 0xFE, 0xFC, 0xFD, 0xFD, 0x04, 0x08, 0xF9, 0xF7, 0x04, 0x04, 0x02,
+0x01, 0x03, 0xFF, 0xFD, 0xF7, 0x08, 0xFD, 0xF7, 0x00, 0x04, 0x06, 0x03, 0xFF, 0xFF, 0xF9, 0xED,
+0xF9, 0xF9, 0x0A, 0xFA, 0x09, 0xFE, 0xFB, 0xFD, 0x05, 0xFF, 0x09, 0xFB, 0xFE, 0x07, 0x02, 0x02,
+0xFB, 0x0A, 0xFD, 0x00, 0xFB, 0x0A, 0xFD, 0xFD, 0x06, 0x02, 0x08, 0x06, 0xFD, 0x06, 0xF9, 0xF7,
+0xFE, 0xFB, 0x05, 0xF9, 0x02, 0xF8, 0xFD, 0xF6, 0x0A, 0x03, 0x04, 0xF9, 0xFB, 0xFF, 0x05, 0x0B,
+0x01, 0x08, 0xFA, 0xF8, 0xFD, 0x09, 0xFC, 0xFD, 0x04, 0x02, 0x03, 0x07, 0xF5, 0x01, 0xFC, 0x05,
+0xFE, 0xFC, 0x09, 0xFC, 0x06, 0xFE, 0xFD, 0xFD, 0x03, 0xFB, 0x0B, 0xFB, 0xFA, 0x05, 0x0B, 0x08,
+0xFC, 0x06, 0x00, 0xF9, 0x01, 0x01, 0xFB, 0xF9, 0x01, 0x03, 0x05, 0x07, 0xF7, 0xFD, 0xF7, 0x03,
+0xF7, 0xF6, 0xFF, 0xFB, 0x02, 0xFB, 0xFC, 0xF9, 0x08, 0xFC, 0x02, 0xFA, 0xF9, 0x03, 0x03, 0x04,
+0xFF, 0x01, 0xF9, 0xFA, 0xFE, 0x0A, 0xFE, 0xFE, 0x05, 0x02, 0x08, 0x0B, 0xFA, 0x01, 0xFA, 0x07,
+0xFA, 0xF9, 0x03, 0xFA, 0x00, 0xF6, 0xF8, 0xFB, 0x05, 0x06, 0x04, 0xF9, 0xFC, 0x00, 0x07, 0x0B,
+0xFB, 0x06, 0x01, 0xF5, 0xF6, 0x09, 0x01, 0xF4, 0x01, 0x02, 0x02, 0x0A, 0xF7, 0xFC, 0xFF, 0x01,
+0xFF, 0xFE, 0x0A, 0xFC, 0x09, 0xFD, 0xF7, 0xFC, 0x02, 0xFF, 0x01, 0xF9, 0xFA, 0xFF, 0x0A, 0x07,
+0xFE, 0x04, 0xFC, 0xFD, 0xF3, 0x08, 0xF7, 0xFB, 0x03, 0x03, 0x01, 0x04, 0xFE, 0x01, 0xF9, 0xE8,
+0xFD, 0xFB, 0x05, 0xFD, 0x0A, 0xFB, 0xF8, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0xFC, 0x06, 0x07, 0x03,
+0xFA, 0x09, 0xF7, 0xFC, 0xFE, 0x00, 0xFA, 0xFD, 0x04, 0x02, 0x07, 0x07, 0xF6, 0x02, 0xFC, 0x03,
+0xFE, 0xFB, 0x0A, 0xF7, 0x04, 0xFB, 0xF8, 0xFA, 0x09, 0x01, 0x04, 0xFF, 0xF6, 0xFE, 0x0C, 0x06,
+0xFB, 0x03, 0xFE, 0xFD, 0xFE, 0x05, 0xF9, 0xF6, 0xFF, 0x03, 0x08, 0x07, 0xF6, 0xFE, 0xF4, 0x01,
+0xFC, 0xF5, 0x07, 0xFB, 0x01, 0xFC, 0xFA, 0xF9, 0x04, 0x00, 0x06, 0xFB, 0xFF, 0x02, 0x06, 0x06,
+0xFC, 0x03, 0xFD, 0xFF, 0xF6, 0x08, 0xFB, 0xFD, 0x02, 0x03, 0x04, 0x02, 0xF8, 0x07, 0xF6, 0x11,
+0xFD, 0xF7, 0x02, 0xFC, 0x07, 0xF6, 0xFE, 0xF8, 0x03, 0xFD, 0x07, 0xFE, 0xFE, 0xFF, 0x06, 0x06,
+0x00, 0x07, 0xFB, 0xF8, 0xF9, 0x08, 0xF7, 0xFE, 0x05, 0x01, 0x04, 0x06, 0xF6, 0x03, 0xF9, 0x03,
+0xFB, 0xF8, 0x06, 0xFC, 0x05, 0xFE, 0xF8, 0xF6, 0x03, 0x00, 0x04, 0xFD, 0xFE, 0xFF, 0x06, 0x04,
+0xF9, 0x04, 0xFF, 0xF6, 0xFA, 0x03, 0xFC, 0xFB, 0x05, 0x03, 0x07, 0x09, 0x00, 0x05, 0xF8, 0xFB,
+0xF8, 0xFA, 0x0B, 0xFB, 0x08, 0xFD, 0xFA, 0x00, 0x03, 0xFD, 0x06, 0xFC, 0xFF, 0x00, 0x06, 0x0B,
+0xFE, 0x03, 0xFA, 0xF7, 0xFC, 0x07, 0xF8, 0xF4, 0x09, 0x01, 0x0C, 0x06, 0xFA, 0xFE, 0xFB, 0xEF,
+0xF9, 0xFB, 0x08, 0xFC, 0x04, 0xFC, 0xF6, 0xF9, 0x05, 0xFE, 0x04, 0xFA, 0xF6, 0xFF, 0x08, 0x09,
+0xF9, 0x06, 0xF8, 0xFA, 0xF6, 0x02, 0xFB, 0xFC, 0x03, 0x01, 0x04, 0x07, 0x00, 0x0C, 0x02, 0xF7,
+0xF9, 0xF7, 0x03, 0xFB, 0x05, 0xF6, 0xFC, 0xFD, 0x02, 0xFB, 0x07, 0xFD, 0xF8, 0x07, 0x0B, 0x07,
+0xFE, 0x03, 0x00, 0xFB, 0xF8, 0x02, 0xFA, 0xFE, 0x05, 0x02, 0x04, 0x01, 0xFC, 0x04, 0xF8, 0xFD,
+0xFC, 0xFC, 0x04, 0x00, 0x0A, 0xFB, 0xFE, 0xFD, 0xFF, 0x01, 0x09, 0xFB, 0xF8, 0x05, 0x08, 0x04,
+0xFE, 0x03, 0xFB, 0xFC, 0xF1, 0x04, 0xFA, 0xFE, 0x0B, 0x04, 0x05, 0x0A, 0xF8, 0x03, 0xFE, 0xED,
+0xFF, 0xFB, 0x05, 0xFA, 0x07, 0xF8, 0xFD, 0xFE, 0x00, 0x01, 0x02, 0xF9, 0xF9, 0x00, 0x05, 0x07,
+0xFB, 0x05, 0xF9, 0xF8, 0xF7, 0x06, 0xF7, 0xFE, 0x01, 0x03, 0x04, 0x07, 0xF5, 0x03, 0xFA, 0xF1,
+0xF9, 0xFE, 0x05, 0xF9, 0xFD, 0xFA, 0xF8, 0xF7, 0x01, 0xFF, 0x04, 0x01, 0xFC, 0x03, 0x08, 0x05,
+0xFA, 0x09, 0xF6, 0xFE, 0xFE, 0x05, 0xFB, 0xF4, 0x01, 0x03, 0x09, 0x09, 0x02, 0x06, 0xFE, 0x08,
+0xFC, 0xFE, 0x03, 0xFD, 0x08, 0xFB, 0xFB, 0xFC, 0xFF, 0xF8, 0x00, 0xFB, 0xFA, 0x01, 0x08, 0x03,
+0xF7, 0x06, 0xFB, 0xFB, 0xFB, 0x07, 0xF8, 0xF9, 0x05, 0x02, 0x08, 0x00, 0xFE, 0x07, 0xFB, 0xE8,
+0xFC, 0xFD, 0x06, 0xFD, 0xFD, 0xF6, 0xF6, 0xF7, 0x04, 0x03, 0x00, 0xFD, 0xF9, 0x08, 0x05, 0x0B,
+0xF8, 0x08, 0xFD, 0xF7, 0xF8, 0x00, 0xFC, 0xF9, 0x04, 0x01, 0x02, 0x09, 0xFD, 0x00, 0xF6, 0xFE,
+0xF8, 0x01, 0x03, 0xFE, 0x04, 0xFC, 0xFD, 0xFA, 0x0A, 0xFB, 0x01, 0xFC, 0xFB, 0x08, 0x02, 0x06,
+0xFB, 0x08, 0xFB, 0x00, 0xFE, 0x05, 0xF6, 0xF8, 0x05, 0x02, 0x07, 0x0A, 0xFF, 0x07, 0xF9, 0xED,
+0xFC, 0xF8, 0x0A, 0xF6, 0x01, 0xFF, 0xFF, 0xFD, 0x03, 0x02, 0x09, 0xFD, 0xFA, 0xFF, 0x07, 0x0A,
+0xFA, 0x07, 0xF9, 0xFC, 0xFB, 0x08, 0xF9, 0xF9, 0x04, 0x02, 0x08, 0x06, 0xF8, 0x02, 0xF9, 0xEC,
+0xFC, 0xFB, 0x07, 0xF7, 0x00, 0xF9, 0xF8, 0xF6, 0x00, 0xFB, 0x04, 0x00, 0xFA, 0x06, 0x04, 0x00,
+0xFE, 0x06, 0xFA, 0xFB, 0xF6, 0x09, 0xF9, 0xF7, 0x00, 0x02, 0x07, 0x03, 0xF8, 0x02, 0xFD, 0xE5,
+0xFC, 0xFE, 0x0A, 0xFA, 0x07, 0xFE, 0xFB, 0xFC, 0x03, 0xFE, 0x06, 0xFC, 0xFA, 0x05, 0x07, 0x07,
+0xFC, 0x0B, 0xFD, 0xFC, 0xFC, 0x03, 0xFC, 0xFF, 0x02, 0x02, 0x05, 0x05, 0xF9, 0x07, 0xFB, 0x01,
+0xFB, 0xFC, 0x0C, 0xF8, 0xFF, 0xFC, 0xFA, 0xFD, 0x02, 0xFA, 0x01, 0xFF, 0xF5, 0x00, 0x04, 0x03,
+0xFC, 0x09, 0xFE, 0xF9, 0xF7, 0x07, 0xF8, 0xFC, 0x07, 0x01, 0x04, 0x05, 0xFE, 0x04, 0x00, 0x08,
+0xFC, 0xFE, 0x06, 0xFA, 0x05, 0xFA, 0x01, 0xFA, 0x00, 0xFB, 0x04, 0xFD, 0xF3, 0x01, 0x0B, 0x08,
+0x00, 0x07, 0xFC, 0xF9, 0xFE, 0x02, 0xFF, 0xFD, 0x01, 0x02, 0x07, 0x08, 0xFA, 0x05, 0xFA, 0x08,
+0xFC, 0xF7, 0x09, 0xF5, 0x03, 0xF8, 0xFD, 0xFF, 0xFD, 0xFE, 0x01, 0xFB, 0xF9, 0x00, 0x09, 0x06,
+0xFD, 0x06, 0xF8, 0xF8, 0xFC, 0x07, 0xFB, 0xFA, 0x03, 0x02, 0x06, 0x06, 0xFB, 0xFD, 0xF7, 0xFC,
+0xF9, 0x00, 0x0A, 0xF6, 0x01, 0xF8, 0xF8, 0xFC, 0x03, 0xFA, 0x02, 0x01, 0xFD, 0xFF, 0x06, 0x08,
+0xF6, 0x03, 0xFA, 0xF9, 0xFD, 0x07, 0xF7, 0xFD, 0x03, 0x03, 0x07, 0x05, 0xF9, 0x00, 0xFB, 0xC8,
+0x01, 0xF7, 0x08, 0xF8, 0xFE, 0xFD, 0xF9, 0xFE, 0x00, 0xFE, 0x0A, 0xF9, 0xF5, 0x00, 0x05, 0x01,
+0xFC, 0x08, 0xFC, 0xFD, 0xF9, 0x0B, 0xF8, 0xFC, 0x03, 0x01, 0x05, 0x02, 0xF7, 0xFF, 0xF4, 0x03,
+0xFB, 0xF8, 0x07, 0xFD, 0x03, 0xFD, 0xF7, 0xFA, 0x00, 0xFE, 0x0B, 0xF5, 0xFA, 0x04, 0x07, 0x03,
+0x00, 0x05, 0xFD, 0xFD, 0xF6, 0x0A, 0xFA, 0xFF, 0x02, 0x02, 0x0B, 0x04, 0xFE, 0xFE, 0xF9, 0xE3,
+0xFC, 0xFA, 0x08, 0xFE, 0x06, 0xFD, 0xFB, 0xFB, 0x05, 0xF9, 0x07, 0xFE, 0xF8, 0x02, 0x05, 0x07,
+0xFD, 0x01, 0xFE, 0xF7, 0xFD, 0x02, 0xFC, 0xF7, 0x07, 0x03, 0x04, 0x04, 0xFA, 0x09, 0x00, 0xF3,
+0xF8, 0x00, 0x07, 0xFB, 0x06, 0xFB, 0xFA, 0xF5, 0x08, 0xFA, 0x04, 0xFD, 0xFE, 0x03, 0x02, 0x09,
+0xF7, 0x04, 0xF6, 0xFA, 0xFD, 0x01, 0xFD, 0xFB, 0x01, 0x03, 0x00, 0x06, 0xFD, 0x01, 0xFD, 0x07,
+0xFE, 0xFC, 0x00, 0xF5, 0x08, 0x01, 0xFA, 0xFC, 0x01, 0x00, 0x09, 0x02, 0xFF, 0xFC, 0x09, 0x09,
+0xF9, 0x0C, 0xFF, 0xFB, 0xF7, 0x06, 0xF2, 0xFD, 0x05, 0x00, 0x03, 0x05, 0xFE, 0x04, 0xFA, 0x00,
+0xF9, 0xFF, 0x0A, 0xFD, 0x03, 0xF7, 0xF8, 0xF7, 0x02, 0x07, 0x02, 0x01, 0xF5, 0x01, 0x09, 0x05,
+0xF8, 0x01, 0xFC, 0xFD, 0xF7, 0x09, 0xF2, 0xF7, 0x00, 0x02, 0xFF, 0x04, 0xFB, 0x02, 0xF5, 0xF1,
+0xFF, 0xF9, 0x07, 0xF9, 0x05, 0xFD, 0xF6, 0xF6, 0x02, 0xFE, 0x05, 0xFF, 0xFE, 0x00, 0x0E, 0x04,
+0xFE, 0x04, 0xF2, 0xF3, 0xF4, 0x04, 0xF9, 0xFD, 0xFF, 0x03, 0x08, 0x04, 0xF6, 0x00, 0xFC, 0xF7,
+0xFD, 0xFD, 0x08, 0xF8, 0x01, 0xFC, 0xF8, 0xFB, 0x01, 0xFD, 0x09, 0xFC, 0xF3, 0x05, 0x08, 0x07,
+0xFE, 0x04, 0xF8, 0x00, 0xF7, 0x02, 0x00, 0xFB, 0x06, 0x01, 0x00, 0x08, 0xF9, 0x07, 0xFE, 0xE4,
+0xFB, 0xFB, 0x02, 0xFD, 0x04, 0xFD, 0xFA, 0xFD, 0x06, 0xFB, 0x08, 0xFE, 0xF8, 0x03, 0x03, 0x06,
+0xF8, 0x04, 0xF8, 0xFD, 0xFD, 0x07, 0xF8, 0x00, 0x03, 0x03, 0x07, 0x05, 0xFB, 0x07, 0xF9, 0xD8,
+0xFA, 0xF8, 0x02, 0xFE, 0x06, 0xFC, 0xFD, 0xF8, 0x03, 0xFA, 0x03, 0xFD, 0xFE, 0x05, 0x04, 0x09,
+0xFA, 0x04, 0xFC, 0xFA, 0xFF, 0x02, 0xFF, 0xFA, 0x06, 0x03, 0x04, 0x03, 0xF4, 0x0A, 0xFB, 0xE6,
+0xFD, 0xFC, 0x08, 0xFF, 0x06, 0xFD, 0xFE, 0xF8, 0x09, 0xF9, 0x00, 0xFA, 0xF9, 0x0A, 0x08, 0x05,
+0xF9, 0x08, 0xF6, 0x00, 0xFF, 0x01, 0xFE, 0xFA, 0x02, 0x03, 0x06, 0x01, 0xFF, 0x06, 0xF8, 0xF4,
+0xF7, 0xF8, 0x0B, 0xF9, 0x08, 0xFA, 0xFE, 0xFB, 0x07, 0x02, 0x08, 0xFA, 0xFC, 0x07, 0x05, 0x02,
+0x02, 0x04, 0xF9, 0xFC, 0xFB, 0x06, 0xFC, 0xF6, 0x03, 0xFF, 0x01, 0x06, 0xF7, 0x05, 0xF8, 0xF3,
+0xFA, 0xFD, 0x07, 0xFC, 0x01, 0xFB, 0xFC, 0xF8, 0xFE, 0xFC, 0x04, 0xFC, 0xF8, 0x04, 0x08, 0x03,
+0xFA, 0x03, 0xFF, 0xF8, 0xFB, 0x03, 0xFE, 0xF6, 0x07, 0x03, 0x04, 0x05, 0xFE, 0x05, 0xF5, 0x02,
+0xF6, 0xFE, 0x09, 0xFB, 0x0B, 0xF8, 0xFC, 0xFF, 0x0A, 0xFF, 0x02, 0x00, 0xFD, 0xFE, 0x04, 0x08,
+0xF7, 0x04, 0xFB, 0xFE, 0xFC, 0x06, 0xF8, 0xFA, 0x04, 0x02, 0x07, 0x03, 0xFE, 0xFF, 0xFD, 0x02,
+0xFC, 0xFB, 0x07, 0xF9, 0x02, 0xFE, 0xFA, 0xF9, 0x03, 0xFC, 0x07, 0xF9, 0xFC, 0x03, 0x07, 0x03,
+0xF9, 0x04, 0xFE, 0xFD, 0xFB, 0x06, 0xFA, 0xF9, 0x00, 0x02, 0x05, 0x06, 0xFB, 0x04, 0xFA, 0x02,
+0xFA, 0xFD, 0x02, 0xFA, 0x02, 0xFB, 0xFA, 0xFD, 0x09, 0xFC, 0x0A, 0xF9, 0xFE, 0xFD, 0x02, 0x03,
+0xF8, 0x08, 0xFA, 0x01, 0xFE, 0x0A, 0xFF, 0xFB, 0x0A, 0x00, 0x03, 0x09, 0xFD, 0x02, 0xFB, 0xFD,
+0xFD, 0xFC, 0x02, 0xF9, 0x05, 0xFC, 0xFC, 0xFC, 0x04, 0xFE, 0x07, 0xFA, 0xFB, 0x01, 0x05, 0x0A,
+0xFA, 0x0A, 0xFC, 0xFE, 0xFA, 0x03, 0xFD, 0xF9, 0x05, 0x02, 0xFF, 0x06, 0xFA, 0x0A, 0xF9, 0x06,
+0xFC, 0xFB, 0x06, 0xFE, 0x06, 0xFB, 0xFE, 0xF6, 0xFE, 0xFC, 0x07, 0xFC, 0xFA, 0x05, 0x05, 0x06,
+0xF8, 0x07, 0xFD, 0xFB, 0xFC, 0x07, 0xF5, 0xFB, 0x04, 0x03, 0x07, 0x03, 0xFD, 0x00, 0xFD, 0xF1,
+0x01, 0xFF, 0x07, 0xF5, 0x08, 0xFD, 0xFF, 0xF7, 0xFE, 0x02, 0x05, 0xF9, 0xF7, 0x01, 0x01, 0x05,
+0x02, 0x07, 0xF5, 0x02, 0xF9, 0x04, 0xF4, 0xF5, 0x01, 0x03, 0x06, 0x00, 0xF8, 0x08, 0xF8, 0xFB,
+0xFE, 0xF9, 0xFF, 0xFE, 0x09, 0xFD, 0xFD, 0xFB, 0x04, 0xFD, 0x08, 0xFB, 0xFE, 0x04, 0x06, 0x06,
+0xFA, 0x06, 0xFA, 0xFB, 0xFB, 0x05, 0xFC, 0xFA, 0x02, 0x03, 0x06, 0x05, 0x01, 0x0C, 0xFA, 0x13,
+0x00, 0xFD, 0x0A, 0xF5, 0xFF, 0xFD, 0xF8, 0xFC, 0x07, 0xFF, 0x09, 0xF9, 0xFA, 0xFD, 0x01, 0x06,
+0xFA, 0x01, 0xF8, 0x00, 0xFA, 0x05, 0x00, 0xF4, 0x07, 0x04, 0x01, 0x0C, 0xFD, 0x03, 0xFF, 0x07,
+0xF8, 0xFB, 0x08, 0xFA, 0xFF, 0xFC, 0xF7, 0x04, 0x03, 0xFD, 0xFE, 0xFA, 0xFA, 0x04, 0x04, 0x00,
+0xFD, 0x07, 0xF9, 0x00, 0xFF, 0x09, 0x01, 0xFA, 0xFF, 0x05, 0x08, 0x0A, 0xF4, 0x07, 0x03, 0x09,
+0x01, 0xFF, 0xFF, 0x01, 0x02, 0xFB, 0xFE, 0xF6, 0x0D, 0xF8, 0x07, 0xFD, 0xF8, 0x0A, 0xFD, 0x08,
+0xF4, 0x02, 0xFE, 0xFD, 0x02, 0x07, 0xF8, 0x00, 0xFF, 0x04, 0x09, 0x0B, 0xF6, 0x02, 0xFF, 0x03,
+0xFE, 0xFC, 0x04, 0xFC, 0x03, 0xFD, 0xFA, 0xF9, 0x05, 0xFA, 0x03, 0xFA, 0xFB, 0x04, 0x05, 0x06,
+0xFA, 0x04, 0xFC, 0xF7, 0xFD, 0x04, 0xFE, 0xF6, 0x02, 0x02, 0x03, 0x02, 0xFB, 0x00, 0xF9, 0xF7,
+0xFB, 0xF8, 0x05, 0xF6, 0x03, 0xF7, 0xFF, 0xF8, 0x02, 0xF7, 0x0A, 0x00, 0xFE, 0xFF, 0x05, 0x0B,
+0xF8, 0x01, 0xFA, 0xFF, 0xFC, 0x0B, 0xF9, 0x00, 0x06, 0x01, 0x03, 0x08, 0xFD, 0x03, 0xFD, 0x0B,
+0xF6, 0xFF, 0x03, 0xF4, 0x01, 0xF6, 0xF9, 0xF5, 0x08, 0xFA, 0x02, 0xF8, 0x00, 0x02, 0x02, 0xFF,
+0x03, 0x09, 0xFE, 0xF9, 0xFD, 0x07, 0xFB, 0xFF, 0x03, 0xFD, 0x09, 0x06, 0xF8, 0x07, 0xF9, 0x02,
+0xFA, 0xF8, 0x07, 0xFA, 0x04, 0xF9, 0xFA, 0xFC, 0x02, 0xFD, 0x04, 0xF8, 0xF9, 0x00, 0x05, 0x05,
+0xFC, 0x01, 0xFD, 0xFC, 0xFC, 0x06, 0xF9, 0xFD, 0x05, 0x02, 0x03, 0x01, 0xFB, 0x03, 0xFB, 0x09,
+0x00, 0xF6, 0x07, 0xFC, 0x01, 0xFD, 0xFF, 0xF5, 0x06, 0xFE, 0x01, 0xFD, 0xFF, 0x06, 0x03, 0xFF,
+0x01, 0x08, 0xFD, 0xF7, 0xFB, 0x05, 0xF6, 0xF9, 0x0A, 0xFC, 0x08, 0x03, 0xF5, 0x01, 0xFE, 0x09,
+0x03, 0xF7, 0x05, 0xFE, 0xFF, 0xFA, 0xFE, 0xF4, 0xFF, 0x04, 0x04, 0xF7, 0xF5, 0xFE, 0x02, 0x05,
+0xFB, 0x0A, 0xFC, 0xFC, 0xFA, 0x00, 0xFD, 0xF8, 0x0A, 0x02, 0x08, 0x06, 0xFB, 0x00, 0xFE, 0x07,
+0xFE, 0xFC, 0x05, 0xFB, 0x03, 0x00, 0xFB, 0xF8, 0x04, 0xFC, 0x03, 0xFF, 0x02, 0x05, 0x08, 0x00,
+0xFE, 0x0A, 0xFC, 0xFB, 0x00, 0x03, 0xFA, 0xF7, 0x03, 0x05, 0x01, 0x06, 0x03, 0x02, 0x00, 0x01,
+0xFF, 0xF5, 0x03, 0xFD, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0x01, 0x0D, 0x01, 0x00, 0xFE, 0x09, 0x01,
+0x02, 0x0A, 0xFE, 0xFE, 0xF8, 0x08, 0xFC, 0xF6, 0x05, 0x01, 0xFF, 0x05, 0xFF, 0x05, 0xF5, 0x0F,
+0xF7, 0xFE, 0x04, 0xFE, 0x03, 0xF9, 0xFF, 0xFA, 0x07, 0xF9, 0x03, 0x03, 0xFD, 0x06, 0x07, 0xFF,
+0xF7, 0x02, 0x00, 0xFC, 0xF9, 0x03, 0xF7, 0xF8, 0x02, 0x02, 0x06, 0x03, 0xF7, 0xFE, 0xFE, 0x07,
+0xFF, 0xFF, 0x07, 0xFC, 0x00, 0xFA, 0xF4, 0xF4, 0xFD, 0x01, 0x0B, 0x02, 0xF4, 0x02, 0x04, 0x01,
+0xFE, 0x07, 0xFB, 0xFE, 0xF7, 0x02, 0xFE, 0xF6, 0x00, 0x01, 0x09, 0xFE, 0xFF, 0x04, 0xF4, 0x06,
+0xF5, 0xFC, 0x09, 0xFD, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0xF6, 0x0A, 0x04, 0xFE, 0xFC, 0x07, 0x07,
+0xFD, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0xF4, 0xF6, 0x05, 0x02, 0x07, 0x0C, 0xFF, 0xFD, 0xF7, 0x0E,
+0xFA, 0xF9, 0x00, 0x00, 0xFE, 0xFA, 0xF4, 0xFA, 0x02, 0xF7, 0x07, 0x02, 0xFF, 0x04, 0x0C, 0x00,
+0x00, 0x0B, 0xF7, 0xF9, 0x00, 0x04, 0xFE, 0xFC, 0x01, 0x04, 0x05, 0xFF, 0xFE, 0x00, 0xFB, 0x03,
+0xFE, 0xF9, 0xFF, 0xF7, 0x01, 0xF7, 0xFE, 0xFF, 0x06, 0xFA, 0x04, 0xFB, 0xFC, 0x03, 0x04, 0xFE,
+0xF9, 0x09, 0xFB, 0xFB, 0xF6, 0x08, 0xFC, 0x00, 0xFC, 0x01, 0x04, 0x00, 0x00, 0xFD, 0xF8, 0x05,
+0x00, 0xFF, 0x05, 0xF7, 0x08, 0xFF, 0xFE, 0xFF, 0x03, 0x00, 0x03, 0x01, 0xFD, 0x03, 0x0A, 0x02,
+0xFA, 0x0A, 0x01, 0xFF, 0xF6, 0x04, 0xF8, 0xFE, 0x00, 0x04, 0x03, 0x05, 0xFD, 0x04, 0xFC, 0x03,
+0xFF, 0x00, 0x07, 0xFD, 0x05, 0xFB, 0xFB, 0xFA, 0x00, 0xFF, 0x0B, 0xF9, 0xFE, 0xFC, 0x07, 0x07,
+0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFB, 0x01, 0x06, 0x03, 0x09, 0x04, 0xF7, 0x03, 0xF6, 0x02,
+0xFD, 0xFE, 0x03, 0xFD, 0x00, 0xFE, 0xF9, 0xFA, 0x05, 0xFC, 0x0A, 0xFC, 0x02, 0xFE, 0x06, 0x0B,
+0xFE, 0x01, 0xF3, 0xFE, 0xFB, 0x0B, 0xFD, 0xFC, 0xFF, 0x00, 0x06, 0x08, 0xFF, 0xFD, 0xF6, 0x01,
+0xF8, 0xFE, 0x0B, 0xF6, 0x03, 0xFC, 0xFA, 0xFC, 0x02, 0x03, 0x0B, 0xFE, 0xF9, 0xFE, 0x08, 0x09,
+0xF9, 0x02, 0xFF, 0xFF, 0xFB, 0x08, 0xF4, 0xF9, 0x00, 0x03, 0x01, 0xFE, 0x00, 0x01, 0xF6, 0x04,
+0xFC, 0xF6, 0x02, 0xFF, 0x09, 0xFA, 0xFC, 0xF5, 0x00, 0x04, 0x04, 0xFE, 0xF6, 0x03, 0x09, 0x04,
+0xFF, 0x07, 0xF6, 0xF7, 0x02, 0x03, 0xF7, 0xFE, 0x06, 0x01, 0x01, 0x04, 0xFF, 0x01, 0xF7, 0x06,
+0xFD, 0xFA, 0x05, 0xF7, 0x06, 0xFE, 0xFE, 0xF8, 0xFE, 0x03, 0x0C, 0xF9, 0xFB, 0x00, 0x0A, 0x04,
+0xF8, 0x07, 0xFD, 0xFF, 0xFE, 0x07, 0xFD, 0xFD, 0x02, 0x02, 0x05, 0x08, 0xF5, 0x03, 0xFC, 0x0D,
+0xFF, 0xF5, 0x05, 0xF7, 0x08, 0xFB, 0xF9, 0xFE, 0x07, 0x00, 0x0A, 0x02, 0xF7, 0x02, 0x06, 0x03,
+0xFD, 0x03, 0x01, 0x01, 0xFB, 0x07, 0xF7, 0xFE, 0x06, 0x02, 0x08, 0x00, 0xFF, 0x01, 0xF7, 0x05,
+0xFF, 0xFB, 0x06, 0x00, 0x00, 0xFA, 0xF9, 0x00, 0x05, 0xFD, 0x00, 0xFF, 0xF9, 0x06, 0x03, 0x0C,
+0xFF, 0x00, 0xFD, 0xFE, 0xFC, 0x07, 0xFB, 0x00, 0x02, 0x04, 0x09, 0x01, 0xF7, 0x04, 0xF6, 0x02,
+0xFF, 0xFB, 0x07, 0xF8, 0x07, 0xFB, 0xFA, 0xFB, 0x00, 0xFE, 0x03, 0x01, 0xF9, 0xFB, 0x0B, 0x09,
+0xFD, 0x01, 0xFF, 0xF9, 0xFB, 0x03, 0xFB, 0xF9, 0xFE, 0x03, 0x05, 0x01, 0xF6, 0x00, 0xFC, 0x08,
+0xFA, 0xF8, 0x04, 0xFC, 0x03, 0xFA, 0xFB, 0xF3, 0xFF, 0xFA, 0x06, 0x02, 0x01, 0xFB, 0x04, 0x06,
+0xFD, 0x04, 0x00, 0x00, 0xF9, 0x02, 0xF6, 0xF6, 0x02, 0x00, 0x02, 0x04, 0xFA, 0x06, 0xF8, 0x09,
+0xF9, 0xF6, 0x04, 0x01, 0x01, 0xFA, 0xFA, 0xFB, 0x06, 0xFD, 0x07, 0xFB, 0xFD, 0x08, 0x00, 0x08,
+0xFB, 0x00, 0xFF, 0xFA, 0xFB, 0x02, 0xFA, 0xFD, 0x07, 0x02, 0x04, 0x08, 0x01, 0x06, 0xFA, 0xFF,
+0xFF, 0xFA, 0x0C, 0xFC, 0x00, 0xFC, 0xF6, 0xF1, 0x01, 0x05, 0x07, 0xFB, 0xF8, 0xFB, 0x00, 0x03,
+0xF8, 0x05, 0xFA, 0xFD, 0xFC, 0x0D, 0xF9, 0xFA, 0x04, 0x02, 0x01, 0x08, 0xFD, 0x03, 0xF4, 0xFE,
+0xFF, 0xFA, 0x08, 0xFF, 0x00, 0xFD, 0x00, 0xF5, 0x02, 0x03, 0x0A, 0xFF, 0xF9, 0x02, 0x08, 0x02,
+0x02, 0x0A, 0xFF, 0xFC, 0xFB, 0x0A, 0x00, 0xF5, 0x08, 0x01, 0x08, 0x07, 0xFD, 0x05, 0xF7, 0x0B,
+0x02, 0xFB, 0x01, 0xFB, 0x02, 0xF6, 0xFA, 0xFC, 0xFF, 0xFC, 0x07, 0xFC, 0xFE, 0xFE, 0x05, 0x02,
+0xF8, 0x07, 0xF5, 0xFB, 0xF7, 0x0C, 0xF9, 0xFB, 0x02, 0x02, 0x05, 0x05, 0xFB, 0x00, 0xF6, 0x07,
+0xFB, 0xFB, 0x03, 0x00, 0x03, 0xF9, 0xFD, 0xF7, 0x09, 0xFB, 0x06, 0xFD, 0xF8, 0x02, 0x08, 0x08,
+0xFF, 0x02, 0xFE, 0xFE, 0xFB, 0x05, 0xF6, 0xF5, 0x04, 0x02, 0x04, 0x09, 0xFF, 0x01, 0xF8, 0xFD,
+0xFA, 0xF8, 0x04, 0xF9, 0x03, 0xF9, 0xFD, 0xFD, 0x04, 0xFD, 0x06, 0xFE, 0xFB, 0x02, 0x00, 0x05,
+0xF6, 0x05, 0xFE, 0xFC, 0xFE, 0x03, 0x00, 0xF6, 0x07, 0x01, 0x08, 0x06, 0xFD, 0x03, 0xF6, 0x0B,
+0x00, 0xFF, 0x09, 0x00, 0x03, 0xFD, 0xF7, 0xF8, 0x05, 0xFC, 0x0A, 0xFC, 0xFA, 0x04, 0x00, 0x01,
+0xFC, 0x09, 0x02, 0xFE, 0xFF, 0x09, 0xFE, 0xF6, 0xFF, 0x01, 0x07, 0x04, 0xF8, 0x03, 0x00, 0x08,
+0xFF, 0xFD, 0x08, 0xFC, 0x05, 0xF8, 0xF7, 0xF5, 0x00, 0xFB, 0x03, 0xFE, 0xFF, 0x05, 0xFE, 0x0A,
+0x03, 0x09, 0xFA, 0xF7, 0xFD, 0x00, 0xFA, 0xFC, 0x03, 0x00, 0x09, 0x06, 0xFE, 0x05, 0xFD, 0x08,
+0xF8, 0xFA, 0x04, 0xFC, 0x04, 0xFE, 0xFE, 0xFD, 0x04, 0xF7, 0x05, 0xFA, 0xF8, 0x01, 0x05, 0x05,
+0xFF, 0x08, 0xFA, 0xFD, 0xFC, 0x09, 0xF8, 0xFF, 0x02, 0x02, 0x02, 0x05, 0xFB, 0x06, 0xFB, 0x13,
+0xF9, 0xF7, 0x05, 0xFA, 0x03, 0xFB, 0xFD, 0xFC, 0xFF, 0x03, 0x02, 0xFC, 0xFE, 0x09, 0x05, 0x09,
+0xFE, 0x08, 0xF6, 0xFC, 0xF6, 0x05, 0xFC, 0xFA, 0x02, 0x02, 0x02, 0x05, 0xFA, 0x03, 0xF5, 0xE8,
+0xF9, 0xFB, 0x02, 0xFB, 0x01, 0xF9, 0xFD, 0xFD, 0x06, 0xFD, 0x02, 0x01, 0xF7, 0x06, 0x05, 0x07,
+0xF9, 0x05, 0xF7, 0xFA, 0xFB, 0x08, 0xFD, 0xFB, 0x00, 0x03, 0x03, 0x07, 0xF5, 0x08, 0xFE, 0xF7,
+0xFC, 0xFA, 0x06, 0xFE, 0x03, 0xFB, 0xFA, 0xFF, 0x09, 0xFB, 0x0A, 0xFD, 0xFD, 0x06, 0x02, 0x03,
+0xFB, 0x06, 0xF9, 0xFC, 0xFD, 0x06, 0xFE, 0xFC, 0x03, 0x02, 0x05, 0x09, 0xFA, 0x04, 0xFB, 0xF9,
+0xFA, 0xFC, 0x03, 0xFD, 0x03, 0xFC, 0xFC, 0xF8, 0x03, 0x05, 0x0A, 0xFD, 0xFF, 0x02, 0x06, 0x07,
+0xF9, 0x0A, 0xF9, 0xF6, 0xF8, 0x0D, 0xFA, 0xFE, 0x00, 0x02, 0x07, 0x06, 0xFB, 0x02, 0xFA, 0xFB,
+0xF9, 0xF6, 0x05, 0xF5, 0x06, 0xFD, 0xFA, 0xFD, 0x02, 0xFD, 0x05, 0xFC, 0xFA, 0x00, 0x03, 0x06,
+0xFC, 0x05, 0xFA, 0xFD, 0xF9, 0x05, 0xFA, 0x00, 0x04, 0x02, 0x05, 0x04, 0xFD, 0x05, 0xF9, 0xFE,
+0xF9, 0xF7, 0x06, 0xF9, 0x0B, 0xF7, 0xFB, 0xF9, 0x04, 0x01, 0x09, 0x03, 0xFE, 0xFB, 0x02, 0x09,
+0x02, 0x03, 0xFB, 0xFD, 0x00, 0x0A, 0xFA, 0xFB, 0x0A, 0x00, 0x03, 0x03, 0xFC, 0x02, 0xF7, 0x06,
+0x01, 0xFB, 0x07, 0xF8, 0xFF, 0xFD, 0x00, 0xF7, 0x05, 0xF8, 0x03, 0x00, 0xF9, 0x01, 0x02, 0x02,
+0xFE, 0x01, 0xF6, 0xFE, 0x01, 0x05, 0xF9, 0xFF, 0x08, 0x02, 0xFF, 0x02, 0xF8, 0x06, 0xF9, 0x01,
+0xFE, 0xFE, 0x04, 0xFC, 0x02, 0xF6, 0xFA, 0xF6, 0x05, 0xFF, 0x05, 0x00, 0xF8, 0x05, 0x03, 0x08,
+0xFA, 0x07, 0xFC, 0x01, 0xF7, 0x07, 0x00, 0xFB, 0xFF, 0x03, 0x03, 0x06, 0xFD, 0x08, 0xFC, 0x00,
+0xF9, 0xFC, 0x05, 0xFA, 0x03, 0xF8, 0xFC, 0xF9, 0x07, 0xFB, 0x04, 0xFC, 0xFE, 0x07, 0x00, 0x06,
+0xFE, 0x04, 0xFE, 0xFB, 0xFA, 0x05, 0xFB, 0xFA, 0x04, 0x02, 0x06, 0x05, 0xFB, 0x06, 0xF8, 0xEF,
+0xFB, 0xF9, 0x02, 0xFD, 0x07, 0xFB, 0xFE, 0xFC, 0x0A, 0xFA, 0x02, 0xFE, 0xFC, 0x0B, 0x05, 0x05,
+0xFA, 0x07, 0xFB, 0xFE, 0xFE, 0x05, 0xFC, 0xFE, 0x05, 0x03, 0x03, 0x07, 0xFB, 0x09, 0xFE, 0x11,
+0xFC, 0xFC, 0x08, 0xF9, 0x05, 0xFF, 0xF9, 0xFE, 0x09, 0xF8, 0x06, 0xFA, 0xFD, 0x06, 0x02, 0x02,
+0xFD, 0x03, 0xFC, 0xFA, 0xFE, 0x05, 0x00, 0xFA, 0x06, 0x02, 0x03, 0x07, 0xFC, 0x0A, 0xFC, 0x18,
+0xFD, 0xF7, 0x08, 0xFC, 0x04, 0xFA, 0xFA, 0xFB, 0x04, 0xFE, 0x08, 0xFC, 0xFA, 0x04, 0x07, 0x02,
+0xFC, 0x03, 0xFC, 0xF9, 0xFC, 0x04, 0xF8, 0xF8, 0x03, 0x03, 0x02, 0x01, 0xFC, 0x02, 0xF4, 0xFD,
+0xF8, 0xFA, 0x07, 0xFC, 0xFF, 0xF9, 0xF5, 0xFA, 0x06, 0x04, 0x0B, 0xFC, 0xFB, 0x09, 0x07, 0x00,
+0x03, 0x06, 0x01, 0xFC, 0xFB, 0x03, 0xFE, 0xF7, 0xFC, 0x01, 0x01, 0x09, 0xFD, 0x04, 0xF8, 0x16,
+0xFD, 0xFB, 0x04, 0xFE, 0x06, 0xFE, 0xFB, 0xFA, 0x06, 0x00, 0x05, 0x00, 0xF9, 0x00, 0x09, 0x01,
+0xFE, 0x02, 0x02, 0xF9, 0x00, 0x08, 0xFD, 0xFD, 0x06, 0x02, 0x08, 0x09, 0xF9, 0x05, 0xFF, 0x06,
+0xFD, 0xFB, 0x06, 0xFC, 0x06, 0xF9, 0xFF, 0xFA, 0xFC, 0x02, 0x06, 0x00, 0xFC, 0x02, 0x0A, 0x08,
+0xFD, 0x01, 0xFA, 0xFE, 0xFC, 0x02, 0xFE, 0xFD, 0x01, 0x02, 0x04, 0x03, 0xF7, 0x07, 0xF8, 0xFC,
+0xF6, 0xFC, 0x0A, 0x01, 0x09, 0xFD, 0xF6, 0xF7, 0x02, 0xFB, 0x04, 0xFD, 0x01, 0xFE, 0xFE, 0x00,
+0xF8, 0x01, 0xF6, 0xF5, 0x00, 0x07, 0xF8, 0xF6, 0x05, 0x02, 0x01, 0x05, 0x00, 0x02, 0xF6, 0x0E,
+0xFD, 0xFA, 0x07, 0xFF, 0x00, 0xF9, 0xF9, 0xF9, 0x02, 0xFC, 0x05, 0xFB, 0xFA, 0x03, 0x04, 0x04,
+0xF8, 0x02, 0xFA, 0xF7, 0xFD, 0x06, 0xFA, 0xF9, 0xFF, 0x02, 0x06, 0x03, 0xFA, 0x02, 0xF9, 0xF5,
+0xF9, 0xFE, 0x03, 0xFF, 0x02, 0xFA, 0x00, 0x00, 0x05, 0xF9, 0x09, 0xFF, 0xFA, 0x06, 0x05, 0x08,
+0xF8, 0xFD, 0xFD, 0xFF, 0xF4, 0x0A, 0xFD, 0xFE, 0x07, 0x04, 0x08, 0x07, 0xFD, 0x05, 0xFC, 0xF7,
+0xFC, 0xF7, 0x06, 0xFC, 0x01, 0xFF, 0xFE, 0xFB, 0x05, 0xFD, 0x04, 0xFB, 0xF9, 0x04, 0x04, 0x03,
+0xFE, 0x06, 0xF8, 0xF5, 0xFF, 0x04, 0xF8, 0xF9, 0x02, 0x02, 0x07, 0x03, 0x05, 0x06, 0xF5, 0xFC,
+0xFF, 0xFB, 0x03, 0xF9, 0x03, 0xFA, 0xFD, 0xFA, 0x07, 0xFA, 0x08, 0xF7, 0xFC, 0x00, 0x00, 0x04,
+0xFA, 0x03, 0xFC, 0xFB, 0xFC, 0x06, 0xFB, 0xF8, 0x03, 0x02, 0x03, 0x04, 0xF8, 0x01, 0xFA, 0x1D,
+0xFB, 0xF8, 0x02, 0xF4, 0xFE, 0xFA, 0xF8, 0xFA, 0x00, 0xFB, 0x07, 0xFF, 0xFA, 0xF9, 0x07, 0x07,
+0xFB, 0x00, 0xFC, 0xFA, 0xF7, 0x03, 0xFB, 0xFD, 0x07, 0x03, 0x07, 0x0A, 0xF7, 0x05, 0xFE, 0x05,
+0xFA, 0xF5, 0x04, 0xFA, 0x01, 0xFD, 0xFB, 0xF9, 0x00, 0x01, 0x00, 0xFD, 0xFE, 0x00, 0x07, 0x09,
+0xF9, 0x03, 0xFB, 0xFE, 0xF9, 0xFF, 0xFC, 0x01, 0x05, 0x02, 0x06, 0x09, 0xF7, 0xFF, 0xFC, 0xF7,
+0xFA, 0xF6, 0x07, 0xFD, 0x02, 0xFC, 0xF8, 0xFC, 0x04, 0xFA, 0x02, 0xFD, 0x00, 0x00, 0x0A, 0x05,
+0xF5, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x00, 0xF6, 0x00, 0x02, 0x0B, 0x00, 0xF4, 0x04, 0xFC, 0x06,
+0xFC, 0xFE, 0x03, 0xFB, 0x04, 0x02, 0x00, 0x01, 0x06, 0xFC, 0x07, 0x00, 0xFD, 0x05, 0x04, 0xFF,
+0xFA, 0xFE, 0xF7, 0xFE, 0x04, 0x07, 0x03, 0xFB, 0x0B, 0x02, 0x06, 0x08, 0xF7, 0x0B, 0xFA, 0x06,
+0xFA, 0xFA, 0x05, 0xF5, 0x06, 0xFF, 0xF5, 0xFB, 0xFF, 0xFB, 0x01, 0xFA, 0xFF, 0x03, 0x07, 0x01,
+0xFE, 0x09, 0xFE, 0xFF, 0xF6, 0x09, 0xFD, 0xFA, 0x04, 0x03, 0x08, 0x02, 0xFB, 0x05, 0xF8, 0x02,
+0xF9, 0xFC, 0x04, 0xFB, 0x02, 0xFA, 0xF9, 0xFA, 0x09, 0xFB, 0x05, 0xFA, 0xF7, 0x02, 0x07, 0x04,
+0xFE, 0x04, 0xF8, 0xFD, 0xFC, 0x03, 0xFA, 0xFA, 0x03, 0x02, 0x06, 0x05, 0xFA, 0x02, 0xFC, 0x03,
+0xFB, 0xFB, 0x02, 0xFE, 0x01, 0xFC, 0xFB, 0xF9, 0x07, 0xFB, 0x06, 0xFB, 0xFC, 0x03, 0x07, 0x05,
+0xFB, 0x04, 0xFC, 0xF9, 0xFD, 0x04, 0xFF, 0xF8, 0x06, 0x02, 0x07, 0x08, 0xFC, 0x0A, 0xFD, 0x0B,
+0xFC, 0xFE, 0x03, 0xFC, 0xFF, 0xFB, 0xFB, 0xF6, 0x03, 0xFF, 0x0D, 0x03, 0xFB, 0x02, 0x03, 0x0A,
+0xFB, 0x06, 0xF8, 0xF8, 0xFA, 0x03, 0xF1, 0xFA, 0x02, 0x02, 0x06, 0x08, 0xFA, 0xFC, 0xF7, 0x0B,
+0xFC, 0xFA, 0x00, 0xF7, 0x07, 0xFF, 0xFD, 0xF8, 0x03, 0xFE, 0x07, 0xFF, 0xF9, 0xFE, 0xFF, 0x0A,
+0xFB, 0x02, 0xFD, 0x01, 0xFE, 0x07, 0xF8, 0xF5, 0x06, 0x01, 0x06, 0x01, 0xFC, 0xFF, 0xFD, 0x17,
+0x01, 0xF8, 0x03, 0xF8, 0x05, 0xFA, 0xF4, 0xFC, 0x02, 0x05, 0x0B, 0xFA, 0xFD, 0xFB, 0x02, 0x08,
+0xFA, 0x01, 0xF6, 0xF7, 0x01, 0x07, 0xFC, 0xFB, 0x00, 0x03, 0x0A, 0x05, 0xF6, 0xFE, 0xF6, 0x03,
+0xFB, 0xFF, 0xFD, 0x02, 0xFE, 0xFD, 0x00, 0xFD, 0xFF, 0x00, 0x09, 0xFA, 0x01, 0x09, 0x07, 0x0A,
+0xF5, 0x07, 0x00, 0xFF, 0xF9, 0x00, 0xF8, 0xFF, 0x03, 0x03, 0x08, 0x09, 0x00, 0x08, 0xF8, 0x0E,
+0xFE, 0xFA, 0x03, 0xF9, 0x03, 0xFC, 0xFA, 0xF9, 0xFE, 0xFE, 0x03, 0x01, 0xFD, 0x01, 0x07, 0x09,
+0xFD, 0x03, 0xFB, 0xFA, 0xF7, 0x02, 0xFE, 0xFD, 0x02, 0x02, 0x01, 0x00, 0xF6, 0x04, 0xFE, 0x07,
+0x02, 0xFC, 0x01, 0x02, 0x02, 0xF7, 0xF8, 0xFA, 0x04, 0x05, 0x05, 0x00, 0xF6, 0x06, 0x00, 0x0C,
+0xFE, 0x09, 0x00, 0x01, 0xF4, 0x06, 0x01, 0xFC, 0x05, 0x03, 0x0D, 0x03, 0xF1, 0x01, 0xF6, 0x10,
+0xFF, 0xFA, 0x06, 0xF9, 0x07, 0xFF, 0x02, 0xFE, 0x05, 0x01, 0x08, 0x05, 0xFA, 0x02, 0x02, 0x09,
+0xF4, 0x02, 0xFA, 0xFD, 0xFF, 0x07, 0xF7, 0x01, 0x01, 0x03, 0x09, 0x07, 0xF7, 0x04, 0xF9, 0x0B,
+0xF9, 0xFC, 0x01, 0x01, 0x05, 0xF8, 0x03, 0xFD, 0x0D, 0xF4, 0x04, 0x03, 0xFA, 0x02, 0x08, 0x01,
+0x00, 0x03, 0xFD, 0xF9, 0xF9, 0xFD, 0xFF, 0xFE, 0x08, 0x0A, 0x04, 0x07, 0xFE, 0x06, 0xFC, 0x05,
+0xFD, 0x01, 0xFF, 0xFE, 0x05, 0xFE, 0xF6, 0xF8, 0x05, 0xFF, 0x0A, 0x04, 0x00, 0xFD, 0x06, 0x0A,
+0xFB, 0x04, 0xF8, 0xFF, 0xFB, 0x02, 0xF9, 0xFE, 0x07, 0x06, 0x0A, 0x04, 0xF7, 0x07, 0xFA, 0xFE,
+0xFC, 0xFA, 0x04, 0xFA, 0x04, 0xFF, 0xFD, 0xFC, 0x05, 0xFA, 0x01, 0xFB, 0xFB, 0x05, 0x02, 0x01,
+0xFB, 0x04, 0xFE, 0xFB, 0xFB, 0x04, 0xFE, 0xFD, 0x04, 0x02, 0x05, 0x02, 0x00, 0x02, 0xFD, 0x18,
+0xFF, 0xF8, 0x03, 0x01, 0x04, 0x01, 0x03, 0xFF, 0x0A, 0xFC, 0x09, 0xFA, 0x04, 0x0A, 0x08, 0x03,
+0xFE, 0x03, 0xFE, 0xFA, 0xFD, 0x06, 0x00, 0x03, 0x0D, 0xFF, 0x04, 0x03, 0xF8, 0x07, 0xF8, 0x06,
+0xF9, 0xF8, 0x09, 0xFA, 0x09, 0xF4, 0xFA, 0xF9, 0x02, 0x00, 0x0C, 0xF6, 0xF4, 0xFA, 0x0F, 0x06,
+0xFA, 0x0C, 0xF7, 0xF9, 0xF9, 0x08, 0xF1, 0xF8, 0x04, 0x06, 0x0B, 0x08, 0xF5, 0x07, 0xF9, 0x00,
+0xF6, 0xFA, 0x0D, 0xFB, 0x0A, 0xF2, 0xF4, 0xFB, 0x09, 0xFF, 0x0C, 0xFC, 0xF5, 0x09, 0x07, 0x07,
+0xF7, 0x06, 0xF9, 0xFC, 0xF8, 0x0A, 0xF8, 0xF5, 0x08, 0x06, 0x09, 0x04, 0xFB, 0x08, 0xF5, 0x08,
+0xF6, 0xF3, 0x09, 0xF5, 0x07, 0xF9, 0xF9, 0xFC, 0x04, 0xFD, 0x0D, 0xF5, 0xF8, 0x02, 0x10, 0x09,
+0xF8, 0x08, 0xFC, 0xF8, 0xF8, 0x08, 0xF3, 0xF3, 0x05, 0x02, 0x0C, 0x09, 0xF9, 0x04, 0xF5, 0x0C,
+0xF6, 0xF9, 0x0C, 0xF4, 0x03, 0xF7, 0xF5, 0xF2, 0x01, 0xF6, 0x07, 0xFA, 0xFB, 0x00, 0x06, 0x02,
+0xF9, 0x03, 0xFC, 0xF3, 0xF9, 0x0E, 0xF8, 0xF5, 0x03, 0x05, 0x07, 0x07, 0xFA, 0x0B, 0xF2, 0xFF,
+0xF3, 0xF5, 0x09, 0xFD, 0x05, 0xF1, 0xF5, 0xF2, 0x03, 0x01, 0x0A, 0x00, 0xF7, 0x04, 0x06, 0x0D,
+0xFA, 0x07, 0xF9, 0xF0, 0xFA, 0x09, 0xFB, 0xF7, 0x04, 0xF8, 0x05, 0x0A, 0xEE, 0x0D, 0xF2, 0x05,
+0xF6, 0xF4, 0x05, 0xF5, 0x04, 0xF9, 0xFA, 0xF6, 0x03, 0xFB, 0x0C, 0xF7, 0xF5, 0x02, 0x06, 0x09,
+0xF8, 0x05, 0xF9, 0xF3, 0xF6, 0x0C, 0xF5, 0xFA, 0x07, 0x07, 0x0C, 0x09, 0xF7, 0x02, 0xF3, 0x0B,
+0xF6, 0xF2, 0x05, 0xF2, 0x07, 0xFC, 0xF1, 0xF5, 0x02, 0xFC, 0x07, 0xFD, 0xF6, 0x06, 0x0D, 0x04,
+0x00, 0x06, 0xFA, 0xF5, 0xF4, 0x0D, 0xF4, 0xF8, 0x04, 0x05, 0x0D, 0x0C, 0xF8, 0x03, 0xF9, 0x02,
+0xF9, 0xF4, 0x08, 0xF8, 0x07, 0xFB, 0xF6, 0xF9, 0x05, 0xFD, 0x07, 0xFB, 0xF3, 0x05, 0x09, 0x0C,
+0xFA, 0x0B, 0xF4, 0xF5, 0xFB, 0x07, 0xF8, 0xF7, 0x03, 0x06, 0x08, 0x05, 0xFB, 0x08, 0xF3, 0x03,
+0xFA, 0xF8, 0x0C, 0xF9, 0x07, 0xFA, 0xF3, 0xFB, 0x00, 0xF9, 0x07, 0xF9, 0xF8, 0x04, 0x04, 0x07,
+0xFC, 0x06, 0xF7, 0xF6, 0xF9, 0x09, 0xF6, 0xF5, 0x0B, 0x08, 0x0C, 0x07, 0xFD, 0x04, 0xF1, 0xDA,
+0xFA, 0xFB, 0x0B, 0xFB, 0x07, 0xF7, 0xFC, 0xF8, 0x0C, 0xFF, 0x0A, 0xFA, 0xFB, 0x05, 0x07, 0x09,
+0xF5, 0x0A, 0xF7, 0xF4, 0xF6, 0x07, 0xF4, 0xF6, 0x02, 0x06, 0x06, 0x05, 0xF7, 0x04, 0xF7, 0xDC,
+0xF8, 0xFC, 0x07, 0xF6, 0x07, 0xFA, 0xF1, 0xF8, 0x06, 0xF8, 0x0D, 0xF9, 0xF4, 0x03, 0x06, 0x0D,
+0xFE, 0x0A, 0xF2, 0xF9, 0xFB, 0x06, 0xF7, 0xFD, 0x06, 0x05, 0x07, 0x08, 0xF7, 0x09, 0xFB, 0xF8,
+0xF5, 0xFD, 0x0D, 0xFE, 0x06, 0xFB, 0xF5, 0xF7, 0x0C, 0xF7, 0x09, 0xFC, 0xF4, 0x02, 0x08, 0x0C,
+0xFA, 0x04, 0xF7, 0xFA, 0xFB, 0x07, 0xF5, 0xF7, 0x06, 0x04, 0x03, 0x06, 0xF7, 0x0C, 0xF8, 0xFE,
+0xF7, 0xF7, 0x02, 0xFA, 0x07, 0xFB, 0xF5, 0xF9, 0x06, 0xF9, 0x08, 0xF6, 0xF8, 0x05, 0x09, 0x0D,
+0xF9, 0x05, 0xFC, 0xFD, 0xF6, 0x09, 0xFF, 0xFA, 0x0A, 0x07, 0x0E, 0x08, 0xFB, 0x0D, 0xF9, 0x01,
+0xFA, 0xF7, 0x0D, 0xF0, 0x05, 0xFA, 0xF8, 0xF6, 0x06, 0xFB, 0x0E, 0xFC, 0xF6, 0xFF, 0x0D, 0x08,
+0xFA, 0x03, 0xFA, 0xFB, 0xF8, 0x08, 0xF8, 0xF4, 0x03, 0x06, 0x08, 0x03, 0xEF, 0x03, 0xF2, 0xED,
+0xF3, 0xFA, 0x02, 0xFC, 0x05, 0xF6, 0xFD, 0xF9, 0x09, 0xFD, 0x08, 0xFC, 0xF3, 0x09, 0x05, 0x05,
+0xF5, 0x08, 0xF8, 0xFD, 0xF8, 0x0B, 0xF7, 0xF8, 0x08, 0x08, 0x09, 0x08, 0xF4, 0x0B, 0xFB, 0xEE,
+0xF6, 0xF8, 0x09, 0xF8, 0x04, 0xFB, 0xF8, 0xF9, 0x08, 0xFF, 0x08, 0xF7, 0xF7, 0x03, 0x09, 0x08,
+0xF8, 0x08, 0xF9, 0xF7, 0xF3, 0x09, 0xFB, 0xF1, 0x03, 0x08, 0x09, 0x0A, 0xF6, 0x02, 0xF9, 0xDC,
+0xF9, 0xF7, 0x0D, 0xFE, 0x07, 0xF4, 0xF9, 0xF6, 0x0F, 0xFD, 0x08, 0xF4, 0xF7, 0x04, 0x09, 0x09,
+0xFA, 0x06, 0xFB, 0xFB, 0xF6, 0x0C, 0xF4, 0xFD, 0x04, 0x02, 0x02, 0x05, 0xFC, 0x06, 0xF6, 0x03,
+0xF5, 0xF5, 0x09, 0xFA, 0x04, 0xF9, 0xF7, 0xF7, 0x0A, 0xF9, 0x0B, 0xF5, 0xFC, 0x09, 0x08, 0x0B,
+0xF6, 0x05, 0xFC, 0xFE, 0xF5, 0x02, 0xF6, 0xFB, 0x04, 0x03, 0x06, 0x04, 0xF7, 0x06, 0xF8, 0x09,
+0xF4, 0xFB, 0x04, 0xF7, 0x0B, 0xF9, 0xF9, 0xFC, 0x04, 0xFB, 0x0A, 0xFA, 0xFC, 0x09, 0x0B, 0x07,
+0xF9, 0x0E, 0xF6, 0xFC, 0xFB, 0x08, 0xF6, 0xF7, 0x00, 0xFF, 0x0D, 0x03, 0xF8, 0x07, 0xF3, 0x05,
+0xFB, 0xF4, 0x0F, 0xFC, 0x03, 0xF1, 0xFB, 0xFB, 0x00, 0xF8, 0x09, 0xFF, 0xFB, 0xFD, 0x0C, 0x05,
+0xFE, 0x08, 0xF9, 0xF6, 0xF6, 0x0C, 0xF5, 0xF5, 0x08, 0x02, 0x04, 0x08, 0xF2, 0x09, 0xFA, 0x07,
+0xFA, 0xF6, 0x0B, 0xFD, 0x06, 0xF4, 0xF5, 0xF9, 0x05, 0xFC, 0x03, 0xFA, 0xF9, 0xFD, 0x09, 0x03,
+0xFE, 0x08, 0xFB, 0xF6, 0xF7, 0x0B, 0xF3, 0xF8, 0x04, 0x04, 0x0A, 0x09, 0xF8, 0x07, 0xF6, 0xFE,
+0xF8, 0xF3, 0x06, 0xF6, 0x04, 0xF8, 0xF6, 0xF9, 0x01, 0xFB, 0x0E, 0xFA, 0xF6, 0xFE, 0x0B, 0x0E,
+0xF7, 0x07, 0xFD, 0xFA, 0xF8, 0x0B, 0xF7, 0xF5, 0x06, 0x00, 0x08, 0x03, 0xFB, 0x04, 0xF4, 0x06,
+0xF8, 0xF3, 0x04, 0xFA, 0x03, 0xF2, 0xF5, 0xF5, 0x0B, 0xFD, 0x03, 0xF6, 0xF8, 0xFD, 0x09, 0x08,
+0xF8, 0x0C, 0xF7, 0xFC, 0xF8, 0x0C, 0xF9, 0xFC, 0x05, 0x01, 0x04, 0x08, 0xEF, 0x00, 0xF5, 0x04,
+0xF5, 0xFB, 0x08, 0xF8, 0x09, 0xF5, 0xF7, 0xFB, 0x09, 0xFC, 0x05, 0xFC, 0xFB, 0x04, 0x06, 0x07,
+0xF6, 0x0A, 0xF8, 0xF9, 0xFA, 0x0A, 0xFA, 0xF6, 0x07, 0x06, 0x09, 0x06, 0xF9, 0x0A, 0xF9, 0x02,
+0xF9, 0xF7, 0x0B, 0xF6, 0x08, 0xFC, 0xFC, 0xF6, 0x06, 0xF9, 0x0E, 0xFC, 0xF3, 0x02, 0x06, 0x09,
+0xFA, 0x05, 0xF3, 0xFA, 0xF9, 0x08, 0xF4, 0xF8, 0x02, 0x06, 0x0A, 0x04, 0xF8, 0x06, 0xFC, 0xF9,
+0xFB, 0xF4, 0x05, 0xF4, 0x0A, 0xF7, 0xF5, 0xF1, 0x0A, 0xFD, 0x0D, 0xFE, 0xF9, 0x05, 0x04, 0x04,
+0xF3, 0x07, 0xFB, 0xF2, 0xFD, 0x0A, 0xF3, 0xFA, 0x03, 0x01, 0x04, 0x06, 0xF3, 0x01, 0xF2, 0x03,
+0xFD, 0xF4, 0x05, 0xF6, 0x07, 0xFC, 0xF4, 0xF8, 0x04, 0xFA, 0x06, 0xFD, 0xF5, 0x03, 0x07, 0x10,
+0xF5, 0x0C, 0xFB, 0xF2, 0xF3, 0x06, 0xF5, 0xFC, 0x01, 0x01, 0x03, 0x0B, 0xFC, 0x03, 0xFD, 0x03,
+0xF8, 0xF4, 0x0C, 0xFC, 0x08, 0xF8, 0xF3, 0xF7, 0x05, 0x00, 0x08, 0xF9, 0xF6, 0xFF, 0x02, 0x02,
+0xF9, 0x0B, 0xFA, 0xFD, 0xF9, 0x07, 0xF6, 0xF3, 0x09, 0x02, 0x0C, 0x06, 0xF4, 0xFF, 0xF3, 0x02,
+0xFC, 0xF1, 0x03, 0xF1, 0x0A, 0xF3, 0xF9, 0xF9, 0x02, 0xF8, 0x03, 0xF1, 0xFE, 0x00, 0x06, 0x04,
+0xFA, 0x09, 0xF9, 0xF7, 0xF7, 0x06, 0xFB, 0xF2, 0x05, 0x02, 0x0C, 0x06, 0xFD, 0x09, 0xFB, 0x04,
+0xF6, 0xF4, 0x0D, 0xF8, 0x06, 0xF6, 0xF8, 0xF8, 0x08, 0x00, 0x05, 0xF7, 0xF5, 0xFD, 0x08, 0x09,
+0xF8, 0x0B, 0xFC, 0xF5, 0xFD, 0x09, 0xF9, 0xF9, 0x02, 0x02, 0x00, 0x0A, 0xF7, 0x08, 0xF7, 0xFE,
+0xF6, 0xF5, 0x07, 0xFC, 0x05, 0xF6, 0xF9, 0xF5, 0x0A, 0xF4, 0x0B, 0xF9, 0xFC, 0x06, 0x09, 0x07,
+0xF8, 0x0C, 0xF8, 0xFB, 0xFD, 0x0B, 0xFE, 0xF9, 0x09, 0x02, 0x08, 0x05, 0xF8, 0x07, 0xF5, 0x08,
+0xF8, 0xF6, 0x07, 0xF0, 0x01, 0xFA, 0xF6, 0xF3, 0xFE, 0xFF, 0x0A, 0xFE, 0xFA, 0xFE, 0x0B, 0x09,
+0xF6, 0x07, 0xF3, 0xF4, 0xF9, 0x09, 0xF8, 0xF1, 0x00, 0x04, 0x08, 0x04, 0xF4, 0x05, 0xF4, 0xFB,
+0xFB, 0xF5, 0x0B, 0xF2, 0x04, 0xFB, 0xF6, 0xF9, 0x08, 0xF6, 0x04, 0x00, 0xF6, 0x08, 0x08, 0x08,
+0xF9, 0x06, 0xFB, 0xF5, 0xF9, 0x09, 0xF8, 0xFA, 0x07, 0x07, 0x09, 0x09, 0xF8, 0x03, 0xF4, 0xF4,
+0xF1, 0xF4, 0x03, 0xF8, 0x05, 0xFD, 0xF8, 0xFF, 0x00, 0xFD, 0x0F, 0xF9, 0xF5, 0x07, 0x06, 0x0A,
+0xF7, 0x08, 0xF7, 0xF5, 0xF9, 0x09, 0xF6, 0xF7, 0x07, 0x05, 0x10, 0x06, 0xF5, 0x02, 0xFB, 0xFF,
+0xF7, 0xF9, 0x0C, 0xF6, 0x08, 0xFD, 0xF9, 0xF3, 0x0B, 0xFD, 0x06, 0xFD, 0xFB, 0x04, 0x05, 0x0A,
+0xF8, 0x0D, 0xF3, 0xFB, 0xF2, 0x07, 0xF9, 0xFC, 0x06, 0xFD, 0x03, 0x03, 0xF9, 0x0C, 0xF9, 0xFA,
+0xFD, 0xF3, 0x03, 0xFA, 0x03, 0xF2, 0xF3, 0xF4, 0x08, 0xFD, 0x0C, 0xF5, 0xF6, 0x03, 0x02, 0x03,
+0xFF, 0x07, 0xFF, 0xFF, 0xF7, 0x0C, 0xF9, 0xF7, 0x06, 0x04, 0x06, 0x02, 0xF4, 0x09, 0xF6, 0xFF,
+0xFE, 0xF5, 0x0B, 0xF4, 0x05, 0xFC, 0xF2, 0xF3, 0x04, 0xF8, 0x0A, 0xF6, 0xFC, 0x01, 0x0C, 0x04,
+0xF9, 0x04, 0xFB, 0xFE, 0xF6, 0x0C, 0xF6, 0xF3, 0x00, 0x04, 0x04, 0x06, 0xFA, 0x00, 0xFC, 0x05,
+0xF9, 0xFA, 0x0C, 0xFC, 0x06, 0xF5, 0xF5, 0xF9, 0x02, 0xFB, 0x0B, 0xFB, 0xFB, 0x02, 0x0D, 0x0B,
+0x02, 0x07, 0xFE, 0xFE, 0xF7, 0x0F, 0xF9, 0xFA, 0x05, 0x02, 0x0C, 0x0D, 0xF2, 0x07, 0xF9, 0xFB,
+0xF9, 0xF9, 0x07, 0xF5, 0x0E, 0xFB, 0xF4, 0xF9, 0x09, 0xF5, 0x05, 0xFB, 0xF9, 0xFF, 0x0E, 0x03,
+0xFB, 0x06, 0xFA, 0xFA, 0xF6, 0x05, 0xF9, 0xF0, 0x05, 0x05, 0x08, 0x04, 0xFB, 0x08, 0xF2, 0x03,
+0xFB, 0xF8, 0x05, 0xF5, 0x06, 0xF8, 0xF6, 0xF5, 0xFE, 0x00, 0x0D, 0xF8, 0xF3, 0x08, 0x07, 0x0A,
+0xFE, 0x07, 0xF7, 0xFD, 0xF6, 0x0C, 0xF8, 0xF7, 0x01, 0x07, 0x0C, 0x08, 0xF4, 0x07, 0xF5, 0x05,
+0xFB, 0xFA, 0x07, 0xFA, 0x03, 0xFD, 0xFC, 0xFD, 0x06, 0xFD, 0x09, 0xFC, 0xF5, 0x00, 0x0B, 0x11,
+0xFC, 0x0B, 0xF9, 0xF7, 0xF1, 0x0E, 0xF5, 0xF3, 0x03, 0x07, 0x0C, 0x09, 0xF4, 0x03, 0xFD, 0xF3,
+0xFC, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0xFD, 0xF7, 0x10, 0xF5, 0x0D, 0xFD, 0xFA, 0x02, 0x09, 0x08,
+0xF4, 0x07, 0xFA, 0xF7, 0xFB, 0x0C, 0xF8, 0xF8, 0x01, 0x05, 0x08, 0x0B, 0xEA, 0x07, 0xFF, 0x0C,
+0xF5, 0xFC, 0x03, 0xF6, 0x03, 0xF5, 0xFB, 0xF9, 0x01, 0xFD, 0x0E, 0xF8, 0xF3, 0xFF, 0x0A, 0x0C,
+0x01, 0x0B, 0xF3, 0xF7, 0xF5, 0x0E, 0xFD, 0xFC, 0x03, 0x08, 0x0A, 0x03, 0xF9, 0x06, 0xF2, 0xFE,
+0xFA, 0xFC, 0x0E, 0xFF, 0x02, 0xF5, 0xF6, 0xFD, 0x05, 0xF8, 0x08, 0xF6, 0xFC, 0x0A, 0x03, 0x05,
+0xFA, 0x05, 0xF7, 0xF9, 0xF5, 0x05, 0xFC, 0xF3, 0x09, 0x07, 0x09, 0x05, 0xFA, 0x0A, 0xF6, 0x05,
+0xF6, 0xFC, 0x0C, 0xF5, 0x01, 0xFC, 0xF2, 0xFE, 0x02, 0x00, 0x07, 0xF8, 0xF7, 0x05, 0x03, 0x08,
+0xF9, 0x08, 0xF2, 0xFC, 0xF3, 0x09, 0xF6, 0xF4, 0x08, 0x06, 0x0A, 0x0D, 0xF4, 0xFE, 0xF8, 0x01,
+0xF8, 0xF5, 0x0D, 0xF7, 0x04, 0xF7, 0xF4, 0xF7, 0x08, 0xFE, 0x07, 0xFF, 0xF8, 0x02, 0x02, 0x05,
+0xFD, 0x09, 0xF9, 0xF0, 0xF4, 0x0A, 0xFB, 0xFB, 0x07, 0x00, 0x0C, 0x09, 0xFA, 0x07, 0xFA, 0x09,
+0xFC, 0xFB, 0x06, 0xF9, 0x08, 0xF5, 0xF2, 0xF7, 0x0B, 0xFF, 0x0A, 0xFB, 0xF3, 0x07, 0x06, 0x08,
+0xF6, 0x06, 0xF8, 0xFC, 0xF4, 0x04, 0xF4, 0xF6, 0x01, 0x05, 0x06, 0x0B, 0xF6, 0xFF, 0xFD, 0x0D,
+0xF9, 0xFA, 0x05, 0xF9, 0x08, 0xFA, 0xF8, 0xF4, 0x03, 0xFD, 0x06, 0xF5, 0xFC, 0x05, 0x0B, 0x06,
+0xFA, 0x08, 0xFC, 0xF5, 0xF5, 0x0A, 0xFB, 0xFA, 0x0B, 0x07, 0x08, 0x07, 0xFA, 0x06, 0xF2, 0xCF,
+0xF9, 0xF7, 0x0B, 0xFA, 0x08, 0xFA, 0xF8, 0xFA, 0x06, 0xFC, 0x0A, 0xFC, 0xF4, 0x04, 0x0A, 0x05,
+0xFA, 0x0B, 0xF4, 0xF8, 0xF8, 0x0A, 0xF4, 0xFA, 0x06, 0x08, 0x07, 0x07, 0xFF, 0x04, 0xFA, 0xE1,
+0xFD, 0xF6, 0x06, 0xF2, 0x00, 0xEE, 0xFA, 0xF2, 0x07, 0x02, 0x09, 0xF6, 0xF6, 0xFF, 0x0B, 0x10,
+0xFE, 0x0D, 0xFA, 0xFB, 0xF1, 0x0B, 0xFD, 0xF6, 0x02, 0x05, 0x06, 0x05, 0xF6, 0x03, 0xF6, 0x00,
+0xFE, 0xF5, 0x0F, 0xEE, 0x04, 0xF9, 0xF9, 0xF3, 0x06, 0xFC, 0x0A, 0xF9, 0xF7, 0x03, 0x0D, 0x05,
+0xF8, 0x0A, 0xFD, 0xF8, 0xF3, 0x09, 0xF8, 0xF2, 0x02, 0x04, 0x06, 0x07, 0x00, 0xFF, 0xFC, 0x02,
+0xF8, 0xF7, 0x06, 0xF5, 0x07, 0xF4, 0xF4, 0xF7, 0x04, 0x00, 0x07, 0xF8, 0xFD, 0xFD, 0x07, 0x06,
+0xF9, 0x0C, 0xF9, 0xF5, 0xF7, 0x03, 0xFC, 0xF8, 0x0B, 0x04, 0x08, 0x03, 0xF3, 0x0B, 0xF4, 0x01,
+0xF9, 0xF8, 0x06, 0xF7, 0x08, 0xFE, 0xFE, 0xF4, 0x0A, 0xFB, 0x0B, 0xF2, 0xF5, 0x08, 0x07, 0x09,
+0xFA, 0x08, 0xF6, 0xFD, 0xF6, 0x0C, 0xF6, 0xFB, 0x02, 0x03, 0x07, 0x05, 0xFE, 0x06, 0xF6, 0x05,
+0xF4, 0xFC, 0x03, 0xF0, 0x08, 0xF3, 0xF3, 0xFB, 0x04, 0xF9, 0x07, 0xFD, 0xF9, 0xFF, 0x08, 0x0A,
+0xFA, 0x04, 0xF6, 0xF8, 0xF8, 0x0E, 0xF5, 0xF6, 0x0A, 0x00, 0x0D, 0x05, 0xFE, 0xFF, 0xF2, 0x00,
+0xF2, 0xF7, 0x0C, 0xF1, 0x08, 0xF9, 0xFC, 0xF8, 0x09, 0x00, 0x0B, 0xFA, 0xFC, 0xFA, 0x09, 0x0D,
+0xF6, 0x0E, 0xF4, 0xF7, 0xF9, 0x0F, 0xFA, 0xFB, 0x07, 0x05, 0x07, 0x02, 0xF6, 0x03, 0xFC, 0x05,
+0xF4, 0xF7, 0x07, 0xF8, 0x0D, 0xF6, 0xFA, 0xF9, 0x04, 0xFF, 0x06, 0xF6, 0xFB, 0x02, 0x0C, 0x07,
+0xFA, 0x0B, 0xF8, 0xFF, 0xF7, 0x0A, 0xF7, 0xFB, 0x0B, 0x08, 0x06, 0x06, 0xFB, 0x07, 0xFA, 0xF2,
+0xF7, 0xF9, 0x06, 0xF6, 0x0A, 0xF6, 0xFB, 0xFA, 0x09, 0xFB, 0x07, 0xF9, 0xF9, 0x06, 0x06, 0x09,
+0xF6, 0x04, 0xF9, 0xF8, 0xFD, 0x09, 0xF9, 0xFB, 0x09, 0x06, 0x07, 0x09, 0xFC, 0x08, 0xF7, 0x11,
+0xF9, 0xF7, 0x06, 0xF8, 0x09, 0xF8, 0xFA, 0xFA, 0x05, 0xFB, 0x09, 0xFA, 0xFB, 0x07, 0x09, 0x0A,
+0xF6, 0x08, 0xF8, 0xF7, 0xFA, 0x0A, 0xF9, 0xF4, 0x09, 0x06, 0x04, 0x06, 0xFA, 0x02, 0xF5, 0xDC,
+0xF7, 0xFC, 0x0A, 0xFA, 0x04, 0xF9, 0xF7, 0xF8, 0x05, 0xFF, 0x07, 0xFB, 0xFA, 0x08, 0x04, 0x07,
+0xF8, 0x05, 0xFB, 0xF7, 0xF6, 0x0D, 0xF5, 0xF9, 0x06, 0x05, 0x09, 0x0B, 0xF5, 0x06, 0xF5, 0xE6,
+0xFB, 0xFF, 0x0B, 0xF9, 0x05, 0xF7, 0xFC, 0xFC, 0x07, 0xF9, 0x0B, 0xFB, 0xF5, 0x07, 0x0E, 0x0B,
+0xF8, 0x06, 0xFB, 0xFA, 0xF6, 0x08, 0xFB, 0xF6, 0x09, 0x05, 0x0C, 0x06, 0xF7, 0x04, 0xF6, 0xDB,
+0xF6, 0xFC, 0x01, 0xF5, 0x09, 0xF4, 0xFE, 0xF7, 0x0D, 0xF5, 0x03, 0xF9, 0xFC, 0x0C, 0x06, 0x06,
+0xF5, 0x0A, 0xFB, 0xF7, 0xF5, 0x06, 0xFB, 0x01, 0x0A, 0x04, 0x08, 0x03, 0xFF, 0x09, 0xEF, 0x19,
+0xF7, 0xF8, 0x0C, 0xF9, 0x05, 0xF8, 0xF7, 0xFA, 0x08, 0xF7, 0x0A, 0xF9, 0xFA, 0x03, 0x09, 0x0B,
+0xFC, 0x04, 0xFC, 0xF8, 0xF4, 0x07, 0xF9, 0xF4, 0x0A, 0x06, 0x0B, 0x01, 0xFD, 0x06, 0xF9, 0xF1,
+0xF7, 0xFC, 0x02, 0xF6, 0x06, 0xF6, 0xF8, 0xF9, 0x0A, 0xFC, 0x0B, 0xFE, 0xF9, 0x02, 0x0A, 0x07,
+0xF5, 0x05, 0xFA, 0xFB, 0xFB, 0x07, 0xF7, 0xF8, 0x0A, 0x06, 0x07, 0x07, 0xF0, 0x06, 0xF5, 0xEB,
+0xF7, 0xFA, 0x04, 0xF7, 0x07, 0xF3, 0xFA, 0xF7, 0x09, 0xF8, 0x07, 0xF8, 0xF9, 0x0B, 0x0A, 0x08,
+0xF9, 0x06, 0xFC, 0xFD, 0xF7, 0x07, 0xFD, 0xFB, 0x08, 0x06, 0x09, 0x04, 0xFA, 0x07, 0xFA, 0xF8,
+0xF5, 0xF3, 0x14, 0xEF, 0x0D, 0xF0, 0xF4, 0xEF, 0x04, 0xFC, 0x13, 0xF2, 0xF2, 0x03, 0x10, 0x0E,
+0xF1, 0x14, 0xF4, 0xF1, 0xF3, 0x0C, 0xF1, 0xF2, 0x0A, 0x0C, 0x10, 0x0F, 0xF2, 0x0D, 0xF3, 0x04,
+0xF0, 0xF1, 0x0B, 0xF5, 0x10, 0xF3, 0xF2, 0xF0, 0x10, 0xF9, 0x0D, 0xF3, 0xF2, 0x0F, 0x0C, 0x10,
+0xF4, 0x11, 0xF2, 0xF3, 0xF5, 0x0A, 0xF3, 0xF1, 0x0A, 0x0B, 0x0D, 0x0D, 0xEA, 0x0C, 0xEF, 0x10,
+0xF3, 0xF2, 0x10, 0xEF, 0x10, 0xF0, 0xED, 0xF4, 0x0B, 0xF5, 0x10, 0xF5, 0xEF, 0x07, 0x0B, 0x11,
+0xF2, 0x0C, 0xF4, 0xEF, 0xF5, 0x0F, 0xF0, 0xF0, 0x09, 0x0B, 0x0C, 0x0C, 0xED, 0x0D, 0xF1, 0x06,
+0xF0, 0xF2, 0x0B, 0xF3, 0x0B, 0xF4, 0xEB, 0xF1, 0x13, 0xF8, 0x0B, 0xF9, 0xF5, 0x08, 0x0C, 0x0E,
+0xEE, 0x0E, 0xF2, 0xF2, 0xF6, 0x0F, 0xF3, 0xEB, 0x05, 0x07, 0x0A, 0x09, 0xE8, 0x11, 0xED, 0x14,
+0xF4, 0xF1, 0x11, 0xEE, 0x09, 0xF4, 0xF0, 0xEB, 0x0B, 0xFA, 0x0E, 0xF2, 0xF4, 0x09, 0x0C, 0x0B,
+0xF0, 0x0B, 0xEE, 0xF3, 0xF1, 0x0A, 0xED, 0xF5, 0x0B, 0x0A, 0x0A, 0x11, 0xF2, 0x0D, 0xED, 0x18,
+0xF1, 0xF5, 0x10, 0xF4, 0x0D, 0xEF, 0xF3, 0xEF, 0x0E, 0xF1, 0x0B, 0xF2, 0xEF, 0x12, 0x0E, 0x10,
+0xF3, 0x10, 0xF7, 0xF5, 0xF6, 0x0F, 0xEF, 0xF9, 0x10, 0x0B, 0x10, 0x0E, 0xF5, 0x0D, 0xF3, 0x0A,
+0xF8, 0xF0, 0x0C, 0xEE, 0x0B, 0xF2, 0xF3, 0xF2, 0x0B, 0xF7, 0x0C, 0xF2, 0xF3, 0x08, 0x11, 0x0F,
+0xF2, 0x0F, 0xF2, 0xF0, 0xED, 0x10, 0xED, 0xF1, 0x0B, 0x0C, 0x0E, 0x0E, 0xEF, 0x07, 0xF5, 0x11,
+0xF0, 0xF0, 0x0E, 0xF1, 0x0D, 0xEC, 0xF1, 0xF6, 0x09, 0xF7, 0x0B, 0xF4, 0xEF, 0x08, 0x0D, 0x10,
+0xF5, 0x0C, 0xF6, 0xF0, 0xED, 0x0D, 0xF1, 0xEF, 0x0A, 0x0C, 0x0C, 0x0E, 0xEC, 0x0C, 0xF4, 0xFB,
+0xF5, 0xF3, 0x11, 0xF2, 0x0C, 0xF1, 0xF2, 0xF0, 0x09, 0xF7, 0x0D, 0xF2, 0xF4, 0x07, 0x0E, 0x0F,
+0xF1, 0x11, 0xF1, 0xF5, 0xF1, 0x0D, 0xF4, 0xF3, 0x08, 0x09, 0x11, 0x0F, 0xF5, 0x0E, 0xF2, 0x23,
+0xF1, 0xEF, 0x0C, 0xF1, 0x0C, 0xEF, 0xEE, 0xEF, 0x08, 0x02, 0x0D, 0xF8, 0xF3, 0x09, 0x11, 0x11,
+0xF0, 0x13, 0xF0, 0xEF, 0xF3, 0x0E, 0xF4, 0xEF, 0x0B, 0x08, 0x0E, 0x0D, 0xF0, 0x06, 0xEB, 0x0D,
+0xF4, 0xEE, 0x0F, 0xF0, 0x0B, 0xF4, 0xF1, 0xF5, 0x0B, 0xF4, 0x0E, 0xF5, 0xF4, 0x0A, 0x0D, 0x10,
+0xF0, 0x10, 0xF6, 0xF4, 0xF4, 0x0C, 0xF7, 0xED, 0x0A, 0x08, 0x10, 0x11, 0xF2, 0x09, 0xEF, 0xFE,
+0xF1, 0xF2, 0x13, 0xEF, 0x10, 0xED, 0xEF, 0xF2, 0x04, 0xF6, 0x14, 0xF2, 0xF3, 0x06, 0x0E, 0x12,
+0xF0, 0x10, 0xF6, 0xF1, 0xF4, 0x0D, 0xF5, 0xF2, 0x0D, 0x05, 0x0C, 0x11, 0xF3, 0x07, 0xF3, 0x14,
+0xF1, 0xF4, 0x0F, 0xF6, 0x0B, 0xF0, 0xF2, 0xF0, 0x0A, 0xF8, 0x0F, 0xF1, 0xED, 0x09, 0x0A, 0x0D,
+0xF2, 0x0E, 0xF4, 0xEE, 0xF6, 0x0D, 0xF3, 0xF3, 0x0D, 0x07, 0x11, 0x0D, 0xEF, 0x14, 0xEF, 0x24,
+0xF2, 0xF2, 0x0D, 0xEF, 0x10, 0xF4, 0xEF, 0xF1, 0x10, 0xF5, 0x0D, 0xF8, 0xF1, 0x06, 0x09, 0x10,
+0xF0, 0x0C, 0xF0, 0xF4, 0xED, 0x0D, 0xEF, 0xF3, 0x0A, 0x08, 0x10, 0x0B, 0xF4, 0x09, 0xF3, 0x17,
+0xF2, 0xEC, 0x10, 0xF2, 0x0E, 0xEA, 0xEF, 0xF3, 0x0B, 0xFE, 0x11, 0xF5, 0xF4, 0x0D, 0x08, 0x0E,
+0xF3, 0x10, 0xF2, 0xF3, 0xF1, 0x0F, 0xF1, 0xF5, 0x0B, 0x0A, 0x0D, 0x0F, 0xF3, 0x09, 0xEF, 0x04,
+0xF8, 0xEE, 0x0E, 0xF1, 0x0B, 0xEE, 0xEE, 0xEF, 0x0A, 0xFC, 0x0E, 0xF8, 0xF1, 0x07, 0x0B, 0x0B,
+0xF1, 0x0D, 0xF3, 0xF1, 0xEE, 0x12, 0xF5, 0xF1, 0x0B, 0x09, 0x0B, 0x0D, 0xF2, 0x0A, 0xED, 0x21,
+0xF2, 0xF5, 0x0D, 0xF1, 0x0A, 0xF0, 0xED, 0xF0, 0x0A, 0xF9, 0x0C, 0xF6, 0xEE, 0x07, 0x0D, 0x12,
+0xF6, 0x0D, 0xF3, 0xF2, 0xF4, 0x0A, 0xF1, 0xEE, 0x08, 0x05, 0x0E, 0x0E, 0xEE, 0x10, 0xF1, 0x1E,
+0xEE, 0xEF, 0x0E, 0xF3, 0x08, 0xF1, 0xF5, 0xEF, 0x07, 0xF9, 0x09, 0xF6, 0xF0, 0x05, 0x0B, 0x0F,
+0xF3, 0x0C, 0xF2, 0xEB, 0xF0, 0x0C, 0xEE, 0xEA, 0x0C, 0x01, 0x0F, 0x11, 0xEB, 0x0F, 0xF2, 0x1D,
+0xF2, 0xF3, 0x0E, 0xF1, 0x0B, 0xF0, 0xF3, 0xEE, 0x08, 0xF9, 0x14, 0xF8, 0xEF, 0x04, 0x12, 0x10,
+0xF0, 0x13, 0xF1, 0xF5, 0xF3, 0x0D, 0xF2, 0xF0, 0x09, 0x07, 0x10, 0x0D, 0xF5, 0x0F, 0xF1, 0x0B,
+0xF4, 0xF6, 0x0D, 0xF2, 0x09, 0xF2, 0xF3, 0xEC, 0x05, 0xF8, 0x14, 0xF6, 0xF3, 0x08, 0x11, 0x10,
+0xF4, 0x0E, 0xF3, 0xF4, 0xF1, 0x11, 0xF0, 0xEE, 0x0B, 0x08, 0x11, 0x0D, 0xF7, 0x0F, 0xED, 0x20,
+0xF4, 0xF6, 0x13, 0xF1, 0x0C, 0xF4, 0xEC, 0xF3, 0x08, 0xF8, 0x14, 0xF8, 0xEE, 0x02, 0x12, 0x12,
+0xF4, 0x15, 0xF5, 0xF5, 0xF7, 0x0C, 0xF4, 0xF5, 0x0B, 0x06, 0x0F, 0x12, 0xF4, 0x13, 0xED, 0x15,
+0xF3, 0xF7, 0x12, 0xEE, 0x0C, 0xF1, 0xE8, 0xF2, 0x05, 0xF4, 0x14, 0xF5, 0xF0, 0x05, 0x10, 0x0D,
+0xF6, 0x0B, 0xF1, 0xF6, 0xF4, 0x10, 0xF6, 0xEF, 0x0D, 0x08, 0x0B, 0x0E, 0xF4, 0x0D, 0xF4, 0xFF,
+0xF0, 0xF0, 0x0F, 0xEC, 0x13, 0xF4, 0xF4, 0xEF, 0x0D, 0xF7, 0x11, 0xF6, 0xF5, 0x07, 0x0A, 0x11,
+0xF4, 0x0F, 0xEE, 0xF4, 0xF3, 0x14, 0xF2, 0xF0, 0x09, 0x01, 0x10, 0x0C, 0xF3, 0x08, 0xF5, 0x18,
+0xF5, 0xEC, 0x10, 0xF2, 0x0F, 0xF1, 0xF1, 0xF4, 0x0B, 0xF7, 0x0F, 0xF6, 0xF3, 0x07, 0x0D, 0x0C,
+0xF2, 0x12, 0xF1, 0xF7, 0xEF, 0x0C, 0xEF, 0xF5, 0x0A, 0x07, 0x0C, 0x0C, 0xF2, 0x0D, 0xF4, 0x22,
+0xF0, 0xF4, 0x0D, 0xEE, 0x0C, 0xEF, 0xF0, 0xEE, 0x0C, 0xF5, 0x0E, 0xF9, 0xF5, 0x08, 0x0C, 0x0B,
+0xF3, 0x0F, 0xEE, 0xF3, 0xF2, 0x0F, 0xF2, 0xEE, 0x0B, 0x09, 0x0B, 0x0C, 0xF6, 0x06, 0xED, 0x0E,
+0xF5, 0xF0, 0x0F, 0xF1, 0x0D, 0xF5, 0xF6, 0xF1, 0x09, 0xF9, 0x0B, 0xF1, 0xEC, 0x0B, 0x0A, 0x13,
+0xF0, 0x12, 0xEF, 0xF4, 0xED, 0x13, 0xF2, 0xF6, 0x0F, 0x06, 0x0F, 0x0C, 0xEC, 0x0B, 0xF2, 0x13,
+0xF3, 0xF3, 0x0C, 0xF2, 0x0B, 0xF4, 0xF2, 0xF2, 0x0C, 0xF6, 0x0D, 0xF5, 0xF3, 0x0A, 0x0B, 0x11,
+0xEF, 0x0E, 0xF0, 0xF1, 0xF2, 0x10, 0xF5, 0xF5, 0x0B, 0x09, 0x11, 0x12, 0xEC, 0x0C, 0xF2, 0x0D,
+0xF0, 0xF1, 0x0E, 0xF2, 0x0D, 0xF1, 0xF4, 0xED, 0x07, 0xF8, 0x10, 0xF5, 0xF7, 0x0C, 0x09, 0x13,
+0xF4, 0x11, 0xF4, 0xEF, 0xF0, 0x10, 0xF1, 0xF6, 0x0C, 0x08, 0x0D, 0x10, 0xF2, 0x12, 0xF4, 0xF7,
+0xF0, 0xF0, 0x0F, 0xF2, 0x0C, 0xF0, 0xF3, 0xF4, 0x09, 0xF8, 0x0C, 0xF7, 0xF1, 0x08, 0x0F, 0x13,
+0xF3, 0x0D, 0xF0, 0xF5, 0xEF, 0x12, 0xEC, 0xF2, 0x09, 0x08, 0x0D, 0x0C, 0xEA, 0x0D, 0xF4, 0x04,
+0xF2, 0xF3, 0x0B, 0xEF, 0x0C, 0xF1, 0xEE, 0xF5, 0x0F, 0xF4, 0x09, 0xF5, 0xEF, 0x0E, 0x0C, 0x10,
+0xF3, 0x0F, 0xF6, 0xF3, 0xF2, 0x0B, 0xF3, 0xF2, 0x0A, 0x07, 0x0C, 0x0D, 0xF0, 0x10, 0xEF, 0x1F,
+0xF3, 0xF0, 0x14, 0xEE, 0x0A, 0xEC, 0xF4, 0xF5, 0x10, 0xF3, 0x0F, 0xF2, 0xED, 0x07, 0x11, 0x0A,
+0xF3, 0x12, 0xF5, 0xF5, 0xF2, 0x0F, 0xF3, 0xF1, 0x07, 0x06, 0x0C, 0x0C, 0xEF, 0x0B, 0xEF, 0x16,
+0xF3, 0xF0, 0x0F, 0xF0, 0x0B, 0xF5, 0xEE, 0xF0, 0x09, 0xFB, 0x0C, 0xF5, 0xEE, 0x03, 0x0D, 0x15,
+0xF2, 0x10, 0xF1, 0xF3, 0xF4, 0x0C, 0xF1, 0xEE, 0x08, 0x07, 0x0C, 0x0C, 0xF3, 0x0D, 0xEC, 0x24,
+0xF6, 0xEE, 0x0D, 0xF0, 0x0C, 0xF0, 0xF1, 0xF4, 0x0D, 0xFC, 0x0D, 0xF1, 0xF0, 0x0A, 0x08, 0x0D,
+0xF1, 0x10, 0xF1, 0xF2, 0xEF, 0x0D, 0xF4, 0xF2, 0x07, 0x0A, 0x0F, 0x10, 0xED, 0x0B, 0xEA, 0x16,
+0xF4, 0xF4, 0x12, 0xF0, 0x11, 0xF3, 0xED, 0xEE, 0x0C, 0xF8, 0x10, 0xF3, 0xF6, 0x01, 0x14, 0x14,
+0xF4, 0x0E, 0xF6, 0xF0, 0xF1, 0x10, 0xF5, 0xEE, 0x07, 0x09, 0x0A, 0x09, 0xEF, 0x07, 0xEE, 0x12,
+0xEF, 0xF2, 0x0D, 0xF0, 0x0C, 0xED, 0xEF, 0xEC, 0x0A, 0xF8, 0x0B, 0xEF, 0xF0, 0x0A, 0x0C, 0x0A,
+0xF6, 0x13, 0xF5, 0xF1, 0xF1, 0x0E, 0xF4, 0xEB, 0x07, 0x05, 0x0A, 0x12, 0xF5, 0x11, 0xF0, 0x0C,
+0xFA, 0xF1, 0x10, 0xF1, 0x0A, 0xF1, 0xF0, 0xF1, 0x04, 0xFF, 0x13, 0xF9, 0xEE, 0x02, 0x0E, 0x0F,
+0xF1, 0x11, 0xF0, 0xED, 0xF3, 0x15, 0xF1, 0xED, 0x06, 0x08, 0x13, 0x0F, 0xE9, 0x0B, 0xF0, 0xF3,
+0xEF, 0xEF, 0x11, 0xF0, 0x0F, 0xF6, 0xF3, 0xF5, 0x0B, 0xF8, 0x0D, 0xF5, 0xE9, 0x08, 0x0C, 0x11,
+0xF6, 0x0A, 0xF4, 0xEF, 0xF5, 0x0D, 0xEF, 0xE9, 0x04, 0x08, 0x0C, 0x11, 0xF1, 0x13, 0xF8, 0x18,
+0xF8, 0xF0, 0x11, 0xF8, 0x0F, 0xF1, 0xF1, 0xF4, 0x13, 0xEE, 0x0D, 0xF8, 0xF8, 0x10, 0x0D, 0x0F,
+0xF2, 0x08, 0xF7, 0xF5, 0xED, 0x0F, 0xF0, 0xF2, 0x0E, 0x05, 0x0C, 0x13, 0xFB, 0x15, 0xF6, 0x1E,
+0xF6, 0xF2, 0x0F, 0xEE, 0x0D, 0xF4, 0xF2, 0xF1, 0x09, 0xFC, 0x12, 0xF3, 0xF2, 0x06, 0x0C, 0x16,
+0xF6, 0x14, 0xF6, 0xF5, 0xF1, 0x0F, 0xEC, 0xF2, 0x09, 0x09, 0x0C, 0x0C, 0xE4, 0x08, 0xED, 0x1A,
+0xEF, 0xF5, 0x0C, 0xEE, 0x0A, 0xEF, 0xEC, 0xEC, 0x0D, 0xF9, 0x0D, 0xF5, 0xF3, 0x03, 0x0D, 0x0E,
+0xF4, 0x13, 0xF2, 0xF1, 0xEE, 0x09, 0xEE, 0xF2, 0x0F, 0x03, 0x0A, 0x0E, 0xF7, 0x09, 0xEE, 0x11,
+0xF0, 0xF5, 0x0E, 0xF5, 0x09, 0xF3, 0xF4, 0xF2, 0x08, 0xF6, 0x0F, 0xF5, 0xF1, 0x07, 0x0B, 0x0F,
+0xF5, 0x0F, 0xF1, 0xF2, 0xF1, 0x0C, 0xEF, 0xEF, 0x08, 0x0B, 0x0D, 0x14, 0xF0, 0x04, 0xF1, 0x18,
+0xEF, 0xF1, 0x0F, 0xF3, 0x10, 0xF0, 0xF1, 0xF1, 0x0E, 0xF5, 0x09, 0xF1, 0xEC, 0x08, 0x10, 0x09,
+0xF2, 0x13, 0xF0, 0xF0, 0xF2, 0x0E, 0xF5, 0xF0, 0x0A, 0x0A, 0x0D, 0x0C, 0xF2, 0x08, 0xF2, 0x0C,
+0xF8, 0xEB, 0x12, 0xF3, 0x0B, 0xF1, 0xED, 0xED, 0x0D, 0xF3, 0x11, 0xFA, 0xEE, 0x07, 0x13, 0x0C,
+0xF7, 0x0C, 0xF2, 0xED, 0xF7, 0x11, 0xF1, 0xF1, 0x0B, 0x08, 0x0E, 0x0C, 0xF3, 0x08, 0xF3, 0xFF,
+0xF4, 0xF2, 0x12, 0xEF, 0x0E, 0xEA, 0xF5, 0xF4, 0x10, 0xF5, 0x0E, 0xF8, 0xF1, 0x0C, 0x12, 0x0F,
+0xF5, 0x0C, 0xEF, 0xF7, 0xEE, 0x0C, 0xF0, 0xF4, 0x07, 0x09, 0x0E, 0x0E, 0xEC, 0x0B, 0xF2, 0xF8,
+0xF7, 0xF0, 0x0B, 0xED, 0x10, 0xF4, 0xF3, 0xF3, 0x0C, 0xF1, 0x11, 0xF5, 0xF1, 0x0A, 0x0D, 0x0B,
+0xF4, 0x0F, 0xF2, 0xEC, 0xF5, 0x11, 0xEF, 0xF2, 0x09, 0x0A, 0x0E, 0x0C, 0xE8, 0x0C, 0xF4, 0xFE,
+0xF4, 0xEE, 0x0D, 0xF4, 0x0D, 0xF2, 0xF4, 0xF5, 0x04, 0xF7, 0x12, 0xF1, 0xEE, 0xFE, 0x0F, 0x0B,
+0xF3, 0x0F, 0xEE, 0xEA, 0xF7, 0x0F, 0xEA, 0xF5, 0x09, 0x08, 0x15, 0x11, 0xED, 0x0D, 0xEF, 0xEC,
+0xF0, 0xEC, 0x0B, 0xF4, 0x11, 0xF6, 0xF2, 0xF0, 0x0D, 0xF0, 0x11, 0xF7, 0xF4, 0x0D, 0x14, 0x12,
+0xEF, 0x0E, 0xF6, 0xEF, 0xF2, 0x11, 0xF7, 0xEC, 0x06, 0x04, 0x0C, 0x0E, 0xF3, 0x06, 0xF2, 0x01,
+0xF0, 0xEC, 0x10, 0xF1, 0x0E, 0xF7, 0xF6, 0xF5, 0x04, 0xFD, 0x14, 0xF6, 0xF7, 0x08, 0x10, 0x12,
+0xF4, 0x0D, 0xEF, 0xF4, 0xEF, 0x0D, 0xEC, 0xF2, 0x05, 0x03, 0x12, 0x0D, 0xF0, 0x05, 0xEC, 0x17,
+0xF7, 0xF9, 0x10, 0xF5, 0x08, 0xF1, 0xED, 0xF0, 0x0C, 0xF9, 0x12, 0xF3, 0xF1, 0x09, 0x10, 0x06,
+0xF3, 0x0D, 0xF9, 0xF6, 0xF5, 0x12, 0xED, 0xF2, 0x0B, 0x04, 0x0B, 0x0A, 0xF0, 0x0C, 0xED, 0x15,
+0xFA, 0xED, 0x0B, 0xF3, 0x10, 0xF2, 0xF6, 0xF4, 0x0D, 0xFE, 0x0F, 0xF7, 0xF7, 0x08, 0x14, 0x0E,
+0xF7, 0x0F, 0xF0, 0xEF, 0xEF, 0x10, 0xF0, 0xEE, 0x0D, 0x08, 0x0A, 0x12, 0xF0, 0x0E, 0xEC, 0x13,
+0xF8, 0xEE, 0x11, 0xF1, 0x0A, 0xF2, 0xF2, 0xEE, 0x0D, 0xFB, 0x14, 0xF6, 0xF5, 0x09, 0x11, 0x11,
+0xF3, 0x13, 0xF1, 0xF2, 0xF1, 0x14, 0xF3, 0xF2, 0x07, 0x08, 0x10, 0x0B, 0xEF, 0x0D, 0xEB, 0xF6,
+0xF6, 0xE8, 0x16, 0xF4, 0x07, 0xEB, 0xF3, 0xEE, 0x08, 0x01, 0x0F, 0xF2, 0xF4, 0x02, 0x0B, 0x0F,
+0xF4, 0x10, 0xF3, 0xF2, 0xF3, 0x0D, 0xEE, 0xEA, 0x04, 0x09, 0x0E, 0x0C, 0xE6, 0x06, 0xF2, 0xD5,
+0xF6, 0xF4, 0x10, 0xF2, 0x0D, 0xF4, 0xE8, 0xF1, 0x06, 0xF9, 0x0D, 0xFB, 0xF3, 0x00, 0x0F, 0x0D,
+0xF6, 0x0B, 0xF1, 0xEC, 0xEE, 0x0F, 0xEE, 0xEF, 0x04, 0x09, 0x15, 0x0F, 0xE4, 0x0B, 0xF5, 0x07,
+0xF1, 0xEE, 0x0A, 0xEB, 0x0D, 0xF0, 0xF8, 0xF0, 0x10, 0xF6, 0x12, 0xF5, 0xF4, 0x08, 0x13, 0x13,
+0xEE, 0x10, 0xF1, 0xF5, 0xF4, 0x0D, 0xF2, 0xF4, 0x0E, 0x06, 0x0E, 0x0C, 0xEF, 0x0F, 0xF6, 0x1B,
+0xF5, 0xF1, 0x0D, 0xF2, 0x0F, 0xF6, 0xF0, 0xEF, 0x0B, 0xF9, 0x0F, 0xF2, 0xED, 0x02, 0x16, 0x0D,
+0xEF, 0x0C, 0xF2, 0xF4, 0xEF, 0x11, 0xF3, 0xF3, 0x06, 0x0E, 0x11, 0x0E, 0xF4, 0x10, 0xF7, 0x10,
+0xF3, 0xEF, 0x0D, 0xF0, 0x08, 0xF1, 0xF6, 0xF7, 0x07, 0xF7, 0x0F, 0xF7, 0xED, 0x0C, 0x12, 0x07,
+0xF6, 0x0D, 0xF9, 0xF6, 0xEF, 0x0C, 0xF1, 0xF1, 0x11, 0x07, 0x0E, 0x0F, 0xEF, 0x0A, 0xF2, 0x13,
+0xF9, 0xEE, 0x11, 0xF8, 0x0F, 0xF7, 0xED, 0xF6, 0x0C, 0xFF, 0x0C, 0xFC, 0xF3, 0x0C, 0x10, 0x0E,
+0xEE, 0x16, 0xF9, 0xF3, 0xEC, 0x12, 0xF4, 0xEA, 0x06, 0x09, 0x0C, 0x12, 0xF9, 0x0A, 0xF7, 0x0D,
+0xF7, 0xF5, 0x0C, 0xED, 0x0A, 0xF2, 0xF3, 0xEF, 0x03, 0xFD, 0x11, 0xFF, 0xEB, 0xFE, 0x0F, 0x0C,
+0xF2, 0x11, 0xF3, 0xF2, 0xF2, 0x0E, 0xF7, 0xF6, 0x0C, 0x09, 0x10, 0x0E, 0xEE, 0x08, 0xEF, 0x18,
+0xF4, 0xED, 0x15, 0xEF, 0x0B, 0xEF, 0xEE, 0xF0, 0x06, 0x00, 0x0C, 0xFA, 0xF1, 0x06, 0x14, 0x14,
+0xF4, 0x0F, 0xF5, 0xED, 0xF3, 0x0A, 0xEF, 0xF1, 0x07, 0x08, 0x10, 0x09, 0xF3, 0x0C, 0xF6, 0x10,
+0xF4, 0xEF, 0x0E, 0xF2, 0x0C, 0xF3, 0xEE, 0xF4, 0x06, 0xFA, 0x0D, 0xF5, 0xF0, 0x04, 0x0D, 0x10,
+0xF3, 0x0C, 0xF4, 0xF3, 0xF3, 0x0F, 0xF1, 0xEF, 0x06, 0x09, 0x10, 0x0E, 0xEF, 0x09, 0xF3, 0x3B,
+0xEE, 0xF7, 0x11, 0xEF, 0x0D, 0xF2, 0xF8, 0xF7, 0x06, 0xF6, 0x13, 0xFA, 0xF2, 0x09, 0x0F, 0x07,
+0xEF, 0x0B, 0xF3, 0xF4, 0xF3, 0x10, 0xF4, 0xED, 0x0D, 0x0B, 0x11, 0x0E, 0xF5, 0x0B, 0xF5, 0x12,
+0xF7, 0xEF, 0x0B, 0xF7, 0x0B, 0xEE, 0xEF, 0xED, 0x0E, 0xF3, 0x09, 0xF4, 0xF8, 0x04, 0x0A, 0x11,
+0xF1, 0x13, 0xEE, 0xEF, 0xF7, 0x11, 0xF9, 0xF6, 0x0F, 0x09, 0x10, 0x0F, 0xF7, 0x0D, 0xF4, 0x12,
+0xF0, 0xF1, 0x0F, 0xEC, 0x0D, 0xF5, 0xF4, 0xF6, 0x07, 0xFB, 0x0F, 0xF7, 0xF3, 0x02, 0x07, 0x12,
+0xF9, 0x10, 0xEF, 0xF8, 0xF1, 0x0E, 0xF7, 0xED, 0x0B, 0x08, 0x0D, 0x09, 0xEF, 0x0A, 0xF4, 0x19,
+0xF9, 0xF4, 0x09, 0xF8, 0x0D, 0xED, 0xED, 0xEF, 0x0C, 0xF6, 0x0E, 0xF9, 0xEB, 0x0D, 0x09, 0x08,
+0xF2, 0x14, 0xF2, 0xEF, 0xF0, 0x13, 0xF9, 0xF4, 0x0E, 0x07, 0x08, 0x09, 0xF7, 0x0B, 0xF0, 0x19,
+0x05, 0x00, 0xFD, 0xFE, 0x02, 0x01, 0x05, 0xFB, 0x06, 0x01, 0xFF, 0xFB, 0x01, 0xFD, 0x02, 0xFD,
+0x04, 0x01, 0xFB, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0x01, 0xFC, 0xFF, 0x05, 0xFE, 0x02, 0xFE,
+0x02, 0x03, 0x05, 0x02, 0xFF, 0x03, 0xFA, 0xFD, 0x05, 0x03, 0x06, 0xFA, 0x01, 0x00, 0x03, 0x04,
+0x03, 0x00, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x03, 0x06, 0xFE, 0xFD, 0x00, 0x05, 0x06, 0xFE, 0x03,
+0xFD, 0xFD, 0xFA, 0xFC, 0xFC, 0x00, 0x02, 0x02, 0xFE, 0xFB, 0x00, 0xFD, 0xFE, 0x03, 0xFE, 0xFF,
+0xFD, 0xFE, 0xFF, 0xFC, 0xFA, 0x05, 0xFA, 0xFB, 0x02, 0x00, 0x00, 0x06, 0xFC, 0xFD, 0xFF, 0xFD,
+0xFB, 0xFE, 0xFE, 0x03, 0xFB, 0x00, 0x02, 0x06, 0xFF, 0x03, 0xFA, 0xFB, 0x01, 0x03, 0xFC, 0x02,
+0x06, 0xFD, 0xFB, 0xFD, 0x01, 0xFD, 0x03, 0xFE, 0x01, 0xFD, 0x05, 0xFF, 0xFD, 0xFA, 0x06, 0x06,
+0x00, 0x00, 0xFE, 0x00, 0x01, 0x04, 0x04, 0xFE, 0xFB, 0xFF, 0x04, 0xFA, 0x05, 0xFD, 0x06, 0xFF,
+0x03, 0x02, 0x00, 0x05, 0xFF, 0xFC, 0xFF, 0xFC, 0xFC, 0xFB, 0x06, 0x02, 0xFC, 0xFE, 0xFE, 0x06,
+0x01, 0xFF, 0xFE, 0x01, 0x03, 0xFE, 0x05, 0x03, 0xFE, 0x01, 0xFE, 0x04, 0x01, 0x04, 0x00, 0xFC,
+0x03, 0x04, 0xFD, 0xFC, 0xFF, 0xFA, 0xFF, 0x05, 0xFA, 0x04, 0xFE, 0x04, 0x00, 0x03, 0x03, 0x06,
+0xFA, 0xFE, 0xFC, 0x05, 0x02, 0xFE, 0x00, 0xFB, 0xFD, 0x06, 0x03, 0x01, 0xFD, 0x01, 0xFA, 0xFD,
+0x06, 0xFF, 0xFB, 0xFB, 0x03, 0xFB, 0xFD, 0x00, 0x06, 0xFC, 0x04, 0xFA, 0x01, 0x06, 0xFC, 0x00,
+0x03, 0xFD, 0xFE, 0x01, 0x03, 0xFF, 0xFA, 0x06, 0xFE, 0xFE, 0x01, 0x03, 0x06, 0xFE, 0x02, 0xFB,
+0xFA, 0xFB, 0x05, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0xFA, 0x02, 0xFC, 0x00, 0x02, 0xFB, 0x00, 0xFC,
+0x01, 0x00, 0xFF, 0x02, 0xFB, 0x02, 0x02, 0x00, 0x01, 0x02, 0xFE, 0x02, 0x03, 0xFD, 0xFD, 0xFD,
+0x01, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x01, 0x03, 0xFD, 0xFD, 0xFF, 0xFF, 0x01, 0x01, 0xFF, 0xE6,
+0x02, 0x00, 0xFD, 0x02, 0xFD, 0x01, 0x02, 0x00, 0xFC, 0x04, 0xFF, 0x04, 0x00, 0xFC, 0xFD, 0x01,
+0x03, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x01, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0xFF, 0x01, 0xE2,
+0x00, 0x02, 0xFF, 0x02, 0xFE, 0x03, 0xFF, 0x00, 0xFE, 0x03, 0xFF, 0x03, 0x02, 0xFC, 0x01, 0x00,
+0x01, 0xFF, 0x02, 0x01, 0x00, 0xFF, 0x02, 0x00, 0xFF, 0xFE, 0xFE, 0xFF, 0x02, 0x01, 0x03, 0xF3,
+0x00, 0x05, 0xFB, 0xFB, 0xFE, 0x03, 0x03, 0xFE, 0x02, 0x02, 0xFE, 0x03, 0xFD, 0xFE, 0x02, 0xFD,
+0x02, 0x00, 0x05, 0x01, 0xFF, 0xFC, 0xFD, 0x06, 0xFF, 0xF6, 0xFF, 0xFE, 0xFE, 0x02, 0x01, 0xE7,
+0x02, 0x02, 0xFF, 0xFD, 0xFD, 0x00, 0xFF, 0xFD, 0xFC, 0x06, 0x01, 0xFE, 0x03, 0xFA, 0xFD, 0x02,
+0x04, 0x02, 0xFF, 0x00, 0xFE, 0xFD, 0xFF, 0x02, 0xFC, 0xF6, 0xFD, 0xFD, 0x00, 0x02, 0x02, 0xF6,
+0x02, 0x03, 0x00, 0x00, 0xFF, 0x02, 0x01, 0xFE, 0xFE, 0x05, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFF,
+0x03, 0xFE, 0x01, 0x01, 0x03, 0xFF, 0x03, 0xFD, 0xFC, 0xFE, 0xFB, 0xFF, 0x02, 0x00, 0xFF, 0xD6,
+0xFF, 0x02, 0xFE, 0x00, 0xFF, 0xFF, 0x02, 0x02, 0xFE, 0x05, 0xFF, 0x02, 0xFF, 0xFC, 0xFF, 0xFF,
+0x03, 0xFF, 0x02, 0x03, 0x02, 0x00, 0x01, 0x03, 0x00, 0xFE, 0xFE, 0xFE, 0x01, 0xFE, 0x00, 0xFA,
+0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x04, 0x01, 0x02, 0xFF, 0xF9, 0xFD, 0xFF,
+0x00, 0xFD, 0xFD, 0x02, 0x01, 0x02, 0x03, 0xFF, 0xFD, 0xFC, 0xFC, 0xFF, 0x01, 0xFF, 0x02, 0xE8,
+0x03, 0x02, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x01, 0xFF, 0x03, 0x02, 0x04, 0x00, 0xFB, 0x00, 0x01,
+0x04, 0xFF, 0xFF, 0x01, 0x01, 0x00, 0x01, 0x02, 0xFF, 0xFB, 0xFE, 0xFD, 0x03, 0x02, 0x01, 0xE9,
+0x00, 0xFF, 0xFD, 0x03, 0xFC, 0x03, 0x01, 0x01, 0xFE, 0x00, 0xFD, 0x04, 0x01, 0xFD, 0xFF, 0x00,
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x01, 0x00, 0xF8, 0xFF, 0x00, 0x02, 0x01, 0x01, 0xD9,
+0x03, 0x00, 0x00, 0x01, 0xFE, 0x03, 0xFE, 0xFF, 0x00, 0xFE, 0xFC, 0x00, 0x03, 0xFE, 0xFE, 0xFF,
+0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0xFD, 0xF7, 0xFD, 0xFF, 0x04, 0x00, 0x04, 0xE8,
+0xFF, 0x00, 0xFD, 0x02, 0xFE, 0x02, 0x01, 0x03, 0x04, 0x03, 0xFD, 0x03, 0xFF, 0x01, 0xFC, 0xFE,
+0x00, 0x01, 0xFF, 0x01, 0x04, 0xFC, 0x03, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0xE8,
+0x00, 0x01, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFD, 0xFD, 0x06, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+0x03, 0xFE, 0xFC, 0x03, 0xFF, 0xFE, 0xFE, 0xFF, 0x00, 0xF9, 0xFD, 0xFF, 0x02, 0xFF, 0x01, 0xDC,
+0x01, 0x01, 0xFF, 0x02, 0xFE, 0x02, 0x01, 0x00, 0x00, 0x08, 0x02, 0x03, 0x01, 0xFE, 0x02, 0xFD,
+0x00, 0x02, 0x04, 0x01, 0xFF, 0x01, 0xFE, 0xFE, 0xFB, 0xF6, 0xFF, 0xFF, 0x04, 0x01, 0xFF, 0xDB,
+0x01, 0x02, 0xFF, 0x00, 0xFE, 0x02, 0x02, 0x00, 0xFD, 0x01, 0xFC, 0xFE, 0xFF, 0xFF, 0xFD, 0xFE,
+0x02, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0x04, 0xFC, 0xF8, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xCE,
+0x00, 0x00, 0xFE, 0x01, 0xFD, 0x02, 0x03, 0x01, 0xFC, 0x04, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x00,
+0x02, 0xFE, 0x01, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xFE, 0x02, 0x01, 0x00, 0xEE,
+0x03, 0x01, 0x00, 0xFE, 0xFE, 0x02, 0x01, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0x02, 0xFC, 0xFE, 0xFE,
+0x01, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x02, 0x04, 0xFD, 0xF7, 0xFF, 0xFF, 0x03, 0x00, 0x01, 0xCE,
+0x03, 0x01, 0x01, 0xFF, 0xFC, 0x02, 0x00, 0x01, 0xFD, 0x03, 0xFF, 0x03, 0xFF, 0xF8, 0x02, 0x01,
+0x04, 0xFE, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0xF6, 0xFF, 0xFD, 0x02, 0x01, 0x00, 0xD6,
+0x01, 0x00, 0x00, 0x01, 0xFB, 0x03, 0x01, 0xFF, 0xFE, 0x03, 0x01, 0x01, 0x02, 0xFC, 0xFF, 0xFF,
+0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0xFE, 0xF6, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xC9,
+0x03, 0x02, 0xFD, 0x01, 0xFE, 0x02, 0x02, 0x04, 0x00, 0x02, 0xFF, 0x03, 0x02, 0xFC, 0xFE, 0xFD,
+0x02, 0xFC, 0x01, 0x02, 0x00, 0xFF, 0xFF, 0x00, 0xFD, 0xFB, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE4,
+0x02, 0x03, 0xFD, 0x03, 0xFF, 0x04, 0x00, 0x00, 0xFC, 0x01, 0xFD, 0x01, 0x05, 0xFD, 0xFF, 0xFE,
+0x03, 0xFC, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFB, 0x00, 0xFF, 0x05, 0xFF, 0x00, 0xE8,
+0x03, 0x02, 0xFF, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0xFC, 0x06, 0x01, 0x04, 0xFF, 0xFC, 0x03, 0xFE,
+0x02, 0x00, 0x03, 0x01, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0xF6, 0xFF, 0xFF, 0x02, 0xFF, 0x00, 0xE1,
+0x03, 0x01, 0x00, 0xFE, 0xFE, 0x01, 0x01, 0x01, 0xFD, 0x01, 0xFD, 0x03, 0x02, 0xFC, 0xFF, 0x01,
+0x00, 0xFE, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0xF6, 0xFF, 0xFC, 0x01, 0xFE, 0xFE, 0xE0,
+0x03, 0x02, 0x00, 0x01, 0xFE, 0x03, 0x02, 0x02, 0xFD, 0x03, 0x00, 0x03, 0x02, 0xFA, 0xFF, 0x03,
+0xFF, 0xFE, 0x02, 0x02, 0xFF, 0x02, 0xFF, 0xFE, 0xFD, 0xF6, 0xFD, 0xFE, 0x01, 0xFF, 0x01, 0xD8,
+0x00, 0x03, 0x00, 0xFE, 0xFE, 0x02, 0xFE, 0x03, 0xFD, 0x03, 0x01, 0x02, 0x06, 0xFD, 0x01, 0xFE,
+0xFF, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x00, 0xFB, 0xF3, 0xFE, 0x01, 0x01, 0xFF, 0x03, 0xDE,
+0x04, 0xFF, 0xFF, 0x01, 0xFF, 0x02, 0x01, 0x00, 0xFD, 0x04, 0xFE, 0x01, 0x00, 0xFB, 0x00, 0x00,
+0x04, 0x00, 0x04, 0x01, 0x02, 0x00, 0x03, 0xFD, 0xFB, 0xF3, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xDF,
+0x01, 0x02, 0x00, 0x01, 0xFC, 0xFF, 0x02, 0x03, 0xFC, 0x04, 0x01, 0x02, 0xFF, 0xFF, 0xFE, 0x02,
+0x03, 0xFF, 0x00, 0x02, 0x01, 0xFD, 0x00, 0x03, 0xFD, 0xF5, 0xFF, 0x01, 0x03, 0xFF, 0x03, 0xD5,
+0x03, 0x03, 0x02, 0xFE, 0xFD, 0x05, 0xFF, 0x04, 0xFD, 0x03, 0xFF, 0x01, 0x01, 0xFE, 0xFB, 0x01,
+0x02, 0xFE, 0x06, 0xFE, 0x01, 0x00, 0xFF, 0x02, 0xFB, 0xF9, 0xFE, 0xFE, 0x04, 0x01, 0x05, 0xF1,
+0x02, 0x01, 0xFB, 0x01, 0xFD, 0x02, 0xFF, 0x01, 0xFC, 0x01, 0xFD, 0x00, 0x02, 0xFE, 0xFE, 0xFD,
+0x01, 0xFC, 0xFF, 0x02, 0x01, 0xFD, 0x01, 0xFF, 0xFC, 0xF8, 0xFD, 0xFE, 0x02, 0xFF, 0x01, 0xE8,
+0x03, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x02, 0xFF, 0xFE, 0x06, 0x01, 0x04, 0x01, 0xFA, 0x01, 0xFD,
+0x03, 0xFE, 0x01, 0x02, 0x01, 0x02, 0x02, 0xFF, 0xFE, 0xF4, 0xFF, 0xFC, 0x00, 0x00, 0xFD, 0xE5,
+0x01, 0x01, 0xFF, 0xFE, 0xFE, 0x01, 0x03, 0x00, 0xFD, 0x00, 0x04, 0x03, 0x00, 0xFB, 0x00, 0xFF,
+0x03, 0x00, 0x04, 0x04, 0x03, 0xFE, 0x01, 0xFE, 0xFF, 0xF2, 0xFF, 0xFC, 0x00, 0x01, 0x01, 0xE4,
+0x02, 0x03, 0xFF, 0x03, 0xFF, 0xFE, 0x04, 0x00, 0xFF, 0x04, 0xFE, 0xFF, 0x02, 0xFB, 0xFC, 0x05,
+0x02, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x01, 0x01, 0xFD, 0xEF, 0x01, 0xFF, 0xFB, 0xFF, 0xFF, 0xDB,
+0x02, 0xFF, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0x04, 0xFF, 0x06, 0x03, 0x05, 0x03, 0xFB, 0x00, 0xFB,
+0x02, 0x01, 0x04, 0x00, 0xFD, 0x01, 0x04, 0x02, 0xFD, 0xE9, 0x03, 0xFE, 0x01, 0xFE, 0x02, 0xE3,
+0x04, 0x08, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x05, 0x02, 0x01, 0xFD, 0x01, 0x00, 0xFD, 0xFC, 0x05,
+0x03, 0x04, 0x05, 0x02, 0x05, 0xFB, 0x01, 0x00, 0x00, 0xEB, 0x02, 0xFF, 0x00, 0xFF, 0x05, 0xEE,
+0xFF, 0x02, 0x01, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x04, 0xFF, 0x05, 0x00, 0xFD, 0x02, 0x03,
+0x06, 0x01, 0x02, 0x00, 0x03, 0xFD, 0x00, 0x04, 0xFB, 0xF0, 0xFC, 0xFC, 0x04, 0x00, 0x04, 0xE7,
+0x05, 0x04, 0x01, 0x00, 0x02, 0xFF, 0x02, 0x01, 0xFE, 0x05, 0xFB, 0x04, 0x02, 0xFC, 0xF9, 0xFD,
+0x00, 0xFD, 0x04, 0x01, 0x03, 0xF9, 0xFE, 0xFF, 0x01, 0xF2, 0xFF, 0x01, 0x02, 0xFF, 0x02, 0xE5,
+0x00, 0xFF, 0xFC, 0x04, 0xFE, 0x04, 0x04, 0xFF, 0xFD, 0x04, 0x01, 0x00, 0xFF, 0xFF, 0xFE, 0x02,
+0x01, 0xFD, 0x00, 0x02, 0x00, 0xFE, 0x04, 0x04, 0xFD, 0xF0, 0xFC, 0xFE, 0xFD, 0xFE, 0x05, 0xEF,
+0x02, 0x02, 0x01, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0xFB, 0x04, 0x00, 0x04, 0x03, 0xF9, 0xFF, 0x02,
+0x03, 0xFF, 0x00, 0x01, 0x03, 0x02, 0x02, 0x01, 0xFE, 0xEF, 0xFD, 0xFC, 0x04, 0x00, 0xFF, 0xEF,
+0x05, 0x00, 0x00, 0xFF, 0xFD, 0x01, 0x00, 0xFD, 0xFE, 0x05, 0xFC, 0x01, 0x04, 0xFD, 0x01, 0xFF,
+0xFE, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x01, 0xFA, 0xEC, 0xFF, 0xFE, 0x00, 0xFC, 0x01, 0xEE,
+0x03, 0x02, 0x00, 0x06, 0x00, 0x01, 0x06, 0x00, 0x01, 0x02, 0x01, 0x05, 0x00, 0xFC, 0xFC, 0x01,
+0x00, 0xFC, 0x01, 0xFE, 0x03, 0x00, 0xFF, 0x06, 0xFD, 0xE5, 0x03, 0x01, 0xFF, 0xFF, 0x01, 0xF3,
+0x00, 0x06, 0x01, 0xFE, 0x00, 0x02, 0x02, 0x05, 0x04, 0xFE, 0xFF, 0x06, 0x00, 0xFC, 0xFF, 0x01,
+0xFE, 0xF8, 0x05, 0x02, 0x00, 0xF6, 0x03, 0x09, 0xFE, 0xF5, 0xFD, 0x03, 0xFD, 0x00, 0x08, 0xFA,
+0x01, 0x01, 0xFC, 0xFE, 0xF8, 0x01, 0x00, 0x03, 0xFF, 0x03, 0x03, 0x06, 0xFE, 0xFF, 0xFD, 0xFD,
+0x06, 0xFD, 0xFF, 0xFA, 0x03, 0x00, 0x06, 0x01, 0xFD, 0xEF, 0x00, 0xF9, 0xFC, 0xFB, 0x01, 0xF1,
+0x05, 0x04, 0x00, 0x01, 0x04, 0x00, 0xFF, 0x06, 0x01, 0xFF, 0x01, 0xFD, 0xFF, 0xFE, 0x00, 0xF8,
+0x00, 0xFE, 0x03, 0x07, 0x05, 0xFD, 0x03, 0x06, 0xF8, 0xF1, 0xFE, 0xFC, 0xFD, 0xFB, 0x09, 0xF5,
+0x03, 0xFF, 0xF8, 0x03, 0xFD, 0x03, 0x02, 0x03, 0xFE, 0x01, 0x02, 0xFE, 0xFF, 0xF5, 0x01, 0xFB,
+0x00, 0xF8, 0x00, 0x03, 0x02, 0xFE, 0x02, 0xFF, 0xF5, 0xFD, 0x01, 0x00, 0x00, 0xF6, 0x05, 0xF8,
+0x00, 0x00, 0x03, 0x00, 0xFD, 0x03, 0x06, 0x02, 0xFE, 0x05, 0xF8, 0xFC, 0x03, 0x01, 0xF5, 0xFF,
+0xFD, 0xFF, 0x06, 0x01, 0x03, 0xF8, 0x01, 0x02, 0x01, 0xF1, 0xF9, 0x09, 0xFF, 0xFD, 0x03, 0xED,
+0x03, 0xFC, 0xF9, 0x06, 0xFE, 0x04, 0x05, 0x02, 0xFE, 0x05, 0xFB, 0x05, 0xFF, 0xFA, 0xFC, 0x00,
+0x03, 0xFA, 0x01, 0x03, 0x04, 0xFF, 0x04, 0xFF, 0xFB, 0xFB, 0x01, 0x01, 0xFC, 0x00, 0x05, 0xFB,
+0x04, 0x05, 0x02, 0xFE, 0xFF, 0x06, 0x03, 0xFF, 0xF9, 0xFE, 0x03, 0x01, 0x04, 0x03, 0xFC, 0x04,
+0xFD, 0x03, 0x04, 0x08, 0x01, 0xFC, 0x03, 0x05, 0xF9, 0xED, 0x04, 0xFE, 0x08, 0x01, 0x03, 0xF1,
+0x02, 0x00, 0xFA, 0xFF, 0xFE, 0xFA, 0x05, 0x00, 0xFD, 0x02, 0x01, 0x05, 0x02, 0xF7, 0xFD, 0x05,
+0xFC, 0xFB, 0x03, 0x04, 0x06, 0x03, 0x01, 0x08, 0xFB, 0xF4, 0x01, 0xFB, 0xF9, 0xFC, 0x02, 0xF4,
+0xFD, 0x01, 0x00, 0xFE, 0xFC, 0xFE, 0xFF, 0x05, 0xFC, 0xFA, 0x05, 0xFA, 0x05, 0x01, 0xFB, 0x00,
+0xFE, 0x01, 0xFA, 0xFB, 0xFB, 0x00, 0xFA, 0xFF, 0xFE, 0xFC, 0x04, 0x02, 0xFC, 0xFF, 0xFA, 0xFA,
+0xFE, 0xFC, 0x04, 0x01, 0xFC, 0x06, 0xFF, 0x00, 0xFE, 0xFA, 0x06, 0xFA, 0x04, 0xFB, 0x00, 0x02,
+0x00, 0x02, 0x05, 0x05, 0x04, 0x01, 0xFA, 0x01, 0x02, 0xFC, 0xFA, 0x06, 0x01, 0x00, 0xFC, 0xFC,
+0x01, 0xFE, 0x00, 0xFF, 0x00, 0x04, 0x05, 0xFA, 0xFE, 0xFC, 0x02, 0xFD, 0xFD, 0xFC, 0xFD, 0x05,
+0x01, 0x05, 0x00, 0xFF, 0xFE, 0x05, 0xFD, 0x04, 0x05, 0x00, 0x03, 0x01, 0xFB, 0xFF, 0x00, 0x04,
+0x00, 0xFD, 0xFC, 0xFD, 0xFA, 0xFD, 0x04, 0xFA, 0x00, 0x00, 0x04, 0xFA, 0x00, 0xFF, 0x02, 0xFE,
+0x02, 0x02, 0x00, 0x00, 0x06, 0x01, 0x00, 0xFC, 0xFA, 0x03, 0xFE, 0xFB, 0x01, 0x03, 0x01, 0xFC,
+0x06, 0x06, 0xFB, 0x04, 0x03, 0xFE, 0x05, 0xFD, 0xFF, 0x00, 0x05, 0xFC, 0x03, 0xFD, 0x06, 0xFD,
+0x04, 0x04, 0x06, 0x02, 0xFE, 0xFD, 0x00, 0x00, 0x04, 0xFE, 0x06, 0xFB, 0xFA, 0x05, 0x05, 0x02,
+0xFD, 0x05, 0x04, 0xFF, 0xFF, 0xFC, 0x06, 0xFD, 0xFF, 0xFF, 0x01, 0xFB, 0x04, 0xFB, 0xFF, 0x00,
+0x01, 0xFB, 0x04, 0x00, 0x02, 0x01, 0xFD, 0xFB, 0xFD, 0x02, 0x06, 0xFD, 0x05, 0x05, 0xFB, 0xFA,
+0x04, 0xFF, 0x05, 0xFA, 0x03, 0x06, 0x05, 0x05, 0x04, 0x02, 0x01, 0xFB, 0x02, 0x00, 0xFA, 0xFC,
+0xFE, 0xFC, 0x03, 0x05, 0x06, 0xFE, 0x02, 0xFD, 0x04, 0x02, 0x06, 0xFF, 0xFE, 0x05, 0x04, 0xFF,
+0xFD, 0x03, 0xFB, 0xFF, 0xFD, 0xFD, 0xFE, 0x01, 0x03, 0x00, 0x05, 0xFD, 0xFA, 0x03, 0x04, 0x05,
+0x00, 0x03, 0xFE, 0x01, 0xFA, 0x01, 0xFA, 0xFE, 0xFF, 0x04, 0x03, 0x01, 0x03, 0xFE, 0xFC, 0x01,
+0x05, 0x06, 0xFB, 0x02, 0xF7, 0x01, 0xFF, 0x09, 0xF4, 0x08, 0xF7, 0x0A, 0x02, 0xF5, 0xF9, 0x00,
+0x04, 0xFA, 0x00, 0x05, 0x04, 0x00, 0xFD, 0x07, 0xFC, 0x03, 0xFE, 0x02, 0x05, 0xFA, 0x01, 0xF6,
+0x01, 0x00, 0xF3, 0x0E, 0x05, 0x00, 0x02, 0x09, 0xFA, 0xF7, 0xF9, 0xFF, 0x04, 0xFC, 0xFB, 0xF2,
+0xFD, 0xF6, 0x0A, 0x04, 0x03, 0xF7, 0x0B, 0x03, 0xFE, 0x00, 0xF9, 0xFF, 0x08, 0xFF, 0x0A, 0xFC,
+0x02, 0x02, 0xF8, 0x07, 0xFF, 0x02, 0x05, 0x0B, 0xFC, 0xFF, 0xFC, 0x05, 0x08, 0x02, 0xF8, 0xF7,
+0xFF, 0xFC, 0x02, 0x04, 0x05, 0xF8, 0x05, 0x02, 0xFB, 0x02, 0xF8, 0xF8, 0x06, 0xFA, 0x06, 0xE7,
+0x00, 0x05, 0xF9, 0x0B, 0xFC, 0x08, 0x01, 0xFF, 0xFE, 0x04, 0xF8, 0x07, 0x0C, 0xFF, 0xFC, 0xF7,
+0x08, 0xFE, 0x03, 0xFF, 0x01, 0x01, 0x07, 0x08, 0x04, 0x04, 0xF6, 0xFB, 0x0A, 0xFF, 0x02, 0xF8,
+0x05, 0x07, 0xFD, 0x01, 0xFD, 0x04, 0x08, 0x09, 0xFF, 0x03, 0xFB, 0xFE, 0x07, 0x00, 0xFC, 0xFB,
+0x02, 0xFC, 0x0C, 0x06, 0xFF, 0xF7, 0x03, 0x02, 0x04, 0x03, 0xF6, 0xFC, 0x08, 0xFA, 0x08, 0xF7,
+0x07, 0x03, 0xF9, 0x05, 0xF9, 0x03, 0x02, 0x03, 0xFC, 0x00, 0xF7, 0x01, 0x05, 0xFB, 0xFC, 0xF7,
+0x02, 0xF9, 0x07, 0x07, 0x03, 0xF9, 0x03, 0x03, 0xF8, 0x03, 0xFE, 0xFC, 0x08, 0xFD, 0x06, 0xE5,
+0xFF, 0x05, 0xF8, 0x07, 0xFE, 0x06, 0x00, 0x09, 0xFC, 0x02, 0xFA, 0x07, 0x04, 0x01, 0xF6, 0xF2,
+0xFF, 0xF8, 0xFF, 0x05, 0x01, 0xFB, 0x02, 0x00, 0x01, 0xFD, 0xF7, 0xF9, 0x06, 0xFC, 0x09, 0xF9,
+0x09, 0xFF, 0xFF, 0x08, 0xF7, 0x06, 0x09, 0x0A, 0x04, 0x04, 0xFD, 0x09, 0x02, 0x00, 0xF9, 0xF9,
+0x09, 0xFB, 0x03, 0x03, 0x03, 0xFE, 0x0A, 0x0A, 0x02, 0xFE, 0xF6, 0x00, 0x09, 0x02, 0x01, 0xFB,
+0x05, 0x0B, 0xFA, 0x09, 0xF8, 0x09, 0x0B, 0x06, 0xFE, 0xFF, 0xFC, 0xFF, 0x08, 0x01, 0xFC, 0xFF,
+0x05, 0xFE, 0x09, 0x04, 0x03, 0xF3, 0x01, 0x03, 0x01, 0x03, 0xFE, 0xFB, 0x03, 0xFF, 0x03, 0xF2,
+0x07, 0x08, 0xF8, 0x06, 0xFC, 0x05, 0x05, 0x03, 0xFB, 0x03, 0xF7, 0x06, 0x05, 0xFD, 0xFC, 0x00,
+0x02, 0xFD, 0x04, 0x02, 0x07, 0xF8, 0x08, 0x03, 0xFA, 0x03, 0xFE, 0xFC, 0x03, 0xFD, 0x06, 0xFC,
+0xFE, 0x01, 0xFC, 0x02, 0xFC, 0x04, 0x0B, 0x03, 0xFE, 0x06, 0xFB, 0x09, 0x04, 0xFB, 0xFA, 0xF6,
+0x00, 0xF5, 0x03, 0x09, 0x08, 0xFA, 0x04, 0x04, 0x02, 0x00, 0xF7, 0xFB, 0x04, 0x00, 0x05, 0xF5,
+0x09, 0x04, 0xFB, 0x06, 0xFF, 0x07, 0x03, 0x04, 0xFB, 0x01, 0xFC, 0x09, 0x07, 0xFD, 0xFD, 0xFB,
+0x03, 0xFD, 0x07, 0x02, 0x06, 0xF9, 0x02, 0x03, 0xFE, 0x02, 0xFC, 0xF8, 0x08, 0x00, 0x05, 0xF2,
+0xFF, 0x01, 0xFC, 0x01, 0xF9, 0x09, 0x05, 0x06, 0xFC, 0x02, 0xFB, 0xFF, 0x04, 0xF9, 0xFD, 0xFE,
+0x03, 0xFB, 0x08, 0x04, 0x07, 0xFF, 0x05, 0x07, 0xFA, 0x03, 0xF9, 0xFA, 0x0A, 0xFD, 0x07, 0xEA,
+0x08, 0x09, 0xFB, 0x03, 0xFE, 0x00, 0x08, 0x00, 0xFF, 0xFB, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
+0x05, 0xF8, 0x04, 0x0A, 0x0A, 0xF5, 0x06, 0x08, 0xFD, 0x01, 0xFA, 0xFB, 0x0B, 0xF8, 0x09, 0xF7,
+0x03, 0x05, 0xF7, 0x03, 0xFB, 0x02, 0x06, 0x07, 0xFD, 0x04, 0xFB, 0x06, 0x03, 0xFF, 0xF8, 0xFF,
+0x05, 0xFA, 0x02, 0x03, 0x05, 0xF8, 0x06, 0x05, 0xFA, 0x03, 0xFF, 0xFA, 0x02, 0xFD, 0x06, 0xF3,
+0x08, 0x0A, 0xFF, 0x07, 0x02, 0x04, 0x02, 0x08, 0x03, 0x01, 0xFF, 0x06, 0x06, 0x06, 0xFB, 0xF7,
+0x00, 0xF2, 0x04, 0x06, 0x05, 0xF6, 0x09, 0x0A, 0xFB, 0x04, 0xF7, 0xF6, 0xFF, 0x01, 0x02, 0xF8,
+0xFF, 0x00, 0xF7, 0xFF, 0xF9, 0x06, 0x07, 0x03, 0xFD, 0x02, 0xFD, 0x05, 0x06, 0x00, 0x02, 0xF8,
+0x09, 0xF5, 0x01, 0x03, 0x01, 0xFD, 0x08, 0x01, 0xFE, 0x03, 0xF7, 0xF6, 0x02, 0xFB, 0x06, 0xF2,
+0x01, 0x01, 0xF7, 0x05, 0xF9, 0x03, 0x09, 0x01, 0xFA, 0x07, 0xF9, 0x00, 0x07, 0x01, 0xFC, 0x00,
+0x02, 0xF8, 0x02, 0x09, 0x02, 0xFF, 0x02, 0x07, 0xFD, 0x03, 0xF9, 0xFC, 0x07, 0xFC, 0x04, 0xF3,
+0x05, 0x07, 0xFF, 0x06, 0xF9, 0x06, 0x04, 0x04, 0xFC, 0x08, 0xF9, 0x06, 0x08, 0xFA, 0xFE, 0xFA,
+0x04, 0xFB, 0x04, 0x03, 0x02, 0xFF, 0x05, 0x05, 0xFC, 0x03, 0xFC, 0xFC, 0x05, 0x00, 0x05, 0xF8,
+0x05, 0x05, 0xFC, 0x06, 0xF8, 0x06, 0x05, 0x05, 0xFC, 0x02, 0xFE, 0x04, 0x03, 0xFB, 0xFA, 0xFC,
+0x05, 0xFB, 0x03, 0x04, 0x06, 0xF9, 0x05, 0x04, 0xFA, 0x03, 0xFA, 0xF9, 0x06, 0x00, 0x06, 0xF4,
+0x05, 0x05, 0xFE, 0x02, 0xF7, 0x05, 0x02, 0x03, 0xF8, 0x06, 0xFD, 0x06, 0x06, 0xFA, 0xFF, 0xFA,
+0x07, 0xFA, 0x07, 0x01, 0x05, 0xFB, 0x02, 0x05, 0xF9, 0x03, 0xFC, 0xF9, 0x06, 0x00, 0x04, 0xEB,
+0x04, 0x03, 0xFB, 0x05, 0xFC, 0x06, 0x01, 0x00, 0xFA, 0x09, 0xFE, 0x06, 0x03, 0xF8, 0xFA, 0x01,
+0x06, 0xF8, 0x07, 0x06, 0x06, 0xFE, 0x04, 0x06, 0xF9, 0x02, 0xFC, 0xFB, 0x03, 0xFE, 0x07, 0xFB,
+0x03, 0x03, 0xFD, 0x08, 0xFE, 0x04, 0x05, 0x07, 0xFB, 0x00, 0xF9, 0x04, 0x01, 0xFB, 0xFA, 0xFE,
+0x01, 0xF9, 0x04, 0x03, 0x01, 0xF8, 0x03, 0x08, 0xFB, 0xF2, 0xFE, 0xFF, 0x02, 0x00, 0x03, 0xFB,
+0x06, 0x06, 0xFF, 0x02, 0xF8, 0x08, 0x08, 0x02, 0x01, 0xFB, 0xFE, 0x04, 0x04, 0x06, 0xF7, 0xFC,
+0x07, 0xF9, 0x02, 0x05, 0x01, 0xF6, 0x0A, 0x09, 0xFB, 0x03, 0xFD, 0xF9, 0x08, 0x06, 0x0A, 0xF1,
+0x05, 0x01, 0x01, 0x02, 0xFC, 0x02, 0x00, 0x01, 0xF7, 0x05, 0xF6, 0x03, 0x08, 0xFB, 0xFB, 0x00,
+0xFE, 0xF6, 0x04, 0x07, 0x08, 0xF9, 0x08, 0x09, 0x00, 0x03, 0xFB, 0xFF, 0x08, 0xFD, 0x0B, 0xF3,
+0x04, 0x0A, 0xF8, 0x03, 0x00, 0x02, 0x09, 0x05, 0xFD, 0xFE, 0xF7, 0x03, 0x06, 0x04, 0xFC, 0xFA,
+0x07, 0xFB, 0xFF, 0x06, 0x03, 0xFD, 0x09, 0x01, 0xFA, 0x03, 0xFC, 0xF8, 0x0B, 0xFC, 0x09, 0xFC,
+0x05, 0x01, 0xF9, 0x04, 0xFC, 0x05, 0x06, 0x06, 0xFA, 0x07, 0xFC, 0x04, 0x03, 0xFD, 0xF8, 0xFE,
+0x04, 0xF8, 0x04, 0x06, 0x07, 0xFB, 0x02, 0x07, 0xFA, 0x03, 0xFA, 0xF9, 0x03, 0xFE, 0x03, 0xEF,
+0x04, 0x04, 0xFF, 0x02, 0xFB, 0x08, 0x07, 0x08, 0xFE, 0x04, 0xFA, 0x05, 0x02, 0xFA, 0xF9, 0xFC,
+0x02, 0xFB, 0x08, 0x02, 0x06, 0xFA, 0x02, 0x05, 0xFB, 0x01, 0xFA, 0xFC, 0x07, 0xFF, 0x04, 0xF6,
+0x05, 0x01, 0xFC, 0x01, 0xFB, 0x07, 0x05, 0x09, 0xF8, 0x06, 0xFB, 0x08, 0x04, 0xF8, 0xFD, 0xFB,
+0x01, 0xFB, 0x03, 0x03, 0x01, 0xFC, 0x00, 0x09, 0xFB, 0x02, 0xFA, 0xFD, 0x09, 0xFF, 0x07, 0xF6,
+0x05, 0x07, 0xFC, 0x03, 0xFD, 0x08, 0x06, 0x05, 0xFD, 0x05, 0xFB, 0x03, 0x09, 0xFD, 0xFE, 0xF9,
+0x03, 0xFB, 0x08, 0x06, 0x02, 0xFB, 0x01, 0x05, 0xFC, 0x02, 0xFA, 0xF9, 0x08, 0xFF, 0x06, 0xF2,
+0x01, 0x04, 0xFE, 0x06, 0xFF, 0x04, 0x05, 0x05, 0xFF, 0x02, 0xF5, 0x01, 0x0B, 0xF8, 0xFA, 0xFB,
+0x06, 0xF9, 0x01, 0x06, 0x05, 0xFC, 0x05, 0x02, 0x02, 0x03, 0xF6, 0xF8, 0x08, 0xFE, 0x0A, 0xF9,
+0x02, 0x0A, 0xF9, 0x09, 0xFC, 0x0A, 0x03, 0x08, 0xFE, 0xFA, 0xF9, 0x01, 0x05, 0xFD, 0xFD, 0xFA,
+0x01, 0xF6, 0x00, 0x05, 0x01, 0xF5, 0x03, 0x02, 0xF9, 0x02, 0xF6, 0xF9, 0x03, 0xFD, 0x03, 0xF4,
+0x06, 0x0A, 0xFF, 0x06, 0xF9, 0x05, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x03, 0xFB, 0xFD, 0xF5,
+0x04, 0xFC, 0x03, 0x07, 0x09, 0xFF, 0x07, 0x05, 0xFC, 0x03, 0xFC, 0xFA, 0x04, 0xFD, 0x0A, 0xF3,
+0x06, 0x04, 0xFF, 0x01, 0xFB, 0x07, 0x04, 0x08, 0xF9, 0x06, 0xFF, 0x09, 0x06, 0xFF, 0xFF, 0xF9,
+0x07, 0x00, 0x02, 0x03, 0x08, 0xFA, 0x04, 0x03, 0xF8, 0x03, 0xFB, 0xFB, 0x06, 0xFE, 0x08, 0xF4,
+0x05, 0x09, 0xF7, 0x04, 0xFF, 0x05, 0x01, 0x07, 0xFE, 0xFC, 0xF8, 0x01, 0x00, 0xFE, 0xF8, 0xFC,
+0x06, 0xF6, 0x04, 0x08, 0x0B, 0xF5, 0x04, 0x08, 0xFD, 0x03, 0xFC, 0xF9, 0xFF, 0x02, 0x04, 0xF6,
+0x03, 0x03, 0xFE, 0x06, 0xFC, 0x04, 0x06, 0x08, 0xFD, 0x05, 0xFD, 0x04, 0x01, 0xFD, 0xF7, 0x01,
+0x06, 0xFC, 0x06, 0x04, 0x07, 0xFB, 0x05, 0x03, 0xFA, 0x02, 0xF9, 0xFD, 0x03, 0xFD, 0x08, 0xF3,
+0x02, 0x04, 0xFC, 0x06, 0xFB, 0x04, 0x04, 0x08, 0xFF, 0x04, 0xF6, 0x05, 0x05, 0xF8, 0xFF, 0xF8,
+0x03, 0xFB, 0x05, 0x06, 0x04, 0xFB, 0x02, 0x03, 0xFB, 0x02, 0xFC, 0xFA, 0x02, 0x00, 0x04, 0xEB,
+0x04, 0x01, 0xFD, 0x07, 0xFB, 0x08, 0x07, 0x06, 0xFF, 0x03, 0xF9, 0x01, 0x03, 0xFC, 0xF9, 0xFA,
+0x02, 0xFC, 0x08, 0x04, 0x06, 0x00, 0x08, 0x04, 0xFB, 0x03, 0xFE, 0xFC, 0x05, 0xFE, 0x08, 0xF8,
+0x02, 0x07, 0xFA, 0x07, 0xFA, 0x04, 0x03, 0x03, 0xFE, 0x07, 0xF9, 0x04, 0x06, 0xFB, 0xFB, 0xFD,
+0x05, 0xFE, 0x06, 0x07, 0x02, 0xFC, 0x03, 0x04, 0xFE, 0x02, 0xF9, 0xFA, 0x08, 0xFD, 0x05, 0xF6,
+0x08, 0x08, 0xFE, 0x01, 0xFA, 0x0B, 0x01, 0xFF, 0xFA, 0x02, 0xFE, 0xFF, 0x08, 0x05, 0xF6, 0xF9,
+0x09, 0x00, 0x07, 0x06, 0x05, 0xFC, 0x01, 0x05, 0xF8, 0x02, 0xF8, 0x01, 0x0C, 0xFD, 0x04, 0xF7,
+0x07, 0x08, 0xFC, 0x00, 0xFD, 0x08, 0x08, 0x07, 0xFC, 0xFE, 0xF9, 0x01, 0x01, 0xFA, 0xFC, 0xFB,
+0xFD, 0xF8, 0x02, 0x08, 0x08, 0xF8, 0x02, 0x08, 0xFD, 0x03, 0xFF, 0xFD, 0x07, 0x00, 0x01, 0xF8,
+0x03, 0xFF, 0xFC, 0xFF, 0xFE, 0x08, 0x0C, 0x0A, 0xFA, 0x06, 0xFB, 0x07, 0x00, 0xFC, 0xFF, 0xFA,
+0xFE, 0xFD, 0x09, 0x01, 0x09, 0xFC, 0x04, 0x02, 0xFB, 0x02, 0x00, 0xFA, 0x02, 0xFB, 0x07, 0xF5,
+0x03, 0x05, 0xFD, 0x04, 0xFD, 0x03, 0x07, 0x07, 0xFB, 0x07, 0xF8, 0xFF, 0x04, 0xFD, 0x00, 0x00,
+0x03, 0xFC, 0x0A, 0x0A, 0xFF, 0xF7, 0x05, 0x09, 0xFD, 0x02, 0xFC, 0xF5, 0x05, 0x00, 0x07, 0xF7,
+0x02, 0x07, 0xFC, 0x08, 0xFF, 0x04, 0x02, 0x05, 0x00, 0x04, 0xFE, 0x08, 0x08, 0xFD, 0xF7, 0xFD,
+0x05, 0xFD, 0x00, 0x06, 0x05, 0xFE, 0x09, 0x04, 0xFF, 0x03, 0xFD, 0xFC, 0x09, 0xFC, 0x03, 0xF9,
+0x05, 0x05, 0xFB, 0x05, 0xFB, 0x06, 0x00, 0x00, 0xFC, 0x04, 0xF9, 0x03, 0x04, 0xFA, 0xFA, 0xFE,
+0x03, 0xFE, 0x07, 0x04, 0x02, 0xFB, 0x02, 0x08, 0xF9, 0x02, 0xFD, 0xFE, 0x05, 0xFE, 0x03, 0xF7,
+0x03, 0x06, 0xFB, 0x04, 0xFF, 0x03, 0x03, 0x01, 0xF9, 0x06, 0xF7, 0x02, 0x07, 0xFC, 0xF8, 0xF9,
+0x02, 0xFF, 0x06, 0x05, 0x00, 0xFE, 0x0A, 0x06, 0xFD, 0x02, 0xFB, 0xFA, 0x03, 0xFE, 0x09, 0xFD,
+0x00, 0x05, 0xFA, 0x09, 0xFA, 0x01, 0x00, 0xFF, 0xFD, 0x04, 0xFF, 0x01, 0x0B, 0xF9, 0xFE, 0xF6,
+0x0A, 0xFD, 0x05, 0x07, 0x06, 0xFD, 0x02, 0x06, 0xFB, 0x02, 0xFD, 0xFE, 0x07, 0xFA, 0x03, 0xF5,
+0x03, 0x05, 0xFA, 0xFF, 0xFC, 0x05, 0x05, 0x07, 0xFF, 0xFE, 0xF8, 0x06, 0x0B, 0xFE, 0xF6, 0xF9,
+0x04, 0xFF, 0x01, 0x02, 0x04, 0xF9, 0x06, 0xFF, 0x00, 0x03, 0xFC, 0xFC, 0x09, 0xF8, 0x04, 0xF3,
+0x08, 0x06, 0xFD, 0x00, 0xFC, 0x07, 0x05, 0x07, 0x00, 0x04, 0xFB, 0x06, 0x00, 0xFB, 0xFB, 0xF6,
+0x01, 0xFD, 0x08, 0x05, 0xFC, 0x03, 0x05, 0x06, 0x01, 0x03, 0xFB, 0xF9, 0x04, 0xFD, 0x05, 0xF2,
+0x01, 0x07, 0xF9, 0x07, 0xFA, 0x05, 0x04, 0x05, 0x00, 0x05, 0xFE, 0x03, 0x03, 0xFD, 0xF9, 0x00,
+0xFE, 0xF7, 0x07, 0x07, 0x09, 0xF8, 0x05, 0x0A, 0xF9, 0x03, 0xFD, 0xFD, 0x01, 0x03, 0x05, 0xF2,
+0x08, 0x03, 0xF7, 0x0A, 0xFB, 0x07, 0x09, 0x04, 0x00, 0xFF, 0xFC, 0x01, 0x03, 0x00, 0xFD, 0xF9,
+0x02, 0xFC, 0x08, 0x02, 0x06, 0xF9, 0x05, 0x02, 0xFB, 0x03, 0xF9, 0xFC, 0x0C, 0xFC, 0x03, 0xEF,
+0x04, 0x02, 0xFA, 0x01, 0xFA, 0x07, 0x05, 0x02, 0xFC, 0x0B, 0xF8, 0x03, 0x06, 0xFB, 0xF6, 0x00,
+0x02, 0xFE, 0x01, 0x01, 0x07, 0xFB, 0x06, 0x07, 0xF9, 0x04, 0x00, 0xF9, 0x04, 0xFE, 0x07, 0xF2,
+0x04, 0x03, 0xF5, 0x06, 0xFD, 0x09, 0x02, 0x09, 0x00, 0xFD, 0xFB, 0x06, 0x0A, 0x01, 0x00, 0xFE,
+0x0A, 0xFA, 0x07, 0x06, 0x07, 0xFF, 0x03, 0x08, 0xFA, 0x02, 0xFF, 0xFA, 0x05, 0xFA, 0x02, 0xF7,
+0x04, 0x07, 0x01, 0x05, 0xF9, 0x01, 0x02, 0x09, 0xFE, 0xFD, 0xF5, 0x06, 0x04, 0xFD, 0xFB, 0xFA,
+0x06, 0xF7, 0x00, 0x06, 0x09, 0xFC, 0x0A, 0x06, 0xFA, 0x01, 0xFF, 0xFB, 0x01, 0xFF, 0x04, 0xF4,
+0x00, 0x05, 0xFA, 0x07, 0xFD, 0x0A, 0x03, 0x05, 0x00, 0xFF, 0xFA, 0x02, 0x01, 0x02, 0xF9, 0xFC,
+0x08, 0xFE, 0x07, 0x08, 0x0A, 0xFB, 0x03, 0x09, 0xFE, 0x02, 0xFE, 0xFC, 0x09, 0xFB, 0x07, 0xF4,
+0x02, 0x01, 0xF9, 0x04, 0xF7, 0x06, 0x00, 0x02, 0x00, 0x07, 0xFD, 0x06, 0x03, 0xFD, 0xFB, 0xFD,
+0x01, 0xFA, 0x00, 0x01, 0x00, 0xF9, 0x09, 0x05, 0xFD, 0x02, 0xFD, 0xFD, 0x05, 0xFB, 0x04, 0xF5,
+0x01, 0x07, 0xFA, 0x03, 0xF8, 0x0E, 0x03, 0x08, 0x04, 0x08, 0xFC, 0x04, 0x0A, 0xFC, 0xFB, 0xFA,
+0xFF, 0xFD, 0x01, 0x0A, 0x02, 0xF9, 0x03, 0x03, 0xFD, 0x03, 0xF9, 0xFE, 0x04, 0xF9, 0x08, 0xF6,
+0x01, 0x05, 0xFE, 0x03, 0xF7, 0x01, 0x04, 0x05, 0xFD, 0x06, 0xFB, 0x01, 0x03, 0xFC, 0xFB, 0xFF,
+0x08, 0xFF, 0x01, 0x06, 0x09, 0xF9, 0x07, 0x05, 0xFC, 0x04, 0xFB, 0xFE, 0x0A, 0xFE, 0x0A, 0xF8,
+0x06, 0x09, 0xFF, 0x03, 0xFC, 0x07, 0x04, 0x03, 0xFB, 0xFB, 0xF9, 0x04, 0x04, 0xFE, 0xFD, 0xFE,
+0x00, 0xF9, 0x05, 0x07, 0x06, 0xFB, 0x0C, 0x02, 0x01, 0x03, 0xFD, 0xF8, 0x05, 0xF9, 0x0A, 0xF6,
+0x00, 0x0A, 0xFC, 0x04, 0xFE, 0x09, 0x0C, 0x04, 0x00, 0xFA, 0xFD, 0xFF, 0x0B, 0xFC, 0xFB, 0xFD,
+0x0A, 0xFC, 0x07, 0x02, 0x07, 0xF7, 0x02, 0x08, 0x01, 0x02, 0xF8, 0xF6, 0x01, 0xFC, 0x09, 0xF4,
+0x01, 0x05, 0xFD, 0x05, 0xFD, 0x02, 0x00, 0x05, 0xFA, 0x00, 0xFC, 0x08, 0x02, 0xFA, 0xFB, 0xF4,
+0x09, 0xFA, 0x01, 0x00, 0x01, 0xFE, 0x06, 0x04, 0xFB, 0x00, 0xF9, 0xFD, 0x10, 0xF5, 0x07, 0xF2,
+0x03, 0x01, 0xFC, 0x00, 0xFF, 0x05, 0x05, 0x09, 0xFB, 0x04, 0xFB, 0x03, 0x07, 0x05, 0x01, 0xFE,
+0x07, 0x01, 0x08, 0x07, 0x01, 0xFF, 0x04, 0x07, 0xF8, 0x01, 0xFD, 0xFA, 0x08, 0xF7, 0x0B, 0xF7,
+0x05, 0x05, 0xF9, 0x0A, 0xF8, 0x09, 0x0A, 0x06, 0xFF, 0x00, 0xFE, 0x07, 0x09, 0xF9, 0xFD, 0xFA,
+0x08, 0x00, 0x0A, 0x00, 0x00, 0xF8, 0x05, 0x01, 0xFF, 0x03, 0xFF, 0xFB, 0xFB, 0xFE, 0x05, 0xFC,
+0x03, 0x0C, 0xF2, 0x03, 0xFA, 0x05, 0x07, 0x07, 0xFE, 0x00, 0xFE, 0x02, 0x05, 0xFF, 0xF5, 0xFF,
+0x04, 0xFD, 0x04, 0x08, 0x02, 0xFA, 0x02, 0x05, 0xFF, 0x03, 0xFE, 0xF7, 0x04, 0xF7, 0x06, 0xF7,
+0x07, 0x07, 0xFC, 0x08, 0xFB, 0x07, 0x03, 0xFC, 0xFD, 0x06, 0xFB, 0x05, 0x06, 0xFE, 0xFA, 0xFA,
+0x04, 0xFE, 0x02, 0x07, 0x07, 0x02, 0x01, 0xFD, 0xFD, 0x02, 0xFC, 0xF8, 0x06, 0x00, 0x03, 0xF8,
+0x00, 0x06, 0xF8, 0x05, 0xF8, 0x05, 0x06, 0x03, 0x00, 0x03, 0xF8, 0x04, 0x05, 0x02, 0xFB, 0xF9,
+0x03, 0xFC, 0x02, 0x02, 0x01, 0xFA, 0x06, 0x03, 0xFA, 0x02, 0xFB, 0xFD, 0x06, 0xFE, 0x09, 0xF6,
+0xFC, 0x05, 0xFB, 0x04, 0x02, 0x0A, 0x07, 0x0C, 0x01, 0x00, 0xF6, 0x0A, 0xFF, 0xFE, 0xFC, 0xFB,
+0x01, 0xFB, 0x07, 0x03, 0x09, 0xFC, 0x03, 0x03, 0xFF, 0x02, 0xFD, 0xF8, 0x01, 0xFD, 0x00, 0xF8,
+0x01, 0xFF, 0xF8, 0xFF, 0xFC, 0x09, 0x09, 0x02, 0xF9, 0x02, 0xF7, 0x03, 0x02, 0xFF, 0xF7, 0xF5,
+0x02, 0xFB, 0x06, 0x00, 0x06, 0xFF, 0x03, 0x0B, 0x01, 0x03, 0xFD, 0xFC, 0x06, 0xFF, 0x00, 0xF5,
+0x06, 0x0A, 0xF8, 0x02, 0xFC, 0x03, 0x00, 0x0C, 0x00, 0x06, 0xFE, 0x05, 0x04, 0x01, 0xF9, 0xFC,
+0x00, 0xF8, 0x02, 0x04, 0x04, 0xF7, 0x00, 0xFF, 0xF8, 0x03, 0xFC, 0xFE, 0x00, 0x00, 0x06, 0xF5,
+0xFD, 0x02, 0xF5, 0x03, 0xFA, 0x04, 0x07, 0x08, 0xFF, 0x01, 0xFC, 0x04, 0x05, 0xFB, 0xF9, 0xFC,
+0x06, 0xF7, 0x08, 0x05, 0x02, 0x02, 0xFE, 0x07, 0xFB, 0x04, 0x01, 0xFA, 0x02, 0xFD, 0x00, 0xF9,
+0x05, 0x08, 0xF8, 0x02, 0xF9, 0x05, 0x04, 0x01, 0xFE, 0xFE, 0xFE, 0x01, 0x04, 0x00, 0xF7, 0xF6,
+0x07, 0xFA, 0x06, 0x03, 0x08, 0xF9, 0x04, 0x03, 0xFD, 0x02, 0xFD, 0xFD, 0x04, 0xFC, 0x02, 0xF2,
+0x09, 0x01, 0x03, 0x01, 0xFD, 0x01, 0x03, 0x02, 0xF9, 0x09, 0xF9, 0x06, 0x03, 0x03, 0xFF, 0xF2,
+0x06, 0x00, 0x06, 0xFD, 0xFC, 0xFA, 0x04, 0x09, 0x00, 0xFD, 0x01, 0xFB, 0x0C, 0xFB, 0x07, 0xEB,
+0x09, 0xFE, 0xFD, 0x02, 0xFE, 0x07, 0x08, 0x02, 0xFA, 0x00, 0xFD, 0x04, 0x0A, 0xFC, 0x02, 0xFF,
+0xFE, 0xF9, 0xFD, 0x07, 0x04, 0xFC, 0x08, 0x06, 0xFA, 0x03, 0xFA, 0xFA, 0x05, 0x04, 0x02, 0xF3,
+0x06, 0x05, 0xFE, 0x02, 0xF7, 0x02, 0x05, 0x03, 0xFA, 0xFF, 0xFC, 0x05, 0x03, 0xFE, 0xF7, 0xF6,
+0x06, 0xF9, 0x0D, 0x04, 0x00, 0xFF, 0x05, 0x04, 0xFF, 0x03, 0xFE, 0xFC, 0x09, 0xF6, 0x01, 0xF4,
+0x04, 0x02, 0xF5, 0x01, 0xFA, 0x09, 0xFF, 0x05, 0xFA, 0xFC, 0xF6, 0x05, 0x00, 0x01, 0xF9, 0xF9,
+0xFF, 0xFD, 0x06, 0x04, 0x03, 0xF9, 0x09, 0x06, 0xFE, 0x03, 0x00, 0xFB, 0x00, 0xFA, 0x0A, 0xF2,
+0x07, 0x03, 0xF6, 0x07, 0xFA, 0x06, 0x03, 0x09, 0x02, 0xFC, 0xFA, 0x04, 0x03, 0xFE, 0xF9, 0xFC,
+0x02, 0xFF, 0x08, 0x03, 0x04, 0xF8, 0x04, 0x06, 0xFB, 0x02, 0xFD, 0xFC, 0x03, 0xFC, 0x06, 0xF5,
+0x02, 0x03, 0x00, 0x02, 0xFD, 0x07, 0x05, 0x04, 0x00, 0x03, 0xF7, 0x04, 0x05, 0xFD, 0xFE, 0xF9,
+0x08, 0xFB, 0x07, 0x05, 0x06, 0xFB, 0x04, 0x06, 0xFA, 0x02, 0xFF, 0xF9, 0x03, 0xFF, 0x04, 0xF6,
+0x03, 0x0C, 0xFE, 0x04, 0xFD, 0x0B, 0x02, 0x00, 0xF9, 0x01, 0xFD, 0x01, 0x0C, 0xFF, 0xFF, 0x00,
+0xFF, 0xFB, 0x01, 0x09, 0x02, 0xFA, 0x05, 0x05, 0xFC, 0x02, 0xF7, 0x01, 0x09, 0xFE, 0x08, 0xFA,
+0x0B, 0x03, 0x01, 0x07, 0xFA, 0x02, 0x07, 0x09, 0xF8, 0x0A, 0xFE, 0xFD, 0x0B, 0x05, 0xFE, 0xFE,
+0x05, 0xFF, 0x02, 0x09, 0x06, 0xFF, 0x0B, 0x06, 0xFA, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x07, 0xF1,
+0x01, 0x02, 0xFF, 0x01, 0x02, 0x00, 0x0B, 0x07, 0xFD, 0xF8, 0xF6, 0x02, 0x03, 0xFD, 0x00, 0xF8,
+0x00, 0xFE, 0xFD, 0x00, 0x0C, 0xF5, 0xFF, 0x04, 0xFF, 0x03, 0xF5, 0xFE, 0x0B, 0xFA, 0x0A, 0xF3,
+0x04, 0x06, 0xF6, 0x07, 0xFF, 0x01, 0x06, 0x04, 0xFF, 0x03, 0xFA, 0x02, 0x0B, 0x05, 0xFC, 0xFF,
+0x08, 0xFD, 0x03, 0x03, 0x06, 0xFB, 0x03, 0x03, 0xFC, 0x02, 0xF5, 0xFD, 0x06, 0xFB, 0x0C, 0xEE,
+0x06, 0x01, 0xFB, 0x07, 0xFC, 0x05, 0x08, 0x02, 0xFE, 0x0B, 0xF8, 0x01, 0x01, 0x01, 0xF6, 0xF5,
+0x08, 0xFD, 0xFF, 0x05, 0x03, 0xFF, 0x0A, 0x02, 0xFD, 0x02, 0xFC, 0xFB, 0x06, 0x02, 0x07, 0xF2,
+0x03, 0x09, 0xFD, 0x06, 0xFE, 0x04, 0x04, 0x02, 0x00, 0x02, 0xFC, 0x03, 0x04, 0xFB, 0xFF, 0xF5,
+0x05, 0xF7, 0x02, 0x06, 0x07, 0xFC, 0x01, 0x06, 0xF8, 0x02, 0xF9, 0xFA, 0x08, 0xFF, 0x08, 0xF0,
+0x06, 0x03, 0xF7, 0x08, 0xFA, 0x04, 0x07, 0x06, 0xFE, 0x02, 0xF8, 0xFD, 0x09, 0xFB, 0xFE, 0xF6,
+0x04, 0xFB, 0x01, 0x07, 0x00, 0xF7, 0x08, 0x06, 0xFA, 0x02, 0xFA, 0xFA, 0x02, 0xFE, 0x00, 0xF8,
+0x00, 0x02, 0xFE, 0x06, 0xFA, 0x08, 0x07, 0x01, 0xFC, 0x05, 0xFA, 0x06, 0x08, 0xFB, 0xFE, 0xF5,
+0x04, 0xFC, 0x06, 0x04, 0x01, 0xFA, 0x02, 0x09, 0xFD, 0x01, 0xFB, 0xFD, 0x08, 0xFD, 0x0A, 0xF6,
+0x06, 0x02, 0xFD, 0x02, 0xFB, 0x06, 0x09, 0x08, 0xFF, 0x00, 0xFA, 0x04, 0x07, 0xF9, 0xFE, 0xF9,
+0x03, 0xFB, 0x03, 0x05, 0x05, 0xF9, 0x02, 0x09, 0xF7, 0x02, 0xFB, 0xFB, 0x03, 0x01, 0x06, 0xF6,
+0x06, 0x08, 0xFC, 0x08, 0xF9, 0x04, 0x07, 0x06, 0x03, 0xFA, 0xF7, 0x02, 0x07, 0x06, 0xF8, 0xFB,
+0x01, 0xF8, 0x07, 0x04, 0x08, 0xFC, 0x01, 0x0B, 0xFA, 0x03, 0xFE, 0xFD, 0x04, 0xFB, 0x03, 0xF6,
+0x00, 0x07, 0xF9, 0x02, 0xF9, 0x02, 0x08, 0x09, 0xFB, 0x02, 0xFC, 0xFE, 0x06, 0xFD, 0xFE, 0xF8,
+0x07, 0xF9, 0x0A, 0x06, 0x02, 0x00, 0x05, 0x02, 0x01, 0x02, 0xF6, 0xFC, 0x09, 0xFC, 0x05, 0xF0,
+0x0C, 0x03, 0xF7, 0x02, 0x00, 0x06, 0x04, 0x05, 0xFD, 0x01, 0xFF, 0x01, 0x02, 0xF8, 0xFB, 0xFD,
+0x02, 0xFC, 0x09, 0x05, 0x07, 0xF9, 0x00, 0x04, 0xF9, 0x03, 0xFC, 0x02, 0x0B, 0xFF, 0x04, 0xF1,
+0xFD, 0x00, 0xF6, 0x08, 0xFA, 0x04, 0x01, 0x0C, 0xFA, 0x04, 0xF6, 0x04, 0x01, 0xFF, 0xFF, 0xF8,
+0x08, 0xFD, 0x00, 0x04, 0x00, 0xFE, 0x07, 0x04, 0x01, 0x02, 0xF7, 0xF6, 0x00, 0xFB, 0x0A, 0xFD,
+0x01, 0x06, 0xFB, 0x02, 0xFC, 0x03, 0x04, 0x05, 0xFD, 0x02, 0xFB, 0x03, 0x08, 0xFC, 0xFC, 0xF5,
+0x05, 0xFB, 0x04, 0x04, 0x08, 0xFB, 0x03, 0x05, 0xFC, 0x02, 0xFB, 0xFC, 0x05, 0xFC, 0x07, 0xF5,
+0x05, 0x08, 0xFA, 0x08, 0xFC, 0x04, 0x05, 0x05, 0xFB, 0x04, 0xF6, 0x08, 0x06, 0xFE, 0xFD, 0xFC,
+0x07, 0xFE, 0x06, 0x07, 0x04, 0xFE, 0x04, 0x04, 0xFF, 0x02, 0xFB, 0xFC, 0x04, 0xFE, 0x07, 0xEC,
+0x02, 0x02, 0xF7, 0x07, 0xFB, 0x04, 0x05, 0x04, 0xFF, 0x05, 0xF9, 0x05, 0x05, 0xFC, 0xF8, 0xFC,
+0x02, 0xFA, 0x02, 0x05, 0x07, 0xF7, 0x04, 0x06, 0xFA, 0x02, 0xFC, 0xFD, 0x03, 0xFD, 0x05, 0xF3,
+0x00, 0x03, 0xFD, 0x0A, 0xFC, 0x06, 0x03, 0x03, 0xFC, 0x01, 0xF8, 0xFF, 0x0A, 0xFD, 0xFB, 0xFB,
+0x05, 0xF9, 0x06, 0x05, 0x03, 0xFD, 0x01, 0x08, 0xFB, 0x02, 0xFC, 0xFD, 0x09, 0xFD, 0x09, 0xF4,
+0x06, 0x02, 0xFC, 0x02, 0xF8, 0x03, 0x09, 0x01, 0xF7, 0x02, 0xF4, 0x03, 0x03, 0x01, 0xFC, 0xF4,
+0x02, 0xF9, 0x01, 0x03, 0x03, 0x00, 0x0A, 0x02, 0xFA, 0x02, 0xFD, 0xFC, 0x06, 0xFE, 0x09, 0xEA,
+0x08, 0x03, 0xF9, 0x02, 0xFF, 0x05, 0x04, 0xFF, 0xFA, 0x00, 0xF8, 0x04, 0x05, 0xFD, 0x00, 0xFF,
+0x00, 0xF8, 0x09, 0x02, 0x08, 0xF9, 0x07, 0x04, 0x00, 0x02, 0xF8, 0xF9, 0x08, 0x02, 0x08, 0xF7,
+0x00, 0x03, 0xF9, 0x09, 0xFA, 0xFE, 0x06, 0x05, 0x01, 0x02, 0xF6, 0x03, 0x03, 0xFF, 0xF4, 0x01,
+0xFB, 0xF5, 0x01, 0x06, 0x08, 0xFD, 0x08, 0x08, 0x01, 0x01, 0xFB, 0x04, 0x08, 0x04, 0x03, 0xFA,
+0x03, 0x0A, 0xF7, 0x08, 0xFA, 0x05, 0x04, 0x01, 0xF9, 0x00, 0x01, 0x04, 0x02, 0xFA, 0x04, 0xFC,
+0x08, 0x00, 0x01, 0x03, 0x0A, 0xFF, 0x00, 0x07, 0xFD, 0x02, 0xFA, 0xF8, 0x0A, 0xFA, 0x09, 0xF2,
+0x07, 0x07, 0xFE, 0x03, 0xFF, 0x09, 0x02, 0x08, 0xFA, 0x07, 0xF5, 0x06, 0x06, 0xFA, 0xF8, 0xFA,
+0x02, 0xF8, 0x07, 0x01, 0x02, 0xFF, 0x07, 0x06, 0xFF, 0x02, 0xFF, 0xFE, 0x04, 0x00, 0x02, 0xF8,
+0x09, 0x08, 0xFA, 0x06, 0xFB, 0x05, 0x05, 0x06, 0xFC, 0x06, 0xFC, 0x02, 0x03, 0xF9, 0xF9, 0xFC,
+0x06, 0xFC, 0x01, 0x05, 0x02, 0xFD, 0x08, 0x03, 0xFB, 0x02, 0xFD, 0xF9, 0x04, 0xFD, 0x06, 0xEF,
+0x02, 0x03, 0xFC, 0x05, 0xF9, 0x06, 0x04, 0x0B, 0xFD, 0x00, 0xF9, 0x03, 0x07, 0xFC, 0xFA, 0xFB,
+0x02, 0xF9, 0x04, 0x04, 0x08, 0xFC, 0x07, 0x07, 0xF9, 0x00, 0xFD, 0xFC, 0x04, 0x01, 0x08, 0xE4,
+0xFF, 0x04, 0xFD, 0x06, 0xFC, 0x05, 0x04, 0x04, 0xFB, 0x05, 0xFC, 0x09, 0x08, 0xFB, 0xF9, 0xFF,
+0x00, 0xF9, 0x05, 0x05, 0x08, 0xFB, 0x05, 0x05, 0xFD, 0x02, 0xFA, 0xFB, 0x06, 0x03, 0x0A, 0xFB,
+0x01, 0x01, 0xFB, 0x05, 0xFA, 0x02, 0x04, 0x02, 0xF9, 0x06, 0xFF, 0x02, 0x05, 0xFE, 0xFC, 0xF8,
+0x07, 0xFB, 0x08, 0x05, 0x07, 0xFB, 0x01, 0x02, 0xFB, 0x01, 0xFD, 0xFB, 0x04, 0xF9, 0x0B, 0xEB,
+0x04, 0x04, 0xF4, 0x08, 0xFD, 0x07, 0x03, 0x07, 0xFD, 0xFE, 0xFB, 0x08, 0x01, 0xFF, 0x00, 0xFC,
+0x09, 0xFC, 0x01, 0x02, 0x0A, 0xFB, 0x02, 0x02, 0x01, 0x01, 0xF8, 0xFD, 0x03, 0x01, 0x01, 0xF6,
+0x0B, 0x05, 0x02, 0x07, 0xF3, 0x02, 0x02, 0x05, 0xFE, 0x03, 0xF9, 0xFF, 0x03, 0xFF, 0xFE, 0x01,
+0x09, 0xFF, 0x07, 0x02, 0x07, 0xFA, 0x06, 0x02, 0xFC, 0xFD, 0xFD, 0xFB, 0x02, 0x01, 0x09, 0xF4,
+0x05, 0x02, 0xFA, 0x0A, 0xF8, 0x08, 0x08, 0x08, 0xFF, 0x05, 0xFA, 0x02, 0x06, 0xF8, 0xFC, 0xFC,
+0x03, 0xFD, 0x03, 0xFE, 0x02, 0xF9, 0x08, 0x01, 0xFE, 0x02, 0xF9, 0xFF, 0x06, 0x01, 0x01, 0xFA,
+0x02, 0x06, 0xF8, 0x06, 0xFB, 0x06, 0x04, 0x07, 0xFF, 0xFC, 0xF7, 0x02, 0x02, 0x03, 0xF8, 0xF9,
+0x08, 0xF8, 0x02, 0x05, 0x08, 0xFA, 0x03, 0x06, 0xFD, 0x02, 0xFC, 0xFF, 0x03, 0xFD, 0x04, 0xF8,
+0x06, 0x05, 0xFA, 0x05, 0xF8, 0x02, 0x04, 0x07, 0xF6, 0x01, 0x01, 0x06, 0x0B, 0xFB, 0xFF, 0xFA,
+0x06, 0xF8, 0xFF, 0x08, 0x03, 0xFE, 0x01, 0x02, 0xFD, 0xFF, 0xF6, 0xF8, 0x07, 0xFD, 0x01, 0xF7,
+0x06, 0x08, 0xFA, 0xFF, 0xFB, 0x06, 0x08, 0x02, 0xFC, 0x04, 0xFC, 0x03, 0x07, 0xFA, 0xFC, 0xF7,
+0x03, 0x00, 0x03, 0x05, 0x04, 0xF8, 0x06, 0x09, 0xFA, 0x02, 0x02, 0xFA, 0x04, 0xFF, 0x07, 0xF0,
+0x06, 0x06, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x06, 0xFB, 0x05, 0xF9, 0x00, 0xFF, 0xF6, 0xF6, 0x00,
+0x0C, 0x02, 0x07, 0xFF, 0xFF, 0xFC, 0x03, 0x02, 0xFC, 0x01, 0xF7, 0xF8, 0x0A, 0xFA, 0x08, 0xF4,
+0x07, 0x05, 0xFC, 0x06, 0xFC, 0x02, 0x05, 0x06, 0xF6, 0xFA, 0xFE, 0x01, 0x04, 0x00, 0xF9, 0x00,
+0x05, 0xF7, 0x05, 0x05, 0x0B, 0xF9, 0x04, 0x0A, 0x00, 0x02, 0xF9, 0x02, 0x06, 0xFF, 0x05, 0xF8,
+0xFF, 0x02, 0xFF, 0x04, 0xFF, 0x07, 0x00, 0x07, 0xFB, 0x05, 0xFB, 0x08, 0x02, 0xFB, 0xF6, 0xF9,
+0x07, 0xFF, 0x00, 0x08, 0x0B, 0xFA, 0x09, 0x05, 0xFD, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0x04, 0xF0,
+0x02, 0x0A, 0xFF, 0x04, 0x00, 0x06, 0x01, 0x07, 0xFE, 0x04, 0xFC, 0x03, 0x06, 0xF9, 0x00, 0xFA,
+0x06, 0xF9, 0x03, 0x06, 0x03, 0xFD, 0x08, 0x01, 0x01, 0x01, 0xFB, 0xF9, 0x03, 0xFF, 0x06, 0xFF,
+0x08, 0x06, 0xFA, 0x00, 0xFE, 0x07, 0x08, 0x0C, 0xFF, 0x01, 0x00, 0x05, 0x04, 0xF8, 0xFC, 0xF9,
+0x08, 0xFC, 0x07, 0x02, 0x01, 0xF7, 0x03, 0x04, 0xFC, 0x00, 0xFC, 0xFA, 0x03, 0xFF, 0x00, 0xFA,
+0x03, 0x09, 0xFE, 0x07, 0xFB, 0x06, 0x04, 0x04, 0xF7, 0xFE, 0xFA, 0x02, 0x08, 0x00, 0xF6, 0xFB,
+0xFE, 0xF6, 0x05, 0x01, 0x05, 0xFA, 0x06, 0x09, 0xFE, 0x00, 0xF7, 0xFF, 0x00, 0xFB, 0x04, 0xF7,
+0x03, 0x0B, 0xFB, 0x08, 0xFD, 0x04, 0x03, 0x07, 0xFD, 0xFB, 0xFE, 0x06, 0x09, 0x05, 0xF8, 0xFC,
+0xFF, 0xF5, 0x07, 0x04, 0x04, 0xFB, 0x05, 0x09, 0xFE, 0x01, 0x00, 0xFE, 0x09, 0xFB, 0x09, 0xF6,
+0x07, 0x04, 0xF7, 0x08, 0xFB, 0x04, 0x02, 0x02, 0xFE, 0x00, 0xF6, 0x07, 0x0A, 0x01, 0xF7, 0x00,
+0x04, 0xF9, 0x02, 0x08, 0x09, 0xF6, 0x04, 0x04, 0xFE, 0x02, 0xFA, 0xFE, 0x02, 0xFF, 0x02, 0xF4,
+0x07, 0x02, 0xFD, 0x01, 0xF6, 0x0B, 0x07, 0x07, 0xFB, 0x01, 0x00, 0x04, 0x0A, 0xFC, 0xFE, 0xF7,
+0x05, 0xFD, 0x04, 0x07, 0x02, 0xFC, 0x03, 0x07, 0xFE, 0x02, 0xFD, 0xFF, 0x09, 0xFC, 0x02, 0xF4,
+0x05, 0x01, 0xFC, 0x04, 0x00, 0x05, 0x07, 0xFD, 0xF7, 0x0C, 0x02, 0x05, 0xFF, 0xF3, 0x01, 0xF5,
+0x08, 0xF9, 0x05, 0x04, 0xFE, 0x03, 0x01, 0x03, 0xF5, 0xFA, 0xFB, 0xFC, 0x11, 0xF9, 0xFB, 0xF3,
+0x02, 0x06, 0xFD, 0x06, 0xFC, 0x09, 0x07, 0x07, 0xFE, 0x01, 0xF9, 0x00, 0x05, 0xFF, 0x01, 0x00,
+0x01, 0xFB, 0x02, 0x03, 0x03, 0xFC, 0x09, 0x05, 0xFD, 0x03, 0xFB, 0xF9, 0x02, 0xFA, 0x0A, 0xFD,
+0x04, 0xFE, 0x02, 0x02, 0xFA, 0xFD, 0x05, 0x09, 0xFF, 0x03, 0xF9, 0x02, 0x07, 0xFB, 0xF9, 0x02,
+0x06, 0xFC, 0x04, 0x00, 0x09, 0xFD, 0x04, 0x08, 0x00, 0x05, 0xF5, 0xF9, 0x05, 0xFC, 0x07, 0xFD,
+0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x05, 0x0A, 0x07, 0xFF, 0x01, 0xF8, 0x01, 0x03, 0xFE, 0x00, 0xF9,
+0x06, 0xF5, 0x07, 0x09, 0x04, 0xF6, 0x09, 0x01, 0xFA, 0x00, 0xFE, 0xFD, 0x07, 0x01, 0x09, 0xF2,
+0xFF, 0x00, 0xFA, 0x09, 0xFD, 0x00, 0x04, 0x0A, 0xFA, 0x02, 0xFF, 0xFE, 0x08, 0xFA, 0xFA, 0xFA,
+0x0B, 0xFB, 0x02, 0x09, 0x06, 0xFF, 0x03, 0xFF, 0xFE, 0x01, 0xFE, 0xF7, 0x02, 0xFE, 0x06, 0xF7,
+0x08, 0x06, 0xFB, 0x05, 0xFF, 0x04, 0x09, 0x04, 0x03, 0xFB, 0xF9, 0x05, 0x03, 0x04, 0xFC, 0xF6,
+0x08, 0xFA, 0x00, 0x09, 0x05, 0xF9, 0x0B, 0x05, 0x03, 0x01, 0xFF, 0xFB, 0x01, 0x02, 0x0A, 0xF2,
+0xFC, 0x06, 0xF8, 0x0A, 0x01, 0x08, 0xFF, 0x01, 0x01, 0x03, 0xF8, 0x07, 0x05, 0x00, 0x01, 0x00,
+0x01, 0x01, 0x07, 0x03, 0x02, 0xF9, 0x08, 0x07, 0xF6, 0x00, 0xFC, 0xFD, 0x09, 0xFA, 0x03, 0xF5,
+0x0C, 0x0A, 0x02, 0x07, 0xFA, 0x05, 0x02, 0x06, 0xFC, 0x04, 0x02, 0x07, 0x04, 0xFD, 0xFC, 0xFA,
+0x0A, 0xFF, 0x03, 0x04, 0x05, 0xF9, 0x05, 0xFF, 0xFE, 0x02, 0x02, 0xF6, 0x05, 0xFF, 0x00, 0xF7,
+0x05, 0x05, 0xF4, 0x01, 0xFC, 0x08, 0x07, 0x0E, 0x04, 0x02, 0xFB, 0x01, 0x0B, 0x05, 0xFF, 0xFA,
+0xFF, 0xFA, 0x08, 0x09, 0x04, 0xF9, 0x06, 0x05, 0xFD, 0x02, 0xFF, 0xFA, 0x02, 0x03, 0x05, 0xF0,
+0x02, 0x09, 0xF8, 0x01, 0xFC, 0x00, 0x09, 0x09, 0xFD, 0xFC, 0xFC, 0x06, 0x04, 0x07, 0xF9, 0xF8,
+0xFF, 0xFA, 0x05, 0x01, 0x08, 0xFE, 0x0A, 0x08, 0x01, 0x04, 0xFA, 0xFE, 0x04, 0x01, 0x09, 0xFB,
+0x08, 0x08, 0xFA, 0x04, 0xFC, 0x05, 0x07, 0x06, 0xF5, 0x08, 0xF9, 0x06, 0x09, 0xFA, 0xFB, 0xF8,
+0x09, 0xF8, 0x07, 0x08, 0x0A, 0xFA, 0x07, 0x07, 0xFB, 0x07, 0xFB, 0xF7, 0x08, 0xFB, 0x06, 0xD6,
+0x07, 0x07, 0xFB, 0x06, 0xFA, 0x07, 0x05, 0x04, 0xF9, 0x07, 0xFB, 0x06, 0x08, 0xFE, 0xFA, 0xF4,
+0x0A, 0xFA, 0x09, 0x0B, 0x09, 0xF6, 0x05, 0x06, 0xFB, 0x07, 0xF9, 0xF8, 0x0C, 0xFB, 0x07, 0xE4,
+0x06, 0x07, 0xF8, 0x08, 0xF8, 0x03, 0x05, 0x0A, 0xF9, 0x08, 0xFC, 0x05, 0x09, 0xFD, 0xF8, 0xF7,
+0x08, 0xFA, 0x06, 0x08, 0x09, 0xFB, 0x08, 0x0A, 0xF8, 0x06, 0xFE, 0xF9, 0x08, 0xFD, 0x06, 0xDF,
+0x06, 0x05, 0xFB, 0x07, 0xF9, 0x05, 0x06, 0x08, 0xFA, 0x0A, 0xFA, 0x06, 0x0B, 0xFA, 0xFA, 0xF9,
+0x06, 0xF8, 0x06, 0x08, 0x06, 0xF9, 0x09, 0x04, 0xFA, 0x08, 0xFA, 0xF8, 0x0A, 0xFD, 0x09, 0xE8,
+0x09, 0x09, 0xF9, 0x07, 0xF9, 0x04, 0x06, 0x07, 0xF7, 0x08, 0xF8, 0x09, 0x06, 0xFB, 0xFA, 0xFA,
+0x09, 0xFA, 0x05, 0x04, 0x08, 0xF9, 0x06, 0x06, 0xF9, 0x06, 0xFA, 0xF9, 0x09, 0xFC, 0x07, 0xEE,
+0x07, 0x07, 0xFC, 0x05, 0xF7, 0x06, 0x07, 0x07, 0xF5, 0x05, 0xF8, 0x06, 0x0A, 0xFB, 0xFA, 0xF9,
+0x08, 0xFA, 0x07, 0x08, 0x04, 0xF6, 0x08, 0x09, 0xFD, 0x06, 0xFB, 0xF7, 0x08, 0xFE, 0x07, 0xE0,
+0x07, 0x06, 0xF8, 0x07, 0xFC, 0x07, 0x03, 0x05, 0xF7, 0x0C, 0xF8, 0x09, 0x04, 0xF9, 0xFB, 0xF4,
+0x07, 0xF7, 0x09, 0x06, 0x05, 0xFC, 0x06, 0x08, 0xFC, 0x06, 0xFB, 0xF8, 0x09, 0xFA, 0x08, 0xDF,
+0x08, 0x05, 0xF9, 0x04, 0xF9, 0x05, 0x07, 0x09, 0xF5, 0x07, 0xF9, 0x0A, 0x05, 0xFC, 0xFB, 0xFA,
+0x05, 0xF7, 0x09, 0x06, 0x07, 0xF7, 0x06, 0x0A, 0xF9, 0x06, 0xFC, 0xF7, 0x07, 0xFC, 0x08, 0xE6,
+0x08, 0x07, 0xF6, 0x07, 0xFE, 0x04, 0x08, 0x07, 0xFD, 0x05, 0xF6, 0x04, 0x08, 0xFB, 0xF7, 0xFA,
+0x04, 0xFB, 0x03, 0x0C, 0x09, 0xF9, 0x07, 0x09, 0xFD, 0x06, 0xF7, 0xFB, 0x0B, 0xFB, 0x0B, 0xE1,
+0x04, 0x04, 0xF9, 0x02, 0xF8, 0x0A, 0x08, 0x08, 0xF8, 0x03, 0xF6, 0x06, 0x0D, 0xF7, 0xFB, 0xFB,
+0x05, 0xFB, 0x0A, 0x08, 0x0A, 0xFA, 0x06, 0x04, 0xFA, 0x07, 0xFC, 0xF6, 0x08, 0xFF, 0x0A, 0xEC,
+0x0B, 0x0A, 0xF6, 0x05, 0xF9, 0x05, 0x06, 0x05, 0xFB, 0x04, 0xFB, 0x01, 0x0B, 0xFC, 0xF6, 0xF4,
+0x08, 0xF6, 0x0A, 0x08, 0x07, 0xFA, 0x08, 0x06, 0xFA, 0x05, 0xFA, 0xFC, 0x06, 0x00, 0x0A, 0xF2,
+0x07, 0x04, 0xFA, 0x04, 0xF9, 0x0A, 0x0A, 0x09, 0xFB, 0xFE, 0xF7, 0x06, 0x0B, 0xFA, 0xF6, 0xF6,
+0x0A, 0xF8, 0x09, 0x05, 0x0D, 0xFE, 0x05, 0x03, 0xF8, 0x05, 0xFD, 0xFA, 0x0C, 0xFB, 0x05, 0xF4,
+0x04, 0x03, 0xFA, 0x08, 0xFC, 0x00, 0x0C, 0x08, 0xFB, 0x05, 0xFD, 0x07, 0x09, 0xF3, 0xF8, 0xFD,
+0x06, 0xF5, 0x04, 0x07, 0x06, 0xF8, 0x09, 0x07, 0xFC, 0x02, 0xF4, 0xF8, 0x08, 0xFC, 0x05, 0xF9,
+0x08, 0x08, 0xF9, 0x07, 0xF9, 0x03, 0x05, 0x06, 0xFE, 0x03, 0xFD, 0x07, 0x05, 0x03, 0xF6, 0xFB,
+0x04, 0xFB, 0x0B, 0x0F, 0x0C, 0xF3, 0x09, 0x0A, 0xF7, 0x05, 0xFB, 0xF7, 0x05, 0xFE, 0x0A, 0xF3,
+0x05, 0x09, 0xF6, 0x03, 0xF7, 0x09, 0x05, 0x08, 0xFA, 0x09, 0xF7, 0x09, 0x02, 0xFD, 0xF8, 0xF8,
+0x06, 0xF9, 0x02, 0x07, 0x05, 0xF3, 0x05, 0x09, 0xF6, 0x06, 0xFE, 0xFB, 0x0B, 0xFE, 0x04, 0xEF,
+0x06, 0x05, 0xFB, 0x05, 0xFA, 0x04, 0x09, 0x0D, 0xFA, 0x00, 0xF9, 0x06, 0x09, 0xF9, 0xFA, 0xF5,
+0x02, 0xF6, 0x03, 0x06, 0x08, 0xF8, 0x0C, 0x0C, 0xFF, 0x05, 0xFB, 0xF6, 0x08, 0xFC, 0x06, 0xE8,
+0x08, 0x0C, 0xF5, 0x07, 0xFA, 0x0A, 0x07, 0x07, 0xFD, 0x04, 0xFB, 0x05, 0x07, 0xFF, 0xFA, 0xFB,
+0x03, 0xF6, 0x07, 0x07, 0x06, 0xF4, 0x0A, 0x04, 0xFA, 0x06, 0xF7, 0xFC, 0x0E, 0xFD, 0x08, 0xE3,
+0x0C, 0x02, 0xF5, 0x09, 0xFA, 0x0B, 0x05, 0x09, 0xFD, 0x05, 0xF6, 0x07, 0x02, 0xFD, 0xF5, 0xF9,
+0x04, 0xF3, 0x08, 0x07, 0x02, 0xF2, 0x09, 0x04, 0xFC, 0x04, 0xFC, 0xF9, 0x09, 0xFE, 0x0A, 0xEA,
+0x02, 0x07, 0xF9, 0x0A, 0xF6, 0x07, 0x05, 0x0A, 0xFB, 0x09, 0xF6, 0x03, 0x03, 0x00, 0xF6, 0xF2,
+0x06, 0xFC, 0x06, 0x03, 0x06, 0xF2, 0x09, 0x09, 0xF6, 0x05, 0xFC, 0xF9, 0x01, 0xFD, 0x0D, 0xF6,
+0x0B, 0x04, 0xFC, 0x09, 0xFC, 0x05, 0x08, 0x03, 0xF7, 0x04, 0xF9, 0x03, 0x0A, 0xFE, 0xF5, 0xFB,
+0x0D, 0xFC, 0x0A, 0x08, 0x09, 0xFE, 0x04, 0x09, 0xFB, 0x07, 0xF2, 0xFD, 0x09, 0xFA, 0x0D, 0xF0,
+0x0A, 0x06, 0xFB, 0x07, 0xF9, 0x09, 0x07, 0x08, 0xFD, 0x08, 0xF8, 0x03, 0x04, 0xF2, 0xFC, 0x00,
+0x09, 0xFD, 0x0C, 0x00, 0x09, 0xFE, 0x08, 0x0C, 0xF7, 0x00, 0xFA, 0xF8, 0x05, 0xFB, 0x08, 0xF1,
+0x03, 0x05, 0xFA, 0x0C, 0xFD, 0x06, 0x02, 0x0A, 0xF7, 0x00, 0xF5, 0x04, 0x09, 0x05, 0xF5, 0xF4,
+0x0A, 0xF3, 0x03, 0x0C, 0x0A, 0xF1, 0x0B, 0x05, 0xFA, 0x00, 0xFD, 0xFA, 0x09, 0xFD, 0x05, 0xF5,
+0x0E, 0x08, 0xF9, 0x0C, 0xFB, 0x07, 0x0C, 0x0A, 0xFE, 0x0A, 0xF9, 0x06, 0x05, 0xFA, 0xFA, 0xFB,
+0x09, 0xF7, 0x04, 0x04, 0x04, 0xFE, 0x0C, 0x04, 0xFA, 0x05, 0xFA, 0xF8, 0x07, 0xF7, 0x05, 0xF6,
+0xFF, 0x05, 0xF9, 0x02, 0xF7, 0x05, 0x0D, 0x08, 0xF7, 0x06, 0xF3, 0x06, 0x03, 0xFA, 0xF5, 0xF3,
+0x01, 0xF2, 0x09, 0x04, 0x09, 0xFC, 0x03, 0x04, 0xFE, 0x05, 0xFA, 0xFD, 0x08, 0xFC, 0x0E, 0xE8,
+0x04, 0x0C, 0xF8, 0x07, 0xFF, 0x07, 0x0B, 0x08, 0x00, 0x03, 0xF4, 0x00, 0x08, 0xF9, 0xF6, 0xF6,
+0x00, 0xFC, 0x04, 0x04, 0x0C, 0xFA, 0x09, 0x05, 0xFC, 0x05, 0xF6, 0xF8, 0x09, 0xFA, 0x07, 0xF3,
+0x01, 0x0A, 0xF5, 0x06, 0xFA, 0x09, 0x07, 0x08, 0xFC, 0x06, 0xFB, 0x08, 0x07, 0xFA, 0xF5, 0xFA,
+0x08, 0xFA, 0x02, 0x07, 0x0C, 0xFD, 0x05, 0x05, 0xF5, 0x06, 0xFC, 0xFC, 0x06, 0xFC, 0x0A, 0xEE,
+0x0B, 0x07, 0xF8, 0x0C, 0xFB, 0x0C, 0x08, 0x07, 0xF8, 0x00, 0xFD, 0x01, 0x0B, 0xF6, 0xFD, 0xFC,
+0x09, 0xFD, 0x03, 0x02, 0x09, 0xF6, 0x08, 0x02, 0xF7, 0x03, 0xFE, 0xF4, 0x0F, 0xF8, 0x09, 0xF2,
+0x00, 0x0C, 0xF9, 0x04, 0xF9, 0x06, 0x06, 0x09, 0xF8, 0x06, 0xFC, 0x03, 0x0C, 0xF6, 0xF9, 0xF5,
+0x07, 0xFC, 0x05, 0x06, 0x09, 0xF8, 0x07, 0x0E, 0xFA, 0x05, 0xFA, 0xF8, 0x08, 0xFF, 0x0C, 0xF0,
+0x01, 0x05, 0xF6, 0x08, 0xFE, 0x08, 0x04, 0x04, 0xF6, 0x07, 0xF4, 0x06, 0x06, 0x00, 0xFC, 0xF4,
+0x0B, 0xFC, 0x0C, 0x04, 0x0F, 0xFA, 0x05, 0x04, 0xFA, 0x03, 0xF1, 0xF2, 0x05, 0xFC, 0x0D, 0xF6,
+0x0B, 0x08, 0xF9, 0x09, 0xFA, 0x05, 0x08, 0x04, 0x00, 0x09, 0xF7, 0x07, 0x02, 0xFE, 0xFC, 0xF6,
+0x0A, 0xF7, 0x0B, 0x0A, 0x05, 0xF7, 0x07, 0x0C, 0xFB, 0x01, 0xFD, 0xF5, 0x09, 0x00, 0x05, 0xF1,
+0x08, 0x0B, 0xF5, 0x0A, 0xF9, 0x04, 0x0E, 0x0A, 0xFF, 0x01, 0xFD, 0x02, 0x02, 0xFC, 0xF4, 0xF3,
+0x06, 0xFD, 0x05, 0x05, 0x09, 0xF9, 0x05, 0x0C, 0xFA, 0x07, 0x00, 0xF6, 0x0C, 0xFD, 0x02, 0xF2,
+0x05, 0x07, 0xF9, 0x05, 0xFA, 0x0B, 0x04, 0x07, 0xFF, 0xF7, 0xFA, 0xFF, 0x0F, 0x03, 0xF7, 0xEF,
+0x04, 0xF0, 0x03, 0x0B, 0x0B, 0xF7, 0x0C, 0x08, 0xFB, 0x05, 0xF4, 0xFD, 0x09, 0xFB, 0x05, 0xF0,
+0x09, 0x07, 0xF6, 0x05, 0xFB, 0x0B, 0x0C, 0x0B, 0xFA, 0xFF, 0xF9, 0x0A, 0x06, 0xFE, 0xF8, 0xF7,
+0x02, 0xF4, 0x09, 0x07, 0x09, 0xF7, 0x04, 0x09, 0x01, 0x06, 0xFE, 0xF8, 0x08, 0xFB, 0x07, 0xF6,
+0x0A, 0x0A, 0xFF, 0x09, 0xF6, 0x02, 0x09, 0x07, 0xF9, 0x01, 0xFE, 0x03, 0x0A, 0xFD, 0xFD, 0xF5,
+0x09, 0xFC, 0x07, 0x0C, 0x08, 0xF5, 0x05, 0x04, 0xF9, 0x05, 0xFA, 0xF8, 0x04, 0xFD, 0x05, 0xEC,
+0x06, 0x05, 0xFC, 0x08, 0xF6, 0x0A, 0x0C, 0x08, 0xF6, 0x07, 0xF5, 0x09, 0x06, 0xFC, 0xF7, 0xFD,
+0x02, 0xFA, 0x09, 0x0B, 0x06, 0xFB, 0x06, 0x09, 0x00, 0x04, 0xFC, 0xF5, 0x04, 0xF7, 0x06, 0xF4,
+0x02, 0x0C, 0xFC, 0x07, 0xF9, 0x0B, 0x05, 0x04, 0xFE, 0x01, 0xF6, 0x09, 0x07, 0x04, 0xFA, 0xED,
+0x0D, 0xF0, 0x03, 0x03, 0x07, 0xF3, 0x07, 0x0D, 0xFF, 0x04, 0xF7, 0xF4, 0x06, 0xFC, 0x05, 0xEB,
+0x06, 0x03, 0xFC, 0x0A, 0x00, 0x06, 0x0D, 0x04, 0xFC, 0x05, 0xF6, 0x07, 0x0C, 0x01, 0xFC, 0xF6,
+0x03, 0xF2, 0x08, 0x03, 0x0E, 0xFB, 0x0B, 0x0F, 0xFD, 0x06, 0xF3, 0xF5, 0x0E, 0xFD, 0x04, 0xEE,
+0x08, 0x03, 0xF9, 0x03, 0xFC, 0x0A, 0x04, 0x0D, 0xF9, 0x09, 0xF4, 0x02, 0x11, 0xFD, 0xF7, 0xF5,
+0x0F, 0xFE, 0x0B, 0x06, 0x06, 0xFB, 0x0B, 0x01, 0xF8, 0x04, 0xFA, 0xF4, 0x04, 0x00, 0x05, 0xEE,
+0x02, 0x0D, 0xF6, 0x05, 0xF8, 0x05, 0x0C, 0x04, 0xFA, 0x03, 0xF7, 0x07, 0x0A, 0x00, 0xFA, 0xF2,
+0x05, 0xF9, 0x02, 0x0A, 0x06, 0xFF, 0x06, 0x05, 0xF9, 0x04, 0xF9, 0xF8, 0x07, 0xFC, 0x08, 0xF0,
+0x07, 0x07, 0xFD, 0x0E, 0xF8, 0x08, 0x0A, 0x05, 0xFB, 0x0A, 0xF5, 0x05, 0x06, 0xFE, 0xFC, 0xFA,
+0x04, 0xF9, 0x0B, 0x07, 0x0C, 0xFC, 0x0B, 0x06, 0xFB, 0x05, 0xFD, 0xFA, 0x06, 0xFC, 0x09, 0xEE,
+0x01, 0x07, 0xF7, 0x03, 0xF9, 0x0C, 0x08, 0x0A, 0xF7, 0x06, 0xFB, 0x04, 0x0B, 0xFD, 0xFA, 0xF9,
+0x03, 0xFC, 0x09, 0x07, 0x07, 0xF6, 0x05, 0x0C, 0xFD, 0x05, 0xFC, 0xFB, 0x0D, 0xFC, 0x07, 0xEE,
+0x07, 0x05, 0xFA, 0x05, 0xF5, 0x03, 0x09, 0x08, 0xFD, 0x05, 0xFA, 0x09, 0x05, 0xFC, 0xFE, 0x00,
+0x00, 0xFB, 0x05, 0x09, 0x0E, 0xF2, 0x0B, 0x0B, 0xF8, 0x02, 0xF5, 0xF9, 0x0A, 0xFB, 0x04, 0xEE,
+0x00, 0x04, 0xF8, 0x06, 0xFE, 0x05, 0x05, 0x05, 0xF5, 0x01, 0xF4, 0x05, 0x0D, 0xF9, 0xF3, 0xFB,
+0x0B, 0xF6, 0x09, 0x04, 0x0A, 0xF3, 0x04, 0x06, 0xFE, 0x00, 0xFE, 0xFA, 0x0E, 0x00, 0x08, 0xF4,
+0x07, 0x01, 0xFC, 0x03, 0xFD, 0x05, 0x05, 0x0A, 0xF9, 0x07, 0xF8, 0x04, 0x0A, 0xF7, 0xF3, 0xF7,
+0x04, 0xFE, 0x03, 0x0B, 0x08, 0xF6, 0x08, 0x0B, 0xF8, 0xFF, 0xF7, 0xFC, 0x09, 0xFC, 0x0B, 0xF3,
+0x07, 0x06, 0xF1, 0x05, 0xFA, 0x02, 0x0E, 0x03, 0xF7, 0x07, 0xF5, 0x01, 0x0E, 0x04, 0xF0, 0xF8,
+0x00, 0xF7, 0x09, 0x05, 0x04, 0xFA, 0x0A, 0x06, 0xF8, 0x02, 0xFA, 0xF8, 0x07, 0xFD, 0x0B, 0xF1,
+0x0C, 0x09, 0xF3, 0x09, 0xFB, 0xFF, 0x01, 0x05, 0xF8, 0x09, 0xF7, 0x0A, 0x09, 0xFF, 0xF5, 0xF4,
+0x0B, 0xF9, 0x02, 0x06, 0x03, 0xF5, 0x02, 0x0B, 0xFB, 0x05, 0xFD, 0xFB, 0x0B, 0xF7, 0x02, 0xF1,
+0x08, 0x05, 0xF6, 0x0D, 0xF5, 0x09, 0x02, 0x07, 0xF8, 0x03, 0xFD, 0x06, 0x0A, 0xFF, 0xF3, 0x00,
+0x06, 0xF8, 0x0B, 0x06, 0x03, 0xF8, 0x02, 0x06, 0xF6, 0xFC, 0x00, 0xF6, 0x09, 0xFA, 0x00, 0xF5,
+0x0B, 0x05, 0xFA, 0x0C, 0xFB, 0x06, 0x04, 0x0A, 0xFD, 0x06, 0xF9, 0x01, 0x04, 0x00, 0xF1, 0xF9,
+0x05, 0xFB, 0x0D, 0x04, 0x09, 0xFD, 0x08, 0x08, 0xFC, 0x04, 0xF8, 0xF8, 0x09, 0xF8, 0x07, 0xEB,
+0x07, 0x0A, 0xFC, 0x06, 0xFA, 0x04, 0x04, 0x09, 0xFA, 0x06, 0xF6, 0x07, 0x08, 0xFC, 0xF6, 0xF9,
+0x04, 0xF8, 0x07, 0x0A, 0x07, 0xFB, 0x03, 0x0B, 0xF8, 0x04, 0xF9, 0xFA, 0x07, 0xFB, 0x0A, 0xE8,
+0x08, 0x08, 0xF5, 0x0A, 0xF9, 0x06, 0x07, 0x05, 0xFA, 0x06, 0xF9, 0x06, 0x08, 0xFC, 0xFC, 0xF6,
+0x03, 0xF8, 0x08, 0x0A, 0x07, 0xF9, 0x0C, 0x07, 0xF8, 0x05, 0xFC, 0xF8, 0x05, 0xFC, 0x04, 0xDB,
+0x08, 0x05, 0xF8, 0x0B, 0xFE, 0x04, 0x0B, 0x0A, 0xFD, 0x03, 0xF2, 0x06, 0x0E, 0xFD, 0xFC, 0xFE,
+0x04, 0xF8, 0x09, 0x05, 0x0A, 0xF5, 0x09, 0x0D, 0xFA, 0x05, 0xFC, 0xFD, 0x04, 0xFE, 0x06, 0xEB,
+0x07, 0x0D, 0xF8, 0x0B, 0xF9, 0x0B, 0x07, 0x08, 0xFA, 0x04, 0xF8, 0x01, 0x06, 0xFA, 0xF6, 0xF6,
+0x04, 0xFA, 0x0B, 0x0D, 0x08, 0xF6, 0x09, 0x06, 0x00, 0x04, 0xFE, 0xFA, 0x04, 0xFD, 0x04, 0xF4,
+0x0A, 0x04, 0xFB, 0x06, 0xF8, 0x05, 0x07, 0x06, 0xF8, 0x0D, 0xFD, 0x0B, 0x03, 0xF2, 0xFB, 0xF8,
+0x04, 0xFF, 0x05, 0x07, 0x05, 0xFC, 0x04, 0x03, 0xF6, 0xEB, 0xFC, 0xFC, 0x07, 0xFD, 0x00, 0xFA,
+0x09, 0x04, 0xFB, 0x09, 0xFE, 0x09, 0x08, 0x0C, 0xF9, 0x02, 0xF6, 0x07, 0x07, 0x01, 0xFF, 0xFC,
+0x07, 0xF2, 0x02, 0x04, 0x0B, 0xF9, 0x0A, 0x07, 0xF6, 0x05, 0xFC, 0xF4, 0x0A, 0xFA, 0x04, 0xED,
+0x06, 0x06, 0xFB, 0x06, 0xF9, 0x07, 0x08, 0x05, 0xF8, 0x07, 0xF7, 0x08, 0x06, 0xFA, 0xFB, 0xF7,
+0x09, 0xF5, 0x06, 0x08, 0x09, 0xFB, 0x05, 0x0A, 0xFB, 0x05, 0xFA, 0xFA, 0x09, 0xFC, 0x08, 0xEA,
+0x06, 0x03, 0xF5, 0x0C, 0xFC, 0x06, 0x05, 0x0D, 0xFB, 0x0B, 0xF5, 0x04, 0x08, 0xFA, 0xF8, 0xF8,
+0x02, 0xF9, 0x06, 0x06, 0x06, 0xF5, 0x08, 0x07, 0xFB, 0x04, 0xFB, 0xFB, 0x03, 0xFB, 0x04, 0xE8,
+0x03, 0x08, 0xF5, 0x0B, 0x00, 0x0B, 0x08, 0x0F, 0xF6, 0x01, 0xF9, 0xFE, 0x07, 0xFC, 0xFE, 0xFA,
+0x08, 0xFB, 0x09, 0x00, 0x0A, 0xF9, 0x09, 0x0A, 0xFC, 0x08, 0xF8, 0xF9, 0x0D, 0x02, 0x06, 0xEC,
+0x00, 0x07, 0xF7, 0x01, 0xF9, 0x06, 0x0C, 0x0B, 0xF5, 0x06, 0xF8, 0x06, 0x0B, 0xFE, 0xF8, 0xFD,
+0x0A, 0xFC, 0x03, 0x01, 0x03, 0xF9, 0x04, 0x09, 0xFE, 0x03, 0xFC, 0xF5, 0x02, 0xF6, 0x01, 0xEC,
+0x04, 0x0C, 0xFA, 0x07, 0xFB, 0x04, 0x0C, 0x0A, 0xFF, 0xF8, 0xF5, 0x09, 0x05, 0xFF, 0xFE, 0xF8,
+0x02, 0xFA, 0x02, 0x0A, 0x06, 0xF5, 0x07, 0x0B, 0x01, 0x08, 0xFA, 0xF8, 0x0A, 0xFA, 0x0D, 0xEE,
+0x06, 0x0B, 0xF7, 0x01, 0xF2, 0x0B, 0x02, 0x06, 0xFC, 0x01, 0xF3, 0x07, 0x01, 0xFE, 0xF5, 0xF8,
+0x05, 0xFB, 0x09, 0x07, 0x0B, 0xF3, 0x02, 0x05, 0xF4, 0xF6, 0xF9, 0xF6, 0x0B, 0xF4, 0x0A, 0xFA,
+0x05, 0x05, 0x04, 0xFF, 0x02, 0x04, 0xFD, 0xFC, 0xFD, 0x03, 0xFF, 0x05, 0xFD, 0x05, 0x02, 0x05,
+0xFC, 0x01, 0xFE, 0x03, 0xFF, 0xFE, 0x06, 0xFE, 0x00, 0xFC, 0x01, 0x03, 0x01, 0x02, 0xFA, 0x03,
+0xFD, 0x01, 0x05, 0x03, 0xFE, 0xFF, 0xFE, 0x02, 0xFA, 0x02, 0x03, 0x01, 0xFC, 0x06, 0x00, 0x03,
+0xFA, 0x02, 0x05, 0x05, 0x00, 0x03, 0x00, 0x02, 0xFB, 0x02, 0x02, 0xFB, 0xFC, 0x02, 0x06, 0x04,
+0x00, 0x04, 0xFE, 0x04, 0xF9, 0x05, 0x08, 0x09, 0xFA, 0x01, 0xF6, 0x07, 0x0D, 0x02, 0xFD, 0xFD,
+0xFF, 0xF6, 0x06, 0x09, 0x03, 0xF6, 0x06, 0x0D, 0xFB, 0x03, 0xF6, 0xF9, 0x06, 0xFA, 0x09, 0xF5,
+0x06, 0x08, 0xF8, 0x0E, 0xFD, 0x0C, 0x0B, 0x0C, 0xFE, 0x01, 0xF1, 0x07, 0x0A, 0x04, 0xFE, 0xFD,
+0x04, 0xF6, 0x08, 0x07, 0x09, 0xF8, 0x07, 0x06, 0xFA, 0x07, 0xF8, 0xFB, 0x04, 0xFE, 0x07, 0xEF,
+0x0E, 0x09, 0xEB, 0x10, 0xF0, 0x13, 0x14, 0x0F, 0xF2, 0x06, 0xF1, 0x0C, 0x0D, 0xFF, 0xFA, 0xF1,
+0x09, 0xF1, 0x0C, 0x06, 0x0B, 0xEE, 0x0B, 0x11, 0xFB, 0x0D, 0xF5, 0xF8, 0x0D, 0xFA, 0x0D, 0xED,
+0x0F, 0x0E, 0xF2, 0x0C, 0xF5, 0x0B, 0x14, 0x12, 0xF1, 0x11, 0xF4, 0x07, 0x0B, 0xFB, 0xF4, 0xF4,
+0x0E, 0xEB, 0x0D, 0x0D, 0x10, 0xF4, 0x10, 0x0E, 0xF5, 0x0B, 0xF2, 0xF4, 0x0E, 0xF8, 0x0E, 0xE6,
+0x0B, 0x0C, 0xF4, 0x10, 0xF3, 0x0F, 0x11, 0x11, 0xF5, 0x04, 0xF5, 0x07, 0x0B, 0xFB, 0xF4, 0xEF,
+0x0C, 0xF2, 0x0B, 0x0A, 0x12, 0xF5, 0x0C, 0x0D, 0xF7, 0x0B, 0xF0, 0xF7, 0x11, 0xF7, 0x11, 0xE4,
+0x0F, 0x12, 0xF3, 0x0E, 0xF0, 0x12, 0x0D, 0x0C, 0xFA, 0x01, 0xEF, 0x07, 0x0E, 0xFB, 0xED, 0xEF,
+0x08, 0xF3, 0x12, 0x0B, 0x11, 0xF1, 0x0B, 0x0C, 0xF3, 0x0B, 0xF5, 0xF0, 0x13, 0xF8, 0x0C, 0xDF,
+0x0E, 0x11, 0xF1, 0x11, 0xF6, 0x11, 0x14, 0x0F, 0xFD, 0x00, 0xEE, 0x07, 0x12, 0x00, 0xEE, 0xED,
+0x0B, 0xED, 0x10, 0x0D, 0x12, 0xF1, 0x0B, 0x0C, 0xF8, 0x0A, 0xF1, 0xF8, 0x0F, 0xF6, 0x0B, 0xE5,
+0x0F, 0x0E, 0xF1, 0x0F, 0xF9, 0x13, 0x11, 0x0A, 0xF7, 0x0B, 0xF2, 0x05, 0x13, 0xFD, 0xF1, 0xEA,
+0x0C, 0xF4, 0x09, 0x0B, 0x0E, 0xF5, 0x0F, 0x0A, 0xF5, 0x0C, 0xEF, 0xF7, 0x11, 0xF9, 0x0B, 0xE1,
+0x12, 0x0B, 0xED, 0x0A, 0xF2, 0x09, 0x16, 0x0D, 0xFE, 0x0C, 0xF0, 0x07, 0x10, 0xFD, 0xF7, 0xE9,
+0x10, 0xEE, 0x12, 0x0D, 0x11, 0xF3, 0x14, 0x0A, 0xF5, 0x0A, 0xF5, 0xF4, 0x12, 0xF5, 0x0C, 0xE2,
+0x0F, 0x13, 0xF5, 0x0D, 0xFB, 0x14, 0x0A, 0x14, 0xFD, 0x07, 0xF2, 0x09, 0x10, 0xFB, 0xF7, 0xF4,
+0x0E, 0xF3, 0x0E, 0x0A, 0x0E, 0xEC, 0x12, 0x0D, 0xFD, 0x0F, 0xF7, 0xED, 0x10, 0xF9, 0x0F, 0xE4,
+0x08, 0x0A, 0xF6, 0x12, 0xF0, 0x10, 0x0A, 0x0B, 0xEF, 0x0A, 0xED, 0x09, 0x0F, 0xF9, 0xF0, 0xEF,
+0x14, 0xF0, 0x0D, 0x0B, 0x0D, 0xF7, 0x08, 0x0C, 0xF6, 0x04, 0xF8, 0xF7, 0x11, 0xF1, 0x0C, 0xE4,
+0x0B, 0x0B, 0xFA, 0x0B, 0xFA, 0x08, 0x0F, 0x0D, 0xF8, 0x06, 0xF0, 0x0A, 0x08, 0xF7, 0xF1, 0xF4,
+0x0F, 0xF0, 0x0C, 0x05, 0x08, 0xF9, 0x10, 0x0A, 0xF9, 0xCC, 0xFA, 0xF7, 0x09, 0xF9, 0x09, 0xE3,
+0x0C, 0x0C, 0xF6, 0x0A, 0xF3, 0x0B, 0x0F, 0x0B, 0xF5, 0x0C, 0xF7, 0x0C, 0x0A, 0xF5, 0xF4, 0xF3,
+0x0D, 0xF3, 0x08, 0x0B, 0x0E, 0xF2, 0x0D, 0x0F, 0xF3, 0x0A, 0xF6, 0xF7, 0x0F, 0xFD, 0x0E, 0xEF,
+0x08, 0x14, 0xF5, 0x0E, 0xF4, 0x0D, 0x10, 0x12, 0xF8, 0x00, 0xE9, 0x0A, 0x11, 0xFD, 0xF2, 0xEE,
+0x0A, 0xF5, 0x08, 0x0C, 0x0B, 0xED, 0x0B, 0x0E, 0xF7, 0x0A, 0xF4, 0xF1, 0x0F, 0xFB, 0x11, 0xDF,
+0x0A, 0x10, 0xF0, 0x10, 0xF0, 0x0A, 0x14, 0x12, 0xF9, 0x05, 0xF5, 0x09, 0x0E, 0xFF, 0xF4, 0xF4,
+0x0B, 0xEF, 0x09, 0x14, 0x0E, 0xF1, 0x0F, 0x11, 0xFB, 0x0A, 0xF2, 0xF4, 0x0F, 0xF9, 0x0B, 0xDC,
+0x0B, 0x10, 0xF5, 0x0E, 0xF7, 0x0A, 0x0F, 0x08, 0xFB, 0x0A, 0xF3, 0x08, 0x0A, 0xFA, 0xEE, 0xF2,
+0x0E, 0xF1, 0x0C, 0x0E, 0x0C, 0xF2, 0x0D, 0x0E, 0xF5, 0x09, 0xF2, 0xF6, 0x0A, 0xF9, 0x0B, 0xE6,
+0x08, 0x09, 0xEF, 0x0D, 0xF4, 0x0E, 0x0C, 0x12, 0xF5, 0x06, 0xF0, 0x09, 0x0E, 0xFA, 0xF5, 0xF9,
+0x0E, 0xF4, 0x0D, 0x0B, 0x11, 0xEF, 0x09, 0x0E, 0xF6, 0x05, 0xF0, 0xF2, 0x0A, 0xF6, 0x0A, 0xE4,
+0x0D, 0x0D, 0xEE, 0x11, 0xF4, 0x0F, 0x10, 0x11, 0xF7, 0x08, 0xF5, 0x07, 0x0C, 0xF4, 0xF5, 0xF3,
+0x0D, 0xF2, 0x07, 0x0D, 0x0F, 0xF3, 0x0A, 0x0A, 0xF1, 0xFE, 0xF2, 0xF9, 0x0E, 0xF5, 0x0D, 0xEF,
+0x10, 0x08, 0xF2, 0x08, 0xF8, 0x0F, 0x10, 0x0E, 0xF1, 0x04, 0xF8, 0x12, 0x09, 0xF6, 0xF5, 0xF1,
+0x0B, 0xF7, 0x09, 0x0D, 0x0F, 0xF0, 0x09, 0x11, 0xF7, 0x0B, 0xEC, 0xF2, 0x10, 0xF3, 0x11, 0xE4,
+0x0A, 0x0B, 0xEF, 0x0F, 0xF5, 0x0D, 0x0F, 0x0C, 0xF6, 0x0C, 0xF1, 0x0C, 0x0E, 0xF5, 0xF5, 0xF9,
+0x09, 0xF4, 0x0C, 0x0A, 0x0D, 0xF5, 0x0D, 0x0A, 0xF3, 0x0B, 0xF2, 0xF4, 0x0A, 0xFD, 0x0E, 0xE8,
+0x0B, 0x0D, 0xF5, 0x0F, 0xF5, 0x0D, 0x10, 0x0E, 0xF4, 0x0B, 0xF8, 0x0A, 0x10, 0xF6, 0xF6, 0xF4,
+0x0C, 0xF4, 0x10, 0x0E, 0x0C, 0xF7, 0x0C, 0x09, 0xF6, 0x03, 0xF3, 0xF6, 0x11, 0xF9, 0x0E, 0xEE,
+0x0F, 0x10, 0xF4, 0x0C, 0xF2, 0x10, 0x0A, 0x0A, 0xF5, 0x0E, 0xF4, 0x0E, 0x0D, 0xF6, 0xF7, 0xF5,
+0x0D, 0xF4, 0x0C, 0x0E, 0x0C, 0xF5, 0x0B, 0x09, 0xF6, 0x09, 0xF4, 0xF1, 0x0E, 0xFD, 0x10, 0xE2,
+0x09, 0x0A, 0xF4, 0x11, 0xF7, 0x0F, 0x0D, 0x0B, 0xF8, 0x0A, 0xF0, 0x0A, 0x11, 0xFC, 0xED, 0xF2,
+0x0A, 0xF1, 0x0D, 0x0E, 0x0C, 0xF6, 0x16, 0x0C, 0xF8, 0x09, 0xF3, 0xF8, 0x0D, 0xFB, 0x10, 0xED,
+0x0C, 0x11, 0xF1, 0x0F, 0xF5, 0x0F, 0x0E, 0x0B, 0xF4, 0x0B, 0xF5, 0x09, 0x0E, 0xFB, 0xF7, 0xF2,
+0x0D, 0xF4, 0x0E, 0x0E, 0x0E, 0xF2, 0x09, 0x0C, 0xF4, 0x09, 0xF2, 0xF6, 0x10, 0xFB, 0x0B, 0xE6,
+0x08, 0x0C, 0xF3, 0x10, 0xF5, 0x0A, 0x11, 0x10, 0xF7, 0x0F, 0xF1, 0x09, 0x0D, 0xF5, 0xF6, 0xF6,
+0x0B, 0xF4, 0x09, 0x0E, 0x0F, 0xF6, 0x10, 0x0B, 0xF3, 0x07, 0xF6, 0xF7, 0x08, 0xF9, 0x0A, 0xEE,
+0x09, 0x12, 0xF4, 0x11, 0xF5, 0x08, 0x10, 0x0F, 0xF5, 0x07, 0xF6, 0x0B, 0x10, 0xF9, 0xF1, 0xED,
+0x0C, 0xF7, 0x0B, 0x0D, 0x07, 0xEF, 0x0C, 0x0D, 0xF7, 0xFD, 0xF4, 0xF9, 0x0B, 0xF3, 0x13, 0xE9,
+0x0A, 0x0E, 0xEF, 0x0D, 0xF7, 0x0A, 0x14, 0x0F, 0xF5, 0x08, 0xF2, 0x0C, 0x0C, 0x00, 0xF2, 0xF4,
+0x0D, 0xF5, 0x10, 0x09, 0x0F, 0xF5, 0x11, 0x12, 0xF6, 0x0C, 0xF5, 0xF7, 0x13, 0xFD, 0x0D, 0xEC,
+0x07, 0x0F, 0xED, 0x09, 0xF8, 0x10, 0x10, 0x0F, 0xF7, 0x01, 0xF3, 0x0B, 0x13, 0xFF, 0xF3, 0xF8,
+0x0B, 0xF6, 0x0D, 0x10, 0x12, 0xF2, 0x0D, 0x0C, 0xF7, 0x0A, 0xF5, 0xEE, 0x12, 0xF9, 0x0D, 0xE2,
+0x07, 0x09, 0xF3, 0x0A, 0xF8, 0x0A, 0x0C, 0x08, 0xFA, 0x09, 0xF7, 0x0B, 0x07, 0xF4, 0xF4, 0xF8,
+0x09, 0xF5, 0x0C, 0x0D, 0x09, 0xF6, 0x0E, 0x08, 0xF4, 0xCD, 0xF8, 0xF6, 0x0B, 0xFA, 0x0B, 0xF5,
+0x0D, 0x0E, 0xF3, 0x0E, 0xF6, 0x0E, 0x11, 0x10, 0xF5, 0x0B, 0xF8, 0x0C, 0x0E, 0xF7, 0xF2, 0xF7,
+0x0C, 0xF5, 0x0F, 0x0B, 0x0D, 0xF4, 0x0D, 0x0D, 0xF6, 0x07, 0xF5, 0xF7, 0x10, 0xFC, 0x0F, 0xE6,
+0x0D, 0x0E, 0xF0, 0x0F, 0xF5, 0x0E, 0x12, 0x0A, 0xF8, 0x09, 0xF3, 0x0B, 0x0D, 0xF8, 0xF4, 0xF3,
+0x0D, 0xF3, 0x0B, 0x0C, 0x0F, 0xF5, 0x0C, 0x0D, 0xF8, 0x08, 0xF2, 0xF4, 0x10, 0xFB, 0x0F, 0xE6,
+0x0E, 0x0C, 0xF0, 0x0F, 0xF4, 0x0D, 0x0B, 0x0D, 0xF7, 0x0D, 0xF8, 0x07, 0x0F, 0xF8, 0xEE, 0xF4,
+0x08, 0xF6, 0x0A, 0x11, 0x0C, 0xF2, 0x0F, 0x0E, 0xFA, 0x09, 0xF5, 0xF3, 0x10, 0xFC, 0x0F, 0xE7,
+0x0C, 0x0D, 0xEF, 0x11, 0xF6, 0x0E, 0x10, 0x0D, 0xF9, 0x07, 0xF5, 0x0B, 0x12, 0xFD, 0xF4, 0xF2,
+0x0B, 0xF2, 0x0D, 0x12, 0x0C, 0xF1, 0x0F, 0x0E, 0xF5, 0x0A, 0xF3, 0xF8, 0x11, 0x02, 0x09, 0xDB,
+0x0D, 0x0C, 0xF6, 0x0A, 0xF5, 0x0A, 0x12, 0x09, 0xF9, 0x08, 0xF2, 0x09, 0x0F, 0xFC, 0xF3, 0xF2,
+0x0E, 0xF3, 0x0C, 0x0D, 0x11, 0xF0, 0x0C, 0x0B, 0xF7, 0x02, 0xF2, 0xF2, 0x0F, 0xF5, 0x0D, 0xE1,
+0x0D, 0x0B, 0xEF, 0x0C, 0xF6, 0x0F, 0x0B, 0x0E, 0xF9, 0x0A, 0xF4, 0x09, 0x10, 0xF8, 0xEF, 0xEF,
+0x0D, 0xF5, 0x09, 0x0C, 0x0B, 0xF1, 0x0D, 0x11, 0xF8, 0x0A, 0xF5, 0xF5, 0x0C, 0xFB, 0x12, 0xE2,
+0x05, 0x09, 0xF2, 0x10, 0xF5, 0x0A, 0x0E, 0x0E, 0xF5, 0x08, 0xF4, 0x0E, 0x07, 0xF6, 0xF7, 0xF8,
+0x0C, 0xF2, 0x10, 0x10, 0x0A, 0xF1, 0x0D, 0x0D, 0xF3, 0x04, 0xF2, 0xF7, 0x0D, 0xF6, 0x0B, 0xE6,
+0x0C, 0x11, 0xF4, 0x10, 0xF4, 0x0C, 0x0D, 0x0C, 0xF4, 0x07, 0xEF, 0x0B, 0x0F, 0xF9, 0xF4, 0xF2,
+0x0D, 0xEF, 0x0E, 0x0C, 0x11, 0xF3, 0x0B, 0x0C, 0xF7, 0x0A, 0xF6, 0xF4, 0x0D, 0xFB, 0x0E, 0xEE,
+0x0D, 0x0C, 0xF3, 0x0E, 0xF5, 0x0D, 0x0C, 0x0C, 0xF6, 0x0C, 0xF3, 0x08, 0x0E, 0xF8, 0xF4, 0xF3,
+0x0D, 0xF4, 0x0E, 0x0C, 0x0E, 0xF3, 0x0B, 0x0E, 0xF5, 0x09, 0xF4, 0xF5, 0x0F, 0xFC, 0x0E, 0xF8,
+0x0A, 0x0D, 0xF6, 0x0B, 0xF6, 0x0F, 0x0B, 0x0D, 0xF6, 0x0D, 0xEF, 0x09, 0x0E, 0xF1, 0xF4, 0xF7,
+0x0B, 0xEF, 0x11, 0x09, 0x10, 0xF3, 0x0A, 0x0A, 0xF4, 0x08, 0xF4, 0xF5, 0x0D, 0xFB, 0x0D, 0xEC,
+0x0A, 0x0E, 0xF0, 0x10, 0xF8, 0x0D, 0x0C, 0x10, 0xF5, 0x09, 0xF0, 0x0C, 0x0A, 0xFB, 0xF4, 0xF8,
+0x0B, 0xF4, 0x0F, 0x0C, 0x0F, 0xF3, 0x0F, 0x12, 0xF5, 0x0A, 0xF6, 0xF7, 0x0F, 0xFA, 0x12, 0xE3,
+0x09, 0x0A, 0xF3, 0x12, 0xF7, 0x12, 0x09, 0x0C, 0xF6, 0x04, 0xF1, 0x05, 0x0D, 0xFA, 0xF2, 0xF0,
+0x0A, 0xEF, 0x08, 0x0D, 0x0D, 0xEE, 0x0A, 0x13, 0xF4, 0x09, 0xF6, 0xF5, 0x0E, 0xF8, 0x0B, 0xE6,
+0x0A, 0x0F, 0xF3, 0x12, 0xF5, 0x0D, 0x0E, 0x0E, 0xFA, 0x05, 0xF2, 0x09, 0x0F, 0xFC, 0xEF, 0xF0,
+0x0A, 0xEF, 0x0A, 0x0E, 0x0D, 0xF4, 0x0E, 0x13, 0xF8, 0x0A, 0xF2, 0xF5, 0x11, 0xFE, 0x0D, 0xDD,
+0x0C, 0x0D, 0xEF, 0x0B, 0xF5, 0x0D, 0x0F, 0x10, 0xF4, 0x03, 0xF5, 0x07, 0x0F, 0xF8, 0xF2, 0xF2,
+0x09, 0xED, 0x11, 0x0B, 0x0B, 0xF4, 0x11, 0x10, 0xF5, 0x08, 0xF4, 0xF2, 0x07, 0xF7, 0x0A, 0xED,
+0x0B, 0x0D, 0xF3, 0x0D, 0xF8, 0x0C, 0x0C, 0x09, 0xF6, 0x07, 0xF1, 0x0E, 0x0F, 0xF6, 0xF5, 0xF2,
+0x0C, 0xF2, 0x10, 0x0D, 0x0A, 0xF2, 0x0C, 0x0E, 0xF4, 0x04, 0xF4, 0xF6, 0x11, 0xF9, 0x0D, 0xE7,
+0x08, 0x09, 0xF5, 0x10, 0xF6, 0x09, 0x09, 0x0C, 0xF9, 0x07, 0xF7, 0x0A, 0x0A, 0xF7, 0xF1, 0xF6,
+0x0C, 0xF7, 0x0C, 0x0E, 0x0A, 0xF6, 0x11, 0x0E, 0xF4, 0xDD, 0xF6, 0xF4, 0x0C, 0xF3, 0x0B, 0xF0,
+0x0B, 0x0B, 0xF5, 0x10, 0xF5, 0x0E, 0x0E, 0x0F, 0xF6, 0x0C, 0xF5, 0x0B, 0x12, 0xFA, 0xF3, 0xF6,
+0x0E, 0xF5, 0x0C, 0x0C, 0x10, 0xF4, 0x11, 0x14, 0xF8, 0x09, 0xF5, 0xF4, 0x0E, 0xF9, 0x0B, 0xE7,
+0x0D, 0x0E, 0xF2, 0x0D, 0xF5, 0x0C, 0x11, 0x0F, 0xFA, 0x0A, 0xF4, 0x0C, 0x0B, 0xF7, 0xF3, 0xF2,
+0x08, 0xF7, 0x0D, 0x0D, 0x0F, 0xF1, 0x11, 0x12, 0xF4, 0x09, 0xF4, 0xF5, 0x0E, 0xFB, 0x09, 0xE8,
+0x0F, 0x0E, 0xF3, 0x0D, 0xF5, 0x0C, 0x0D, 0x0D, 0xF3, 0x0E, 0xF6, 0x0B, 0x0F, 0xF6, 0xF2, 0xFA,
+0x0D, 0xF2, 0x0B, 0x0D, 0x0C, 0xF0, 0x08, 0x10, 0xF5, 0x09, 0xF2, 0xF5, 0x11, 0xFD, 0x10, 0xEC,
+0x0A, 0x0B, 0xF1, 0x0B, 0xF4, 0x0B, 0x0C, 0x10, 0xF3, 0x0E, 0xF1, 0x08, 0x0B, 0xF5, 0xF2, 0xF5,
+0x11, 0xF7, 0x10, 0x08, 0x0E, 0xEE, 0x09, 0x09, 0xF9, 0x03, 0xF2, 0xF3, 0x0C, 0xF7, 0x09, 0xED,
+0x0E, 0x09, 0xF1, 0x09, 0xF7, 0x0A, 0x0D, 0x12, 0xFA, 0x0D, 0xF5, 0x10, 0x10, 0xFB, 0xEE, 0xF6,
+0x0A, 0xF3, 0x0E, 0x07, 0x12, 0xEF, 0x0C, 0x0E, 0xF3, 0x08, 0xFA, 0xED, 0x08, 0xF7, 0x0A, 0xEB,
+0x0A, 0x10, 0xF1, 0x10, 0xF9, 0x0F, 0x0E, 0x0C, 0xFB, 0x09, 0xF2, 0x08, 0x0F, 0xF4, 0xF6, 0xF1,
+0x0A, 0xF2, 0x10, 0x0E, 0x11, 0xF3, 0x0C, 0x0C, 0xF8, 0x0C, 0xF1, 0xF4, 0x0C, 0xFA, 0x10, 0xE8,
+0x0B, 0x10, 0xF5, 0x0F, 0xF3, 0x0D, 0x0F, 0x0D, 0xF4, 0x0A, 0xF0, 0x0B, 0x11, 0xFB, 0xF6, 0xF2,
+0x09, 0xF5, 0x0C, 0x0D, 0x0A, 0xF2, 0x0D, 0x10, 0xF6, 0x0B, 0xF2, 0xF4, 0x0F, 0xFE, 0x0C, 0xE5,
+0x0D, 0x0D, 0xF4, 0x0B, 0xF0, 0x0D, 0x0E, 0x10, 0xFC, 0x07, 0xF3, 0x0B, 0x10, 0x00, 0xEF, 0xF4,
+0x0C, 0xEF, 0x0E, 0x0C, 0x0F, 0xF0, 0x13, 0x0F, 0xF9, 0x0A, 0xF0, 0xF6, 0x0D, 0xFA, 0x0E, 0xEA,
+0x12, 0x0A, 0xEF, 0x11, 0xF2, 0x11, 0x0F, 0x0E, 0xFB, 0x0D, 0xED, 0x08, 0x0B, 0xFA, 0xF3, 0xF2,
+0x0E, 0xF7, 0x0D, 0x0E, 0x0B, 0xF1, 0x09, 0x09, 0xF8, 0x09, 0xF3, 0xF7, 0x08, 0xFB, 0x0B, 0xEB,
+0xFC, 0x01, 0x02, 0x01, 0x00, 0x03, 0x03, 0xFF, 0xFD, 0x04, 0x03, 0xFC, 0x05, 0xFA, 0xFD, 0x02,
+0x03, 0xFC, 0xFC, 0x05, 0xFF, 0xFF, 0x04, 0x04, 0x03, 0xFC, 0xFA, 0x01, 0x03, 0x06, 0x01, 0xFE,
+0x00, 0x01, 0xFA, 0xFC, 0x04, 0xFF, 0x00, 0xFD, 0xFD, 0xFE, 0x02, 0xFC, 0x05, 0xFF, 0x01, 0x04,
+0xFC, 0xFF, 0xFB, 0xFF, 0x06, 0xFF, 0xFB, 0xFF, 0xFA, 0xFF, 0x00, 0x00, 0xFB, 0x06, 0x04, 0xFF,
+0x0D, 0x0E, 0xEF, 0x0F, 0xF9, 0x0C, 0x11, 0x08, 0xF3, 0x09, 0xEF, 0x06, 0x0D, 0xFA, 0xF2, 0xF0,
+0x0D, 0xF3, 0x09, 0x10, 0x0A, 0xF4, 0x0C, 0x0E, 0xFA, 0x0B, 0xEE, 0xF9, 0x10, 0xF7, 0x0E, 0xE6,
+0x0D, 0x10, 0xF7, 0x0A, 0xF8, 0x10, 0x11, 0x0F, 0xFA, 0x0A, 0xF0, 0x06, 0x0F, 0xF8, 0xF0, 0xF4,
+0x0E, 0xF3, 0x0A, 0x07, 0x0D, 0xF0, 0x11, 0x0F, 0xF6, 0x0C, 0xEC, 0xFB, 0x0A, 0xFD, 0x10, 0xE9,
+0x0A, 0x10, 0xED, 0x0D, 0xF4, 0x0D, 0x0D, 0x0A, 0xFB, 0x08, 0xEF, 0x0B, 0x0B, 0xFB, 0xF7, 0xEF,
+0x06, 0xF0, 0x07, 0x0C, 0x0C, 0xED, 0x0B, 0x13, 0xF9, 0x09, 0xF2, 0xF8, 0x09, 0xF6, 0x09, 0xE2,
+0x09, 0x09, 0xF4, 0x0F, 0xEF, 0x11, 0x0E, 0x0D, 0xF0, 0x06, 0xED, 0x08, 0x0D, 0xFF, 0xF3, 0xF2,
+0x10, 0xF7, 0x0E, 0x0D, 0x12, 0xF4, 0x0E, 0x09, 0xF6, 0x07, 0xF7, 0xF8, 0x07, 0xFB, 0x10, 0xEE,
+0x0D, 0x0E, 0xF3, 0x0A, 0xF6, 0x0A, 0x0A, 0x0D, 0xF3, 0x00, 0xF4, 0x07, 0x10, 0xF8, 0xF6, 0xF4,
+0x0C, 0xF5, 0x0F, 0x09, 0x0A, 0xF3, 0x08, 0x13, 0xF6, 0x08, 0xF8, 0xEE, 0x0D, 0xF2, 0x0C, 0xE7,
+0x0B, 0x0B, 0xED, 0x08, 0xF3, 0x0F, 0x0A, 0x12, 0xF5, 0x09, 0xF5, 0x05, 0x0C, 0xEF, 0xF5, 0xFA,
+0x0A, 0xEE, 0x0D, 0x07, 0x08, 0xF7, 0x12, 0x10, 0xF3, 0x07, 0xF1, 0xF6, 0x0D, 0xF0, 0x08, 0xEE,
+0xFF, 0x02, 0x01, 0xFA, 0xFF, 0x06, 0x02, 0x04, 0x00, 0xFE, 0x01, 0x00, 0x05, 0xFC, 0x03, 0x04,
+0x03, 0xFB, 0xFD, 0xFB, 0x04, 0xFC, 0x05, 0xFB, 0x00, 0x02, 0x05, 0x04, 0xFF, 0xFB, 0x03, 0x02,
+0x04, 0xFF, 0x01, 0x03, 0xFF, 0x02, 0x03, 0xFA, 0xFD, 0x04, 0x01, 0x05, 0x03, 0x02, 0x02, 0xFC,
+0xFF, 0xFB, 0xFC, 0x02, 0x03, 0xFE, 0x01, 0xFC, 0x05, 0x06, 0x01, 0x05, 0x06, 0xFB, 0xFE, 0x00,
+0x0A, 0x08, 0xEC, 0x0A, 0xF0, 0x08, 0x0A, 0x0D, 0xFB, 0x03, 0xEF, 0x0C, 0x09, 0xFB, 0xF7, 0xF4,
+0x0D, 0xF0, 0x11, 0x0E, 0x0D, 0xF4, 0x11, 0x0B, 0xF5, 0x09, 0xF3, 0xEF, 0x0F, 0xF5, 0x0A, 0xE9,
+0x09, 0x13, 0xEE, 0x0F, 0xFA, 0x10, 0x14, 0x0E, 0x00, 0xFC, 0xEE, 0x03, 0x15, 0x02, 0xF2, 0xF5,
+0x0E, 0xF1, 0x0F, 0x08, 0x11, 0xF2, 0x0C, 0x13, 0xFB, 0x0A, 0xF6, 0xF6, 0x09, 0xF4, 0x0E, 0xE3,
+0x04, 0x04, 0x04, 0xFD, 0x01, 0x02, 0xFA, 0x05, 0x06, 0xFB, 0x00, 0xF9, 0x00, 0xFD, 0xFB, 0xFD,
+0xFF, 0xFD, 0x04, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x03, 0xF5, 0xF9, 0x06, 0x03, 0x05, 0xFE, 0xFD,
+0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02, 0x02, 0x00, 0xFD, 0xFE, 0x01, 0xFE,
+0x02, 0x03, 0x02, 0x00, 0x04, 0x01, 0x00, 0xFA, 0xFF, 0xF2, 0xFE, 0x04, 0x01, 0x06, 0xFE, 0xE6,
+0xFF, 0x00, 0xFE, 0x04, 0x03, 0x03, 0x01, 0x03, 0xFE, 0x04, 0x00, 0x02, 0x00, 0xFB, 0xFD, 0xFD,
+0xFD, 0x02, 0x01, 0x01, 0x01, 0x04, 0xFE, 0xFD, 0x02, 0xF2, 0xFF, 0xFE, 0x08, 0x04, 0x01, 0xD6,
+0x01, 0x03, 0xFF, 0x01, 0xFF, 0xFE, 0xFF, 0x02, 0xFB, 0x04, 0x03, 0x01, 0xFF, 0xFB, 0xFF, 0x01,
+0xFE, 0xFF, 0x01, 0x00, 0x01, 0x01, 0x02, 0xFE, 0xFE, 0xEF, 0x02, 0xFD, 0x00, 0x06, 0x02, 0xC2,
+0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0xFE, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0xFC, 0xFB, 0xFF, 0x03,
+0xFF, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0xFE, 0xEE, 0xFE, 0xFE, 0xFF, 0x09, 0x01, 0xF6,
+0x01, 0x02, 0x01, 0xFD, 0x03, 0xFF, 0x03, 0x02, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x00,
+0x00, 0xFF, 0x01, 0x01, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xF2, 0x00, 0x00, 0x04, 0x02, 0x02, 0xD3,
+0x03, 0x01, 0xFC, 0x00, 0xFF, 0x03, 0x03, 0x03, 0xFE, 0x06, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0x00,
+0x00, 0x01, 0xFF, 0xFF, 0x04, 0xFD, 0x04, 0x03, 0xFE, 0xF3, 0x01, 0x01, 0x05, 0x00, 0x03, 0xE7,
+0x00, 0x00, 0xFC, 0x04, 0xFD, 0x03, 0x04, 0x01, 0xFD, 0x07, 0x04, 0x01, 0x04, 0xFA, 0x03, 0xFC,
+0x04, 0xFC, 0x04, 0x03, 0x04, 0x01, 0xFD, 0xFE, 0x03, 0xF5, 0x01, 0xFE, 0x00, 0x07, 0xFE, 0xED,
+0x01, 0x02, 0x02, 0xFD, 0xFE, 0x02, 0x00, 0xFD, 0x00, 0xFD, 0x04, 0x00, 0xFD, 0xFC, 0xFC, 0xFA,
+0x01, 0xFE, 0xFE, 0xFF, 0xFC, 0xFF, 0xFE, 0xFA, 0xFF, 0xFB, 0xF8, 0xFE, 0x04, 0x04, 0x00, 0xF3,
+0xFE, 0x05, 0x01, 0x02, 0x02, 0x00, 0xFF, 0xFB, 0xFD, 0xFC, 0x03, 0xFF, 0xFA, 0xFF, 0xFB, 0xFF,
+0x01, 0xFD, 0x00, 0x01, 0xFF, 0x04, 0xFE, 0x03, 0xFE, 0xFD, 0xFE, 0x03, 0x05, 0x00, 0x05, 0xED,
+0x01, 0xFD, 0xFE, 0xFE, 0xFF, 0x02, 0x01, 0x02, 0xFF, 0xFD, 0x01, 0x03, 0xFC, 0xFD, 0x00, 0xFF,
+0x02, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0xFC, 0xFE, 0xF4, 0xFF, 0x01, 0x05, 0x02, 0xFF, 0xB8,
+0x01, 0x00, 0x01, 0x01, 0x00, 0x02, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0x02, 0xFD, 0xFC, 0xFF, 0xFF,
+0xFF, 0x01, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x02, 0x00, 0xF4, 0x01, 0x00, 0x01, 0x04, 0x00, 0xBB,
+0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x02, 0xFE, 0xFE, 0x00, 0x00,
+0x03, 0x02, 0x00, 0x01, 0xFE, 0x01, 0x01, 0xFE, 0x00, 0xF4, 0x00, 0xFF, 0x04, 0x02, 0xFF, 0xCF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x02, 0xFF, 0x02, 0xFF, 0xFE, 0xFD, 0x00,
+0xFE, 0x03, 0xFF, 0xFF, 0x01, 0xFB, 0x03, 0x00, 0xFF, 0xF3, 0x00, 0xFF, 0x03, 0x06, 0x00, 0xD7,
+0xFF, 0x01, 0x03, 0x02, 0xFF, 0x01, 0xFF, 0x03, 0xFD, 0xFD, 0xFF, 0x00, 0xFA, 0x02, 0xFF, 0xFA,
+0x07, 0x04, 0x01, 0x01, 0xFE, 0x04, 0x05, 0x01, 0x03, 0xFE, 0xF8, 0x02, 0x03, 0x00, 0xFD, 0xD5,
+0x00, 0x01, 0x01, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x02, 0x00, 0x00, 0xFD, 0xFE, 0xFB, 0xFE, 0x06,
+0x01, 0xFE, 0x04, 0x05, 0xFF, 0x02, 0x03, 0xFE, 0xFB, 0xFF, 0xFD, 0xFD, 0x07, 0x05, 0xFC, 0xEB,
+0xFE, 0x02, 0xFF, 0xFF, 0x03, 0xFB, 0x03, 0x01, 0xFE, 0xFF, 0x00, 0x03, 0xF9, 0xFC, 0x07, 0x00,
+0x00, 0xFE, 0xFE, 0x05, 0x00, 0x06, 0x02, 0xFF, 0xFB, 0x07, 0x02, 0x00, 0x03, 0xFF, 0xF9, 0x04,
+0x07, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0xFC, 0xFE, 0x01, 0xF9, 0xFE, 0x04, 0xFC, 0xFE, 0xFF, 0x03,
+0x03, 0x00, 0xFA, 0xFE, 0x03, 0x05, 0x00, 0xFE, 0xFF, 0x03, 0xFC, 0x01, 0x0C, 0xFF, 0x05, 0xE0,
+0x02, 0x01, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xFD, 0xFF, 0xFE,
+0x04, 0xFD, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0x06, 0x03, 0xC1,
+0x03, 0xFF, 0x01, 0xFD, 0xFD, 0x00, 0x02, 0x03, 0xFE, 0x01, 0xFE, 0x02, 0xFE, 0xFC, 0xFF, 0x02,
+0x02, 0xFF, 0xFF, 0x01, 0xFE, 0xFE, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0xFB, 0x00, 0x08, 0xFE, 0xB8,
+0x03, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xFC, 0x06, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0x00,
+0x01, 0x03, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x03, 0x06, 0xFD, 0xC3,
+0x00, 0x02, 0x00, 0xFF, 0xFE, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0xFF, 0xFD, 0xFD, 0x01,
+0x00, 0x00, 0x00, 0xFE, 0x01, 0xFF, 0xFE, 0xFD, 0x01, 0xFC, 0xFE, 0xFD, 0x03, 0x04, 0x01, 0xC3,
+0xFE, 0x03, 0xFE, 0xFD, 0x05, 0xFF, 0x02, 0x01, 0xFF, 0xF9, 0x00, 0x02, 0x04, 0x02, 0xFC, 0x01,
+0x05, 0x00, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x05, 0x03, 0x01, 0xFF, 0x03, 0x02, 0x04, 0xC8,
+0x02, 0xFC, 0x04, 0x01, 0x03, 0xFE, 0xF8, 0x02, 0x00, 0x04, 0x05, 0xFD, 0x00, 0x09, 0xFF, 0x01,
+0x05, 0x01, 0x03, 0x02, 0x06, 0xFC, 0x03, 0x05, 0x00, 0x09, 0x06, 0x00, 0x01, 0x01, 0x00, 0xF9,
+0xFE, 0x03, 0x05, 0x04, 0x01, 0x06, 0x03, 0xFE, 0x07, 0xFD, 0xFE, 0xFB, 0x07, 0x05, 0xFC, 0xFF,
+0xFE, 0x04, 0x02, 0x01, 0xF9, 0xFD, 0x01, 0xFF, 0xFF, 0x0C, 0x03, 0x04, 0x05, 0x02, 0x03, 0xF7,
+0x00, 0x00, 0xFD, 0x01, 0x05, 0x01, 0x06, 0x04, 0x05, 0x01, 0xFC, 0xFA, 0x03, 0x0A, 0xFD, 0xFC,
+0xFD, 0x01, 0xFE, 0x03, 0x00, 0x00, 0xFF, 0x07, 0x08, 0x00, 0x01, 0x07, 0x0C, 0x0B, 0x06, 0xF3,
+0x01, 0x03, 0xFE, 0xFF, 0x02, 0x02, 0x03, 0x00, 0x01, 0xFE, 0xFB, 0x01, 0x00, 0xFE, 0xFB, 0x00,
+0xFE, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFD, 0x02, 0xF6, 0x01, 0xFD, 0x02, 0x04, 0xFF, 0xC6,
+0x03, 0x00, 0x02, 0xFD, 0x01, 0x00, 0x01, 0x02, 0xFF, 0x04, 0xFA, 0x02, 0xFF, 0xFC, 0xFE, 0x04,
+0x01, 0x00, 0x01, 0x00, 0xFD, 0x01, 0xFD, 0x01, 0xFF, 0xF3, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xC1,
+0x01, 0xFF, 0x00, 0xFB, 0xFF, 0x00, 0x02, 0x03, 0xFC, 0x02, 0xFE, 0x07, 0xFD, 0xFB, 0x02, 0x02,
+0xFD, 0x02, 0x00, 0xFD, 0xFF, 0x02, 0xFC, 0x02, 0xFB, 0xF1, 0x00, 0xFF, 0xFC, 0xFE, 0xFF, 0xC4,
+0x03, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x04, 0x03, 0xFF, 0xFB, 0xFE, 0x00, 0xFF, 0x02, 0xFD, 0xFF,
+0xFE, 0xFF, 0x00, 0x01, 0x03, 0xFE, 0xFE, 0x01, 0xFE, 0xF7, 0xFB, 0xFF, 0xF9, 0x05, 0xFA, 0xC8,
+0x00, 0xFD, 0x03, 0x02, 0xFB, 0x00, 0xFB, 0xFC, 0x00, 0xFF, 0xFE, 0x03, 0x02, 0xFE, 0x02, 0xFE,
+0xFF, 0x00, 0xFC, 0xFE, 0xFB, 0x02, 0xFD, 0x00, 0xFA, 0xFE, 0x00, 0xFE, 0x06, 0x00, 0xFE, 0xE7,
+0x04, 0x02, 0xFD, 0xFC, 0x04, 0xFE, 0xFF, 0xFA, 0x01, 0x02, 0xFE, 0x05, 0xFD, 0xFE, 0xFC, 0xFA,
+0xFC, 0x07, 0x04, 0xFA, 0xFF, 0x00, 0xFF, 0xF9, 0x03, 0x05, 0xFC, 0x00, 0xFB, 0xFE, 0xFF, 0xF3,
+0x00, 0x08, 0x01, 0x06, 0xF9, 0x09, 0x03, 0x07, 0x0E, 0x00, 0xFB, 0xF8, 0x01, 0x0A, 0xFE, 0xFB,
+0xF8, 0xFE, 0xFF, 0x02, 0x03, 0xFA, 0x02, 0x04, 0x05, 0x0A, 0x0A, 0xFC, 0xF5, 0x0C, 0xFE, 0xF9,
+0x05, 0x01, 0xFF, 0x03, 0x04, 0xFE, 0x03, 0x05, 0x0A, 0xFA, 0xFF, 0xFF, 0x00, 0x06, 0xF8, 0xFE,
+0x01, 0xF7, 0x03, 0x01, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0xFC, 0x04, 0x05, 0x03, 0x0B, 0xFF, 0xE9,
+0xFF, 0x03, 0xFE, 0xFD, 0x01, 0x02, 0x09, 0xFE, 0x02, 0xFF, 0xFC, 0x04, 0xFD, 0x05, 0x00, 0xFE,
+0x00, 0xFA, 0x01, 0xFE, 0xFF, 0xFD, 0x03, 0x03, 0x00, 0xF7, 0x04, 0x04, 0x02, 0x06, 0x03, 0xEA,
+0x00, 0xFF, 0xFB, 0xFE, 0x05, 0x00, 0x02, 0x00, 0x05, 0xFE, 0xFF, 0xFD, 0x01, 0x04, 0xFA, 0xFD,
+0xFE, 0xFF, 0xFE, 0x01, 0x00, 0xF7, 0x09, 0x01, 0x00, 0xF0, 0xFE, 0x05, 0xFA, 0xFC, 0x01, 0xBD,
+0xF9, 0x02, 0xFA, 0x01, 0x02, 0x03, 0x00, 0x06, 0x06, 0xF9, 0x04, 0xFE, 0xFD, 0xFD, 0x01, 0xFE,
+0xFE, 0x00, 0xFE, 0xFD, 0x00, 0xF4, 0x03, 0x05, 0x02, 0xEF, 0x00, 0x00, 0xF7, 0xFB, 0x05, 0xD0,
+0x02, 0xFE, 0x04, 0x02, 0x04, 0x03, 0x04, 0x02, 0x06, 0xFE, 0xFE, 0xFF, 0xFE, 0xFC, 0x04, 0xFE,
+0x00, 0x00, 0x02, 0x03, 0x03, 0x01, 0xFD, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x06, 0xFF, 0xFD, 0xD9,
+0xF8, 0xFF, 0x03, 0x00, 0x01, 0x03, 0xFE, 0xFF, 0x04, 0x04, 0x03, 0x04, 0xF8, 0xFB, 0x07, 0xFC,
+0x02, 0x04, 0xF9, 0x03, 0x05, 0xFC, 0x00, 0x00, 0xFA, 0xFD, 0xFD, 0x02, 0x04, 0x06, 0xFD, 0xE9,
+0x02, 0x02, 0x00, 0xFA, 0xF6, 0xFE, 0xF8, 0xFE, 0xFD, 0x0A, 0xFD, 0xF9, 0xF6, 0x02, 0x03, 0x02,
+0xFD, 0x07, 0x03, 0xFC, 0xFC, 0xFE, 0x04, 0xF5, 0xFC, 0xF8, 0xFC, 0xF9, 0xFC, 0x00, 0xFA, 0xFD,
+0x03, 0x03, 0x02, 0x02, 0xFD, 0x00, 0xFF, 0x02, 0x01, 0xF8, 0x04, 0x03, 0x02, 0x02, 0xFE, 0xFE,
+0xFD, 0xFC, 0x04, 0xFB, 0x01, 0xFF, 0xFA, 0xFB, 0xFC, 0x0A, 0xFE, 0x05, 0xFC, 0x03, 0x01, 0x04,
+0x04, 0x00, 0xFE, 0x02, 0x06, 0x03, 0x02, 0xFC, 0x02, 0x04, 0x06, 0x00, 0x04, 0x01, 0x00, 0xFD,
+0xFE, 0x03, 0xFF, 0xFB, 0xFB, 0x02, 0xFD, 0xFD, 0xFA, 0x00, 0x05, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE,
+0xFE, 0x07, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0xFB, 0x07, 0x00, 0x02, 0xFA,
+0x02, 0x01, 0x03, 0xFB, 0xFB, 0x00, 0x01, 0x06, 0x03, 0xFA, 0xFD, 0x00, 0x02, 0x01, 0xFB, 0xE8,
+0xFA, 0x01, 0xFD, 0x01, 0x05, 0xFC, 0x02, 0xFB, 0x03, 0x00, 0xF9, 0xFC, 0x02, 0xFB, 0xFF, 0x05,
+0x05, 0xFD, 0xFB, 0x03, 0x04, 0xFD, 0xFE, 0xFC, 0x00, 0xF8, 0xFA, 0xFC, 0x05, 0x01, 0x02, 0xE3,
+0x01, 0xFF, 0xFC, 0x04, 0x00, 0xFC, 0x02, 0x00, 0xFF, 0x03, 0xFC, 0x05, 0xFE, 0x03, 0xFF, 0x00,
+0x04, 0x05, 0x01, 0xFC, 0x02, 0x01, 0xFF, 0x01, 0x02, 0xF6, 0x05, 0x04, 0xFE, 0xFD, 0x04, 0xE3,
+0xFD, 0x00, 0x04, 0x04, 0xFF, 0xFE, 0x01, 0xFE, 0x02, 0x01, 0xF9, 0x05, 0x06, 0x00, 0x02, 0x02,
+0x06, 0xFA, 0xFD, 0x03, 0x01, 0xFE, 0xFE, 0x02, 0x04, 0xFD, 0x07, 0x01, 0xF7, 0xFF, 0x01, 0xEC,
+0xFE, 0x05, 0x01, 0x00, 0x04, 0x01, 0x00, 0xFA, 0xFD, 0x00, 0x02, 0xFC, 0xFA, 0xFB, 0xFE, 0xFF,
+0x03, 0x01, 0xFF, 0xFE, 0xFD, 0x08, 0xFC, 0xFC, 0xF9, 0xFF, 0xFB, 0xFC, 0x09, 0x03, 0x01, 0xED,
+0xFD, 0xF7, 0x01, 0xF7, 0x00, 0xF7, 0xF9, 0x06, 0xF9, 0x0C, 0x0B, 0x01, 0xFC, 0x02, 0x05, 0xF9,
+0x05, 0xFD, 0x00, 0x05, 0xFE, 0x03, 0xFE, 0x06, 0xFE, 0x05, 0x02, 0x07, 0xFC, 0x00, 0xFD, 0xF1,
+0x04, 0x01, 0x02, 0xFA, 0x02, 0xF9, 0x01, 0xFA, 0xF8, 0x03, 0xFE, 0x05, 0xFB, 0xF9, 0xFC, 0x02,
+0x01, 0x08, 0xFD, 0x08, 0xFA, 0x06, 0x03, 0x04, 0xF7, 0x02, 0x03, 0x07, 0xFF, 0xFB, 0xFB, 0xFA,
+0xF9, 0x05, 0xFE, 0xFE, 0x06, 0xFE, 0x02, 0x01, 0xFD, 0xFC, 0xFF, 0xFC, 0xFA, 0xF9, 0xFA, 0xFC,
+0x00, 0x04, 0x08, 0x02, 0xFD, 0xFC, 0xFB, 0x01, 0x07, 0xFC, 0xFB, 0x03, 0xFA, 0x06, 0xFE, 0xF6,
+0x06, 0x05, 0x06, 0xF8, 0xFC, 0x05, 0x00, 0xFD, 0x00, 0x0D, 0x03, 0xFB, 0x01, 0xFC, 0xFE, 0xFB,
+0xFD, 0x03, 0xFE, 0x02, 0x00, 0x06, 0x00, 0xF8, 0xFF, 0xFD, 0xFD, 0x01, 0xF7, 0x05, 0xFF, 0xF1,
+0x07, 0x05, 0x02, 0x00, 0xFA, 0x0B, 0xFB, 0x01, 0xFF, 0x06, 0x08, 0xFA, 0xFE, 0x00, 0x0B, 0x02,
+0x05, 0xFF, 0xFE, 0xFC, 0x02, 0x01, 0x02, 0x01, 0xFE, 0xFB, 0x02, 0x01, 0xF9, 0x01, 0xFE, 0xF0,
+0x00, 0x00, 0x02, 0x01, 0x03, 0x06, 0xFB, 0xFF, 0xFD, 0xFE, 0x04, 0x04, 0xFC, 0xFE, 0x01, 0x05,
+0xFD, 0x02, 0x02, 0x05, 0x05, 0x06, 0xFB, 0xFF, 0xFF, 0x02, 0xFB, 0x05, 0xFF, 0x01, 0xFD, 0x02,
+0xFB, 0xFB, 0x00, 0xFF, 0x06, 0x00, 0xFA, 0x05, 0xFF, 0xFE, 0xFD, 0xFD, 0xFE, 0xFA, 0xFE, 0xFF,
+0xFD, 0x03, 0x03, 0x06, 0xFC, 0xFB, 0x06, 0x04, 0x00, 0x02, 0x02, 0x03, 0xFC, 0x03, 0x00, 0xFF,
+0x01, 0x01, 0xFC, 0xFD, 0xFF, 0x02, 0xFD, 0xFD, 0x06, 0xFB, 0x00, 0xFF, 0x00, 0xFB, 0x01, 0xFF,
+0x05, 0x05, 0x03, 0x02, 0xFC, 0xFC, 0xFA, 0xFE, 0x00, 0x01, 0xFD, 0xFC, 0xFA, 0x01, 0xFF, 0xFA,
+0xFF, 0xFB, 0xFE, 0xFD, 0xFD, 0x05, 0x00, 0x03, 0x03, 0x05, 0x04, 0xF9, 0x03, 0x01, 0xFC, 0xFD,
+0xFD, 0xFF, 0x00, 0x05, 0xFE, 0x04, 0xFE, 0xFE, 0xFF, 0x03, 0x06, 0x00, 0x05, 0x05, 0xFA, 0xF2,
+0xFD, 0xFA, 0xFC, 0xFF, 0xFD, 0x00, 0xFD, 0x03, 0xFE, 0x00, 0xFE, 0xFE, 0x02, 0x07, 0x01, 0x06,
+0x02, 0x00, 0xFB, 0xF9, 0xF9, 0x04, 0x02, 0xFF, 0x04, 0x04, 0xFD, 0x05, 0x05, 0x04, 0xFB, 0xF7,
+0xF7, 0x02, 0x00, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x07, 0xFC, 0xFE, 0xFC, 0x05, 0x05, 0xFB, 0xF9,
+0x02, 0xFF, 0xFA, 0x0A, 0x01, 0xFC, 0x08, 0xFC, 0x09, 0xFA, 0xFD, 0x07, 0x03, 0x09, 0x06, 0xFC,
+0x05, 0xFA, 0x00, 0xFB, 0x01, 0xFF, 0xFC, 0xFF, 0xFE, 0x00, 0x02, 0xFB, 0x07, 0x04, 0x04, 0xFE,
+0x07, 0x00, 0xFD, 0x02, 0xFD, 0x03, 0xFB, 0x03, 0x01, 0x04, 0x00, 0xF9, 0xFD, 0x03, 0x02, 0xF8,
+0x00, 0xFD, 0x01, 0x05, 0x01, 0x02, 0x02, 0x00, 0x04, 0xFB, 0x05, 0x06, 0xFF, 0x04, 0x06, 0x03,
+0xFA, 0x05, 0x01, 0x03, 0x06, 0xFD, 0x03, 0x04, 0x06, 0x03, 0x02, 0xFB, 0xFD, 0xFF, 0x04, 0xFD,
+0xFC, 0xFE, 0xFD, 0xFC, 0x05, 0xFF, 0xFF, 0xFA, 0xFD, 0x01, 0xFE, 0x01, 0x00, 0xFF, 0xFF, 0x00,
+0xFE, 0xFB, 0xFA, 0x04, 0xFA, 0xFC, 0x02, 0xFB, 0x03, 0xFC, 0xFE, 0xFE, 0xFD, 0xFA, 0x04, 0x01,
+0xFB, 0xFD, 0xFF, 0x02, 0x06, 0xFC, 0x03, 0xFF, 0xFC, 0x01, 0xFB, 0xFC, 0xFB, 0x00, 0x06, 0xFB,
+0xFF, 0xFF, 0x01, 0x03, 0x06, 0x04, 0x01, 0xFA, 0x06, 0x06, 0x03, 0xFB, 0x06, 0x05, 0x03, 0xFE,
+0x00, 0x05, 0x04, 0x06, 0xFE, 0xFD, 0xFC, 0x05, 0x01, 0x04, 0xFD, 0x03, 0xFB, 0x02, 0x04, 0xFB,
+0xFD, 0xFE, 0xFD, 0xFA, 0x05, 0xFC, 0xFD, 0xFA, 0x04, 0x05, 0x00, 0x02, 0x04, 0x02, 0xFB, 0xF8,
+0x05, 0xFD, 0x04, 0x03, 0x05, 0x00, 0x01, 0x03, 0xFF, 0x04, 0x05, 0x01, 0x02, 0x04, 0x06, 0x01,
+0xFA, 0x06, 0xFD, 0xFB, 0xFB, 0xFD, 0x06, 0x04, 0xFE, 0x00, 0xFE, 0x01, 0xFF, 0xFE, 0xFE, 0xFB,
+0xFC, 0x01, 0x06, 0xFA, 0x05, 0x02, 0xFA, 0x00, 0xFF, 0x05, 0xFA, 0x06, 0x01, 0x04, 0x06, 0xFA,
+0x02, 0x00, 0x02, 0x03, 0x05, 0xFF, 0x05, 0x00, 0x02, 0x01, 0x01, 0xFD, 0xFD, 0xFA, 0xFC, 0xFC,
+0x03, 0x01, 0x05, 0x03, 0xFF, 0xFD, 0xFB, 0xFA, 0x06, 0x04, 0xFA, 0x05, 0x06, 0x00, 0x01, 0xFB,
+0x03, 0x04, 0x00, 0xFF, 0x01, 0xFD, 0xFF, 0x00, 0xFD, 0x04, 0xFD, 0x05, 0x02, 0x06, 0x02, 0xFE,
+0xFB, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x04, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xFE, 0x02, 0x05, 0xFA,
+0x06, 0xFC, 0xFF, 0x00, 0x05, 0xFB, 0xFA, 0x00, 0xFC, 0x06, 0x06, 0xFD, 0xFD, 0xFB, 0xFF, 0xFE,
+0xFD, 0xFF, 0x01, 0x04, 0x02, 0xFD, 0x03, 0x01, 0xFE, 0x02, 0xFC, 0xFB, 0x06, 0x04, 0x04, 0x01,
+0xFC, 0xFC, 0x00, 0x04, 0x03, 0x04, 0x06, 0xFF, 0x02, 0xFE, 0x06, 0xFE, 0xFE, 0x02, 0x05, 0x05,
+0xFD, 0xFA, 0xFD, 0xFA, 0xFE, 0xFC, 0xFD, 0x05, 0x00, 0x04, 0xFE, 0x01, 0x06, 0x04, 0x05, 0xFE,
+0xFF, 0x04, 0x05, 0x01, 0xFB, 0xFD, 0xFD, 0xFB, 0x04, 0x02, 0xFD, 0x06, 0x04, 0x02, 0x05, 0xFD,
+0xFB, 0x00, 0x02, 0x05, 0x05, 0x02, 0xFA, 0x05, 0xFD, 0xFB, 0x01, 0x03, 0x04, 0xFD, 0x05, 0x05,
+0xFC, 0x01, 0xFE, 0x01, 0xFF, 0x04, 0xFA, 0x04, 0xFD, 0x06, 0x04, 0xFC, 0xFC, 0xFD, 0x03, 0xFE,
+0x05, 0xFB, 0x04, 0x05, 0xFC, 0x02, 0x05, 0x04, 0x06, 0xFB, 0xFA, 0x01, 0x04, 0x04, 0xFA, 0x01,
+0x04, 0x03, 0x00, 0x03, 0x00, 0x01, 0x06, 0xFE, 0xFF, 0x06, 0x03, 0x03, 0xFE, 0x02, 0xFC, 0xFA,
+0xFE, 0xFD, 0x02, 0x05, 0xFF, 0x03, 0x02, 0x05, 0xFE, 0x06, 0xFC, 0xFE, 0xFF, 0xFA, 0xFF, 0x02,
+0xFA, 0x02, 0x06, 0xFB, 0x04, 0xFF, 0xFB, 0x03, 0x02, 0x05, 0x03, 0xFA, 0x00, 0xFC, 0x01, 0x05,
+0xFB, 0xFE, 0x01, 0xFA, 0x04, 0xFF, 0xFD, 0x00, 0xFE, 0x02, 0x02, 0x00, 0xF9, 0x05, 0x06, 0x01,
+0x01, 0x02, 0xFD, 0xFF, 0xFC, 0x01, 0xF7, 0xFD, 0x03, 0x08, 0x02, 0x05, 0xFD, 0x02, 0xF6, 0xFF,
+0xFE, 0xFE, 0x03, 0xFC, 0x02, 0xFF, 0xFF, 0xFB, 0x06, 0xFD, 0x05, 0xFC, 0x00, 0x02, 0x01, 0x03,
+0xFB, 0x02, 0xFC, 0x01, 0xFB, 0x04, 0xF9, 0xFE, 0x00, 0x03, 0x00, 0x04, 0xFB, 0x04, 0xFC, 0x00,
+0xF9, 0x00, 0x04, 0x00, 0x03, 0xFD, 0xFC, 0xFF, 0xFE, 0xFD, 0x02, 0xFD, 0x03, 0x00, 0xFF, 0x05,
+0xFE, 0x07, 0xFB, 0xFB, 0xFD, 0x04, 0xFD, 0xFB, 0xFF, 0x05, 0x01, 0x04, 0xF9, 0x05, 0x03, 0xFF,
+0xFE, 0xFC, 0xFE, 0xF6, 0x02, 0xF8, 0x01, 0xFD, 0x06, 0xFA, 0x02, 0xF9, 0xFB, 0x01, 0x00, 0x00,
+0x02, 0x01, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x07, 0x04, 0x04, 0x02, 0xFE, 0x01, 0xFE, 0x07,
+0xFC, 0xF9, 0x08, 0xF9, 0xFD, 0x02, 0xFB, 0xFB, 0xFF, 0x03, 0x01, 0xFC, 0xFC, 0x04, 0x05, 0x05,
+0xFF, 0x05, 0xFE, 0xFB, 0xFE, 0x02, 0xFE, 0xF7, 0xFF, 0x00, 0x05, 0xFF, 0xFE, 0xFF, 0xFE, 0x04,
+0x00, 0xFA, 0x0A, 0x00, 0xFF, 0x01, 0xFC, 0xFB, 0x03, 0x04, 0x00, 0xFA, 0xFC, 0x01, 0x00, 0x00,
+0x02, 0x02, 0xFF, 0xFF, 0xFA, 0x08, 0xFA, 0xFC, 0x00, 0x05, 0x01, 0x08, 0xFD, 0x04, 0x00, 0x01,
+0xFA, 0x02, 0x04, 0xFD, 0x03, 0xFB, 0xFE, 0xF8, 0x01, 0xFB, 0x06, 0xFC, 0xFF, 0x01, 0x03, 0x01,
+0x00, 0x01, 0xFE, 0xFF, 0xFD, 0x05, 0xF9, 0xF9, 0x03, 0x06, 0x02, 0x04, 0x03, 0x03, 0x00, 0xFF,
+0xFC, 0xFF, 0x03, 0xFD, 0x05, 0xFE, 0xFA, 0xFB, 0x02, 0xFB, 0x04, 0xFD, 0x00, 0x01, 0x01, 0x02,
+0x00, 0x01, 0xFF, 0xFD, 0xFD, 0x02, 0xFB, 0xFD, 0x01, 0x06, 0x04, 0x03, 0xFD, 0x05, 0xFC, 0x04,
+0x02, 0xFF, 0xFE, 0xFC, 0x02, 0x00, 0xFC, 0xFE, 0x02, 0x00, 0x01, 0xFD, 0xFE, 0x01, 0x03, 0x02,
+0xFD, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFC, 0xFE, 0x02, 0x07, 0x01, 0x01, 0xF8, 0x03, 0xFE, 0x02,
+0xFF, 0xFF, 0x06, 0x02, 0xFF, 0x00, 0xFE, 0xFE, 0x02, 0x03, 0x03, 0x01, 0xFD, 0x00, 0x05, 0x07,
+0xFF, 0x02, 0xFE, 0xFF, 0x01, 0x06, 0xFF, 0xFE, 0x03, 0x06, 0x03, 0xFD, 0xFF, 0x02, 0xFA, 0x07,
+0xFE, 0xFD, 0xFF, 0x01, 0x05, 0xFF, 0x01, 0xFF, 0x00, 0x02, 0x04, 0xFC, 0xFF, 0x00, 0x08, 0x03,
+0xFE, 0x04, 0xFE, 0xFD, 0xFF, 0x00, 0xFB, 0xFF, 0x03, 0x04, 0x01, 0x05, 0x02, 0x04, 0xFE, 0x01,
+0xFB, 0x01, 0x03, 0x01, 0x03, 0x00, 0xFE, 0x01, 0x04, 0xF8, 0x00, 0xFF, 0x00, 0x05, 0xFF, 0x07,
+0xFE, 0xFD, 0xFE, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x05, 0x03, 0x03, 0x01, 0x03, 0x07, 0xFC, 0x03,
+0x01, 0xFC, 0xFF, 0xFC, 0x03, 0xFF, 0x01, 0xFB, 0x01, 0xFD, 0xFF, 0x00, 0x01, 0x05, 0x04, 0x05,
+0xFE, 0x03, 0xFD, 0x02, 0xFD, 0x03, 0xFE, 0x00, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0xFC, 0x04,
+0xFE, 0x00, 0x05, 0x00, 0x00, 0xFB, 0x00, 0xFF, 0x01, 0xFD, 0x02, 0x00, 0xFE, 0x06, 0x03, 0x01,
+0xFD, 0x00, 0xFD, 0x00, 0xFE, 0x01, 0xFC, 0xFC, 0x05, 0x05, 0xFE, 0x01, 0x01, 0x02, 0x00, 0x02,
+0xFF, 0xFB, 0x06, 0x01, 0xFE, 0x02, 0xFC, 0x01, 0x00, 0x00, 0x05, 0xFC, 0xFD, 0x02, 0x06, 0x01,
+0xFF, 0x00, 0x00, 0xFE, 0xFB, 0x08, 0xFD, 0xFE, 0xFF, 0x06, 0xFF, 0x01, 0xFC, 0x02, 0x00, 0x00,
+0xFD, 0xFE, 0x02, 0x00, 0x05, 0xFE, 0xFE, 0xFE, 0x04, 0x00, 0x01, 0xFB, 0x01, 0x02, 0x02, 0x00,
+0xFE, 0x00, 0x00, 0x00, 0xFD, 0x03, 0xFD, 0x01, 0x01, 0x07, 0x02, 0x00, 0xFC, 0x04, 0x00, 0x04,
+0xFE, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xFD, 0xFC, 0x00, 0xFE, 0x01, 0xFE, 0xFE, 0x04, 0x03, 0x03,
+0xFF, 0x03, 0xFE, 0x00, 0xFD, 0x01, 0xFD, 0xFF, 0x02, 0x04, 0xFE, 0x02, 0xFC, 0x01, 0xFF, 0x05,
+0xFE, 0xFE, 0x00, 0xFE, 0x01, 0x00, 0x02, 0xFC, 0x03, 0xFD, 0x02, 0xFF, 0xFF, 0x02, 0x04, 0x00,
+0xFD, 0x01, 0xFE, 0x02, 0xFD, 0x04, 0xFC, 0xFF, 0x03, 0x05, 0x02, 0x03, 0xFE, 0x07, 0x03, 0x03,
+0xFC, 0xFD, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xFD, 0x00, 0x05, 0x01, 0x03,
+0xFE, 0x02, 0xFC, 0x00, 0xFE, 0x01, 0xFE, 0xFF, 0x03, 0x04, 0xFF, 0x02, 0x02, 0x06, 0x01, 0x04,
+0xFC, 0xFE, 0x02, 0xFE, 0x01, 0xFD, 0xFB, 0xFF, 0x01, 0xFE, 0x01, 0xFF, 0xFE, 0x04, 0xFF, 0x04,
+0xFF, 0x02, 0xFE, 0xFE, 0xFE, 0x01, 0xFF, 0xFE, 0x03, 0x02, 0x00, 0x03, 0x00, 0x02, 0xFE, 0x03,
+0x00, 0xFF, 0x02, 0xFB, 0x02, 0xFD, 0xFD, 0xFE, 0x02, 0xFF, 0x01, 0x01, 0x00, 0x02, 0x01, 0x02,
+0xFF, 0x04, 0xFF, 0xFC, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFD, 0x02, 0xFF, 0x04,
+0xFE, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0x04, 0xFD, 0x01, 0xFE, 0xFE, 0x06, 0x04, 0xFF,
+0xFF, 0x02, 0x00, 0xFD, 0xFD, 0x03, 0x01, 0xFD, 0x04, 0x04, 0xFE, 0x01, 0x02, 0x03, 0xFF, 0x02,
+0xFE, 0x00, 0x00, 0xFD, 0x03, 0xFF, 0xFB, 0xFB, 0x00, 0xFD, 0x04, 0x00, 0x00, 0x03, 0x00, 0x02,
+0xFE, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0xFA, 0x02, 0x06, 0x00, 0x01, 0x02, 0x04, 0xFD, 0x03,
+0x00, 0x01, 0x02, 0xFC, 0x03, 0x00, 0xFC, 0xFE, 0x01, 0xFD, 0x06, 0xFF, 0x00, 0x03, 0x03, 0x02,
+0xFF, 0x01, 0xFC, 0x00, 0xFE, 0x03, 0xFD, 0x00, 0x01, 0x05, 0x03, 0x01, 0xFF, 0x02, 0xFD, 0x02,
+0x01, 0x01, 0x02, 0x00, 0x02, 0xFE, 0xFF, 0xFE, 0x02, 0xFF, 0x01, 0xFE, 0xFF, 0x03, 0x02, 0x02,
+0xFF, 0x01, 0xFE, 0xFF, 0xFD, 0x01, 0xFD, 0xFE, 0x02, 0x04, 0x02, 0x01, 0xFD, 0x01, 0xFC, 0x04,
+0xFE, 0xFF, 0x04, 0xFE, 0x02, 0xFE, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x06, 0x02, 0x01,
+0x00, 0x00, 0xFF, 0xFF, 0x01, 0x02, 0xFF, 0x00, 0x02, 0x04, 0x01, 0x02, 0x02, 0x07, 0xFE, 0x03,
+0xFE, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0xFE, 0xFF, 0x01, 0xFD, 0x03, 0xFD, 0xFD, 0x04, 0x01, 0x02,
+0xFF, 0x02, 0x00, 0x00, 0xFE, 0x01, 0xFE, 0x02, 0x04, 0x04, 0x01, 0x04, 0xFE, 0x03, 0xFF, 0x03,
+0xFF, 0x00, 0x01, 0xFE, 0x04, 0xFE, 0xFF, 0x00, 0x04, 0xFC, 0x01, 0xFF, 0xFF, 0x02, 0x00, 0x04,
+0x01, 0x03, 0xFE, 0xFF, 0xFF, 0x00, 0xFE, 0xFE, 0x03, 0x03, 0x02, 0x00, 0xFE, 0x05, 0x00, 0x03,
+0xFE, 0xFE, 0x01, 0xFE, 0x03, 0x00, 0xFC, 0xFE, 0x01, 0xFF, 0x02, 0xFD, 0xFE, 0x03, 0x01, 0x01,
+0xFF, 0x02, 0xFE, 0xFF, 0xFD, 0x02, 0xFE, 0x01, 0x01, 0x01, 0x01, 0x03, 0xFF, 0x02, 0x00, 0x04,
+0x00, 0xFF, 0x01, 0xFB, 0x01, 0xFF, 0xFE, 0xFE, 0x02, 0xFD, 0x01, 0xFD, 0xFF, 0x02, 0x00, 0x00,
+0xFE, 0x02, 0xFE, 0xFE, 0xFF, 0x01, 0xFC, 0xFE, 0x03, 0x04, 0x00, 0x01, 0xFE, 0x00, 0xFB, 0x02,
+0xFD, 0xFF, 0x02, 0xFE, 0x02, 0xFE, 0xFB, 0xFF, 0x01, 0xFF, 0x02, 0xFF, 0x01, 0x00, 0x02, 0x02,
+0xFF, 0x03, 0xFD, 0xFE, 0xFF, 0x01, 0xFD, 0xFC, 0x02, 0x04, 0x01, 0xFF, 0x00, 0x02, 0x00, 0x03,
+0xFF, 0xFF, 0x04, 0xFF, 0x03, 0xFD, 0xFE, 0x00, 0x03, 0xFE, 0x03, 0xFD, 0xFF, 0x03, 0x02, 0x01,
+0xFF, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0xFF, 0x01, 0x04, 0x01, 0x00, 0xFD, 0x02, 0xFF, 0x03,
+0xFE, 0xFE, 0x01, 0xFD, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x00, 0xFF, 0x01, 0xFF, 0x04, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0x01, 0x00, 0x05, 0xFA, 0x06,
+0xFD, 0xFF, 0x04, 0xFF, 0x03, 0x01, 0xFC, 0xFF, 0x01, 0xFE, 0x02, 0xFD, 0xFE, 0x04, 0x03, 0x00,
+0xFF, 0x01, 0xFE, 0xFF, 0xFD, 0x01, 0x00, 0xFC, 0x02, 0x04, 0x01, 0x01, 0x01, 0x02, 0x00, 0xFF,
+0xFE, 0xFD, 0x05, 0xFC, 0x01, 0xFE, 0x01, 0x00, 0x02, 0xFF, 0x02, 0xFE, 0xFF, 0x04, 0x01, 0x02,
+0xFD, 0xFF, 0xFF, 0x00, 0xFE, 0x01, 0xFE, 0x02, 0x02, 0x03, 0x02, 0x03, 0xFF, 0x02, 0xFE, 0x04,
+0xFE, 0xFF, 0x05, 0xFE, 0x00, 0xFE, 0xFC, 0x01, 0x02, 0xFC, 0x02, 0xFE, 0xFF, 0x00, 0x03, 0x01,
+0x01, 0x00, 0xFD, 0xFE, 0x01, 0x02, 0x00, 0xFD, 0x04, 0x03, 0x02, 0x02, 0xFE, 0x03, 0xFC, 0x03,
+0xFE, 0xFF, 0x02, 0xFE, 0x02, 0xFC, 0x01, 0xFF, 0x05, 0xFD, 0x00, 0xFF, 0xFF, 0x04, 0x02, 0x00,
+0x00, 0x01, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0xFC, 0x04, 0x02, 0x01, 0x03, 0x00, 0x06, 0xFF, 0x04,
+0xFF, 0xFD, 0x03, 0xFF, 0x00, 0xFD, 0xFE, 0xFE, 0x02, 0x01, 0x00, 0xFD, 0xFF, 0x02, 0x01, 0x02,
+0xFE, 0x03, 0xFD, 0xFE, 0xFD, 0x03, 0xFE, 0xFA, 0x00, 0x04, 0x02, 0x00, 0xFF, 0x00, 0xFD, 0xFF,
+0xFE, 0xFE, 0x00, 0xFE, 0x01, 0x00, 0xFC, 0xFF, 0x03, 0xFC, 0x01, 0xFD, 0x03, 0x00, 0x02, 0x03,
+0xFE, 0x01, 0xFE, 0xFD, 0x01, 0x00, 0xFD, 0xFD, 0x02, 0x03, 0x03, 0x02, 0xFF, 0x03, 0xFE, 0x02,
+0xFF, 0xFF, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0xFF, 0x03, 0xFD, 0x03, 0xFE, 0xFE, 0x01, 0x00, 0x01,
+0xFD, 0x02, 0xFF, 0x00, 0xFF, 0x01, 0xFD, 0xFF, 0x01, 0x04, 0x01, 0x01, 0xFC, 0x05, 0x00, 0x03,
+0xFF, 0xFE, 0x00, 0xFD, 0x03, 0x00, 0xFF, 0xFD, 0x01, 0xFE, 0x00, 0xFC, 0xFF, 0x03, 0x02, 0x01,
+0x00, 0xFF, 0xFD, 0x00, 0xFC, 0x01, 0xFE, 0xFF, 0x03, 0x03, 0x01, 0x02, 0xFF, 0x03, 0xFC, 0x01,
+0xFC, 0xFD, 0x03, 0xFE, 0x01, 0xFE, 0xFE, 0x01, 0x03, 0xFE, 0x01, 0xFE, 0xFE, 0x02, 0x02, 0x01,
+0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x01, 0x02, 0x01, 0x00, 0x00, 0x04, 0xFE, 0x01,
+0xFE, 0xFD, 0x02, 0xFE, 0x02, 0xFD, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFD, 0xFD, 0x03, 0x01, 0x02,
+0xFF, 0x01, 0xFE, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0x02, 0x02, 0x03, 0xFE, 0x04, 0x00, 0x02,
+0x00, 0xFF, 0x04, 0x00, 0xFF, 0xFE, 0xFB, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0xFE, 0x02, 0x01, 0xFE,
+0x00, 0x01, 0xFD, 0x01, 0xFF, 0x03, 0x00, 0xFD, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0xFF, 0x00,
+0xFC, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFC, 0x01, 0xFC, 0x02, 0x03, 0x02, 0x02,
+0xFC, 0xFE, 0xFF, 0x02, 0xFC, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x04, 0x02, 0xFF,
+0xFE, 0xFF, 0x02, 0xFF, 0x01, 0xFD, 0x00, 0xFF, 0x03, 0xFE, 0x01, 0xFE, 0xFF, 0x04, 0x01, 0x02,
+0xFE, 0x02, 0xFE, 0xFF, 0xFE, 0x02, 0xFF, 0xFD, 0x01, 0x02, 0x01, 0x01, 0xFE, 0x04, 0xFE, 0x03,
+0xFD, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFD, 0x01, 0x02, 0xFD, 0x04, 0xFD, 0xFF, 0x02, 0x00, 0x01,
+0xFD, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0x02, 0x02, 0x01, 0x01, 0x00, 0x05, 0xFE, 0x02,
+0xFF, 0x01, 0x04, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0x03, 0xFD, 0x04, 0xFF, 0xFF, 0x04, 0x00, 0xFF,
+0xFE, 0x01, 0xFD, 0xFF, 0x00, 0x03, 0xFE, 0xFE, 0x02, 0x02, 0x01, 0x01, 0xFE, 0x02, 0x00, 0x01,
+0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 0xFB, 0x06, 0x00, 0xFE, 0xFE, 0xFB, 0x00, 0x01, 0xFB, 0xFA,
+0x04, 0x04, 0x03, 0x00, 0x03, 0x02, 0x03, 0x00, 0x05, 0x03, 0x02, 0x02, 0x05, 0xFE, 0xFE, 0x02,
+0xFA, 0xFD, 0xFB, 0x04, 0x03, 0x01, 0x06, 0x03, 0xFD, 0xFE, 0xFB, 0xFF, 0x01, 0xFD, 0x02, 0xFC,
+0x00, 0x01, 0xFB, 0x01, 0xFB, 0xFE, 0xFA, 0x04, 0x03, 0xFA, 0x02, 0x06, 0xFD, 0xFB, 0x03, 0xFC,
+0xFF, 0x01, 0xFE, 0xFF, 0xFC, 0x06, 0x03, 0xFD, 0x05, 0xFD, 0xFF, 0xFD, 0xFE, 0xFD, 0xFC, 0x04,
+0x01, 0x03, 0xFA, 0xFE, 0xFA, 0xFD, 0xFB, 0x01, 0x06, 0xFC, 0xFD, 0x05, 0x05, 0x05, 0x04, 0xFB,
+0x06, 0x06, 0x01, 0xFB, 0x05, 0x01, 0x01, 0x01, 0x00, 0xFF, 0xFF, 0xFA, 0xFA, 0x01, 0xFE, 0xFB,
+0x05, 0xFD, 0xFA, 0x00, 0x06, 0xFE, 0xFF, 0x05, 0x01, 0x00, 0xFD, 0x01, 0xFD, 0xFD, 0x06, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFB, 0x05, 0xFA, 0x01, 0xFD, 0x03, 0xFD, 0x05, 0xFF, 0x05, 0x02, 0x02, 0xFA,
+0x03, 0x03, 0xFB, 0xFA, 0x00, 0xFA, 0xFA, 0x02, 0x04, 0x02, 0x01, 0x04, 0x02, 0x00, 0xFE, 0x00,
+0xFF, 0xFE, 0xFA, 0x02, 0xFC, 0xFD, 0x05, 0x02, 0xFC, 0x02, 0x06, 0x03, 0x06, 0x05, 0xFD, 0xFB,
+0xFC, 0x05, 0xFA, 0x03, 0x05, 0xFF, 0x03, 0x04, 0xFF, 0x03, 0x05, 0xFB, 0x01, 0xFB, 0xFF, 0xFD,
+0x05, 0x03, 0xFB, 0x03, 0x03, 0xFE, 0x01, 0x03, 0x04, 0x06, 0xFB, 0xFA, 0xFD, 0x04, 0x06, 0xFD,
+0xFB, 0x02, 0xFF, 0x05, 0xFD, 0x05, 0x00, 0xFA, 0xFC, 0xFB, 0xFA, 0x01, 0x06, 0x01, 0xFF, 0xFD,
+0xFF, 0x02, 0xFD, 0x01, 0x00, 0xFB, 0x02, 0xFE, 0xFF, 0xFC, 0x03, 0x04, 0xFF, 0x05, 0x01, 0xFF,
+0xFA, 0x06, 0xFE, 0xFF, 0xFE, 0x04, 0x04, 0x03, 0x04, 0x02, 0xFB, 0x04, 0x00, 0xFB, 0xFC, 0x02,
+0xFC, 0xFC, 0x0D, 0xFF, 0x00, 0xFC, 0xFC, 0xFD, 0xFB, 0x01, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00,
+0xF9, 0x07, 0xF9, 0x00, 0xF5, 0x08, 0xFE, 0xF4, 0x03, 0x00, 0xFF, 0x04, 0xFF, 0x05, 0xFD, 0x02,
+0xFE, 0xFC, 0x04, 0xFB, 0x04, 0xFB, 0xFC, 0xFA, 0x01, 0xFD, 0x03, 0xFD, 0xFA, 0xFD, 0x0A, 0x07,
+0xF9, 0x04, 0xF5, 0xFC, 0xFB, 0x0A, 0xFA, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x01, 0x03, 0xFC, 0x09,
+0x00, 0xFB, 0x02, 0xFB, 0x07, 0xFA, 0xF6, 0xFB, 0x02, 0x00, 0x09, 0xFD, 0xF7, 0x03, 0x08, 0x07,
+0xF8, 0x08, 0xFC, 0xF8, 0x00, 0x09, 0x00, 0xFE, 0x01, 0x02, 0x05, 0x00, 0xF8, 0x02, 0xFE, 0x06,
+0xFF, 0xF8, 0x05, 0xF9, 0x02, 0xFF, 0xF7, 0xFD, 0x02, 0xFB, 0x05, 0xFB, 0xF6, 0xFB, 0x0A, 0x04,
+0xFC, 0x02, 0xFB, 0xFA, 0xFF, 0x05, 0xFA, 0xF4, 0xFE, 0x01, 0x07, 0x00, 0xF6, 0xFE, 0xFD, 0x08,
+0xFA, 0xFD, 0x06, 0xFC, 0xFF, 0xFF, 0xFD, 0xFE, 0x05, 0xFF, 0x02, 0xF5, 0xFD, 0x01, 0x06, 0x08,
+0x00, 0xFF, 0xFD, 0xFF, 0xF6, 0x08, 0xFC, 0xF5, 0x01, 0x03, 0x05, 0x05, 0xFF, 0x06, 0xFC, 0x08,
+0xFE, 0xFB, 0x0C, 0xFB, 0x00, 0xFF, 0xF8, 0xF8, 0x02, 0xFD, 0x07, 0xFF, 0xFE, 0xFA, 0x09, 0x01,
+0xF5, 0x02, 0xF9, 0xF7, 0xF6, 0x0C, 0xFC, 0xF7, 0x01, 0x00, 0x06, 0x06, 0xFF, 0x04, 0xFF, 0x04,
+0x01, 0xFF, 0x04, 0xFB, 0x09, 0xF6, 0xF5, 0xFE, 0xFD, 0xFB, 0x03, 0x04, 0xF9, 0xF6, 0x08, 0x0E,
+0xFB, 0x09, 0xF8, 0xF8, 0xFE, 0x04, 0xF6, 0xFB, 0x05, 0xFF, 0x08, 0xFF, 0xF9, 0x02, 0xFE, 0x08,
+0xFA, 0xFF, 0x08, 0xF6, 0x00, 0xFB, 0xF6, 0xFF, 0xFD, 0x02, 0x02, 0x02, 0xFB, 0xFE, 0x02, 0x02,
+0xFC, 0x08, 0xF7, 0xFF, 0xFC, 0x02, 0xFC, 0xF6, 0x03, 0xFF, 0x01, 0x04, 0xFA, 0x05, 0xF8, 0x08,
+0xFA, 0xFF, 0x02, 0xFC, 0x04, 0xFC, 0xF9, 0xF9, 0x06, 0xFC, 0x08, 0xFD, 0xFF, 0x03, 0x08, 0x09,
+0xF9, 0x03, 0xFC, 0xFB, 0xFB, 0x05, 0xF8, 0xFA, 0x01, 0x03, 0x04, 0x06, 0xFE, 0x03, 0xF7, 0x0A,
+0xFD, 0xFB, 0x04, 0xF7, 0x02, 0xF8, 0xF6, 0xFC, 0x06, 0x03, 0x0A, 0xFB, 0xFA, 0x06, 0x06, 0x07,
+0xFB, 0x04, 0xFE, 0xFA, 0xF7, 0x04, 0xFB, 0xFA, 0x01, 0x02, 0x01, 0x04, 0x00, 0x04, 0xFF, 0x04,
+0xFF, 0xF7, 0x04, 0xFB, 0x04, 0xFD, 0xFA, 0xFE, 0xFE, 0xFD, 0x03, 0xFB, 0xF6, 0x02, 0x06, 0x03,
+0xFD, 0x09, 0xFF, 0xFE, 0xFA, 0x03, 0xFA, 0xF9, 0x07, 0x02, 0x04, 0x05, 0xF6, 0x01, 0xFA, 0x08,
+0xF6, 0xFE, 0x0B, 0xFF, 0xFD, 0xF7, 0xFA, 0xF6, 0x12, 0x03, 0x04, 0x00, 0xF7, 0x0A, 0x03, 0x01,
+0xF7, 0x01, 0x01, 0xFD, 0xF7, 0x07, 0xFC, 0x01, 0x01, 0x03, 0x05, 0x00, 0xF9, 0x04, 0xFC, 0x00,
+0xFF, 0xF9, 0x08, 0xF7, 0x06, 0xFD, 0xFA, 0xFA, 0x03, 0xFD, 0x02, 0xFC, 0xF7, 0x01, 0x06, 0x05,
+0xFD, 0x09, 0xFC, 0xFE, 0xF9, 0x05, 0xF9, 0xFE, 0xFE, 0x03, 0x05, 0x05, 0xFD, 0x03, 0xFF, 0x07,
+0xFD, 0xFC, 0x05, 0xF8, 0x02, 0xFB, 0xFD, 0xFA, 0xFE, 0xFA, 0x06, 0xFC, 0xFB, 0x00, 0x08, 0x07,
+0xF9, 0x01, 0xFA, 0xFD, 0xFD, 0x04, 0xF9, 0xFA, 0x08, 0x02, 0x03, 0x06, 0xFF, 0x06, 0xF5, 0x00,
+0xFC, 0xF8, 0x06, 0xFC, 0x04, 0xFF, 0xFB, 0xF7, 0x01, 0xFC, 0x08, 0xFB, 0xFB, 0x00, 0x03, 0x04,
+0x00, 0x06, 0xF7, 0xFB, 0xFB, 0x08, 0xF6, 0xFB, 0x06, 0x01, 0x07, 0x01, 0xFA, 0xFF, 0xFA, 0x03,
+0xF9, 0xF8, 0x06, 0xF7, 0x00, 0xF8, 0xF9, 0xFE, 0x05, 0x02, 0x0C, 0xFD, 0xFC, 0x04, 0x05, 0x0D,
+0xFC, 0x04, 0x02, 0xFE, 0xFE, 0x07, 0xFA, 0xF6, 0x03, 0x02, 0x00, 0x01, 0xF5, 0x01, 0xF8, 0x0A,
+0xFD, 0xF7, 0x04, 0xFC, 0x01, 0xF7, 0xFF, 0xFC, 0x04, 0xFF, 0x04, 0xFD, 0xFB, 0x04, 0x01, 0x0B,
+0xF7, 0x05, 0xFE, 0xFC, 0xFE, 0x04, 0xFA, 0xFC, 0x06, 0x03, 0x09, 0x08, 0xF6, 0x02, 0x01, 0x05,
+0xFB, 0xFF, 0x03, 0xF8, 0x01, 0xFE, 0xFB, 0xF7, 0x02, 0xFB, 0x03, 0xF8, 0xF4, 0x00, 0x03, 0x07,
+0x01, 0x06, 0xFA, 0xFD, 0xFA, 0x07, 0xFB, 0xF7, 0x03, 0x03, 0x04, 0x04, 0x01, 0x07, 0xF5, 0x02,
+0xFA, 0xF9, 0x05, 0xFC, 0x05, 0xFA, 0xFF, 0xFD, 0x03, 0xFB, 0x07, 0xFC, 0xFC, 0x00, 0x09, 0x07,
+0xFD, 0x05, 0xFD, 0xFD, 0x00, 0x08, 0xFA, 0xF9, 0x04, 0x02, 0x06, 0x04, 0xFB, 0x03, 0xFD, 0x0A,
+0xF9, 0xFB, 0x06, 0xF8, 0x05, 0xFE, 0xFA, 0xFB, 0x02, 0xFC, 0x07, 0xFB, 0xF6, 0x02, 0x07, 0x03,
+0xF9, 0x05, 0xFA, 0xFC, 0xFB, 0x05, 0xFB, 0xFA, 0x07, 0x03, 0x07, 0x05, 0xFE, 0x05, 0xFC, 0x05,
+0xFA, 0xFD, 0x05, 0xFA, 0x06, 0xFC, 0xFD, 0xF8, 0x07, 0xFB, 0x05, 0xFC, 0xFE, 0x04, 0x04, 0x05,
+0xFA, 0x01, 0xFB, 0xFA, 0xFB, 0x04, 0xFC, 0xFB, 0x08, 0x01, 0x06, 0x08, 0xFD, 0x08, 0xF8, 0x07,
+0xFF, 0xFC, 0x0B, 0xFC, 0x03, 0xF9, 0xF6, 0xFB, 0x00, 0xFD, 0x0C, 0xFB, 0xFD, 0xFF, 0x06, 0x01,
+0xFE, 0x07, 0xFB, 0xF9, 0xFC, 0x05, 0xF9, 0xFA, 0x01, 0x02, 0x06, 0x02, 0xFE, 0x01, 0xF8, 0x07,
+0xFD, 0xF8, 0x0A, 0xF8, 0x05, 0xFC, 0xFB, 0xFD, 0xFC, 0xFB, 0x05, 0xF9, 0xFE, 0x00, 0x09, 0x07,
+0x01, 0x09, 0xFB, 0xFB, 0xF7, 0x07, 0xFE, 0xF8, 0x04, 0x01, 0x05, 0x02, 0xF4, 0xFE, 0xFC, 0x04,
+0xFC, 0xFF, 0x08, 0xFC, 0x03, 0x00, 0xF9, 0xFF, 0x04, 0x00, 0x04, 0xFE, 0xFD, 0x07, 0x07, 0x02,
+0xFC, 0x04, 0xFB, 0xFD, 0xF8, 0x08, 0xFD, 0xF8, 0x04, 0x01, 0x04, 0x08, 0xFD, 0x08, 0xF9, 0x06,
+0xFE, 0xF7, 0x0C, 0xF7, 0x06, 0xFE, 0xFE, 0xFD, 0x03, 0x03, 0x02, 0x01, 0xFB, 0x02, 0x0A, 0x08,
+0xFF, 0x0A, 0xFB, 0xFF, 0xF6, 0x06, 0xFC, 0xFC, 0x04, 0xFD, 0x05, 0x05, 0xFC, 0x04, 0xF8, 0x06,
+0xFC, 0xFA, 0x05, 0xF9, 0x03, 0xFC, 0xFD, 0xFA, 0x05, 0xFD, 0x05, 0xFD, 0xFD, 0x06, 0x06, 0x07,
+0xFB, 0x05, 0xFD, 0xFD, 0xFD, 0x03, 0xF8, 0xFC, 0x05, 0x02, 0x05, 0x05, 0x00, 0x04, 0xFB, 0x09,
+0xFE, 0xFA, 0x0C, 0xFD, 0x02, 0x02, 0xF9, 0xFB, 0x07, 0xFB, 0x04, 0xFD, 0xFA, 0x03, 0x03, 0x02,
+0xFC, 0x08, 0x00, 0xF9, 0xFA, 0x07, 0xFB, 0xFE, 0x07, 0x02, 0x06, 0x04, 0xFD, 0x06, 0xF8, 0x03,
+0xFB, 0xFB, 0x02, 0xFB, 0x07, 0xFA, 0xF7, 0xFD, 0x07, 0xFE, 0x05, 0xFA, 0xFC, 0x07, 0x04, 0x09,
+0xFB, 0x05, 0xFD, 0xFA, 0xFE, 0x08, 0xFA, 0xFB, 0x06, 0x02, 0x04, 0x05, 0xFF, 0x03, 0xFB, 0x04,
+0xFA, 0xFA, 0x04, 0xFA, 0x04, 0xFB, 0xFF, 0xF9, 0x05, 0xFB, 0x02, 0xFB, 0xFC, 0x02, 0x04, 0x04,
+0xFC, 0x03, 0xFD, 0xFA, 0xFD, 0x07, 0xFD, 0xFA, 0x06, 0x03, 0x06, 0x08, 0xFC, 0x09, 0xFB, 0x07,
+0xFC, 0xFA, 0x04, 0xFB, 0x05, 0xF9, 0xFC, 0xFE, 0x03, 0xFC, 0x06, 0xFC, 0xFC, 0x05, 0x05, 0x06,
+0xFB, 0x02, 0xF6, 0xFF, 0xFE, 0x04, 0xFC, 0xF8, 0x03, 0x02, 0x06, 0x07, 0xFE, 0x07, 0xFC, 0x08,
+0xFC, 0xFC, 0x06, 0xFC, 0x04, 0xFC, 0xFC, 0xFB, 0x05, 0xFC, 0x03, 0xFC, 0xFD, 0x07, 0x07, 0x02,
+0xFE, 0x06, 0xFC, 0xF9, 0xFA, 0x05, 0xFA, 0xFB, 0x05, 0x01, 0x04, 0x07, 0xFE, 0x03, 0xFC, 0x04,
+0xFC, 0xFB, 0x08, 0xFA, 0x02, 0xFB, 0x00, 0xFB, 0x02, 0xFD, 0x04, 0xFF, 0xFF, 0xFE, 0x0B, 0x09,
+0xFA, 0x04, 0xF8, 0xF8, 0x00, 0x03, 0xF3, 0xFB, 0x02, 0x02, 0x07, 0x05, 0xFF, 0x04, 0xF7, 0x02,
+0xF9, 0xF6, 0xFF, 0xF8, 0x00, 0xF7, 0xFA, 0xFF, 0x03, 0xFC, 0x02, 0x02, 0xFF, 0xFE, 0x05, 0x09,
+0xFB, 0x04, 0xFC, 0xF9, 0xF4, 0x09, 0xFC, 0xFE, 0x03, 0xFF, 0x05, 0x00, 0xF7, 0x04, 0xFD, 0x07,
+0xFC, 0xF5, 0x00, 0x01, 0x05, 0xF7, 0xF8, 0xF6, 0x04, 0xFE, 0x07, 0xFC, 0xFC, 0x01, 0x06, 0x01,
+0xFD, 0x08, 0xFF, 0xF7, 0x00, 0x04, 0xFD, 0xF8, 0x00, 0x00, 0x04, 0x0B, 0xFD, 0x06, 0xFD, 0x06,
+0xF9, 0xFB, 0x04, 0xFC, 0x03, 0xFC, 0xFB, 0xFB, 0x04, 0xFC, 0x05, 0xFC, 0xFD, 0x05, 0x05, 0x05,
+0xFB, 0x04, 0xFC, 0xFD, 0xFD, 0x06, 0xF9, 0xFD, 0x04, 0x02, 0x03, 0x07, 0xFF, 0x07, 0xF8, 0x06,
+0xFC, 0xFC, 0x04, 0xFC, 0x06, 0xFC, 0xFC, 0xFA, 0x03, 0xFC, 0x04, 0xFD, 0xFC, 0x08, 0x03, 0x04,
+0xFC, 0x04, 0xFC, 0xFA, 0xFE, 0x07, 0xFC, 0xFA, 0x04, 0x03, 0x04, 0x06, 0xFE, 0x0A, 0xFD, 0x07,
+0xFA, 0xFC, 0x06, 0xFE, 0x04, 0xFD, 0xFC, 0xFA, 0x06, 0xFA, 0x07, 0xFC, 0xFB, 0x07, 0x05, 0x03,
+0xFC, 0x02, 0xFC, 0xFD, 0xFB, 0x02, 0xFD, 0xFE, 0x04, 0x03, 0x03, 0x05, 0xFF, 0x0A, 0xFA, 0x07,
+0xFB, 0xFA, 0x06, 0xFB, 0x02, 0xFA, 0xFA, 0xFC, 0x03, 0xFD, 0x06, 0xFC, 0xFA, 0x06, 0x03, 0x04,
+0xFB, 0x06, 0xFD, 0xFB, 0xFB, 0x05, 0xFB, 0xFB, 0x03, 0x03, 0x05, 0x06, 0xFD, 0x03, 0xFC, 0x06,
+0xFC, 0xFE, 0x07, 0xF7, 0x02, 0xFD, 0xFA, 0xFE, 0x08, 0xFE, 0x0A, 0xFD, 0xFA, 0x01, 0x09, 0x05,
+0xFE, 0x05, 0xF7, 0xFE, 0xFA, 0x08, 0xFF, 0xFF, 0x00, 0x03, 0x05, 0x08, 0xFA, 0x03, 0xFE, 0x07,
+0xFA, 0xFD, 0x05, 0xFD, 0x00, 0xFA, 0xFD, 0xF7, 0x03, 0xFA, 0x05, 0xFE, 0xF8, 0x04, 0x04, 0x02,
+0xFA, 0x01, 0xFD, 0xFA, 0xFB, 0x01, 0xF8, 0x01, 0x07, 0x03, 0x07, 0x04, 0xFE, 0x06, 0xFA, 0x03,
+0xFD, 0xFA, 0x07, 0xFE, 0x05, 0xFB, 0xF1, 0xFC, 0xFD, 0xFB, 0x08, 0xFB, 0x00, 0xF9, 0x0D, 0x04,
+0xFB, 0x0B, 0xF8, 0xF8, 0xFF, 0x08, 0xF9, 0xF6, 0xFB, 0xFF, 0x05, 0x09, 0xFA, 0x03, 0x00, 0x02,
+0xF8, 0xFA, 0x05, 0xFC, 0x07, 0xFC, 0xFB, 0xFA, 0x04, 0xFB, 0x06, 0xFA, 0xFB, 0x05, 0x04, 0x07,
+0xF9, 0x03, 0xFC, 0xFD, 0xFE, 0x05, 0xFC, 0xFB, 0x06, 0x02, 0x04, 0x07, 0xFE, 0x0A, 0xFE, 0x06,
+0xFC, 0xFD, 0x08, 0xFD, 0x04, 0xFE, 0xFD, 0xF9, 0x03, 0xF8, 0x03, 0xFC, 0xFE, 0x07, 0x06, 0x02,
+0xFD, 0x03, 0xFD, 0xFC, 0xFB, 0x08, 0xFB, 0xFB, 0x07, 0x02, 0x03, 0x04, 0x01, 0x09, 0xFA, 0x07,
+0xFB, 0xFB, 0x03, 0xF9, 0x03, 0xFC, 0xFE, 0xFB, 0x04, 0xFC, 0x06, 0xF9, 0xFC, 0x02, 0x04, 0x06,
+0xFB, 0x03, 0xFB, 0xFD, 0xFA, 0x06, 0xF9, 0xFB, 0x04, 0x03, 0x06, 0x05, 0xFE, 0x07, 0xF9, 0x07,
+0xFC, 0xFC, 0x06, 0xFC, 0x05, 0xFB, 0xFD, 0xF8, 0x04, 0xFC, 0x03, 0xFD, 0xFC, 0x07, 0x04, 0x03,
+0xFC, 0x02, 0xFC, 0xFA, 0xFA, 0x06, 0xFC, 0xFD, 0x07, 0x02, 0x05, 0x07, 0xFD, 0x07, 0xFC, 0x06,
+0xFB, 0xFC, 0x0C, 0xFA, 0x06, 0xFF, 0xFD, 0xFE, 0x06, 0xF9, 0x02, 0xFB, 0x00, 0x06, 0x04, 0x05,
+0xFC, 0x01, 0xFE, 0xFE, 0xFB, 0x03, 0xFC, 0xF8, 0x04, 0x02, 0x03, 0x09, 0xFE, 0x0F, 0xFE, 0x05,
+0xF9, 0xFC, 0x04, 0xFC, 0x06, 0xFB, 0xFC, 0xF7, 0x04, 0xFB, 0x07, 0xFC, 0xFD, 0x05, 0x04, 0x05,
+0xFB, 0x05, 0xFA, 0xFB, 0xFD, 0x09, 0xFD, 0xF9, 0x01, 0x03, 0x07, 0x03, 0xFE, 0x08, 0xFD, 0x07,
+0xF8, 0x01, 0x05, 0xFA, 0x08, 0xF7, 0xFA, 0xFE, 0x01, 0xF8, 0x02, 0xFD, 0xF9, 0x05, 0xFF, 0x05,
+0xFF, 0x01, 0xF6, 0xFE, 0xFA, 0x00, 0xF7, 0xFB, 0x04, 0x02, 0x06, 0x01, 0xFA, 0x04, 0xF7, 0x09,
+0xF9, 0xFF, 0x08, 0xFF, 0x07, 0xFF, 0xFA, 0xFC, 0x08, 0x02, 0x09, 0xFE, 0xF6, 0x04, 0x09, 0x06,
+0xF9, 0x02, 0xFA, 0xFD, 0xFE, 0x01, 0xF9, 0xFB, 0x02, 0x01, 0x00, 0x06, 0xFF, 0xFF, 0xFA, 0x0A,
+0xFA, 0xFE, 0x02, 0xFB, 0x05, 0xFD, 0xFF, 0xFD, 0x08, 0xFA, 0x03, 0xFA, 0xFC, 0x05, 0x04, 0x03,
+0xFA, 0x00, 0xFB, 0xFA, 0xFD, 0x06, 0xFD, 0xFC, 0x04, 0x03, 0x05, 0x06, 0xFC, 0x07, 0xF8, 0x08,
+0xFF, 0xFE, 0x03, 0xFA, 0x0B, 0xFB, 0xFA, 0xFA, 0x03, 0x01, 0x08, 0xFE, 0xFA, 0x01, 0x05, 0x07,
+0xFB, 0x0A, 0x03, 0xF9, 0xF6, 0x07, 0xFA, 0xF8, 0x05, 0x03, 0x04, 0x01, 0xF9, 0x00, 0xFF, 0x02,
+0xFB, 0xFB, 0x07, 0xF9, 0x02, 0xFC, 0xFC, 0xF9, 0x02, 0xFD, 0x03, 0xFC, 0xF9, 0x03, 0x06, 0x05,
+0xFE, 0x05, 0xFA, 0xFB, 0xFA, 0x05, 0xF9, 0xF9, 0x02, 0x01, 0x07, 0x04, 0xFF, 0x05, 0xFC, 0x07,
+0xFC, 0xFD, 0x01, 0xF9, 0x06, 0xF7, 0xFF, 0xF6, 0x02, 0x03, 0x05, 0x00, 0xF8, 0x05, 0x03, 0x04,
+0xF7, 0x03, 0xFC, 0xFB, 0xF7, 0x07, 0xF9, 0xF9, 0x02, 0x03, 0x08, 0x00, 0xFC, 0x00, 0xF8, 0x04,
+0xFA, 0x01, 0x0B, 0xF6, 0xFF, 0xF7, 0xF4, 0xFC, 0x01, 0xFE, 0x08, 0x00, 0xFA, 0xFC, 0x02, 0x02,
+0xFA, 0x0B, 0xF7, 0xFC, 0xFD, 0x07, 0xF9, 0xFA, 0x03, 0x04, 0x06, 0x01, 0xF8, 0xFA, 0xFC, 0x04,
+0xFC, 0xFB, 0x05, 0xF8, 0x07, 0xFF, 0xFB, 0xFC, 0x02, 0xFE, 0x03, 0xFD, 0xFB, 0x06, 0x06, 0x04,
+0xFD, 0x03, 0xFD, 0xFC, 0xFC, 0x02, 0xFF, 0x00, 0x06, 0x03, 0x05, 0x05, 0xFA, 0x0C, 0xF7, 0x08,
+0xF8, 0xFC, 0x0B, 0xF4, 0x08, 0xFA, 0xFA, 0xFE, 0x00, 0x01, 0x06, 0xFE, 0xFC, 0xFF, 0x0B, 0x06,
+0xFB, 0x00, 0xF5, 0xFD, 0xFB, 0x06, 0xF6, 0xF9, 0xFD, 0x02, 0x0B, 0xFE, 0x00, 0xFD, 0xFF, 0x08,
+0xF7, 0xF6, 0xFE, 0xFC, 0x0B, 0xFE, 0xFE, 0xFB, 0x05, 0xFF, 0x04, 0xFD, 0xF8, 0x03, 0x09, 0x05,
+0xFF, 0x07, 0xFB, 0xF8, 0xFE, 0x01, 0xFB, 0x01, 0x06, 0xFE, 0x04, 0x04, 0xFE, 0x00, 0xFE, 0x04,
+0xF7, 0xFC, 0x08, 0xFE, 0xFF, 0xFE, 0xF9, 0xF7, 0xFF, 0xFF, 0x05, 0x01, 0x00, 0x04, 0x0B, 0x06,
+0xFF, 0x0A, 0xFD, 0xF8, 0xFE, 0x03, 0xF6, 0xFC, 0x02, 0x06, 0x00, 0x04, 0xF8, 0x07, 0xFF, 0x03,
+0xFC, 0xFD, 0x06, 0xFC, 0x07, 0xFE, 0xFC, 0xF9, 0x04, 0xFC, 0x03, 0xFA, 0x00, 0x05, 0x07, 0x06,
+0xFB, 0x04, 0xFC, 0xF9, 0xFB, 0x04, 0xFA, 0xFC, 0x05, 0x01, 0x03, 0x05, 0xFF, 0x02, 0xFD, 0x00,
+0xFC, 0xF9, 0xFE, 0xFD, 0xFC, 0x00, 0x01, 0xF8, 0x09, 0xF7, 0x09, 0xF7, 0xFE, 0x06, 0x08, 0x06,
+0xF9, 0x04, 0xFE, 0x03, 0xFC, 0x0A, 0xFF, 0xF6, 0x03, 0x02, 0x02, 0x05, 0xFB, 0x04, 0xF7, 0x05,
+0xF8, 0xFD, 0x03, 0xF8, 0x06, 0xFF, 0xF6, 0xF8, 0x07, 0x06, 0x07, 0x01, 0xFF, 0x08, 0x00, 0x04,
+0x00, 0x09, 0xF9, 0xFD, 0xFE, 0x04, 0xFA, 0xFC, 0x06, 0xFF, 0x05, 0x06, 0xFA, 0x08, 0xF8, 0x08,
+0xFE, 0xFB, 0x05, 0xF9, 0x05, 0xFD, 0xFE, 0xFB, 0x03, 0xFE, 0x04, 0xFC, 0xF9, 0x05, 0x03, 0x04,
+0xFC, 0x03, 0xFA, 0xFD, 0xFC, 0x08, 0xFA, 0xF9, 0x04, 0x02, 0x01, 0x02, 0xFE, 0x03, 0xFA, 0x04,
+0x01, 0xFE, 0x07, 0x00, 0x04, 0xFA, 0xF4, 0xFB, 0xFE, 0xFA, 0x07, 0x01, 0xF9, 0xFA, 0x05, 0x03,
+0xF8, 0x0A, 0xF5, 0xF7, 0xF8, 0x0A, 0xF9, 0xF8, 0x01, 0xFA, 0x08, 0x03, 0xF5, 0xFC, 0x03, 0x05,
+0xF6, 0xFC, 0x0A, 0xF8, 0x00, 0xFF, 0xF7, 0xFC, 0xFC, 0x05, 0x07, 0xFF, 0xFF, 0x04, 0x01, 0x03,
+0xFF, 0x07, 0xFC, 0x02, 0xF5, 0x08, 0xFB, 0xFC, 0x05, 0x03, 0x06, 0x02, 0xFD, 0x06, 0xF8, 0xFF,
+0xFA, 0xFA, 0x01, 0x00, 0x06, 0xFF, 0xF6, 0xFB, 0x02, 0xFC, 0x01, 0xFA, 0xFE, 0x01, 0x06, 0x01,
+0xFA, 0x07, 0xFB, 0xFF, 0xF9, 0x09, 0x01, 0xFF, 0xFE, 0x01, 0x01, 0x04, 0xFA, 0x04, 0xFF, 0x03,
+0xFF, 0xFD, 0x09, 0xFC, 0xFD, 0x01, 0xF9, 0xFF, 0x04, 0xFD, 0x09, 0xFD, 0xFD, 0x01, 0xFF, 0x06,
+0x02, 0x09, 0xF6, 0xF9, 0xFC, 0x00, 0xF8, 0xFB, 0x04, 0xF7, 0x02, 0x08, 0xFB, 0xFF, 0xFB, 0x07,
+0xF5, 0xF5, 0x04, 0xF3, 0xFF, 0xFE, 0xF6, 0xFD, 0xF9, 0xFE, 0x03, 0x02, 0xF8, 0xFA, 0x08, 0x03,
+0x00, 0x05, 0xF5, 0xF8, 0xFD, 0x0C, 0xF9, 0xFB, 0x06, 0xFC, 0x01, 0x04, 0xFD, 0xFF, 0xFD, 0x04,
+0xFD, 0xFD, 0x04, 0xF9, 0x09, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0x07, 0xF5, 0x02, 0xFF, 0x09, 0x06,
+0xF7, 0x06, 0xFB, 0xFB, 0xF6, 0x02, 0xFC, 0xFF, 0xFE, 0xFA, 0x00, 0x09, 0xF7, 0xFF, 0xFF, 0x01,
+0xFE, 0xF8, 0x03, 0xFD, 0xFF, 0xF9, 0xF6, 0xF5, 0xF9, 0x01, 0x08, 0xF9, 0xFD, 0x00, 0x08, 0x09,
+0x02, 0x0A, 0xFE, 0xFB, 0xF7, 0x0B, 0xFE, 0xF7, 0x05, 0xFF, 0x04, 0xFE, 0xFD, 0xFA, 0xF8, 0x04,
+0xFD, 0xF7, 0x01, 0xF7, 0x02, 0xF9, 0xF5, 0xF5, 0x00, 0x03, 0x03, 0xFB, 0xF6, 0xF6, 0x03, 0x02,
+0xFB, 0x09, 0xF6, 0x00, 0xFC, 0x00, 0xFC, 0xFC, 0xFE, 0x00, 0x0C, 0x09, 0xFF, 0x02, 0xFA, 0x05,
+0xFC, 0xFC, 0xFE, 0xF8, 0xFF, 0xFB, 0x01, 0xFD, 0x00, 0x02, 0x02, 0x02, 0xFE, 0x08, 0xFF, 0xFE,
+0xF7, 0x08, 0xF8, 0xFE, 0xFE, 0x04, 0xF7, 0xFE, 0xFE, 0x06, 0x07, 0x06, 0x01, 0x08, 0xFC, 0x09,
+0x02, 0xF7, 0x0C, 0x01, 0xFE, 0xF4, 0xFB, 0xFB, 0x01, 0x04, 0x02, 0xF9, 0xF7, 0x01, 0x01, 0x04,
+0x02, 0x08, 0xFC, 0xFE, 0xF6, 0x05, 0x00, 0xF9, 0x09, 0xFA, 0x00, 0x07, 0x03, 0xFF, 0xFC, 0x08,
+0x01, 0xF7, 0x00, 0xF9, 0x01, 0xFA, 0xFD, 0xFE, 0x01, 0x01, 0x07, 0xF9, 0xFA, 0x00, 0x02, 0x08,
+0x00, 0x0A, 0xFF, 0xF8, 0xFE, 0x05, 0xFC, 0xF9, 0xFD, 0xFF, 0x0B, 0x06, 0xFE, 0x05, 0xFA, 0x02,
+0xFD, 0xFD, 0x02, 0xF8, 0x05, 0xFD, 0xFE, 0xF8, 0x06, 0xFF, 0x06, 0xF9, 0x01, 0xFC, 0x08, 0x07,
+0x00, 0x05, 0xFE, 0xFB, 0xF9, 0x02, 0xFC, 0x01, 0x07, 0xFF, 0x07, 0x06, 0xFC, 0x00, 0xFB, 0x04,
+0xFE, 0xFC, 0x04, 0xFD, 0x07, 0xFE, 0xFD, 0xF8, 0x03, 0xFC, 0x08, 0xFB, 0xFD, 0xFA, 0x03, 0x03,
+0xFA, 0x05, 0xFC, 0xFA, 0xFE, 0x02, 0xFA, 0xF8, 0x04, 0x04, 0x06, 0x06, 0xFC, 0x04, 0xFB, 0x07,
+0x00, 0xF7, 0x08, 0xFE, 0x03, 0xFE, 0xFD, 0xFF, 0x04, 0xFD, 0x02, 0xFF, 0xF8, 0x00, 0x08, 0x05,
+0x02, 0x02, 0xFB, 0xF8, 0xF7, 0x08, 0xF8, 0xFF, 0x07, 0x06, 0x02, 0x04, 0xFD, 0x08, 0xF7, 0x02,
+0xF9, 0xFE, 0x02, 0xF7, 0x03, 0xFC, 0xFC, 0xF8, 0xFE, 0x00, 0x08, 0xFE, 0xF7, 0x00, 0x06, 0x04,
+0xFE, 0x02, 0xF9, 0xF9, 0xFD, 0x06, 0xF7, 0xF8, 0x02, 0xFC, 0x08, 0x05, 0xFE, 0x01, 0xF6, 0x08,
+0x01, 0x00, 0x08, 0xFC, 0x02, 0x00, 0xF9, 0xFA, 0x04, 0xFB, 0x08, 0xFD, 0xF7, 0xFB, 0x04, 0x07,
+0xFF, 0xFF, 0xFC, 0xF8, 0xF9, 0x0B, 0x00, 0xF9, 0x03, 0xFD, 0xFF, 0x0A, 0xF7, 0x04, 0xF9, 0x09,
+0xFE, 0xFD, 0x0A, 0xFB, 0x09, 0xF8, 0xFC, 0x01, 0x00, 0xF4, 0xFF, 0xFF, 0x00, 0x03, 0x03, 0x07,
+0xFB, 0x02, 0xFA, 0xFF, 0xFD, 0x06, 0xF7, 0xF8, 0xFD, 0xFF, 0x08, 0x01, 0xFD, 0xFF, 0xFF, 0x06,
+0xF7, 0xFF, 0x05, 0xFB, 0x00, 0xFD, 0xF9, 0xFB, 0x02, 0x02, 0x05, 0x00, 0xFC, 0x06, 0x06, 0x05,
+0xFE, 0xFF, 0xFD, 0xFE, 0xF4, 0x0B, 0x01, 0xF9, 0xFF, 0xFD, 0x08, 0x07, 0x00, 0x03, 0x00, 0x07,
+0xFB, 0xFB, 0x0A, 0x00, 0x00, 0xFC, 0xFC, 0xF6, 0x00, 0xFE, 0xFF, 0xFB, 0x00, 0x01, 0x06, 0x06,
+0xFF, 0x07, 0xF8, 0xFF, 0xFD, 0x03, 0xFD, 0xFF, 0x07, 0x05, 0x09, 0x01, 0xFF, 0x04, 0xF5, 0xFF,
+0xFB, 0xF5, 0x09, 0xFD, 0x07, 0xF9, 0xFF, 0xFB, 0x02, 0x01, 0x0B, 0x00, 0xFC, 0x04, 0xFF, 0x06,
+0x00, 0x0B, 0xFA, 0xFA, 0xF9, 0x04, 0xFE, 0xFF, 0x08, 0x03, 0x09, 0xFF, 0x01, 0x02, 0xFC, 0x05,
+0xFE, 0xFB, 0x08, 0xFC, 0x03, 0xFC, 0xFA, 0xFB, 0x05, 0xFC, 0x04, 0xFC, 0xFC, 0x04, 0x03, 0x05,
+0xFB, 0x06, 0xFD, 0xF9, 0xFA, 0x06, 0xFD, 0xF9, 0x02, 0xFD, 0x07, 0x08, 0xFD, 0x06, 0xF9, 0x08,
+0xF8, 0xFE, 0x08, 0xFE, 0x03, 0xF9, 0xF9, 0xFA, 0x07, 0xFC, 0x08, 0xFE, 0xFD, 0x05, 0x08, 0x02,
+0xF9, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x02, 0xFF, 0x0A, 0x02, 0x05, 0x04, 0xFD, 0x0B, 0xFD, 0x03,
+0xFF, 0xFF, 0x0A, 0xF9, 0x06, 0xFC, 0xFE, 0xFB, 0x02, 0xFF, 0x06, 0xFC, 0xF8, 0x05, 0x03, 0x07,
+0xFF, 0x0B, 0xFD, 0x00, 0xFA, 0x07, 0xFE, 0xFC, 0x05, 0x05, 0x05, 0x01, 0xFE, 0x09, 0xFD, 0x04,
+0xFC, 0xFA, 0x06, 0xF9, 0x05, 0xFC, 0xFB, 0xFC, 0x08, 0xFD, 0x08, 0x02, 0xFC, 0x06, 0x02, 0x06,
+0xF9, 0x07, 0xFD, 0xFA, 0xF9, 0x06, 0xFE, 0xF8, 0x04, 0x02, 0x02, 0x01, 0xFE, 0x01, 0xF9, 0x0A,
+0xFD, 0x02, 0xFF, 0xF9, 0x03, 0xF7, 0xFE, 0x00, 0x07, 0xFD, 0x08, 0xFA, 0xF8, 0x02, 0x03, 0x00,
+0xF8, 0x01, 0xFC, 0xFD, 0xF9, 0x09, 0xF9, 0xFB, 0x05, 0xFE, 0x05, 0x09, 0xFA, 0x01, 0xF6, 0x07,
+0xFE, 0x00, 0x01, 0xF9, 0x06, 0xFC, 0xF8, 0x01, 0x0A, 0x03, 0x06, 0xF9, 0xF9, 0x00, 0x04, 0x07,
+0x00, 0x03, 0xFA, 0xFB, 0xFD, 0x03, 0xF7, 0xF7, 0x00, 0x01, 0x04, 0x04, 0x00, 0x02, 0xF8, 0x03,
+0xFE, 0xFB, 0x00, 0xF6, 0x04, 0xF3, 0xFC, 0xF6, 0xFF, 0xFB, 0x09, 0x04, 0xFA, 0xF9, 0x00, 0x0B,
+0xF8, 0x04, 0xFA, 0x00, 0xFE, 0x0B, 0xF8, 0xFE, 0x05, 0xFE, 0x08, 0x02, 0xF6, 0x03, 0xFD, 0x00,
+0xFD, 0x00, 0x07, 0xFD, 0x06, 0xFB, 0x00, 0xFD, 0x07, 0xFC, 0x02, 0xFA, 0xFD, 0x00, 0x02, 0x05,
+0x01, 0x06, 0xF8, 0xFB, 0xFB, 0x07, 0xF7, 0xF5, 0x04, 0x04, 0x09, 0x08, 0xFF, 0x03, 0xFB, 0x02,
+0xF8, 0xFB, 0x08, 0xFB, 0x07, 0xF9, 0xFF, 0xFB, 0x07, 0xFC, 0x06, 0xFB, 0xFB, 0x01, 0x02, 0x04,
+0xFC, 0x03, 0xFE, 0xFA, 0xFA, 0x04, 0xFC, 0xF9, 0x07, 0x02, 0x03, 0x02, 0xFF, 0x0A, 0xFF, 0x02,
+0xFA, 0xFC, 0x06, 0xFC, 0x03, 0xFC, 0xFC, 0xFE, 0x04, 0xFC, 0x04, 0xFC, 0xFC, 0x03, 0x04, 0x04,
+0xFB, 0x04, 0xFD, 0xFA, 0xFD, 0x02, 0xFE, 0xFC, 0x06, 0x01, 0x05, 0x04, 0xF9, 0x0D, 0xFC, 0x07,
+0xFC, 0xFA, 0x06, 0xF9, 0x04, 0xFC, 0xFC, 0xFC, 0x03, 0xFD, 0x04, 0xFD, 0xFC, 0x05, 0x05, 0x06,
+0xFD, 0x05, 0xFC, 0xFC, 0xFA, 0x04, 0xFC, 0xFC, 0x05, 0xFF, 0x04, 0x08, 0xFD, 0x0A, 0xFC, 0x05,
+0x00, 0xFD, 0x06, 0xF9, 0x06, 0xFD, 0xFA, 0xF8, 0x03, 0xF8, 0x03, 0xFA, 0xFD, 0x03, 0x04, 0x08,
+0xFC, 0x06, 0xFD, 0xFA, 0xFD, 0x03, 0xFB, 0xFE, 0x04, 0x02, 0x06, 0x06, 0xFC, 0x05, 0xFB, 0x04,
+0xFF, 0xF8, 0x08, 0xFB, 0x06, 0xFC, 0xFD, 0xFA, 0x03, 0xFF, 0x05, 0x00, 0xFB, 0xFF, 0x04, 0x09,
+0xFB, 0x09, 0xFD, 0xFD, 0xFE, 0x04, 0xF7, 0xF9, 0x00, 0x00, 0x06, 0x06, 0xF7, 0x00, 0xF6, 0x04,
+0xFC, 0xF8, 0x09, 0xF6, 0x07, 0x01, 0xF9, 0xF7, 0xFE, 0x04, 0x05, 0xFE, 0xFE, 0x05, 0x0B, 0x03,
+0x00, 0x01, 0xFA, 0xF7, 0xFB, 0x0B, 0xFC, 0xFE, 0x06, 0xF9, 0x03, 0x03, 0xFB, 0x02, 0xF8, 0x00,
+0xF7, 0xF8, 0x01, 0xFE, 0x02, 0xF9, 0xFC, 0xFB, 0x07, 0xFD, 0x04, 0xFD, 0x03, 0x00, 0x09, 0x08,
+0x00, 0x06, 0xFF, 0xFA, 0xFF, 0xFD, 0xFE, 0xFC, 0x07, 0x06, 0xFF, 0x06, 0xFA, 0x07, 0x01, 0x05,
+0xFF, 0xFB, 0x05, 0xFA, 0x05, 0xFA, 0xF4, 0xFF, 0xFC, 0xFE, 0x09, 0xFD, 0xFA, 0x05, 0x03, 0x01,
+0xFC, 0x08, 0xF9, 0xF8, 0xFD, 0x07, 0xFF, 0xFA, 0x04, 0x04, 0x07, 0x00, 0xFB, 0xFE, 0xF9, 0x05,
+0xFB, 0xFC, 0x07, 0xFC, 0x05, 0xF9, 0xFB, 0xFA, 0x01, 0xFC, 0x05, 0xFE, 0xFD, 0x03, 0x05, 0x05,
+0xFC, 0x06, 0xFC, 0xFB, 0xFC, 0x09, 0xF9, 0xFC, 0x01, 0x02, 0x05, 0x05, 0xFC, 0x05, 0xF9, 0x07,
+0xFA, 0xFD, 0x06, 0xFD, 0x03, 0xFA, 0xFC, 0xFD, 0x06, 0xFA, 0x03, 0xFB, 0xFC, 0x05, 0x02, 0x04,
+0xFA, 0x06, 0xFC, 0xFC, 0xF9, 0x03, 0xFA, 0xFB, 0x03, 0x02, 0x04, 0x03, 0xFA, 0x0A, 0x00, 0x08,
+0xFD, 0xFB, 0x03, 0xFB, 0x05, 0xFA, 0xFD, 0xF9, 0x04, 0xFA, 0x06, 0xFA, 0xFA, 0x03, 0x07, 0x04,
+0xFB, 0x05, 0xFB, 0xFC, 0xFE, 0x04, 0xFC, 0xFC, 0x04, 0x03, 0x05, 0x04, 0xFA, 0x08, 0xFC, 0x04,
+0xFD, 0xFB, 0x09, 0xFC, 0x05, 0xFB, 0xF6, 0xFA, 0x02, 0x01, 0x09, 0xFF, 0xFC, 0x04, 0x06, 0x03,
+0xFD, 0x04, 0xFB, 0xF9, 0xFF, 0x04, 0xFA, 0xFA, 0x04, 0x02, 0x04, 0x07, 0xFD, 0x04, 0xF7, 0x03,
+0xFC, 0xFF, 0x04, 0xF7, 0x05, 0xFD, 0xFF, 0xFE, 0x01, 0x01, 0x0C, 0xFF, 0xFD, 0x04, 0x05, 0x05,
+0x01, 0x0A, 0xFA, 0xF8, 0xF9, 0x06, 0xFD, 0xFD, 0x05, 0x02, 0x05, 0x03, 0xFF, 0x06, 0xFA, 0x08,
+0x00, 0xFD, 0x06, 0xF5, 0x02, 0xFE, 0xFE, 0xFD, 0x00, 0xFA, 0x02, 0x01, 0xFB, 0x03, 0x05, 0x06,
+0xF9, 0x05, 0x02, 0xFC, 0xFC, 0x08, 0xFC, 0xFD, 0x02, 0xFE, 0x05, 0x01, 0xFB, 0x04, 0xF8, 0x0A,
+0xFB, 0xFC, 0x0A, 0x01, 0x00, 0xF6, 0xFF, 0xFA, 0x00, 0x03, 0x02, 0xFE, 0x02, 0xFF, 0x03, 0x07,
+0xF8, 0x07, 0xFD, 0xFF, 0xFB, 0x08, 0xF6, 0xFE, 0x01, 0x01, 0x04, 0x04, 0xFE, 0x00, 0xF6, 0x05,
+0xFF, 0xF8, 0x01, 0x00, 0x06, 0xF9, 0xFA, 0xFE, 0x00, 0xF9, 0x08, 0xF6, 0xFD, 0x08, 0xFF, 0x06,
+0x03, 0x03, 0xFA, 0xFA, 0xFC, 0x01, 0xFB, 0xF5, 0x02, 0x03, 0x05, 0x08, 0xFA, 0x03, 0xF8, 0x01,
+0xFA, 0xFB, 0x05, 0xFD, 0x00, 0xF9, 0xF7, 0xFD, 0x04, 0xFE, 0x07, 0xFD, 0xFA, 0x00, 0x06, 0x05,
+0xFA, 0x05, 0xFD, 0xF9, 0xFF, 0x04, 0xFD, 0xFB, 0x05, 0x03, 0x06, 0x03, 0xFA, 0x04, 0xFC, 0x06,
+0x01, 0xFD, 0x07, 0xFD, 0x04, 0xF8, 0xFC, 0xFE, 0x03, 0x00, 0x04, 0xFE, 0xFD, 0x03, 0x05, 0x09,
+0xFC, 0x08, 0xFC, 0xFC, 0xFA, 0x03, 0xFA, 0xFA, 0x04, 0x02, 0x08, 0x05, 0xFA, 0x08, 0xFB, 0x06,
+0xFF, 0x00, 0x01, 0x00, 0x08, 0xFA, 0xF8, 0x00, 0x07, 0xFC, 0x02, 0xFB, 0xF9, 0x03, 0x08, 0x03,
+0xFE, 0x02, 0xFC, 0xF5, 0xFF, 0x03, 0xFD, 0xF9, 0x05, 0x02, 0x06, 0x05, 0xFE, 0x05, 0xF8, 0x0A,
+0xFD, 0xFE, 0x08, 0xFB, 0x05, 0xFD, 0xFC, 0xFF, 0x06, 0xFC, 0x04, 0xFA, 0xFD, 0x02, 0x06, 0x04,
+0xFD, 0x05, 0xFB, 0xFC, 0xFC, 0x04, 0xFC, 0xFD, 0x04, 0x02, 0x06, 0x06, 0xFD, 0x07, 0xFB, 0x07,
+0xFE, 0xF7, 0x08, 0xF8, 0x06, 0xF6, 0xF9, 0x00, 0x05, 0x00, 0x03, 0x02, 0xF6, 0x02, 0x09, 0x05,
+0xFF, 0x0C, 0xFF, 0xFE, 0xFC, 0x03, 0xF8, 0xF9, 0x03, 0x01, 0x00, 0x06, 0xFF, 0xFD, 0xFA, 0x0A,
+0xFE, 0xFE, 0x05, 0xF8, 0x01, 0xF8, 0xFC, 0x00, 0x01, 0xFD, 0x03, 0xFD, 0xFB, 0xFA, 0x04, 0x05,
+0xF9, 0x05, 0xFC, 0xF7, 0x00, 0x03, 0xF7, 0xF9, 0xFE, 0xF9, 0x03, 0x05, 0xF8, 0x07, 0xFA, 0x06,
+0x02, 0xF5, 0x08, 0xFC, 0xFF, 0xF7, 0xF6, 0xFC, 0x04, 0x00, 0x08, 0x01, 0xFF, 0xFE, 0x0A, 0x0A,
+0x01, 0x07, 0xFA, 0xFE, 0x02, 0x0D, 0xF4, 0xFC, 0x03, 0xFB, 0x09, 0x08, 0x00, 0x01, 0xF9, 0x04,
+0xFA, 0xF6, 0x03, 0x01, 0x08, 0xFD, 0xFB, 0xFF, 0x05, 0x02, 0x04, 0xF9, 0xF6, 0xFC, 0x05, 0x00,
+0x02, 0x03, 0xFD, 0xFC, 0xF6, 0x06, 0xFD, 0xFB, 0x02, 0xFB, 0x04, 0x0A, 0xFD, 0x03, 0xFE, 0x09,
+0xFB, 0xFF, 0x04, 0xF5, 0x04, 0xF9, 0xF5, 0xF4, 0x02, 0xFE, 0x07, 0xFB, 0xF7, 0x03, 0x07, 0x02,
+0x01, 0x0A, 0xFF, 0xFD, 0xF6, 0x07, 0xF8, 0xFE, 0x03, 0xFC, 0x08, 0x01, 0x00, 0xFC, 0xFE, 0x09,
+0xFC, 0xF8, 0x08, 0xFC, 0x04, 0xF9, 0xFA, 0xFB, 0x00, 0xFF, 0x04, 0xFD, 0xF7, 0x02, 0x03, 0x04,
+0xFA, 0x04, 0xFA, 0xFD, 0xFA, 0x06, 0xF9, 0xFB, 0x06, 0x03, 0x05, 0x02, 0xFA, 0x03, 0xFE, 0x08,
+0xFE, 0xFC, 0x02, 0xFE, 0x04, 0xF5, 0xFE, 0xF7, 0x04, 0x03, 0x06, 0xFE, 0xFD, 0x05, 0x03, 0x0A,
+0xF8, 0x06, 0xFD, 0xFB, 0xF9, 0x08, 0xFF, 0xFB, 0x04, 0x01, 0x07, 0x05, 0xF6, 0x05, 0xFC, 0x07,
+0xF8, 0xF9, 0x02, 0x00, 0x08, 0xF8, 0x01, 0xF6, 0x04, 0xFE, 0x09, 0xFA, 0xFE, 0x06, 0xFF, 0x01,
+0xFD, 0x04, 0xF6, 0xF7, 0xF6, 0x04, 0x00, 0xF7, 0x06, 0xF9, 0x04, 0x0A, 0xFA, 0x02, 0x00, 0x07,
+0xFE, 0xF6, 0x06, 0xFD, 0xFE, 0xF8, 0xF6, 0xF2, 0xFC, 0xFE, 0x05, 0x03, 0x00, 0x04, 0x0B, 0x00,
+0x02, 0x04, 0x00, 0xF9, 0xF8, 0x0B, 0xF5, 0xFA, 0x05, 0xF8, 0x00, 0x0B, 0xFE, 0xFD, 0xFF, 0xFF,
+0xFD, 0xFA, 0x06, 0xF6, 0x01, 0xFB, 0xF4, 0xFF, 0xFB, 0xFE, 0x01, 0x01, 0xFC, 0x00, 0x02, 0x0A,
+0xFF, 0x08, 0xF8, 0xFE, 0xF7, 0x06, 0xF5, 0xF6, 0x04, 0xFE, 0x08, 0x03, 0xFB, 0x00, 0xF9, 0x02,
+0xF7, 0xF7, 0x02, 0xFC, 0x02, 0xF8, 0xF9, 0xFB, 0xFF, 0xFD, 0xFF, 0xFB, 0xF8, 0xFF, 0xFD, 0x06,
+0xFF, 0x03, 0xFA, 0xFE, 0x01, 0x03, 0xFB, 0xFC, 0x03, 0x0B, 0x08, 0x02, 0xF7, 0x01, 0xFC, 0x00,
+0xFD, 0xFC, 0xFE, 0xFC, 0x01, 0xFA, 0xFE, 0xFB, 0x02, 0xF9, 0x02, 0xFB, 0xFC, 0x01, 0x06, 0x02,
+0xFF, 0x03, 0xFB, 0xF8, 0xFE, 0x03, 0xFA, 0xFA, 0x01, 0x00, 0x07, 0x05, 0xFB, 0x02, 0xFE, 0x07,
+0xF9, 0xFF, 0x03, 0xF8, 0x06, 0xFB, 0xFD, 0xFB, 0xFE, 0xFB, 0x03, 0xFB, 0xFF, 0xFF, 0x03, 0x08,
+0xFB, 0x06, 0xFA, 0xF6, 0x01, 0x05, 0xFB, 0xFA, 0x02, 0x06, 0xFF, 0x0A, 0xF9, 0x04, 0x03, 0x06,
+0xFA, 0xFF, 0x02, 0xFB, 0x00, 0xFE, 0xF5, 0xFC, 0xFB, 0x02, 0x08, 0x00, 0xFE, 0xF6, 0x04, 0x09,
+0x01, 0x09, 0xFB, 0xF4, 0xF9, 0x0C, 0xF4, 0xFD, 0x00, 0x05, 0x00, 0x04, 0xF7, 0x00, 0xF4, 0x05,
+0xF5, 0xF5, 0x0C, 0xFF, 0xFE, 0xFC, 0xFD, 0xF9, 0x09, 0xFF, 0x01, 0xFA, 0xF7, 0x02, 0x05, 0x01,
+0xFE, 0x01, 0xFF, 0xFA, 0xF9, 0x04, 0xFE, 0x00, 0x01, 0xFD, 0x09, 0x03, 0xFF, 0xFE, 0xFB, 0x08,
+0xFB, 0xF9, 0x0C, 0xFF, 0x01, 0xFF, 0x00, 0xFC, 0xFF, 0xF8, 0x07, 0xFB, 0xFD, 0xFD, 0x04, 0x05,
+0xF9, 0x03, 0xFB, 0x00, 0xFE, 0x03, 0xFA, 0xF6, 0x02, 0xFD, 0x05, 0x08, 0xF9, 0x04, 0xFA, 0x0B,
+0xFD, 0xFA, 0x07, 0xFE, 0x00, 0xF7, 0xFB, 0xFF, 0x06, 0xFE, 0x01, 0xFE, 0xFB, 0xFF, 0x04, 0x02,
+0xFC, 0x01, 0xFA, 0xFB, 0xFC, 0x01, 0xFA, 0xFC, 0x03, 0x02, 0x01, 0x01, 0xF8, 0x05, 0xFF, 0x08,
+0x02, 0xF9, 0xFD, 0xFB, 0xFD, 0xF9, 0xF8, 0xFA, 0x0B, 0xF9, 0x03, 0xFA, 0xFE, 0x00, 0x01, 0x01,
+0xF6, 0x08, 0xF6, 0xF5, 0x00, 0xFE, 0xFF, 0x01, 0x09, 0xFE, 0x03, 0x01, 0xFC, 0x00, 0x00, 0x0A,
+0xF5, 0xF9, 0x0B, 0xF8, 0x06, 0xFA, 0xF7, 0xF6, 0x08, 0xF9, 0x04, 0xFD, 0xFA, 0x06, 0x06, 0x09,
+0xFA, 0x07, 0xF8, 0xFA, 0xFB, 0x07, 0xFA, 0xF8, 0x08, 0x05, 0x08, 0x08, 0xF8, 0x0B, 0xFC, 0x08,
+0xF8, 0xF8, 0x0A, 0xFB, 0x08, 0xF7, 0xF9, 0xF7, 0x0B, 0xFD, 0x06, 0xF9, 0xF3, 0x05, 0x05, 0x09,
+0xF6, 0x05, 0xFA, 0xF7, 0xFB, 0x05, 0xF9, 0xF2, 0x0A, 0x03, 0x09, 0x0A, 0xFB, 0x0A, 0xFA, 0x08,
+0xF8, 0xF9, 0x0B, 0xF4, 0x05, 0xFC, 0xF7, 0xF4, 0x02, 0xF9, 0x08, 0xF8, 0xF9, 0x04, 0x0C, 0x0B,
+0xFF, 0x07, 0xFA, 0xFB, 0xF3, 0x0A, 0xFA, 0xFB, 0x08, 0x05, 0x0C, 0x0A, 0xF8, 0x06, 0xFA, 0x0C,
+0xF8, 0xF4, 0x04, 0xFA, 0x03, 0xFB, 0xF3, 0xF6, 0x02, 0x00, 0x0A, 0xF6, 0xF5, 0xFA, 0x0D, 0x0F,
+0xF7, 0x0D, 0xFB, 0xF6, 0xF2, 0x07, 0xF5, 0xF9, 0x00, 0x04, 0x08, 0x06, 0xF8, 0x02, 0xFA, 0x0B,
+0xF8, 0xFA, 0x04, 0xF8, 0x05, 0xFC, 0xF6, 0xF4, 0x07, 0xF8, 0x08, 0xF9, 0xF9, 0x04, 0x0A, 0x0C,
+0xFD, 0x08, 0xFB, 0xF8, 0xF8, 0x0A, 0xFB, 0xFD, 0x08, 0x04, 0x0B, 0x0B, 0xF8, 0x06, 0xF7, 0x09,
+0xFA, 0xF9, 0x0E, 0xF3, 0x04, 0xF7, 0xF4, 0xF7, 0x07, 0xFB, 0x08, 0xF9, 0xF9, 0x03, 0x04, 0x0B,
+0xF9, 0x0E, 0xF8, 0xFB, 0xF6, 0x0A, 0xF9, 0xF7, 0x01, 0x07, 0x09, 0x04, 0xF3, 0x04, 0xFA, 0x06,
+0xF7, 0xF2, 0x09, 0xF8, 0x06, 0xFD, 0xF9, 0xF5, 0xFF, 0xFE, 0x08, 0xFD, 0xF3, 0x02, 0x07, 0x0E,
+0xF9, 0x08, 0xFA, 0xF3, 0xF7, 0x0B, 0xF8, 0xF9, 0x04, 0x05, 0x0D, 0x08, 0xF2, 0x07, 0xFC, 0x0C,
+0xF6, 0xF4, 0x07, 0xF3, 0x01, 0xFC, 0xF4, 0xFB, 0xFF, 0xFA, 0x07, 0x00, 0xFA, 0x08, 0x0A, 0x06,
+0xF8, 0x0E, 0xF6, 0xF3, 0xF9, 0x09, 0xF7, 0xFA, 0x01, 0x07, 0x0C, 0x07, 0xF8, 0x03, 0xFC, 0x0F,
+0xF9, 0xFC, 0x04, 0xF8, 0x09, 0xFA, 0xF6, 0xF6, 0x05, 0xFA, 0x08, 0xF7, 0xF8, 0x08, 0x08, 0x07,
+0xFA, 0x06, 0xFA, 0xF9, 0xF7, 0x09, 0xF8, 0xFB, 0x09, 0x06, 0x07, 0x07, 0xFC, 0x07, 0xFA, 0x0A,
+0xF8, 0xF8, 0x05, 0xF9, 0x07, 0xFB, 0xF9, 0xF8, 0x08, 0xF7, 0x09, 0xF8, 0xF8, 0x08, 0x06, 0x08,
+0xFC, 0x07, 0xFA, 0xF8, 0xF9, 0x05, 0xF8, 0xF6, 0x07, 0x06, 0x04, 0x0A, 0xFD, 0x08, 0xFA, 0x07,
+0xF8, 0xFA, 0x09, 0xFA, 0x07, 0xFB, 0xF4, 0xF8, 0x05, 0xFB, 0x09, 0xF9, 0xF9, 0x08, 0x06, 0x09,
+0xF8, 0x07, 0xFA, 0xF9, 0xFA, 0x09, 0xF9, 0xF9, 0x05, 0x06, 0x08, 0x07, 0xF9, 0x0A, 0xFA, 0x09,
+0xF6, 0xFA, 0x08, 0xF8, 0x08, 0xFB, 0xF8, 0xF8, 0x06, 0xF8, 0x05, 0xF9, 0xF9, 0x07, 0x09, 0x04,
+0xF9, 0x09, 0xF9, 0xF9, 0xF9, 0x07, 0xF9, 0xFA, 0x08, 0x05, 0x08, 0x08, 0xFD, 0x0A, 0xF9, 0x09,
+0xF8, 0xF7, 0x0A, 0xFA, 0x08, 0xF8, 0xFA, 0xF9, 0x06, 0xFA, 0x05, 0xF9, 0xFA, 0x08, 0x06, 0x07,
+0xF8, 0x06, 0xFB, 0xF9, 0xF8, 0x05, 0xFA, 0xF9, 0x07, 0x05, 0x06, 0x09, 0xF9, 0x0D, 0xFA, 0x0B,
+0xF9, 0xF8, 0x07, 0xF7, 0x05, 0xFB, 0xF9, 0xFA, 0x03, 0xF9, 0x0A, 0xFA, 0xF8, 0x06, 0x09, 0x09,
+0xF8, 0x09, 0xFA, 0xF9, 0xF9, 0x08, 0xFA, 0xF9, 0x08, 0x06, 0x0A, 0x0A, 0xFA, 0x0A, 0xF9, 0x0A,
+0xF9, 0xF8, 0x06, 0xFA, 0x09, 0xF8, 0xF5, 0xF8, 0x07, 0xFB, 0x06, 0xF9, 0xF8, 0x05, 0x07, 0x05,
+0xFA, 0x08, 0xF9, 0xF7, 0xFB, 0x06, 0xFA, 0xF7, 0x06, 0x06, 0x07, 0x06, 0xF9, 0x0B, 0xF7, 0x08,
+0xFA, 0xF8, 0x04, 0xF7, 0x08, 0xFB, 0xF5, 0xF3, 0x05, 0xF9, 0x07, 0xFA, 0xF6, 0x04, 0x08, 0x05,
+0xFB, 0x05, 0xF9, 0xF8, 0xFB, 0x0A, 0xF6, 0xFA, 0x08, 0x07, 0x07, 0x04, 0xFA, 0x09, 0xF7, 0x09,
+0xFA, 0xF3, 0x04, 0xF6, 0x05, 0xF9, 0xF3, 0xFB, 0x05, 0xFE, 0x09, 0xFA, 0xF9, 0x05, 0x03, 0x09,
+0xF8, 0x07, 0xFC, 0xF8, 0xF6, 0x06, 0xFA, 0xF9, 0x08, 0x03, 0x06, 0x0C, 0xF7, 0x05, 0xF6, 0x0B,
+0xFA, 0xF9, 0x08, 0xFA, 0x04, 0xF4, 0xF7, 0xF9, 0x08, 0xF6, 0x09, 0xFC, 0xFB, 0x06, 0x08, 0x04,
+0x00, 0x07, 0xF3, 0xF9, 0xFB, 0x07, 0xF9, 0xF2, 0x0A, 0x05, 0x09, 0x06, 0xF5, 0xFF, 0xF9, 0x05,
+0xFB, 0xFA, 0x0B, 0xFB, 0x00, 0xF9, 0xF5, 0xF9, 0x09, 0xFA, 0x0C, 0xFE, 0xF6, 0xFF, 0x0C, 0x07,
+0xFF, 0x07, 0xF8, 0xF8, 0xFA, 0x09, 0xF9, 0xF9, 0x07, 0x03, 0x04, 0x08, 0xF7, 0x0B, 0xFB, 0x0B,
+0xF9, 0xFE, 0x08, 0xF8, 0x0B, 0xFC, 0xFD, 0xF9, 0x04, 0xFB, 0x06, 0xF9, 0xF7, 0x06, 0x08, 0x05,
+0xFB, 0x0B, 0xFA, 0xF8, 0xF6, 0x07, 0xFD, 0xFA, 0x06, 0x03, 0x09, 0x03, 0xF8, 0x0A, 0xF8, 0x08,
+0xF6, 0xFB, 0x06, 0xFB, 0x05, 0xF1, 0xFB, 0xF6, 0x06, 0x00, 0x03, 0xF7, 0xF5, 0x06, 0x04, 0x05,
+0xF9, 0x07, 0xF8, 0xF7, 0xF9, 0x09, 0xF5, 0xF6, 0x00, 0x02, 0x07, 0x06, 0xF0, 0x00, 0xF7, 0x06,
+0xFB, 0xF8, 0x07, 0xF3, 0x03, 0xFC, 0xF8, 0xF5, 0x00, 0x03, 0x03, 0xF9, 0xF3, 0x05, 0x0A, 0x0A,
+0xFA, 0x0E, 0xFB, 0xF9, 0xF4, 0x0A, 0xFB, 0xF9, 0x00, 0x03, 0x0A, 0x04, 0xF4, 0x03, 0xF5, 0x0B,
+0xFC, 0xF6, 0x0D, 0xFB, 0x09, 0xFE, 0xF3, 0xF7, 0x07, 0xFE, 0x0A, 0xF9, 0xFD, 0x02, 0x07, 0x03,
+0xFC, 0x07, 0xFF, 0xFA, 0xF8, 0x0A, 0xF6, 0xF3, 0x0A, 0x04, 0x06, 0x07, 0xFA, 0x00, 0xF6, 0x0C,
+0xFD, 0xF8, 0x0A, 0xFA, 0x04, 0xF7, 0xFB, 0xF7, 0x0B, 0xFA, 0x0D, 0x00, 0xFC, 0x04, 0x09, 0x07,
+0xF9, 0x05, 0xFB, 0xF8, 0xF5, 0x0C, 0xF8, 0xF9, 0x04, 0x01, 0x0A, 0x06, 0xF6, 0x06, 0xF6, 0x0A,
+0xFD, 0xF6, 0x01, 0xF7, 0x09, 0xF8, 0xFB, 0xF5, 0x05, 0xFF, 0x07, 0xFF, 0xF8, 0x02, 0x09, 0x06,
+0xF8, 0x0C, 0xF8, 0xF7, 0xF4, 0x06, 0xF9, 0xF6, 0x04, 0x04, 0x08, 0x06, 0xF2, 0x05, 0xF7, 0x09,
+0xFB, 0xFA, 0x04, 0xF8, 0x07, 0xF7, 0xFA, 0xF9, 0x09, 0xF8, 0x0C, 0xFA, 0xFA, 0x03, 0x07, 0x0A,
+0xFB, 0x06, 0xF5, 0xF8, 0xF8, 0x05, 0xF6, 0xF3, 0x06, 0x05, 0x07, 0x07, 0xFA, 0x09, 0xF7, 0x0B,
+0xF6, 0xFB, 0x06, 0xF8, 0x05, 0xF7, 0xF4, 0xF5, 0x04, 0xFB, 0x05, 0xFE, 0xF4, 0x04, 0x08, 0x0E,
+0xFB, 0x06, 0xFA, 0xF5, 0xF7, 0x07, 0xFC, 0xFB, 0x08, 0x06, 0x0A, 0x02, 0xFD, 0x03, 0xF7, 0x06,
+0xFF, 0xF1, 0x08, 0xF3, 0x05, 0xF3, 0xF4, 0xF8, 0x04, 0x00, 0x0B, 0xFE, 0xF9, 0x03, 0x0B, 0x0A,
+0x01, 0x03, 0xF6, 0xF4, 0xF4, 0x09, 0xF9, 0xFD, 0x00, 0x05, 0x09, 0x04, 0xF2, 0xFE, 0xFC, 0x0A,
+0xFD, 0xF3, 0x06, 0xF5, 0x07, 0xF6, 0xFA, 0xF0, 0x04, 0xFF, 0x0C, 0xFE, 0xFD, 0xFA, 0x10, 0x08,
+0xF7, 0x04, 0xF8, 0xF1, 0xF4, 0x04, 0xF8, 0xF8, 0x02, 0xFF, 0x04, 0x03, 0xF1, 0x01, 0xF8, 0x0C,
+0xFA, 0xF7, 0x07, 0xF2, 0x04, 0xFD, 0xF8, 0xF3, 0x00, 0xF9, 0x04, 0xFC, 0xF6, 0x02, 0x0B, 0x03,
+0xFD, 0x04, 0xF7, 0xFB, 0xF2, 0x05, 0xF5, 0xF5, 0x02, 0x05, 0x05, 0x05, 0xF9, 0x03, 0xF2, 0x0B,
+0xFD, 0xF5, 0x0A, 0xF7, 0x05, 0xF8, 0xFC, 0xFA, 0x03, 0xFC, 0x0C, 0xF9, 0xF4, 0x02, 0x07, 0x08,
+0xF6, 0x08, 0xF8, 0xF8, 0xF5, 0x03, 0xFA, 0xF3, 0x07, 0x05, 0x05, 0x0A, 0xF9, 0x0B, 0xF7, 0x06,
+0xFB, 0xFB, 0x05, 0xFB, 0x06, 0xF9, 0xF9, 0xF9, 0x06, 0xFA, 0x0B, 0xFD, 0xFA, 0x05, 0x05, 0x09,
+0xFA, 0x07, 0xFB, 0xF6, 0xF6, 0x0C, 0xF9, 0xF8, 0x08, 0x06, 0x06, 0x04, 0xFB, 0x07, 0xF6, 0x08,
+0xFB, 0xFA, 0x04, 0xF5, 0x09, 0xF6, 0xF1, 0xF9, 0x00, 0x00, 0x0E, 0xFB, 0xFA, 0x02, 0x07, 0x09,
+0xFF, 0x0C, 0xF8, 0xF7, 0xF4, 0x07, 0xFB, 0xF4, 0x04, 0x06, 0x08, 0x09, 0xF6, 0x06, 0xF8, 0x07,
+0xFD, 0xF3, 0x0F, 0xF7, 0x06, 0xFE, 0xF8, 0xFC, 0x07, 0xF7, 0x08, 0xFB, 0xF4, 0x06, 0x09, 0x07,
+0xF7, 0x08, 0xF5, 0xFA, 0xFB, 0x03, 0xF9, 0xFB, 0x05, 0x07, 0x03, 0x06, 0xFB, 0x0A, 0xF4, 0x04,
+0xF5, 0xFC, 0x09, 0xFD, 0x07, 0xF9, 0xF4, 0xF9, 0x08, 0xFB, 0x07, 0xFA, 0xF6, 0x02, 0x05, 0x05,
+0xF9, 0x05, 0xF9, 0xF8, 0xFA, 0x07, 0xFE, 0xF5, 0x0A, 0x06, 0x03, 0x07, 0xFE, 0x0B, 0xFA, 0x09,
+0xFD, 0xF9, 0x08, 0xF3, 0x0C, 0xFA, 0xF4, 0xF5, 0x06, 0xFD, 0x0D, 0xFD, 0xFB, 0xFE, 0x04, 0x0A,
+0xFA, 0x0B, 0xFC, 0xF7, 0xFA, 0x05, 0xF4, 0xFB, 0x09, 0x04, 0x08, 0x03, 0x01, 0x09, 0xFA, 0x05,
+0xFD, 0xF4, 0x06, 0xFA, 0x02, 0xFC, 0xF5, 0xF9, 0x02, 0xFD, 0x05, 0x01, 0xFA, 0x01, 0x06, 0x08,
+0xF7, 0x0B, 0xF5, 0xF5, 0xF6, 0x0C, 0xF7, 0xFA, 0x07, 0x03, 0x0C, 0x08, 0xF8, 0x06, 0xF8, 0x05,
+0xFA, 0xF9, 0x0A, 0xF9, 0x08, 0xF8, 0xFC, 0xF4, 0x03, 0xF9, 0x06, 0xFB, 0xF9, 0x05, 0x0D, 0x06,
+0xFB, 0x07, 0xF8, 0xF5, 0xF6, 0x08, 0xF9, 0xF8, 0x00, 0x03, 0x07, 0x05, 0xF8, 0x02, 0xFA, 0x0B,
+0xF6, 0xFA, 0x04, 0xF8, 0x06, 0xF5, 0xF6, 0xF1, 0x01, 0xFA, 0x06, 0xF8, 0xF8, 0x00, 0x0A, 0x0B,
+0xFA, 0x04, 0xF5, 0xF6, 0xFB, 0x0D, 0xFC, 0xF2, 0x04, 0x03, 0x04, 0x07, 0xFA, 0x08, 0xF9, 0x05,
+0xFB, 0xF6, 0x0B, 0xF8, 0x09, 0xFC, 0xF9, 0xF7, 0x01, 0xFC, 0x07, 0xF8, 0xF8, 0x07, 0x08, 0x0C,
+0xF8, 0x09, 0xFA, 0xFD, 0xF8, 0x08, 0xF8, 0xFA, 0x05, 0x05, 0x06, 0x05, 0xFD, 0x0C, 0xF2, 0x08,
+0xFB, 0xF7, 0x03, 0xF7, 0x06, 0xFB, 0xF3, 0xF9, 0x06, 0xFC, 0x09, 0xFB, 0xF8, 0x03, 0x0B, 0x09,
+0xFA, 0x09, 0xF6, 0xFC, 0xFA, 0x09, 0xF7, 0xF7, 0x03, 0x06, 0x04, 0x06, 0xFE, 0x02, 0xF3, 0x0D,
+0xFA, 0xFD, 0x08, 0xFD, 0x0B, 0xFB, 0xF4, 0xF4, 0x02, 0xFD, 0x03, 0xFA, 0xFB, 0x07, 0x04, 0x01,
+0xFB, 0x03, 0xFA, 0xFA, 0xFC, 0x0A, 0xF7, 0xF1, 0x06, 0x05, 0x0A, 0x07, 0xF2, 0x05, 0xF4, 0x0A,
+0xFD, 0xFB, 0x08, 0xFA, 0x09, 0xFC, 0xFA, 0xF6, 0x06, 0xFB, 0x06, 0xF7, 0xF2, 0x03, 0x09, 0x07,
+0xFB, 0x09, 0xF8, 0xFB, 0xF8, 0x07, 0xF8, 0xF7, 0x06, 0x08, 0x07, 0x03, 0xFB, 0x03, 0xF9, 0x09,
+0xFB, 0xFB, 0x0B, 0xF3, 0x03, 0xFD, 0xF7, 0xF3, 0x02, 0xFF, 0x05, 0xFE, 0xF3, 0x06, 0x0D, 0x0C,
+0xF9, 0x09, 0xFB, 0xFC, 0xF8, 0x0F, 0xFB, 0xF5, 0x03, 0x02, 0x04, 0x07, 0xF3, 0x02, 0xF7, 0x04,
+0xF4, 0xFB, 0x02, 0xF7, 0x0B, 0xF8, 0xF9, 0xFB, 0x08, 0xFE, 0x0B, 0xF4, 0xFC, 0xFF, 0x05, 0x08,
+0xFA, 0x09, 0xF6, 0xF8, 0xF5, 0x06, 0xF6, 0xF3, 0x05, 0xFF, 0x05, 0x0B, 0xF2, 0x01, 0xFC, 0x06,
+0xFB, 0xF9, 0x05, 0xF6, 0x07, 0xFD, 0xF8, 0xFA, 0x04, 0xFA, 0x06, 0xFB, 0xFA, 0x06, 0x09, 0x08,
+0xF9, 0x0B, 0xFC, 0xF9, 0xFA, 0x07, 0xF9, 0xF7, 0x05, 0x05, 0x0C, 0x07, 0xFB, 0x09, 0xF9, 0x09,
+0xF7, 0xF7, 0x06, 0xF9, 0x06, 0xF8, 0xF9, 0xF7, 0x08, 0xFD, 0x0B, 0xF8, 0xF8, 0x04, 0x08, 0x08,
+0xF9, 0x06, 0xF8, 0xF9, 0xFB, 0x05, 0xFB, 0xF9, 0x05, 0x01, 0x05, 0x08, 0xFA, 0x0B, 0xF7, 0x08,
+0xFB, 0xF7, 0x07, 0xF4, 0x04, 0xF9, 0xF4, 0xF4, 0x08, 0xFA, 0x06, 0xFA, 0xF6, 0x03, 0x04, 0x08,
+0xF9, 0x06, 0xFB, 0xF8, 0xF6, 0x07, 0xFB, 0xF8, 0x06, 0x05, 0x05, 0x08, 0xFC, 0x05, 0xF7, 0x07,
+0xFC, 0xF7, 0x07, 0xF1, 0x03, 0xFF, 0xF7, 0xF3, 0x02, 0xFF, 0x0A, 0xFB, 0xF7, 0x03, 0x06, 0x08,
+0xFA, 0x08, 0xFA, 0xFB, 0xF7, 0x0D, 0xF9, 0xF4, 0x05, 0x05, 0x07, 0x06, 0xF9, 0x09, 0xF5, 0x05,
+0xF7, 0xFA, 0x0C, 0xF5, 0x07, 0xFC, 0xF2, 0xF9, 0x01, 0x01, 0x07, 0xF7, 0xFC, 0x00, 0x06, 0x0A,
+0xFF, 0x0B, 0xF1, 0xFB, 0xF5, 0x0A, 0xF9, 0xF8, 0x03, 0x04, 0x0E, 0x06, 0xFC, 0x04, 0xF4, 0x0B,
+0xF5, 0xFA, 0x0C, 0xF6, 0x06, 0xFE, 0xFA, 0xFC, 0x01, 0xFA, 0x08, 0xF9, 0xF9, 0x04, 0x07, 0x06,
+0xF8, 0x0B, 0xF6, 0xF7, 0xF8, 0x08, 0xF6, 0xF5, 0x02, 0x06, 0x07, 0x06, 0xF6, 0x06, 0xFB, 0x05,
+0xFA, 0xFA, 0x0C, 0xFA, 0x05, 0xFF, 0xFA, 0xFA, 0x04, 0xF7, 0x0A, 0xFC, 0xF6, 0x03, 0x0D, 0x08,
+0xF7, 0x07, 0xF7, 0xFA, 0xF9, 0x0A, 0xF9, 0xF7, 0x04, 0x05, 0x09, 0x04, 0xF3, 0x06, 0xF9, 0x06,
+0xFB, 0xF3, 0x04, 0xF2, 0x0A, 0xF6, 0xF6, 0xFD, 0x04, 0xFC, 0x09, 0xFB, 0xF8, 0xFF, 0x08, 0x09,
+0xF9, 0x04, 0xF3, 0xF4, 0xF9, 0x09, 0xFC, 0xF4, 0x05, 0x05, 0x07, 0x05, 0xF7, 0x01, 0xF9, 0x0B,
+0xF7, 0xFC, 0x05, 0xF2, 0x06, 0xF6, 0xF6, 0xF5, 0x08, 0xFF, 0x06, 0xFC, 0xF3, 0xFF, 0x0C, 0x07,
+0xFE, 0x0C, 0xF8, 0xF4, 0xF3, 0x04, 0xF3, 0xF4, 0x07, 0xFD, 0x03, 0x06, 0xF7, 0x00, 0xFA, 0x07,
+0xF6, 0xFC, 0x05, 0xFA, 0x03, 0xFB, 0xF5, 0xFB, 0x04, 0xFD, 0x08, 0xF9, 0xF3, 0x08, 0x0A, 0x07,
+0xFB, 0x0A, 0xFE, 0xFC, 0xF4, 0x0A, 0xF5, 0xF4, 0x06, 0x07, 0x04, 0x0A, 0xFC, 0x06, 0xF5, 0x05,
+0xFC, 0xFB, 0x06, 0xF7, 0x08, 0xFD, 0xF9, 0xF7, 0x08, 0xFB, 0x08, 0xFA, 0xF8, 0x07, 0x06, 0x07,
+0xF9, 0x09, 0xF9, 0xF6, 0xFA, 0x06, 0xFD, 0xF6, 0x04, 0x07, 0x08, 0x07, 0xFD, 0x0D, 0xF8, 0x0B,
+0xF9, 0xFA, 0x06, 0xF9, 0x06, 0xFB, 0xF7, 0xF8, 0x08, 0xFA, 0x07, 0xF9, 0xF8, 0x05, 0x06, 0x07,
+0xF8, 0x09, 0xF9, 0xF6, 0xFB, 0x05, 0xF9, 0xF9, 0x07, 0x04, 0x09, 0x07, 0xFA, 0x08, 0xF9, 0x06,
+0xFB, 0xFA, 0x03, 0xFB, 0x07, 0xFB, 0xF7, 0xFA, 0x07, 0xF9, 0x07, 0xFA, 0xF9, 0x08, 0x07, 0x08,
+0xFA, 0x07, 0xF9, 0xF8, 0xFB, 0x08, 0xFC, 0xF9, 0x07, 0x05, 0x05, 0x09, 0xFA, 0x0D, 0xF8, 0x08,
+0xF9, 0xFA, 0x03, 0xF8, 0x07, 0xFA, 0xF6, 0xF9, 0x07, 0xF9, 0x06, 0xFA, 0xFA, 0x08, 0x08, 0x08,
+0xFA, 0x06, 0xF8, 0xF8, 0xF8, 0x07, 0xFA, 0xF9, 0x07, 0x05, 0x07, 0x08, 0xFA, 0x08, 0xF8, 0x0A,
+0xF9, 0xF8, 0x05, 0xF9, 0x06, 0xFA, 0xF8, 0xF9, 0x06, 0xFA, 0x07, 0xFA, 0xF7, 0x06, 0x08, 0x08,
+0xFA, 0x09, 0xF8, 0xF8, 0xF8, 0x07, 0xFA, 0xF9, 0x06, 0x04, 0x06, 0x07, 0xFA, 0x0D, 0xF9, 0x08,
+0xFA, 0xF9, 0x08, 0xF9, 0x07, 0xFC, 0xF9, 0xF9, 0x07, 0xFA, 0x05, 0xF8, 0xF8, 0x06, 0x06, 0x06,
+0xFA, 0x08, 0xF8, 0xF9, 0xF9, 0x08, 0xF9, 0xF7, 0x05, 0x05, 0x08, 0x08, 0xFB, 0x0C, 0xF9, 0x09,
+0xF9, 0xF8, 0x08, 0xFA, 0x06, 0xFA, 0xF8, 0xF9, 0x07, 0xFA, 0x08, 0xFA, 0xF9, 0x08, 0x07, 0x06,
+0xFA, 0x07, 0xFA, 0xF9, 0xFA, 0x07, 0xF9, 0xF8, 0x08, 0x05, 0x07, 0x08, 0xFC, 0x0C, 0xFA, 0x09,
+0xFA, 0xFA, 0x08, 0xF9, 0x06, 0xFB, 0xF9, 0xFA, 0x07, 0xFA, 0x07, 0xF9, 0xF9, 0x07, 0x08, 0x07,
+0xFA, 0x07, 0xF9, 0xF7, 0xF9, 0x06, 0xFB, 0xF5, 0x08, 0x04, 0x07, 0x07, 0xFC, 0x09, 0xF9, 0x08,
+0xF9, 0xF8, 0x03, 0xFA, 0x05, 0xFA, 0xF7, 0xFA, 0x06, 0xFA, 0x05, 0xF9, 0xF8, 0x06, 0x08, 0x08,
+0xF9, 0x07, 0xFA, 0xF7, 0xF8, 0x09, 0xFA, 0xFA, 0x08, 0x04, 0x09, 0x07, 0xFB, 0x09, 0xF9, 0x08,
+0xF5, 0xF2, 0x0D, 0xF5, 0x0A, 0xF2, 0xF5, 0xF2, 0x0B, 0xF8, 0x0C, 0xF4, 0xF5, 0x0C, 0x0D, 0x0B,
+0xF2, 0x0A, 0xF2, 0xF3, 0xF1, 0x0C, 0xF5, 0xF2, 0x0B, 0x0D, 0x0C, 0x0F, 0xEF, 0x0D, 0xF1, 0x10,
+0xF1, 0xF1, 0x10, 0xF2, 0x0B, 0xF3, 0xF3, 0xF2, 0x0A, 0xF5, 0x0F, 0xF3, 0xF1, 0x09, 0x0C, 0x0D,
+0xF5, 0x09, 0xF6, 0xF4, 0xF3, 0x0C, 0xF2, 0xF2, 0x0C, 0x0D, 0x0A, 0x0C, 0xF6, 0x10, 0xF3, 0x13,
+0xF3, 0xF1, 0x0D, 0xF0, 0x0F, 0xF1, 0xF7, 0xF0, 0x0C, 0xF7, 0x0D, 0xF7, 0xF4, 0x0C, 0x0E, 0x0D,
+0xF3, 0x0F, 0xF4, 0xF5, 0xF5, 0x0E, 0xF5, 0xF5, 0x10, 0x0D, 0x0D, 0x0E, 0xF7, 0x10, 0xF5, 0x14,
+0xF4, 0xF2, 0x0D, 0xF4, 0x0C, 0xF5, 0xF2, 0xF3, 0x0B, 0xF5, 0x0D, 0xF4, 0xF3, 0x0E, 0x0C, 0x0F,
+0xF4, 0x0C, 0xF4, 0xF5, 0xF3, 0x0D, 0xF4, 0xF2, 0x0C, 0x0B, 0x0E, 0x0E, 0xF5, 0x11, 0xF3, 0x0F,
+0xF4, 0xF0, 0x0E, 0xF5, 0x09, 0xF3, 0xF1, 0xF0, 0x0C, 0xF6, 0x0C, 0xF6, 0xF2, 0x0B, 0x0F, 0x0B,
+0xF5, 0x0E, 0xF5, 0xF4, 0xF4, 0x0C, 0xF0, 0xF0, 0x0C, 0x0E, 0x0B, 0x0B, 0xF5, 0x0D, 0xF1, 0x0E,
+0xF3, 0xF3, 0x0E, 0xF5, 0x10, 0xF3, 0xF3, 0xF3, 0x0B, 0xF5, 0x0E, 0xF6, 0xF5, 0x0E, 0x0D, 0x0E,
+0xF6, 0x0F, 0xF4, 0xF5, 0xF4, 0x11, 0xF3, 0xF3, 0x0F, 0x0F, 0x0D, 0x0E, 0xF6, 0x11, 0xF4, 0x0C,
+0xF7, 0xF4, 0x0C, 0xF1, 0x0D, 0xF1, 0xF3, 0xF4, 0x0D, 0xF7, 0x0B, 0xF3, 0xF5, 0x0D, 0x0C, 0x0C,
+0xF3, 0x0E, 0xF3, 0xF5, 0xF1, 0x0D, 0xF3, 0xF2, 0x0D, 0x0F, 0x0A, 0x0F, 0xF4, 0x0D, 0xEF, 0x0D,
+0xF3, 0xF2, 0x0E, 0xF4, 0x0A, 0xF4, 0xF2, 0xF3, 0x0B, 0xF4, 0x0E, 0xF6, 0xF5, 0x0C, 0x0B, 0x10,
+0xF4, 0x0D, 0xF6, 0xF5, 0xF3, 0x0E, 0xF3, 0xF3, 0x0B, 0x0E, 0x0D, 0x0F, 0xF4, 0x11, 0xF6, 0x0E,
+0xF8, 0xF6, 0x09, 0xF3, 0x0F, 0xF3, 0xF8, 0xF1, 0x0A, 0xF7, 0x0B, 0xF4, 0xF7, 0x08, 0x0A, 0x0F,
+0xEE, 0x09, 0xF1, 0xF1, 0xF0, 0x11, 0xF0, 0xF2, 0x10, 0x09, 0x0E, 0x0C, 0xF7, 0x0C, 0xF2, 0x10,
+0xF2, 0xF4, 0x09, 0xF4, 0x0C, 0xF3, 0xF4, 0xF4, 0x0E, 0xF5, 0x0F, 0xF4, 0xF5, 0x0D, 0x0C, 0x0B,
+0xF3, 0x0D, 0xF1, 0xF2, 0xF6, 0x0D, 0xF0, 0xF3, 0x0C, 0x0A, 0x0E, 0x0B, 0xF9, 0x12, 0xF3, 0x10,
+0xF7, 0xF2, 0x0F, 0xF1, 0x09, 0xF1, 0xF5, 0xF4, 0x0A, 0xF8, 0x0E, 0xF4, 0xF5, 0x0D, 0x0D, 0x0D,
+0xF3, 0x0E, 0xF3, 0xF1, 0xF2, 0x0E, 0xF2, 0xF4, 0x08, 0x09, 0x0E, 0x09, 0xF4, 0x0C, 0xF3, 0x0F,
+0xF0, 0xF1, 0x0C, 0xF6, 0x0D, 0xF3, 0xF5, 0xF3, 0x0A, 0xF6, 0x0E, 0xF1, 0xF2, 0x0F, 0x0B, 0x0B,
+0xF3, 0x0B, 0xF5, 0xF5, 0xF5, 0x0F, 0xF2, 0xF5, 0x0D, 0x08, 0x0C, 0x0D, 0xF3, 0x11, 0xF2, 0x0E,
+0xF2, 0xF3, 0x0F, 0xF5, 0x0A, 0xF1, 0xF3, 0xF6, 0x0B, 0xF8, 0x0C, 0xF4, 0xF6, 0x0C, 0x0D, 0x0C,
+0xF1, 0x11, 0xF3, 0xF3, 0xF2, 0x10, 0xF4, 0xF4, 0x0E, 0x09, 0x0D, 0x0E, 0xF1, 0x11, 0xF6, 0x0D,
+0xF4, 0xF4, 0x0E, 0xF5, 0x0B, 0xF3, 0xF1, 0xF2, 0x09, 0xF5, 0x11, 0xF5, 0xF2, 0x0D, 0x0B, 0x0C,
+0xF2, 0x09, 0xF6, 0xF6, 0xF0, 0x0F, 0xF6, 0xF4, 0x0A, 0x0A, 0x10, 0x0D, 0xF4, 0x0E, 0xF4, 0x0F,
+0xF3, 0xF5, 0x0D, 0xF2, 0x0C, 0xF1, 0xF4, 0xF4, 0x0E, 0xF6, 0x0F, 0xF3, 0xF3, 0x0B, 0x0A, 0x0D,
+0xF0, 0x11, 0xF5, 0xF5, 0xF4, 0x0F, 0xF6, 0xF5, 0x0C, 0x0A, 0x0E, 0x0D, 0xF6, 0x10, 0xF3, 0x0C,
+0xF2, 0xF2, 0x0A, 0xF5, 0x0C, 0xF3, 0xF4, 0xF3, 0x0C, 0xF5, 0x0F, 0xF2, 0xF4, 0x0C, 0x08, 0x0C,
+0xF4, 0x0D, 0xF5, 0xF4, 0xF4, 0x0D, 0xF5, 0xF4, 0x0D, 0x08, 0x0D, 0x0C, 0xF2, 0x0F, 0xF1, 0x10,
+0xF5, 0xF2, 0x0B, 0xF1, 0x0A, 0xF3, 0xED, 0xF4, 0x0A, 0xF6, 0x11, 0xF9, 0xF4, 0x05, 0x0B, 0x0D,
+0xF4, 0x0B, 0xF2, 0xF4, 0xF7, 0x0E, 0xF0, 0xF1, 0x09, 0x06, 0x0B, 0x0E, 0xF3, 0x0C, 0xF3, 0x12,
+0xF2, 0xF4, 0x0B, 0xF4, 0x0D, 0xF1, 0xF2, 0xF2, 0x0A, 0xF7, 0x11, 0xF4, 0xF1, 0x09, 0x0D, 0x0A,
+0xF3, 0x0B, 0xF3, 0xF7, 0xF1, 0x0F, 0xF5, 0xF4, 0x09, 0x0A, 0x0E, 0x0E, 0xF6, 0x0E, 0xF1, 0x11,
+0xF2, 0xF3, 0x0C, 0xF7, 0x0C, 0xF3, 0xF5, 0xF5, 0x0D, 0xF4, 0x0E, 0xF6, 0xF5, 0x0E, 0x0C, 0x0B,
+0xF4, 0x0C, 0xF5, 0xF4, 0xF3, 0x0D, 0xF5, 0xF5, 0x0C, 0x0B, 0x0E, 0x0C, 0xF8, 0x15, 0xF5, 0x11,
+0xF2, 0xF2, 0x09, 0xF4, 0x0C, 0xF3, 0xF4, 0xF5, 0x0D, 0xF3, 0x0E, 0xF3, 0xF4, 0x0B, 0x0B, 0x0D,
+0xF3, 0x0C, 0xF5, 0xF3, 0xF3, 0x0E, 0xF4, 0xF5, 0x0B, 0x07, 0x0F, 0x0D, 0xF3, 0x11, 0xF5, 0x12,
+0xF3, 0xF3, 0x0D, 0xF4, 0x0E, 0xF2, 0xF5, 0xF2, 0x0C, 0xF4, 0x0D, 0xF5, 0xF4, 0x0B, 0x0D, 0x0C,
+0xF3, 0x0D, 0xF5, 0xF4, 0xF4, 0x0D, 0xF3, 0xF4, 0x0B, 0x0A, 0x0C, 0x0D, 0xF5, 0x10, 0xF4, 0x11,
+0xF3, 0xF3, 0x0F, 0xF6, 0x0C, 0xF2, 0xF5, 0xF4, 0x0D, 0xF4, 0x0D, 0xF6, 0xF5, 0x0B, 0x0C, 0x0C,
+0xF4, 0x0A, 0xF3, 0xF3, 0xF3, 0x0D, 0xF4, 0xF5, 0x0C, 0x0B, 0x0D, 0x0D, 0xF4, 0x13, 0xF4, 0x10,
+0xF4, 0xF4, 0x0C, 0xF4, 0x0F, 0xF4, 0xF3, 0xF4, 0x0B, 0xF2, 0x0F, 0xF7, 0xF2, 0x07, 0x0F, 0x0D,
+0xF5, 0x0C, 0xF4, 0xF4, 0xF0, 0x0B, 0xF1, 0xF5, 0x0B, 0x07, 0x0D, 0x0C, 0xF5, 0x12, 0xF7, 0x12,
+0xF7, 0xF6, 0x11, 0xF4, 0x0F, 0xF0, 0xF2, 0xF4, 0x09, 0xFA, 0x0D, 0xF6, 0xEF, 0x07, 0x09, 0x0F,
+0xF5, 0x0B, 0xF2, 0xF5, 0xEF, 0x0B, 0xF2, 0xF2, 0x07, 0x06, 0x12, 0x0D, 0xEB, 0x09, 0xEF, 0x0D,
+0xF6, 0xF5, 0x0B, 0xF1, 0x0E, 0xF0, 0xF4, 0xF2, 0x0C, 0xF4, 0x0E, 0xF6, 0xF4, 0x07, 0x0A, 0x0D,
+0xF0, 0x0B, 0xF1, 0xF4, 0xF7, 0x0F, 0xF2, 0xF5, 0x09, 0x09, 0x0F, 0x0D, 0xF1, 0x09, 0xF0, 0x0E,
+0xF3, 0xF2, 0x0E, 0xF7, 0x0B, 0xF2, 0xF1, 0xF4, 0x0C, 0xF4, 0x0D, 0xF3, 0xF3, 0x0D, 0x0C, 0x0F,
+0xF5, 0x0D, 0xF5, 0xF1, 0xF3, 0x0E, 0xF1, 0xF6, 0x09, 0x08, 0x10, 0x0C, 0xF4, 0x13, 0xF2, 0x11,
+0xF3, 0xF4, 0x10, 0xF2, 0x0C, 0xF0, 0xF3, 0xF3, 0x0A, 0xF5, 0x0D, 0xF7, 0xF4, 0x0C, 0x0B, 0x0D,
+0xF4, 0x0E, 0xF4, 0xF4, 0xF3, 0x0C, 0xF4, 0xF4, 0x0B, 0x08, 0x0F, 0x0B, 0xF8, 0x13, 0xF3, 0x11,
+0xF5, 0xF4, 0x0C, 0xF4, 0x0E, 0xF2, 0xF4, 0xF3, 0x0C, 0xF3, 0x0E, 0xF4, 0xF4, 0x0E, 0x0C, 0x0E,
+0xF4, 0x0E, 0xF5, 0xF6, 0xF4, 0x0D, 0xF3, 0xF2, 0x0B, 0x09, 0x0E, 0x0D, 0xF4, 0x13, 0xF7, 0x12,
+0xF1, 0xF3, 0x0F, 0xF6, 0x0D, 0xF2, 0xF6, 0xF3, 0x0D, 0xF3, 0x0D, 0xF6, 0xF4, 0x0E, 0x0C, 0x0D,
+0xF5, 0x0B, 0xF5, 0xF5, 0xF4, 0x0E, 0xF3, 0xF5, 0x0C, 0x08, 0x0D, 0x0B, 0xF5, 0x15, 0xF4, 0x13,
+0xF4, 0xF5, 0x0D, 0xF4, 0x10, 0xF4, 0xF5, 0xF3, 0x0C, 0xF4, 0x0E, 0xF5, 0xF4, 0x0B, 0x0D, 0x0C,
+0xF4, 0x0B, 0xF5, 0xF4, 0xF5, 0x0F, 0xF4, 0xF5, 0x0B, 0x0B, 0x10, 0x0D, 0xF5, 0x12, 0xF4, 0x13,
+0xF3, 0xF3, 0x0A, 0xF2, 0x0C, 0xF2, 0xF2, 0xF1, 0x0C, 0xF6, 0x10, 0xF3, 0xF2, 0x09, 0x0A, 0x0C,
+0xF6, 0x0E, 0xF3, 0xF3, 0xF4, 0x0D, 0xF2, 0xEF, 0x0E, 0x0A, 0x0C, 0x10, 0xF0, 0x0F, 0xF5, 0x10,
+0xF6, 0xF4, 0x0D, 0xF6, 0x0C, 0xF6, 0xF3, 0xF4, 0x0B, 0xF5, 0x0D, 0xF4, 0xF1, 0x08, 0x0B, 0x0D,
+0xF3, 0x0E, 0xF3, 0xF2, 0xF4, 0x0F, 0xF2, 0xF1, 0x0C, 0x0B, 0x0D, 0x0B, 0xF0, 0x0D, 0xF4, 0x0F,
+0xF7, 0xF1, 0x11, 0xF3, 0x0B, 0xF2, 0xF5, 0xF3, 0x0B, 0xFA, 0x10, 0xF7, 0xF5, 0x0A, 0x0E, 0x10,
+0xF2, 0x0B, 0xF1, 0xF0, 0xF0, 0x0E, 0xF4, 0xF2, 0x09, 0x0A, 0x0E, 0x0D, 0xF6, 0x09, 0xF0, 0x12,
+0xF2, 0xF5, 0x0B, 0xEF, 0x08, 0xEE, 0xEC, 0xF5, 0x08, 0xF2, 0x0F, 0xF6, 0xF5, 0x08, 0x0D, 0x12,
+0xF6, 0x0E, 0xF2, 0xF2, 0xF4, 0x0E, 0xF2, 0xEE, 0x0B, 0x0B, 0x0D, 0x0A, 0xF2, 0x09, 0xF1, 0x0B,
+0xF3, 0xF3, 0x0C, 0xF5, 0x0E, 0xF1, 0xF7, 0xF2, 0x0E, 0xF5, 0x0E, 0xF5, 0xF6, 0x0C, 0x0B, 0x0D,
+0xF2, 0x0D, 0xF4, 0xF4, 0xF5, 0x0C, 0xF2, 0xF4, 0x0D, 0x0D, 0x0E, 0x0E, 0xF7, 0x13, 0xF4, 0x12,
+0xF3, 0xF5, 0x0B, 0xF3, 0x0F, 0xF2, 0xF5, 0xF3, 0x0F, 0xF4, 0x0D, 0xF3, 0xF4, 0x0B, 0x09, 0x0E,
+0xF4, 0x0D, 0xF5, 0xF4, 0xF4, 0x0B, 0xF3, 0xF4, 0x0C, 0x0C, 0x0D, 0x0D, 0xF3, 0x11, 0xF5, 0x12,
+0xF3, 0xF3, 0x0C, 0xF4, 0x11, 0xF3, 0xF6, 0xF4, 0x0C, 0xF5, 0x0E, 0xF6, 0xF5, 0x0C, 0x0D, 0x0C,
+0xF4, 0x0D, 0xF4, 0xF4, 0xF4, 0x0E, 0xF5, 0xF4, 0x0C, 0x0A, 0x0F, 0x0C, 0xF7, 0x16, 0xF4, 0x13,
+0xF3, 0xF1, 0x0B, 0xF4, 0x0C, 0xF2, 0xF7, 0xF2, 0x0E, 0xF5, 0x0D, 0xF4, 0xF3, 0x0B, 0x0B, 0x0D,
+0xF2, 0x0D, 0xF5, 0xF5, 0xF6, 0x0F, 0xF2, 0xF3, 0x0B, 0x0B, 0x0F, 0x0F, 0xF6, 0x13, 0xF5, 0x11,
+0xF5, 0xF3, 0x0C, 0xF4, 0x0D, 0xF2, 0xF3, 0xF0, 0x0C, 0xF7, 0x0E, 0xF4, 0xF1, 0x0A, 0x0B, 0x0A,
+0xF5, 0x0E, 0xF4, 0xF3, 0xF4, 0x0E, 0xF3, 0xEF, 0x0C, 0x07, 0x0D, 0x0B, 0xF3, 0x10, 0xF2, 0x11,
+0xF4, 0xF3, 0x10, 0xF3, 0x0C, 0xF1, 0xF4, 0xF4, 0x0C, 0xF6, 0x0C, 0xF7, 0xF3, 0x0C, 0x0E, 0x0F,
+0xF4, 0x0E, 0xF4, 0xF5, 0xF5, 0x0D, 0xF4, 0xF2, 0x0B, 0x09, 0x0F, 0x0E, 0xF6, 0x0F, 0xF5, 0x10,
+0xF7, 0xF5, 0x11, 0xF1, 0x0E, 0xF3, 0xF2, 0xF5, 0x08, 0xF9, 0x12, 0xF0, 0xF4, 0x07, 0x0E, 0x0B,
+0xF3, 0x13, 0xF3, 0xF1, 0xF3, 0x0F, 0xF5, 0xF3, 0x09, 0x0A, 0x0F, 0x06, 0xFA, 0x08, 0xF2, 0x08,
+0xF4, 0xF3, 0x0E, 0xF2, 0x0F, 0xF3, 0xF7, 0xF4, 0x0D, 0xF4, 0x0D, 0xF4, 0xF3, 0x0C, 0x0C, 0x0C,
+0xF4, 0x0E, 0xF3, 0xF6, 0xF5, 0x0E, 0xF2, 0xF2, 0x0D, 0x06, 0x0F, 0x0D, 0xF8, 0x15, 0xF3, 0x15,
+0xF1, 0xF3, 0x0F, 0xF5, 0x0B, 0xF1, 0xF5, 0xF4, 0x0E, 0xF5, 0x0D, 0xF6, 0xF3, 0x0B, 0x0C, 0x0E,
+0xF4, 0x0C, 0xF6, 0xF4, 0xF3, 0x0F, 0xF2, 0xF4, 0x0A, 0x0B, 0x0E, 0x0E, 0xF6, 0x12, 0xF3, 0x13,
+0xF4, 0xF2, 0x0F, 0xF1, 0x09, 0xF3, 0xF4, 0xF0, 0x0C, 0xF6, 0x0C, 0xF6, 0xF4, 0x0B, 0x0D, 0x0E,
+0xF3, 0x0F, 0xF4, 0xF3, 0xF5, 0x0E, 0xF2, 0xEF, 0x0B, 0x0B, 0x0C, 0x0C, 0xF8, 0x10, 0xF4, 0x13,
+0xF4, 0xF3, 0x0B, 0xF2, 0x0D, 0xF2, 0xF4, 0xF3, 0x0C, 0xF6, 0x0E, 0xF4, 0xF2, 0x0D, 0x0B, 0x0D,
+0xF6, 0x0D, 0xF4, 0xF3, 0xF0, 0x0E, 0xF4, 0xF4, 0x0B, 0x0A, 0x0D, 0x0E, 0xF3, 0x12, 0xF4, 0x13,
+0xF4, 0xF3, 0x0D, 0xF3, 0x0C, 0xF3, 0xF7, 0xF1, 0x0C, 0xF4, 0x0E, 0xF4, 0xF5, 0x0C, 0x0D, 0x0D,
+0xF4, 0x0F, 0xF5, 0xF4, 0xF2, 0x0D, 0xF4, 0xF6, 0x0C, 0x0B, 0x0F, 0x0D, 0xF7, 0x13, 0xF3, 0x12,
+0xF5, 0xEF, 0x0A, 0xF3, 0x0B, 0xF3, 0xF4, 0xF2, 0x0B, 0xF4, 0x0D, 0xF6, 0xF0, 0x0B, 0x0F, 0x0E,
+0xF3, 0x0C, 0xF4, 0xF0, 0xF2, 0x0E, 0xF3, 0xF0, 0x0B, 0x0B, 0x0D, 0x0E, 0xF5, 0x10, 0xF3, 0x0F,
+0xF4, 0xF7, 0x09, 0xF2, 0x0E, 0xF4, 0xF6, 0xF2, 0x0A, 0xF5, 0x10, 0xF7, 0xF1, 0x07, 0x0B, 0x0D,
+0xF2, 0x0E, 0xF1, 0xF4, 0xF3, 0x0C, 0xF3, 0xF5, 0x0C, 0x08, 0x0D, 0x0D, 0xF3, 0x0F, 0xF4, 0x12,
+0xF3, 0xF4, 0x0A, 0xF5, 0x11, 0xF4, 0xF3, 0xF4, 0x08, 0xF3, 0x0E, 0xF6, 0xEE, 0x0B, 0x0B, 0x06,
+0xF2, 0x0E, 0xF4, 0xF2, 0xF9, 0x0E, 0xF3, 0xEF, 0x06, 0x08, 0x09, 0x0B, 0xF6, 0x10, 0xF4, 0x09,
+0xF5, 0xF3, 0x0E, 0xF3, 0x0E, 0xF1, 0xF2, 0xF4, 0x0C, 0xF8, 0x0B, 0xF1, 0xF3, 0x07, 0x0C, 0x0D,
+0xF7, 0x0C, 0xF3, 0xF4, 0xF5, 0x13, 0xF4, 0xF0, 0x0B, 0x0E, 0x0E, 0x09, 0xF5, 0x0B, 0xEE, 0x12,
+0xF5, 0xF2, 0x0C, 0xF2, 0x0C, 0xF1, 0xF3, 0xF1, 0x0B, 0xF5, 0x0D, 0xF3, 0xF2, 0x0C, 0x0D, 0x0E,
+0xF3, 0x10, 0xF4, 0xF4, 0xF2, 0x0E, 0xF4, 0xF4, 0x0A, 0x0A, 0x10, 0x0D, 0xF4, 0x11, 0xF1, 0x12,
+0xF7, 0xF1, 0x13, 0xF4, 0x0D, 0xF5, 0xF1, 0xF3, 0x09, 0xFA, 0x11, 0xF7, 0xF5, 0x08, 0x09, 0x10,
+0xF6, 0x0E, 0xF1, 0xF5, 0xF6, 0x0E, 0xF1, 0xF1, 0x0C, 0x09, 0x0E, 0x0D, 0xF4, 0x07, 0xF6, 0x11,
+0xF3, 0xF3, 0x10, 0xF0, 0x09, 0xF3, 0xF2, 0xF5, 0x0C, 0xF7, 0x09, 0xF9, 0xF6, 0x08, 0x0C, 0x0B,
+0xF1, 0x12, 0xF5, 0xF0, 0xF2, 0x0B, 0xF5, 0xF0, 0x10, 0x08, 0x0A, 0x0F, 0xF4, 0x0D, 0xF7, 0x10,
+0xF5, 0xF2, 0x0D, 0xF1, 0x09, 0xF2, 0xF4, 0xF1, 0x0B, 0xF3, 0x0D, 0xF5, 0xF1, 0x0D, 0x0E, 0x11,
+0xF3, 0x0F, 0xF6, 0xF3, 0xF3, 0x0D, 0xF4, 0xF0, 0x0A, 0x04, 0x0E, 0x0E, 0xF4, 0x13, 0xF3, 0x12,
+0xF3, 0xF2, 0x0D, 0xF0, 0x09, 0xF3, 0xF4, 0xF0, 0x09, 0xF7, 0x0F, 0xF7, 0xF0, 0x08, 0x0C, 0x10,
+0xF3, 0x0E, 0xF2, 0xF6, 0xF1, 0x0F, 0xF4, 0xF0, 0x0B, 0x0B, 0x0A, 0x0C, 0xF7, 0x0A, 0xF1, 0x0F,
+0xF3, 0xFA, 0x11, 0xF0, 0x0D, 0xF6, 0xF5, 0xF4, 0x0C, 0xF7, 0x07, 0xF0, 0xF5, 0x06, 0x0E, 0x0E,
+0xF2, 0x0C, 0xF5, 0xED, 0xF2, 0x11, 0xEF, 0xF0, 0x09, 0x04, 0x07, 0x08, 0xED, 0x05, 0xF8, 0x0F,
+0xF2, 0xF4, 0x14, 0xF4, 0x10, 0xF0, 0xEB, 0xED, 0x08, 0xFE, 0x0E, 0xF3, 0xF3, 0x00, 0x0A, 0x08,
+0xF6, 0x0B, 0xF8, 0xF7, 0xED, 0x0E, 0xF1, 0xF2, 0x0C, 0xFF, 0x0C, 0x09, 0xF3, 0x06, 0xED, 0x13,
+0xF8, 0xF8, 0x0B, 0xF3, 0x06, 0xEF, 0xED, 0xEF, 0x0C, 0x00, 0x10, 0xF7, 0xEE, 0x03, 0x10, 0x0C,
+0xF6, 0x0C, 0xF4, 0xEE, 0xF2, 0x0B, 0xF6, 0xF6, 0x04, 0x01, 0x0A, 0x0E, 0xEF, 0x09, 0xF1, 0x0E,
+0xF6, 0xF6, 0x0B, 0xF8, 0x0E, 0xED, 0xF0, 0xF3, 0x0B, 0xFC, 0x11, 0xFE, 0xF3, 0x09, 0x0F, 0x08,
+0xF1, 0x0D, 0xEF, 0xF2, 0xEF, 0x0F, 0xF3, 0xF2, 0x0C, 0x05, 0x0B, 0x0F, 0xEE, 0x0A, 0xEF, 0x08,
+0xF4, 0xF5, 0x08, 0xF4, 0x0C, 0xF1, 0xF2, 0xF6, 0x0B, 0xF5, 0x0D, 0xF5, 0xF4, 0x0A, 0x09, 0x0D,
+0xF2, 0x0E, 0xF7, 0xF1, 0xF3, 0x0C, 0xF1, 0xF1, 0x09, 0x02, 0x0B, 0x0A, 0xF2, 0x0C, 0xF4, 0x13,
+0xF6, 0xF2, 0x0C, 0xEF, 0x0A, 0xF4, 0xF3, 0xF0, 0x09, 0xFA, 0x10, 0xF6, 0xF3, 0x05, 0x0E, 0x10,
+0xF5, 0x0A, 0xF5, 0xF2, 0xF4, 0x0F, 0xF4, 0xF3, 0x0A, 0x01, 0x0D, 0x0B, 0xF3, 0x0A, 0xEF, 0x11,
+0xF1, 0xEC, 0x13, 0xF6, 0x0A, 0xF8, 0xF5, 0xED, 0x08, 0xFE, 0x13, 0xF3, 0xF2, 0x06, 0x0C, 0x0F,
+0xF3, 0x0D, 0xF6, 0xEF, 0xEE, 0x0D, 0xF5, 0xED, 0x0C, 0x02, 0x0A, 0x09, 0xF3, 0x05, 0xF6, 0x0E,
+0xF4, 0xF1, 0x0A, 0xF5, 0x0C, 0xF4, 0xF5, 0xF5, 0x06, 0xFD, 0x10, 0xF0, 0xEC, 0x04, 0x11, 0x0F,
+0xF3, 0x0B, 0xF9, 0xF8, 0xF5, 0x0F, 0xF1, 0xF1, 0x08, 0x02, 0x0C, 0x07, 0xF7, 0x0C, 0xF5, 0x12,
+0xF1, 0xF2, 0x0D, 0xF2, 0x09, 0xF8, 0xEF, 0xF4, 0x0B, 0xF8, 0x0B, 0xF4, 0xEF, 0x0E, 0x07, 0x08,
+0xF8, 0x10, 0xF6, 0xF8, 0xEF, 0x12, 0xEF, 0xF3, 0x0B, 0x04, 0x0E, 0x0D, 0xFA, 0x09, 0xEE, 0x0D,
+0xFB, 0x03, 0x04, 0xFA, 0x02, 0x04, 0xFE, 0x01, 0xFE, 0xFF, 0xFB, 0x05, 0xFD, 0xFC, 0x06, 0xFA,
+0xFE, 0xFD, 0x03, 0xFD, 0x01, 0x06, 0x06, 0x02, 0x00, 0xFC, 0x01, 0x03, 0x06, 0xFF, 0x03, 0x04,
+0xFA, 0xFD, 0x05, 0xFC, 0x03, 0xFE, 0xFA, 0xFE, 0xFD, 0x00, 0xFE, 0x06, 0x02, 0x00, 0xFE, 0x06,
+0xFB, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0xFE, 0xFD, 0x05, 0x06, 0x05, 0xFA, 0xFC, 0x01, 0x01, 0x03,
+0x02, 0xFD, 0x02, 0x06, 0x04, 0x02, 0xFC, 0x00, 0x03, 0x06, 0xFA, 0xFD, 0x05, 0x00, 0x00, 0xFF,
+0xFE, 0x01, 0xFA, 0x06, 0xFB, 0x03, 0x03, 0xFF, 0x03, 0x06, 0xFD, 0x01, 0x05, 0xFB, 0x02, 0x04,
+0xFA, 0xFF, 0x02, 0xFC, 0xFF, 0xFB, 0x04, 0xFB, 0x01, 0x01, 0x05, 0x01, 0x04, 0x05, 0x03, 0xFE,
+0x05, 0x01, 0x03, 0xFA, 0xFA, 0x06, 0xFA, 0x03, 0xFB, 0x00, 0xFD, 0xFA, 0x01, 0x01, 0xFC, 0xFB,
+0xFC, 0x06, 0xFE, 0x03, 0xFE, 0x01, 0x05, 0x05, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x03, 0x00, 0x06,
+0xFA, 0xFD, 0x03, 0x04, 0xFB, 0x05, 0x03, 0xFA, 0x01, 0xFD, 0xFD, 0xFF, 0x04, 0x02, 0xFD, 0x05,
+0xFF, 0xFE, 0xFC, 0xFD, 0xFC, 0xFA, 0xFB, 0x01, 0xFF, 0xFB, 0x02, 0xFB, 0x00, 0xFA, 0x00, 0xFF,
+0x03, 0xFD, 0x03, 0xFD, 0xFE, 0xFC, 0xFA, 0x00, 0xFB, 0x05, 0x01, 0x04, 0xFF, 0x05, 0x01, 0x02,
+0x02, 0x01, 0xFB, 0xFC, 0x06, 0x02, 0xFA, 0x05, 0xFC, 0xFD, 0x02, 0x05, 0xFB, 0x05, 0x06, 0x05,
+0x04, 0x03, 0xFD, 0x00, 0x02, 0x04, 0x04, 0xFD, 0x02, 0xFA, 0xFD, 0x06, 0x02, 0x03, 0x04, 0xFE,
+0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0xFD, 0x02, 0x02, 0x06, 0x04, 0xFA, 0x00, 0x02, 0xFF, 0x03, 0x04,
+0x03, 0x01, 0x02, 0xFC, 0xFB, 0xFE, 0x01, 0xFB, 0x03, 0xFD, 0xFE, 0xFB, 0xFA, 0x04, 0xFD, 0x01,
+0x01, 0x01, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFE, 0x04, 0x01, 0xFE, 0x00, 0xFE,
+0x03, 0x00, 0x01, 0x02, 0x02, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFE, 0x01, 0x01,
+0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x04, 0xFF, 0x05, 0x00, 0xFD, 0x00, 0xFF,
+0x02, 0x00, 0x02, 0x01, 0x00, 0xFF, 0x01, 0x02, 0xFE, 0xFB, 0xFD, 0xFD, 0x01, 0x00, 0x01, 0x02,
+0x01, 0x03, 0xFF, 0x00, 0xFE, 0x02, 0x00, 0x02, 0xFE, 0x02, 0x00, 0x02, 0x01, 0xFD, 0xFE, 0xFF,
+0x01, 0xFE, 0x01, 0x02, 0x02, 0xFE, 0x01, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0x01, 0x00, 0x01, 0x00,
+0x02, 0x03, 0xFF, 0x00, 0xFD, 0x03, 0x05, 0x02, 0x01, 0xFE, 0xFE, 0x01, 0x02, 0xFE, 0xFE, 0xFF,
+0xFF, 0xFB, 0x00, 0x04, 0xFF, 0x01, 0x02, 0x01, 0xFE, 0xFD, 0xFC, 0x02, 0xFF, 0x01, 0x00, 0xFE,
+0x03, 0x00, 0xFD, 0x04, 0xFE, 0x00, 0x01, 0x02, 0xFB, 0x05, 0x01, 0x04, 0xFF, 0xFD, 0x00, 0x00,
+0xFF, 0x02, 0x04, 0xFF, 0x02, 0x01, 0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+0x01, 0x03, 0x00, 0x01, 0xFE, 0x02, 0x01, 0xFF, 0xFD, 0x02, 0xFF, 0x01, 0x01, 0xFD, 0xFF, 0xFF,
+0x01, 0xFE, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0xFD, 0xFE, 0xFF, 0xFF, 0x01, 0x00, 0x01, 0x00,
+0x01, 0x00, 0xFF, 0x01, 0xFE, 0x01, 0x01, 0x03, 0xFD, 0x03, 0xFF, 0x02, 0x01, 0xFE, 0xFD, 0xFF,
+0x01, 0x00, 0x02, 0x02, 0x01, 0xFF, 0x02, 0x02, 0xFE, 0xFD, 0xFF, 0xFE, 0x03, 0x00, 0x00, 0xFE,
+0x02, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x04, 0x00, 0xFF, 0x02, 0xFD, 0x01, 0x00, 0x00, 0xFE, 0x00,
+0x02, 0x00, 0x01, 0x00, 0x02, 0xFE, 0x01, 0x03, 0xFD, 0xFF, 0xFD, 0xFF, 0x01, 0xFF, 0x00, 0x00,
+0x02, 0x01, 0xFE, 0x01, 0xFE, 0x02, 0x00, 0x00, 0xFE, 0x03, 0xFD, 0x03, 0x02, 0xFE, 0xFF, 0xFF,
+0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x03, 0xFE, 0xFD, 0xFE, 0xFF, 0x01, 0x00, 0x01, 0x00,
+0x01, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0x02, 0x02, 0xFE, 0x03, 0xFF, 0x03, 0x01, 0xFF, 0xFE, 0x00,
+0x03, 0x01, 0x03, 0x01, 0x01, 0x00, 0x03, 0x00, 0xFD, 0xFC, 0xFE, 0xFE, 0x01, 0x01, 0x02, 0x01,
+0x02, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0xFF, 0xFD,
+0x02, 0x00, 0x03, 0x02, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0xFC, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x02, 0xFE, 0x01, 0x01, 0xFF, 0xFC, 0x02, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0xFE,
+0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0x04, 0x00, 0x01, 0xFF,
+0x01, 0x01, 0x02, 0x01, 0xFD, 0x02, 0x01, 0x01, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0xFA, 0xFE, 0xFE,
+0x00, 0xFE, 0x02, 0x02, 0xFF, 0x00, 0x00, 0x02, 0x00, 0xFB, 0xFF, 0x00, 0x02, 0x01, 0x02, 0xFE,
+0x00, 0x01, 0x00, 0x02, 0xFE, 0x01, 0x00, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0x02, 0xFE, 0xFE, 0x00,
+0x02, 0xFE, 0x01, 0x03, 0x02, 0x00, 0x03, 0x03, 0xFC, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFE,
+0x02, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0xFD, 0xFF, 0xFE,
+0x02, 0xFE, 0x02, 0x02, 0x02, 0xFE, 0x01, 0x03, 0xFD, 0xFD, 0xFE, 0x00, 0x03, 0x01, 0x00, 0xFE,
+0x02, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFE, 0x04, 0xFE, 0x01, 0x02, 0xFD, 0xFE, 0xFF,
+0x02, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x01, 0x02, 0xFD, 0xFE, 0xFF, 0x00, 0x03, 0x00, 0x01, 0x01,
+0x01, 0x01, 0x00, 0x02, 0xFE, 0x01, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0x03, 0x02, 0xFD, 0xFE, 0xFE,
+0x02, 0xFF, 0x02, 0x02, 0x02, 0xFD, 0x01, 0x03, 0xFE, 0xFC, 0xFF, 0x00, 0x03, 0xFF, 0x02, 0x00,
+0x01, 0x01, 0xFF, 0x00, 0xFE, 0x01, 0x00, 0x01, 0xFE, 0x03, 0xFF, 0x05, 0x01, 0xFF, 0xFF, 0xFF,
+0x03, 0x00, 0x01, 0x01, 0x01, 0xFE, 0x02, 0x00, 0xFB, 0xF7, 0xFE, 0xFF, 0x03, 0x00, 0x02, 0x03,
+0x01, 0x01, 0xFE, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFE, 0x02, 0x00, 0x02, 0x01, 0xFC, 0xFE, 0xFE,
+0x02, 0xFE, 0x02, 0x02, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFD, 0xFF, 0xFE, 0x02, 0x00, 0x01, 0xFC,
+0x02, 0x03, 0xFF, 0x02, 0xFE, 0x01, 0x02, 0x01, 0xFE, 0x02, 0xFF, 0x03, 0x03, 0xFE, 0xFF, 0xFF,
+0x01, 0xFD, 0x01, 0x03, 0x03, 0xFF, 0x01, 0x00, 0xFC, 0xFD, 0xFE, 0xFF, 0x02, 0xFF, 0x02, 0x01,
+0x02, 0x03, 0x00, 0x01, 0xFD, 0x01, 0x03, 0x01, 0xFD, 0x03, 0xFE, 0x01, 0x02, 0xFC, 0xFE, 0xFF,
+0x01, 0xFE, 0x02, 0x01, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0xFE, 0xFE, 0xFE, 0x01, 0xFF, 0x01, 0x00,
+0x02, 0x02, 0xFF, 0x02, 0xFF, 0x01, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0x01, 0x01, 0xFD, 0xFF, 0xFF,
+0x03, 0xFE, 0x01, 0x02, 0x01, 0x00, 0x02, 0x02, 0xFD, 0xFB, 0xFD, 0xFF, 0x01, 0x00, 0x01, 0x00,
+0x01, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0x01, 0xFD, 0x01, 0xFF, 0x01, 0x03, 0xFD, 0xFE, 0xFF,
+0x01, 0xFF, 0x00, 0x01, 0x01, 0xFB, 0x00, 0x02, 0xFD, 0xFB, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xFE,
+0x03, 0x00, 0xFF, 0x02, 0xFE, 0x01, 0x01, 0x00, 0xFF, 0x02, 0xFE, 0x02, 0x01, 0xFC, 0xFE, 0xFF,
+0x02, 0xFF, 0x01, 0x02, 0x01, 0xFD, 0x01, 0x02, 0xFD, 0xFC, 0xFE, 0xFF, 0x02, 0x00, 0x02, 0x00,
+0x03, 0x01, 0xFE, 0x01, 0xFE, 0x02, 0x03, 0x01, 0xFF, 0x02, 0xFE, 0x01, 0x00, 0xFC, 0xFD, 0xFE,
+0x01, 0xFF, 0x01, 0x01, 0x01, 0x00, 0x03, 0x04, 0xFE, 0xF9, 0xFD, 0xFF, 0x01, 0xFE, 0x03, 0x01,
+0x02, 0x01, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x04, 0xFE, 0x04, 0x03, 0xFB, 0x00, 0xFE,
+0x03, 0x00, 0x02, 0x00, 0x01, 0xFF, 0x03, 0x02, 0xFE, 0xFA, 0xFE, 0xFF, 0x01, 0xFF, 0x03, 0x02,
+0x00, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0x01, 0x02, 0xFD, 0x01, 0x00, 0x02, 0x01, 0xFC, 0xFD, 0xFD,
+0x03, 0xFF, 0x01, 0x02, 0x03, 0xFD, 0x00, 0x01, 0xFE, 0xFA, 0xFC, 0x00, 0x01, 0xFF, 0x02, 0x00,
+0x03, 0x03, 0xFD, 0x04, 0xFF, 0x02, 0x03, 0x02, 0xFE, 0xFF, 0xFE, 0x03, 0x04, 0xFD, 0xFE, 0x00,
+0x02, 0xFD, 0x01, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0xFF, 0xFE, 0xFE, 0x03, 0x00, 0x02, 0xFE,
+0x02, 0x04, 0x00, 0x02, 0xFF, 0x01, 0x03, 0x02, 0xFC, 0x02, 0xFF, 0x01, 0x03, 0xFC, 0xFF, 0xFE,
+0x02, 0xFF, 0x01, 0x04, 0x01, 0x00, 0x03, 0x01, 0xFD, 0xFD, 0xFE, 0xFF, 0x03, 0x00, 0x03, 0xFC,
+0x01, 0x02, 0xFF, 0x01, 0xFD, 0x01, 0x00, 0x01, 0xFE, 0x01, 0xFC, 0x02, 0x03, 0xFB, 0x00, 0x00,
+0x02, 0xFF, 0x01, 0x00, 0x02, 0xFE, 0x01, 0x03, 0xFD, 0xFB, 0xFE, 0xFD, 0x03, 0x00, 0x01, 0xFE,
+0x03, 0x00, 0xFE, 0x03, 0xFE, 0x00, 0x01, 0x02, 0xFD, 0x02, 0x01, 0x02, 0x00, 0xFD, 0xFF, 0x01,
+0x01, 0x00, 0x01, 0x01, 0x02, 0xFD, 0x04, 0x03, 0xFD, 0xF8, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x01,
+0x04, 0xFF, 0xFF, 0x00, 0xFE, 0x02, 0x03, 0x00, 0xFF, 0x03, 0xFD, 0x03, 0x01, 0x00, 0xFE, 0x00,
+0x01, 0xFF, 0x02, 0x02, 0x01, 0xFE, 0x02, 0x02, 0xFC, 0xF9, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFC,
+0x01, 0x01, 0x01, 0x02, 0xFF, 0x02, 0x03, 0x03, 0xFF, 0x02, 0xFE, 0x02, 0x01, 0xFC, 0xFB, 0xFF,
+0x02, 0xFD, 0x02, 0x01, 0x03, 0xFE, 0x02, 0x03, 0xFE, 0xF0, 0xFF, 0xFD, 0x01, 0xFD, 0x01, 0x00,
+0xFF, 0x06, 0xF7, 0x02, 0x01, 0x03, 0x02, 0x00, 0xFD, 0x02, 0x01, 0x02, 0x02, 0x00, 0xFF, 0xFD,
+0x02, 0xFE, 0xFF, 0x00, 0x03, 0xFE, 0x04, 0x05, 0xFD, 0xF7, 0xFC, 0xFB, 0x01, 0xFD, 0x03, 0xFF,
+0x01, 0x02, 0xFE, 0x06, 0xFF, 0x03, 0x02, 0x06, 0x00, 0x02, 0x01, 0x03, 0x02, 0x00, 0xFF, 0x00,
+0x01, 0xFF, 0x01, 0x05, 0x01, 0xFD, 0x03, 0x03, 0xFE, 0xF9, 0xFD, 0xFE, 0x01, 0xFE, 0x06, 0xFE,
+0x03, 0xFF, 0xFA, 0x04, 0xFF, 0x05, 0xFD, 0xFF, 0xFE, 0x04, 0xFF, 0xFF, 0x02, 0xFB, 0xFC, 0xFF,
+0x00, 0xFE, 0x02, 0x00, 0x04, 0x00, 0x03, 0x02, 0xF8, 0xF8, 0xFF, 0xFE, 0x02, 0xFE, 0x04, 0x02,
+0x04, 0x03, 0x02, 0x01, 0xFF, 0x00, 0x03, 0x00, 0xFB, 0x06, 0x01, 0x01, 0x02, 0xFE, 0xFE, 0xFF,
+0x03, 0x00, 0x05, 0x03, 0x02, 0xFA, 0xFF, 0x04, 0xFF, 0xF8, 0xFB, 0xFD, 0x01, 0xFE, 0x01, 0xFF,
+0xFE, 0x02, 0xFE, 0x03, 0xFE, 0x03, 0x04, 0x02, 0xFE, 0x03, 0xFD, 0x02, 0x05, 0x00, 0x02, 0xFB,
+0x01, 0xFC, 0x02, 0x04, 0x01, 0xFE, 0x02, 0x04, 0xFD, 0xF9, 0xFE, 0xFB, 0x01, 0xFD, 0xFF, 0x00,
+0x05, 0x01, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0xFE, 0xFE, 0x02, 0xFB, 0x00, 0x02, 0xFE, 0xFE, 0xFB,
+0x00, 0xFC, 0x01, 0x03, 0xFF, 0xFE, 0x04, 0x07, 0x02, 0xF9, 0xFF, 0xFF, 0x02, 0xFD, 0x05, 0xFB,
+0x03, 0x03, 0x00, 0x01, 0xFE, 0x01, 0x01, 0x04, 0xFD, 0xFF, 0xFC, 0x05, 0xFF, 0xFD, 0xFF, 0x00,
+0x02, 0xFE, 0x02, 0x04, 0x00, 0xFF, 0x03, 0x01, 0xFD, 0xF5, 0xFD, 0xFD, 0x04, 0xFE, 0x01, 0xFE,
+0x02, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0x03, 0xFF, 0xFE, 0x02, 0xFC, 0x04, 0xFF, 0xFE, 0x00, 0x00,
+0x02, 0xFC, 0x02, 0x00, 0x02, 0xFD, 0x00, 0x06, 0x00, 0xFB, 0xFD, 0xFC, 0x01, 0xFB, 0x04, 0xFE,
+0x02, 0x02, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x04, 0x02, 0xFD, 0xFF, 0xFD,
+0x04, 0xFD, 0x00, 0x02, 0x02, 0xF9, 0x02, 0x06, 0xFE, 0xF9, 0x00, 0xFC, 0x01, 0xFD, 0x03, 0xFD,
+0x01, 0x07, 0x00, 0x03, 0xFA, 0x00, 0x04, 0x04, 0xFF, 0x08, 0xFD, 0x03, 0x02, 0xFF, 0x00, 0xFC,
+0x02, 0xFF, 0x04, 0x02, 0x01, 0xFF, 0x02, 0x01, 0xF9, 0xF8, 0xFC, 0xFF, 0xFF, 0xFD, 0x01, 0x00,
+0x00, 0x08, 0x00, 0x02, 0x03, 0x01, 0x06, 0xFF, 0xFE, 0xFB, 0xF8, 0x01, 0x03, 0xFC, 0x00, 0x00,
+0x01, 0xF9, 0x04, 0xFC, 0x05, 0xFD, 0x07, 0x07, 0xFD, 0xFC, 0xFD, 0xFE, 0x06, 0xFC, 0x05, 0x02,
+0x05, 0xFF, 0xFE, 0x05, 0x00, 0x00, 0x02, 0x03, 0xF8, 0x06, 0xFD, 0x00, 0x05, 0x01, 0xFE, 0xFD,
+0x06, 0x01, 0x06, 0x03, 0x00, 0x00, 0x01, 0x08, 0xF6, 0xFE, 0xFF, 0x00, 0xFC, 0xFA, 0xFD, 0xFC,
+0x01, 0x09, 0xFD, 0x01, 0xF9, 0x03, 0x03, 0x02, 0x02, 0x01, 0xF9, 0x05, 0x00, 0x05, 0x00, 0x00,
+0x04, 0xFC, 0x01, 0x03, 0x00, 0xF8, 0x09, 0x06, 0x01, 0xFE, 0xFD, 0xFA, 0x01, 0xFF, 0x08, 0xFF,
+0x03, 0x02, 0xF9, 0x03, 0xFD, 0x02, 0xFF, 0x02, 0xFA, 0x02, 0xF9, 0x00, 0x01, 0x01, 0xF6, 0xFB,
+0xFF, 0xFF, 0x04, 0x05, 0x02, 0xF9, 0x00, 0x02, 0xFF, 0xFD, 0x01, 0x02, 0xFF, 0xFC, 0x03, 0x00,
+0x02, 0x00, 0xFC, 0x02, 0xFE, 0x03, 0x05, 0x02, 0xFD, 0x04, 0xFE, 0x01, 0x01, 0xFE, 0xFF, 0xFD,
+0xFE, 0x00, 0x02, 0x00, 0x00, 0xF9, 0x02, 0x02, 0xFC, 0xF9, 0xFE, 0xFB, 0xFF, 0xFC, 0x00, 0xFF,
+0x03, 0xFC, 0xFD, 0x04, 0xFC, 0x03, 0xFD, 0x01, 0x06, 0x03, 0xFB, 0xFA, 0xFE, 0xFE, 0xFE, 0x00,
+0xFE, 0x05, 0x01, 0x03, 0x04, 0x02, 0x01, 0x05, 0x02, 0x05, 0xFB, 0xFF, 0xFE, 0x06, 0x00, 0xFD,
+0x03, 0x00, 0x01, 0xFF, 0x05, 0xFA, 0x00, 0xFA, 0x04, 0x05, 0x02, 0x00, 0x06, 0x02, 0xFF, 0xFF,
+0x05, 0xFB, 0x01, 0x03, 0x05, 0xFE, 0xFC, 0x03, 0x01, 0x01, 0x05, 0x05, 0x00, 0x00, 0x00, 0xFB,
+0xFD, 0x04, 0xFD, 0x05, 0xFE, 0x03, 0x00, 0xFD, 0x03, 0xFB, 0x00, 0x00, 0xFA, 0xFF, 0x03, 0xFD,
+0x01, 0x02, 0x01, 0x04, 0xFE, 0xFE, 0x00, 0x04, 0x03, 0x04, 0x05, 0x01, 0xFA, 0xFC, 0xFF, 0x00,
+0x03, 0x01, 0xFE, 0xFA, 0x03, 0xFB, 0x01, 0xFB, 0xFD, 0x03, 0xFA, 0x02, 0xFD, 0x01, 0x03, 0xFF,
+0xFF, 0x05, 0xFD, 0x00, 0x05, 0xFE, 0x00, 0x02, 0x02, 0xFA, 0xFB, 0xFC, 0xFA, 0x01, 0xFC, 0xFA,
+0xFA, 0x00, 0xFE, 0x02, 0xFB, 0x01, 0x00, 0xFB, 0x04, 0xFC, 0xFF, 0x02, 0x03, 0x00, 0x05, 0x00,
+0xFE, 0xFE, 0xFA, 0x04, 0x04, 0x04, 0xFA, 0x05, 0xFE, 0x00, 0xFF, 0x06, 0x02, 0xFF, 0x06, 0x00,
+0x05, 0xFE, 0x04, 0x04, 0x06, 0xFB, 0x04, 0xFD, 0xFB, 0x03, 0xFF, 0x02, 0xFF, 0xFF, 0xFD, 0x05,
+0xFA, 0x06, 0xFF, 0xFC, 0x02, 0xFC, 0xFC, 0xFE, 0xFC, 0xFF, 0x01, 0xFD, 0x03, 0xFA, 0x01, 0xFD,
+0x00, 0xFD, 0x02, 0x06, 0xFB, 0x02, 0xFC, 0xFD, 0x01, 0xFA, 0xFE, 0x02, 0x02, 0x03, 0xFA, 0xFD,
+0x04, 0x05, 0xFE, 0x03, 0x01, 0x04, 0x06, 0x04, 0x00, 0xFD, 0x02, 0x05, 0xFD, 0x05, 0xFA, 0xFC,
+0xFD, 0x04, 0x06, 0x01, 0xFA, 0x02, 0x02, 0xFE, 0x05, 0xFD, 0xFC, 0x02, 0x02, 0x03, 0xFB, 0xFA,
+0x03, 0x05, 0x01, 0xFB, 0xFE, 0xFC, 0x04, 0xFB, 0x02, 0x00, 0x01, 0x03, 0x05, 0xFB, 0xFF, 0xFC,
+0x01, 0x02, 0xF5, 0x00, 0xFC, 0x00, 0x06, 0x0A, 0xFD, 0x04, 0xFB, 0x02, 0x07, 0xFF, 0xFB, 0xFF,
+0x04, 0xFC, 0x08, 0x02, 0x08, 0xF9, 0x08, 0x0A, 0x00, 0x04, 0xFC, 0xFE, 0x05, 0xFF, 0x0B, 0xFF,
+0x05, 0x09, 0xFA, 0x05, 0xFD, 0x06, 0x04, 0x08, 0xFE, 0x01, 0xFD, 0x07, 0x04, 0x01, 0xFD, 0xFA,
+0x03, 0xFD, 0x01, 0x04, 0x02, 0xF9, 0x03, 0x0D, 0x03, 0x04, 0xF8, 0xFE, 0x08, 0xFD, 0x0C, 0xF9,
+0x03, 0x07, 0xFA, 0x05, 0xFC, 0x03, 0x03, 0x06, 0xFC, 0x04, 0xFC, 0x03, 0x05, 0xFC, 0xFB, 0xFD,
+0x05, 0xFE, 0x05, 0x03, 0x07, 0xF9, 0x04, 0x05, 0xFA, 0x00, 0xFD, 0xFC, 0x05, 0xFC, 0x04, 0xFC,
+0xFF, 0x01, 0xFA, 0x06, 0xFB, 0x03, 0xFF, 0x05, 0xF9, 0x03, 0xFA, 0x01, 0x01, 0x00, 0xFF, 0xF6,
+0x03, 0xF8, 0x03, 0x02, 0x02, 0xFC, 0x02, 0x09, 0xFC, 0xFD, 0xF4, 0xF8, 0x07, 0xFF, 0x02, 0xF9,
+0x02, 0x0A, 0xFE, 0x0A, 0xFA, 0x03, 0x03, 0x04, 0x03, 0x03, 0xFF, 0xFC, 0x03, 0x02, 0xFA, 0x00,
+0x06, 0x01, 0x06, 0x0B, 0x03, 0xFD, 0x03, 0x05, 0xFA, 0xF9, 0xFA, 0xFD, 0x05, 0xFA, 0x04, 0xF7,
+0x05, 0x05, 0xFA, 0x01, 0xFD, 0x05, 0x07, 0x01, 0xFE, 0x02, 0xFA, 0x06, 0x04, 0xF8, 0xFC, 0xFD,
+0x05, 0xF9, 0x04, 0x06, 0x06, 0xFC, 0x03, 0x06, 0xFE, 0xFC, 0xFB, 0xFB, 0x05, 0xFE, 0x04, 0xFC,
+0x01, 0x04, 0xF8, 0x07, 0xFC, 0x05, 0x04, 0x03, 0xF8, 0x06, 0xFA, 0x05, 0x04, 0xF9, 0xFF, 0xFC,
+0x07, 0xFC, 0x02, 0x01, 0x04, 0xFA, 0x07, 0x06, 0xFE, 0x04, 0xFF, 0xFA, 0x09, 0xFE, 0x03, 0xFC,
+0x02, 0x00, 0xFC, 0x07, 0xFD, 0x00, 0x07, 0x03, 0xFA, 0x05, 0xFE, 0xFF, 0x04, 0x00, 0xF5, 0xFF,
+0x02, 0xF6, 0x07, 0x06, 0x09, 0xF9, 0x0A, 0x02, 0x00, 0xF7, 0xFC, 0xFC, 0x01, 0xFE, 0x05, 0xFE,
+0x03, 0x06, 0xF8, 0x06, 0xFB, 0x06, 0x07, 0x0A, 0x02, 0x05, 0xF7, 0x03, 0x04, 0xFB, 0xFE, 0xFA,
+0xFE, 0xFA, 0xFE, 0x06, 0x06, 0xFA, 0x07, 0x01, 0xFA, 0x05, 0xF8, 0xFB, 0x00, 0x02, 0xFF, 0xF8,
+0x03, 0x02, 0xFB, 0x04, 0xFC, 0x05, 0x06, 0x04, 0xFD, 0x05, 0xFC, 0x06, 0x05, 0xFC, 0xFC, 0xFD,
+0x04, 0xFA, 0x05, 0x03, 0x05, 0xFD, 0x02, 0x04, 0xFD, 0xF9, 0xFB, 0xFC, 0x06, 0xFE, 0x06, 0xFB,
+0x02, 0x00, 0xF9, 0x01, 0xFB, 0x04, 0x03, 0x04, 0xFA, 0x04, 0xFD, 0x08, 0x03, 0x00, 0xFB, 0xFF,
+0x07, 0xFB, 0x04, 0x09, 0x01, 0xF9, 0x04, 0x06, 0xFA, 0x03, 0xFA, 0xF8, 0x06, 0xFD, 0x08, 0xF9,
+0x06, 0x06, 0xFC, 0x04, 0xFA, 0x03, 0x05, 0x03, 0xFC, 0x02, 0xFC, 0x05, 0x04, 0xFA, 0xFB, 0xFF,
+0x03, 0xFA, 0x07, 0x02, 0x08, 0xFC, 0x05, 0x06, 0xFE, 0xFB, 0xFC, 0xFE, 0x05, 0xFE, 0x02, 0xFD,
+0x06, 0x03, 0xFA, 0x01, 0xFA, 0x06, 0x01, 0x01, 0xFC, 0x04, 0xFD, 0x06, 0x04, 0xFC, 0xFD, 0xFB,
+0x05, 0xFB, 0x05, 0x05, 0x05, 0xFA, 0x02, 0x04, 0xFA, 0xF9, 0xFB, 0xFE, 0x08, 0xFE, 0x02, 0xFD,
+0x03, 0x04, 0xFC, 0x04, 0xFB, 0x05, 0x09, 0x08, 0xFE, 0x03, 0xFA, 0x07, 0x09, 0xF9, 0xF5, 0xFB,
+0xFF, 0xFA, 0xFF, 0x03, 0x06, 0xFE, 0x01, 0x03, 0xF9, 0xFE, 0xFB, 0xFA, 0x06, 0xFF, 0x02, 0x00,
+0x05, 0x04, 0xFB, 0x02, 0xFB, 0x04, 0x05, 0x03, 0xFE, 0x06, 0xFA, 0x08, 0x05, 0xFE, 0xFD, 0xFD,
+0x05, 0xFC, 0x03, 0x03, 0x05, 0xF9, 0x05, 0x04, 0xFE, 0xFD, 0xFC, 0xFD, 0x07, 0xFD, 0x03, 0xFA,
+0x04, 0x02, 0xFE, 0x02, 0xFD, 0x07, 0x0B, 0x08, 0xFF, 0x07, 0xFA, 0x07, 0x02, 0xFF, 0xFA, 0x00,
+0x02, 0xFE, 0x04, 0x06, 0x07, 0xFB, 0x03, 0x0A, 0x00, 0x00, 0xFB, 0xFF, 0x07, 0x01, 0x07, 0xFA,
+0xFD, 0x03, 0xF6, 0x06, 0xFC, 0x04, 0x04, 0x02, 0x00, 0x03, 0xF7, 0xFC, 0x02, 0xFE, 0xF5, 0xFC,
+0x00, 0xF6, 0x04, 0x02, 0x05, 0xF9, 0x05, 0x04, 0xF7, 0x05, 0xF6, 0xF9, 0x04, 0x01, 0x03, 0xFC,
+0x04, 0x06, 0xFA, 0x02, 0xFD, 0x04, 0x06, 0x01, 0xFB, 0x06, 0xFD, 0x04, 0x06, 0xFB, 0xF9, 0xFD,
+0x05, 0xFD, 0x05, 0x05, 0x04, 0xFD, 0x00, 0x04, 0xF6, 0x00, 0xFC, 0xFD, 0x07, 0xFE, 0x04, 0x00,
+0x03, 0x05, 0xFA, 0x04, 0xF9, 0x04, 0x03, 0x04, 0xFB, 0x03, 0xFB, 0x05, 0x05, 0xFB, 0xFB, 0xFD,
+0x05, 0xFA, 0x06, 0x04, 0x03, 0xFC, 0x03, 0x05, 0xF9, 0xFC, 0xFC, 0xFB, 0x07, 0xFE, 0x03, 0xFE,
+0x06, 0x05, 0xFA, 0x04, 0xFD, 0x06, 0x05, 0x06, 0xFC, 0x02, 0xFD, 0x05, 0x05, 0xFC, 0xFD, 0xFC,
+0x03, 0xFA, 0x03, 0x05, 0x05, 0xF9, 0x03, 0x04, 0xFD, 0xFD, 0xFC, 0xFB, 0x05, 0xFE, 0x06, 0xFE,
+0x05, 0x05, 0xFB, 0x04, 0xFB, 0x05, 0x02, 0x04, 0xFB, 0x05, 0xFC, 0x05, 0x03, 0xFD, 0xFD, 0xFB,
+0x06, 0xFB, 0x05, 0x03, 0x04, 0xFB, 0x05, 0x05, 0xFB, 0xFA, 0xFA, 0xFC, 0x05, 0xFD, 0x05, 0xFD,
+0x06, 0x02, 0xFF, 0x03, 0xFB, 0x04, 0x04, 0x03, 0xFA, 0x06, 0x01, 0x06, 0x04, 0xF9, 0xFC, 0xFB,
+0x07, 0xFC, 0x05, 0x06, 0x03, 0xFB, 0x04, 0x03, 0xFB, 0xF0, 0xFA, 0xFD, 0x06, 0xFE, 0x03, 0x02,
+0x03, 0x06, 0xFD, 0x04, 0xFD, 0x04, 0x07, 0x03, 0xFC, 0x02, 0xFC, 0x06, 0x04, 0xFC, 0xFC, 0xFE,
+0x05, 0xFD, 0x04, 0x03, 0x04, 0xFC, 0x02, 0x03, 0xFA, 0xF5, 0xFE, 0xFC, 0x04, 0xFD, 0x03, 0xFF,
+0x03, 0x07, 0xF6, 0x06, 0xFF, 0x07, 0x06, 0x03, 0xFD, 0xFE, 0xFD, 0xFF, 0x02, 0xFD, 0xFA, 0xFD,
+0x01, 0xF9, 0x09, 0x05, 0x04, 0xFA, 0x0A, 0x09, 0x04, 0x02, 0xFE, 0xFA, 0x04, 0xFC, 0x05, 0xFF,
+0x07, 0x02, 0xFA, 0x08, 0xFE, 0x04, 0x06, 0x0B, 0x00, 0x01, 0xF8, 0x06, 0x05, 0xFD, 0x00, 0x00,
+0x06, 0xF5, 0x06, 0x00, 0x02, 0xF8, 0x04, 0x0B, 0x02, 0x06, 0xF7, 0xF6, 0x00, 0xFE, 0x05, 0xFD,
+0x03, 0x01, 0xFC, 0x0A, 0xFB, 0x05, 0x04, 0x02, 0xFB, 0x01, 0xF3, 0x00, 0x03, 0xFF, 0xF9, 0xF9,
+0x04, 0xF9, 0x02, 0x07, 0x02, 0xF8, 0x04, 0x0A, 0xFE, 0xFD, 0xFC, 0xFE, 0x03, 0xFB, 0x03, 0xFD,
+0x05, 0x06, 0xFA, 0x03, 0xFD, 0x04, 0x07, 0x05, 0xFC, 0x04, 0xFE, 0x04, 0x04, 0xFE, 0xFD, 0xFB,
+0x04, 0xFA, 0x06, 0x06, 0x07, 0xF8, 0x06, 0x04, 0xFB, 0x02, 0xFB, 0xFC, 0x04, 0xFD, 0x07, 0xFD,
+0x02, 0x03, 0xFC, 0x06, 0xFC, 0x04, 0x04, 0x03, 0xFC, 0x04, 0xFE, 0x05, 0x05, 0xFD, 0xFC, 0xFA,
+0x05, 0xFD, 0x04, 0x05, 0x06, 0xF9, 0x06, 0x03, 0xFB, 0xF4, 0xFC, 0xFD, 0x07, 0xFD, 0x03, 0xFE,
+0x03, 0x04, 0xFD, 0x03, 0xFC, 0x05, 0x04, 0x01, 0xFA, 0x06, 0xFE, 0x06, 0x04, 0xFB, 0xFA, 0xFE,
+0x05, 0xFD, 0x05, 0x06, 0x05, 0xFD, 0x05, 0x02, 0xF9, 0xF2, 0xFB, 0xFF, 0x06, 0xFE, 0x03, 0x00,
+0x03, 0x05, 0xFD, 0x06, 0xFD, 0x04, 0x05, 0x06, 0xFD, 0x04, 0xFA, 0x03, 0x04, 0xFD, 0xFA, 0xFC,
+0x04, 0xFB, 0x05, 0x04, 0x05, 0xFC, 0x05, 0x07, 0xFC, 0xF8, 0xFC, 0xFB, 0x06, 0xFE, 0x05, 0xFE,
+0x05, 0x09, 0xFC, 0x03, 0xFE, 0x04, 0x03, 0x08, 0xFE, 0x02, 0xF6, 0x03, 0x04, 0xFD, 0xFD, 0xF9,
+0x03, 0xFA, 0x03, 0x04, 0x07, 0xF3, 0x03, 0x06, 0xFE, 0x00, 0xFB, 0xFE, 0x05, 0x00, 0x00, 0xF8,
+0x06, 0x03, 0xFA, 0x08, 0xFE, 0x03, 0x06, 0x05, 0xFC, 0x02, 0xFB, 0x02, 0x06, 0xFC, 0xFC, 0xFC,
+0x04, 0xFD, 0x03, 0x03, 0x05, 0xF6, 0x05, 0x08, 0xFF, 0x01, 0xFD, 0xF9, 0x00, 0x00, 0x09, 0xFA,
+0x03, 0x04, 0xFC, 0x02, 0xFF, 0x08, 0x0B, 0x0B, 0x02, 0x02, 0xF8, 0xFF, 0x02, 0xFE, 0xFF, 0xF9,
+0x03, 0xFA, 0x04, 0x06, 0x07, 0xF8, 0x04, 0x08, 0xFD, 0x00, 0xFD, 0xFE, 0x07, 0xFF, 0x06, 0xFD,
+0x03, 0x06, 0xFB, 0x06, 0xFD, 0x05, 0x04, 0x04, 0xFA, 0x04, 0xFC, 0x04, 0x04, 0xF9, 0xFC, 0xFA,
+0x04, 0xFC, 0x04, 0x05, 0x04, 0xFE, 0x05, 0x01, 0xFD, 0xF8, 0xFC, 0xFD, 0x08, 0xFD, 0x04, 0xFD,
+0x04, 0x00, 0xFE, 0x02, 0xFA, 0x04, 0x09, 0x09, 0xFB, 0x01, 0xF7, 0x05, 0x02, 0xFE, 0xFD, 0xF9,
+0x02, 0xF8, 0x03, 0x03, 0x04, 0xFC, 0x03, 0x04, 0xFE, 0xFE, 0xF8, 0xFF, 0x06, 0xFE, 0x02, 0xF6,
+0x05, 0x05, 0xFD, 0x04, 0xFD, 0x04, 0x04, 0x03, 0xFD, 0x02, 0xFA, 0x07, 0x04, 0xFE, 0xFD, 0xFC,
+0x05, 0xF9, 0x05, 0x04, 0x05, 0xFA, 0x04, 0x05, 0xFC, 0xFB, 0xFC, 0xFA, 0x06, 0xFF, 0x04, 0xFD,
+0x02, 0x05, 0xFB, 0x06, 0xFD, 0x05, 0x03, 0x04, 0xFF, 0x03, 0xFC, 0x06, 0x04, 0xFA, 0xFC, 0xFC,
+0x04, 0xFD, 0x04, 0x04, 0x05, 0xFB, 0x05, 0x07, 0xFD, 0xFA, 0xFA, 0xFB, 0x04, 0xFE, 0x04, 0xFE,
+0x02, 0x05, 0xFB, 0x04, 0xFA, 0x06, 0x05, 0x06, 0xFE, 0x02, 0xFC, 0x06, 0x05, 0xFE, 0xFE, 0xFE,
+0x04, 0xFA, 0x08, 0x06, 0x02, 0xFC, 0x03, 0x05, 0xFD, 0xFB, 0xFC, 0xFB, 0x07, 0xFE, 0x03, 0x00,
+0x03, 0x06, 0xFA, 0x06, 0xFE, 0x04, 0x06, 0x06, 0xFC, 0x00, 0xF9, 0x04, 0x05, 0x00, 0xFA, 0xFC,
+0x05, 0xFB, 0x05, 0x07, 0x04, 0xFD, 0x03, 0x03, 0xFE, 0xF9, 0xFB, 0xFE, 0x08, 0xFD, 0x04, 0xFB,
+0x03, 0x05, 0xF9, 0x06, 0x02, 0x06, 0x05, 0x03, 0xFE, 0x03, 0xFA, 0x04, 0x0A, 0x02, 0xF5, 0xFC,
+0xFF, 0xF8, 0x07, 0x05, 0x09, 0xFB, 0x01, 0x04, 0xFB, 0x01, 0xFC, 0xFB, 0x08, 0x05, 0x05, 0xFA,
+0x02, 0x05, 0xFA, 0x03, 0xFC, 0x05, 0x05, 0x06, 0xFE, 0x00, 0xFC, 0x03, 0x04, 0xFE, 0xFC, 0xFD,
+0x04, 0xF8, 0x06, 0x06, 0x04, 0xFB, 0x07, 0x06, 0x00, 0xFD, 0xFC, 0xFD, 0x06, 0xFE, 0x04, 0xFF,
+0x02, 0x01, 0xFB, 0x05, 0xFF, 0x05, 0x07, 0x06, 0xFA, 0x03, 0xFC, 0x06, 0x06, 0xFD, 0xFE, 0xFC,
+0x05, 0xF9, 0x06, 0x03, 0x08, 0xF9, 0x04, 0x01, 0xFE, 0xFD, 0xFD, 0xFF, 0x07, 0xFE, 0x04, 0xFD,
+0x05, 0x04, 0xFC, 0x05, 0xFD, 0x04, 0x03, 0x03, 0xFD, 0x04, 0xFE, 0x05, 0x06, 0xFC, 0xFF, 0xF8,
+0x05, 0xFC, 0x02, 0x01, 0x02, 0xF8, 0x07, 0x06, 0xFE, 0xFB, 0xFA, 0xF7, 0x04, 0xFE, 0x03, 0xFA,
+0x04, 0x03, 0xFB, 0x02, 0xFB, 0x03, 0x03, 0x07, 0xFC, 0x03, 0xFC, 0x04, 0x04, 0xFB, 0xFE, 0xFE,
+0x03, 0xFA, 0x05, 0x02, 0x01, 0xFF, 0x04, 0x05, 0xFB, 0xFD, 0xFD, 0xFC, 0x05, 0xFE, 0x04, 0xFB,
+0x03, 0x03, 0xFA, 0x02, 0xFC, 0x04, 0x02, 0x02, 0xFB, 0x04, 0xFE, 0x07, 0x04, 0xFA, 0xFE, 0xFC,
+0x04, 0xFC, 0x03, 0x03, 0x02, 0xFC, 0x03, 0x04, 0xFC, 0xF8, 0xFC, 0xFC, 0x05, 0xFD, 0x05, 0xFF,
+0x02, 0x03, 0xFA, 0x05, 0xFD, 0x04, 0x0B, 0x09, 0xFC, 0x02, 0xF7, 0x02, 0x04, 0x01, 0x00, 0xFF,
+0x04, 0xFB, 0x04, 0x0A, 0x08, 0xFE, 0x08, 0x01, 0xFE, 0x01, 0xF9, 0xFB, 0x07, 0xFE, 0x07, 0xFC,
+0x01, 0x0B, 0xFD, 0x0A, 0xFB, 0x03, 0x01, 0x0C, 0xFA, 0xFA, 0xFB, 0x04, 0x09, 0x01, 0x01, 0xFA,
+0x06, 0xFD, 0x05, 0xFF, 0x04, 0xFA, 0x08, 0x08, 0x01, 0x03, 0x00, 0xF7, 0x07, 0xFF, 0x0B, 0xFD,
+0x02, 0x08, 0xF9, 0x02, 0xFE, 0x06, 0x07, 0x04, 0xFD, 0x02, 0xF7, 0x02, 0x03, 0xFE, 0xFE, 0xF9,
+0x04, 0xFA, 0x06, 0x02, 0x03, 0xF7, 0x08, 0x03, 0xFF, 0xFE, 0xFB, 0xFF, 0x05, 0xFE, 0x03, 0x00,
+0x00, 0x03, 0xFB, 0x00, 0xFD, 0x07, 0x02, 0x05, 0xFE, 0xFF, 0xFD, 0x01, 0x06, 0xFA, 0xFC, 0xF9,
+0x03, 0xFB, 0x05, 0x04, 0x05, 0xF8, 0x03, 0x06, 0x00, 0x03, 0x00, 0xFA, 0x01, 0xFE, 0x07, 0xF7,
+0x03, 0x02, 0xF9, 0x06, 0xFB, 0x02, 0x06, 0x06, 0xFB, 0x03, 0xFF, 0x07, 0x02, 0xFF, 0xF7, 0xFE,
+0x04, 0xFA, 0x02, 0x02, 0x01, 0xFD, 0x01, 0x05, 0xFB, 0xFE, 0xF8, 0xFE, 0x07, 0xFD, 0x08, 0xFB,
+0x03, 0x06, 0xFE, 0x05, 0xFB, 0x07, 0x07, 0x07, 0xFC, 0xFE, 0xF9, 0x02, 0x04, 0xFE, 0xF7, 0xF9,
+0x05, 0xFA, 0x03, 0x00, 0x06, 0xF8, 0x06, 0x02, 0xFD, 0xFF, 0xFE, 0xFC, 0x03, 0xFE, 0x05, 0xF9,
+0x09, 0x05, 0xF8, 0x03, 0xF9, 0x07, 0x09, 0x05, 0xFF, 0x04, 0xF8, 0x07, 0x01, 0xFE, 0xFC, 0xF9,
+0x03, 0xFC, 0x03, 0x04, 0x06, 0xFD, 0x00, 0x05, 0x01, 0xFE, 0xF9, 0xFD, 0x07, 0xFE, 0x01, 0xFE,
+0x05, 0x02, 0xF8, 0x0C, 0x00, 0x02, 0x06, 0x07, 0x03, 0x02, 0xF9, 0x00, 0x05, 0xFF, 0xFD, 0xF9,
+0x05, 0xF6, 0x05, 0x0A, 0x07, 0xF6, 0x02, 0x08, 0xFD, 0xFF, 0xF7, 0x01, 0x03, 0xFF, 0x03, 0xFE,
+0x02, 0x08, 0xFD, 0x06, 0xFE, 0x02, 0x0A, 0x07, 0xFA, 0xFC, 0xFC, 0x06, 0x08, 0xFF, 0xFB, 0x00,
+0x04, 0xF8, 0x09, 0x01, 0x05, 0xF7, 0x04, 0x0A, 0x01, 0x02, 0xFD, 0xFE, 0x08, 0xFF, 0x05, 0xFB,
+0x01, 0x06, 0xFA, 0x01, 0xFA, 0x08, 0x04, 0x02, 0xFD, 0x02, 0xFE, 0x03, 0x02, 0xFB, 0xFA, 0xFC,
+0x03, 0xFE, 0x07, 0xFE, 0x07, 0xF8, 0x09, 0x08, 0xFC, 0x00, 0xFA, 0xFB, 0x06, 0xFD, 0x04, 0xFC,
+0x05, 0x02, 0xF8, 0x05, 0xFC, 0x05, 0x01, 0xFE, 0xFF, 0x04, 0xFA, 0x05, 0x04, 0xFD, 0xF6, 0xFA,
+0x06, 0xFA, 0x02, 0x02, 0x03, 0xFF, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x01, 0x09, 0xFE, 0x04, 0xF8,
+0x08, 0x0B, 0xF9, 0x07, 0xF7, 0x09, 0x06, 0x02, 0xFC, 0xFC, 0xF5, 0x07, 0x07, 0xFC, 0xFE, 0xFB,
+0xFE, 0xFE, 0xFF, 0x06, 0x03, 0xF5, 0x03, 0x07, 0x02, 0x03, 0xFD, 0xFA, 0x04, 0xFD, 0x07, 0xF9,
+0x05, 0x08, 0xF9, 0x08, 0xFF, 0x00, 0x04, 0x03, 0xFA, 0x03, 0xF6, 0x06, 0x04, 0x01, 0xFB, 0xFB,
+0x04, 0xFB, 0x05, 0x00, 0x05, 0xFC, 0x02, 0x08, 0xFC, 0xFC, 0xFC, 0xFD, 0x05, 0x00, 0x01, 0xFB,
+0x05, 0x06, 0xFD, 0x03, 0xFB, 0x06, 0x0A, 0x08, 0xFE, 0x02, 0xF8, 0x07, 0x02, 0x00, 0xFD, 0xFE,
+0x00, 0xFA, 0x04, 0x03, 0x06, 0xFB, 0x02, 0x07, 0x00, 0x03, 0xFE, 0xFA, 0x05, 0xFB, 0x05, 0xFD,
+0x07, 0x00, 0xF9, 0x0A, 0xF8, 0x07, 0x06, 0x01, 0xFF, 0x03, 0xF8, 0x02, 0x03, 0xFB, 0x01, 0xF9,
+0x04, 0xFC, 0x07, 0x0A, 0x07, 0xFA, 0x05, 0x01, 0xFE, 0x07, 0xF6, 0xF9, 0x02, 0xFF, 0x06, 0xFB,
+0x05, 0x0A, 0x00, 0x06, 0xFD, 0x03, 0x04, 0x06, 0x02, 0xFE, 0xFE, 0x02, 0x09, 0x00, 0xF9, 0xFB,
+0x05, 0xFD, 0x05, 0x0A, 0x06, 0xF6, 0x09, 0x0B, 0xFE, 0x06, 0xF9, 0xF5, 0xFF, 0xFC, 0x05, 0xFD,
+0x03, 0x09, 0xF5, 0x01, 0xF8, 0x03, 0x0A, 0x03, 0xFE, 0xF8, 0xF6, 0x00, 0x02, 0xFF, 0xF7, 0xFD,
+0x06, 0xFE, 0x09, 0x02, 0x08, 0xFA, 0x05, 0x03, 0xFE, 0x0B, 0xFA, 0xF6, 0x05, 0xFD, 0x04, 0xFB,
+0x01, 0x02, 0xF6, 0x02, 0xFC, 0x03, 0x09, 0x07, 0xFD, 0x04, 0xF9, 0x00, 0x04, 0x00, 0xFD, 0xF5,
+0x02, 0xF6, 0x03, 0x02, 0x05, 0xF7, 0x03, 0x08, 0x02, 0x05, 0xFF, 0xF8, 0x03, 0xF8, 0x04, 0xF7,
+0x07, 0x05, 0xF7, 0x05, 0xFA, 0x04, 0x06, 0x0B, 0x06, 0xFD, 0xF6, 0x01, 0x06, 0x09, 0xF5, 0xFA,
+0x00, 0xF8, 0x09, 0x05, 0x07, 0xF9, 0x03, 0x05, 0xFA, 0x04, 0xF5, 0x00, 0x09, 0xFF, 0x08, 0xFB,
+0x00, 0xFD, 0xFC, 0x06, 0xFA, 0x01, 0x0A, 0x00, 0xF6, 0x01, 0xFB, 0x01, 0x07, 0xFB, 0xFA, 0x01,
+0x03, 0x04, 0x0B, 0xFD, 0xFF, 0xF5, 0x06, 0x03, 0xFE, 0x08, 0xFC, 0xFB, 0x07, 0xF8, 0x08, 0x00,
+0x04, 0x04, 0xFC, 0x05, 0xFD, 0x01, 0x01, 0x05, 0xFA, 0x03, 0xFE, 0xFF, 0x05, 0xF7, 0xFE, 0xFE,
+0x06, 0xF9, 0x02, 0x08, 0x07, 0xF8, 0x05, 0x01, 0xFF, 0xFA, 0xFB, 0xFC, 0x03, 0xFF, 0x06, 0xFD,
+0x0A, 0x06, 0xFF, 0x0B, 0xFE, 0x0B, 0x06, 0x01, 0xFC, 0xFF, 0xFF, 0xFE, 0x09, 0xFC, 0xFB, 0xF5,
+0x02, 0xF9, 0xFF, 0x02, 0x08, 0xFB, 0x06, 0x06, 0xF9, 0x08, 0xFC, 0xF9, 0x02, 0x02, 0x00, 0xFE,
+0x07, 0x05, 0xF7, 0x04, 0x01, 0x02, 0xFF, 0x00, 0xFD, 0x05, 0xFE, 0xFF, 0x05, 0x01, 0xF7, 0xFA,
+0x01, 0x02, 0x07, 0x00, 0x08, 0xF9, 0xFF, 0x0A, 0x00, 0xFD, 0xFE, 0xFB, 0x07, 0xFA, 0x07, 0xFC,
+0x08, 0x01, 0xF9, 0xFF, 0xFF, 0x01, 0x01, 0x05, 0xFB, 0xFE, 0xFD, 0x02, 0x03, 0xFE, 0xF8, 0xF9,
+0x07, 0x00, 0x03, 0x06, 0x08, 0xF7, 0x05, 0x04, 0xFD, 0x02, 0xFA, 0xF6, 0x08, 0x03, 0x00, 0xF7,
+0x0A, 0x09, 0xF7, 0x00, 0xFD, 0x05, 0xFF, 0x09, 0xFD, 0x03, 0xFF, 0x00, 0xFE, 0xFE, 0x01, 0x00,
+0x04, 0x02, 0x0B, 0x04, 0x02, 0xF7, 0x0A, 0x00, 0x00, 0xFE, 0x00, 0xFA, 0x08, 0xFF, 0x09, 0xFC,
+0x01, 0x05, 0xFD, 0x02, 0xFB, 0x05, 0x05, 0x01, 0xFE, 0x05, 0xFC, 0x01, 0x06, 0xFB, 0xFB, 0xFE,
+0x06, 0x01, 0x05, 0x05, 0x01, 0xFE, 0x06, 0x02, 0xFC, 0xF6, 0xFC, 0xFB, 0x06, 0xFC, 0x05, 0xFB,
+0xFB, 0x00, 0xFB, 0x06, 0x02, 0x00, 0x0B, 0x06, 0xFD, 0xFC, 0xFD, 0x0B, 0x03, 0xF6, 0xF5, 0xFA,
+0x07, 0x01, 0x03, 0x07, 0x02, 0x00, 0xFD, 0x00, 0xFC, 0xFD, 0xF5, 0xFC, 0x07, 0xFC, 0x09, 0x06,
+0x03, 0x00, 0xFC, 0x03, 0x04, 0x07, 0x02, 0xFF, 0xFE, 0xFE, 0xF5, 0xFE, 0x08, 0x03, 0xF9, 0xFD,
+0x08, 0xFD, 0x02, 0x03, 0x08, 0xFA, 0x0D, 0x0A, 0xFE, 0x05, 0xFD, 0xFA, 0x04, 0x00, 0x03, 0xFC,
+0x05, 0x04, 0xF6, 0x05, 0xFE, 0x07, 0x03, 0x05, 0xFF, 0xFE, 0x00, 0x05, 0x07, 0x01, 0xF9, 0xF8,
+0x02, 0xFF, 0x09, 0x03, 0x0B, 0xF6, 0x03, 0x02, 0xFE, 0xFD, 0xF6, 0xFF, 0x04, 0xFA, 0xFF, 0xF9,
+0x05, 0x06, 0xF8, 0x04, 0xFD, 0x05, 0x06, 0x03, 0xFC, 0xFD, 0xFA, 0xFF, 0x07, 0x02, 0xFE, 0xF8,
+0x05, 0xFE, 0x0A, 0x0A, 0x04, 0xFF, 0x09, 0x03, 0xFE, 0x03, 0xFB, 0xFA, 0x04, 0xFC, 0x06, 0xFF,
+0x03, 0x04, 0xFD, 0x06, 0xFC, 0x05, 0x00, 0x02, 0xFB, 0xFF, 0xF7, 0x00, 0x05, 0xFB, 0xFE, 0xF9,
+0x05, 0xFA, 0x05, 0x05, 0x02, 0xFD, 0x06, 0x05, 0xF9, 0xFD, 0xFB, 0xFB, 0x03, 0xFE, 0x03, 0xFA,
+0x01, 0x02, 0xFB, 0x08, 0xFC, 0x04, 0x04, 0x04, 0xFF, 0x07, 0xFA, 0x03, 0x07, 0xFE, 0xFA, 0xFD,
+0x05, 0xFC, 0x06, 0x03, 0x03, 0xFF, 0x03, 0x01, 0xFD, 0x01, 0xFD, 0xFA, 0x09, 0xFA, 0x06, 0xFA,
+0x00, 0x01, 0xF6, 0x08, 0xFE, 0x07, 0x01, 0x04, 0x01, 0x06, 0xF7, 0x03, 0x03, 0xFE, 0xFA, 0xFA,
+0x06, 0xFC, 0x00, 0x0C, 0x00, 0xFC, 0x03, 0x05, 0xFF, 0xFD, 0xFA, 0xFA, 0x00, 0xFD, 0x04, 0x01,
+0x00, 0x0B, 0xFB, 0x08, 0x00, 0x09, 0xFF, 0x02, 0xFD, 0x00, 0xFF, 0x04, 0x00, 0xFF, 0xFC, 0xFA,
+0x06, 0xF6, 0x01, 0x0A, 0x0B, 0xFD, 0x04, 0x06, 0xFE, 0xF8, 0x02, 0xF9, 0x07, 0x04, 0x08, 0xF6,
+0x02, 0x09, 0xFA, 0x07, 0x01, 0x07, 0x00, 0x02, 0x01, 0xFF, 0xFB, 0x06, 0x0A, 0x03, 0xF9, 0xFE,
+0x01, 0xF8, 0x0A, 0x07, 0x02, 0xFB, 0xFF, 0x0A, 0xFE, 0x02, 0x01, 0xFA, 0xFD, 0xFB, 0x00, 0x00,
+0x08, 0x01, 0xFE, 0x06, 0xFD, 0x07, 0x00, 0x05, 0xFC, 0x05, 0xF9, 0xFE, 0x03, 0xFB, 0xFC, 0xF9,
+0x04, 0xFE, 0x02, 0x02, 0x06, 0xFB, 0x04, 0x03, 0xFB, 0xFD, 0xFE, 0xFD, 0x0B, 0xF7, 0x07, 0xFA,
+0x06, 0x02, 0xFA, 0x00, 0xFC, 0x04, 0x06, 0x08, 0xFA, 0x05, 0xF9, 0x06, 0x02, 0xFB, 0xF8, 0xFB,
+0x00, 0xFE, 0x04, 0x04, 0x04, 0xF8, 0xFF, 0xFF, 0xFB, 0xFF, 0xFA, 0xFA, 0x01, 0xFF, 0x08, 0xFD,
+0x03, 0x04, 0xFC, 0x05, 0xFC, 0x05, 0x03, 0x05, 0xFD, 0x04, 0xFD, 0x05, 0x05, 0xFD, 0xFB, 0xFB,
+0x04, 0xF9, 0x05, 0x04, 0x05, 0xF8, 0x03, 0x05, 0xFB, 0xF9, 0xFE, 0xFD, 0x05, 0xFD, 0x04, 0xFA,
+0x03, 0x02, 0xFC, 0x04, 0xFC, 0x05, 0x0A, 0x04, 0xFE, 0x03, 0xFB, 0x03, 0x06, 0xFC, 0xF7, 0x00,
+0x05, 0xFA, 0x08, 0x06, 0x07, 0x00, 0x05, 0x07, 0xF8, 0xFF, 0xFE, 0xFC, 0x04, 0xFD, 0x07, 0xFB,
+0x04, 0x07, 0xFB, 0x09, 0xFB, 0x04, 0x06, 0x07, 0xFD, 0x03, 0xF9, 0x06, 0x04, 0xFC, 0xFD, 0xFE,
+0x03, 0xFC, 0x06, 0x04, 0x03, 0xFD, 0x03, 0x08, 0xFB, 0xFE, 0xFA, 0xFB, 0x04, 0xFD, 0x08, 0xFE,
+0x02, 0x06, 0xFD, 0x05, 0xFB, 0x05, 0x06, 0x04, 0xFC, 0x05, 0xFD, 0x03, 0x04, 0xFF, 0xFC, 0xF9,
+0x05, 0xFE, 0x06, 0x05, 0x05, 0xFD, 0x04, 0x03, 0xFA, 0xFA, 0xFC, 0xFA, 0x08, 0xFC, 0x05, 0xFC,
+0x07, 0x09, 0xFA, 0x07, 0x00, 0x03, 0x04, 0x08, 0x00, 0x03, 0xFF, 0x06, 0x07, 0xFF, 0xFD, 0xFD,
+0x01, 0xFF, 0x01, 0x07, 0x09, 0xF8, 0x07, 0x05, 0xFC, 0xFD, 0xFD, 0x00, 0x05, 0xFE, 0x08, 0xFF,
+0x09, 0x09, 0xF8, 0x00, 0xFB, 0x07, 0x00, 0x07, 0xFC, 0x00, 0xFD, 0x02, 0x01, 0x01, 0xFF, 0xFE,
+0x05, 0xFB, 0x09, 0x04, 0x05, 0xFA, 0x07, 0xFF, 0xF9, 0xFF, 0xFA, 0x00, 0x0C, 0xFD, 0x07, 0xF9,
+0x01, 0x02, 0xFC, 0x02, 0xFE, 0x08, 0x01, 0x07, 0xFB, 0x00, 0xFA, 0x06, 0x01, 0x08, 0xF7, 0xF9,
+0x04, 0xF6, 0x0D, 0x0D, 0x03, 0xFA, 0x07, 0x02, 0x02, 0xFD, 0xFF, 0xF7, 0x01, 0xFE, 0x03, 0xF9,
+0x08, 0x0A, 0xF7, 0x09, 0xFE, 0x07, 0x08, 0x08, 0x03, 0x06, 0xFE, 0xFF, 0x06, 0xFF, 0xF9, 0xF9,
+0x05, 0xFF, 0xFF, 0x09, 0x06, 0xFB, 0x04, 0x0A, 0xFE, 0x05, 0xFE, 0xFB, 0x01, 0xFB, 0x00, 0xF8,
+0x04, 0x07, 0xFC, 0x03, 0xFD, 0x05, 0x08, 0x03, 0xFB, 0x03, 0xFD, 0x03, 0x04, 0xFC, 0xFD, 0xFB,
+0x06, 0xFB, 0x04, 0x04, 0x04, 0xFE, 0x03, 0x04, 0xFD, 0xF8, 0xFB, 0xFD, 0x04, 0xFC, 0x02, 0xFA,
+0x04, 0x05, 0xFA, 0x06, 0xFD, 0x03, 0x02, 0x04, 0xFB, 0x05, 0xFC, 0x05, 0x05, 0xFB, 0xFD, 0xFD,
+0x06, 0xFD, 0x05, 0x05, 0x02, 0xF9, 0x05, 0x06, 0xFB, 0xF6, 0xFC, 0xFA, 0x06, 0xFC, 0x04, 0x01,
+0x04, 0x04, 0xFA, 0x05, 0xFD, 0x05, 0x06, 0x04, 0xFD, 0x03, 0xFB, 0x04, 0x05, 0xFD, 0xFC, 0xFB,
+0x04, 0xFB, 0x06, 0x04, 0x05, 0xF9, 0x05, 0x04, 0xFD, 0xF7, 0xFD, 0xFD, 0x04, 0xFD, 0x03, 0xFC,
+0x04, 0x04, 0xF9, 0x07, 0xFC, 0x03, 0x04, 0x06, 0xFE, 0x03, 0xFA, 0x04, 0x05, 0xFE, 0xFC, 0xFC,
+0x04, 0xFC, 0x05, 0x05, 0x04, 0xFD, 0x05, 0x07, 0xFE, 0xFD, 0xFD, 0xFD, 0x07, 0xFF, 0x05, 0xFB,
+0x00, 0x04, 0x00, 0x03, 0xFB, 0x00, 0x0A, 0x0C, 0x02, 0xFF, 0xFC, 0xFF, 0x09, 0xFF, 0xF6, 0xF8,
+0xFF, 0xF6, 0x08, 0x04, 0x04, 0xFC, 0x0A, 0x05, 0xFE, 0x00, 0xFC, 0xF7, 0x03, 0xFE, 0x01, 0xF7,
+0x02, 0x03, 0xF8, 0x01, 0xFD, 0x01, 0x07, 0x06, 0xF9, 0x06, 0x01, 0x03, 0x08, 0xFE, 0xF7, 0xF8,
+0x02, 0xF9, 0x03, 0x01, 0xFF, 0xFD, 0x03, 0x03, 0xFF, 0xFD, 0xFA, 0xFB, 0x07, 0x01, 0x04, 0xF5,
+0x05, 0x07, 0x00, 0x05, 0xFE, 0x04, 0x07, 0x0A, 0x07, 0x04, 0xFC, 0xFA, 0x08, 0x07, 0x00, 0xF6,
+0x03, 0xFB, 0x06, 0x04, 0xFF, 0xF8, 0x07, 0x09, 0xFE, 0x00, 0xFA, 0xFE, 0x0B, 0xFD, 0x04, 0xF9,
+0x05, 0x03, 0xFF, 0x03, 0xFB, 0x00, 0x0A, 0x06, 0xFF, 0x03, 0xFA, 0x03, 0x05, 0xFE, 0xFC, 0xFE,
+0xFF, 0xFD, 0x06, 0x07, 0x08, 0xF8, 0x06, 0x07, 0xFE, 0xFB, 0xFC, 0xFA, 0x00, 0xFF, 0x06, 0xFA,
+0x03, 0x03, 0xFE, 0x05, 0xFB, 0x05, 0x04, 0x04, 0xFE, 0x05, 0xFA, 0x05, 0x06, 0xFD, 0xFC, 0xFC,
+0x05, 0xF9, 0x04, 0x02, 0x03, 0xFA, 0x07, 0x08, 0xFB, 0xFC, 0xFB, 0xFB, 0x04, 0xFE, 0x05, 0xFC,
+0x04, 0x05, 0xFC, 0x04, 0xFB, 0x03, 0x03, 0x03, 0xFB, 0x07, 0xFD, 0x04, 0x05, 0xFB, 0xFA, 0xFC,
+0x06, 0xFB, 0x05, 0x04, 0x06, 0x01, 0x04, 0x03, 0xFC, 0xF2, 0xFE, 0xFC, 0x06, 0xFF, 0x05, 0xFC,
+0x05, 0x05, 0xFE, 0x04, 0xFC, 0x05, 0x04, 0x06, 0xFE, 0x06, 0xFE, 0x02, 0x04, 0xFA, 0xFE, 0xFC,
+0x05, 0xFA, 0x06, 0x04, 0x05, 0xFC, 0x05, 0x06, 0xFB, 0xF4, 0xFD, 0xFB, 0x06, 0xFD, 0x04, 0xFE,
+0x05, 0x03, 0x00, 0x05, 0xFC, 0x02, 0x07, 0x06, 0xFE, 0xFF, 0xF8, 0x03, 0x08, 0xFA, 0xFB, 0xF9,
+0x05, 0xFA, 0x03, 0x01, 0x05, 0xF6, 0x02, 0x05, 0xFC, 0xFA, 0xFD, 0xFC, 0x01, 0xFE, 0x0A, 0xFF,
+0x05, 0x05, 0xFB, 0x06, 0xFB, 0x05, 0x04, 0x07, 0xF9, 0x00, 0xFB, 0x04, 0x05, 0x05, 0xF7, 0xF4,
+0x06, 0x01, 0x02, 0x04, 0x00, 0xFD, 0x02, 0x07, 0x00, 0xFA, 0xF7, 0xF9, 0x09, 0x00, 0x03, 0xFA,
+0x0A, 0x0D, 0xFA, 0x03, 0xF8, 0x08, 0x0B, 0x03, 0x00, 0xFE, 0xFB, 0x01, 0x01, 0xFA, 0x00, 0xF9,
+0x01, 0xFD, 0x00, 0x00, 0x05, 0xFC, 0x03, 0x03, 0xFD, 0x10, 0xF8, 0xFC, 0x07, 0x01, 0x07, 0xF9,
+0x07, 0x05, 0xF8, 0xFF, 0xFE, 0x02, 0x00, 0x04, 0x01, 0x01, 0xFD, 0x07, 0x01, 0x02, 0xF5, 0xF9,
+0x01, 0xF5, 0x09, 0x09, 0x07, 0xFA, 0xFF, 0x00, 0xF6, 0x06, 0xF7, 0xF6, 0x03, 0x01, 0x04, 0x00,
+0x07, 0x05, 0xFE, 0x06, 0xFA, 0x06, 0x08, 0x05, 0xFF, 0x02, 0xF7, 0x03, 0x08, 0xFC, 0xFD, 0xFA,
+0x02, 0xFA, 0x04, 0x04, 0x04, 0xFA, 0x06, 0xFD, 0xFD, 0xF9, 0xF9, 0xFD, 0x03, 0x02, 0x01, 0x00,
+0x03, 0x07, 0xFF, 0x08, 0xFF, 0x06, 0x01, 0x06, 0xFD, 0x04, 0xF8, 0x04, 0x09, 0xFE, 0xFF, 0xF9,
+0x04, 0xF7, 0x08, 0x05, 0x01, 0xFB, 0x03, 0x08, 0x02, 0x05, 0xFF, 0xFB, 0x06, 0xFF, 0x09, 0xFE,
+0x05, 0x04, 0xFF, 0x04, 0xFC, 0x07, 0x05, 0x04, 0xFC, 0x08, 0xFF, 0x03, 0x08, 0x01, 0xFC, 0xFD,
+0x07, 0xFD, 0x04, 0x04, 0x03, 0xFA, 0x04, 0x07, 0xF8, 0xFC, 0xFC, 0xFB, 0x05, 0xFF, 0x06, 0xF9,
+0x04, 0x02, 0xFB, 0x01, 0xFD, 0x06, 0x03, 0x05, 0xFA, 0x03, 0xFE, 0x03, 0x06, 0xFA, 0xFC, 0xF7,
+0x03, 0xFB, 0x03, 0x07, 0x06, 0xFC, 0x02, 0x07, 0xFC, 0xF8, 0xFC, 0xFB, 0x05, 0xFB, 0x05, 0xFE,
+0x04, 0x07, 0xFA, 0x05, 0x00, 0x05, 0x08, 0x0A, 0x01, 0xFE, 0xFD, 0x02, 0x07, 0x00, 0xF7, 0xFD,
+0x02, 0xFC, 0x07, 0x04, 0x02, 0xFA, 0x03, 0x07, 0xFD, 0x02, 0xF9, 0xFD, 0x07, 0xFB, 0x04, 0xFC,
+0xFF, 0x06, 0xFD, 0x09, 0xFB, 0x0A, 0x02, 0x04, 0xFD, 0x04, 0xFA, 0x01, 0x03, 0x04, 0xF8, 0xF9,
+0x04, 0xF6, 0x09, 0x09, 0x02, 0xFB, 0x02, 0x01, 0xFF, 0x02, 0xFC, 0xF9, 0x08, 0xFD, 0x01, 0xF9,
+0x01, 0x08, 0x01, 0x08, 0xF6, 0x08, 0xFE, 0x06, 0xFE, 0x04, 0xFF, 0x05, 0x0B, 0xFB, 0xFD, 0xFC,
+0x08, 0xFE, 0xFE, 0x05, 0x03, 0xFB, 0x03, 0x09, 0x00, 0x02, 0xF8, 0xFB, 0x02, 0x00, 0x03, 0xFD,
+0x06, 0x0A, 0xFE, 0x08, 0xFC, 0x04, 0x01, 0x03, 0xFD, 0x06, 0xFE, 0x01, 0x04, 0xFE, 0xF9, 0xFB,
+0x05, 0xFE, 0x08, 0x01, 0x01, 0x00, 0x08, 0x01, 0xFE, 0xF9, 0xFB, 0xF9, 0x09, 0x00, 0xFE, 0xFE,
+0x08, 0x04, 0xF9, 0x03, 0xFA, 0x04, 0x04, 0x04, 0xFB, 0x03, 0xFA, 0x03, 0x08, 0x01, 0xF7, 0xF7,
+0x0A, 0xFC, 0x01, 0x08, 0x08, 0x00, 0x04, 0xFF, 0xF8, 0x05, 0xFD, 0xFE, 0x03, 0xFF, 0x0A, 0xFD,
+0x08, 0x01, 0xF9, 0x01, 0xFA, 0x07, 0x02, 0x04, 0xFF, 0x01, 0xFB, 0x06, 0x07, 0xFF, 0xFE, 0xFC,
+0x04, 0xFB, 0x08, 0x02, 0x01, 0xF7, 0x04, 0x08, 0xFB, 0x03, 0xFB, 0xF8, 0x04, 0xFD, 0x05, 0xFD,
+0x02, 0x04, 0xFE, 0x02, 0xFD, 0x08, 0x08, 0x05, 0xFE, 0x05, 0xF7, 0x06, 0x09, 0x00, 0xFE, 0xF9,
+0x05, 0xF7, 0x01, 0x01, 0x06, 0xFD, 0x04, 0x05, 0xFE, 0xFE, 0xFE, 0xFC, 0x07, 0xFF, 0x05, 0xFA,
+0x02, 0x0A, 0x01, 0x09, 0xF9, 0x06, 0x00, 0x0A, 0x00, 0x01, 0xF6, 0x04, 0x00, 0x01, 0xFF, 0xF4,
+0x03, 0xFF, 0x07, 0x06, 0x08, 0x00, 0x09, 0x02, 0x01, 0x00, 0xFC, 0xFF, 0x07, 0xF8, 0x08, 0xF3,
+0x00, 0x05, 0xFC, 0x0C, 0xFE, 0x07, 0x0B, 0x05, 0xFC, 0xFD, 0xF6, 0x00, 0x01, 0xFE, 0xFC, 0xFB,
+0x00, 0xFA, 0x06, 0x03, 0x01, 0xFF, 0x05, 0x03, 0xFE, 0xFE, 0x00, 0xF7, 0x09, 0xFB, 0x08, 0xF8,
+0x02, 0x07, 0xF7, 0x04, 0x01, 0x09, 0x02, 0x09, 0xFB, 0x09, 0xF5, 0x00, 0x01, 0xFB, 0xFE, 0x02,
+0x05, 0xFD, 0x00, 0x04, 0x07, 0xFF, 0x01, 0x05, 0xF5, 0xFF, 0xF7, 0x02, 0x0B, 0xFE, 0x05, 0x00,
+0x03, 0x02, 0xF9, 0x07, 0xFF, 0x06, 0x08, 0x0A, 0x01, 0xFE, 0xFF, 0xFD, 0x03, 0x00, 0xFA, 0x01,
+0x08, 0x00, 0x02, 0x08, 0x04, 0xF8, 0x03, 0x0A, 0xFD, 0x07, 0x02, 0xF3, 0x0A, 0xFF, 0x09, 0xFA,
+0x07, 0x06, 0xF7, 0x0B, 0x01, 0x00, 0x04, 0x03, 0xFE, 0xFE, 0xFA, 0x06, 0xFF, 0xFE, 0xFC, 0xF9,
+0x02, 0xFC, 0x04, 0x05, 0x05, 0xFA, 0x01, 0x00, 0x00, 0xFD, 0xFC, 0xF8, 0x05, 0xFC, 0x02, 0xFE,
+0xFE, 0x07, 0xFD, 0x09, 0xF9, 0x07, 0x08, 0x09, 0x00, 0xFD, 0xFE, 0x01, 0x0B, 0xFF, 0xFE, 0xF5,
+0x02, 0xFB, 0xFF, 0x01, 0x03, 0xF9, 0x0A, 0x02, 0xF6, 0x00, 0xFF, 0xF8, 0x02, 0xFC, 0x02, 0xFD,
+0x03, 0x05, 0xFD, 0x07, 0x04, 0x07, 0x04, 0x01, 0xF9, 0x05, 0xF9, 0x02, 0xFF, 0xFA, 0xF8, 0x01,
+0x06, 0xFA, 0x07, 0x06, 0x00, 0xFC, 0x07, 0x03, 0x01, 0xF9, 0xFF, 0xFC, 0x04, 0xFA, 0x04, 0x01,
+0x05, 0x05, 0xFE, 0xFF, 0xFF, 0x07, 0x07, 0x02, 0x01, 0x04, 0xF6, 0xFF, 0x06, 0x04, 0xF7, 0xFA,
+0x00, 0xF9, 0x05, 0x04, 0x01, 0xF5, 0x01, 0x08, 0xFF, 0x00, 0x01, 0xFA, 0x05, 0xFF, 0x06, 0xFA,
+0xFF, 0x09, 0xF9, 0x06, 0xFF, 0x03, 0x03, 0x04, 0x02, 0x00, 0xFA, 0x03, 0x01, 0xFC, 0x00, 0xFC,
+0x02, 0xFC, 0x05, 0x00, 0x05, 0xFF, 0x08, 0x0B, 0xFD, 0xFD, 0xFE, 0xFF, 0x05, 0xFA, 0x01, 0xF6,
+0xFE, 0x05, 0xFC, 0x08, 0x02, 0x05, 0x01, 0x05, 0xF7, 0xFE, 0xFD, 0x06, 0x0B, 0xFC, 0xFB, 0xFE,
+0x05, 0xFC, 0x02, 0x03, 0x03, 0xFB, 0x03, 0x06, 0xFC, 0x03, 0xF8, 0x01, 0x03, 0xF5, 0x05, 0xFC,
+0x05, 0x04, 0xFA, 0x03, 0xF8, 0x03, 0xFF, 0x02, 0xF7, 0x04, 0xFA, 0xFE, 0x00, 0x00, 0xF6, 0xFE,
+0x00, 0xFC, 0x09, 0x05, 0x06, 0xFC, 0x07, 0x02, 0xF7, 0x03, 0xFD, 0xFA, 0x09, 0xF9, 0x07, 0xFB,
+0x05, 0x0A, 0xF8, 0x08, 0x00, 0x00, 0x0B, 0x02, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0xFE, 0xF9, 0x02,
+0x05, 0xFB, 0x07, 0xFF, 0x06, 0xFE, 0x08, 0x0B, 0x03, 0x02, 0xFB, 0x00, 0x08, 0x05, 0x07, 0xF9,
+0x07, 0x05, 0xFA, 0x05, 0xFB, 0x07, 0x05, 0x07, 0xF8, 0x07, 0xFA, 0x07, 0x06, 0xF9, 0xF8, 0xF9,
+0x06, 0xFA, 0x07, 0x06, 0x05, 0xFA, 0x05, 0x04, 0xFB, 0xF6, 0xF9, 0xF9, 0x08, 0xFC, 0x07, 0xFA,
+0x06, 0x06, 0xF9, 0x05, 0xFA, 0x06, 0x07, 0x06, 0xF9, 0x07, 0xFA, 0x06, 0x06, 0xF7, 0xF9, 0xF9,
+0x06, 0xFC, 0x07, 0x06, 0x05, 0xFC, 0x07, 0x05, 0xFC, 0xF6, 0xF9, 0xF9, 0x08, 0xFC, 0x04, 0xFB,
+0x06, 0x07, 0xF9, 0x05, 0xF9, 0x07, 0x04, 0x05, 0xF9, 0x08, 0xFA, 0x06, 0x07, 0xF9, 0xFA, 0xF9,
+0x07, 0xFA, 0x07, 0x06, 0x07, 0xFA, 0x06, 0x04, 0xFA, 0xFB, 0xF9, 0xF8, 0x09, 0xFC, 0x07, 0xFC,
+0x06, 0x06, 0xF9, 0x06, 0xFA, 0x05, 0x06, 0x05, 0xF9, 0x08, 0xF9, 0x06, 0x07, 0xF9, 0xF9, 0xFA,
+0x06, 0xFA, 0x08, 0x06, 0x05, 0xFC, 0x06, 0x04, 0xFD, 0xF6, 0xF9, 0xFA, 0x09, 0xFC, 0x05, 0xFC,
+0x07, 0x05, 0xFA, 0x07, 0xFC, 0x06, 0x06, 0x04, 0xF9, 0x07, 0xFB, 0x07, 0x06, 0xF9, 0xF9, 0xF9,
+0x07, 0xFB, 0x07, 0x07, 0x06, 0xFC, 0x07, 0x04, 0xFA, 0xF2, 0xF9, 0xFC, 0x09, 0xFC, 0x05, 0xFE,
+0x04, 0x06, 0xFA, 0x04, 0xFB, 0x08, 0x04, 0x07, 0xFA, 0x06, 0xF8, 0x05, 0x06, 0xFA, 0xF9, 0xF9,
+0x07, 0xF9, 0x07, 0x09, 0x07, 0xF9, 0x06, 0x05, 0xFB, 0xF7, 0xFB, 0xFA, 0x08, 0xFC, 0x06, 0xF9,
+0x06, 0x06, 0xF9, 0x04, 0xFA, 0x07, 0x07, 0x05, 0xFA, 0x06, 0xFA, 0x05, 0x08, 0xF9, 0xF7, 0xF8,
+0x06, 0xF9, 0x08, 0x07, 0x07, 0xFC, 0x09, 0x03, 0xFC, 0xFB, 0xFA, 0xFA, 0x0A, 0xFC, 0x05, 0xF9,
+0x06, 0x06, 0xF9, 0x05, 0xFA, 0x07, 0x04, 0x06, 0xFA, 0x08, 0xFA, 0x06, 0x07, 0xF8, 0xF9, 0xF9,
+0x06, 0xFA, 0x08, 0x07, 0x06, 0xF9, 0x06, 0x05, 0xFB, 0xF7, 0xFA, 0xFA, 0x08, 0xFC, 0x07, 0xFB,
+0x07, 0x07, 0xF9, 0x07, 0xF9, 0x07, 0x08, 0x06, 0xFE, 0x07, 0xF8, 0x07, 0x05, 0xF8, 0xF9, 0xF8,
+0x04, 0xFB, 0x05, 0x06, 0x08, 0xFB, 0x06, 0x06, 0xFC, 0xFD, 0xFC, 0xF9, 0x08, 0xFC, 0x07, 0xF8,
+0x04, 0x05, 0xFB, 0x05, 0xF7, 0x05, 0x08, 0x09, 0xF7, 0x03, 0xF9, 0x04, 0x06, 0xFA, 0xFB, 0xF9,
+0x07, 0xF8, 0x09, 0x05, 0x06, 0xF9, 0x04, 0x06, 0xF8, 0xFF, 0xF9, 0xFB, 0x0A, 0xFC, 0x07, 0xFB,
+0x08, 0x07, 0xFC, 0x04, 0xF9, 0x0A, 0x0A, 0x04, 0xFC, 0x03, 0xF7, 0x0A, 0x05, 0xFB, 0xF9, 0xF9,
+0x04, 0xF8, 0x08, 0x09, 0x04, 0xFA, 0x06, 0x04, 0xF8, 0xFC, 0xFA, 0xF9, 0x08, 0xFC, 0x0A, 0xFA,
+0x05, 0x05, 0xFD, 0x08, 0xFB, 0x07, 0x06, 0x09, 0xF9, 0x07, 0xF9, 0x06, 0x09, 0xF8, 0xF8, 0xF8,
+0x05, 0xF9, 0x08, 0x07, 0x04, 0xFC, 0x05, 0x08, 0xF9, 0xFA, 0xFA, 0xFD, 0x09, 0xFC, 0x04, 0xFB,
+0x06, 0x08, 0xFC, 0x06, 0xF7, 0x05, 0x02, 0x07, 0xFA, 0x03, 0xFC, 0x06, 0x07, 0xF8, 0xFB, 0xFB,
+0x06, 0xF9, 0x05, 0x09, 0x0A, 0xF9, 0x08, 0x08, 0xF9, 0xFA, 0xFB, 0xF9, 0x08, 0xFD, 0x06, 0xFC,
+0x05, 0x06, 0xF8, 0x05, 0xF9, 0x06, 0x06, 0x04, 0xF9, 0x07, 0xF9, 0x0C, 0x06, 0xFB, 0xFA, 0xF9,
+0x06, 0xFB, 0x05, 0x05, 0x07, 0xFC, 0x07, 0x03, 0xFB, 0xFC, 0xFA, 0xF9, 0x09, 0xFC, 0x06, 0xF7,
+0x06, 0x08, 0xF9, 0x04, 0xF9, 0x07, 0x0B, 0x06, 0xFC, 0x04, 0xF5, 0x04, 0x05, 0xFC, 0xFA, 0xFA,
+0x06, 0xF5, 0x08, 0x06, 0x05, 0xF2, 0x07, 0x03, 0xFA, 0x01, 0xF5, 0xFA, 0x08, 0xFC, 0x03, 0xFB,
+0x05, 0x06, 0xF4, 0x04, 0xFA, 0x07, 0x08, 0x0A, 0xFB, 0x04, 0xF8, 0x05, 0x08, 0xFB, 0xF7, 0xF9,
+0x06, 0xFA, 0x07, 0x05, 0x05, 0xF9, 0x05, 0x06, 0xFC, 0x01, 0xFB, 0xF9, 0x08, 0xFC, 0x07, 0xFC,
+0x07, 0x05, 0xF9, 0x0B, 0xFA, 0x09, 0x09, 0x05, 0xFC, 0x05, 0xFB, 0x03, 0x06, 0xF9, 0xF8, 0xF6,
+0x03, 0xF8, 0x05, 0x04, 0x09, 0xF6, 0x09, 0x05, 0xFD, 0xFE, 0xF8, 0xFB, 0x08, 0xFC, 0x05, 0xF8,
+0x06, 0x04, 0xF7, 0x06, 0xF7, 0x05, 0x03, 0x07, 0xF8, 0x09, 0xFC, 0x08, 0x04, 0xFD, 0xF9, 0xFD,
+0x06, 0xFC, 0x07, 0x06, 0x06, 0xF9, 0x04, 0x0A, 0xF7, 0xF6, 0xF9, 0xF8, 0x07, 0xFD, 0x06, 0xF9,
+0x04, 0x0B, 0xFA, 0x04, 0xFA, 0x09, 0x07, 0x07, 0xFA, 0x05, 0xF6, 0x09, 0x07, 0xF8, 0xF9, 0xFA,
+0x07, 0xFA, 0x05, 0x07, 0x0A, 0xFA, 0x04, 0x04, 0xFB, 0xFE, 0xFB, 0xFB, 0x0C, 0xFD, 0x08, 0xFA,
+0x04, 0x07, 0xF5, 0x05, 0xFC, 0x08, 0x04, 0x09, 0xFB, 0x06, 0xF9, 0x03, 0x06, 0xFA, 0xF5, 0xF7,
+0x05, 0xF9, 0x09, 0x03, 0x05, 0xF8, 0x06, 0x05, 0xF8, 0xFE, 0xF6, 0xF9, 0x06, 0xFB, 0x07, 0xFA,
+0x05, 0x05, 0xF4, 0x0B, 0xFB, 0x07, 0x03, 0x09, 0xFC, 0x06, 0xFB, 0x08, 0x03, 0x00, 0xFB, 0xF8,
+0x02, 0xFB, 0x09, 0x09, 0x0C, 0xFC, 0x04, 0x0A, 0xF9, 0xFE, 0xFA, 0xF5, 0x07, 0xFA, 0x03, 0xF7,
+0x06, 0x06, 0xF9, 0x06, 0xFC, 0x05, 0x07, 0x09, 0xFB, 0x07, 0xFC, 0x06, 0x04, 0xFA, 0xF4, 0xF6,
+0x07, 0xFC, 0x09, 0x09, 0x06, 0xF7, 0x09, 0x07, 0xFF, 0xF9, 0xFB, 0xFB, 0x06, 0xFC, 0x04, 0xF6,
+0x02, 0x0A, 0xF6, 0x0A, 0xF9, 0x07, 0x04, 0x08, 0xFD, 0x03, 0xF4, 0x06, 0x04, 0xFF, 0xF5, 0xFB,
+0x03, 0xFA, 0x04, 0x06, 0x0C, 0xF5, 0x07, 0x07, 0xFB, 0xFE, 0xFA, 0xFC, 0x06, 0xFB, 0x07, 0xF4,
+0x06, 0x05, 0xF7, 0x03, 0xFA, 0x05, 0x06, 0x08, 0xF9, 0x06, 0xFC, 0x04, 0x05, 0xFF, 0xFA, 0xF7,
+0x07, 0xFC, 0x06, 0x07, 0x05, 0xF7, 0x09, 0x05, 0xF6, 0xFE, 0xFA, 0xF9, 0x0A, 0xFD, 0x07, 0xF4,
+0x03, 0x06, 0xFC, 0x05, 0xF9, 0x07, 0x05, 0x08, 0xFE, 0x05, 0xF7, 0x07, 0x09, 0xFC, 0xFB, 0xF8,
+0x05, 0xF8, 0x06, 0x05, 0x06, 0xFC, 0x05, 0x06, 0xFB, 0xFF, 0xF8, 0xF9, 0x06, 0xFB, 0x0A, 0xF6,
+0x06, 0x04, 0xFC, 0x06, 0xFA, 0x07, 0x07, 0x05, 0xF8, 0x03, 0xFA, 0x05, 0x06, 0xFE, 0xF9, 0xFA,
+0x06, 0xFE, 0x06, 0x06, 0x05, 0xFA, 0x08, 0x09, 0xF6, 0xF6, 0xFB, 0xF6, 0x09, 0xFC, 0x05, 0xFB,
+0x05, 0x06, 0xF8, 0x05, 0xFA, 0x09, 0x0B, 0x09, 0xFC, 0x06, 0xFA, 0x08, 0x08, 0xFC, 0xFA, 0xF6,
+0x06, 0xFB, 0x05, 0x06, 0x04, 0xFB, 0x06, 0x08, 0xFB, 0xFA, 0xF5, 0xF9, 0x08, 0xFD, 0x05, 0xF9,
+0x04, 0x07, 0xF6, 0x06, 0xFC, 0x0A, 0x05, 0x0B, 0xFD, 0x06, 0xF8, 0x09, 0x06, 0xF9, 0xF7, 0xFB,
+0x04, 0xFA, 0x04, 0x04, 0x0D, 0xFA, 0x08, 0x07, 0xFA, 0x02, 0xFC, 0xFB, 0x0B, 0xFC, 0x08, 0xF5,
+0x05, 0x07, 0xF9, 0x04, 0xFA, 0x0B, 0x08, 0x07, 0xFC, 0x02, 0xF4, 0x08, 0x05, 0xF9, 0xFB, 0xF8,
+0x07, 0xFB, 0x04, 0x07, 0x07, 0xF6, 0x03, 0x05, 0xFB, 0xFC, 0xF8, 0xFB, 0x0B, 0xFA, 0x0C, 0xF8,
+0x07, 0x06, 0xFB, 0x01, 0xF5, 0x09, 0x0C, 0x03, 0xFD, 0x09, 0xFD, 0x05, 0x00, 0xF9, 0xF6, 0xFA,
+0x06, 0xFB, 0x07, 0x0A, 0x04, 0xFA, 0x08, 0x09, 0xFA, 0xFB, 0xF8, 0xFC, 0x07, 0xFC, 0x09, 0xF4,
+0x08, 0x0B, 0xF8, 0x09, 0xFD, 0x06, 0x06, 0x07, 0xF9, 0x05, 0xF6, 0x06, 0x07, 0xFD, 0xFE, 0xF8,
+0x01, 0xFA, 0x06, 0x09, 0x07, 0xF5, 0x0A, 0x04, 0xFF, 0x06, 0xFC, 0xF9, 0x0B, 0xFF, 0x08, 0xF6,
+0x04, 0x09, 0xF5, 0x0A, 0xFE, 0x06, 0x08, 0x08, 0x00, 0x02, 0xFA, 0x06, 0x08, 0xFE, 0xF7, 0xFD,
+0x03, 0xF7, 0x02, 0x08, 0x05, 0xFB, 0x03, 0x0C, 0xFB, 0x06, 0xF5, 0xF9, 0x07, 0xFD, 0x0C, 0xF7,
+0x09, 0x05, 0xF7, 0x06, 0xFC, 0x0B, 0x0C, 0x06, 0xFC, 0x05, 0xF8, 0x0A, 0x0A, 0x02, 0xFA, 0xFB,
+0x03, 0xF9, 0x07, 0x03, 0x09, 0xF7, 0x0A, 0x0A, 0xFB, 0x00, 0xFB, 0xF6, 0x04, 0xFC, 0x04, 0xF8,
+0x08, 0x03, 0xF9, 0x07, 0xFB, 0x06, 0x07, 0x07, 0xFA, 0x08, 0xFC, 0x06, 0x06, 0xFD, 0xFD, 0xF8,
+0x0A, 0xFA, 0x04, 0x06, 0x07, 0xFA, 0x05, 0x07, 0xFC, 0xF8, 0xFC, 0xFA, 0x0A, 0xFC, 0x03, 0xFE,
+0x06, 0x09, 0xF7, 0x09, 0xF7, 0x0A, 0x08, 0x06, 0xF9, 0x05, 0xFA, 0x03, 0x09, 0xFE, 0xFA, 0xFB,
+0x06, 0xFB, 0x07, 0x03, 0x0A, 0xF8, 0x07, 0x06, 0xFA, 0xFB, 0xF9, 0xF9, 0x06, 0xFC, 0x08, 0xFD,
+0x05, 0x0B, 0xF4, 0x05, 0xF9, 0x0A, 0x06, 0x0A, 0xFB, 0x01, 0xFA, 0x08, 0x06, 0x00, 0xFA, 0xF4,
+0x04, 0xFD, 0x05, 0x09, 0x0C, 0xFA, 0x0D, 0x03, 0xF8, 0x01, 0xF8, 0xF9, 0x08, 0xFB, 0x04, 0xF9,
+0x05, 0x0B, 0xF7, 0x03, 0xFD, 0x03, 0x07, 0x0F, 0x00, 0x02, 0xF6, 0x09, 0x07, 0x00, 0xFE, 0xF8,
+0x0A, 0xF3, 0x07, 0x07, 0x05, 0xF4, 0x08, 0x03, 0xF7, 0xFE, 0xFB, 0xFD, 0x01, 0xFB, 0x08, 0xF6,
+0x0B, 0x09, 0xFA, 0x05, 0xFA, 0x08, 0x07, 0x05, 0xFC, 0x04, 0xFD, 0x05, 0x0D, 0xFC, 0xFA, 0xF6,
+0x05, 0xF9, 0x0A, 0x08, 0x05, 0xF9, 0x02, 0x04, 0xFA, 0x04, 0xF4, 0xF9, 0x0C, 0xFD, 0x0D, 0xF5,
+0x05, 0x0B, 0xF9, 0x09, 0xFD, 0x02, 0x06, 0x0A, 0xFC, 0x01, 0xF6, 0x09, 0x08, 0xFD, 0xF9, 0xF8,
+0x04, 0xF5, 0x05, 0x09, 0x08, 0xFB, 0x03, 0x03, 0xFA, 0x02, 0xFD, 0xF7, 0x04, 0xFD, 0x0B, 0xFC,
+0x05, 0x06, 0xF9, 0x05, 0xFC, 0x09, 0x0A, 0x07, 0xF9, 0x05, 0xFB, 0x04, 0x06, 0x00, 0xFA, 0xF8,
+0x08, 0xF8, 0x04, 0x09, 0x0A, 0xF9, 0x0A, 0x06, 0xF9, 0xFE, 0xFA, 0xF5, 0x09, 0xFC, 0x05, 0xF9,
+0x08, 0x05, 0xFB, 0x09, 0xFB, 0x07, 0x06, 0x07, 0xFA, 0x08, 0xF8, 0x09, 0x02, 0xF9, 0xFC, 0xFA,
+0x05, 0xF8, 0x02, 0x06, 0x05, 0xFC, 0x08, 0x05, 0xFD, 0xF7, 0xFA, 0xF9, 0x07, 0xFD, 0x09, 0xFB,
+0x0A, 0x04, 0xF7, 0x01, 0xFE, 0x06, 0x09, 0x02, 0x01, 0x05, 0xF7, 0x09, 0x05, 0x02, 0xF4, 0xF8,
+0x08, 0xFD, 0x08, 0x0A, 0x09, 0xF4, 0x02, 0x08, 0xFA, 0x01, 0xF5, 0xF6, 0x0A, 0xFD, 0x0A, 0xF5,
+0x05, 0x0B, 0xFD, 0x09, 0xFE, 0x0A, 0x07, 0x08, 0xF8, 0x00, 0xFD, 0x03, 0x06, 0xFA, 0xF9, 0xF6,
+0x05, 0xF6, 0x02, 0x09, 0x08, 0xFE, 0x09, 0x05, 0xFA, 0xF7, 0xF5, 0xF9, 0x06, 0xFE, 0x08, 0xF6,
+0x0B, 0x03, 0xFA, 0x08, 0xFD, 0x04, 0x0D, 0x0A, 0xFA, 0x05, 0xF9, 0x06, 0x0B, 0xFA, 0xFD, 0xF6,
+0x09, 0xF6, 0x0A, 0x02, 0x07, 0xF7, 0x03, 0x07, 0x00, 0xFF, 0xFD, 0xFB, 0x0B, 0xFC, 0x08, 0xF7,
+0x07, 0x09, 0xFD, 0x06, 0xFB, 0x0A, 0x07, 0x09, 0xF6, 0x0A, 0xFB, 0x08, 0x07, 0xFE, 0xFD, 0xF6,
+0x03, 0xFC, 0x03, 0x02, 0x07, 0xF3, 0x09, 0x07, 0xF9, 0x01, 0xF7, 0xFA, 0x09, 0xFB, 0x04, 0xF6,
+0x04, 0x09, 0xFB, 0x0D, 0xFB, 0x0C, 0x06, 0x04, 0xFA, 0x02, 0xFB, 0x03, 0x03, 0xFC, 0xF6, 0xF4,
+0x05, 0xF7, 0x04, 0x05, 0x04, 0xF8, 0x06, 0x0B, 0xFB, 0xFD, 0xF8, 0xFB, 0x05, 0xFE, 0x0A, 0xF5,
+0x04, 0x04, 0xF1, 0x09, 0xF8, 0x05, 0x07, 0x0F, 0xFB, 0x00, 0xF9, 0x04, 0x05, 0xFD, 0xF3, 0xF7,
+0x08, 0xFB, 0x06, 0x08, 0x0A, 0xFD, 0x08, 0x0E, 0xFF, 0x04, 0xFA, 0xFA, 0x05, 0xFD, 0x05, 0xF9,
+0x04, 0x07, 0xFD, 0x06, 0xFD, 0x08, 0x08, 0x0B, 0xFC, 0x00, 0xF5, 0x02, 0x09, 0xFC, 0xFC, 0xF6,
+0x02, 0xF6, 0x0A, 0x0C, 0x0A, 0xF9, 0x04, 0x0C, 0xFB, 0xFF, 0xF7, 0xFB, 0x02, 0xFE, 0x0C, 0xFD,
+0x05, 0x04, 0xFB, 0x05, 0xF9, 0x0B, 0x0D, 0x0B, 0xFC, 0x01, 0xF9, 0x05, 0x07, 0x00, 0xF8, 0xFA,
+0x03, 0xFB, 0x07, 0x06, 0x09, 0xF9, 0x06, 0x09, 0xFA, 0x08, 0xF9, 0xF6, 0x0B, 0xFC, 0x0A, 0xF2,
+0x09, 0x07, 0xF7, 0x09, 0xFC, 0x03, 0x05, 0x06, 0xF7, 0x06, 0xFB, 0x06, 0x0C, 0x03, 0xFA, 0xF8,
+0x08, 0xFD, 0x06, 0x0B, 0x04, 0xFC, 0x06, 0x09, 0xF7, 0x03, 0xF4, 0xF4, 0x09, 0xFB, 0x06, 0xF6,
+0x0D, 0x05, 0xFE, 0x05, 0xFB, 0x07, 0x0C, 0x02, 0xFF, 0x01, 0xF5, 0x09, 0x0C, 0xFC, 0xF9, 0xFD,
+0x06, 0xFA, 0x0B, 0x0B, 0x08, 0xFC, 0x10, 0x0A, 0x03, 0x04, 0xFB, 0xF2, 0x0C, 0x01, 0x0A, 0xFC,
+0x05, 0x08, 0xFA, 0x07, 0xFC, 0x0A, 0x02, 0x03, 0xF5, 0x0A, 0xFA, 0x05, 0x02, 0xFB, 0xFD, 0xF7,
+0x08, 0xF7, 0x01, 0x02, 0x08, 0xFC, 0x00, 0xFF, 0xF4, 0xF3, 0xF7, 0xFD, 0x07, 0xF5, 0x06, 0xF3,
+0x09, 0x0F, 0xF3, 0x03, 0x02, 0x0D, 0x04, 0x0D, 0xFB, 0x04, 0xF3, 0x08, 0x0F, 0xFA, 0xF3, 0xF2,
+0x05, 0xF9, 0x09, 0x02, 0x0B, 0xF3, 0x00, 0x04, 0x01, 0x07, 0xFE, 0xFC, 0x03, 0xFB, 0x03, 0x00,
+0x06, 0x06, 0xFD, 0x0A, 0xFA, 0x09, 0x03, 0x07, 0xF9, 0x04, 0xF4, 0x05, 0x04, 0xF9, 0xFC, 0xF9,
+0x0A, 0xFB, 0x08, 0x08, 0x09, 0xFA, 0x09, 0x08, 0xFE, 0x00, 0xFE, 0xF5, 0x09, 0xF7, 0x07, 0xFF,
+0x0A, 0x02, 0xF7, 0x04, 0xFE, 0x08, 0x04, 0x08, 0xFF, 0x02, 0xF4, 0x08, 0x04, 0x00, 0xFA, 0xF8,
+0x00, 0xF3, 0x08, 0x07, 0x07, 0xF7, 0x0E, 0x05, 0xF8, 0x04, 0xFB, 0xF6, 0x05, 0xF6, 0x08, 0xF3,
+0x0A, 0x08, 0xF6, 0x0C, 0xFF, 0x09, 0x0E, 0x0B, 0xF9, 0xFA, 0xFB, 0x04, 0x09, 0x02, 0xF9, 0xF8,
+0x03, 0xF4, 0x06, 0x06, 0x07, 0xFC, 0x09, 0x0B, 0xFF, 0x07, 0xF9, 0xFB, 0x06, 0xFC, 0x07, 0xF1,
+0x08, 0x07, 0xF9, 0x06, 0xFA, 0x07, 0x07, 0x08, 0xFD, 0x00, 0xF4, 0x03, 0x04, 0xFC, 0xF9, 0xF7,
+0x03, 0xF9, 0x08, 0x04, 0x09, 0xFA, 0x0B, 0x06, 0xFA, 0x02, 0xF9, 0xF9, 0x06, 0xFC, 0x08, 0xFB,
+0x04, 0x05, 0xF8, 0x06, 0xFD, 0x07, 0x0B, 0x07, 0xFD, 0x02, 0xFB, 0x07, 0x04, 0x00, 0xF5, 0xFB,
+0x08, 0xFC, 0x06, 0x07, 0x05, 0xF8, 0x04, 0x08, 0xF9, 0xFD, 0xFB, 0xF7, 0x05, 0xFC, 0x03, 0xFB,
+0x04, 0x0A, 0xFD, 0x0B, 0xFF, 0x04, 0x0A, 0x06, 0xFD, 0x01, 0xF5, 0x02, 0x02, 0x00, 0xFD, 0xFA,
+0x07, 0xF8, 0x08, 0x08, 0x0C, 0xF8, 0x07, 0x0A, 0xFA, 0x00, 0xFA, 0xF9, 0x02, 0xFD, 0x03, 0xF8,
+0x02, 0x05, 0xFD, 0x05, 0xF9, 0x0B, 0x04, 0x03, 0xFC, 0x04, 0xF4, 0x09, 0x05, 0xFA, 0xF3, 0xFA,
+0x06, 0xF7, 0x00, 0x0B, 0x05, 0xFD, 0x02, 0x09, 0xFC, 0x00, 0xFC, 0xFA, 0x09, 0xFD, 0x0D, 0xFB,
+0x04, 0x05, 0xF8, 0x02, 0xF7, 0x05, 0x09, 0x07, 0xFA, 0x07, 0xF8, 0x0A, 0x0A, 0xFF, 0xF9, 0xFD,
+0x02, 0xF4, 0x07, 0x09, 0x08, 0xFE, 0x04, 0x09, 0xF7, 0x05, 0xFA, 0xFB, 0x09, 0xFD, 0x05, 0xF9,
+0x04, 0x05, 0xFA, 0x05, 0xFC, 0x07, 0x08, 0x0A, 0xFA, 0x05, 0xFC, 0x08, 0x07, 0x00, 0xF9, 0xF8,
+0x08, 0xF6, 0x04, 0x04, 0x07, 0xF8, 0x05, 0x03, 0xFA, 0x01, 0xFC, 0xF8, 0x07, 0xFE, 0x09, 0xFC,
+0x06, 0x04, 0xFD, 0x05, 0xF9, 0x05, 0x04, 0x05, 0xFA, 0x03, 0xF8, 0x03, 0x0B, 0xFD, 0xF5, 0xF9,
+0x04, 0xFC, 0x04, 0x0B, 0x04, 0xFA, 0x02, 0x05, 0xFB, 0xFB, 0xFB, 0xFA, 0x0A, 0xFC, 0x06, 0xF9,
+0x07, 0x05, 0xF9, 0x06, 0xFB, 0x05, 0x07, 0x04, 0xFA, 0x06, 0xFB, 0x06, 0x06, 0xFB, 0xFA, 0xFB,
+0x07, 0xFA, 0x05, 0x06, 0x08, 0xFA, 0x07, 0x08, 0xF8, 0xF9, 0xFC, 0xF9, 0x05, 0xFD, 0x05, 0xFB,
+0x0B, 0x0A, 0xEF, 0x0C, 0xF9, 0x0F, 0x0B, 0x10, 0xF6, 0x04, 0xF0, 0x0B, 0x0A, 0xF9, 0xF5, 0xEE,
+0x09, 0xF7, 0x0A, 0x0C, 0x0A, 0xF1, 0x08, 0x0E, 0xF9, 0xF9, 0xF2, 0xF4, 0x09, 0xF8, 0x0E, 0xF0,
+0x0D, 0x15, 0xF3, 0x0F, 0xF6, 0x0C, 0x0C, 0x0D, 0xF6, 0x0A, 0xF2, 0x05, 0x0C, 0xFA, 0xF5, 0xF0,
+0x0E, 0xF2, 0x08, 0x0C, 0x0C, 0xF1, 0x0D, 0x0A, 0xF9, 0x00, 0xF3, 0xF0, 0x13, 0xF2, 0x0F, 0xED,
+0x09, 0x0C, 0xF2, 0x10, 0xF3, 0x0F, 0x0E, 0x0B, 0xFB, 0x09, 0xF2, 0x05, 0x10, 0xFA, 0xF4, 0xF4,
+0x0B, 0xF6, 0x07, 0x0D, 0x0B, 0xF2, 0x0C, 0x11, 0xFA, 0xFB, 0xF0, 0xF7, 0x0C, 0xF5, 0x0E, 0xF6,
+0x0E, 0x0E, 0xF0, 0x0E, 0xF7, 0x0F, 0x10, 0x0E, 0xF6, 0x08, 0xF2, 0x09, 0x0D, 0xF9, 0xF2, 0xF2,
+0x0B, 0xF0, 0x09, 0x0B, 0x0A, 0xF5, 0x0D, 0x0A, 0xF7, 0xF8, 0xF1, 0xF6, 0x0D, 0xF6, 0x0D, 0xF5,
+0x0C, 0x10, 0xEF, 0x0C, 0xF6, 0x0B, 0x0D, 0x10, 0xF6, 0x05, 0xF3, 0x09, 0x0F, 0xFA, 0xF5, 0xF1,
+0x09, 0xF3, 0x0A, 0x07, 0x0C, 0xF1, 0x0E, 0x0B, 0xF5, 0xFA, 0xF3, 0xF2, 0x0E, 0xF3, 0x0E, 0xF2,
+0x0B, 0x11, 0xEE, 0x10, 0xF9, 0x0C, 0x13, 0x09, 0xFC, 0x08, 0xF0, 0x09, 0x13, 0xFB, 0xF2, 0xF0,
+0x0B, 0xEF, 0x08, 0x06, 0x09, 0xF3, 0x0C, 0x0B, 0xFC, 0xFD, 0xF4, 0xF6, 0x0C, 0xF6, 0x08, 0xED,
+0x08, 0x11, 0xEF, 0x13, 0xF7, 0x0D, 0x09, 0x13, 0xF5, 0x06, 0xF2, 0x04, 0x13, 0xFB, 0xF2, 0xF6,
+0x0E, 0xF1, 0x10, 0x0C, 0x09, 0xF3, 0x0C, 0x0B, 0xFE, 0xF9, 0xEF, 0xED, 0x12, 0xF6, 0x0E, 0xF2,
+0x0C, 0x14, 0xF2, 0x10, 0xF9, 0x07, 0x0A, 0x09, 0xF6, 0x08, 0xF3, 0x08, 0x13, 0xFE, 0xF1, 0xEF,
+0x05, 0xF2, 0x0F, 0x0B, 0x0B, 0xED, 0x08, 0x14, 0xFA, 0xFC, 0xF5, 0xF6, 0x0C, 0xF7, 0x0C, 0xF7,
+0x0C, 0x0E, 0xF2, 0x0C, 0xF5, 0x0E, 0x0C, 0x0F, 0xF3, 0x0C, 0xF1, 0x0C, 0x0B, 0xF9, 0xF3, 0xF7,
+0x0E, 0xF2, 0x11, 0x09, 0x0F, 0xF8, 0x0B, 0x0A, 0xF6, 0xF8, 0xF5, 0xF5, 0x0E, 0xFB, 0x0E, 0xFA,
+0x0B, 0x0B, 0xF4, 0x0B, 0xF6, 0x0C, 0x0C, 0x0D, 0xF7, 0x09, 0xF5, 0x0C, 0x0B, 0xF6, 0xF3, 0xF5,
+0x0D, 0xF2, 0x0B, 0x0A, 0x0E, 0xF5, 0x0F, 0x0B, 0xF6, 0xF3, 0xF5, 0xF6, 0x0E, 0xFA, 0x0D, 0xF9,
+0x0A, 0x0B, 0xF6, 0x09, 0xF6, 0x09, 0x0C, 0x0B, 0xF4, 0x0A, 0xF8, 0x0C, 0x0A, 0xF4, 0xF3, 0xF8,
+0x0B, 0xF5, 0x0C, 0x0C, 0x0A, 0xF6, 0x0B, 0x0A, 0xF4, 0xEC, 0xF6, 0xF6, 0x0D, 0xF9, 0x0C, 0xFB,
+0x0C, 0x0A, 0xF5, 0x0D, 0xF5, 0x0C, 0x0D, 0x0E, 0xF6, 0x0C, 0xF5, 0x0A, 0x0C, 0xF9, 0xF0, 0xF6,
+0x0A, 0xF4, 0x0E, 0x0D, 0x0C, 0xF4, 0x0C, 0x0D, 0xF7, 0xF3, 0xF6, 0xF6, 0x0D, 0xF5, 0x0D, 0xF5,
+0x0B, 0x0C, 0xF4, 0x0C, 0xF5, 0x0B, 0x0B, 0x0B, 0xF6, 0x0B, 0xF2, 0x09, 0x0D, 0xF7, 0xF3, 0xF5,
+0x09, 0xF6, 0x0B, 0x0F, 0x0D, 0xF4, 0x0C, 0x0D, 0xF4, 0xF4, 0xF5, 0xF5, 0x0D, 0xF7, 0x0E, 0xF8,
+0x0C, 0x0C, 0xF5, 0x0C, 0xF3, 0x0B, 0x0C, 0x0B, 0xF6, 0x0B, 0xF4, 0x0C, 0x0B, 0xF4, 0xF7, 0xF5,
+0x09, 0xF5, 0x0B, 0x0B, 0x0A, 0xF5, 0x0A, 0x0C, 0xF4, 0xF5, 0xF7, 0xF5, 0x0C, 0xF8, 0x09, 0xFA,
+0x0C, 0x0D, 0xF4, 0x10, 0xF4, 0x0A, 0x0E, 0x10, 0xF7, 0x0A, 0xF5, 0x0C, 0x0D, 0xFB, 0xF5, 0xF6,
+0x0A, 0xF5, 0x09, 0x0C, 0x0D, 0xF5, 0x0E, 0x0C, 0xF7, 0xF6, 0xF4, 0xF6, 0x0E, 0xFB, 0x0C, 0xF8,
+0x0A, 0x0C, 0xEF, 0x08, 0xF3, 0x0C, 0x11, 0x0E, 0xF6, 0x06, 0xF0, 0x0B, 0x0E, 0xF7, 0xEF, 0xF4,
+0x0E, 0xF4, 0x0E, 0x0A, 0x0F, 0xF7, 0x09, 0x0C, 0xF3, 0xFF, 0xF6, 0xF2, 0x0B, 0xF7, 0x0C, 0xF4,
+0x0C, 0x0C, 0xF5, 0x0C, 0xF4, 0x0D, 0x0F, 0x0E, 0xF0, 0x08, 0xF3, 0x09, 0x0E, 0xFB, 0xF3, 0xF5,
+0x0B, 0xF3, 0x0A, 0x0E, 0x0F, 0xF8, 0x10, 0x0F, 0xF8, 0xFF, 0xF0, 0xF2, 0x0A, 0xF7, 0x0A, 0xF5,
+0x0A, 0x0C, 0xF3, 0x0C, 0xF5, 0x0B, 0x0D, 0x0C, 0xF7, 0x0B, 0xF6, 0x0D, 0x0A, 0xF4, 0xF4, 0xF7,
+0x0B, 0xF5, 0x0B, 0x0C, 0x0C, 0xF7, 0x0B, 0x09, 0xF6, 0xEE, 0xF5, 0xF7, 0x0A, 0xFB, 0x0B, 0xF9,
+0x0A, 0x0E, 0xF3, 0x09, 0xF5, 0x0B, 0x0D, 0x0F, 0xF5, 0x0C, 0xF5, 0x0B, 0x0B, 0xF6, 0xF5, 0xF5,
+0x0C, 0xF4, 0x0C, 0x0C, 0x0C, 0xF4, 0x0A, 0x08, 0xF6, 0xEF, 0xF5, 0xF6, 0x0E, 0xFB, 0x0B, 0xFD,
+0x0A, 0x0B, 0xF6, 0x0C, 0xF5, 0x0B, 0x0B, 0x0C, 0xF6, 0x0C, 0xF6, 0x0B, 0x0C, 0xF5, 0xF5, 0xF5,
+0x0B, 0xF4, 0x0B, 0x0C, 0x0A, 0xF7, 0x0D, 0x0B, 0xF5, 0xEF, 0xF5, 0xF7, 0x0D, 0xFB, 0x0D, 0xF9,
+0x0A, 0x0C, 0xF5, 0x0C, 0xF5, 0x0B, 0x0B, 0x0A, 0xF7, 0x0C, 0xF5, 0x0C, 0x0C, 0xF6, 0xF5, 0xF5,
+0x0A, 0xF3, 0x0A, 0x0C, 0x0D, 0xF6, 0x0B, 0x0B, 0xF5, 0xEF, 0xF5, 0xF7, 0x0F, 0xFA, 0x0E, 0xFB,
+0x0C, 0x0B, 0xF6, 0x0C, 0xF4, 0x0B, 0x0A, 0x0B, 0xF4, 0x0C, 0xF5, 0x0A, 0x0C, 0xF1, 0xF8, 0xF6,
+0x09, 0xF5, 0x0C, 0x0C, 0x0B, 0xF7, 0x0D, 0x0C, 0xF5, 0xEC, 0xF6, 0xF5, 0x0F, 0xFB, 0x0B, 0xFC,
+0x08, 0x0C, 0xF3, 0x0E, 0xF5, 0x0C, 0x0C, 0x0D, 0xF7, 0x08, 0xF5, 0x0B, 0x0B, 0xF8, 0xF4, 0xF5,
+0x09, 0xF5, 0x0A, 0x0C, 0x0B, 0xF4, 0x0B, 0x0F, 0xF7, 0xF3, 0xF7, 0xF8, 0x0E, 0xFB, 0x0C, 0xF9,
+0x09, 0x0B, 0xF2, 0x0E, 0xF5, 0x0B, 0x13, 0x08, 0xF5, 0x0E, 0xEF, 0x0A, 0x0F, 0xF9, 0xF6, 0xF3,
+0x0B, 0xF4, 0x0B, 0x0B, 0x0A, 0xF5, 0x0C, 0x12, 0xF7, 0xF7, 0xF7, 0xF6, 0x0D, 0xFB, 0x0D, 0xF8,
+0x0B, 0x0B, 0xF5, 0x0C, 0xF5, 0x0A, 0x07, 0x0A, 0xF4, 0x0C, 0xF5, 0x0C, 0x0C, 0xF4, 0xF3, 0xF5,
+0x0B, 0xF5, 0x0C, 0x0D, 0x0B, 0xF6, 0x0E, 0x0C, 0xF5, 0xEF, 0xF6, 0xF6, 0x0E, 0xFB, 0x0B, 0xFA,
+0x0A, 0x0B, 0xF3, 0x0D, 0xF5, 0x0B, 0x0C, 0x0E, 0xF4, 0x09, 0xF3, 0x0C, 0x0C, 0xF6, 0xF6, 0xF7,
+0x0A, 0xF5, 0x0A, 0x0C, 0x0D, 0xF4, 0x0B, 0x0C, 0xF6, 0xF5, 0xF5, 0xF7, 0x0B, 0xF8, 0x0C, 0xF6,
+0x0A, 0x0B, 0xF6, 0x0C, 0xF5, 0x0B, 0x0B, 0x0B, 0xF4, 0x0C, 0xF6, 0x0C, 0x0D, 0xF5, 0xF4, 0xF6,
+0x0B, 0xF4, 0x0C, 0x0C, 0x0A, 0xF6, 0x0B, 0x0E, 0xF4, 0xED, 0xF6, 0xF6, 0x0A, 0xFB, 0x0A, 0xFA,
+0x0A, 0x0B, 0xF4, 0x0C, 0xF6, 0x0B, 0x0D, 0x0C, 0xF5, 0x09, 0xF3, 0x0C, 0x0D, 0xF7, 0xF3, 0xF6,
+0x0B, 0xF5, 0x0D, 0x0B, 0x0B, 0xF5, 0x0C, 0x0C, 0xF7, 0xF0, 0xF5, 0xF6, 0x0D, 0xF9, 0x0B, 0xF8,
+0x0C, 0x0C, 0xF7, 0x0C, 0xF5, 0x0B, 0x0F, 0x0C, 0xF7, 0x09, 0xF3, 0x0A, 0x0B, 0xF7, 0xF5, 0xF6,
+0x0C, 0xF5, 0x0C, 0x0C, 0x0B, 0xF3, 0x0B, 0x0E, 0xF4, 0xF1, 0xF4, 0xF5, 0x0D, 0xFA, 0x0D, 0xF9,
+0x0B, 0x0B, 0xF7, 0x0A, 0xF5, 0x0A, 0x0D, 0x0D, 0xF5, 0x0B, 0xF6, 0x0D, 0x0B, 0xF5, 0xF5, 0xF5,
+0x0C, 0xF4, 0x0C, 0x0C, 0x0B, 0xF5, 0x0C, 0x0A, 0xF6, 0xEA, 0xF4, 0xF5, 0x0C, 0xFB, 0x0A, 0xFD,
+0x0C, 0x0E, 0xF8, 0x0C, 0xF8, 0x0C, 0x0A, 0x0C, 0xF5, 0x06, 0xF5, 0x08, 0x0C, 0xF3, 0xF5, 0xF4,
+0x0B, 0xF3, 0x09, 0x0B, 0x10, 0xF7, 0x0A, 0x0A, 0xF4, 0xF1, 0xF4, 0xF3, 0x0C, 0xF8, 0x09, 0xF3,
+0x0C, 0x0C, 0xF4, 0x0C, 0xF5, 0x0C, 0x10, 0x0F, 0xF6, 0x08, 0xF5, 0x0A, 0x0C, 0xF9, 0xF5, 0xF4,
+0x0A, 0xF5, 0x0C, 0x0D, 0x0B, 0xF2, 0x0C, 0x0D, 0xF7, 0xFC, 0xF5, 0xF3, 0x0C, 0xFB, 0x0E, 0xF7,
+0x0A, 0x0F, 0xF5, 0x0D, 0xF6, 0x0E, 0x0B, 0x0C, 0xFA, 0x0A, 0xF1, 0x0A, 0x0C, 0xF9, 0xF6, 0xF4,
+0x0A, 0xF3, 0x0C, 0x0D, 0x0A, 0xF3, 0x0D, 0x0F, 0xF8, 0xF9, 0xF3, 0xF5, 0x11, 0xFA, 0x0C, 0xF6,
+0x0A, 0x0D, 0xF5, 0x0C, 0xF6, 0x0A, 0x0A, 0x0E, 0xF4, 0x09, 0xF7, 0x0D, 0x0D, 0xF6, 0xF5, 0xF6,
+0x0A, 0xF5, 0x0A, 0x0B, 0x0A, 0xF5, 0x0D, 0x0A, 0xF6, 0xF0, 0xF6, 0xF5, 0x0B, 0xFC, 0x0C, 0xFA,
+0x0A, 0x0B, 0xF6, 0x0C, 0xF5, 0x0B, 0x0D, 0x0C, 0xF4, 0x0D, 0xF6, 0x0D, 0x0B, 0xF5, 0xF5, 0xF7,
+0x0C, 0xF5, 0x0C, 0x0C, 0x0B, 0xF3, 0x09, 0x0B, 0xF5, 0xEA, 0xF5, 0xF7, 0x0C, 0xFB, 0x0B, 0xFB,
+0x0A, 0x0A, 0xF5, 0x0E, 0xF5, 0x0B, 0x0B, 0x0C, 0xF4, 0x09, 0xF6, 0x0A, 0x0B, 0xF6, 0xF4, 0xF4,
+0x0B, 0xF5, 0x0B, 0x0C, 0x0B, 0xF5, 0x0D, 0x0B, 0xF5, 0xEF, 0xF4, 0xF6, 0x0D, 0xFA, 0x0D, 0xF9,
+0x0A, 0x0B, 0xF5, 0x0C, 0xF6, 0x0B, 0x0B, 0x0C, 0xF6, 0x0B, 0xF5, 0x0E, 0x0B, 0xF7, 0xF4, 0xF7,
+0x0B, 0xF4, 0x0A, 0x0C, 0x0B, 0xF4, 0x0C, 0x0B, 0xF5, 0xEE, 0xF6, 0xF6, 0x0E, 0xFB, 0x0B, 0xFB,
+0x0A, 0x0C, 0xF5, 0x0D, 0xF6, 0x0B, 0x0B, 0x0D, 0xF5, 0x09, 0xF6, 0x0D, 0x0B, 0xF7, 0xF4, 0xF4,
+0x0C, 0xF3, 0x0D, 0x0B, 0x0B, 0xF6, 0x0E, 0x0C, 0xF4, 0xF4, 0xF5, 0xF6, 0x0C, 0xFA, 0x0C, 0xF7,
+0x0B, 0x0C, 0xF4, 0x0D, 0xF5, 0x0D, 0x0C, 0x11, 0xF6, 0x07, 0xF4, 0x09, 0x0F, 0xFA, 0xF2, 0xF5,
+0x0A, 0xF6, 0x0E, 0x0B, 0x0B, 0xF4, 0x08, 0x0D, 0xF8, 0x01, 0xF2, 0xF5, 0x0D, 0xFA, 0x0E, 0xF7,
+0x0C, 0x0F, 0xF4, 0x0C, 0xF5, 0x0E, 0x0F, 0x0D, 0xF7, 0x0A, 0xF3, 0x08, 0x0C, 0xF9, 0xF5, 0xF3,
+0x0C, 0xF3, 0x0C, 0x0D, 0x0C, 0xF7, 0x0F, 0x0B, 0xF5, 0xF9, 0xF3, 0xF5, 0x0C, 0xF9, 0x0D, 0xF8,
+0x0A, 0x0C, 0xF4, 0x0C, 0xF4, 0x0B, 0x0B, 0x0D, 0xF6, 0x0A, 0xF5, 0x0C, 0x0A, 0xF6, 0xF5, 0xF6,
+0x09, 0xF4, 0x0B, 0x0D, 0x0C, 0xF6, 0x0E, 0x0D, 0xF6, 0xEF, 0xF5, 0xF6, 0x0C, 0xFB, 0x0D, 0xF7,
+0x0A, 0x0C, 0xF4, 0x0C, 0xF6, 0x0B, 0x0D, 0x0D, 0xF6, 0x0A, 0xF4, 0x0A, 0x0B, 0xF8, 0xF2, 0xF4,
+0x0A, 0xF5, 0x0A, 0x0C, 0x0C, 0xF2, 0x0C, 0x0E, 0xF7, 0xEF, 0xF4, 0xF7, 0x0B, 0xFC, 0x0B, 0xF9,
+0x0C, 0x0B, 0xF6, 0x0B, 0xF4, 0x0C, 0x0B, 0x0B, 0xF5, 0x0D, 0xF4, 0x0C, 0x0B, 0xF5, 0xF4, 0xF6,
+0x0C, 0xF7, 0x0B, 0x0C, 0x0B, 0xF6, 0x0D, 0x0E, 0xF4, 0xEB, 0xF7, 0xF4, 0x0D, 0xFB, 0x0C, 0xF9,
+0x08, 0x0A, 0xF4, 0x0C, 0xF4, 0x0B, 0x09, 0x0A, 0xF5, 0x0C, 0xF6, 0x0A, 0x0B, 0xED, 0xF5, 0xF6,
+0x0C, 0xF4, 0x0A, 0x0C, 0x09, 0xF6, 0x0C, 0x0D, 0xF5, 0xEA, 0xF6, 0xF6, 0x0E, 0xFA, 0x0A, 0xF8,
+0x0B, 0x0E, 0xF3, 0x0C, 0xF4, 0x0C, 0x0B, 0x0C, 0xF6, 0x09, 0xF6, 0x0C, 0x0C, 0xF5, 0xF4, 0xF6,
+0x0A, 0xF4, 0x0B, 0x0C, 0x0C, 0xF7, 0x0D, 0x0B, 0xF5, 0xEE, 0xF3, 0xF6, 0x0D, 0xFB, 0x0A, 0xF9,
+0x0D, 0x0C, 0xF4, 0x0A, 0xF4, 0x0D, 0x0D, 0x0D, 0xF8, 0x09, 0xF1, 0x09, 0x0F, 0xF8, 0xF2, 0xF4,
+0x09, 0xF2, 0x0A, 0x0D, 0x0A, 0xF5, 0x0D, 0x10, 0xF8, 0xF9, 0xF6, 0xF5, 0x0C, 0xFA, 0x0E, 0xF2,
+0x0B, 0x0C, 0xF2, 0x0A, 0xF5, 0x0C, 0x0C, 0x0B, 0xF4, 0x09, 0xF5, 0x0B, 0x0F, 0xF9, 0xF7, 0xF5,
+0x0C, 0xF2, 0x0A, 0x0B, 0x09, 0xF5, 0x0B, 0x0C, 0xF6, 0xF6, 0xF3, 0xF3, 0x10, 0xFA, 0x0B, 0xF5,
+0x0C, 0x09, 0xF4, 0x0A, 0xF7, 0x0C, 0x07, 0x0F, 0xF6, 0x09, 0xF6, 0x0A, 0x0A, 0xF6, 0xF3, 0xF0,
+0x0C, 0xF7, 0x0D, 0x08, 0x0D, 0xF1, 0x0A, 0x11, 0xF9, 0xF7, 0xF1, 0xF1, 0x0D, 0xF8, 0x0B, 0xF2,
+0x0C, 0x0C, 0xF8, 0x0C, 0xF5, 0x0B, 0x0F, 0x0E, 0xF7, 0x09, 0xF3, 0x04, 0x0A, 0xFB, 0xF2, 0xF5,
+0x0A, 0xF2, 0x0F, 0x0B, 0x0F, 0xF6, 0x10, 0x10, 0xF5, 0xFF, 0xF5, 0xF6, 0x0C, 0xF3, 0x09, 0xF0,
+0x0B, 0x0E, 0xF1, 0x09, 0xF7, 0x10, 0x0D, 0x0C, 0xFA, 0x0B, 0xF1, 0x07, 0x09, 0xFC, 0xF5, 0xF4,
+0x0E, 0xF3, 0x0C, 0x08, 0x0B, 0xEF, 0x10, 0x0B, 0xF4, 0xFB, 0xF4, 0xF8, 0x10, 0xF9, 0x08, 0xF3,
+0x0A, 0x10, 0xF2, 0x0D, 0xF7, 0x0B, 0x10, 0x0B, 0xF7, 0x10, 0xF6, 0x04, 0x10, 0x01, 0xF2, 0xEF,
+0x0C, 0xF6, 0x09, 0x0E, 0x0C, 0xF0, 0x0E, 0x0A, 0xF4, 0xFC, 0xF5, 0xF6, 0x09, 0xF4, 0x0A, 0xF1,
+0x10, 0x13, 0xF0, 0x09, 0xF9, 0x0B, 0x0E, 0x0D, 0xF7, 0x07, 0xF3, 0x07, 0x0E, 0xFD, 0xF7, 0xF7,
+0x0D, 0xF1, 0x0F, 0x05, 0x0E, 0xF8, 0x0D, 0x0A, 0xF5, 0xF8, 0xF1, 0xF7, 0x0F, 0xF4, 0x0D, 0xF9,
+0x0B, 0x09, 0xF8, 0x12, 0xF5, 0x0C, 0x0B, 0x10, 0xF7, 0x0C, 0xF7, 0x0B, 0x08, 0xF7, 0xF7, 0xF9,
+0x08, 0xF8, 0x0F, 0x09, 0x10, 0xF8, 0x11, 0x0B, 0xFB, 0xEF, 0xEE, 0xF3, 0x11, 0xF9, 0x13, 0xF3,
+0x0A, 0x06, 0xF6, 0x0A, 0xF7, 0x0B, 0x0A, 0x09, 0xF0, 0x12, 0xED, 0x08, 0x11, 0xF4, 0xF1, 0xEE,
+0x0F, 0xEE, 0x09, 0x0A, 0x0C, 0xF6, 0x11, 0x07, 0xEF, 0xF9, 0xF7, 0xFA, 0x06, 0xF9, 0x0A, 0xF8,
+0x0A, 0x07, 0xEE, 0x12, 0xF3, 0x0D, 0x0E, 0x0E, 0xFA, 0x07, 0xF7, 0x05, 0x0F, 0xFD, 0xF0, 0xF3,
+0x0D, 0xF6, 0x0F, 0x0F, 0x09, 0xF8, 0x0D, 0x0E, 0xF8, 0x03, 0xF4, 0xF4, 0x0A, 0xF6, 0x11, 0xF1,
+0x0E, 0x0E, 0xEF, 0x11, 0xF0, 0x0D, 0x0D, 0x0C, 0xFE, 0x04, 0xF8, 0x05, 0x07, 0xF8, 0xF6, 0xF2,
+0x07, 0xF1, 0x0C, 0x10, 0x0E, 0xEE, 0x13, 0x09, 0xF3, 0x04, 0xF7, 0xF3, 0x0E, 0xF4, 0x11, 0xFA,
+0x0A, 0x0A, 0xF6, 0x0A, 0xF5, 0x0A, 0x0C, 0x0B, 0xF6, 0x0A, 0xF5, 0x0B, 0x0A, 0xF6, 0xF6, 0xF7,
+0x0C, 0xF5, 0x0C, 0x0B, 0x0B, 0xF7, 0x0C, 0x0C, 0xF5, 0xED, 0xF6, 0xF6, 0x0C, 0xFB, 0x0A, 0xF9,
+0x0B, 0x0B, 0xF5, 0x0C, 0xF5, 0x09, 0x0A, 0x0A, 0xF6, 0x0B, 0xF6, 0x0C, 0x0A, 0xF6, 0xF4, 0xF5,
+0x0C, 0xF6, 0x0C, 0x0C, 0x0A, 0xF6, 0x0D, 0x0A, 0xF5, 0xEE, 0xF6, 0xF6, 0x0D, 0xFE, 0x0C, 0xFC,
+0x0B, 0x0B, 0xF7, 0x09, 0xF6, 0x0A, 0x0A, 0x0B, 0xF6, 0x0C, 0xF7, 0x0C, 0x09, 0xF4, 0xF5, 0xF7,
+0x0B, 0xF6, 0x0C, 0x0C, 0x0B, 0xF7, 0x0A, 0x0A, 0xF4, 0xEA, 0xF5, 0xF7, 0x0B, 0xFC, 0x0B, 0xFE,
+0x0A, 0x0A, 0xF5, 0x0C, 0xF5, 0x09, 0x0D, 0x0B, 0xF5, 0x0A, 0xF5, 0x0B, 0x0A, 0xF3, 0xF5, 0xF5,
+0x0B, 0xF6, 0x0B, 0x0A, 0x0A, 0xF3, 0x0C, 0x0B, 0xF4, 0xEF, 0xF5, 0xF5, 0x0F, 0xFB, 0x0B, 0xFA,
+0x0B, 0x0D, 0xF6, 0x0C, 0xF4, 0x0A, 0x0B, 0x0A, 0xF6, 0x0C, 0xF7, 0x09, 0x0A, 0xF3, 0xF3, 0xF5,
+0x0A, 0xF7, 0x0B, 0x0D, 0x09, 0xF9, 0x08, 0x0C, 0xF4, 0xEE, 0xF6, 0xF6, 0x0D, 0xF8, 0x0A, 0xF4,
+0x0B, 0x0C, 0xF8, 0x09, 0xF5, 0x0D, 0x0D, 0x0D, 0xF5, 0x0B, 0xF6, 0x0B, 0x0D, 0xF8, 0xF9, 0xF7,
+0x09, 0xF4, 0x0A, 0x0B, 0x0D, 0xF7, 0x0D, 0x09, 0xF4, 0xF2, 0xF6, 0xF8, 0x0B, 0x01, 0x0C, 0xF8,
+0x0C, 0x0A, 0xF5, 0x0C, 0xF4, 0x0B, 0x0E, 0x0B, 0xF7, 0x0D, 0xF6, 0x0A, 0x0B, 0xF7, 0xF4, 0xF5,
+0x09, 0xF2, 0x0C, 0x0D, 0x0A, 0xF6, 0x0D, 0x0F, 0xF5, 0xFA, 0xF4, 0xF4, 0x0A, 0xFE, 0x09, 0xF9,
+0x0B, 0x0B, 0xF7, 0x0A, 0xF5, 0x0B, 0x0C, 0x0A, 0xF3, 0x0B, 0xF5, 0x0A, 0x0A, 0xF7, 0xF3, 0xF7,
+0x0B, 0xF5, 0x0C, 0x0B, 0x0A, 0xF7, 0x0A, 0x0A, 0xF2, 0xED, 0xF8, 0xF6, 0x0D, 0xFA, 0x09, 0xFA,
+0xFF, 0xFF, 0xFE, 0x01, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0xFF, 0x01, 0x01, 0x00, 0x03, 0xFF, 0x01, 0x00, 0xFE, 0xF7, 0x00, 0x01, 0x00, 0x03, 0x02, 0xFF,
+0x01, 0x02, 0xFF, 0x03, 0x00, 0x01, 0x02, 0x03, 0x00, 0xFD, 0xFF, 0x01, 0x03, 0xFF, 0xFE, 0xFE,
+0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x02, 0x03, 0x00, 0xF9, 0xFF, 0x00, 0x00, 0x05, 0x01, 0xFF,
+0x01, 0x01, 0xFE, 0x03, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xF9, 0xFF, 0x02, 0x01, 0xFE, 0x02,
+0x02, 0x00, 0x02, 0x01, 0x00, 0x03, 0x03, 0x03, 0xFE, 0xF9, 0xFF, 0xFE, 0x01, 0x06, 0xFF, 0x02,
+0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x02, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x02,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x04, 0xFE, 0xFA, 0x01, 0x01, 0xFD, 0x04, 0x00, 0x03,
+0x01, 0xFE, 0x02, 0x01, 0xFF, 0x00, 0x03, 0x01, 0xFE, 0x01, 0xFF, 0x03, 0x01, 0xFE, 0x00, 0x00,
+0xFF, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0xFD, 0xF7, 0x01, 0xFF, 0xFF, 0x03, 0x01, 0x03,
+0x01, 0xFF, 0xFF, 0x02, 0xFF, 0x02, 0x03, 0x02, 0x01, 0x00, 0xFF, 0x03, 0x01, 0xFF, 0x00, 0x01,
+0x00, 0x00, 0x01, 0x03, 0x02, 0x00, 0x02, 0x03, 0xFF, 0xF8, 0xFF, 0x01, 0x01, 0x06, 0x03, 0x02,
+0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0xFF, 0xFE, 0x03, 0x03, 0x00, 0xFF, 0xFE,
+0x00, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0xFC, 0xFE, 0x01, 0x00, 0x05, 0x01, 0x02,
+0xFF, 0x03, 0xFF, 0x00, 0x02, 0x02, 0x01, 0xFE, 0x01, 0xFE, 0xFD, 0xFE, 0x00, 0x00, 0x02, 0xFF,
+0x00, 0xFD, 0xFF, 0xFE, 0x02, 0x01, 0x01, 0x02, 0xFF, 0xFB, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x02,
+0xFF, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0x01, 0xFF, 0x00, 0xFF,
+0xFF, 0x00, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x03, 0x02, 0xFE, 0xFE, 0xFF, 0xFE, 0x05, 0x00, 0x01,
+0x00, 0xFF, 0x00, 0x02, 0x02, 0x03, 0x00, 0x02, 0x00, 0x00, 0x03, 0x02, 0x02, 0xFD, 0x00, 0x00,
+0xFF, 0x00, 0xFF, 0x02, 0x00, 0xFF, 0x02, 0x01, 0x00, 0xFE, 0xFE, 0xFF, 0xFF, 0x06, 0x01, 0x00,
+0x02, 0x02, 0x01, 0x00, 0xFF, 0x01, 0x03, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0x02, 0xFC, 0xFF, 0xFF,
+0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFE, 0xFB, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x01,
+0xFE, 0xFF, 0x00, 0x01, 0x00, 0x01, 0x03, 0x02, 0x01, 0xFD, 0xFD, 0x02, 0x02, 0x01, 0xFE, 0x00,
+0xFE, 0xFF, 0x01, 0x02, 0x02, 0xFE, 0x01, 0x03, 0xFE, 0xFA, 0x01, 0x00, 0x00, 0x03, 0x02, 0x02,
+0xFF, 0x01, 0x00, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00,
+0x00, 0x00, 0x01, 0x04, 0x01, 0xFF, 0x03, 0x03, 0xFE, 0xFB, 0xFF, 0x00, 0xFF, 0x05, 0x01, 0x03,
+0x00, 0xFF, 0x00, 0x02, 0x00, 0x01, 0x03, 0x01, 0x01, 0x00, 0xFF, 0x02, 0x00, 0xFF, 0xFE, 0x01,
+0xFF, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x01, 0xFE, 0xFC, 0xFF, 0x01, 0x00, 0x03, 0x02, 0x04,
+0x00, 0x00, 0x01, 0x02, 0x01, 0x02, 0x04, 0x01, 0x01, 0xFD, 0xFD, 0x03, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x02, 0x01, 0x02, 0x00, 0x02, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0x06, 0x01, 0x06,
+0xFF, 0xFF, 0xFE, 0x01, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0x01, 0xFF, 0x00, 0xFF,
+0x02, 0xFF, 0x00, 0x02, 0x00, 0x01, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x03, 0x02, 0x05, 0x02, 0x04,
+0xFE, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x02, 0xFE, 0xFD, 0x02, 0x02, 0x03, 0x02, 0x03,
+0x00, 0x03, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x08, 0xFC, 0x01, 0x00, 0x04, 0xFF, 0x02,
+0xFE, 0x01, 0xFD, 0x01, 0x03, 0x00, 0xFD, 0x03, 0x04, 0xFF, 0xFE, 0x02, 0x03, 0x03, 0x00, 0x00,
+0xFF, 0xFF, 0x02, 0xFF, 0xFD, 0xFE, 0x04, 0x05, 0x03, 0x08, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x03,
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x02, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x01,
+0xFF, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0x02, 0xFE, 0x06, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x01,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x02, 0xFE, 0x02, 0x02, 0xFF, 0xFF, 0x01,
+0xFF, 0x00, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x06, 0xFE, 0x00, 0x00, 0x01, 0x01, 0x05,
+0x01, 0x00, 0x02, 0x01, 0xFF, 0x02, 0x01, 0x01, 0xFF, 0x02, 0xFE, 0x03, 0x01, 0xFD, 0x01, 0x01,
+0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0xFF, 0x01, 0xFE, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x01, 0x05,
+0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0xFF, 0x00, 0xFE,
+0x00, 0xFD, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x05, 0xFE, 0x01, 0x02, 0x02, 0x00, 0x03,
+0xFF, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0x01, 0xFE, 0xFF,
+0xFE, 0x00, 0xFF, 0x01, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x01, 0xFE, 0x05, 0x02, 0x02,
+0x00, 0x00, 0x01, 0x00, 0xFF, 0x02, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x02, 0xFF,
+0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x09, 0x00, 0x03, 0x01, 0x06, 0xFE, 0x03,
+0x00, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x03, 0x03, 0xFF, 0x02,
+0xFE, 0x02, 0xFE, 0x00, 0xFF, 0x02, 0x02, 0x00, 0xFE, 0x0B, 0xFE, 0xFE, 0x03, 0x06, 0xFD, 0x03,
+0xFF, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0xFC, 0xFE, 0x02, 0x00, 0x00, 0x01, 0x01,
+0x00, 0xFE, 0x00, 0x02, 0x01, 0xFD, 0xFE, 0xFE, 0x00, 0x06, 0xFD, 0xFF, 0x04, 0x07, 0xFC, 0x04,
+0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0xFE, 0xFA, 0xFE, 0x03, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFE, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01,
+0x01, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0xFC, 0x01, 0x03,
+0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFD, 0xFB, 0x03, 0x07,
+0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0xFA, 0x00, 0x04,
+0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xFE, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFB, 0x03, 0x05,
+0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x05, 0x02, 0x02, 0xFF, 0xFE, 0x02, 0x02, 0xFD, 0xFF, 0x00,
+0x00, 0xFF, 0xFF, 0x01, 0x03, 0x00, 0xFF, 0x02, 0xFF, 0x03, 0x00, 0x00, 0xFE, 0xFF, 0x02, 0x02,
+0x02, 0x01, 0x01, 0xFE, 0xFE, 0x02, 0xFB, 0xFE, 0xFE, 0x02, 0xFF, 0x02, 0xFE, 0x01, 0x00, 0x01,
+0x03, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0xFF, 0x00, 0x06, 0xFD, 0x01, 0x00, 0x03, 0xFE, 0x01,
+0x02, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0xFB, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x03,
+0x03, 0xFE, 0x00, 0x02, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x09, 0xFC, 0x01, 0x01, 0x06, 0xFC, 0x01,
+0xFC, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x02, 0xFF, 0x03, 0xFF, 0x01, 0x05, 0xFF, 0x00,
+0x00, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0x0B, 0xFC, 0x03, 0x06, 0x04, 0xFD, 0x00,
+0xFE, 0xFE, 0xFF, 0x00, 0x04, 0x01, 0x02, 0xFF, 0x00, 0xFB, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00,
+0xFD, 0xFF, 0xFE, 0x01, 0xFC, 0x00, 0xFF, 0x02, 0x02, 0x08, 0xFE, 0xFF, 0x03, 0x03, 0x00, 0xFE,
+0xFE, 0x01, 0xFE, 0x02, 0x04, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0xFD, 0xFF,
+0xFE, 0x00, 0xFE, 0x02, 0x02, 0xFF, 0xFE, 0x02, 0xFF, 0x02, 0x00, 0x02, 0x03, 0xFD, 0x02, 0x03,
+0x01, 0x02, 0x02, 0x00, 0x02, 0xFE, 0x05, 0x00, 0x02, 0x01, 0xFE, 0x04, 0x02, 0x02, 0xFC, 0x03,
+0xFD, 0xFF, 0x00, 0x01, 0x03, 0xFD, 0xFE, 0x02, 0x00, 0xFF, 0x00, 0x00, 0xFA, 0xF9, 0x02, 0x04,
+0x00, 0xFF, 0x00, 0x01, 0x04, 0x00, 0x03, 0x01, 0x02, 0x01, 0xFA, 0x01, 0x04, 0xFC, 0xFF, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFD, 0xFA, 0x02, 0x04,
+0x00, 0xFD, 0x03, 0x01, 0xFF, 0x00, 0x03, 0x00, 0x03, 0xFE, 0xFB, 0x01, 0xFE, 0xFD, 0x01, 0x01,
+0x01, 0x00, 0x02, 0x03, 0x01, 0xFB, 0xFF, 0xFD, 0x01, 0x03, 0xFD, 0xFE, 0x00, 0xFD, 0x03, 0x00,
+0x00, 0xFD, 0xFF, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0xFF, 0x00, 0x02, 0x07, 0x01,
+0x00, 0xFF, 0x05, 0x03, 0x04, 0xFE, 0x03, 0xFF, 0x00, 0x05, 0xFE, 0x04, 0x05, 0x00, 0xFF, 0xFF,
+0x02, 0xFF, 0xFF, 0x02, 0x01, 0x01, 0xFD, 0x02, 0x02, 0xFB, 0xFC, 0x02, 0x01, 0x00, 0xFE, 0x04,
+0x01, 0xFF, 0x00, 0xFE, 0xFF, 0x06, 0x00, 0x02, 0x01, 0x09, 0x04, 0x02, 0x02, 0x01, 0xFF, 0x04,
+0xFE, 0x00, 0x02, 0xFB, 0xFE, 0x00, 0xFF, 0x00, 0xFB, 0x01, 0x08, 0x02, 0x01, 0xFE, 0x05, 0x06,
+0x01, 0xFF, 0x01, 0xFF, 0xFC, 0x02, 0x01, 0xFE, 0x02, 0x0A, 0xFC, 0x02, 0x05, 0x02, 0xFB, 0xFF,
+0xFD, 0x01, 0xFD, 0xFE, 0x02, 0xFF, 0x02, 0xFC, 0xFE, 0xFC, 0xFB, 0x00, 0x02, 0x04, 0x05, 0x06,
+0x04, 0x02, 0x01, 0x03, 0xFE, 0xFC, 0x02, 0xFF, 0x02, 0x08, 0x01, 0x01, 0x06, 0x07, 0x03, 0x01,
+0xFE, 0xFF, 0xFF, 0x04, 0x03, 0x03, 0x04, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0x03, 0x01, 0x00, 0xFD,
+0xFF, 0x04, 0x00, 0xFE, 0x00, 0xFC, 0x02, 0x01, 0x05, 0x04, 0xFD, 0x01, 0xFF, 0x04, 0x04, 0x03,
+0x02, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x01, 0x01, 0x00, 0xFA, 0x04, 0xFF, 0x00, 0x02, 0xFC, 0x01,
+0x03, 0xFB, 0xFF, 0x02, 0xFF, 0xFE, 0x02, 0x02, 0xFD, 0x01, 0xFF, 0x01, 0x05, 0x04, 0x01, 0x04,
+0x04, 0xFC, 0x00, 0x03, 0xFE, 0x01, 0xFC, 0x02, 0x05, 0x04, 0xFB, 0x03, 0xFB, 0xFE, 0x07, 0xFC,
+0x04, 0x02, 0x04, 0xFF, 0x02, 0x05, 0x01, 0xF9, 0xFE, 0x00, 0x01, 0x03, 0x05, 0xF9, 0x03, 0xFF,
+0x04, 0xFE, 0xFB, 0x04, 0xFF, 0xFA, 0x01, 0x02, 0x02, 0xFF, 0xFE, 0x03, 0xFE, 0xFC, 0x03, 0xFE,
+0xFF, 0xF9, 0xFE, 0x00, 0xFC, 0x04, 0xFE, 0x03, 0xFF, 0xFE, 0x06, 0xFC, 0xF7, 0xFE, 0x05, 0x05,
+0xFD, 0x00, 0x02, 0x02, 0xFE, 0xFD, 0xF7, 0xFF, 0xFC, 0xFE, 0x02, 0x04, 0xFD, 0xFC, 0x01, 0xFC,
+0x02, 0xFD, 0x05, 0xFD, 0xFD, 0x02, 0xFD, 0xF9, 0xFB, 0x06, 0xFA, 0x03, 0xFF, 0xFD, 0xFF, 0x02,
+0x03, 0x01, 0x01, 0xFF, 0x00, 0x01, 0xF8, 0xFD, 0xFD, 0x02, 0x01, 0xFC, 0x01, 0xFD, 0xFF, 0xFE,
+0xFE, 0x05, 0x01, 0x01, 0x01, 0x07, 0x01, 0xFF, 0x00, 0x0B, 0xFF, 0x02, 0x02, 0x02, 0x00, 0xFE,
+0x00, 0x02, 0xFF, 0x00, 0x02, 0xFD, 0xFD, 0xFE, 0xFF, 0xFC, 0x01, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
+0xFF, 0x00, 0xFF, 0x02, 0x00, 0x01, 0xFD, 0x00, 0x01, 0x07, 0xFE, 0x04, 0x03, 0x07, 0x00, 0x02,
+0x00, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0x02, 0xFE, 0xFF, 0xFE, 0x00, 0x02,
+0x00, 0x00, 0xFD, 0x01, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x05, 0xFD, 0x02, 0x04, 0x03, 0xFD, 0x02,
+0x00, 0xFE, 0xFF, 0x00, 0x02, 0x02, 0x02, 0x02, 0xFF, 0xFE, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x03, 0x02, 0xFE, 0x07, 0xFF, 0x03, 0xFF, 0x07, 0x02, 0x04,
+0xFE, 0xFE, 0xFD, 0xFC, 0x02, 0x00, 0x08, 0x04, 0x01, 0xFB, 0x02, 0xFE, 0x03, 0x01, 0x03, 0xFC,
+0xFC, 0x00, 0xFF, 0x01, 0xFA, 0xFA, 0x03, 0x01, 0xFD, 0x02, 0xFF, 0x00, 0x03, 0x04, 0xFE, 0x07,
+0xFD, 0x00, 0x00, 0xFC, 0x01, 0x02, 0x02, 0xF9, 0x00, 0x09, 0xFE, 0x03, 0x00, 0x03, 0x07, 0xFF,
+0xFC, 0x08, 0xFC, 0xFB, 0x03, 0x04, 0x00, 0xFA, 0xFB, 0xFB, 0xFE, 0xF9, 0xFE, 0xFE, 0x05, 0xFD,
+0xF9, 0x01, 0x01, 0x05, 0x06, 0x04, 0x04, 0x04, 0xFA, 0x00, 0xFC, 0x02, 0xFD, 0xFC, 0xFE, 0x02,
+0xFE, 0x01, 0x02, 0xFE, 0x00, 0x03, 0x02, 0x04, 0x02, 0x09, 0x04, 0x07, 0xFD, 0x02, 0xFA, 0x05,
+0xFE, 0x01, 0xFE, 0x02, 0x04, 0x05, 0xFB, 0xFA, 0x05, 0xFA, 0xFD, 0x01, 0x03, 0xFE, 0x02, 0x02,
+0xFD, 0x03, 0xFA, 0x04, 0x03, 0xFB, 0x02, 0x00, 0x01, 0x07, 0xFF, 0xFE, 0x07, 0x01, 0xFB, 0x01,
+0xFA, 0xFD, 0x01, 0x04, 0x03, 0x02, 0xFB, 0xFE, 0x00, 0x00, 0xF6, 0xFC, 0xFE, 0x04, 0xFE, 0xFB,
+0x01, 0x00, 0x00, 0xFF, 0x03, 0xFD, 0xF9, 0x00, 0x00, 0x07, 0xFB, 0x06, 0x04, 0x07, 0x00, 0x00,
+0xFF, 0xFD, 0xFE, 0x01, 0x01, 0xFF, 0xFD, 0xFD, 0x02, 0xFD, 0x01, 0x00, 0xFF, 0x05, 0x00, 0x00,
+0x01, 0x05, 0xFF, 0x02, 0xFF, 0x06, 0x02, 0x01, 0xFE, 0x02, 0x00, 0xFF, 0x04, 0x02, 0xFC, 0x03,
+0x04, 0xFE, 0x01, 0xFF, 0x07, 0x00, 0xFB, 0x03, 0x00, 0xFA, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFE,
+0xFF, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFE, 0xFC, 0x03, 0x08, 0xFE, 0x00, 0x05, 0x04, 0x00, 0x00,
+0x01, 0x01, 0xFC, 0xFD, 0x02, 0xFF, 0xFB, 0x01, 0x00, 0xF8, 0x01, 0xFF, 0xFE, 0xFE, 0x00, 0xFB,
+0x03, 0x05, 0xFE, 0x04, 0xFA, 0x02, 0x02, 0x01, 0x00, 0x0A, 0x06, 0xFF, 0x00, 0x01, 0xFF, 0x05,
+0xFD, 0xFA, 0xFF, 0xFC, 0xFE, 0xFF, 0x05, 0x07, 0x02, 0xF8, 0xFE, 0x01, 0xFF, 0xFC, 0xFE, 0x03,
+0xFE, 0x02, 0xFB, 0x02, 0xFF, 0x00, 0x04, 0xFB, 0xF8, 0x03, 0x05, 0x05, 0xF6, 0x01, 0x00, 0x05,
+0x00, 0xFB, 0x03, 0xFB, 0x01, 0xF7, 0xFC, 0x03, 0xF9, 0xF8, 0x08, 0x0A, 0xFE, 0xF4, 0x05, 0x06,
+0x01, 0x06, 0x01, 0x02, 0xFA, 0x00, 0x03, 0xFF, 0xFB, 0x08, 0xFF, 0x00, 0xFF, 0xF7, 0xFD, 0x00,
+0x05, 0xFC, 0x04, 0x00, 0xFE, 0xFF, 0xF7, 0x00, 0xFB, 0x02, 0x00, 0xFE, 0xFA, 0xF9, 0x02, 0xFD,
+0x01, 0x04, 0xF9, 0xFD, 0xFE, 0x03, 0x02, 0xFB, 0xFC, 0xF6, 0x02, 0xFD, 0xFB, 0x05, 0xFC, 0x02,
+0xFE, 0xFB, 0xFF, 0x00, 0x03, 0xFE, 0xF9, 0x02, 0xFD, 0x02, 0xFE, 0xFB, 0xFB, 0xFE, 0x02, 0x00,
+0x00, 0x01, 0xFB, 0x00, 0x00, 0x05, 0xFD, 0xFC, 0x05, 0xF7, 0x01, 0xF9, 0x02, 0x08, 0xFE, 0xFB,
+0xFD, 0x01, 0x0C, 0xFD, 0xFD, 0xF9, 0xFA, 0xFF, 0xFC, 0x06, 0x04, 0x02, 0xFE, 0xFB, 0xFE, 0xFE,
+0xF8, 0x02, 0x02, 0x00, 0x00, 0xFE, 0x00, 0xFA, 0x07, 0x04, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0xFE,
+0x00, 0xFF, 0xFA, 0xFC, 0xFA, 0xFD, 0x02, 0x01, 0xFD, 0x00, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0x02,
+0x02, 0xFF, 0xFB, 0x06, 0x06, 0x01, 0xFB, 0x03, 0x02, 0x04, 0x06, 0xFA, 0x04, 0x06, 0xFB, 0xFB,
+0x03, 0xFE, 0xFC, 0x01, 0x00, 0xFB, 0xFA, 0x05, 0x04, 0x01, 0xFD, 0x05, 0x00, 0xFA, 0xFA, 0xFE,
+0x06, 0x01, 0x05, 0x06, 0xFA, 0x01, 0xFF, 0xFD, 0xFF, 0xFF, 0x01, 0x03, 0xFD, 0x04, 0xFB, 0xFB,
+0x06, 0xFE, 0x02, 0xFC, 0x03, 0xFF, 0x03, 0xFE, 0x01, 0x05, 0x06, 0x06, 0x00, 0x01, 0x04, 0x05,
+0x02, 0x05, 0xFA, 0x01, 0xFD, 0x04, 0xFE, 0x03, 0x05, 0xFD, 0x03, 0xFB, 0xFB, 0xFC, 0x05, 0xFD,
+0x00, 0xFB, 0xFD, 0xFE, 0xFF, 0x05, 0xFE, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0x03, 0x06, 0x00, 0x01,
+0x02, 0x05, 0xFB, 0x00, 0xFE, 0xFB, 0x04, 0x01, 0x02, 0xFF, 0xFE, 0x00, 0xFB, 0x03, 0x00, 0x02,
+0xFB, 0xFE, 0x04, 0xFE, 0xFD, 0x03, 0xFC, 0x06, 0x04, 0xFE, 0x02, 0xFE, 0x04, 0xFD, 0xFB, 0x04,
+0x04, 0xFF, 0x00, 0xFB, 0x02, 0xFD, 0xFF, 0xFD, 0xFC, 0x05, 0x02, 0xFE, 0x06, 0x06, 0xFD, 0xFD,
+0x05, 0xFD, 0xFD, 0xFA, 0x04, 0x00, 0x06, 0x01, 0xFF, 0x04, 0x01, 0x02, 0xFB, 0x04, 0xFE, 0x04,
+0xFF, 0x00, 0xFC, 0x06, 0x05, 0x06, 0x04, 0x05, 0xFB, 0xFD, 0xFA, 0xFF, 0xFC, 0xFB, 0x01, 0xFF,
+0x02, 0x04, 0x00, 0xFC, 0x05, 0xFB, 0x01, 0xFE, 0xFD, 0x03, 0x06, 0xFD, 0x01, 0x03, 0xFF, 0xFD,
+0x03, 0x00, 0x05, 0x03, 0x06, 0xFB, 0x05, 0x01, 0x03, 0xFF, 0x06, 0x05, 0xFC, 0xFB, 0xFA, 0xFB,
+0x00, 0x01, 0x02, 0x04, 0xFB, 0x05, 0x05, 0xFC, 0x05, 0xFF, 0xFA, 0xFA, 0xFB, 0xFF, 0xFD, 0x04,
+0x00, 0xFC, 0x00, 0xFC, 0xFE, 0x03, 0x00, 0x01, 0x02, 0x03, 0xFC, 0xFE, 0x02, 0x06, 0x04, 0x03,
+0xFD, 0xFD, 0x06, 0xFE, 0x03, 0xFC, 0xFD, 0xF8, 0x04, 0xFD, 0x01, 0xFE, 0xFF, 0x01, 0x02, 0x01,
+0xFD, 0x07, 0xFC, 0xFE, 0xFF, 0x04, 0xFD, 0xFE, 0x02, 0x05, 0x03, 0x04, 0x00, 0x02, 0xFD, 0x02,
+0xFE, 0xFB, 0x02, 0xFD, 0x04, 0xFC, 0xFC, 0xFD, 0x02, 0xFE, 0x01, 0xFD, 0xFC, 0x03, 0x03, 0x02,
+0xFC, 0x01, 0xFE, 0xFB, 0xFB, 0x03, 0xFD, 0xFC, 0x01, 0x05, 0x02, 0x04, 0xFD, 0x02, 0xFE, 0x03,
+0xFE, 0xFE, 0x04, 0xFD, 0x01, 0xFC, 0xFF, 0xFC, 0x03, 0xFE, 0x03, 0xFF, 0xFD, 0x02, 0x01, 0x02,
+0xFC, 0x05, 0xFE, 0xFC, 0xFD, 0x02, 0xFE, 0xFD, 0x00, 0x06, 0x03, 0x01, 0xFD, 0x03, 0xFD, 0x06,
+0x00, 0xFA, 0x03, 0xFE, 0x02, 0xFC, 0xFC, 0xFF, 0x01, 0xFD, 0x02, 0xFD, 0xFC, 0x02, 0x02, 0x04,
+0xFD, 0x01, 0xFE, 0xFF, 0xFE, 0x04, 0xFB, 0xFE, 0x03, 0x05, 0x02, 0x03, 0xFA, 0x03, 0xFE, 0x05,
+0xFC, 0xFB, 0x02, 0xFB, 0x02, 0x00, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0xFC, 0xFF, 0x02, 0x02, 0x04,
+0xFD, 0x07, 0xFE, 0xFE, 0xFB, 0x08, 0xFE, 0x00, 0x03, 0x05, 0x01, 0x02, 0xFD, 0x05, 0xFF, 0x04,
+0xFF, 0xFD, 0x0A, 0x00, 0x01, 0xFD, 0xF7, 0x00, 0x00, 0xFC, 0x02, 0x00, 0xFE, 0x01, 0x02, 0x01,
+0xFF, 0x02, 0xFC, 0xFE, 0x00, 0x05, 0xFC, 0xFC, 0x01, 0x05, 0x02, 0x01, 0xFF, 0x03, 0xFA, 0x02,
+0xFC, 0xFE, 0x03, 0xFF, 0x04, 0xFE, 0xFA, 0xFF, 0x02, 0xFE, 0x05, 0xFF, 0xFF, 0x08, 0x02, 0x00,
+0xFE, 0x02, 0x00, 0xFD, 0xFB, 0x01, 0xFD, 0xFA, 0x03, 0x06, 0x01, 0x02, 0xFD, 0x05, 0xFA, 0x03,
+0xFB, 0xFB, 0x03, 0xFE, 0x02, 0xFC, 0xFE, 0xFD, 0x03, 0xFD, 0x02, 0xFD, 0xFE, 0x03, 0x02, 0x01,
+0xFE, 0x06, 0xFD, 0xFC, 0xFF, 0x05, 0xFF, 0xFC, 0x04, 0x05, 0x03, 0x04, 0x00, 0x04, 0xFC, 0x02,
+0xFE, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0xFF, 0xFB, 0x03, 0xFE, 0xFF, 0xFD, 0xFF, 0x05, 0x01, 0x00,
+0xFE, 0x04, 0xFD, 0xFD, 0xFF, 0x03, 0xFE, 0x01, 0x04, 0x07, 0x01, 0x02, 0x00, 0x02, 0xFC, 0x01,
+0xFE, 0xFC, 0x01, 0xFF, 0x02, 0xFE, 0xFD, 0xFE, 0x01, 0xFF, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x02,
+0xFE, 0x01, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFE, 0x03, 0x07, 0x03, 0x02, 0xFC, 0x03, 0xFD, 0x03,
+0xFF, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0xFE, 0xFD, 0x02, 0xFD, 0x01, 0xFD, 0xFF, 0x03, 0x03, 0x01,
+0xFD, 0x03, 0xFE, 0xFD, 0xFF, 0x00, 0xFE, 0xFE, 0x02, 0x06, 0x03, 0x01, 0xFD, 0x02, 0xFE, 0x02,
+0xFF, 0xFC, 0x01, 0xFD, 0x01, 0xFF, 0xFD, 0xF9, 0x03, 0xFF, 0x00, 0xFD, 0xFD, 0x02, 0x02, 0x01,
+0xFE, 0x05, 0xFE, 0xFF, 0xFD, 0x04, 0xFF, 0xFA, 0x02, 0x05, 0x01, 0x01, 0x01, 0x02, 0xFD, 0x00,
+0xFE, 0xFE, 0x00, 0xFD, 0x03, 0xFE, 0xFD, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xFB, 0x04, 0xFF, 0x02,
+0xFE, 0x07, 0xFE, 0xFF, 0x01, 0x02, 0xFE, 0xFE, 0x03, 0x04, 0x01, 0x02, 0xFE, 0x02, 0xFE, 0x04,
+0xFD, 0xFD, 0x01, 0xFF, 0x02, 0xFE, 0xFE, 0xFE, 0x02, 0xFD, 0x01, 0xFD, 0xFD, 0x03, 0x01, 0x02,
+0xFE, 0xFF, 0xFE, 0xFD, 0xFD, 0x02, 0xFC, 0x00, 0x02, 0x06, 0x02, 0x02, 0xFD, 0x02, 0xFC, 0x02,
+0xFD, 0x00, 0x01, 0xFD, 0x02, 0xFE, 0xFE, 0xFF, 0x04, 0xFD, 0x03, 0xFF, 0xFD, 0x03, 0x02, 0x00,
+0xFE, 0x03, 0xFE, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x02, 0x06, 0x03, 0x02, 0x01, 0x05, 0xFF, 0x01,
+0xFF, 0x00, 0x04, 0xFF, 0x01, 0xFE, 0xFE, 0xFE, 0x01, 0xFF, 0x02, 0xFD, 0xFD, 0x04, 0x02, 0x02,
+0xFE, 0x04, 0xFD, 0xFD, 0xFF, 0x02, 0xFE, 0xFF, 0x02, 0x06, 0x01, 0x01, 0xFF, 0x04, 0xFF, 0x03,
+0xFE, 0xFE, 0x02, 0xFF, 0x03, 0xFE, 0xFF, 0xFC, 0x03, 0xFE, 0x01, 0xFE, 0xFD, 0x04, 0x01, 0x01,
+0xFE, 0x03, 0xFE, 0xFE, 0xFE, 0x02, 0xFE, 0xFF, 0x02, 0x05, 0x01, 0x02, 0xFF, 0x03, 0xFE, 0x02,
+0xFE, 0xFD, 0x02, 0xFE, 0x02, 0xFE, 0xFD, 0xFD, 0x02, 0xFF, 0x01, 0xFE, 0xFE, 0x03, 0x01, 0x03,
+0xFF, 0x02, 0xFD, 0xFE, 0xFE, 0x02, 0xFF, 0xFF, 0x02, 0x05, 0x02, 0x01, 0x00, 0x03, 0xFD, 0x03,
+0xFE, 0xFF, 0x01, 0xFE, 0x02, 0xFE, 0xFF, 0xFF, 0x02, 0xFE, 0x01, 0xFE, 0xFD, 0x02, 0x01, 0x02,
+0xFE, 0x03, 0xFD, 0xFE, 0xFE, 0x02, 0xFE, 0xFE, 0x02, 0x05, 0x02, 0x02, 0xFD, 0x03, 0x00, 0x04,
+0xFD, 0xFF, 0x01, 0xFF, 0x02, 0xFD, 0xFF, 0xFF, 0x03, 0xFD, 0x01, 0xFE, 0xFD, 0x02, 0x01, 0x01,
+0xFD, 0x01, 0xFD, 0xFD, 0xFF, 0x01, 0xFF, 0xFE, 0x01, 0x03, 0x03, 0x01, 0xFF, 0x03, 0xFE, 0x03,
+0xFE, 0xFD, 0x01, 0xFE, 0x02, 0xFE, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0xFF, 0xFE, 0x02, 0x00, 0x01,
+0xFE, 0x04, 0xFE, 0xFF, 0xFE, 0x02, 0xFE, 0xFE, 0x03, 0x03, 0x02, 0x02, 0xFF, 0x04, 0xFE, 0x04,
+0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0xFE, 0xFF, 0x02, 0xFE, 0x01, 0xFE, 0xFE, 0x02, 0x02, 0x01,
+0xFD, 0x02, 0xFE, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0x05, 0x02, 0x02, 0xFF, 0x02, 0xFE, 0x03,
+0xFD, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0xFD, 0xFF, 0x03, 0xFE, 0x02, 0xFE, 0xFC, 0x03, 0x02, 0x02,
+0xFE, 0x01, 0xFE, 0xFE, 0xFF, 0x02, 0xFF, 0xFF, 0x02, 0x05, 0x02, 0x02, 0xFF, 0x03, 0xFD, 0x04,
+0xFD, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0xFD, 0xFD, 0x01, 0xFD, 0x02, 0xFD, 0xFE, 0x02, 0x01, 0x01,
+0xFF, 0x03, 0xFD, 0xFE, 0xFD, 0x02, 0xFE, 0xFE, 0x02, 0x05, 0x01, 0x02, 0xFE, 0x04, 0xFE, 0x01,
+0xFE, 0xFF, 0x01, 0xFF, 0x02, 0xFF, 0xFF, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0xFE, 0x02, 0x01, 0x01,
+0xFD, 0x02, 0xFE, 0xFE, 0xFF, 0x01, 0xFE, 0xFE, 0x02, 0x04, 0x02, 0x01, 0xFF, 0x02, 0xFE, 0x02,
+0xFF, 0xFE, 0x01, 0xFE, 0x02, 0xFE, 0xFE, 0xFE, 0x02, 0xFD, 0x01, 0xFE, 0xFE, 0x02, 0x01, 0x02,
+0xFE, 0x01, 0xFE, 0xFE, 0xFE, 0x01, 0xFE, 0xFF, 0x02, 0x04, 0x02, 0x01, 0xFE, 0x03, 0xFE, 0x03,
+0xFE, 0xFF, 0x01, 0xFF, 0x01, 0xFD, 0xFE, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0xFE, 0x03, 0x01, 0x01,
+0xFE, 0x01, 0xFF, 0xFD, 0xFD, 0x02, 0xFF, 0xFF, 0x01, 0x04, 0x02, 0x01, 0xFF, 0x03, 0xFD, 0x04,
+0xFE, 0xFD, 0x00, 0xFE, 0x02, 0xFE, 0xFF, 0xFE, 0x03, 0xFE, 0x02, 0xFF, 0xFF, 0x02, 0x01, 0x02,
+0xFD, 0x00, 0xFE, 0xFE, 0xFF, 0x01, 0xFE, 0xFF, 0x02, 0x02, 0x02, 0x02, 0xFF, 0x05, 0xFF, 0x03,
+0xFE, 0xFF, 0x02, 0xFE, 0x03, 0xFF, 0xFE, 0xFE, 0x01, 0xFE, 0x02, 0xFF, 0xFF, 0x02, 0x02, 0x02,
+0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x03, 0x02, 0x02, 0x02, 0xFE, 0x03, 0xFE, 0x04,
+0xFE, 0xFE, 0x01, 0xFE, 0x02, 0xFE, 0xFF, 0xFE, 0x02, 0xFE, 0x01, 0xFD, 0xFE, 0x02, 0x01, 0x02,
+0xFD, 0x02, 0xFF, 0xFE, 0xFE, 0x01, 0xFE, 0xFF, 0x01, 0x04, 0x02, 0x02, 0xFE, 0x03, 0xFE, 0x03,
+0xFE, 0xFF, 0x02, 0xFF, 0x01, 0xFE, 0xFD, 0xFF, 0x03, 0xFD, 0x01, 0xFD, 0xFE, 0x03, 0x01, 0x01,
+0xFE, 0x03, 0xFE, 0xFE, 0xFE, 0x00, 0xFE, 0xFE, 0x02, 0x04, 0x01, 0x01, 0xFE, 0x02, 0xFF, 0x02,
+0xFE, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0xFE, 0xFE, 0x01, 0xFE, 0x02, 0xFE, 0xFE, 0x02, 0x02, 0x01,
+0xFD, 0x01, 0xFD, 0xFE, 0xFF, 0x02, 0xFF, 0xFF, 0x02, 0x04, 0x01, 0x01, 0xFF, 0x02, 0xFE, 0x03,
+0xFE, 0xFF, 0x02, 0xFF, 0x02, 0xFE, 0xFE, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0xFE, 0x03, 0x02, 0x01,
+0xFE, 0x02, 0xFE, 0xFF, 0xFE, 0x02, 0x00, 0xFF, 0x02, 0x03, 0x01, 0x02, 0x00, 0x04, 0xFE, 0x02,
+0xFD, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0xFE, 0xFE, 0x01, 0xFE, 0x00, 0xFD, 0xFE, 0x02, 0x01, 0x01,
+0xFE, 0x01, 0xFE, 0xFE, 0xFE, 0x02, 0xFE, 0x00, 0x02, 0x04, 0x02, 0x01, 0xFF, 0x02, 0xFE, 0x03,
+0xFE, 0xFE, 0x03, 0xFF, 0x02, 0xFE, 0xFF, 0xFF, 0x02, 0xFE, 0x01, 0xFD, 0xFE, 0x04, 0x01, 0x01,
+0xFE, 0x03, 0xFE, 0xFE, 0xFE, 0x02, 0xFF, 0xFD, 0x02, 0x05, 0x01, 0x02, 0xFE, 0x01, 0xFF, 0x02,
+0xFE, 0xFE, 0x02, 0xFE, 0x03, 0xFE, 0xFF, 0xFD, 0x03, 0xFD, 0x02, 0xFD, 0x00, 0x04, 0x00, 0x01,
+0xFF, 0x02, 0xFF, 0xFF, 0xFD, 0x01, 0xFD, 0xFF, 0x01, 0x04, 0x02, 0x01, 0xFF, 0x04, 0xFF, 0x01,
+0xFE, 0xFD, 0x06, 0xFE, 0x03, 0xFC, 0xFC, 0xFE, 0x03, 0xFE, 0x02, 0xFF, 0xFE, 0x03, 0x02, 0x01,
+0xFD, 0x02, 0xFE, 0xFE, 0x01, 0x02, 0x00, 0xFF, 0x03, 0x03, 0x02, 0x02, 0x03, 0x01, 0xFD, 0x01,
+0xFE, 0xFF, 0x01, 0xFF, 0x03, 0xFE, 0xFD, 0xFE, 0x03, 0xFD, 0x01, 0xFE, 0xFF, 0x03, 0x01, 0x02,
+0xFE, 0x03, 0xFE, 0xFE, 0xFF, 0x00, 0xFE, 0xFE, 0x02, 0x05, 0x03, 0x02, 0x00, 0x03, 0xFE, 0x03,
+0xFE, 0xFF, 0x01, 0xFF, 0x02, 0xFF, 0xFD, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0xFF, 0x03, 0x02, 0x02,
+0xFE, 0x03, 0xFE, 0xFE, 0xFE, 0x01, 0xFE, 0xFF, 0x03, 0x04, 0x01, 0x02, 0x00, 0x03, 0xFE, 0x01,
+0xFE, 0xFE, 0x02, 0xFF, 0x02, 0xFE, 0xFD, 0xFF, 0x02, 0xFE, 0x02, 0xFE, 0xFD, 0x02, 0x02, 0x01,
+0xFE, 0x01, 0xFF, 0xFE, 0xFF, 0x01, 0xFF, 0xFE, 0x01, 0x03, 0x02, 0x02, 0xFF, 0x02, 0xFD, 0x03,
+0xFE, 0xFE, 0x01, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x02, 0xFE, 0x01, 0xFE, 0xFE, 0x02, 0x02, 0x02,
+0xFD, 0x02, 0xFE, 0xFE, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0x01, 0x02, 0x02, 0xFF, 0x02, 0xFE, 0x01,
+0xFF, 0xFE, 0x01, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x02, 0xFE, 0x01, 0xFE, 0xFF, 0x02, 0x01, 0x01,
+0xFE, 0x03, 0xFF, 0xFE, 0xFE, 0x01, 0xFD, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFE, 0x02, 0xFF, 0x02,
+0xFE, 0xFF, 0x01, 0xFF, 0x02, 0xFE, 0xFE, 0xFF, 0x02, 0xFD, 0x02, 0xFE, 0xFE, 0x03, 0x01, 0x01,
+0xFE, 0x01, 0xFE, 0xFE, 0xFE, 0x02, 0xFF, 0xFF, 0x02, 0x01, 0x01, 0x01, 0xFF, 0x04, 0xFE, 0x03,
+0xFE, 0xFF, 0x06, 0xFF, 0x02, 0xFF, 0x00, 0xFB, 0x01, 0xFE, 0x01, 0xFC, 0xFE, 0x05, 0x01, 0xFE,
+0xFF, 0x00, 0xFD, 0xFF, 0x01, 0x01, 0xFE, 0xFD, 0x00, 0x05, 0xFF, 0x02, 0x03, 0x03, 0xFD, 0x00,
+0xFE, 0x00, 0x02, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x01, 0xFD, 0x02, 0xFD, 0xFE, 0x02, 0x00, 0x00,
+0xFF, 0x01, 0xFF, 0xFE, 0xFE, 0x00, 0xFF, 0xFF, 0x03, 0x05, 0x01, 0x02, 0xFF, 0x03, 0xFF, 0x04,
+0xFF, 0xFE, 0x03, 0xFE, 0x01, 0xFE, 0xFE, 0xFE, 0x02, 0xFF, 0x02, 0xFE, 0xFE, 0x01, 0x02, 0x02,
+0xFF, 0x03, 0xFE, 0xFE, 0xFF, 0x01, 0xFE, 0xFE, 0x02, 0x01, 0x02, 0x02, 0xFE, 0x02, 0xFF, 0x02,
+0xFD, 0xFF, 0x02, 0xFF, 0x01, 0xFE, 0xFE, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0xFF, 0x02, 0x01, 0x01,
+0xFE, 0x01, 0xFE, 0xFE, 0xFE, 0x01, 0xFF, 0xFF, 0x02, 0x01, 0x02, 0x02, 0xFF, 0x02, 0xFE, 0x03,
+0xFE, 0xFE, 0x03, 0xFF, 0x02, 0xFF, 0xFD, 0xFD, 0x01, 0xFF, 0x03, 0xFE, 0xFF, 0x02, 0x02, 0x01,
+0xFF, 0x02, 0xFD, 0xFF, 0xFF, 0x02, 0xFE, 0xFE, 0x02, 0x01, 0x01, 0x02, 0x00, 0x02, 0xFE, 0x01,
+0xFC, 0xFA, 0xFA, 0xFB, 0x01, 0x01, 0x05, 0x00, 0x04, 0x06, 0xFD, 0x04, 0x06, 0xFF, 0x00, 0xFA,
+0x03, 0x06, 0xFB, 0x01, 0xFC, 0x02, 0x02, 0x06, 0xFC, 0x05, 0x02, 0xFE, 0x02, 0x01, 0x00, 0xFF,
+0x02, 0xFA, 0x01, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0xFA, 0x03, 0x06, 0x04, 0x01, 0x01, 0x06, 0x04,
+0x00, 0xFE, 0xFD, 0xFE, 0xFD, 0x01, 0xFF, 0xFA, 0xFA, 0xFE, 0x00, 0x05, 0x01, 0x00, 0xFB, 0x00,
+0x04, 0x05, 0x03, 0xFD, 0x01, 0xFD, 0x06, 0xFD, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0x02,
+0x05, 0x02, 0xFB, 0xFD, 0xFE, 0x01, 0xFE, 0xFD, 0xFF, 0x04, 0x06, 0xFF, 0x04, 0x01, 0xFE, 0xFD,
+0x02, 0xFD, 0xFE, 0x01, 0xFD, 0x06, 0x02, 0x02, 0x06, 0xFB, 0xFC, 0xFB, 0xFB, 0x01, 0x00, 0xFF,
+0xFA, 0xFF, 0x02, 0xFA, 0xFC, 0x02, 0x00, 0xFD, 0x06, 0x04, 0x03, 0x03, 0xFA, 0x01, 0x00, 0xFD,
+0x00, 0x01, 0x06, 0xFF, 0xFF, 0x00, 0x04, 0x03, 0x01, 0x02, 0xFA, 0x02, 0xFA, 0xFA, 0x03, 0x04,
+0x06, 0xFF, 0x03, 0xFB, 0x06, 0x01, 0xFF, 0xFF, 0x05, 0x06, 0x03, 0x04, 0x00, 0x01, 0xFF, 0xFC,
+0xFA, 0x06, 0x00, 0xFF, 0x02, 0x05, 0xFE, 0xFE, 0xFD, 0xFC, 0x02, 0x03, 0xFF, 0xFB, 0xFE, 0x05,
+0xFD, 0x02, 0x02, 0x02, 0x00, 0xFE, 0x01, 0xFE, 0xFD, 0xFF, 0xFE, 0x01, 0xFC, 0xFA, 0xFF, 0x03,
+0x00, 0x03, 0x03, 0x05, 0xFD, 0xFD, 0xFF, 0x02, 0x04, 0xFC, 0x05, 0xFE, 0xFF, 0xFF, 0x02, 0x03,
+0x02, 0x06, 0xFF, 0x05, 0xFF, 0x02, 0x03, 0x00, 0xFD, 0x05, 0x03, 0x02, 0xFC, 0x01, 0x02, 0x05,
+0xFD, 0xFD, 0xFD, 0xFA, 0xFA, 0xFF, 0xFD, 0x02, 0xFC, 0xFC, 0xFA, 0x03, 0xFA, 0xFC, 0xFB, 0xFF,
+0x06, 0x00, 0x06, 0x05, 0xFC, 0x01, 0xFA, 0xFA, 0x02, 0x04, 0xFA, 0x03, 0xFD, 0xFE, 0x01, 0xFB,
+0xFF, 0xFD, 0x08, 0xF8, 0x04, 0xF9, 0xF6, 0xF6, 0xFB, 0x02, 0x0A, 0x05, 0xF7, 0xFF, 0x03, 0x0C,
+0xFB, 0x02, 0xFA, 0xFA, 0xFF, 0x01, 0xF7, 0xFD, 0x04, 0x02, 0x07, 0x02, 0x00, 0xFF, 0xFE, 0x02,
+0xFD, 0xFA, 0x06, 0xFD, 0x06, 0xFA, 0xF9, 0x00, 0x03, 0xFD, 0x01, 0xFA, 0xFB, 0x06, 0x06, 0x08,
+0xFC, 0x07, 0xFD, 0xFE, 0xFC, 0xFF, 0xFE, 0xFF, 0x02, 0x02, 0x03, 0x07, 0xFA, 0x04, 0xFC, 0x09,
+0xFE, 0xFB, 0x06, 0xFB, 0x00, 0xF9, 0xFB, 0xF9, 0x02, 0x02, 0x05, 0xFF, 0x00, 0x00, 0x06, 0x05,
+0xF7, 0x0B, 0xFC, 0xFD, 0xFB, 0x04, 0xFE, 0xFB, 0x02, 0x01, 0x0B, 0x07, 0xF8, 0x02, 0xFB, 0x08,
+0xFA, 0xFB, 0x06, 0xFA, 0x02, 0xFE, 0xFE, 0xFD, 0x04, 0xFE, 0x01, 0xFA, 0xF9, 0x03, 0x02, 0x03,
+0xFF, 0x01, 0xFC, 0xFE, 0xF9, 0x0B, 0xFC, 0xF8, 0x07, 0x01, 0x00, 0x03, 0x00, 0x07, 0xFC, 0x05,
+0x01, 0xFF, 0x05, 0xF9, 0x04, 0xF9, 0xFE, 0xFF, 0xFF, 0xFD, 0x07, 0x01, 0xFE, 0x03, 0x07, 0x02,
+0xFD, 0x0A, 0xFB, 0xF9, 0xFA, 0x0A, 0xF7, 0xFB, 0x00, 0x01, 0x03, 0x03, 0xFF, 0x06, 0xFA, 0x03,
+0xFD, 0xF8, 0x04, 0xFB, 0x02, 0xFE, 0xF7, 0xF8, 0x04, 0xFE, 0x04, 0x02, 0xFA, 0x05, 0x08, 0x02,
+0x01, 0x07, 0xFC, 0xFC, 0xFA, 0x09, 0xFE, 0xFE, 0x04, 0x01, 0x04, 0x04, 0x03, 0x05, 0xF6, 0x08,
+0xF9, 0xFF, 0x02, 0xFB, 0x04, 0xFC, 0xFE, 0xF8, 0x01, 0xFC, 0x05, 0xFC, 0xFB, 0x01, 0x03, 0x05,
+0xFC, 0x03, 0xFA, 0xF9, 0xFB, 0x02, 0xF8, 0xFC, 0x03, 0x02, 0x02, 0x03, 0xFC, 0x03, 0xF6, 0x06,
+0xFC, 0xFB, 0x04, 0xFC, 0x01, 0xFB, 0xFB, 0xFE, 0x00, 0x01, 0x09, 0xFF, 0xFD, 0x00, 0x06, 0x01,
+0xFD, 0x08, 0x02, 0xFA, 0xFB, 0x04, 0xF7, 0xF7, 0x04, 0x02, 0x04, 0x06, 0x02, 0x03, 0xF8, 0x02,
+0xFD, 0xFB, 0x05, 0xFB, 0x07, 0xFB, 0xFC, 0xFB, 0x02, 0xFD, 0x08, 0xFB, 0xFE, 0x03, 0x04, 0x0A,
+0xFD, 0x0B, 0x01, 0xFC, 0xF7, 0x06, 0xFA, 0xFB, 0x04, 0x02, 0x09, 0x07, 0xFC, 0x03, 0xFE, 0x04,
+0xFA, 0xFA, 0x02, 0xFB, 0x06, 0xFC, 0xFD, 0xFE, 0x04, 0xFA, 0x06, 0xFC, 0xFC, 0x04, 0x05, 0x05,
+0xFB, 0x03, 0xFC, 0xFB, 0xFE, 0x04, 0xFA, 0xFB, 0x05, 0x02, 0x05, 0x06, 0xFD, 0x07, 0xFC, 0x05,
+0xFD, 0xFA, 0x03, 0xFD, 0x04, 0xFD, 0xFE, 0xF8, 0x03, 0xFD, 0x07, 0xFF, 0xF9, 0x05, 0x09, 0x07,
+0xFB, 0x03, 0xFC, 0xFA, 0xFE, 0x04, 0xF8, 0xF9, 0x01, 0x02, 0x05, 0x05, 0xFE, 0x05, 0xF9, 0x02,
+0xFB, 0xFD, 0x08, 0xFE, 0x01, 0xFB, 0xFF, 0xF8, 0x05, 0xFC, 0x07, 0xFD, 0xFD, 0xFF, 0x06, 0x06,
+0xFC, 0x02, 0xFE, 0xFA, 0xFB, 0x09, 0xFA, 0xF6, 0x02, 0x02, 0x02, 0x06, 0xFE, 0x03, 0xFA, 0x06,
+0xF8, 0xF7, 0x02, 0xFC, 0x04, 0xFB, 0xFD, 0xFB, 0x02, 0xFE, 0x07, 0xFE, 0xF9, 0x06, 0x03, 0x05,
+0xFB, 0x07, 0xF7, 0xF9, 0xFD, 0x02, 0xF9, 0xFD, 0x05, 0x02, 0x02, 0x03, 0xFB, 0x00, 0xFB, 0x05,
+0xFD, 0xF9, 0x04, 0xF8, 0x03, 0xFD, 0xFE, 0xF8, 0x01, 0xFD, 0x05, 0xFC, 0xF9, 0x03, 0x03, 0x06,
+0xFE, 0x04, 0xFC, 0xFC, 0xFA, 0x07, 0xFB, 0xFC, 0x04, 0x02, 0x05, 0x07, 0xFD, 0x03, 0xFC, 0x08,
+0xFE, 0xFA, 0x03, 0xFA, 0x06, 0xF7, 0xFB, 0xFC, 0x03, 0x01, 0x04, 0xFB, 0xF8, 0x05, 0x08, 0x04,
+0xFC, 0x04, 0xFA, 0xFC, 0xFA, 0x05, 0xFC, 0xFC, 0x00, 0x02, 0x04, 0x03, 0xF9, 0x03, 0xF9, 0x06,
+0xFA, 0xF5, 0x06, 0xF7, 0x04, 0xF4, 0xF8, 0xFC, 0x03, 0xFB, 0x02, 0xFE, 0xFC, 0x02, 0x04, 0x08,
+0xF9, 0x00, 0xFA, 0xF9, 0xFD, 0x03, 0xFB, 0xFB, 0x00, 0x03, 0x09, 0x04, 0xF6, 0x03, 0x01, 0x06,
+0xFB, 0xFA, 0x08, 0xFB, 0x02, 0xFD, 0xFC, 0xFB, 0x04, 0xFD, 0x06, 0xFA, 0xFC, 0x02, 0x05, 0x07,
+0xFC, 0x04, 0xFB, 0xFC, 0xF9, 0x05, 0xFA, 0xFB, 0x02, 0x02, 0x01, 0x06, 0xFE, 0x04, 0xFB, 0x09,
+0xFB, 0xFE, 0x01, 0xFC, 0x04, 0xFD, 0xF7, 0xFE, 0x05, 0xFC, 0x06, 0xFD, 0xFC, 0x01, 0x09, 0x07,
+0xFC, 0x03, 0xFB, 0xFA, 0xF9, 0x05, 0xFA, 0xFD, 0x02, 0x02, 0x06, 0x06, 0xFA, 0x06, 0xFA, 0x06,
+0xF9, 0xF9, 0x08, 0xFD, 0x06, 0xFD, 0xFD, 0xFC, 0x04, 0xFC, 0x06, 0xFA, 0xFE, 0x04, 0x03, 0x06,
+0xFC, 0x03, 0xFC, 0xFC, 0xFA, 0x03, 0xFD, 0xFA, 0x02, 0x02, 0x04, 0x06, 0xFA, 0x04, 0xFB, 0x06,
+0xFC, 0xFA, 0x04, 0xFA, 0x05, 0xFA, 0xFC, 0xFB, 0x05, 0xFB, 0x05, 0xFB, 0xFA, 0x05, 0x05, 0x07,
+0xFB, 0x04, 0xFA, 0xFB, 0xFC, 0x04, 0xFB, 0xFC, 0x05, 0x01, 0x07, 0x06, 0xFC, 0x07, 0xFB, 0x08,
+0xFA, 0xFB, 0x05, 0xFB, 0x05, 0xFA, 0xFC, 0xFB, 0x04, 0xFB, 0x06, 0xF9, 0xFC, 0x05, 0x04, 0x05,
+0xFB, 0x05, 0xFC, 0xF9, 0xFB, 0x05, 0xFA, 0xFC, 0x06, 0x01, 0x06, 0x05, 0xFA, 0x06, 0xFB, 0x07,
+0xFC, 0xFA, 0x05, 0xFB, 0x05, 0xFD, 0xFA, 0xFB, 0x04, 0xFA, 0x04, 0xFB, 0xFD, 0x05, 0x05, 0x05,
+0xFC, 0x04, 0xFC, 0xFC, 0xF9, 0x03, 0xFB, 0xFA, 0x04, 0x02, 0x03, 0x05, 0xFF, 0x05, 0xFA, 0x04,
+0xFC, 0xF9, 0x04, 0xFA, 0x05, 0xFC, 0xFE, 0xF7, 0x05, 0xFC, 0x05, 0xFB, 0xFD, 0x04, 0x06, 0x05,
+0xFA, 0x06, 0xFB, 0xFC, 0xFC, 0x07, 0xFB, 0xFE, 0x04, 0x02, 0x05, 0x04, 0xFB, 0x06, 0xFE, 0x04,
+0xFE, 0xFC, 0x06, 0xFA, 0x03, 0xFC, 0xFA, 0xFF, 0x02, 0xFD, 0x03, 0xFD, 0xF9, 0x04, 0x02, 0x06,
+0xFE, 0x07, 0xF7, 0xFD, 0xF6, 0x09, 0xF9, 0xFA, 0x05, 0x02, 0x03, 0x08, 0xFD, 0x01, 0xFC, 0x04,
+0xFF, 0xF7, 0x08, 0xFC, 0x05, 0xFE, 0xF8, 0xFE, 0x05, 0x02, 0x04, 0xFD, 0xFD, 0x03, 0x03, 0x00,
+0xFD, 0x05, 0xFD, 0xFC, 0xFC, 0x04, 0x01, 0xF7, 0x06, 0x03, 0x06, 0x08, 0xF7, 0x01, 0xFB, 0x0A,
+0xFA, 0xFB, 0x05, 0xFB, 0x04, 0xFA, 0xFC, 0xFC, 0x04, 0xFD, 0x05, 0xFD, 0xFB, 0x01, 0x04, 0x05,
+0xFB, 0x03, 0xFB, 0xFB, 0xFB, 0x05, 0xFB, 0xF9, 0x04, 0x02, 0x06, 0x05, 0xFB, 0x06, 0xFC, 0x07,
+0xFC, 0xFB, 0x06, 0xFC, 0x06, 0xFB, 0xFE, 0xFC, 0x04, 0xFB, 0x05, 0xFC, 0xFE, 0x06, 0x04, 0x04,
+0xFB, 0x04, 0xFD, 0xFB, 0xFB, 0x03, 0xFD, 0xFC, 0x04, 0x01, 0x06, 0x07, 0xFB, 0x07, 0xFB, 0x08,
+0xFB, 0xFA, 0x04, 0xFB, 0x05, 0xFB, 0xFC, 0xFA, 0x04, 0xFC, 0x06, 0xFC, 0xFC, 0x05, 0x05, 0x04,
+0xFC, 0x06, 0xFB, 0xFB, 0xFC, 0x05, 0xFB, 0xFC, 0x06, 0x02, 0x05, 0x05, 0xFD, 0x09, 0xFC, 0x07,
+0xFA, 0xFB, 0x04, 0xFA, 0x04, 0xFB, 0xFD, 0xFD, 0x06, 0xFB, 0x04, 0xFB, 0xFD, 0x05, 0x05, 0x06,
+0xFA, 0x02, 0xFB, 0xFA, 0xFB, 0x06, 0xFB, 0xFD, 0x05, 0x01, 0x05, 0x05, 0xFD, 0x08, 0xFC, 0x07,
+0xFD, 0xFB, 0x04, 0xFC, 0x05, 0xFB, 0xFB, 0xF8, 0x04, 0xFA, 0x07, 0xFC, 0xFD, 0x06, 0x04, 0x04,
+0xFD, 0x09, 0xFB, 0xFC, 0xF8, 0x03, 0xFB, 0xFB, 0x04, 0x02, 0x03, 0x05, 0xFF, 0x03, 0xFC, 0x05,
+0xFC, 0xFC, 0x03, 0xFB, 0x05, 0xFB, 0xFD, 0xFE, 0x04, 0xFB, 0x05, 0xFC, 0xFC, 0x03, 0x06, 0x06,
+0xFB, 0x03, 0xFB, 0xFB, 0xFB, 0x04, 0xFA, 0xFB, 0x05, 0x02, 0x06, 0x06, 0xFD, 0x04, 0xFC, 0x05,
+0xFD, 0xFB, 0x02, 0xFA, 0x04, 0xFE, 0xFC, 0x00, 0x04, 0xFE, 0x08, 0xFE, 0xF6, 0x00, 0x08, 0x0A,
+0xFA, 0x02, 0xFC, 0xFC, 0xF5, 0x01, 0xF7, 0xFB, 0xFD, 0x02, 0x07, 0x06, 0xFC, 0x06, 0xFF, 0x06,
+0xFA, 0xFC, 0x03, 0xFB, 0x03, 0xFA, 0xFB, 0xFD, 0x06, 0xFA, 0x04, 0xFF, 0xF6, 0xFF, 0x04, 0x08,
+0xFB, 0x02, 0xF8, 0xFE, 0xFF, 0x05, 0xF9, 0xFC, 0x01, 0x03, 0x06, 0x03, 0xFE, 0x03, 0xFE, 0x07,
+0xFB, 0xFB, 0x03, 0xFA, 0x02, 0xF8, 0xFA, 0xF7, 0x04, 0xFD, 0x04, 0xFC, 0xF8, 0x01, 0x03, 0x04,
+0xFC, 0x06, 0xFD, 0xFC, 0xF8, 0x04, 0xFE, 0xF9, 0x04, 0x02, 0x06, 0x03, 0xFF, 0x05, 0xFE, 0x05,
+0xFB, 0xFB, 0x05, 0xFC, 0x05, 0xFA, 0xFD, 0xFB, 0x04, 0xFB, 0x05, 0xFC, 0xFB, 0x04, 0x04, 0x06,
+0xFB, 0x05, 0xFD, 0xFC, 0xFB, 0x03, 0xFC, 0xFC, 0x03, 0x02, 0x06, 0x04, 0xFD, 0x08, 0xFC, 0x07,
+0xFC, 0xFA, 0x03, 0xFB, 0x05, 0xFC, 0xFA, 0xFC, 0x05, 0xFB, 0x03, 0xFB, 0xFB, 0x06, 0x04, 0x06,
+0xFB, 0x03, 0xFB, 0xFC, 0xFC, 0x04, 0xFC, 0xFD, 0x05, 0x02, 0x04, 0x04, 0xFC, 0x08, 0xFC, 0x08,
+0xFC, 0xFD, 0x04, 0xFB, 0x05, 0xFA, 0xFC, 0xFD, 0x05, 0xFB, 0x04, 0xFA, 0xFD, 0x05, 0x04, 0x06,
+0xF9, 0x02, 0xFC, 0xFB, 0xFC, 0x04, 0xFC, 0xFD, 0x05, 0x02, 0x06, 0x04, 0xFD, 0x09, 0xFB, 0x07,
+0xFA, 0xFB, 0x04, 0xFB, 0x06, 0xFB, 0xFD, 0xFC, 0x04, 0xFC, 0x06, 0xFC, 0xFC, 0x03, 0x05, 0x05,
+0xFC, 0x03, 0xFC, 0xFB, 0xFB, 0x04, 0xFC, 0xFB, 0x05, 0x02, 0x04, 0x05, 0xFD, 0x06, 0xFB, 0x07,
+0xFD, 0xFB, 0x06, 0xFA, 0x03, 0xFD, 0xFE, 0xF8, 0x04, 0xFE, 0x06, 0xFC, 0xFA, 0x02, 0x05, 0x05,
+0xFC, 0x06, 0xFC, 0xFC, 0xFF, 0x04, 0xFB, 0xF8, 0x04, 0x03, 0x06, 0x05, 0xFD, 0x03, 0xFA, 0x04,
+0xFF, 0xFB, 0x05, 0xFA, 0x01, 0xFC, 0xFE, 0xFE, 0x00, 0xFB, 0x05, 0xFD, 0xF8, 0x04, 0x04, 0x06,
+0xFD, 0x06, 0xFC, 0xFB, 0xFB, 0x05, 0xF9, 0xF8, 0x03, 0x03, 0x01, 0x08, 0xFE, 0x04, 0xFE, 0x04,
+0xFF, 0xF6, 0x03, 0xFC, 0x07, 0xFD, 0xF9, 0xF7, 0x01, 0xFF, 0x04, 0xFE, 0xFE, 0x06, 0x00, 0x07,
+0xFF, 0x0B, 0xFF, 0xFA, 0xF9, 0x0B, 0xF8, 0xFC, 0x02, 0x02, 0x03, 0x06, 0xFF, 0x05, 0xFC, 0x04,
+0xFB, 0xFA, 0x05, 0xFB, 0x04, 0xFB, 0xFC, 0xFA, 0x05, 0xFC, 0x06, 0xFD, 0xFB, 0x04, 0x04, 0x07,
+0xFB, 0x03, 0xFB, 0xFB, 0xFB, 0x06, 0xFB, 0xFB, 0x04, 0x02, 0x05, 0x05, 0xFD, 0x09, 0xFB, 0x07,
+0xFC, 0xFC, 0x04, 0xFC, 0x06, 0xFC, 0xFC, 0xFC, 0x05, 0xFD, 0x04, 0xFB, 0xFC, 0x05, 0x04, 0x06,
+0xFC, 0x03, 0xFB, 0xFB, 0xFC, 0x04, 0xFB, 0xFB, 0x05, 0x02, 0x05, 0x04, 0xFE, 0x09, 0xFA, 0x08,
+0xFB, 0xFB, 0x06, 0xFB, 0x05, 0xFA, 0xFB, 0xFC, 0x04, 0xFD, 0x05, 0xFC, 0xFB, 0x04, 0x04, 0x05,
+0xFC, 0x02, 0xFC, 0xFC, 0xFC, 0x05, 0xFB, 0xFD, 0x04, 0x02, 0x04, 0x06, 0xFD, 0x08, 0xFB, 0x06,
+0xFB, 0xFC, 0x04, 0xFB, 0x06, 0xFB, 0xFC, 0xFB, 0x06, 0xFA, 0x04, 0xFC, 0xFC, 0x04, 0x04, 0x05,
+0xFC, 0x03, 0xFB, 0xFB, 0xFB, 0x05, 0xFC, 0xFC, 0x04, 0x02, 0x04, 0x05, 0xFD, 0x07, 0xFD, 0x06,
+0xFC, 0xFB, 0x04, 0xFB, 0x05, 0xFC, 0xFA, 0xFC, 0x05, 0xFD, 0x04, 0xFC, 0xFA, 0x05, 0x03, 0x04,
+0xFB, 0x04, 0xFB, 0xFB, 0xFC, 0x04, 0xFC, 0xFC, 0x05, 0x02, 0x04, 0x05, 0xFD, 0x07, 0xFA, 0x06,
+0xFB, 0xFB, 0x04, 0xFB, 0x05, 0xFB, 0xFE, 0xFB, 0x05, 0xFD, 0x06, 0xFD, 0xFC, 0x04, 0x04, 0x06,
+0xFB, 0x05, 0xFC, 0xFB, 0xFB, 0x06, 0xFA, 0xFC, 0x06, 0x02, 0x05, 0x06, 0xFB, 0x0A, 0xFB, 0x08,
+0xF7, 0xF5, 0x03, 0xFA, 0x0A, 0xFC, 0xFC, 0xF7, 0x01, 0x01, 0x02, 0xFC, 0xFB, 0xFD, 0x0A, 0x05,
+0xFC, 0x00, 0xFB, 0xFC, 0xFA, 0x07, 0xFB, 0xF7, 0x07, 0x02, 0x09, 0x01, 0xFB, 0x00, 0xFD, 0x02,
+0xFC, 0xF6, 0x02, 0xFA, 0x05, 0xF9, 0x00, 0xF8, 0x03, 0x01, 0x09, 0xFE, 0xFE, 0x02, 0x01, 0x03,
+0xFF, 0x09, 0xF8, 0xFE, 0xFE, 0x09, 0xF8, 0xFC, 0x01, 0x02, 0x02, 0x02, 0xF9, 0x05, 0xF9, 0x03,
+0xFB, 0xFB, 0x03, 0xFD, 0x05, 0xFB, 0xFB, 0xFC, 0x04, 0xFC, 0x05, 0xFC, 0xFC, 0x04, 0x03, 0x06,
+0xFA, 0x05, 0xFC, 0xFC, 0xFC, 0x04, 0xFB, 0xFD, 0x05, 0x02, 0x05, 0x06, 0xFD, 0x09, 0xFC, 0x07,
+0xFC, 0xFB, 0x06, 0xFB, 0x04, 0xFB, 0xFC, 0xFE, 0x05, 0xFC, 0x04, 0xFA, 0xFB, 0x03, 0x05, 0x06,
+0xFB, 0x05, 0xFA, 0xFC, 0xFB, 0x01, 0xFB, 0xFD, 0x04, 0x02, 0x05, 0x03, 0xFF, 0x04, 0xF9, 0x03,
+0xFB, 0xFA, 0x06, 0xFA, 0x04, 0xFB, 0xFC, 0xFB, 0x04, 0xFD, 0x03, 0xFC, 0xFD, 0x05, 0x04, 0x05,
+0xFC, 0x04, 0xFD, 0xFD, 0xFB, 0x06, 0xFB, 0xFC, 0x04, 0x01, 0x04, 0x06, 0xFC, 0x07, 0xFC, 0x06,
+0xFD, 0xFD, 0x06, 0xFC, 0x05, 0xFA, 0xFD, 0xFA, 0x05, 0xFC, 0x04, 0xFC, 0xFC, 0x06, 0x04, 0x03,
+0xFB, 0x04, 0xFB, 0xFB, 0xFC, 0x04, 0xFB, 0xFD, 0x05, 0x02, 0x05, 0x06, 0xFC, 0x07, 0xFC, 0x06,
+0xFB, 0xFD, 0x05, 0xFD, 0x05, 0xFF, 0xFA, 0xF9, 0x04, 0xFC, 0x06, 0xFB, 0xFC, 0x02, 0x04, 0x05,
+0xFB, 0x01, 0xFA, 0xFB, 0xFC, 0x06, 0xF9, 0xFC, 0x06, 0x01, 0x06, 0x04, 0xFE, 0x05, 0xFF, 0x05,
+0xFB, 0xFD, 0x03, 0xFC, 0x05, 0xFC, 0xFD, 0xFB, 0x05, 0xFA, 0x05, 0xFC, 0xFB, 0x06, 0x04, 0x05,
+0xFD, 0x06, 0xFC, 0xFD, 0xFD, 0x05, 0xFD, 0xFD, 0x05, 0x02, 0x05, 0x05, 0xFB, 0x09, 0xFD, 0x07,
+0xFE, 0xFD, 0x04, 0xF8, 0x02, 0xF5, 0xFF, 0xFF, 0x04, 0xFB, 0x05, 0xFD, 0xF6, 0x02, 0x04, 0x06,
+0xFD, 0x03, 0xFF, 0xFA, 0xFC, 0x08, 0xF8, 0xFA, 0x03, 0x01, 0x08, 0x01, 0xFC, 0x03, 0xFE, 0x07,
+0xFC, 0xF8, 0x03, 0xFD, 0x04, 0xFD, 0xFC, 0xFF, 0x04, 0xFB, 0x05, 0xFC, 0xF9, 0x02, 0x07, 0x03,
+0xFB, 0x06, 0xFF, 0xFC, 0xFA, 0x04, 0xFF, 0xFD, 0x06, 0x02, 0x04, 0x06, 0xFE, 0x04, 0x00, 0x01,
+0xFC, 0xFF, 0x08, 0xFE, 0x04, 0xFC, 0xFA, 0xFE, 0x05, 0x01, 0x07, 0x01, 0xFD, 0x03, 0x02, 0x07,
+0xFE, 0x05, 0xF9, 0xF9, 0xFC, 0x09, 0xFB, 0xFD, 0x05, 0x03, 0x05, 0x01, 0xF9, 0x01, 0xF7, 0x05,
+0xFC, 0xFD, 0x05, 0xFB, 0x02, 0xFB, 0xFC, 0xFB, 0x02, 0xFD, 0x05, 0xFA, 0xFB, 0x03, 0x05, 0x06,
+0xFB, 0x04, 0xFD, 0xFC, 0xFC, 0x06, 0xFD, 0xFD, 0x04, 0x02, 0x05, 0x03, 0xFF, 0x05, 0xFB, 0x04,
+0xFF, 0xFC, 0x06, 0xFF, 0x03, 0xF9, 0xF8, 0xF5, 0x01, 0xFD, 0x07, 0xFD, 0xFE, 0x04, 0x04, 0x01,
+0xFA, 0x0B, 0xFB, 0xFA, 0xFA, 0x07, 0xF9, 0xFE, 0x01, 0x01, 0x03, 0x06, 0xFF, 0x04, 0xF8, 0x01,
+0xFB, 0xF6, 0x05, 0xFB, 0x01, 0xFF, 0xFD, 0xFB, 0xFF, 0xFB, 0x07, 0x00, 0xFD, 0xFF, 0x0A, 0x0A,
+0xFA, 0x06, 0x00, 0xFD, 0xFB, 0x06, 0xFE, 0xF7, 0x07, 0x01, 0x05, 0x01, 0xF9, 0x06, 0xF8, 0x0A,
+0xFC, 0xFB, 0x02, 0xFA, 0x03, 0xFC, 0xF9, 0xFB, 0x05, 0xFD, 0x05, 0xFD, 0xFC, 0x03, 0x06, 0x06,
+0xFB, 0x03, 0xFA, 0xFC, 0xFC, 0x04, 0xFB, 0xFC, 0x04, 0x01, 0x04, 0x05, 0xFC, 0x02, 0xFC, 0x03,
+0xFE, 0xFF, 0x02, 0xF9, 0x08, 0xFB, 0xF8, 0xFA, 0x05, 0xFF, 0x05, 0xFB, 0xF9, 0xFE, 0x0A, 0x08,
+0xFF, 0x03, 0xFB, 0xFE, 0xFF, 0x08, 0xFF, 0xF7, 0x03, 0x02, 0x03, 0x03, 0xFD, 0x00, 0xF7, 0x03,
+0xFF, 0xFE, 0x02, 0xFE, 0x02, 0xFC, 0xFB, 0xF9, 0x06, 0x02, 0x06, 0x00, 0xFD, 0x03, 0x02, 0x05,
+0xFD, 0x0C, 0xFB, 0xFF, 0xFE, 0x09, 0xFD, 0xFB, 0x06, 0x00, 0x04, 0x05, 0xFC, 0x02, 0xFA, 0x05,
+0xFC, 0xFD, 0x00, 0xF9, 0x06, 0xF7, 0xF9, 0xFD, 0x01, 0xFE, 0x04, 0xFD, 0xF8, 0x05, 0x04, 0x08,
+0x01, 0x07, 0x00, 0xFE, 0xFE, 0x05, 0xFC, 0xFC, 0xFC, 0x00, 0x06, 0xFE, 0xFC, 0xFF, 0xFC, 0x07,
+0x00, 0xFA, 0xFE, 0xFF, 0x05, 0xFB, 0xFF, 0xF9, 0x04, 0xF9, 0xFC, 0xFB, 0x00, 0x06, 0x03, 0x06,
+0x02, 0x06, 0x01, 0xF9, 0xF8, 0x04, 0xFA, 0xFB, 0x05, 0x02, 0xFF, 0x07, 0xF8, 0x02, 0xFF, 0x00,
+0xFE, 0xFC, 0x01, 0xF7, 0x06, 0xF9, 0xFC, 0xFE, 0x06, 0x03, 0x04, 0xFF, 0xFC, 0xF9, 0x01, 0x05,
+0xF7, 0x03, 0xF8, 0x01, 0xF5, 0x06, 0xFE, 0xFC, 0x00, 0xFF, 0x0A, 0x08, 0xF9, 0x05, 0xF9, 0x04,
+0xFB, 0xFD, 0x00, 0xF8, 0x07, 0xFB, 0xFB, 0xFC, 0x02, 0xFE, 0x09, 0x02, 0xFE, 0xFB, 0x09, 0x07,
+0x02, 0x0B, 0xF6, 0xFE, 0xF7, 0x04, 0xFF, 0xF8, 0xFF, 0x03, 0x02, 0x05, 0xFB, 0x05, 0xFB, 0x07,
+0xFD, 0xFD, 0x0A, 0x00, 0x01, 0xFC, 0xFB, 0xF7, 0xFF, 0x00, 0x07, 0xF9, 0xF5, 0xFD, 0x08, 0x02,
+0xFF, 0x00, 0xFB, 0xFA, 0xF7, 0x04, 0xFC, 0xF7, 0x02, 0x03, 0x01, 0x01, 0x03, 0x07, 0xF5, 0x02,
+0x00, 0xF7, 0x03, 0xFE, 0x09, 0xFE, 0x00, 0xFD, 0x04, 0x01, 0x00, 0xFC, 0xFB, 0xFB, 0x07, 0x08,
+0xFA, 0x09, 0xFC, 0xF7, 0xFE, 0x08, 0xFC, 0xFA, 0x00, 0x01, 0x03, 0x00, 0xFF, 0x05, 0xF7, 0x04,
+0xF6, 0xF7, 0x00, 0x03, 0x02, 0xF7, 0xF9, 0xFF, 0x08, 0xFF, 0x04, 0xF8, 0xFC, 0x07, 0x03, 0x08,
+0x01, 0x06, 0xFD, 0xFD, 0xF6, 0xFC, 0xFE, 0xFB, 0x03, 0x03, 0x01, 0x01, 0xFE, 0xFE, 0x02, 0x01,
+0xFE, 0xF9, 0x03, 0xFB, 0x02, 0xF7, 0xFB, 0xF8, 0xFC, 0x06, 0x0A, 0x06, 0xFA, 0x03, 0x07, 0x07,
+0xFD, 0x03, 0xFE, 0x01, 0x01, 0x0B, 0xF8, 0xF6, 0xFE, 0x03, 0x05, 0x04, 0xFE, 0x05, 0xFB, 0xFD,
+0xF8, 0xFA, 0xFF, 0xFE, 0x03, 0xFA, 0x01, 0xFA, 0x08, 0xFA, 0x07, 0xFF, 0xFB, 0xF8, 0x01, 0xFE,
+0xF9, 0x01, 0xFE, 0xFB, 0xF8, 0x08, 0xF6, 0xF9, 0x01, 0x04, 0x05, 0xFF, 0xF9, 0x04, 0xFD, 0x03,
+0xFE, 0xF8, 0xFF, 0xFB, 0x06, 0xFF, 0xFE, 0xF9, 0x01, 0xF9, 0x08, 0xFD, 0xFF, 0x00, 0x07, 0x07,
+0xF8, 0x02, 0xFD, 0xFA, 0xFF, 0x06, 0xFD, 0x01, 0x03, 0x05, 0x02, 0x05, 0xFB, 0x04, 0xFF, 0x01,
+0xFA, 0xFC, 0x02, 0xFF, 0x01, 0xF8, 0xFF, 0xF6, 0x04, 0xFF, 0x06, 0xFA, 0xFC, 0xFF, 0x02, 0x06,
+0xFA, 0x02, 0xFC, 0xFB, 0xF8, 0x02, 0xF9, 0x00, 0x02, 0x01, 0x05, 0x08, 0xFE, 0x06, 0xF8, 0x08,
+0xFB, 0xFB, 0x08, 0xF9, 0x06, 0xFA, 0xFD, 0xFB, 0x08, 0xFC, 0x04, 0xFE, 0xFE, 0x03, 0x08, 0x02,
+0xFA, 0x02, 0xFD, 0x00, 0xFB, 0x03, 0xFF, 0xFE, 0x09, 0x02, 0x04, 0x04, 0x00, 0x09, 0xFE, 0x04,
+0xFB, 0xFD, 0x06, 0xF9, 0x04, 0xFC, 0xFB, 0xFA, 0x01, 0xFE, 0x04, 0xFA, 0xFB, 0x02, 0x04, 0x02,
+0xFE, 0x06, 0xFB, 0xFC, 0xFA, 0x03, 0xFA, 0xF8, 0x02, 0x02, 0x05, 0x02, 0xFC, 0x03, 0xFD, 0x07,
+0xF8, 0xFB, 0x02, 0xFD, 0x03, 0xFF, 0xFE, 0xFA, 0x04, 0xFC, 0x04, 0xFE, 0xF7, 0x01, 0x05, 0x03,
+0xFE, 0x08, 0xFA, 0xF9, 0xFD, 0x0A, 0xFA, 0xFC, 0x05, 0x02, 0x05, 0x01, 0xFD, 0x01, 0xFD, 0x07,
+0xF8, 0xFF, 0x09, 0xFE, 0x07, 0xFF, 0xF6, 0xF4, 0x02, 0xFD, 0x01, 0x01, 0xF9, 0xFE, 0x01, 0x00,
+0xF8, 0x02, 0xFD, 0xF7, 0xFC, 0x0B, 0xF8, 0xFC, 0x03, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x04,
+0xFE, 0xF6, 0x07, 0xFE, 0x0A, 0xF8, 0xF7, 0xFA, 0x03, 0x02, 0x00, 0x05, 0xFD, 0xFF, 0x09, 0x00,
+0x00, 0x0C, 0x00, 0xFF, 0xFF, 0x07, 0xF4, 0xF7, 0x02, 0xFF, 0xFE, 0xFF, 0xFD, 0x00, 0xF6, 0xFF,
+0x00, 0xF6, 0x05, 0xFF, 0xFF, 0x00, 0xF8, 0xFE, 0x06, 0xFC, 0x07, 0xFB, 0xF6, 0x00, 0x05, 0x02,
+0xFF, 0x02, 0xF8, 0xFC, 0xFD, 0x02, 0xF4, 0xFF, 0xFE, 0x00, 0x0B, 0x0A, 0xFE, 0x02, 0xFE, 0x01,
+0xFB, 0xFC, 0x05, 0x00, 0x01, 0xFA, 0xFF, 0xFA, 0x02, 0x01, 0x08, 0xFD, 0xF7, 0x01, 0x02, 0x03,
+0xFF, 0x0A, 0xFB, 0xF7, 0xF9, 0x03, 0xFB, 0xFF, 0x06, 0x02, 0x0A, 0x06, 0xF7, 0x04, 0xFA, 0x03,
+0xFB, 0xFF, 0x03, 0xFD, 0x03, 0xFC, 0xF9, 0xFD, 0x03, 0xFC, 0x04, 0xFD, 0xFB, 0x02, 0x05, 0x06,
+0xFC, 0x04, 0xFB, 0xFA, 0xF9, 0x06, 0xFB, 0xF9, 0x06, 0x01, 0x06, 0x03, 0xFD, 0x07, 0xFC, 0x09,
+0xFC, 0xFB, 0x02, 0xFB, 0x06, 0xFB, 0xFF, 0xFA, 0x05, 0xF9, 0x03, 0xFD, 0xFC, 0x05, 0x03, 0x05,
+0xFB, 0x02, 0xFC, 0xFB, 0xFC, 0x04, 0xFD, 0xFC, 0x03, 0x01, 0x04, 0x06, 0xFB, 0x07, 0xFB, 0x04,
+0xFC, 0xFE, 0x08, 0xF8, 0x03, 0xFD, 0xF7, 0x00, 0x03, 0xFE, 0x04, 0xFD, 0xFB, 0x02, 0x04, 0x07,
+0xFC, 0x08, 0xFC, 0xFC, 0xFE, 0x08, 0xFD, 0xFB, 0x02, 0x02, 0x05, 0x02, 0xFA, 0x06, 0xFD, 0x05,
+0xFE, 0xFA, 0x04, 0xFD, 0x02, 0xFB, 0xFE, 0xFE, 0x03, 0xFE, 0x05, 0xFB, 0xF9, 0x03, 0x07, 0x03,
+0xFA, 0x04, 0xFC, 0xFB, 0xF7, 0x04, 0xF8, 0xF7, 0x03, 0x02, 0x06, 0x04, 0xFA, 0x04, 0xF8, 0x04,
+0xF8, 0xFF, 0x05, 0xFB, 0x04, 0xF7, 0xFC, 0xF9, 0x05, 0xFD, 0x00, 0xFB, 0xFC, 0x01, 0x03, 0x03,
+0xF9, 0x03, 0xF9, 0xFB, 0xFE, 0x06, 0xFB, 0x00, 0x03, 0x02, 0x07, 0x04, 0xFC, 0x06, 0xFB, 0x04,
+0xF9, 0xFC, 0x06, 0xFC, 0xFE, 0x00, 0xF9, 0xFD, 0x08, 0x03, 0x00, 0x01, 0xF8, 0x01, 0x04, 0x04,
+0xFC, 0x08, 0xFF, 0x01, 0xF9, 0x09, 0xFF, 0xFB, 0x0A, 0x05, 0x09, 0x06, 0x01, 0x04, 0xFE, 0x02,
+0xFE, 0xFC, 0x06, 0xFF, 0x03, 0xFB, 0xF8, 0xFA, 0x0A, 0xFD, 0x02, 0xFD, 0xFC, 0xFC, 0x09, 0xFE,
+0xF8, 0xFF, 0xF9, 0xFC, 0xF7, 0xFD, 0x02, 0x00, 0x08, 0xFE, 0x08, 0x09, 0xF6, 0x08, 0xF8, 0x02,
+0xF9, 0xF9, 0x07, 0xF8, 0x04, 0xFA, 0xFA, 0xFC, 0x01, 0xFC, 0x04, 0xFB, 0xFC, 0x03, 0x04, 0x04,
+0xFC, 0x07, 0x00, 0xFA, 0xFC, 0x09, 0xF8, 0xFF, 0x04, 0x02, 0x03, 0x04, 0xFE, 0x01, 0xFE, 0x06,
+0xFC, 0xFB, 0x04, 0xFB, 0x04, 0xFB, 0xFC, 0xFC, 0x05, 0xFB, 0x03, 0xFD, 0xFC, 0x04, 0x06, 0x05,
+0xFC, 0x02, 0xFB, 0xFC, 0xFB, 0x04, 0xFC, 0xFB, 0x04, 0x02, 0x04, 0x06, 0xFC, 0x07, 0xFC, 0x07,
+0xFB, 0xFD, 0x05, 0xFC, 0x06, 0xFB, 0xFD, 0xFC, 0x06, 0xFB, 0x04, 0xFD, 0xFC, 0x05, 0x04, 0x04,
+0xFB, 0x03, 0xFC, 0xFB, 0xFC, 0x04, 0xFC, 0xFD, 0x04, 0x02, 0x06, 0x05, 0xFC, 0x0B, 0xFC, 0x08,
+0xFB, 0xFB, 0x04, 0xFC, 0x05, 0xFC, 0xFB, 0xFC, 0x03, 0xFC, 0x05, 0xFD, 0xFC, 0x02, 0x05, 0x05,
+0xFD, 0x05, 0xFC, 0xFB, 0xFC, 0x05, 0xFB, 0xFB, 0x04, 0x01, 0x04, 0x05, 0xFA, 0x08, 0xFA, 0x07,
+0xFB, 0xFC, 0x03, 0xFB, 0x04, 0xFB, 0xFC, 0xFA, 0x05, 0xFC, 0x05, 0xFD, 0xFB, 0x05, 0x04, 0x04,
+0xFC, 0x04, 0xFB, 0xFB, 0xFC, 0x05, 0xFB, 0xFB, 0x04, 0x02, 0x05, 0x04, 0xFB, 0x04, 0xFC, 0x06,
+0xFB, 0xFB, 0x01, 0xFE, 0x04, 0xF7, 0xF8, 0xF9, 0x04, 0xFD, 0x03, 0xFD, 0xF8, 0x05, 0x01, 0x04,
+0xFC, 0x02, 0xFB, 0xFD, 0xFF, 0x05, 0xFB, 0xF7, 0x03, 0x02, 0x03, 0x08, 0xFE, 0x04, 0xFE, 0x09,
+0xFA, 0xFD, 0x04, 0xFE, 0x05, 0xF6, 0x01, 0xFC, 0x09, 0xF9, 0x01, 0xFC, 0xFA, 0x04, 0x00, 0x06,
+0x02, 0x0B, 0xFB, 0x02, 0x01, 0x04, 0x01, 0xFD, 0x03, 0x00, 0x06, 0x0B, 0xFA, 0x04, 0xF8, 0x06,
+0x01, 0xFF, 0x01, 0xFE, 0xFE, 0xFA, 0xF9, 0xF8, 0x02, 0xFD, 0x08, 0xFE, 0xF6, 0xFF, 0x02, 0x01,
+0xFC, 0x00, 0xFD, 0xF8, 0xFE, 0x06, 0xFE, 0xF7, 0x04, 0x02, 0x0A, 0x03, 0xFF, 0x06, 0xFE, 0x04,
+0xFE, 0xFB, 0x08, 0x00, 0x04, 0xFD, 0xFD, 0xF9, 0x01, 0x03, 0x08, 0xFD, 0xFD, 0x06, 0x06, 0x04,
+0xFD, 0x09, 0xFE, 0xFB, 0xFB, 0x02, 0xFE, 0xF9, 0x06, 0x01, 0x07, 0x06, 0xFF, 0x04, 0xFD, 0x08,
+0xFC, 0xFB, 0x05, 0xFB, 0x04, 0xFC, 0xFE, 0xFB, 0x06, 0xFB, 0x04, 0xFC, 0xFD, 0x05, 0x05, 0x05,
+0xFC, 0x05, 0xFD, 0xFC, 0xFC, 0x07, 0xFB, 0xFC, 0x05, 0x02, 0x04, 0x05, 0xFB, 0x0A, 0xFB, 0x06,
+0xFB, 0xFB, 0x04, 0xFC, 0x05, 0xFB, 0xFC, 0xFC, 0x05, 0xFC, 0x04, 0xFC, 0xFC, 0x05, 0x04, 0x05,
+0xFB, 0x04, 0xFC, 0xFB, 0xFC, 0x04, 0xFB, 0xFC, 0x04, 0x02, 0x05, 0x05, 0xFC, 0x08, 0xFC, 0x07,
+0xFC, 0xFB, 0x04, 0xFC, 0x04, 0xFB, 0xFB, 0xFB, 0x05, 0xFC, 0x05, 0xFB, 0xFB, 0x04, 0x04, 0x04,
+0xFD, 0x05, 0xFB, 0xFC, 0xFB, 0x05, 0xFC, 0xFB, 0x04, 0x02, 0x04, 0x05, 0xFD, 0x08, 0xFD, 0x07,
+0xFA, 0xFC, 0x06, 0xFC, 0x05, 0xFB, 0xFA, 0xFA, 0x05, 0xFB, 0x05, 0xFD, 0xFC, 0x05, 0x05, 0x04,
+0xFA, 0x03, 0xFD, 0xFC, 0xFC, 0x03, 0xFB, 0xFC, 0x05, 0x02, 0x05, 0x06, 0xFE, 0x06, 0xFB, 0x05,
+0xF9, 0xFD, 0x0B, 0xFD, 0x02, 0xFB, 0xFC, 0xF7, 0xFF, 0x01, 0x06, 0xFF, 0xFF, 0x01, 0x05, 0x04,
+0xFD, 0x04, 0xFA, 0xFD, 0xF6, 0x05, 0xFC, 0xFA, 0x01, 0x05, 0x05, 0x07, 0xFB, 0x04, 0xFC, 0x02,
+0xFE, 0x01, 0x05, 0xFC, 0xFE, 0xFA, 0xF8, 0x00, 0x05, 0x02, 0x0A, 0xFD, 0xFB, 0x00, 0x05, 0x02,
+0xFE, 0x0B, 0xFD, 0xFD, 0xF6, 0x04, 0xFB, 0xF7, 0xFF, 0x02, 0x05, 0x04, 0xF4, 0xFF, 0xFF, 0x00,
+0xFA, 0xF7, 0x0A, 0xFC, 0x03, 0xFB, 0xFB, 0xF5, 0x00, 0x05, 0x0A, 0xFF, 0xFE, 0x02, 0x05, 0x02,
+0xFE, 0x02, 0xFE, 0xFE, 0xF9, 0x01, 0xF7, 0xFA, 0xFC, 0x02, 0x01, 0x04, 0xFB, 0x03, 0xFB, 0xFF,
+0xFD, 0xFC, 0x06, 0xF8, 0x01, 0xFB, 0xFD, 0xFB, 0x01, 0xFF, 0x08, 0xFF, 0xF8, 0x02, 0x03, 0x06,
+0xFC, 0x07, 0xFB, 0xFB, 0xF8, 0x09, 0xFE, 0xFC, 0x05, 0x02, 0x05, 0x06, 0xFE, 0x03, 0xFC, 0x04,
+0xFC, 0xFC, 0x07, 0xFA, 0x03, 0xFC, 0xFD, 0xFA, 0x05, 0xFE, 0x04, 0xFC, 0xFE, 0x03, 0x05, 0x07,
+0xFD, 0x06, 0xFC, 0xFC, 0xFD, 0x04, 0xFC, 0xFB, 0x02, 0x01, 0x05, 0x03, 0xFA, 0x07, 0xFB, 0x07,
+0xFD, 0xFB, 0x02, 0xFD, 0x04, 0xFC, 0xFC, 0xFE, 0x06, 0xFC, 0x04, 0xFB, 0xFB, 0x05, 0x03, 0x04,
+0xFD, 0x06, 0xFD, 0xFC, 0xFB, 0x06, 0xFD, 0xFA, 0x05, 0x02, 0x04, 0x03, 0xFC, 0x07, 0xFA, 0x05,
+0xFB, 0xFE, 0x06, 0xFB, 0x04, 0xFC, 0xFC, 0xFE, 0x04, 0xFD, 0x03, 0xFD, 0xFD, 0x05, 0x04, 0x03,
+0xFD, 0x06, 0xFB, 0xFC, 0xFC, 0x06, 0xFB, 0xFB, 0x04, 0x02, 0x05, 0x06, 0xFE, 0x08, 0xFC, 0x05,
+0xFD, 0xFB, 0x03, 0xFC, 0x04, 0xFA, 0xFC, 0xFA, 0x06, 0xFC, 0x05, 0xFB, 0xFD, 0x05, 0x04, 0x04,
+0xFA, 0x04, 0xFB, 0xFC, 0xFB, 0x04, 0xFC, 0xFD, 0x05, 0x02, 0x04, 0x06, 0xFD, 0x05, 0xFC, 0x05,
+0xFE, 0xFB, 0x05, 0xFA, 0x03, 0xFB, 0xFB, 0xF8, 0x04, 0xFB, 0x02, 0xFC, 0xFF, 0x03, 0x05, 0x07,
+0xFC, 0x06, 0xFC, 0xFC, 0xFD, 0x03, 0xFA, 0xFC, 0x04, 0x03, 0x03, 0x06, 0xFD, 0x04, 0xFB, 0x06,
+0xFA, 0xFC, 0x06, 0xF8, 0xFF, 0xFA, 0xFE, 0xF9, 0xFB, 0x03, 0x0A, 0x03, 0xFD, 0x00, 0x07, 0x05,
+0xFB, 0x05, 0xFA, 0xFD, 0xFF, 0x09, 0xFB, 0xFA, 0x03, 0x00, 0x03, 0x05, 0x03, 0x02, 0xF9, 0x04,
+0x00, 0x01, 0x05, 0xFD, 0xFF, 0xF7, 0xFD, 0xFB, 0x05, 0xFA, 0x02, 0x04, 0xF6, 0xFF, 0x04, 0x03,
+0xF7, 0x04, 0xF8, 0xF5, 0xFE, 0x04, 0xFA, 0xFC, 0xFF, 0x00, 0x05, 0x01, 0xFB, 0x08, 0xF7, 0x09,
+0xFB, 0xFC, 0x06, 0xFD, 0x01, 0x01, 0xF5, 0xF7, 0x05, 0xFB, 0x07, 0xFB, 0x01, 0x04, 0x09, 0xFD,
+0x04, 0x05, 0xF9, 0xFF, 0xFC, 0x04, 0xF9, 0xF8, 0xFB, 0x03, 0x09, 0xFF, 0xFA, 0xFC, 0xFE, 0x02,
+0xFB, 0xF7, 0x05, 0xFC, 0x07, 0xFE, 0xF9, 0xFE, 0x04, 0xFD, 0x02, 0xFB, 0xFF, 0x05, 0x07, 0x06,
+0x03, 0x0A, 0xFC, 0xFE, 0xF8, 0x06, 0xF7, 0xF7, 0x05, 0x01, 0x04, 0x03, 0xFC, 0xFF, 0xFC, 0x05,
+0xFD, 0xF9, 0x0A, 0xFA, 0x01, 0xFF, 0xFC, 0xF6, 0x02, 0x02, 0x03, 0xFC, 0xFE, 0x01, 0x04, 0x05,
+0xFA, 0x07, 0xF8, 0xF9, 0xFD, 0x08, 0xFC, 0xF9, 0x02, 0x01, 0x04, 0x07, 0xF9, 0x06, 0xFD, 0x08,
+0xFD, 0xFC, 0x03, 0xF9, 0x02, 0xFB, 0xFB, 0xF9, 0x04, 0xFF, 0x03, 0xFB, 0xF9, 0x05, 0x04, 0x08,
+0xFB, 0x02, 0xFC, 0xFB, 0xF6, 0x09, 0xFD, 0xFA, 0x06, 0x01, 0x01, 0x04, 0xFB, 0x02, 0xFB, 0x07,
+0xFF, 0xFC, 0x06, 0xFF, 0x04, 0xFE, 0xF9, 0xF7, 0x01, 0xFB, 0x05, 0xFB, 0xF7, 0x07, 0x02, 0x06,
+0xF8, 0x0A, 0xFB, 0xF7, 0xFE, 0x02, 0xF8, 0xFE, 0xFF, 0x02, 0x05, 0x01, 0xF9, 0x02, 0xF8, 0x00,
+0xFC, 0xFE, 0x07, 0xF4, 0x06, 0xF4, 0x00, 0xFF, 0x09, 0x01, 0x06, 0xFB, 0xFD, 0x02, 0x02, 0x01,
+0xF6, 0x05, 0x02, 0x02, 0xFF, 0xFF, 0xFB, 0x01, 0xFF, 0xFF, 0xFD, 0x07, 0xF7, 0x05, 0xF6, 0x05,
+0xF8, 0xFA, 0x01, 0xFA, 0x04, 0xF7, 0xFD, 0xF7, 0x00, 0xFE, 0x03, 0x00, 0xFB, 0x01, 0x04, 0x04,
+0x01, 0x04, 0x00, 0xFC, 0xF8, 0x03, 0xF8, 0xFD, 0x07, 0xFE, 0x08, 0x04, 0x01, 0x07, 0xF7, 0x04,
+0x03, 0xF9, 0x08, 0xFE, 0xFF, 0xF7, 0x00, 0xFB, 0xFF, 0xF9, 0x03, 0x02, 0xFB, 0xFE, 0xFD, 0x06,
+0xFB, 0x04, 0xF8, 0xFD, 0xF6, 0x09, 0xFF, 0xF6, 0x07, 0xFC, 0x05, 0x05, 0xF8, 0xFF, 0xFB, 0x03,
+0xFA, 0xFA, 0x06, 0xF8, 0x00, 0xFA, 0xF9, 0xF7, 0x04, 0x07, 0x07, 0x04, 0xFB, 0x04, 0x03, 0x04,
+0xF8, 0x06, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0xFB, 0x04, 0x00, 0x01, 0x05, 0xFF, 0xFF, 0xFC, 0x06,
+0xF8, 0xF5, 0x04, 0xFF, 0x08, 0xF9, 0x00, 0xFC, 0xFF, 0x00, 0x09, 0xFF, 0xF8, 0x03, 0x09, 0x04,
+0xFF, 0x0A, 0xF9, 0xFB, 0xFD, 0x0B, 0xFB, 0xFD, 0xFC, 0xFC, 0x03, 0x04, 0x00, 0x01, 0xFB, 0x04,
+0xFE, 0xFC, 0x03, 0xF6, 0x04, 0xFA, 0x01, 0xFE, 0x01, 0xFA, 0x06, 0xFA, 0xFB, 0x08, 0x01, 0x01,
+0x00, 0x02, 0xFC, 0xFB, 0xFE, 0x00, 0xF9, 0xFD, 0x09, 0x03, 0x06, 0x06, 0xFA, 0xFF, 0xFC, 0x08,
+0xFB, 0xFC, 0x09, 0xFF, 0x07, 0xFC, 0x01, 0xFC, 0x01, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x06, 0x08,
+0xFF, 0x0B, 0x02, 0xFA, 0xFA, 0x06, 0xFC, 0xF5, 0x09, 0xFF, 0x08, 0xFE, 0xFE, 0xFF, 0xF9, 0x01,
+0xFC, 0xFF, 0x08, 0xFD, 0x04, 0xFD, 0xFC, 0xFF, 0xFF, 0xF9, 0x03, 0x02, 0xF7, 0x03, 0x05, 0x07,
+0xF9, 0x00, 0xFC, 0xFC, 0xF7, 0x05, 0xFB, 0xF9, 0x01, 0xFD, 0x07, 0x04, 0xF9, 0x03, 0xFA, 0x06,
+0xFE, 0xFF, 0x09, 0xFB, 0xFD, 0xFB, 0x00, 0xFE, 0x01, 0x02, 0x0A, 0xFD, 0xF9, 0x03, 0x00, 0x02,
+0xFF, 0x09, 0xF9, 0xFA, 0xF7, 0x08, 0xFA, 0xF7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF,
+0xFC, 0xFB, 0x0A, 0xFE, 0xFE, 0x00, 0xFD, 0xFA, 0x05, 0x02, 0x00, 0xFB, 0xFA, 0xFF, 0x08, 0x01,
+0xF9, 0x01, 0xF7, 0xFF, 0x01, 0x03, 0xF6, 0xFC, 0x06, 0x01, 0x03, 0x02, 0x01, 0x06, 0xF8, 0x01,
+0xFB, 0xF8, 0x07, 0xF9, 0x08, 0xF7, 0xF7, 0xFB, 0x06, 0xFC, 0x0D, 0xFA, 0xF9, 0x05, 0x06, 0x08,
+0xF9, 0x08, 0xF9, 0xF8, 0xF4, 0x0A, 0xF7, 0xF8, 0x05, 0x04, 0x05, 0x06, 0xFC, 0x07, 0xF5, 0x08,
+0xF8, 0xF5, 0x09, 0xF8, 0x06, 0xF9, 0xF8, 0xF7, 0x07, 0xFB, 0x0A, 0xFB, 0xFA, 0x04, 0x08, 0x0A,
+0xFA, 0x09, 0xF8, 0xF9, 0xF8, 0x08, 0xF5, 0xF6, 0x06, 0x04, 0x07, 0x08, 0xF8, 0x05, 0xF7, 0x09,
+0xFA, 0xF9, 0x07, 0xF7, 0x05, 0xF9, 0xF2, 0xF6, 0x05, 0xFD, 0x08, 0xFA, 0xF2, 0x03, 0x08, 0x09,
+0xFC, 0x07, 0xF9, 0xF8, 0xF6, 0x0C, 0xF9, 0xF6, 0x04, 0x04, 0x08, 0x0A, 0xFC, 0x06, 0xF8, 0x08,
+0xFB, 0xF7, 0x0C, 0xF7, 0x09, 0xFA, 0xFB, 0xF7, 0x06, 0xFA, 0x07, 0xF9, 0xF8, 0x06, 0x06, 0x06,
+0xFA, 0x07, 0xFA, 0xFC, 0xFA, 0x09, 0xF7, 0xF7, 0x08, 0x04, 0x06, 0x07, 0xF7, 0x09, 0xFA, 0x08,
+0xFA, 0xF8, 0x0A, 0xF9, 0x05, 0xF9, 0xF7, 0xF8, 0x06, 0xFB, 0x09, 0xF8, 0xF9, 0x03, 0x08, 0x0A,
+0xFB, 0x06, 0xFA, 0xFA, 0xF9, 0x07, 0xF8, 0xF8, 0x07, 0x04, 0x08, 0x07, 0xFB, 0x09, 0xF8, 0x0C,
+0xFA, 0xF9, 0x0E, 0xF9, 0x05, 0xF8, 0xF5, 0xF7, 0x07, 0xFC, 0x08, 0xFA, 0xF9, 0x05, 0x08, 0x06,
+0xFA, 0x07, 0xF8, 0xFA, 0xF7, 0x09, 0xF9, 0xF6, 0x06, 0x04, 0x08, 0x08, 0xF9, 0x08, 0xFA, 0x09,
+0xF7, 0xF9, 0x08, 0xFA, 0x05, 0xF9, 0xF5, 0xFA, 0x06, 0xFA, 0x0A, 0xFA, 0xF9, 0x05, 0x08, 0x08,
+0xF8, 0x07, 0xF8, 0xF8, 0xF5, 0x06, 0xF8, 0xFA, 0x08, 0x04, 0x07, 0x0A, 0xF7, 0x06, 0xF6, 0x0C,
+0xFA, 0xF9, 0x09, 0xF9, 0x07, 0xFA, 0xF6, 0xF7, 0x06, 0xFA, 0x06, 0xFB, 0xF9, 0x05, 0x09, 0x09,
+0xFA, 0x0A, 0xFA, 0xF9, 0xF7, 0x0A, 0xFA, 0xF8, 0x05, 0x05, 0x08, 0x08, 0xF9, 0x07, 0xFC, 0x08,
+0xF8, 0xF9, 0x07, 0xF9, 0x07, 0xF9, 0xF9, 0xF9, 0x05, 0xFA, 0x07, 0xF8, 0xF9, 0x06, 0x07, 0x07,
+0xF9, 0x07, 0xF9, 0xF8, 0xF7, 0x08, 0xF8, 0xF8, 0x06, 0x05, 0x07, 0x08, 0xF9, 0x08, 0xF9, 0x09,
+0xF7, 0xF9, 0x07, 0xFA, 0x07, 0xF9, 0xF8, 0xF9, 0x06, 0xFA, 0x07, 0xF9, 0xFA, 0x07, 0x08, 0x08,
+0xFA, 0x06, 0xFA, 0xFA, 0xF9, 0x07, 0xF8, 0xF8, 0x06, 0x04, 0x08, 0x07, 0xF9, 0x09, 0xF9, 0x08,
+0xF9, 0xF9, 0x07, 0xF9, 0x08, 0xF9, 0xF8, 0xFB, 0x07, 0xF8, 0x07, 0xF9, 0xF8, 0x07, 0x06, 0x07,
+0xF9, 0x08, 0xF9, 0xF9, 0xFA, 0x06, 0xF9, 0xFA, 0x07, 0x05, 0x08, 0x07, 0xF8, 0x0B, 0xF9, 0x0A,
+0xF7, 0xF8, 0x04, 0xFA, 0x07, 0xFA, 0xFA, 0xF9, 0x08, 0xF9, 0x07, 0xF9, 0xFA, 0x07, 0x07, 0x07,
+0xF8, 0x08, 0xF9, 0xF9, 0xF8, 0x08, 0xFA, 0xFB, 0x07, 0x04, 0x08, 0x08, 0xFB, 0x09, 0xFA, 0x0B,
+0xF9, 0xFA, 0x07, 0xF8, 0x08, 0xF8, 0xF9, 0xF9, 0x09, 0xF9, 0x06, 0xFA, 0xFA, 0x06, 0x05, 0x08,
+0xF8, 0x06, 0xF9, 0xFA, 0xF8, 0x08, 0xF9, 0xF9, 0x06, 0x04, 0x08, 0x08, 0xF9, 0x09, 0xF9, 0x0A,
+0xF8, 0xFA, 0x07, 0xF9, 0x08, 0xF8, 0xF9, 0xF9, 0x07, 0xF8, 0x06, 0xFA, 0xFA, 0x08, 0x09, 0x08,
+0xF8, 0x08, 0xF9, 0xF9, 0xFA, 0x09, 0xF8, 0xF9, 0x06, 0x04, 0x07, 0x07, 0xF9, 0x09, 0xFA, 0x0A,
+0xF8, 0xFA, 0x08, 0xFA, 0x07, 0xF8, 0xF7, 0xFA, 0x07, 0xFA, 0x07, 0xF9, 0xFA, 0x06, 0x09, 0x07,
+0xF9, 0x09, 0xF9, 0xF9, 0xF9, 0x06, 0xF9, 0xF8, 0x07, 0x04, 0x07, 0x07, 0xFA, 0x07, 0xF9, 0x08,
+0xF8, 0xF8, 0x07, 0xF9, 0x07, 0xF9, 0xFA, 0xF9, 0x08, 0xFA, 0x08, 0xF9, 0xF9, 0x06, 0x07, 0x06,
+0xF9, 0x06, 0xF9, 0xF9, 0xF9, 0x07, 0xF9, 0xF8, 0x07, 0x05, 0x06, 0x08, 0xFA, 0x09, 0xF8, 0x09,
+0xF8, 0xF6, 0x08, 0xF9, 0x04, 0xFA, 0xF7, 0xF7, 0x04, 0xFD, 0x09, 0xFA, 0xF5, 0x01, 0x09, 0x08,
+0xFB, 0x0B, 0xF8, 0xF7, 0xF8, 0x09, 0xF6, 0xFC, 0x05, 0x05, 0x07, 0x06, 0xFB, 0x06, 0xF6, 0x05,
+0xF9, 0xF9, 0x09, 0xFA, 0x05, 0xF8, 0xF8, 0xF5, 0x04, 0xFD, 0x0A, 0xFB, 0xF2, 0x03, 0x06, 0x05,
+0xFA, 0x03, 0xFB, 0xF7, 0xF5, 0x05, 0xF5, 0xFB, 0x06, 0x04, 0x06, 0x03, 0xF3, 0x05, 0xFB, 0x0A,
+0xFC, 0xF6, 0x08, 0xF6, 0x02, 0xF8, 0xF4, 0xFC, 0x06, 0xFB, 0x04, 0xFA, 0xF9, 0x08, 0x08, 0x08,
+0xFB, 0x0A, 0xFC, 0xFD, 0xF6, 0x06, 0xF6, 0xF6, 0x04, 0x05, 0x06, 0x06, 0xF8, 0x08, 0xF9, 0x04,
+0xF9, 0xF8, 0x0A, 0xF7, 0x05, 0xFA, 0xFB, 0xF8, 0x06, 0xFA, 0x06, 0xFB, 0xFC, 0x04, 0x07, 0x07,
+0xFA, 0x06, 0xFA, 0xF9, 0xF8, 0x08, 0xF7, 0xF9, 0x05, 0x03, 0x07, 0x06, 0xF7, 0x08, 0xFF, 0x0C,
+0xFC, 0xF8, 0x05, 0xF4, 0x08, 0xF8, 0xFB, 0xFC, 0x06, 0xFC, 0x06, 0xFD, 0xFC, 0x02, 0x0A, 0x06,
+0xF9, 0x08, 0xF8, 0xF9, 0xF9, 0x05, 0xF7, 0xF6, 0x03, 0x03, 0x07, 0x08, 0xF1, 0x03, 0xFA, 0x0A,
+0xF8, 0xFA, 0x09, 0xF9, 0x06, 0xF9, 0xF7, 0xF9, 0x05, 0xFC, 0x07, 0xFB, 0xFB, 0x06, 0x08, 0x09,
+0xFB, 0x08, 0xFA, 0xF8, 0xF5, 0x09, 0xFB, 0xF7, 0x05, 0x04, 0x05, 0x07, 0xFD, 0x06, 0xF8, 0x08,
+0xFC, 0xF9, 0x06, 0xFA, 0x04, 0xFA, 0xF7, 0xF7, 0x04, 0xFB, 0x0A, 0xFA, 0xF4, 0x06, 0x08, 0x06,
+0xFA, 0x08, 0xF9, 0xF9, 0xF9, 0x08, 0xF9, 0xFA, 0x07, 0x04, 0x07, 0x07, 0xFA, 0x06, 0xF3, 0x05,
+0xFA, 0xF5, 0x0B, 0xFB, 0x08, 0xF7, 0xFB, 0xFB, 0x03, 0xFC, 0x05, 0xF9, 0xF6, 0x03, 0x07, 0x06,
+0xFA, 0x04, 0xFA, 0xFA, 0xF3, 0x09, 0xFB, 0xF4, 0x09, 0x04, 0x07, 0x07, 0xF8, 0x07, 0xF9, 0x08,
+0xF8, 0xF8, 0x06, 0xF8, 0x08, 0xF6, 0xF6, 0xFA, 0x06, 0xFB, 0x0A, 0xFB, 0xF8, 0x04, 0x08, 0x06,
+0xFB, 0x09, 0xFA, 0xF8, 0xFA, 0x06, 0xFA, 0xF9, 0x05, 0x05, 0x07, 0x08, 0xF6, 0x05, 0xFA, 0x07,
+0xF8, 0xF4, 0x07, 0xF9, 0x07, 0xF8, 0xF5, 0xF4, 0x05, 0xFC, 0x06, 0xFA, 0xFA, 0x03, 0x09, 0x08,
+0xFB, 0x08, 0xF6, 0xFA, 0xF6, 0x05, 0xF9, 0xF4, 0x03, 0x04, 0x09, 0x07, 0xFB, 0x06, 0xF8, 0x09,
+0xF7, 0xF4, 0x09, 0xFB, 0x03, 0xF6, 0xFC, 0xF5, 0x04, 0xFA, 0x06, 0xFA, 0xF7, 0x05, 0x06, 0x04,
+0xF9, 0x06, 0xF9, 0xF8, 0xFA, 0x04, 0xF7, 0xFC, 0x06, 0x04, 0x06, 0x07, 0xFB, 0x05, 0xF5, 0x06,
+0xFB, 0xF9, 0x07, 0xFD, 0x05, 0xFC, 0xFA, 0xFB, 0x04, 0xF8, 0x07, 0xFA, 0xF7, 0x03, 0x0A, 0x08,
+0xF9, 0x08, 0xF9, 0xF8, 0xF9, 0x09, 0xF7, 0xF6, 0x09, 0x04, 0x07, 0x06, 0xFF, 0x06, 0xF8, 0x08,
+0xF7, 0xFA, 0x08, 0xF8, 0x05, 0xF9, 0xF7, 0xF9, 0x07, 0xFB, 0x05, 0xFB, 0xF9, 0x05, 0x07, 0x06,
+0xF9, 0x04, 0xF9, 0xF8, 0xF6, 0x09, 0xF8, 0xF9, 0x06, 0x03, 0x07, 0x05, 0xFA, 0x05, 0xFB, 0x0B,
+0xF9, 0xFC, 0x0B, 0xFA, 0x0B, 0xF9, 0xFA, 0xF9, 0x07, 0xF9, 0x06, 0xFB, 0xFB, 0x05, 0x06, 0x07,
+0xFC, 0x08, 0xFB, 0xF9, 0xF6, 0x06, 0xF8, 0xFB, 0x07, 0x03, 0x08, 0x08, 0xFA, 0x06, 0xFA, 0x08,
+0xF9, 0xFB, 0x0C, 0xF7, 0x08, 0xF9, 0xFC, 0xF7, 0x05, 0xFA, 0x08, 0xFD, 0xFA, 0x02, 0x05, 0x09,
+0xFA, 0x08, 0xF7, 0xFA, 0xF8, 0x0A, 0xF9, 0xF4, 0x07, 0x03, 0x07, 0x0B, 0xF6, 0x03, 0xF8, 0x0D,
+0xFA, 0xF5, 0x0A, 0xF8, 0x07, 0xF9, 0xF9, 0xFB, 0x05, 0xFC, 0x09, 0xFC, 0xF7, 0x03, 0x08, 0x08,
+0xFA, 0x06, 0xF9, 0xFB, 0xF9, 0x09, 0xF8, 0xFB, 0x07, 0x05, 0x08, 0x08, 0xFC, 0x09, 0xFC, 0x07,
+0xF7, 0xF6, 0x04, 0xF8, 0x06, 0xF8, 0xF6, 0xF6, 0x08, 0xF8, 0x09, 0xFB, 0xF8, 0x06, 0x07, 0x0B,
+0xF9, 0x05, 0xF8, 0xF8, 0xFA, 0x05, 0xF9, 0xFA, 0x06, 0x05, 0x08, 0x06, 0xFA, 0x07, 0xFB, 0x08,
+0xF9, 0xF6, 0x08, 0xF8, 0x07, 0xF9, 0xF9, 0xFA, 0x06, 0xFB, 0x08, 0xF9, 0xFA, 0x05, 0x09, 0x09,
+0xFA, 0x08, 0xFB, 0xFA, 0xF7, 0x07, 0xF8, 0xF8, 0x06, 0x05, 0x07, 0x06, 0xF9, 0x09, 0xF9, 0x09,
+0xFA, 0xF9, 0x08, 0xF9, 0x06, 0xF9, 0xFA, 0xFB, 0x06, 0xFA, 0x07, 0xFB, 0xF8, 0x07, 0x06, 0x07,
+0xF9, 0x07, 0xF9, 0xF9, 0xF9, 0x06, 0xF9, 0xF8, 0x06, 0x03, 0x08, 0x07, 0xFA, 0x08, 0xFB, 0x0A,
+0xFA, 0xF7, 0x09, 0xFA, 0x06, 0xF9, 0xF9, 0xFC, 0x06, 0xFC, 0x06, 0xFB, 0xF9, 0x04, 0x05, 0x08,
+0xFA, 0x09, 0xFA, 0xF8, 0xF8, 0x06, 0xF7, 0xF7, 0x07, 0x03, 0x08, 0x07, 0xF9, 0x05, 0xFC, 0x06,
+0xF8, 0xFA, 0x05, 0xF8, 0x03, 0xF7, 0xF9, 0xFD, 0x09, 0xFC, 0x06, 0xFA, 0xFA, 0x05, 0x09, 0x07,
+0xFA, 0x05, 0xFA, 0xF8, 0xF8, 0x08, 0xF9, 0xF7, 0x05, 0x03, 0x06, 0x05, 0xF8, 0x09, 0xF9, 0x08,
+0xFB, 0xFA, 0x07, 0xF8, 0x04, 0xFC, 0xFA, 0xFA, 0x03, 0xFD, 0x0A, 0xFD, 0xF5, 0x02, 0x09, 0x06,
+0xFA, 0x0E, 0xF8, 0xFC, 0xF6, 0x0D, 0xF9, 0xFB, 0x06, 0x04, 0x09, 0x07, 0xF8, 0x06, 0xF6, 0x06,
+0xFA, 0xFA, 0x05, 0xF9, 0x07, 0xFA, 0xF7, 0xFA, 0x06, 0xFB, 0x06, 0xFA, 0xF6, 0x03, 0x07, 0x07,
+0xFA, 0x07, 0xF9, 0xF8, 0xF7, 0x0B, 0xF8, 0xF5, 0x07, 0x04, 0x07, 0x09, 0xF9, 0x06, 0xF9, 0x0A,
+0xF8, 0xF6, 0x07, 0xF7, 0x03, 0xF9, 0xF9, 0xF4, 0x05, 0xFD, 0x09, 0xFA, 0xFA, 0x05, 0x0A, 0x08,
+0xFB, 0x0A, 0xF9, 0xFA, 0xF6, 0x08, 0xF8, 0xF7, 0x05, 0x05, 0x07, 0x06, 0xF9, 0x06, 0xF9, 0x07,
+0xFA, 0xF7, 0x07, 0xF8, 0x06, 0xF8, 0xFA, 0xF7, 0x06, 0xFB, 0x08, 0xF9, 0xFA, 0x06, 0x05, 0x07,
+0xFA, 0x08, 0xFA, 0xFA, 0xFA, 0x07, 0xFA, 0xF6, 0x06, 0x05, 0x07, 0x08, 0xFC, 0x07, 0xF8, 0x07,
+0xF8, 0xF9, 0x07, 0xF9, 0x08, 0xFA, 0xF9, 0xFA, 0x06, 0xFA, 0x08, 0xFA, 0xFA, 0x05, 0x06, 0x08,
+0xFA, 0x09, 0xFA, 0xFA, 0xFA, 0x07, 0xF9, 0xF8, 0x05, 0x05, 0x06, 0x06, 0xFB, 0x09, 0xF7, 0x07,
+0xFA, 0xF9, 0x08, 0xF8, 0x05, 0xF9, 0xF9, 0xF7, 0x06, 0xFB, 0x0A, 0xFB, 0xF9, 0x06, 0x07, 0x08,
+0xFA, 0x06, 0xFA, 0xFA, 0xF8, 0x07, 0xFA, 0xFA, 0x04, 0x06, 0x07, 0x06, 0xFA, 0x08, 0xF8, 0x08,
+0xF8, 0xF8, 0x0A, 0xFA, 0x07, 0xF9, 0xF8, 0xF9, 0x06, 0xFC, 0x07, 0xFA, 0xF9, 0x03, 0x07, 0x09,
+0xF9, 0x07, 0xFB, 0xF9, 0xF9, 0x07, 0xF7, 0xFA, 0x06, 0x04, 0x07, 0x07, 0xF6, 0x07, 0xFB, 0x08,
+0xF9, 0xFB, 0x0B, 0xF9, 0x05, 0xF7, 0xF9, 0xF5, 0x04, 0xFB, 0x07, 0xFA, 0xF9, 0x05, 0x0A, 0x09,
+0xFB, 0x0A, 0xF9, 0xFA, 0xF7, 0x08, 0xF6, 0xFA, 0x09, 0x04, 0x07, 0x07, 0xFE, 0x04, 0xFC, 0x07,
+0xFA, 0xFA, 0x08, 0xFA, 0x06, 0xFA, 0xF8, 0xF9, 0x05, 0xFC, 0x09, 0xFC, 0xFA, 0x05, 0x09, 0x07,
+0xFA, 0x05, 0xFB, 0xF9, 0xF9, 0x09, 0xF9, 0xF9, 0x05, 0x05, 0x08, 0x07, 0xF8, 0x0A, 0xFA, 0x09,
+0xF9, 0xF8, 0x06, 0xF9, 0x06, 0xFB, 0xF8, 0xF8, 0x05, 0xFA, 0x08, 0xFA, 0xFA, 0x05, 0x06, 0x08,
+0xFB, 0x05, 0xFB, 0xF9, 0xF8, 0x07, 0xF8, 0xF7, 0x05, 0x04, 0x07, 0x06, 0xFA, 0x06, 0xF7, 0x08,
+0xF9, 0xF7, 0x07, 0xF9, 0x07, 0xF9, 0xFB, 0xF7, 0x06, 0xFB, 0x08, 0xFB, 0xFA, 0x04, 0x08, 0x09,
+0xF9, 0x07, 0xFA, 0xF8, 0xF9, 0x07, 0xFA, 0xFA, 0x06, 0x05, 0x08, 0x07, 0xFA, 0x08, 0xF8, 0x09,
+0xF8, 0xFB, 0x07, 0xF9, 0x08, 0xF9, 0xF9, 0xFA, 0x07, 0xFB, 0x08, 0xFA, 0xFA, 0x05, 0x07, 0x07,
+0xF9, 0x0B, 0xF9, 0xF9, 0xF9, 0x05, 0xF8, 0xF7, 0x06, 0x05, 0x08, 0x07, 0xF8, 0x07, 0xF8, 0x09,
+0xF8, 0xF9, 0x09, 0xFA, 0x06, 0xFA, 0xF7, 0xFA, 0x06, 0xFA, 0x07, 0xF9, 0xF9, 0x05, 0x07, 0x07,
+0xFB, 0x0A, 0xFA, 0xF9, 0xF9, 0x08, 0xF9, 0xF9, 0x09, 0x05, 0x08, 0x06, 0xFB, 0x09, 0xF7, 0x09,
+0xF9, 0xFA, 0x07, 0xF8, 0x05, 0xF8, 0xF8, 0xF9, 0x08, 0xFA, 0x07, 0xFA, 0xFA, 0x08, 0x08, 0x07,
+0xF8, 0x09, 0xFA, 0xFB, 0xFA, 0x04, 0xFB, 0xF8, 0x07, 0x04, 0x08, 0x06, 0xF9, 0x0A, 0xF9, 0x08,
+0xF7, 0xF9, 0x0A, 0xFA, 0x06, 0xFA, 0xF9, 0xF8, 0x07, 0xFB, 0x08, 0xF9, 0xF9, 0x06, 0x06, 0x08,
+0xF9, 0x07, 0xF8, 0xF9, 0xF9, 0x07, 0xF8, 0xFA, 0x07, 0x04, 0x07, 0x08, 0xFB, 0x07, 0xF9, 0x07,
+0xF8, 0xF9, 0x05, 0xF9, 0x07, 0xF9, 0xF9, 0xFA, 0x08, 0xF8, 0x05, 0xF9, 0xF9, 0x06, 0x07, 0x06,
+0xF8, 0x06, 0xFA, 0xFA, 0xF7, 0x05, 0xF9, 0xF8, 0x08, 0x05, 0x06, 0x08, 0xFC, 0x09, 0xF8, 0x08,
+0xF9, 0xF9, 0x07, 0xF8, 0x06, 0xF9, 0xFB, 0xFA, 0x06, 0xFA, 0x08, 0xF8, 0xF9, 0x06, 0x08, 0x08,
+0xF9, 0x07, 0xF8, 0xF9, 0xF7, 0x07, 0xF9, 0xF7, 0x07, 0x04, 0x07, 0x05, 0xFC, 0x08, 0xF9, 0x0A,
+0xF7, 0xF8, 0x0B, 0xF9, 0x08, 0xFA, 0xF8, 0xF6, 0x06, 0xFB, 0x06, 0xF9, 0xF8, 0x04, 0x08, 0x07,
+0xF9, 0x06, 0xF9, 0xF8, 0xFA, 0x08, 0xF9, 0xF9, 0x06, 0x05, 0x07, 0x07, 0xF8, 0x04, 0xF9, 0x07,
+0xF8, 0xFA, 0x07, 0xF7, 0x08, 0xFA, 0xFA, 0xF9, 0x05, 0xFA, 0x06, 0xF9, 0xFB, 0x06, 0x09, 0x06,
+0xF9, 0x08, 0xF9, 0xF8, 0xF8, 0x08, 0xFA, 0xF7, 0x06, 0x06, 0x07, 0x07, 0xF6, 0x07, 0xF8, 0x07,
+0xF8, 0xF9, 0x07, 0xF9, 0x06, 0xF9, 0xFA, 0xFB, 0x07, 0xFA, 0x08, 0xFA, 0xF9, 0x06, 0x06, 0x08,
+0xF9, 0x06, 0xFA, 0xF9, 0xF8, 0x06, 0xF9, 0xF7, 0x06, 0x05, 0x07, 0x07, 0xF8, 0x08, 0xF9, 0x09,
+0xF9, 0xF9, 0x07, 0xFA, 0x06, 0xF9, 0xFA, 0xF9, 0x07, 0xFB, 0x08, 0xFA, 0xFA, 0x06, 0x06, 0x08,
+0xFA, 0x07, 0xFA, 0xF9, 0xFA, 0x07, 0xF8, 0xF9, 0x06, 0x05, 0x07, 0x07, 0xF9, 0x09, 0xF9, 0x0A,
+0xF9, 0xF9, 0x07, 0xFA, 0x07, 0xF9, 0xF9, 0xFA, 0x06, 0xF9, 0x07, 0xFA, 0xF9, 0x06, 0x07, 0x07,
+0xF9, 0x06, 0xFA, 0xFA, 0xF9, 0x07, 0xF9, 0xF8, 0x06, 0x05, 0x07, 0x08, 0xF9, 0x0B, 0xF9, 0x0A,
+0xF8, 0xF9, 0x06, 0xF9, 0x07, 0xF9, 0xFA, 0xFA, 0x06, 0xF9, 0x07, 0xF9, 0xFA, 0x06, 0x07, 0x08,
+0xF9, 0x08, 0xFA, 0xFA, 0xF8, 0x07, 0xFA, 0xFA, 0x07, 0x05, 0x07, 0x07, 0xFB, 0x0B, 0xF9, 0x0A,
+0xF9, 0xF9, 0x07, 0xF9, 0x08, 0xF9, 0xFA, 0xF9, 0x06, 0xFA, 0x08, 0xFA, 0xFA, 0x07, 0x06, 0x07,
+0xF9, 0x07, 0xFA, 0xFA, 0xF9, 0x08, 0xFB, 0xF9, 0x07, 0x05, 0x08, 0x08, 0xFA, 0x0D, 0xFB, 0x0A,
+0xF8, 0xF9, 0x08, 0xF8, 0x06, 0xF9, 0xF9, 0xFA, 0x06, 0xFA, 0x08, 0xFA, 0xF8, 0x06, 0x07, 0x07,
+0xF8, 0x06, 0xF9, 0xF9, 0xF9, 0x07, 0xF9, 0xF9, 0x06, 0x05, 0x07, 0x08, 0xF9, 0x09, 0xF9, 0x0A,
+0xFA, 0xF8, 0x06, 0xF8, 0x06, 0xF9, 0xFA, 0xFA, 0x07, 0xFA, 0x08, 0xFA, 0xF9, 0x06, 0x07, 0x08,
+0xF9, 0x07, 0xF9, 0xF9, 0xF9, 0x07, 0xF9, 0xF8, 0x07, 0x05, 0x07, 0x08, 0xFB, 0x09, 0xF9, 0x08,
+0xFA, 0xF9, 0x06, 0xF8, 0x06, 0xF9, 0xFA, 0xFA, 0x06, 0xFA, 0x08, 0xFA, 0xFA, 0x06, 0x06, 0x08,
+0xF9, 0x07, 0xF9, 0xF9, 0xF8, 0x07, 0xFA, 0xF9, 0x06, 0x05, 0x07, 0x07, 0xFA, 0x09, 0xF9, 0x09,
+0xF2, 0xF4, 0x0D, 0xF4, 0x0E, 0xF4, 0xF5, 0xF4, 0x0C, 0xF3, 0x0C, 0xF5, 0xF4, 0x0B, 0x0D, 0x0D,
+0xF4, 0x0B, 0xF4, 0xF4, 0xF4, 0x0C, 0xF6, 0xF4, 0x0C, 0x0B, 0x0C, 0x0E, 0xF5, 0x12, 0xF4, 0x11,
+0xF3, 0xF4, 0x0B, 0xF5, 0x0C, 0xF5, 0xF5, 0xF4, 0x0E, 0xF4, 0x0D, 0xF5, 0xF4, 0x0D, 0x0C, 0x0D,
+0xF2, 0x0C, 0xF3, 0xF3, 0xF3, 0x0D, 0xF5, 0xF5, 0x0B, 0x0E, 0x0C, 0x0D, 0xF4, 0x14, 0xF4, 0x11,
+0xF2, 0xF4, 0x0E, 0xF4, 0x0E, 0xF4, 0xF4, 0xF4, 0x0D, 0xF3, 0x0D, 0xF5, 0xF4, 0x0C, 0x0B, 0x0C,
+0xF2, 0x0C, 0xF4, 0xF4, 0xF3, 0x0C, 0xF4, 0xF5, 0x0D, 0x0F, 0x0F, 0x0E, 0xF5, 0x14, 0xF3, 0x11,
+0xF3, 0xF5, 0x0D, 0xF6, 0x0E, 0xF4, 0xF5, 0xF4, 0x0D, 0xF2, 0x0E, 0xF5, 0xF2, 0x0B, 0x0B, 0x0E,
+0xF3, 0x0C, 0xF5, 0xF4, 0xF5, 0x0B, 0xF4, 0xF4, 0x0B, 0x0E, 0x0D, 0x0D, 0xF6, 0x15, 0xF4, 0x11,
+0xF3, 0xF3, 0x0C, 0xF4, 0x0D, 0xF2, 0xF2, 0xF5, 0x0C, 0xF4, 0x0C, 0xF6, 0xF4, 0x09, 0x0C, 0x0D,
+0xF4, 0x0B, 0xF5, 0xF5, 0xF3, 0x0D, 0xF3, 0xF2, 0x0C, 0x0E, 0x0C, 0x0F, 0xF3, 0x10, 0xF5, 0x12,
+0xF3, 0xF3, 0x0E, 0xF3, 0x0F, 0xF3, 0xF7, 0xF4, 0x0D, 0xF3, 0x0D, 0xF4, 0xF3, 0x0D, 0x0D, 0x0D,
+0xF3, 0x0C, 0xF5, 0xF5, 0xF2, 0x0D, 0xF4, 0xF5, 0x0D, 0x0C, 0x0C, 0x0E, 0xF8, 0x13, 0xF3, 0x11,
+0xF2, 0xF3, 0x0B, 0xF4, 0x0E, 0xF4, 0xF6, 0xF5, 0x0C, 0xF3, 0x0C, 0xF4, 0xF4, 0x0C, 0x0C, 0x0E,
+0xF3, 0x0D, 0xF5, 0xF3, 0xF3, 0x0C, 0xF4, 0xF4, 0x0D, 0x0F, 0x0D, 0x0D, 0xF7, 0x12, 0xF3, 0x11,
+0xF3, 0xF5, 0x0E, 0xF3, 0x0D, 0xF4, 0xF4, 0xF4, 0x0C, 0xF5, 0x0D, 0xF5, 0xF4, 0x0A, 0x0C, 0x0D,
+0xF3, 0x0D, 0xF4, 0xF4, 0xF4, 0x0D, 0xF4, 0xF5, 0x0C, 0x0C, 0x0C, 0x0D, 0xF5, 0x11, 0xF4, 0x12,
+0xF3, 0xF6, 0x0B, 0xF5, 0x0D, 0xF5, 0xF4, 0xF4, 0x0B, 0xF3, 0x0D, 0xF5, 0xF2, 0x0A, 0x0E, 0x0B,
+0xF5, 0x0F, 0xF3, 0xF5, 0xF3, 0x0D, 0xF3, 0xF4, 0x0B, 0x0D, 0x0C, 0x0C, 0xF2, 0x0C, 0xF4, 0x11,
+0xF3, 0xF3, 0x0D, 0xF4, 0x0D, 0xF5, 0xF5, 0xF2, 0x0E, 0xF2, 0x0D, 0xF4, 0xF5, 0x0C, 0x0B, 0x0D,
+0xF4, 0x0A, 0xF4, 0xF6, 0xF6, 0x0B, 0xF4, 0xF5, 0x0B, 0x0E, 0x0C, 0x0F, 0xF6, 0x13, 0xF4, 0x11,
+0xF2, 0xF5, 0x0B, 0xF5, 0x0E, 0xF3, 0xF5, 0xF4, 0x0D, 0xF4, 0x0E, 0xF5, 0xF4, 0x0C, 0x0B, 0x0C,
+0xF4, 0x0C, 0xF5, 0xF5, 0xF6, 0x0C, 0xF4, 0xF4, 0x0B, 0x09, 0x0E, 0x0E, 0xF6, 0x13, 0xF3, 0x10,
+0xF2, 0xF2, 0x0B, 0xF4, 0x0D, 0xF4, 0xF5, 0xF4, 0x0E, 0xF4, 0x0B, 0xF5, 0xF2, 0x0C, 0x0B, 0x0E,
+0xF4, 0x0D, 0xF4, 0xF4, 0xF3, 0x0B, 0xF4, 0xF2, 0x0C, 0x0A, 0x0D, 0x0D, 0xF5, 0x10, 0xF3, 0x11,
+0xF3, 0xF4, 0x0D, 0xF3, 0x0E, 0xF3, 0xF7, 0xF4, 0x0D, 0xF3, 0x0D, 0xF5, 0xF4, 0x0A, 0x0B, 0x0F,
+0xF3, 0x0C, 0xF6, 0xF4, 0xF4, 0x0C, 0xF3, 0xF4, 0x0C, 0x09, 0x0D, 0x0F, 0xF5, 0x11, 0xF3, 0x11,
+0xF2, 0xF3, 0x0B, 0xF4, 0x0C, 0xF5, 0xF4, 0xF1, 0x0C, 0xF5, 0x0C, 0xF4, 0xF3, 0x0A, 0x0C, 0x0E,
+0xF4, 0x0E, 0xF4, 0xF4, 0xF3, 0x0E, 0xF4, 0xF4, 0x0C, 0x0A, 0x0C, 0x0D, 0xF6, 0x0E, 0xF5, 0x10,
+0xF3, 0xF5, 0x0C, 0xF5, 0x0B, 0xF3, 0xF5, 0xF4, 0x0D, 0xF4, 0x0D, 0xF5, 0xF4, 0x0D, 0x0D, 0x0E,
+0xF2, 0x0D, 0xF5, 0xF3, 0xF4, 0x0D, 0xF5, 0xF4, 0x0B, 0x0D, 0x0D, 0x0E, 0xF5, 0x14, 0xF4, 0x11,
+0xF3, 0xF0, 0x0D, 0xF4, 0x0A, 0xF5, 0xF5, 0xF2, 0x0A, 0xF6, 0x0B, 0xF8, 0xF4, 0x09, 0x0F, 0x0F,
+0xF1, 0x0E, 0xF3, 0xF2, 0xF2, 0x0F, 0xF1, 0xF6, 0x09, 0x0A, 0x0D, 0x0E, 0xF0, 0x09, 0xF2, 0x0C,
+0xF3, 0xF1, 0x0C, 0xF4, 0x0C, 0xF2, 0xF5, 0xF4, 0x09, 0xF5, 0x0C, 0xF5, 0xF2, 0x08, 0x0E, 0x0C,
+0xF4, 0x0C, 0xF6, 0xF3, 0xF5, 0x0C, 0xF3, 0xF3, 0x08, 0x09, 0x0E, 0x0F, 0xF5, 0x0E, 0xF2, 0x10,
+0xF3, 0xF4, 0x0B, 0xF4, 0x0E, 0xF4, 0xF4, 0xF3, 0x0D, 0xF3, 0x0C, 0xF5, 0xF4, 0x0A, 0x0B, 0x0E,
+0xF4, 0x0C, 0xF5, 0xF5, 0xF4, 0x0D, 0xF4, 0xF5, 0x0B, 0x08, 0x0D, 0x0F, 0xF6, 0x12, 0xF3, 0x11,
+0xF3, 0xF5, 0x0E, 0xF4, 0x0D, 0xF4, 0xF5, 0xF5, 0x0B, 0xF5, 0x0D, 0xF5, 0xF5, 0x0B, 0x0C, 0x0E,
+0xF3, 0x0C, 0xF5, 0xF4, 0xF5, 0x0A, 0xF5, 0xF5, 0x0B, 0x08, 0x0D, 0x0D, 0xF5, 0x15, 0xF3, 0x13,
+0xF3, 0xF4, 0x0C, 0xF4, 0x0D, 0xF5, 0xF6, 0xF3, 0x0C, 0xF4, 0x0D, 0xF3, 0xF4, 0x0C, 0x0B, 0x0D,
+0xF3, 0x0C, 0xF3, 0xF4, 0xF4, 0x0C, 0xF4, 0xF5, 0x0C, 0x08, 0x0D, 0x0C, 0xF5, 0x12, 0xF4, 0x12,
+0xF3, 0xF5, 0x0B, 0xF5, 0x0C, 0xF3, 0xF4, 0xF5, 0x0D, 0xF4, 0x0C, 0xF5, 0xF5, 0x0D, 0x0A, 0x0D,
+0xF3, 0x0D, 0xF5, 0xF4, 0xF5, 0x0B, 0xF5, 0xF4, 0x0C, 0x08, 0x0D, 0x0D, 0xF4, 0x16, 0xF4, 0x13,
+0xF4, 0xF4, 0x0C, 0xF4, 0x0D, 0xF3, 0xF6, 0xF5, 0x0C, 0xF4, 0x0C, 0xF5, 0xF4, 0x0B, 0x0B, 0x0D,
+0xF2, 0x0B, 0xF3, 0xF4, 0xF4, 0x0B, 0xF4, 0xF5, 0x0C, 0x08, 0x0D, 0x0E, 0xF5, 0x12, 0xF3, 0x12,
+0xF2, 0xF3, 0x0C, 0xF4, 0x0C, 0xF2, 0xF4, 0xF3, 0x0E, 0xF5, 0x0C, 0xF5, 0xF4, 0x09, 0x0C, 0x0D,
+0xF3, 0x0D, 0xF5, 0xF5, 0xF4, 0x0C, 0xF4, 0xF4, 0x0D, 0x08, 0x0B, 0x0E, 0xF5, 0x0E, 0xF2, 0x10,
+0xF2, 0xF1, 0x0F, 0xF3, 0x0A, 0xF2, 0xEF, 0xF6, 0x0B, 0xF4, 0x0E, 0xF8, 0xEF, 0x08, 0x0C, 0x0C,
+0xF5, 0x0C, 0xF5, 0xF5, 0xF6, 0x0F, 0xF5, 0xF2, 0x0A, 0x0E, 0x0B, 0x0B, 0xF6, 0x0C, 0xF2, 0x0D,
+0xF3, 0xF3, 0x0C, 0xF3, 0x0B, 0xF4, 0xF3, 0xF3, 0x0B, 0xF5, 0x0D, 0xF5, 0xF4, 0x0B, 0x0C, 0x0E,
+0xF4, 0x0C, 0xF5, 0xF5, 0xF4, 0x0E, 0xF4, 0xF2, 0x0B, 0x08, 0x0D, 0x0C, 0xF3, 0x0E, 0xF4, 0x0F,
+0xF3, 0xF3, 0x0C, 0xF4, 0x0E, 0xF3, 0xF3, 0xF2, 0x0D, 0xF5, 0x0C, 0xF5, 0xF4, 0x0B, 0x0D, 0x0E,
+0xF3, 0x0D, 0xF4, 0xF4, 0xF3, 0x0D, 0xF4, 0xF3, 0x0D, 0x08, 0x0E, 0x0D, 0xF6, 0x11, 0xF3, 0x10,
+0xF4, 0xF4, 0x0E, 0xF4, 0x0D, 0xF4, 0xF6, 0xF4, 0x0D, 0xF4, 0x0C, 0xF4, 0xF5, 0x0D, 0x0B, 0x0D,
+0xF4, 0x0E, 0xF4, 0xF5, 0xF5, 0x0C, 0xF4, 0xF5, 0x0C, 0x09, 0x0D, 0x0E, 0xF6, 0x13, 0xF4, 0x10,
+0xF4, 0xF3, 0x0C, 0xF4, 0x0D, 0xF3, 0xF4, 0xF4, 0x0E, 0xF4, 0x0D, 0xF5, 0xF4, 0x0C, 0x0C, 0x0D,
+0xF2, 0x0C, 0xF4, 0xF4, 0xF4, 0x0B, 0xF4, 0xF4, 0x0C, 0x08, 0x0D, 0x0E, 0xF5, 0x12, 0xF3, 0x12,
+0xF2, 0xF4, 0x0D, 0xF4, 0x0E, 0xF5, 0xF5, 0xF5, 0x0D, 0xF4, 0x0C, 0xF3, 0xF4, 0x0C, 0x0B, 0x0E,
+0xF4, 0x0D, 0xF4, 0xF4, 0xF4, 0x0A, 0xF5, 0xF4, 0x0B, 0x08, 0x0D, 0x0E, 0xF6, 0x16, 0xF5, 0x13,
+0xF3, 0xF4, 0x0B, 0xF4, 0x0E, 0xF3, 0xF5, 0xF5, 0x0C, 0xF5, 0x0D, 0xF5, 0xF4, 0x0B, 0x0C, 0x0D,
+0xF3, 0x0C, 0xF4, 0xF4, 0xF5, 0x0C, 0xF4, 0xF5, 0x0D, 0x08, 0x0F, 0x0E, 0xF7, 0x13, 0xF4, 0x12,
+0xF3, 0xF2, 0x10, 0xF3, 0x0C, 0xF4, 0xF2, 0xF3, 0x0C, 0xF3, 0x0D, 0xF4, 0xF4, 0x0C, 0x0D, 0x0D,
+0xF4, 0x0C, 0xF3, 0xF5, 0xF3, 0x0D, 0xF4, 0xF1, 0x0C, 0x08, 0x0C, 0x0C, 0xF7, 0x10, 0xF3, 0x0F,
+0xF3, 0xF2, 0x0D, 0xF2, 0x0C, 0xF3, 0xF5, 0xF1, 0x0B, 0xF7, 0x0D, 0xF4, 0xF3, 0x09, 0x0B, 0x0D,
+0xF3, 0x0B, 0xF4, 0xF5, 0xF3, 0x0C, 0xF4, 0xF2, 0x0C, 0x09, 0x0B, 0x0E, 0xF2, 0x0C, 0xF4, 0x0F,
+0xF3, 0xF4, 0x0E, 0xF3, 0x0C, 0xF3, 0xF3, 0xF4, 0x0D, 0xF3, 0x0D, 0xF5, 0xF5, 0x0C, 0x0C, 0x0C,
+0xF4, 0x0D, 0xF4, 0xF4, 0xF4, 0x0C, 0xF2, 0xF4, 0x0B, 0x09, 0x0B, 0x0E, 0xF6, 0x0D, 0xF3, 0x0F,
+0xF3, 0xF2, 0x0D, 0xF4, 0x0C, 0xF3, 0xF4, 0xF1, 0x0A, 0xF4, 0x0C, 0xF5, 0xF3, 0x0E, 0x0C, 0x0C,
+0xF4, 0x0E, 0xF4, 0xF4, 0xF4, 0x0D, 0xF2, 0xF2, 0x0C, 0x09, 0x0C, 0x0C, 0xF8, 0x0F, 0xF5, 0x0E,
+0xF4, 0xF3, 0x0E, 0xF4, 0x0D, 0xF4, 0xF5, 0xF4, 0x0D, 0xF5, 0x0E, 0xF4, 0xF5, 0x0B, 0x0C, 0x0D,
+0xF4, 0x11, 0xF6, 0xF4, 0xF4, 0x0C, 0xF3, 0xF3, 0x0B, 0x08, 0x0D, 0x0E, 0xF7, 0x12, 0xF4, 0x12,
+0xF3, 0xF4, 0x0D, 0xF4, 0x0B, 0xF4, 0xF6, 0xF4, 0x0E, 0xF3, 0x0B, 0xF5, 0xF4, 0x0C, 0x0C, 0x0D,
+0xF4, 0x0D, 0xF4, 0xF4, 0xF4, 0x0C, 0xF4, 0xF3, 0x0C, 0x08, 0x0C, 0x0D, 0xF4, 0x15, 0xF5, 0x11,
+0xF3, 0xF5, 0x0B, 0xF4, 0x0C, 0xF4, 0xF5, 0xF5, 0x0D, 0xF5, 0x0D, 0xF4, 0xF5, 0x0B, 0x0C, 0x0E,
+0xF3, 0x0C, 0xF4, 0xF2, 0xF5, 0x0D, 0xF3, 0xF6, 0x0C, 0x08, 0x0E, 0x0D, 0xF4, 0x14, 0xF4, 0x13,
+0xF3, 0xF3, 0x0B, 0xF4, 0x0E, 0xF3, 0xF6, 0xF3, 0x0E, 0xF4, 0x0C, 0xF4, 0xF4, 0x0D, 0x0B, 0x0C,
+0xF3, 0x0C, 0xF4, 0xF5, 0xF5, 0x0E, 0xF4, 0xF5, 0x0C, 0x07, 0x0C, 0x0D, 0xF6, 0x14, 0xF3, 0x12,
+0xF2, 0xF4, 0x0C, 0xF3, 0x0C, 0xF4, 0xF4, 0xF2, 0x0D, 0xF4, 0x0C, 0xF4, 0xF4, 0x0C, 0x0C, 0x0E,
+0xF3, 0x0C, 0xF5, 0xF3, 0xF2, 0x0D, 0xF2, 0xF3, 0x0D, 0x07, 0x0E, 0x0E, 0xF8, 0x0D, 0xF3, 0x0F,
+0xF2, 0xF4, 0x0C, 0xF4, 0x0E, 0xF4, 0xF5, 0xF4, 0x0C, 0xF3, 0x0C, 0xF5, 0xF5, 0x0B, 0x0E, 0x0C,
+0xF3, 0x0E, 0xF6, 0xF4, 0xF4, 0x0D, 0xF6, 0xF4, 0x0C, 0x09, 0x0D, 0x0E, 0xF5, 0x13, 0xF4, 0x11,
+0xF2, 0xF5, 0x0F, 0xF2, 0x0A, 0xF5, 0xF3, 0xF3, 0x09, 0xF8, 0x0B, 0xF5, 0xF2, 0x07, 0x0A, 0x0F,
+0xF5, 0x0E, 0xF6, 0xF5, 0xF3, 0x0C, 0xF3, 0xF5, 0x0A, 0x0A, 0x0C, 0x0E, 0xF2, 0x0A, 0xF0, 0x0F,
+0xF3, 0xF3, 0x0E, 0xF4, 0x0D, 0xF4, 0xF4, 0xF2, 0x0D, 0xF5, 0x0F, 0xF3, 0xF4, 0x0B, 0x0B, 0x0D,
+0xF4, 0x0F, 0xF5, 0xF4, 0xF4, 0x0C, 0xF3, 0xF5, 0x0C, 0x08, 0x0E, 0x0D, 0xF6, 0x13, 0xF3, 0x10,
+0xF3, 0xF2, 0x0D, 0xF4, 0x0D, 0xF3, 0xF5, 0xF4, 0x0C, 0xF4, 0x0D, 0xF5, 0xF5, 0x0B, 0x0C, 0x0E,
+0xF4, 0x0E, 0xF4, 0xF4, 0xF3, 0x0D, 0xF5, 0xF4, 0x0C, 0x08, 0x0D, 0x0E, 0xF6, 0x12, 0xF3, 0x11,
+0xF2, 0xF2, 0x0C, 0xF4, 0x0D, 0xF4, 0xF7, 0xF4, 0x0C, 0xF3, 0x0D, 0xF5, 0xF4, 0x0C, 0x0D, 0x0D,
+0xF4, 0x0C, 0xF4, 0xF4, 0xF3, 0x0C, 0xF4, 0xF4, 0x0C, 0x07, 0x0D, 0x0E, 0xF5, 0x14, 0xF4, 0x11,
+0xF2, 0xF3, 0x0E, 0xF3, 0x0C, 0xF3, 0xF5, 0xF4, 0x0B, 0xF4, 0x0E, 0xF4, 0xF5, 0x0C, 0x0D, 0x0D,
+0xF3, 0x0B, 0xF5, 0xF3, 0xF3, 0x0C, 0xF3, 0xF3, 0x0C, 0x08, 0x0D, 0x0D, 0xF6, 0x11, 0xF4, 0x11,
+0xF3, 0xF4, 0x0D, 0xF4, 0x0C, 0xF3, 0xF5, 0xF4, 0x0D, 0xF4, 0x0C, 0xF4, 0xF4, 0x0B, 0x0C, 0x0E,
+0xF3, 0x0F, 0xF4, 0xF4, 0xF3, 0x0E, 0xF4, 0xF5, 0x0B, 0x08, 0x0C, 0x0E, 0xF6, 0x11, 0xF4, 0x12,
+0xF2, 0xF3, 0x0D, 0xF4, 0x0D, 0xF4, 0xF3, 0xF3, 0x0D, 0xF4, 0x0E, 0xF5, 0xF4, 0x0E, 0x0C, 0x0E,
+0xF3, 0x0D, 0xF4, 0xF5, 0xF4, 0x0C, 0xF4, 0xF4, 0x0C, 0x08, 0x0E, 0x0D, 0xF6, 0x13, 0xF3, 0x11,
+0xF4, 0xF0, 0x0F, 0xF1, 0x08, 0xF4, 0xF6, 0xF5, 0x0B, 0xF9, 0x0C, 0xF6, 0xF2, 0x08, 0x0D, 0x0C,
+0xF6, 0x10, 0xF7, 0xF2, 0xF2, 0x0E, 0xF2, 0xF4, 0x0D, 0x0A, 0x0C, 0x0D, 0xF7, 0x0A, 0xF1, 0x0A,
+0xF7, 0xF4, 0x0F, 0xF3, 0x09, 0xF6, 0xEF, 0xF2, 0x09, 0xF7, 0x0C, 0xF7, 0xF3, 0x09, 0x0D, 0x0C,
+0xF5, 0x10, 0xF5, 0xF4, 0xF4, 0x0C, 0xF3, 0xF3, 0x0A, 0x07, 0x0A, 0x0A, 0xF4, 0x0B, 0xF1, 0x0C,
+0xF4, 0xF5, 0x0E, 0xF3, 0x0C, 0xF3, 0xF5, 0xF2, 0x0C, 0xF7, 0x0E, 0xF5, 0xF3, 0x0C, 0x0C, 0x0D,
+0xF4, 0x12, 0xF4, 0xF4, 0xF4, 0x0C, 0xF3, 0xF4, 0x0A, 0x08, 0x0C, 0x0C, 0xF6, 0x0E, 0xF1, 0x0F,
+0xF3, 0xF3, 0x0B, 0xF4, 0x0E, 0xF4, 0xF6, 0xF4, 0x0C, 0xF3, 0x0D, 0xF4, 0xF4, 0x0C, 0x0B, 0x10,
+0xF4, 0x0E, 0xF6, 0xF4, 0xF3, 0x0E, 0xF4, 0xF4, 0x0D, 0x08, 0x0E, 0x0E, 0xF5, 0x14, 0xF3, 0x13,
+0xF1, 0xF4, 0x0D, 0xF5, 0x0E, 0xF2, 0xF7, 0xF5, 0x0D, 0xF5, 0x0C, 0xF7, 0xF5, 0x0C, 0x0C, 0x0C,
+0xF3, 0x0D, 0xF5, 0xF4, 0xF3, 0x0D, 0xF5, 0xF4, 0x0B, 0x07, 0x0C, 0x0E, 0xF7, 0x11, 0xF4, 0x10,
+0xF3, 0xF4, 0x0D, 0xF4, 0x0D, 0xF4, 0xF3, 0xF2, 0x0B, 0xF4, 0x0E, 0xF5, 0xF4, 0x0B, 0x0B, 0x0C,
+0xF4, 0x0D, 0xF5, 0xF4, 0xF3, 0x0D, 0xF5, 0xF2, 0x0C, 0x05, 0x0B, 0x0F, 0xF9, 0x0E, 0xF1, 0x0E,
+0xF3, 0xF3, 0x0C, 0xF3, 0x0D, 0xF3, 0xF7, 0xF4, 0x0F, 0xF3, 0x0C, 0xF5, 0xF4, 0x0E, 0x0D, 0x0C,
+0xF3, 0x0E, 0xF4, 0xF4, 0xF3, 0x0E, 0xF4, 0xF5, 0x0C, 0x08, 0x0D, 0x0E, 0xF5, 0x14, 0xF4, 0x12,
+0xF4, 0xF2, 0x0D, 0xF3, 0x0B, 0xF5, 0xF2, 0xF1, 0x0C, 0xF5, 0x0E, 0xF5, 0xF2, 0x0B, 0x0C, 0x0C,
+0xF5, 0x0F, 0xF5, 0xF5, 0xF2, 0x0D, 0xF2, 0xF1, 0x0C, 0x08, 0x0C, 0x0E, 0xF8, 0x0C, 0xF2, 0x0B,
+0xF5, 0xF0, 0x0D, 0xF2, 0x0B, 0xF6, 0xF4, 0xF5, 0x09, 0xFA, 0x0E, 0xF5, 0xF2, 0x09, 0x10, 0x10,
+0xF7, 0x0D, 0xF6, 0xF7, 0xF4, 0x0C, 0xF3, 0xF2, 0x09, 0x07, 0x0D, 0x0C, 0xF6, 0x0B, 0xF5, 0x0E,
+0xF3, 0xF1, 0x0A, 0xF0, 0x0C, 0xF1, 0xF6, 0xF2, 0x07, 0xF7, 0x10, 0xF8, 0xEE, 0x06, 0x0D, 0x0E,
+0xF3, 0x0F, 0xF0, 0xF1, 0xF5, 0x11, 0xF6, 0xF6, 0x06, 0x0A, 0x0C, 0x0C, 0xF6, 0x08, 0xF5, 0x0E,
+0xF2, 0xF0, 0x10, 0xF8, 0x07, 0xF7, 0xF7, 0xF5, 0x08, 0xFC, 0x0E, 0xF8, 0xF0, 0x09, 0x0A, 0x10,
+0xF6, 0x0B, 0xF7, 0xF6, 0xF0, 0x0E, 0xF3, 0xF3, 0x08, 0x08, 0x0A, 0x0B, 0xF3, 0x09, 0xF6, 0x12,
+0xF6, 0xF5, 0x10, 0xF1, 0x0B, 0xF6, 0xF2, 0xF5, 0x09, 0xF8, 0x0E, 0xF5, 0xF2, 0x09, 0x0B, 0x0C,
+0xF6, 0x10, 0xF6, 0xF4, 0xF1, 0x0F, 0xF4, 0xF0, 0x09, 0x08, 0x0D, 0x0C, 0xF4, 0x0C, 0xF4, 0x0E,
+0xF2, 0xF4, 0x0F, 0xF3, 0x0B, 0xF4, 0xF3, 0xF4, 0x0B, 0xF5, 0x0C, 0xF4, 0xF4, 0x0A, 0x0B, 0x0F,
+0xF5, 0x0C, 0xF5, 0xF4, 0xF4, 0x0C, 0xF3, 0xF5, 0x09, 0x06, 0x0D, 0x0B, 0xF7, 0x0D, 0xF5, 0x0D,
+0xF5, 0xF0, 0x0C, 0xF2, 0x08, 0xF2, 0xF1, 0xF5, 0x0B, 0xF8, 0x0F, 0xF4, 0xF6, 0x07, 0x0E, 0x0E,
+0xF5, 0x0B, 0xF6, 0xF6, 0xF7, 0x0B, 0xF1, 0xF3, 0x0A, 0x07, 0x0C, 0x0D, 0xF4, 0x0C, 0xF6, 0x0F,
+0xF6, 0xEF, 0x0E, 0xF7, 0x0B, 0xF5, 0xF1, 0xF4, 0x09, 0xF7, 0x11, 0xF6, 0xF1, 0x09, 0x0F, 0x10,
+0xF7, 0x0F, 0xF7, 0xF6, 0xF4, 0x0A, 0xF1, 0xF1, 0x09, 0x06, 0x0D, 0x0B, 0xF4, 0x0B, 0xF2, 0x0F,
+0xF7, 0xF0, 0x0B, 0xEF, 0x07, 0xF6, 0xF4, 0xF5, 0x04, 0xFC, 0x0A, 0xF9, 0xF3, 0x00, 0x0E, 0x11,
+0xF6, 0x0C, 0xF4, 0xF6, 0xF1, 0x0E, 0xEF, 0xF2, 0x04, 0x07, 0x0D, 0x0F, 0xEE, 0x09, 0xF3, 0x11,
+0xF9, 0xED, 0x0C, 0xED, 0x05, 0xF3, 0xF4, 0xF1, 0x08, 0xFB, 0x12, 0xF8, 0xED, 0x04, 0x0C, 0x0C,
+0xF0, 0x12, 0xF2, 0xF6, 0xF3, 0x11, 0xF2, 0xED, 0x07, 0x08, 0x09, 0x0E, 0xF5, 0x04, 0xF5, 0x0B,
+0xFA, 0xFE, 0xFC, 0xFC, 0x05, 0x05, 0xFD, 0xFB, 0xFC, 0xFA, 0xFD, 0x05, 0xFB, 0xFE, 0x02, 0x00,
+0x02, 0x01, 0x01, 0xFF, 0x06, 0xFF, 0x05, 0x01, 0x00, 0xFA, 0x02, 0x00, 0xFE, 0x01, 0x02, 0xFB,
+0x01, 0xFE, 0xFE, 0xFA, 0xFA, 0xFC, 0x00, 0xFE, 0x02, 0xFE, 0x03, 0x02, 0x06, 0x01, 0x03, 0xFF,
+0xFF, 0x04, 0x04, 0xFE, 0x01, 0xFB, 0xFD, 0x05, 0xFE, 0x05, 0xFF, 0x00, 0x01, 0xFD, 0xFC, 0x01,
+0x02, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0x06, 0xFA, 0xFC, 0x03, 0x03, 0x04, 0xFA, 0x05, 0xFC, 0x01,
+0xFF, 0xFE, 0x01, 0x04, 0xFF, 0xFE, 0x03, 0x06, 0x00, 0x06, 0x04, 0xFC, 0x06, 0xFE, 0x04, 0x05,
+0x06, 0xFB, 0x01, 0x05, 0xFF, 0x05, 0xFE, 0x04, 0xFC, 0xFC, 0x04, 0x03, 0x04, 0xFB, 0xFB, 0xFC,
+0xFA, 0xFC, 0x06, 0xFD, 0x04, 0x01, 0x06, 0x04, 0x04, 0x02, 0xFB, 0x04, 0x04, 0x05, 0x04, 0x01,
+0x00, 0xFC, 0x05, 0xFE, 0xFA, 0xFD, 0xFE, 0x05, 0xFB, 0x05, 0xFD, 0xFB, 0x02, 0x03, 0xFB, 0x05,
+0xFD, 0xFD, 0x03, 0xFB, 0xFD, 0x03, 0x02, 0xFE, 0x01, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0xFB, 0xFA,
+0xFC, 0x01, 0x05, 0xFA, 0x02, 0x05, 0x02, 0xFE, 0x04, 0xFD, 0xFD, 0x02, 0xFC, 0x03, 0x05, 0xFC,
+0x04, 0x06, 0xFC, 0x04, 0xFE, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFD, 0x03, 0x06, 0xFB, 0xFD,
+0x03, 0x05, 0x00, 0x03, 0x02, 0xFF, 0x00, 0xFB, 0x06, 0x00, 0xFD, 0x01, 0x00, 0xFB, 0xFA, 0xFE,
+0xFA, 0x06, 0xFC, 0xFF, 0x00, 0x02, 0xFB, 0x03, 0xFC, 0x04, 0x06, 0xFF, 0xFE, 0x04, 0x06, 0x01,
+0xFF, 0xFF, 0xFD, 0xFB, 0x01, 0xFC, 0xFD, 0xFA, 0xFF, 0xFA, 0x05, 0xFC, 0xFB, 0x02, 0x05, 0x05,
+0x00, 0xFF, 0xFD, 0xFD, 0x05, 0xFA, 0x06, 0x03, 0x00, 0x06, 0xFA, 0x06, 0x03, 0x02, 0xFB, 0x02,
+0x01, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0x01, 0x02, 0xFE, 0x03, 0xFE, 0x01, 0x01, 0xFD, 0xFF, 0xFF,
+0x02, 0xFF, 0x01, 0x02, 0x01, 0xFE, 0x01, 0x01, 0xFF, 0xFE, 0xFF, 0xFE, 0x01, 0xFF, 0x01, 0x00,
+0x02, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0x04, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0x01, 0xFE, 0xFE, 0xFF,
+0x02, 0xFF, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x01, 0x01,
+0x01, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0x01, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0x02, 0xFD, 0xFF, 0xFF,
+0x01, 0xFF, 0x02, 0x01, 0x01, 0x00, 0x02, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x01, 0x00,
+0x01, 0xFF, 0xFF, 0x02, 0x00, 0x02, 0x01, 0x02, 0xFD, 0x04, 0xFE, 0x01, 0x01, 0xFF, 0xFC, 0xFE,
+0x03, 0x00, 0x00, 0x01, 0x03, 0xFE, 0xFF, 0x03, 0xFE, 0xF9, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0x02,
+0x01, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0x01, 0x02, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFD, 0x01, 0xFE,
+0x01, 0xFD, 0x00, 0x01, 0x00, 0xFD, 0x04, 0x00, 0xFD, 0xF9, 0x00, 0xFF, 0x01, 0xFE, 0x01, 0xFF,
+0x02, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFE, 0x02, 0xFF, 0x01, 0x02, 0xFE, 0xFF, 0x00,
+0x01, 0xFF, 0x01, 0x02, 0x02, 0xFF, 0x02, 0x01, 0xFE, 0xFF, 0xFE, 0xFF, 0x02, 0xFF, 0x01, 0x00,
+0x02, 0x01, 0xFE, 0x00, 0xFE, 0x01, 0x03, 0x02, 0xFD, 0x03, 0xFF, 0x02, 0x01, 0xFD, 0xFE, 0xFF,
+0x01, 0xFF, 0x02, 0x01, 0x02, 0xFE, 0x01, 0x01, 0xFE, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x01, 0x00,
+0x02, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFF, 0x02, 0xFF, 0x02, 0x00, 0x02, 0x01, 0xFE, 0xFE, 0xFF,
+0x01, 0xFE, 0x02, 0x01, 0x02, 0xFE, 0x02, 0x01, 0xFE, 0xFE, 0xFE, 0xFE, 0x01, 0xFF, 0x01, 0xFF,
+0x02, 0x01, 0xFF, 0x01, 0xFF, 0x02, 0x02, 0x02, 0xFF, 0x01, 0xFE, 0x02, 0x01, 0xFE, 0xFE, 0xFF,
+0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0xFF, 0xFE, 0xFF, 0xFE, 0x03, 0xFF, 0x02, 0xFE,
+0x01, 0x01, 0x00, 0x01, 0xFE, 0x01, 0x03, 0x01, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0xFE, 0xFF, 0xFF,
+0x02, 0xFE, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0xFF, 0xFC, 0xFE, 0xFF, 0x01, 0xFF, 0x00, 0xFD,
+0x01, 0x01, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFE, 0x03, 0xFE, 0x02, 0x00, 0xFE, 0xFE, 0xFE,
+0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x04, 0x00, 0xFF, 0xFB, 0xFF, 0xFF, 0x02, 0xFE, 0x01, 0xFE,
+0x01, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0xFD, 0x03, 0xFE, 0x02, 0x00, 0xFE, 0xFE, 0xFD,
+0x01, 0xFE, 0x01, 0x01, 0x01, 0xFE, 0x01, 0x00, 0xFE, 0xFC, 0xFE, 0xFE, 0x02, 0xFF, 0x00, 0xFE,
+0x01, 0x00, 0xFD, 0x01, 0xFE, 0x01, 0xFF, 0x01, 0xFD, 0x03, 0x00, 0x03, 0x02, 0xFD, 0xFF, 0xFF,
+0x00, 0xFE, 0x02, 0x02, 0x02, 0xFF, 0x01, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x01,
+0x01, 0x00, 0xFF, 0x00, 0xFE, 0x01, 0xFF, 0xFF, 0xFD, 0x01, 0xFE, 0x01, 0x01, 0xFE, 0xFE, 0xFF,
+0x02, 0xFE, 0x02, 0x01, 0x01, 0xFF, 0x03, 0x00, 0xFE, 0xFB, 0xFE, 0xFF, 0x01, 0xFF, 0x01, 0xFC,
+0x01, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFD, 0x03, 0xFF, 0x01, 0x01, 0xFC, 0xFE, 0xFF,
+0x01, 0xFF, 0x01, 0x00, 0x02, 0xFE, 0x02, 0x00, 0xFE, 0xFC, 0xFE, 0xFE, 0x01, 0xFF, 0x00, 0xFE,
+0x02, 0x01, 0xFF, 0x01, 0xFF, 0x02, 0x02, 0x01, 0xFD, 0x03, 0xFF, 0x03, 0x01, 0xFE, 0xFF, 0xFF,
+0x02, 0xFF, 0x02, 0x01, 0x01, 0xFF, 0x01, 0x01, 0xFF, 0xFE, 0xFF, 0xFE, 0x03, 0xFF, 0x01, 0xFF,
+0x01, 0x01, 0xFE, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFD, 0x03, 0xFE, 0x02, 0x01, 0xFE, 0xFE, 0xFE,
+0x01, 0xFE, 0x02, 0x01, 0x01, 0xFE, 0x03, 0x02, 0xFF, 0xFC, 0xFE, 0xFE, 0x01, 0xFE, 0x01, 0xFD,
+0x01, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x02, 0x02, 0xFE, 0x03, 0xFF, 0x02, 0x01, 0xFE, 0xFF, 0xFE,
+0x01, 0xFF, 0x01, 0x02, 0x01, 0xFD, 0x01, 0x02, 0xFF, 0xFB, 0xFE, 0x00, 0x02, 0xFE, 0x01, 0xFB,
+0x00, 0x01, 0xFD, 0x01, 0xFE, 0x01, 0x02, 0x00, 0xFE, 0x02, 0xFE, 0x02, 0x01, 0xFF, 0xFE, 0xFE,
+0x01, 0x00, 0x02, 0x01, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xFB, 0xFD, 0xFF, 0x02, 0xFE, 0x01, 0xFB,
+0x02, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0x01, 0x02, 0xFE, 0x02, 0xFD, 0x03, 0x02, 0xFE, 0xFD, 0xFF,
+0x02, 0xFD, 0x02, 0x01, 0x02, 0xFF, 0x02, 0x01, 0xFE, 0xFD, 0xFF, 0xFE, 0x03, 0xFE, 0x02, 0x01,
+0x02, 0x02, 0xFE, 0x01, 0xFF, 0x02, 0x01, 0x00, 0xFE, 0x04, 0xFE, 0x03, 0x01, 0xFD, 0xFF, 0xFE,
+0x02, 0xFE, 0x02, 0x03, 0x01, 0xFF, 0x01, 0x03, 0xFE, 0xFD, 0xFD, 0xFE, 0x02, 0xFE, 0x02, 0xFF,
+0x01, 0x01, 0xFF, 0x01, 0xFF, 0x02, 0x02, 0x01, 0xFE, 0x02, 0xFE, 0x02, 0x01, 0xFE, 0xFD, 0xFE,
+0x02, 0x00, 0x01, 0x01, 0x00, 0xFE, 0x01, 0x01, 0xFF, 0xFA, 0xFD, 0xFF, 0x03, 0xFE, 0x01, 0xFB,
+0x01, 0x01, 0xFF, 0x02, 0xFF, 0x01, 0x04, 0x00, 0xFE, 0x02, 0x00, 0x02, 0x01, 0xFE, 0xFF, 0xFF,
+0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x02, 0xFE, 0xFB, 0xFD, 0x00, 0x02, 0xFE, 0x01, 0xFA,
+0x02, 0x02, 0xFF, 0x01, 0xFE, 0x02, 0x01, 0x01, 0xFD, 0x02, 0xFF, 0x02, 0x01, 0xFE, 0xFE, 0xFE,
+0x01, 0xFD, 0x02, 0x02, 0x01, 0xFD, 0x02, 0x01, 0xFE, 0xFC, 0xFE, 0xFD, 0x02, 0xFE, 0x01, 0xFD,
+0x01, 0x00, 0xFE, 0x01, 0xFE, 0x01, 0x01, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0x01, 0xFF, 0xFE, 0xFF,
+0x02, 0xFE, 0x01, 0x01, 0x01, 0xFE, 0x04, 0x00, 0xFF, 0xFB, 0xFE, 0xFE, 0x02, 0xFE, 0x02, 0xFA,
+0x01, 0x00, 0xFD, 0x02, 0xFD, 0x01, 0x05, 0x02, 0xFE, 0x03, 0xFF, 0x02, 0x01, 0xFD, 0xFF, 0x01,
+0x02, 0x00, 0x02, 0x01, 0x00, 0xFE, 0x03, 0x02, 0xFE, 0xFA, 0xFF, 0xFE, 0x01, 0xFE, 0x00, 0xFC,
+0x01, 0x00, 0xFD, 0x01, 0xFF, 0x02, 0x01, 0x00, 0xFD, 0x03, 0xFF, 0x01, 0x01, 0xFD, 0xFE, 0xFE,
+0x02, 0xFF, 0x02, 0x02, 0x01, 0xFE, 0x03, 0x01, 0xFD, 0xFA, 0xFE, 0xFF, 0x03, 0xFE, 0x00, 0xFA,
+0x01, 0x03, 0xFF, 0x00, 0xFE, 0x02, 0x03, 0x02, 0xFC, 0x02, 0xFE, 0x02, 0x01, 0xFE, 0xFF, 0xFC,
+0x01, 0xFC, 0x03, 0x01, 0x04, 0xFD, 0x01, 0x02, 0x00, 0xFB, 0x00, 0xFF, 0x02, 0xFD, 0x01, 0xFB,
+0x01, 0x01, 0xFD, 0x02, 0xFE, 0x03, 0x05, 0x02, 0xFE, 0x01, 0xFD, 0x02, 0x01, 0xFE, 0xFF, 0xFD,
+0x04, 0xFD, 0x02, 0x02, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFB, 0xFF, 0xFE, 0x03, 0xFE, 0x03, 0xFD,
+0x00, 0x01, 0xFE, 0x00, 0xFE, 0x02, 0x01, 0x01, 0xFD, 0x03, 0x00, 0x03, 0x02, 0xFD, 0xFE, 0xFE,
+0x02, 0xFD, 0x02, 0x00, 0x01, 0xFD, 0x01, 0x02, 0xFD, 0xFA, 0xFE, 0xFF, 0x03, 0xFD, 0x01, 0xFB,
+0x02, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x01, 0xFE, 0x02, 0x00, 0x01, 0x01, 0xFE, 0xFF, 0xFE,
+0x02, 0xFC, 0x02, 0x01, 0x02, 0xFD, 0x03, 0x02, 0xFF, 0xFB, 0xFF, 0xFF, 0x02, 0xFE, 0x02, 0xFD,
+0x02, 0x01, 0xFE, 0x02, 0xFF, 0x01, 0x05, 0x02, 0xFE, 0x02, 0x00, 0x01, 0x01, 0xFD, 0xFF, 0xFF,
+0x02, 0xFE, 0x01, 0x01, 0x01, 0xFC, 0x00, 0x04, 0xFE, 0xFB, 0xFF, 0xFE, 0x01, 0xFE, 0x01, 0xFD,
+0x02, 0x02, 0xFE, 0x01, 0xFF, 0x02, 0x02, 0x00, 0xFF, 0x02, 0xFF, 0x02, 0x00, 0xFF, 0xF5, 0x00,
+0x01, 0xFB, 0x00, 0x01, 0x01, 0xFE, 0x04, 0x05, 0xFF, 0xF7, 0xFE, 0xFE, 0x02, 0xFD, 0x01, 0xF5,
+0x01, 0x02, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x01, 0x01, 0xFE, 0xFD, 0xFE,
+0x01, 0xFF, 0x01, 0x01, 0x02, 0xF9, 0x03, 0x01, 0xFD, 0xF8, 0xFF, 0xFF, 0x03, 0xFE, 0x01, 0xF4,
+0x01, 0x01, 0xFF, 0x01, 0xFE, 0x02, 0x03, 0x00, 0xFD, 0x03, 0xFB, 0x02, 0x01, 0xFC, 0xFA, 0xFD,
+0x02, 0x00, 0x02, 0x00, 0x01, 0xFE, 0x03, 0x00, 0xFE, 0xF8, 0xFD, 0xFC, 0x03, 0xFD, 0x02, 0xF7,
+0x00, 0x03, 0xFB, 0x02, 0xFE, 0x02, 0x09, 0x03, 0xFF, 0x00, 0xFF, 0x05, 0x00, 0x00, 0xFE, 0xFE,
+0x02, 0xFC, 0x02, 0x04, 0x02, 0xFE, 0xFF, 0x00, 0xFF, 0xF8, 0xFE, 0xFE, 0x03, 0xFC, 0x00, 0xFB,
+0x01, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x07, 0x00, 0xFE, 0x04, 0xFD, 0x02, 0x03, 0xFE, 0xFF, 0xFD,
+0x03, 0xFE, 0x01, 0x02, 0x01, 0xFC, 0x03, 0x00, 0xFD, 0xF3, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xFC,
+0x01, 0x02, 0xFA, 0x00, 0x01, 0x01, 0x0A, 0x00, 0xFF, 0x00, 0xFF, 0x02, 0x02, 0x00, 0xFE, 0xFB,
+0x01, 0x00, 0x02, 0x02, 0x01, 0xFC, 0xFE, 0x0C, 0xFD, 0xF8, 0xFF, 0xFE, 0x02, 0xFD, 0xFF, 0xF8,
+0x02, 0x03, 0xFF, 0x02, 0xFF, 0x01, 0x03, 0x05, 0x01, 0x01, 0xFE, 0x02, 0x02, 0xFF, 0xFF, 0xFE,
+0x01, 0xFA, 0x03, 0x01, 0x02, 0xFB, 0x01, 0x04, 0xFF, 0xF8, 0xFD, 0xFE, 0x03, 0xFE, 0x03, 0xFA,
+0x01, 0x01, 0xFA, 0x00, 0xFE, 0x01, 0x04, 0x02, 0xFE, 0x01, 0xFA, 0x01, 0x01, 0x00, 0xFE, 0xFD,
+0x01, 0xFE, 0x02, 0x01, 0x01, 0xFF, 0x0C, 0x01, 0xFD, 0xF8, 0xFE, 0xFE, 0x03, 0xFD, 0x00, 0xFC,
+0x01, 0x04, 0xFF, 0x06, 0xFD, 0x01, 0x08, 0x01, 0xFD, 0x01, 0xFE, 0x02, 0x01, 0xFE, 0xFE, 0xFF,
+0xFF, 0xFE, 0x02, 0x00, 0x04, 0xFD, 0x01, 0x00, 0x00, 0xF9, 0xFE, 0xFE, 0x01, 0xFD, 0x04, 0xF6,
+0x01, 0x02, 0xFF, 0xFF, 0xFD, 0x02, 0x01, 0x05, 0xFF, 0x02, 0xFE, 0x02, 0x03, 0xFD, 0xFB, 0xFA,
+0x02, 0xFD, 0x01, 0x02, 0x03, 0xFD, 0x00, 0x01, 0xFE, 0xF9, 0xFE, 0xFF, 0x01, 0xFD, 0x00, 0xF8,
+0x02, 0x04, 0xFE, 0x03, 0xFD, 0x01, 0x00, 0x05, 0xFD, 0x01, 0xFE, 0x04, 0x03, 0xFC, 0xFD, 0xFF,
+0x01, 0xFA, 0x01, 0x01, 0x04, 0xFB, 0xFC, 0x02, 0xFC, 0xF9, 0xFE, 0xFD, 0x02, 0xFD, 0x05, 0xFC,
+0x01, 0x06, 0xFF, 0x02, 0xFF, 0x02, 0x05, 0x06, 0xFE, 0x03, 0xFC, 0x03, 0x01, 0xFE, 0xFC, 0xFB,
+0x02, 0x00, 0x03, 0x02, 0x01, 0xFD, 0x02, 0x00, 0xFE, 0xF7, 0xFC, 0x00, 0x02, 0xFC, 0x02, 0xFF,
+0x00, 0x03, 0xFF, 0x03, 0xFE, 0x02, 0x07, 0x01, 0xFF, 0x00, 0xFE, 0x01, 0x01, 0xFC, 0xFD, 0xFD,
+0x03, 0xFE, 0x02, 0x03, 0x02, 0xFD, 0x02, 0x00, 0xFE, 0xF6, 0xFD, 0xFC, 0x03, 0xFB, 0x02, 0xFA,
+0x01, 0x04, 0xFE, 0x04, 0xFF, 0x04, 0x09, 0x06, 0xFF, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
+0x02, 0xFD, 0x00, 0x00, 0x02, 0xFA, 0x05, 0x01, 0xFF, 0xF9, 0xFE, 0xFE, 0x02, 0xFC, 0x03, 0xFC,
+0x02, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0x02, 0x03, 0xFE, 0x02, 0xFE, 0x02, 0x02, 0xFE, 0xFD, 0xFE,
+0x01, 0xFF, 0x04, 0x02, 0x05, 0x00, 0x05, 0xFF, 0xFE, 0xF9, 0xFE, 0xFD, 0x02, 0xFD, 0x01, 0x00,
+0x04, 0x03, 0xFB, 0xFF, 0xFF, 0x02, 0x01, 0x04, 0x01, 0x02, 0xF9, 0x00, 0x00, 0xFE, 0xFD, 0xFC,
+0x01, 0xFA, 0x03, 0x04, 0xFF, 0x01, 0x05, 0x02, 0xFF, 0xF8, 0xFF, 0xFF, 0x03, 0xFD, 0x02, 0xF8,
+0x03, 0x01, 0x00, 0x06, 0xFE, 0x06, 0xFC, 0x03, 0xFE, 0x06, 0x00, 0x00, 0x04, 0xFE, 0x03, 0xFB,
+0x04, 0x02, 0xFF, 0xFC, 0x02, 0xFE, 0x01, 0x02, 0x03, 0xFB, 0x06, 0xFC, 0x04, 0x04, 0x05, 0xFC,
+0x00, 0x02, 0xFA, 0xFE, 0x02, 0x02, 0x00, 0x06, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFF, 0xFE, 0xFF,
+0xFB, 0xFE, 0xFF, 0xFF, 0xFB, 0xFE, 0x02, 0x04, 0x06, 0x04, 0xFC, 0xFE, 0xFB, 0xFA, 0x05, 0x04,
+0x00, 0x00, 0x01, 0xFE, 0xFD, 0xFE, 0xFB, 0xFB, 0x04, 0xFA, 0x01, 0x01, 0x00, 0xFF, 0xFD, 0xFD,
+0x02, 0xFF, 0xFA, 0xFD, 0xFA, 0x06, 0xFA, 0xFD, 0x03, 0xFE, 0xFA, 0xFE, 0x01, 0x03, 0xFF, 0x00,
+0x05, 0xFD, 0x04, 0xFE, 0xFF, 0x04, 0xFE, 0xFF, 0x05, 0xFD, 0x03, 0xFA, 0x05, 0x01, 0x04, 0x01,
+0xFD, 0xFA, 0xFB, 0x05, 0xFA, 0xFB, 0x03, 0x04, 0x05, 0xFE, 0x03, 0x04, 0xFD, 0xFD, 0xFF, 0x03,
+0x03, 0xFF, 0x03, 0x06, 0xFC, 0x01, 0xFC, 0x01, 0x01, 0x04, 0xFD, 0xFA, 0x04, 0x01, 0x05, 0xFC,
+0xFE, 0xFA, 0x04, 0xFA, 0x01, 0x06, 0xFE, 0x03, 0xFD, 0xFC, 0x03, 0xFA, 0xFF, 0x03, 0xFD, 0x01,
+0x04, 0xFD, 0xFF, 0x03, 0x06, 0x00, 0xFE, 0xFD, 0x06, 0x00, 0xFB, 0x01, 0x05, 0xFE, 0xFE, 0x04,
+0x05, 0xFA, 0x05, 0xFD, 0x01, 0x05, 0xFA, 0x03, 0xFA, 0x04, 0x02, 0xFB, 0x06, 0x04, 0x03, 0x06,
+0x06, 0xFB, 0xFC, 0xFB, 0xFD, 0x06, 0xFC, 0x02, 0x00, 0xFD, 0xFE, 0x04, 0xFA, 0x03, 0x06, 0xFD,
+0x03, 0x01, 0x01, 0xFF, 0x05, 0x01, 0x05, 0x06, 0x01, 0x03, 0x05, 0x05, 0xFF, 0xFB, 0x05, 0x03,
+0xFA, 0xFA, 0xFD, 0xFD, 0x03, 0xFB, 0x02, 0xFC, 0xFF, 0x02, 0x01, 0x02, 0xFD, 0xFE, 0xFF, 0x03,
+0x03, 0x04, 0xFC, 0x01, 0xFC, 0xFF, 0x06, 0x05, 0x02, 0x03, 0x01, 0xFA, 0xFD, 0x02, 0x06, 0xFC,
+0x03, 0x04, 0xFA, 0x05, 0xFA, 0x04, 0x02, 0x0A, 0xFF, 0x02, 0xFF, 0x02, 0x08, 0xFC, 0xFA, 0xFB,
+0x02, 0xFD, 0x03, 0x05, 0x08, 0xFA, 0x05, 0x07, 0xFA, 0x01, 0xF9, 0xFC, 0x05, 0xFF, 0x06, 0xF7,
+0x01, 0x04, 0x00, 0x06, 0xFA, 0x0A, 0x0A, 0x09, 0x02, 0x05, 0xF9, 0x01, 0x01, 0x00, 0xF8, 0xFC,
+0xFF, 0xF8, 0x04, 0x0C, 0x00, 0xF6, 0x02, 0x08, 0xFA, 0x03, 0xF7, 0xFD, 0x07, 0x01, 0x02, 0xFD,
+0x06, 0x06, 0xFE, 0x04, 0xFA, 0x04, 0x04, 0x04, 0xFA, 0x05, 0xFE, 0x03, 0x05, 0xFC, 0xFA, 0xFC,
+0x05, 0xFB, 0x06, 0x04, 0x05, 0xF9, 0x03, 0x04, 0xFA, 0x02, 0xFA, 0xFB, 0x05, 0xFE, 0x05, 0xFC,
+0x04, 0x03, 0xF7, 0x01, 0xFB, 0x03, 0x04, 0x02, 0xFE, 0x00, 0xFB, 0x04, 0x06, 0xFD, 0xFE, 0xFC,
+0x04, 0xFC, 0x03, 0x00, 0x08, 0xF5, 0x03, 0x0B, 0xFD, 0x03, 0xFC, 0xFB, 0x08, 0xFF, 0x03, 0xFC,
+0x09, 0x02, 0xF7, 0x0B, 0x01, 0x03, 0x02, 0x05, 0xFE, 0x01, 0xFE, 0x02, 0x02, 0x00, 0xFD, 0xF6,
+0x01, 0xF7, 0x08, 0x05, 0x03, 0xFB, 0x08, 0x0C, 0x02, 0x02, 0xFD, 0xFE, 0x05, 0xFF, 0x03, 0xFD,
+0x06, 0x05, 0xFA, 0x06, 0xFB, 0x05, 0x04, 0x05, 0xFC, 0x04, 0xFB, 0x05, 0x05, 0xFD, 0xFB, 0xFC,
+0x06, 0xFB, 0x05, 0x05, 0x05, 0xFB, 0x06, 0x04, 0xFD, 0x02, 0xFB, 0xFC, 0x06, 0xFF, 0x04, 0xFC,
+0x05, 0x04, 0xF7, 0x02, 0xFC, 0x07, 0x09, 0x0B, 0xFC, 0x00, 0xFC, 0xFF, 0x07, 0xFE, 0xFA, 0xF9,
+0x06, 0xFD, 0x04, 0x05, 0x01, 0xFF, 0x0A, 0x0B, 0xFE, 0x03, 0xFC, 0xFC, 0x06, 0xFF, 0x02, 0xFF,
+0x00, 0x06, 0xFA, 0x07, 0xFF, 0x04, 0x09, 0x06, 0xFC, 0x04, 0xFD, 0x03, 0x03, 0xFD, 0xFA, 0xFD,
+0x02, 0xFE, 0x04, 0x07, 0x06, 0xFA, 0x04, 0x06, 0xFD, 0x03, 0xF4, 0xFC, 0x07, 0x00, 0x0A, 0xFA,
+0x06, 0x06, 0xF7, 0x05, 0xFD, 0x01, 0x04, 0x04, 0xFD, 0x02, 0xFA, 0x04, 0x08, 0xFE, 0xFE, 0xFD,
+0x04, 0xF8, 0x01, 0x06, 0x04, 0xF9, 0x01, 0x05, 0xF9, 0x03, 0xF9, 0xFB, 0x04, 0xFF, 0x02, 0xFB,
+0x06, 0x05, 0xFC, 0x05, 0xFC, 0x05, 0x04, 0x05, 0xFC, 0x05, 0xFA, 0x05, 0x04, 0xFC, 0xFC, 0xFB,
+0x05, 0xFB, 0x05, 0x05, 0x05, 0xFB, 0x05, 0x06, 0xFC, 0x02, 0xFB, 0xFC, 0x07, 0xFF, 0x05, 0xFF,
+0x05, 0x07, 0xFD, 0x04, 0xF9, 0x03, 0x01, 0x04, 0xF9, 0x05, 0xFC, 0x04, 0x05, 0xFA, 0xFC, 0xFE,
+0x03, 0xF9, 0x08, 0x06, 0x04, 0xFC, 0x07, 0x05, 0xFD, 0x03, 0xFB, 0xFB, 0x04, 0xFF, 0x06, 0xFC,
+0x05, 0x05, 0xFB, 0x03, 0xFC, 0x04, 0x05, 0x03, 0xFB, 0x06, 0xFA, 0x03, 0x05, 0xF9, 0xFC, 0xFC,
+0x05, 0xFA, 0x05, 0x04, 0x05, 0xFC, 0x01, 0x04, 0xFB, 0x03, 0xFB, 0xFB, 0x05, 0xFF, 0x05, 0xFD,
+0x04, 0x06, 0xF9, 0x06, 0xFC, 0x04, 0x04, 0x06, 0xFC, 0x02, 0xFC, 0x05, 0x05, 0xFE, 0xFC, 0xFA,
+0x03, 0xF9, 0x04, 0x05, 0x05, 0xFE, 0x06, 0x05, 0xFB, 0x02, 0xFB, 0xFB, 0x07, 0xFE, 0x05, 0xFE,
+0x05, 0x06, 0xFC, 0x03, 0xFC, 0x05, 0x03, 0x08, 0xFE, 0x02, 0xFC, 0x07, 0x08, 0xFD, 0xF7, 0xFA,
+0x02, 0xFA, 0x03, 0x03, 0x07, 0xFA, 0x05, 0x0A, 0xFC, 0x03, 0xFE, 0xFC, 0x01, 0xFF, 0x07, 0xFC,
+0x05, 0x04, 0xFB, 0x05, 0xFB, 0x06, 0x05, 0x05, 0xFC, 0x04, 0xFB, 0x04, 0x05, 0xFB, 0xFB, 0xFB,
+0x04, 0xFD, 0x04, 0x05, 0x05, 0xFA, 0x03, 0x04, 0xFC, 0x03, 0xFA, 0xFA, 0x07, 0xFF, 0x04, 0xFC,
+0x05, 0x04, 0xFB, 0x07, 0xFC, 0x03, 0x02, 0x09, 0xFC, 0x03, 0xF8, 0x09, 0x02, 0xFF, 0xFE, 0xFE,
+0x03, 0xFE, 0x03, 0x06, 0x0A, 0xFB, 0x04, 0x08, 0xFD, 0x02, 0xFB, 0xFE, 0x01, 0xFD, 0x05, 0xFB,
+0x04, 0x03, 0xFB, 0x02, 0xFF, 0x07, 0x09, 0x04, 0xFD, 0xFF, 0xF9, 0x02, 0x03, 0xFF, 0xF6, 0xFA,
+0x07, 0xFB, 0x03, 0x02, 0x02, 0xF9, 0x03, 0x0C, 0x02, 0x03, 0xFF, 0xF9, 0x04, 0x00, 0x08, 0xF9,
+0x05, 0x05, 0xFC, 0x05, 0xFB, 0x04, 0x05, 0x04, 0xFA, 0x05, 0xFE, 0x04, 0x04, 0xFC, 0xFC, 0xFD,
+0x04, 0xFB, 0x05, 0x06, 0x04, 0xFC, 0x04, 0x04, 0xFC, 0x03, 0xFB, 0xFC, 0x06, 0xFF, 0x04, 0xFC,
+0x06, 0x05, 0xFB, 0x04, 0xFB, 0x05, 0x03, 0x03, 0xFB, 0x06, 0xFB, 0x04, 0x04, 0xF9, 0xFA, 0xFB,
+0x06, 0xFC, 0x05, 0x05, 0x05, 0xFA, 0x04, 0x04, 0xFB, 0x03, 0xFB, 0xFB, 0x06, 0xFF, 0x04, 0xFE,
+0x07, 0x04, 0xFC, 0x05, 0xF9, 0x05, 0x03, 0x04, 0xFC, 0x06, 0xFD, 0x05, 0x06, 0xFC, 0xFA, 0xFC,
+0x04, 0xFC, 0x04, 0x04, 0x06, 0xF9, 0x04, 0x05, 0xFB, 0x03, 0xFA, 0xFC, 0x08, 0xFF, 0x04, 0xFC,
+0x05, 0x05, 0xFA, 0x04, 0xFC, 0x05, 0x04, 0x04, 0xFC, 0x04, 0xFC, 0x05, 0x04, 0xFC, 0xFC, 0xFB,
+0x06, 0xFB, 0x05, 0x05, 0x07, 0xFB, 0x03, 0x06, 0xFA, 0x03, 0xFA, 0xFC, 0x06, 0xFF, 0x06, 0xFC,
+0x05, 0x05, 0xFA, 0x04, 0xFB, 0x05, 0x03, 0x04, 0xFC, 0x04, 0xFC, 0x05, 0x05, 0xFC, 0xF9, 0xFB,
+0x05, 0xFB, 0x06, 0x04, 0x05, 0xFB, 0x03, 0x07, 0xFB, 0x03, 0xFA, 0xFC, 0x07, 0xFF, 0x05, 0xFD,
+0x05, 0x05, 0xFB, 0x05, 0xFB, 0x03, 0x05, 0x04, 0xFC, 0x04, 0xFB, 0x04, 0x04, 0xFD, 0xFC, 0xFC,
+0x05, 0xFC, 0x04, 0x05, 0x05, 0xFA, 0x04, 0x05, 0xFC, 0x02, 0xFC, 0xFC, 0x06, 0xFE, 0x05, 0xFE,
+0x07, 0x03, 0xFD, 0x05, 0xFA, 0x0B, 0x03, 0x03, 0xFE, 0xFE, 0xFF, 0x01, 0x03, 0x02, 0xFD, 0xFE,
+0x07, 0xF9, 0x05, 0x06, 0x0C, 0xFE, 0x03, 0x04, 0xF8, 0x03, 0xF9, 0xF8, 0x06, 0xFE, 0x03, 0xF9,
+0x03, 0x08, 0xFA, 0x04, 0xFB, 0x05, 0x07, 0x05, 0x01, 0x01, 0xFD, 0x00, 0x06, 0xFD, 0xFB, 0xFD,
+0x03, 0xFA, 0x03, 0x02, 0x07, 0xF8, 0x05, 0x09, 0xFB, 0x03, 0xF9, 0xF9, 0x09, 0x00, 0x05, 0xFA,
+0x05, 0x03, 0xFB, 0x01, 0xFD, 0x05, 0x08, 0x0A, 0xFD, 0x03, 0xFC, 0x01, 0x05, 0xFB, 0xFD, 0xFC,
+0x03, 0xFA, 0x07, 0x08, 0x02, 0xFA, 0x06, 0x04, 0xFE, 0x02, 0xF8, 0xF9, 0x06, 0xFF, 0x05, 0xFB,
+0x05, 0x05, 0xFB, 0x04, 0xFB, 0x06, 0x05, 0x05, 0xFC, 0x05, 0xFC, 0x03, 0x05, 0xFC, 0xFB, 0xFB,
+0x04, 0xFA, 0x06, 0x04, 0x05, 0xFA, 0x05, 0x05, 0xFD, 0x03, 0xFC, 0xFB, 0x07, 0xFF, 0x06, 0xFC,
+0x05, 0x05, 0xFB, 0x07, 0xFC, 0x05, 0x04, 0x05, 0xFC, 0x05, 0xFC, 0x05, 0x05, 0xFC, 0xFD, 0xFA,
+0x04, 0xFC, 0x06, 0x05, 0x05, 0xFA, 0x05, 0x04, 0xFA, 0x03, 0xFB, 0xFC, 0x07, 0xFF, 0x06, 0xFF,
+0x05, 0x05, 0xFC, 0x05, 0xFC, 0x04, 0x06, 0x04, 0xF9, 0x05, 0xFC, 0x06, 0x04, 0xF9, 0xFA, 0xFC,
+0x06, 0xFC, 0x06, 0x05, 0x05, 0xFC, 0x04, 0x05, 0xFB, 0x02, 0xFC, 0xFD, 0x08, 0xFF, 0x03, 0xFE,
+0x06, 0x04, 0xFB, 0x05, 0xFB, 0x05, 0x05, 0x06, 0xFC, 0x06, 0xFC, 0x04, 0x04, 0xFC, 0xFC, 0xFB,
+0x06, 0xF9, 0x05, 0x05, 0x05, 0xFB, 0x04, 0x03, 0xFC, 0x02, 0xFC, 0xFB, 0x07, 0xFF, 0x06, 0xFD,
+0x03, 0x05, 0xFC, 0x09, 0xFB, 0x05, 0x07, 0x04, 0x00, 0x00, 0xF5, 0x03, 0x05, 0x00, 0xFB, 0xF7,
+0x03, 0xFC, 0x05, 0x04, 0x07, 0xFC, 0x08, 0x07, 0xFE, 0x02, 0xFB, 0xFC, 0x0B, 0xFF, 0x02, 0xFA,
+0x05, 0x05, 0xF9, 0x05, 0x01, 0x0A, 0x05, 0x05, 0xFE, 0x02, 0xFC, 0x03, 0x08, 0x01, 0xFD, 0xFE,
+0x06, 0xFE, 0x08, 0x08, 0x09, 0xFC, 0x05, 0x02, 0xFB, 0x02, 0xFD, 0xF9, 0x0A, 0x00, 0x06, 0xF7,
+0x03, 0x02, 0xFB, 0x02, 0xFE, 0x07, 0x04, 0x05, 0xFC, 0x03, 0xF8, 0x02, 0x05, 0xFC, 0xF9, 0xF9,
+0x03, 0xFF, 0x05, 0x04, 0x09, 0xFE, 0x03, 0x04, 0xFA, 0x02, 0xFC, 0xFC, 0x08, 0xFF, 0x07, 0xF9,
+0x04, 0x05, 0xFC, 0x06, 0xFC, 0x04, 0x03, 0x05, 0xFD, 0x03, 0xFC, 0x02, 0x05, 0xFB, 0xFB, 0xFB,
+0x04, 0xFC, 0x04, 0x05, 0x06, 0xF9, 0x06, 0x06, 0xFC, 0x02, 0xFA, 0xFC, 0x07, 0x00, 0x05, 0xFA,
+0x06, 0x03, 0xFD, 0x05, 0xFB, 0x04, 0x04, 0x04, 0xFC, 0x08, 0xFC, 0x03, 0x04, 0xFA, 0xFD, 0xFD,
+0x05, 0xFC, 0x03, 0x02, 0x04, 0xFB, 0x08, 0x09, 0xFC, 0x02, 0xFC, 0xFA, 0x03, 0xFF, 0x05, 0xFD,
+0x05, 0x04, 0xFC, 0x06, 0xFC, 0x04, 0x04, 0x05, 0xFC, 0x04, 0xFA, 0x05, 0x04, 0xFC, 0xFB, 0xFB,
+0x04, 0xFB, 0x05, 0x05, 0x05, 0xFC, 0x04, 0x05, 0xFC, 0x03, 0xFB, 0xFB, 0x07, 0xFF, 0x05, 0xFC,
+0x05, 0x03, 0xFB, 0x06, 0xFC, 0x06, 0x04, 0x06, 0xFC, 0x04, 0xFC, 0x06, 0x04, 0xFC, 0xFB, 0xFB,
+0x05, 0xFC, 0x04, 0x05, 0x04, 0xFC, 0x06, 0x05, 0xFB, 0x02, 0xFC, 0xFD, 0x07, 0xFF, 0x05, 0xFE,
+0x04, 0x06, 0xFC, 0x06, 0xFA, 0x05, 0x01, 0x06, 0xFB, 0x05, 0xFD, 0x05, 0x05, 0xFC, 0xFB, 0xFE,
+0x05, 0xFC, 0x04, 0x03, 0x03, 0xF9, 0x05, 0x08, 0xFD, 0x01, 0xFC, 0xFC, 0x06, 0xFE, 0x05, 0x00,
+0x06, 0x06, 0xFC, 0x06, 0xFB, 0x05, 0x08, 0x04, 0xFC, 0x04, 0xFC, 0x03, 0x05, 0xFC, 0xFB, 0xFB,
+0x05, 0xFB, 0x04, 0x05, 0x05, 0xFB, 0x06, 0x06, 0xFC, 0x03, 0xFB, 0xFB, 0x05, 0x00, 0x03, 0xFC,
+0x05, 0x06, 0xFD, 0x04, 0xF9, 0x03, 0x04, 0x0A, 0x00, 0x00, 0xFE, 0xFF, 0x08, 0xFD, 0xF5, 0xFD,
+0x02, 0xF9, 0x05, 0x00, 0x06, 0xF2, 0x05, 0x02, 0xFA, 0x03, 0xFA, 0xFC, 0x06, 0x00, 0x01, 0xFC,
+0x04, 0x03, 0xFB, 0x06, 0xFD, 0x03, 0x03, 0x04, 0xFC, 0x06, 0xFC, 0x04, 0x04, 0xFB, 0xFB, 0xFA,
+0x05, 0xFC, 0x05, 0x05, 0x04, 0xFD, 0x05, 0x07, 0xFB, 0x02, 0xFB, 0xFB, 0x03, 0x01, 0x04, 0xFC,
+0x04, 0x03, 0xF9, 0x04, 0xFD, 0x05, 0x05, 0x05, 0xFB, 0x02, 0xFC, 0x03, 0x05, 0xFC, 0xFC, 0xFB,
+0x05, 0xFA, 0x06, 0x05, 0x05, 0xFA, 0x04, 0x03, 0xFC, 0x03, 0xFB, 0xFC, 0x03, 0xFE, 0x06, 0xFC,
+0x07, 0x05, 0xFC, 0x06, 0xFB, 0x03, 0x05, 0x07, 0xFD, 0x03, 0xFB, 0x03, 0x04, 0xFE, 0xFB, 0xFC,
+0x05, 0xF9, 0x05, 0x05, 0x05, 0xFA, 0x01, 0x07, 0xFC, 0x02, 0xFD, 0xFD, 0x05, 0xFF, 0x08, 0xFD,
+0x03, 0x03, 0xFC, 0x05, 0xFD, 0x04, 0x04, 0x04, 0xFD, 0x03, 0xFC, 0x05, 0x03, 0xFB, 0xFD, 0xFC,
+0x03, 0xFC, 0x04, 0x05, 0x05, 0xFB, 0x05, 0x05, 0xFB, 0x02, 0xFC, 0xFC, 0x07, 0xFE, 0x05, 0xFB,
+0x04, 0x04, 0xFD, 0x04, 0xFC, 0x03, 0x04, 0x03, 0xFE, 0x03, 0xFD, 0x06, 0x04, 0xFA, 0xFD, 0xFD,
+0x03, 0xFC, 0x05, 0x05, 0x03, 0xFA, 0x06, 0x04, 0xFC, 0xFF, 0xFC, 0xFD, 0x04, 0xFE, 0x05, 0xFC,
+0x05, 0x06, 0xF9, 0x06, 0xFD, 0x02, 0x04, 0x09, 0xFB, 0x03, 0xFC, 0x01, 0x05, 0xFB, 0xFA, 0xFC,
+0x03, 0xFC, 0x05, 0x04, 0x04, 0xFD, 0x03, 0x0A, 0xFB, 0x03, 0xFB, 0xFA, 0x05, 0xFF, 0x05, 0xFC,
+0x03, 0x02, 0xFA, 0x02, 0xFD, 0x00, 0x09, 0x06, 0xFD, 0x04, 0xFC, 0x06, 0x05, 0xFC, 0xFC, 0xFB,
+0x05, 0xFA, 0x03, 0x03, 0x07, 0xF9, 0x06, 0x07, 0x01, 0x03, 0xFD, 0xFA, 0x05, 0xFF, 0x07, 0xFD,
+0x04, 0x06, 0xFE, 0x06, 0xFD, 0x06, 0x07, 0x06, 0xFE, 0x01, 0xFE, 0x05, 0x08, 0xFD, 0xFC, 0xFB,
+0x03, 0xFA, 0x05, 0x05, 0x04, 0xF7, 0x04, 0x03, 0xFD, 0x02, 0xFB, 0xFE, 0x05, 0x00, 0x04, 0xFD,
+0x01, 0x06, 0xFD, 0x05, 0x01, 0x05, 0x07, 0x0A, 0xFF, 0xFF, 0xFB, 0xFD, 0x08, 0xFB, 0xFF, 0xFB,
+0x03, 0xF9, 0x09, 0x07, 0x01, 0xFF, 0x03, 0x00, 0xFF, 0x03, 0xFB, 0xFB, 0x05, 0x00, 0x09, 0xF9,
+0x05, 0x06, 0xFD, 0x08, 0xFD, 0x04, 0x0B, 0x04, 0xFE, 0x02, 0xF8, 0x04, 0x05, 0xFD, 0xFC, 0xFA,
+0x05, 0xFB, 0x06, 0x04, 0x03, 0xFC, 0x02, 0x02, 0xFD, 0x02, 0xFA, 0xFC, 0x06, 0xFF, 0x05, 0xF9,
+0x00, 0x03, 0xFD, 0x09, 0xFD, 0x02, 0x08, 0x08, 0x00, 0x03, 0xFB, 0x05, 0x07, 0x01, 0xFC, 0xFA,
+0x03, 0xF8, 0x07, 0x05, 0x07, 0xFE, 0x06, 0x08, 0x00, 0x02, 0xF8, 0xFC, 0x03, 0xFF, 0x07, 0xF9,
+0x04, 0x08, 0xF9, 0x03, 0xFC, 0x05, 0x04, 0x05, 0xFE, 0x03, 0xFD, 0x03, 0x03, 0xFE, 0xFD, 0xF8,
+0x06, 0xFA, 0x06, 0x05, 0x09, 0xF6, 0x04, 0x06, 0xFE, 0x02, 0xFE, 0xFB, 0x03, 0xFF, 0x04, 0xFB,
+0x03, 0x06, 0xF9, 0x07, 0xFB, 0x05, 0x05, 0x06, 0xFD, 0x06, 0xFD, 0x02, 0x05, 0xFD, 0xFB, 0xFD,
+0x05, 0xFC, 0x05, 0x08, 0x08, 0xF8, 0x06, 0x06, 0xFD, 0x03, 0xFD, 0xFA, 0xFE, 0x00, 0x05, 0xFC,
+0x04, 0x04, 0xFB, 0x09, 0xFD, 0x01, 0x08, 0x06, 0xFF, 0x04, 0xF9, 0x03, 0x03, 0xFF, 0xFB, 0xFA,
+0x03, 0xF6, 0x03, 0x05, 0x03, 0xF9, 0x09, 0x07, 0xFD, 0x03, 0xFB, 0xFC, 0x05, 0xFF, 0x03, 0xFA,
+0x03, 0x09, 0xFB, 0x05, 0xFD, 0x02, 0x06, 0x04, 0xFD, 0x03, 0xFE, 0x04, 0x04, 0xFE, 0xFA, 0xFD,
+0x06, 0xFB, 0x02, 0x04, 0x03, 0xF6, 0x05, 0x08, 0xFE, 0x02, 0xF9, 0xFD, 0x02, 0x00, 0x08, 0xF9,
+0x03, 0x03, 0xF9, 0x07, 0x01, 0x03, 0x04, 0x05, 0xFB, 0x02, 0xF9, 0x00, 0x06, 0xFD, 0xFA, 0xFC,
+0x04, 0xFB, 0x00, 0x02, 0x05, 0xFF, 0x05, 0x03, 0xFE, 0x02, 0xFB, 0xF8, 0x05, 0xFE, 0x04, 0xFA,
+0x08, 0x03, 0xFB, 0x05, 0xFA, 0x09, 0x04, 0x07, 0xFD, 0x03, 0xF9, 0x00, 0x0E, 0xFB, 0xFE, 0xF4,
+0x02, 0xFD, 0x03, 0x03, 0x04, 0xF9, 0x05, 0x04, 0xF8, 0x03, 0xF7, 0xFD, 0xFF, 0xFD, 0x04, 0xFF,
+0x00, 0x02, 0xFA, 0x05, 0xFB, 0x08, 0x02, 0x04, 0x02, 0xFF, 0xF8, 0x03, 0x05, 0xFE, 0xFA, 0xF9,
+0x03, 0xF8, 0x05, 0x03, 0x04, 0xF9, 0x0B, 0x04, 0xFC, 0x03, 0xFA, 0xF8, 0x0C, 0xFF, 0x05, 0xFA,
+0x05, 0x09, 0xFD, 0x03, 0x01, 0x04, 0x04, 0x09, 0x02, 0xFA, 0xFB, 0x00, 0x04, 0x02, 0xF7, 0x00,
+0x01, 0xFB, 0x09, 0x02, 0x0A, 0xFE, 0x09, 0x03, 0xFC, 0x00, 0xF5, 0xF9, 0x07, 0xFE, 0x0B, 0xF7,
+0x01, 0x04, 0xFE, 0x03, 0xFB, 0x07, 0x0A, 0x03, 0xFB, 0x03, 0xFC, 0x04, 0x04, 0x02, 0xFC, 0xF8,
+0x02, 0xFC, 0x09, 0x05, 0x08, 0xF7, 0x04, 0x0A, 0xF8, 0x03, 0xFD, 0xFB, 0x02, 0xFD, 0x08, 0xFC,
+0x03, 0x08, 0xFB, 0x07, 0xFC, 0x04, 0x04, 0x07, 0xFA, 0x02, 0xFD, 0x06, 0x09, 0xFA, 0xF7, 0xFE,
+0x04, 0xFE, 0x07, 0x02, 0x07, 0xF5, 0x02, 0x02, 0xFD, 0x04, 0xFE, 0xFB, 0x03, 0xFE, 0x03, 0xF9,
+0x02, 0x07, 0xFE, 0x0B, 0xFE, 0x04, 0x03, 0x04, 0xFD, 0x03, 0xFC, 0x04, 0x05, 0x01, 0xFE, 0xFC,
+0x05, 0xFC, 0x02, 0x03, 0x0B, 0xFE, 0x05, 0x08, 0xFB, 0x04, 0xFA, 0xFC, 0x06, 0x01, 0x04, 0xF5,
+0x05, 0x04, 0xFD, 0x05, 0xFA, 0x05, 0x09, 0x04, 0xFF, 0x03, 0xFC, 0x02, 0x06, 0x01, 0xFE, 0xFB,
+0x06, 0xF8, 0x03, 0x04, 0x04, 0xF5, 0x01, 0x08, 0xFF, 0x03, 0xFA, 0xFB, 0x09, 0xFE, 0x05, 0xF8,
+0x05, 0x06, 0xF8, 0x05, 0x00, 0x09, 0x03, 0x08, 0xFC, 0x04, 0xFD, 0x04, 0x05, 0xFC, 0xFE, 0xFD,
+0x06, 0xF6, 0x05, 0x05, 0x07, 0xF6, 0x03, 0x02, 0xFB, 0x03, 0xFC, 0xFB, 0x01, 0xFE, 0x04, 0xFB,
+0x08, 0x06, 0xF9, 0xFF, 0xFA, 0x09, 0x01, 0x09, 0xFE, 0x03, 0x02, 0x04, 0xFE, 0x01, 0xFD, 0xF7,
+0x00, 0xFE, 0x00, 0x07, 0x0A, 0xF9, 0x06, 0x01, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x04, 0x06, 0xF6,
+0x01, 0x03, 0xFC, 0x02, 0xFD, 0x08, 0x06, 0x04, 0xFD, 0x04, 0xFC, 0xFF, 0x01, 0xFF, 0xFC, 0xFC,
+0x06, 0xFA, 0x03, 0x06, 0x03, 0xF6, 0x01, 0x09, 0xFC, 0x00, 0xFB, 0xFB, 0x05, 0xFE, 0x05, 0xF9,
+0x02, 0x06, 0xFB, 0x03, 0xF9, 0x09, 0x07, 0x09, 0xFE, 0x05, 0x02, 0xFD, 0x03, 0x00, 0xF8, 0xFA,
+0x00, 0xFA, 0x02, 0x00, 0x05, 0xF7, 0x05, 0x00, 0x01, 0x04, 0x00, 0xFA, 0x00, 0xFC, 0x05, 0xF8,
+0xFF, 0x00, 0xFC, 0x09, 0xF7, 0x02, 0x0D, 0x00, 0xFB, 0x03, 0xFD, 0x04, 0x07, 0x04, 0xFA, 0xFA,
+0x04, 0xFA, 0x04, 0x05, 0x04, 0xFC, 0x08, 0x04, 0x08, 0x01, 0xFB, 0xFF, 0x00, 0xFB, 0x09, 0xF9,
+0x06, 0xFE, 0xF9, 0x04, 0xFC, 0x0A, 0x06, 0x00, 0xFB, 0x03, 0xFB, 0xFE, 0x04, 0xFD, 0xF8, 0x00,
+0x07, 0xFA, 0x07, 0x04, 0x03, 0xF6, 0x03, 0x08, 0xFD, 0x04, 0xFD, 0xF7, 0x00, 0x04, 0x02, 0xFC,
+0x07, 0x01, 0xFA, 0x03, 0xFC, 0x03, 0x02, 0x05, 0xFB, 0x04, 0xFC, 0x03, 0x07, 0xFE, 0xFB, 0x03,
+0xFE, 0xFD, 0x08, 0x04, 0x05, 0xFF, 0x04, 0x02, 0xF9, 0x00, 0x00, 0xF4, 0x04, 0xFE, 0x03, 0xFB,
+0x05, 0x02, 0xFB, 0x06, 0xFE, 0x05, 0x05, 0x07, 0xFF, 0x04, 0xFF, 0x04, 0x04, 0xFF, 0xFA, 0xFF,
+0x02, 0xFC, 0x05, 0x03, 0x07, 0xFB, 0x08, 0x07, 0xF8, 0x02, 0xFD, 0xFB, 0x02, 0xFD, 0x06, 0xFE,
+0x03, 0x03, 0xFC, 0x01, 0x02, 0x03, 0x03, 0x07, 0xFE, 0x04, 0xFC, 0x05, 0x05, 0xFC, 0xFF, 0xFC,
+0x04, 0xFD, 0x02, 0x04, 0x08, 0xFD, 0x05, 0x07, 0x05, 0xFF, 0x00, 0xF9, 0x09, 0x02, 0x0A, 0xF8,
+0xFD, 0x02, 0xFE, 0x0B, 0xFE, 0x0B, 0x08, 0x06, 0xFD, 0xFA, 0xFF, 0xFE, 0x09, 0xFC, 0xFC, 0xF7,
+0x01, 0xFC, 0x01, 0x04, 0x04, 0xFC, 0xFF, 0x02, 0xF9, 0x03, 0xFF, 0xF6, 0x06, 0x01, 0x08, 0xFF,
+0xFE, 0x06, 0xF4, 0x00, 0xFC, 0x08, 0x06, 0x04, 0xF5, 0x01, 0xFB, 0x01, 0x08, 0x02, 0xF5, 0xF6,
+0x04, 0x01, 0x06, 0x06, 0x03, 0xFE, 0x02, 0x00, 0x01, 0x03, 0xF3, 0xF9, 0x07, 0xFE, 0x0C, 0xFC,
+0x03, 0x05, 0xFC, 0x01, 0xFD, 0x06, 0x04, 0x05, 0xFC, 0x01, 0xFC, 0x03, 0x03, 0xFE, 0xFB, 0xF9,
+0x03, 0xFD, 0x05, 0x06, 0x05, 0xFC, 0x08, 0x08, 0xFD, 0x01, 0xFC, 0xFA, 0x06, 0xFE, 0x02, 0xFB,
+0x04, 0x03, 0xFD, 0x04, 0xFE, 0x04, 0x03, 0x06, 0xFE, 0x03, 0xFB, 0x05, 0x03, 0xFC, 0xFE, 0xFB,
+0x02, 0xFB, 0x05, 0x03, 0x04, 0xF9, 0x09, 0x07, 0xFD, 0x01, 0xFD, 0xFB, 0x04, 0xFD, 0x08, 0xFD,
+0x04, 0x04, 0xF8, 0x03, 0xFC, 0x04, 0x05, 0x04, 0xFE, 0x03, 0xFB, 0x04, 0x04, 0xFD, 0xFB, 0xFC,
+0x03, 0xFB, 0x07, 0x03, 0x02, 0xF9, 0x04, 0x07, 0xFD, 0x03, 0xFD, 0xFA, 0x05, 0xFE, 0x02, 0xFC,
+0x00, 0x08, 0xF6, 0x02, 0xFF, 0x0A, 0x0B, 0x0A, 0xF7, 0x03, 0xF5, 0x02, 0x00, 0x01, 0xF6, 0xFC,
+0x05, 0xFB, 0x06, 0xFD, 0x03, 0xFB, 0xFF, 0x05, 0xFF, 0x01, 0x01, 0xFC, 0xFD, 0xFD, 0x02, 0x00,
+0x00, 0x05, 0xFB, 0x0C, 0xFE, 0x01, 0x04, 0x09, 0xFA, 0x07, 0x01, 0x05, 0x05, 0x00, 0xFC, 0xFF,
+0x02, 0xFA, 0x00, 0x06, 0xFF, 0xF9, 0x04, 0x05, 0x01, 0xFC, 0xFB, 0xF6, 0x08, 0xFB, 0x0B, 0xFA,
+0x04, 0x02, 0xF6, 0x01, 0x07, 0x02, 0x0A, 0x08, 0x02, 0xFD, 0xFC, 0x06, 0x08, 0x01, 0xFF, 0xFF,
+0x04, 0xF7, 0x07, 0x01, 0x09, 0xFF, 0x0B, 0x04, 0xFF, 0x01, 0xFB, 0xFF, 0xFF, 0xFD, 0x08, 0x02,
+0x0A, 0x09, 0x00, 0x04, 0xF8, 0x06, 0x03, 0x01, 0xFC, 0x05, 0xFF, 0x05, 0x08, 0xFD, 0xFC, 0xFB,
+0x06, 0xFE, 0x06, 0x02, 0x06, 0xFE, 0x09, 0x03, 0x01, 0x02, 0xF9, 0xFE, 0x07, 0xFE, 0x04, 0xFC,
+0x06, 0x06, 0xFA, 0x09, 0xFE, 0x03, 0x09, 0x07, 0xFC, 0x00, 0xFD, 0x02, 0x06, 0xFD, 0xFA, 0xFC,
+0x05, 0xFA, 0x04, 0x04, 0x04, 0xFB, 0x02, 0x01, 0xF9, 0x03, 0xFA, 0xFC, 0x06, 0x00, 0x08, 0xFF,
+0x06, 0x05, 0xFB, 0x06, 0xFB, 0x05, 0x06, 0x05, 0xFB, 0x03, 0xFA, 0x04, 0x04, 0xFC, 0xFC, 0xFB,
+0x05, 0xFD, 0x04, 0x05, 0x04, 0xFA, 0x05, 0x04, 0xFC, 0x02, 0xFB, 0xFB, 0x05, 0xFF, 0x04, 0xFC,
+0x04, 0x04, 0xFE, 0x05, 0xFC, 0x04, 0x05, 0x04, 0xFA, 0x06, 0xFD, 0x06, 0x05, 0xFA, 0xFB, 0xFC,
+0x07, 0xFC, 0x05, 0x04, 0x02, 0xFD, 0x05, 0x03, 0xFB, 0xF6, 0xFB, 0xFD, 0x08, 0xFB, 0x04, 0xFF,
+0x04, 0x04, 0xFC, 0x05, 0xFB, 0x05, 0x02, 0x05, 0xF9, 0x04, 0xFB, 0x06, 0x06, 0xF8, 0xFA, 0xFC,
+0x04, 0xFC, 0x07, 0x07, 0x05, 0xFE, 0x06, 0x04, 0xFB, 0x02, 0xFC, 0xFB, 0x06, 0xFE, 0x04, 0xFD,
+0x05, 0x05, 0xFB, 0x06, 0xFC, 0x05, 0x05, 0x06, 0xFC, 0x04, 0xFB, 0x06, 0x05, 0xFC, 0xFA, 0xFB,
+0x04, 0xFB, 0x04, 0x05, 0x07, 0xFC, 0x04, 0x05, 0xFC, 0x02, 0xFC, 0xFC, 0x05, 0xFF, 0x05, 0xFE,
+0x06, 0x03, 0xF6, 0x03, 0xFF, 0x03, 0x05, 0x04, 0x00, 0x01, 0xFF, 0x05, 0x08, 0xFB, 0xFF, 0xFC,
+0x04, 0xF6, 0x06, 0x06, 0x05, 0xFC, 0x04, 0x07, 0xFF, 0x03, 0xF9, 0xFA, 0x04, 0xFE, 0x0A, 0xFD,
+0x05, 0x05, 0xFE, 0x04, 0xFE, 0x04, 0x02, 0x07, 0xF7, 0x07, 0xF9, 0x02, 0x02, 0xF7, 0xFB, 0xFD,
+0x05, 0xFD, 0x05, 0x02, 0x04, 0x01, 0x02, 0x06, 0xFC, 0x00, 0xFA, 0xFB, 0x03, 0xFA, 0x08, 0xFC,
+0x02, 0x03, 0xF7, 0x00, 0xFE, 0x05, 0x06, 0x0C, 0xFA, 0x04, 0xF9, 0xFD, 0x04, 0x00, 0xFC, 0xF7,
+0xFF, 0xFC, 0x07, 0x02, 0x0C, 0xFE, 0x0A, 0x09, 0xFE, 0x02, 0xFD, 0xFD, 0x02, 0xFD, 0x03, 0xFD,
+0x04, 0x06, 0xFA, 0x05, 0xFD, 0x05, 0x0C, 0x06, 0xFE, 0x04, 0xFE, 0x03, 0x04, 0xFB, 0xFD, 0xFD,
+0x04, 0xFC, 0x03, 0x04, 0x05, 0xFC, 0x04, 0x04, 0xFD, 0xF7, 0xFC, 0xFE, 0x07, 0xFE, 0x05, 0xFC,
+0x05, 0x05, 0xFC, 0x06, 0xFB, 0x05, 0x06, 0x02, 0xFC, 0x06, 0xFC, 0x05, 0x04, 0xFB, 0xF9, 0xFD,
+0x04, 0xFB, 0x04, 0x06, 0x04, 0xFC, 0x03, 0x06, 0xFC, 0x02, 0xFB, 0xFC, 0x06, 0xFF, 0x04, 0xFD,
+0x04, 0x05, 0xFC, 0x04, 0xFD, 0x05, 0x05, 0x04, 0xFC, 0x06, 0xFB, 0x06, 0x06, 0xFC, 0xFA, 0xFC,
+0x05, 0xFD, 0x05, 0x05, 0x06, 0xFB, 0x06, 0x05, 0xFA, 0x01, 0xFC, 0xFC, 0x07, 0xFE, 0x05, 0xFE,
+0x05, 0x05, 0xF9, 0x05, 0xFB, 0x06, 0x06, 0x06, 0xFB, 0x05, 0xFB, 0x04, 0x05, 0xFB, 0xFB, 0xFB,
+0x04, 0xFC, 0x04, 0x04, 0x05, 0xFA, 0x05, 0x06, 0xFB, 0x02, 0xFD, 0xFC, 0x05, 0x00, 0x05, 0xFC,
+0x04, 0x02, 0xFC, 0x04, 0xFA, 0x05, 0x03, 0x06, 0xFA, 0x04, 0xFF, 0x04, 0x05, 0xFC, 0xFB, 0xFB,
+0x07, 0xFB, 0x05, 0x05, 0x05, 0xFB, 0x06, 0x07, 0xFB, 0x02, 0xFB, 0xFC, 0x06, 0x00, 0x06, 0xFE,
+0xFF, 0x02, 0xFE, 0x07, 0xFA, 0x08, 0x08, 0x07, 0xFC, 0x01, 0xFB, 0x02, 0x00, 0xF7, 0xF6, 0xFA,
+0x08, 0xF9, 0xFF, 0x05, 0x06, 0xFA, 0x00, 0x04, 0x00, 0xFD, 0xF7, 0x02, 0x05, 0xFB, 0x04, 0xFD,
+0x06, 0x08, 0x00, 0x03, 0x00, 0x08, 0x07, 0x05, 0x00, 0x02, 0xFD, 0x06, 0x03, 0xFF, 0xFD, 0xFD,
+0x04, 0xFF, 0x08, 0x00, 0x0B, 0xFA, 0x06, 0x07, 0xFC, 0x03, 0xFF, 0xF6, 0x03, 0xFD, 0x05, 0xFD,
+0x05, 0x05, 0xF9, 0x0A, 0xFC, 0x02, 0x07, 0x00, 0xF8, 0xFD, 0xFD, 0x01, 0x07, 0x01, 0x01, 0xF7,
+0x00, 0xF7, 0xFE, 0x02, 0x00, 0xFD, 0x00, 0x0B, 0xF8, 0x03, 0xFF, 0xFD, 0x04, 0x00, 0x0A, 0xFB,
+0x03, 0x07, 0xFB, 0x05, 0xFB, 0x05, 0x03, 0x01, 0xFC, 0x06, 0xFB, 0x05, 0x07, 0xFE, 0xF8, 0xFC,
+0x04, 0xFD, 0x05, 0x03, 0x03, 0xFE, 0x07, 0x07, 0xFB, 0x02, 0xFB, 0xFB, 0x06, 0xFF, 0x05, 0xFE,
+0x06, 0x05, 0xFA, 0x05, 0xFA, 0x05, 0x06, 0x03, 0xFC, 0x04, 0xFC, 0x07, 0x05, 0xFC, 0xFC, 0xFD,
+0x05, 0xFE, 0x05, 0x02, 0x06, 0xF9, 0x00, 0x06, 0xF9, 0x03, 0xFB, 0xFC, 0x07, 0xFF, 0x07, 0xFE,
+0x05, 0x05, 0xFE, 0x04, 0xFD, 0x06, 0x05, 0x04, 0xFC, 0x05, 0xFC, 0x06, 0x05, 0xFB, 0xFA, 0xFB,
+0x06, 0xFD, 0x05, 0x05, 0x06, 0xFC, 0x06, 0x07, 0xFC, 0xFD, 0xFC, 0xFD, 0x05, 0xFD, 0x04, 0xFC,
+0x05, 0x04, 0xF9, 0x04, 0xFA, 0x04, 0x05, 0x06, 0xFB, 0x05, 0xFB, 0x03, 0x05, 0xFB, 0xFC, 0xFB,
+0x04, 0xFB, 0x05, 0x05, 0x05, 0xFA, 0x06, 0x04, 0xFA, 0x02, 0xFB, 0xFB, 0x05, 0x00, 0x05, 0xFD,
+0x04, 0x06, 0xFC, 0x04, 0xFB, 0x06, 0x04, 0x05, 0xFD, 0x05, 0xFB, 0x04, 0x05, 0xFC, 0xF8, 0xFB,
+0x03, 0xFA, 0x05, 0x05, 0x04, 0xF9, 0x06, 0x05, 0xFB, 0x03, 0xFC, 0xFB, 0x05, 0xFF, 0x05, 0xFD,
+0x03, 0x05, 0xF6, 0x02, 0xF8, 0x05, 0x04, 0x02, 0xFD, 0x06, 0xFF, 0x05, 0x02, 0xFC, 0xFA, 0xFE,
+0x04, 0xFC, 0x05, 0x06, 0x05, 0xFD, 0x05, 0x08, 0xFD, 0x01, 0xFB, 0xFE, 0x07, 0xFC, 0x03, 0xFB,
+0x06, 0x08, 0xF5, 0x02, 0xF7, 0x02, 0x03, 0x07, 0x02, 0x04, 0xFE, 0x04, 0x02, 0xFF, 0xFD, 0xFD,
+0x03, 0xFC, 0x01, 0x02, 0x04, 0xFB, 0x0A, 0x06, 0xFE, 0x00, 0x00, 0xF6, 0x02, 0xFB, 0x02, 0x02,
+0x05, 0x0A, 0xFF, 0x00, 0x00, 0x04, 0x07, 0x09, 0xF9, 0x04, 0xFA, 0x07, 0x07, 0x02, 0xFD, 0xFD,
+0x05, 0xFB, 0x05, 0x04, 0x00, 0xF9, 0x06, 0x07, 0x04, 0x04, 0x00, 0xF8, 0x02, 0xFD, 0x05, 0xFC,
+0x02, 0x07, 0xFE, 0x08, 0xFD, 0x07, 0x04, 0x08, 0xFE, 0x02, 0xFB, 0x03, 0x04, 0x02, 0xF8, 0xFC,
+0x05, 0xF8, 0x02, 0x04, 0x09, 0xF8, 0x04, 0x06, 0xFA, 0x01, 0x01, 0xFC, 0x04, 0xFE, 0x08, 0xFC,
+0x08, 0x02, 0xFC, 0x02, 0xFD, 0x05, 0x06, 0x05, 0xFB, 0x04, 0xFF, 0x04, 0x03, 0xFC, 0xF7, 0xFE,
+0x03, 0xFD, 0x05, 0x08, 0x06, 0xFF, 0x09, 0x02, 0xFF, 0x02, 0xFA, 0xFE, 0x07, 0xFF, 0x08, 0xFB,
+0x04, 0x06, 0xFA, 0x03, 0xFE, 0x05, 0x05, 0x07, 0xF9, 0x04, 0xFC, 0x05, 0x05, 0xFC, 0xFE, 0xFA,
+0x06, 0xFA, 0x07, 0x05, 0x05, 0xF8, 0x01, 0x05, 0xF9, 0x02, 0xFC, 0xFB, 0x08, 0xFE, 0x04, 0xFF,
+0x04, 0x05, 0xF9, 0x08, 0xFB, 0x04, 0x05, 0x08, 0xFD, 0x02, 0xFB, 0x07, 0x05, 0xFF, 0xFB, 0xFD,
+0x03, 0xF9, 0x06, 0x04, 0x03, 0xFC, 0x01, 0x07, 0xF8, 0xFF, 0xFE, 0xFB, 0x08, 0xFE, 0x05, 0xFC,
+0x04, 0x05, 0xFE, 0x06, 0xFC, 0x02, 0x06, 0x03, 0xFD, 0x04, 0xFD, 0x02, 0x03, 0xFC, 0xFC, 0xFB,
+0x05, 0xF8, 0x05, 0x05, 0x02, 0xFB, 0x07, 0x06, 0xFA, 0x02, 0xFB, 0xFD, 0x05, 0xFF, 0x04, 0xFD,
+0x04, 0x07, 0xF8, 0x06, 0x01, 0x03, 0x03, 0x03, 0xF7, 0x06, 0xFF, 0x02, 0x02, 0xFF, 0xFE, 0xFC,
+0x03, 0xFA, 0x05, 0x04, 0x04, 0xFB, 0x09, 0x04, 0xF9, 0x02, 0xF9, 0xFA, 0x01, 0xFD, 0x09, 0xFA,
+0x09, 0x05, 0xF9, 0x03, 0x00, 0x04, 0x00, 0x03, 0xFF, 0x04, 0xFE, 0x07, 0x06, 0xFF, 0xFF, 0xF5,
+0x00, 0xF7, 0x05, 0x04, 0x07, 0xFD, 0x02, 0x00, 0xF7, 0x06, 0xFE, 0xFD, 0x08, 0xFD, 0x0B, 0x01,
+0x06, 0x07, 0xFA, 0x07, 0xFE, 0x04, 0x04, 0x06, 0xF8, 0x02, 0xF7, 0xFB, 0x09, 0xFD, 0xFB, 0xFB,
+0x02, 0xF8, 0xFF, 0xFD, 0x09, 0xFB, 0x06, 0x00, 0xFC, 0x02, 0xFB, 0x00, 0x01, 0x03, 0x04, 0xF9,
+0x08, 0x04, 0xF9, 0x05, 0xFC, 0x04, 0xFF, 0x03, 0xFD, 0x04, 0xFF, 0x04, 0x08, 0xFE, 0xFD, 0xFA,
+0x04, 0xFA, 0x09, 0x05, 0x0A, 0xF9, 0x01, 0x07, 0x00, 0xFF, 0xF9, 0xFD, 0x0D, 0xFE, 0x00, 0xFE,
+0x06, 0x06, 0xFF, 0x04, 0xFE, 0x07, 0x08, 0x08, 0xFC, 0x02, 0xFB, 0x04, 0x07, 0xFF, 0xFA, 0xFF,
+0x07, 0xFC, 0x07, 0x04, 0x05, 0xF8, 0x00, 0x09, 0xFF, 0x02, 0xFD, 0xF9, 0x07, 0xFE, 0x05, 0xFC,
+0x04, 0x03, 0xFD, 0x00, 0xFC, 0x04, 0x0A, 0x09, 0xFE, 0x04, 0xFC, 0x09, 0x01, 0xF7, 0xFB, 0xFA,
+0x09, 0xF8, 0x06, 0x05, 0x03, 0x01, 0x01, 0x06, 0x00, 0xFF, 0xFD, 0xFD, 0x02, 0x01, 0x05, 0xF6,
+0x02, 0x09, 0xFA, 0x05, 0xFE, 0x05, 0x04, 0x04, 0xF9, 0x04, 0xF6, 0x06, 0x03, 0xFE, 0xFF, 0xFA,
+0x07, 0xF7, 0x02, 0x01, 0x03, 0xFB, 0x0A, 0x05, 0xFC, 0x03, 0xFC, 0xFF, 0x02, 0xFE, 0x05, 0xFC,
+0x05, 0x08, 0xFE, 0x05, 0xFF, 0x05, 0xFF, 0x0A, 0xFB, 0x01, 0xF4, 0x05, 0x08, 0x04, 0xF6, 0xFA,
+0x04, 0xFF, 0x04, 0x06, 0x02, 0xFF, 0x07, 0x05, 0xFB, 0x01, 0xF8, 0xFA, 0x03, 0xFC, 0x06, 0xFE,
+0x05, 0x09, 0xFC, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0xF7, 0x01, 0xFC, 0x08, 0x02, 0x01, 0xF7, 0xF7,
+0xFE, 0xFD, 0x05, 0x09, 0x01, 0xF8, 0x03, 0x0A, 0xFF, 0xFC, 0xF5, 0xFE, 0x0B, 0xF7, 0x02, 0xFE,
+0x05, 0x04, 0xF8, 0x08, 0xF8, 0x08, 0xFF, 0x09, 0x03, 0xFF, 0x00, 0x04, 0x07, 0x03, 0x00, 0x02,
+0x04, 0xFA, 0x08, 0x0B, 0x0B, 0xFD, 0x09, 0x03, 0x04, 0x02, 0xFC, 0x00, 0x0B, 0x01, 0x0A, 0xFC,
+0x08, 0x0B, 0xFD, 0x05, 0xFE, 0x04, 0x01, 0x01, 0x02, 0x00, 0xF6, 0x04, 0x0B, 0xFC, 0xF7, 0x02,
+0x03, 0xFF, 0x05, 0x08, 0x06, 0xF9, 0x02, 0x07, 0xFF, 0x04, 0x00, 0xFA, 0x02, 0xFD, 0x07, 0x01,
+0x07, 0x07, 0x00, 0x08, 0xFF, 0x0B, 0x08, 0x03, 0xFF, 0x01, 0x01, 0x00, 0x04, 0xFB, 0xF9, 0xFB,
+0x07, 0xFC, 0x00, 0x08, 0x06, 0xFB, 0x03, 0x05, 0xFA, 0x00, 0x01, 0xFB, 0x08, 0xFF, 0x05, 0xFE,
+0x04, 0x07, 0xFB, 0x01, 0x00, 0x08, 0x03, 0x02, 0xFF, 0x00, 0xFB, 0x02, 0x06, 0x03, 0xFA, 0xFF,
+0x09, 0xF8, 0x02, 0x02, 0x0C, 0xFE, 0x09, 0x02, 0xFD, 0x01, 0xF7, 0xF6, 0xFF, 0xFB, 0x0A, 0x00,
+0x01, 0x08, 0xF8, 0x03, 0xF8, 0xFF, 0x0B, 0x09, 0x04, 0xFC, 0x01, 0x03, 0x0B, 0x02, 0xF9, 0x00,
+0x04, 0xF4, 0x07, 0xFF, 0x01, 0xF9, 0x03, 0x06, 0x01, 0x02, 0xFF, 0xF8, 0x01, 0xFE, 0x0A, 0xFD,
+0xFF, 0x07, 0xFE, 0x04, 0xF8, 0x0A, 0x05, 0x0A, 0xF7, 0xF9, 0xFE, 0x01, 0x07, 0x03, 0xF8, 0xF8,
+0x02, 0x00, 0x03, 0xFE, 0x07, 0xF8, 0xFF, 0x03, 0x01, 0x05, 0xFC, 0xF6, 0x07, 0xFC, 0x01, 0xF6,
+0xFF, 0x02, 0xFE, 0x05, 0xF8, 0x09, 0x07, 0x0C, 0x03, 0x05, 0xF8, 0x00, 0x07, 0x00, 0x00, 0xFA,
+0x01, 0xFA, 0x05, 0x06, 0x07, 0xFE, 0x04, 0x0C, 0x04, 0x03, 0xFB, 0xFA, 0xFE, 0x00, 0x04, 0xF8,
+0x04, 0x01, 0xFE, 0x04, 0xF8, 0x01, 0x01, 0x0A, 0xFC, 0x01, 0xF6, 0x00, 0x03, 0xFE, 0xF7, 0xFA,
+0x05, 0xFD, 0x0B, 0x01, 0x02, 0x01, 0xFF, 0x0B, 0xF8, 0x01, 0xF5, 0xF7, 0x01, 0xFF, 0x07, 0x01,
+0x04, 0x05, 0x00, 0x07, 0xFE, 0x03, 0x05, 0x03, 0xFC, 0x07, 0xFC, 0x02, 0x04, 0x08, 0xFA, 0x00,
+0x05, 0xFC, 0x07, 0x06, 0x04, 0xFA, 0x0A, 0x08, 0x00, 0x05, 0xFD, 0xF8, 0x06, 0xFE, 0x05, 0xFA,
+0x07, 0x07, 0xF9, 0x07, 0xF9, 0x08, 0x08, 0x07, 0xF9, 0x07, 0xF8, 0x06, 0x08, 0xFB, 0xF8, 0xF9,
+0x06, 0xF9, 0x07, 0x08, 0x07, 0xF8, 0x06, 0x08, 0xF9, 0x05, 0xFA, 0xFA, 0x08, 0xFE, 0x07, 0xFA,
+0x07, 0x07, 0xFA, 0x07, 0xF8, 0x07, 0x08, 0x08, 0xFA, 0x06, 0xF8, 0x06, 0x07, 0xFA, 0xF8, 0xF9,
+0x08, 0xF9, 0x06, 0x08, 0x07, 0xF9, 0x07, 0x08, 0xF9, 0x06, 0xFA, 0xFA, 0x09, 0xFF, 0x08, 0xFA,
+0x06, 0x08, 0xF9, 0x08, 0xF9, 0x07, 0x08, 0x07, 0xFA, 0x08, 0xF8, 0x06, 0x08, 0xFB, 0xF9, 0xF9,
+0x07, 0xF8, 0x07, 0x08, 0x06, 0xFA, 0x07, 0x08, 0xFA, 0x06, 0xFA, 0xFA, 0x07, 0xFF, 0x08, 0xFC,
+0x07, 0x06, 0xF9, 0x08, 0xF9, 0x06, 0x07, 0x07, 0xFA, 0x07, 0xF8, 0x06, 0x08, 0xFB, 0xF9, 0xF9,
+0x07, 0xF9, 0x08, 0x07, 0x08, 0xF9, 0x07, 0x08, 0xFA, 0x07, 0xFA, 0xF9, 0x08, 0xFF, 0x08, 0xFB,
+0x06, 0x07, 0xF9, 0x07, 0xFA, 0x06, 0x09, 0x07, 0xFB, 0x07, 0xF8, 0x06, 0x07, 0xFB, 0xF9, 0xF9,
+0x06, 0xF8, 0x08, 0x09, 0x08, 0xF9, 0x08, 0x07, 0xFA, 0x06, 0xFA, 0xFA, 0x08, 0xFF, 0x07, 0xFA,
+0x07, 0x07, 0xF9, 0x09, 0xF9, 0x07, 0x08, 0x07, 0xFA, 0x07, 0xF9, 0x06, 0x07, 0xFA, 0xFA, 0xF8,
+0x07, 0xFA, 0x07, 0x07, 0x08, 0xFC, 0x06, 0x06, 0xFA, 0x06, 0xFA, 0xF9, 0x09, 0xFF, 0x08, 0xF9,
+0x07, 0x08, 0xF8, 0x08, 0xF9, 0x08, 0x09, 0x07, 0xFA, 0x07, 0xF8, 0x06, 0x07, 0xFA, 0xF9, 0xF9,
+0x06, 0xF8, 0x07, 0x07, 0x06, 0xFA, 0x08, 0x08, 0xF8, 0x06, 0xFA, 0xFA, 0x07, 0xFF, 0x08, 0xFA,
+0x08, 0x07, 0xF9, 0x08, 0xF9, 0x08, 0x09, 0x08, 0xFA, 0x07, 0xF7, 0x07, 0x08, 0xFA, 0xF9, 0xF9,
+0x06, 0xF9, 0x07, 0x08, 0x08, 0xFA, 0x06, 0x06, 0xF9, 0x05, 0xFA, 0xFA, 0x08, 0xFE, 0x09, 0xFC,
+0x07, 0x07, 0xF9, 0x07, 0xF9, 0x08, 0x0A, 0x08, 0xFB, 0x06, 0xFA, 0x04, 0x06, 0xF9, 0xFA, 0xF8,
+0x05, 0xFA, 0x07, 0x07, 0x08, 0xF7, 0x04, 0x07, 0xF8, 0x05, 0xFB, 0xFB, 0x06, 0xFE, 0x07, 0xFB,
+0x06, 0x0A, 0xF6, 0x06, 0xFA, 0x07, 0x0A, 0x06, 0xFB, 0x06, 0xF8, 0x04, 0x06, 0xFD, 0xF6, 0xF9,
+0x04, 0xF9, 0x06, 0x05, 0x07, 0xF6, 0x09, 0x08, 0xFA, 0x06, 0xF7, 0xF9, 0x03, 0xFF, 0x07, 0xF8,
+0x07, 0x08, 0xF7, 0x07, 0xF8, 0x07, 0x08, 0x07, 0xFB, 0x06, 0xF8, 0x06, 0x06, 0xFB, 0xF9, 0xFA,
+0x05, 0xFA, 0x07, 0x0A, 0x06, 0xF8, 0x0C, 0x07, 0xFB, 0x06, 0xF9, 0xF9, 0x09, 0xFF, 0x07, 0xFB,
+0x06, 0x07, 0xF9, 0x06, 0xF9, 0x08, 0x08, 0x09, 0xFC, 0x06, 0xF7, 0x05, 0x07, 0xFC, 0xF9, 0xF7,
+0x05, 0xF9, 0x05, 0x07, 0x07, 0xF5, 0x0B, 0x07, 0xF9, 0x06, 0xFB, 0xF9, 0x08, 0xFE, 0x07, 0xFB,
+0x07, 0x07, 0xF7, 0x09, 0xFB, 0x07, 0x08, 0x09, 0xFB, 0x05, 0xFA, 0x04, 0x07, 0xFB, 0xF7, 0xF9,
+0x04, 0xF7, 0x07, 0x08, 0x09, 0xFB, 0x07, 0x08, 0xFA, 0x06, 0xFB, 0xFB, 0x04, 0xFF, 0x07, 0xF5,
+0x05, 0x06, 0xF7, 0x09, 0xF9, 0x05, 0x0B, 0x07, 0xFB, 0x05, 0xF6, 0x05, 0x07, 0xFC, 0xFA, 0xF8,
+0x06, 0xF7, 0x05, 0x08, 0x07, 0xFA, 0x07, 0x06, 0xF9, 0x06, 0xF7, 0xFB, 0x07, 0xFE, 0x08, 0xF9,
+0x04, 0x07, 0xF9, 0x06, 0xFA, 0x08, 0x06, 0x0E, 0xFE, 0x00, 0xF9, 0x03, 0x08, 0xFD, 0xF3, 0xF5,
+0x04, 0xF8, 0x07, 0x05, 0x0B, 0xF6, 0x0A, 0x08, 0xFB, 0x06, 0xFA, 0xF9, 0x05, 0xFF, 0x08, 0xF8,
+0x06, 0x06, 0xF6, 0x06, 0xF8, 0x07, 0x08, 0x09, 0xFA, 0x05, 0xF7, 0x06, 0x07, 0xFA, 0xFB, 0xF9,
+0x05, 0xF9, 0x05, 0x06, 0x08, 0xFB, 0x08, 0x0A, 0xFA, 0x06, 0xFA, 0xFA, 0x06, 0xFF, 0x07, 0xFA,
+0x07, 0x08, 0xF8, 0x07, 0xF9, 0x08, 0x08, 0x09, 0xFB, 0x07, 0xF9, 0x05, 0x07, 0xFB, 0xF8, 0xF7,
+0x05, 0xFA, 0x06, 0x08, 0x0A, 0xF9, 0x06, 0x07, 0xFA, 0x05, 0xF9, 0xF9, 0x0A, 0xFE, 0x08, 0xFA,
+0x07, 0x09, 0xFA, 0x07, 0xF9, 0x07, 0x07, 0x07, 0xFC, 0x07, 0xF8, 0x06, 0x09, 0xFC, 0xF8, 0xFA,
+0x07, 0xF8, 0x08, 0x07, 0x07, 0xF8, 0x07, 0x09, 0xF9, 0x06, 0xF9, 0xF9, 0x09, 0xFF, 0x09, 0xFB,
+0x06, 0x08, 0xF8, 0x06, 0xFC, 0x06, 0x09, 0x09, 0xFB, 0x04, 0xF6, 0x06, 0x08, 0xFB, 0xF8, 0xFB,
+0x05, 0xF9, 0x05, 0x07, 0x07, 0xF9, 0x08, 0x06, 0xFA, 0xF4, 0xFA, 0xFA, 0x06, 0xFD, 0x07, 0xFB,
+0x07, 0x07, 0xF7, 0x06, 0xFA, 0x06, 0x0C, 0x09, 0xFC, 0x03, 0xF8, 0x04, 0x09, 0xFD, 0xF7, 0xFA,
+0x04, 0xF7, 0x04, 0x09, 0x06, 0xF6, 0x09, 0x09, 0xF8, 0x06, 0xF9, 0xFB, 0x09, 0xFE, 0x09, 0xFA,
+0x08, 0x09, 0xF6, 0x0A, 0xFC, 0x09, 0x0C, 0x0A, 0xFE, 0x02, 0xF7, 0x04, 0x04, 0xFE, 0xFA, 0xF7,
+0x06, 0xF7, 0x05, 0x04, 0x06, 0xF7, 0x06, 0x06, 0xF7, 0x06, 0xFA, 0xFB, 0x0B, 0xFF, 0x0A, 0xF6,
+0x06, 0x06, 0xF6, 0x09, 0xF9, 0x06, 0x0B, 0x0A, 0xFB, 0x05, 0xF8, 0x05, 0x08, 0xFC, 0xF8, 0xF9,
+0x05, 0xF7, 0x06, 0x07, 0x07, 0xF8, 0x08, 0x0A, 0xFA, 0x06, 0xFA, 0xFA, 0x09, 0xFE, 0x08, 0xFA,
+0x06, 0x09, 0xFA, 0x08, 0xF9, 0x0A, 0x08, 0x0B, 0xFB, 0x04, 0xF9, 0x03, 0x08, 0xFE, 0xFA, 0xF4,
+0x06, 0xF9, 0x09, 0x0A, 0x08, 0xF9, 0x0A, 0x0B, 0xFE, 0x06, 0xFA, 0xFB, 0x07, 0xFF, 0x0A, 0xF8,
+0x06, 0x08, 0xF7, 0x0B, 0xFA, 0x07, 0x0B, 0x07, 0xFB, 0x06, 0xF2, 0x04, 0x06, 0xFE, 0xF8, 0xFA,
+0x04, 0xFA, 0x05, 0x07, 0x07, 0xF5, 0x0A, 0x07, 0xFB, 0x06, 0xFB, 0xF9, 0x07, 0xFF, 0x07, 0xFA,
+0x07, 0x05, 0xFA, 0x06, 0xF9, 0x05, 0x05, 0x08, 0xFD, 0x06, 0xF4, 0x05, 0x07, 0xFA, 0xF9, 0xFC,
+0x05, 0xF8, 0x07, 0x07, 0x08, 0xF8, 0x08, 0x07, 0xF7, 0x05, 0xFB, 0xF9, 0x07, 0xFE, 0x08, 0xFC,
+0x05, 0x08, 0xFA, 0x08, 0xFB, 0x06, 0x0A, 0x08, 0xFA, 0x06, 0xF8, 0x06, 0x07, 0xFB, 0xF7, 0xFB,
+0x05, 0xF8, 0x07, 0x07, 0x07, 0xF7, 0x07, 0x09, 0xFA, 0x05, 0xFC, 0xF9, 0x07, 0xFF, 0x08, 0xFD,
+0x07, 0x07, 0xF8, 0x08, 0xF9, 0x06, 0x0C, 0x0A, 0xFB, 0x06, 0xFA, 0x04, 0x06, 0xFC, 0xF9, 0xF8,
+0x05, 0xF9, 0x07, 0x08, 0x09, 0xF6, 0x0A, 0x07, 0xFA, 0x06, 0xF9, 0xF9, 0x06, 0xFE, 0x09, 0xFB,
+0x06, 0x0A, 0xF7, 0x06, 0xFA, 0x08, 0x0A, 0x08, 0xFC, 0x06, 0xF7, 0x07, 0x0A, 0xFB, 0xF8, 0xFA,
+0x06, 0xFA, 0x07, 0x07, 0x08, 0xF7, 0x06, 0x09, 0xF9, 0x06, 0xF9, 0xF9, 0x08, 0xFE, 0x06, 0xFA,
+0x06, 0x06, 0xF6, 0x07, 0xF8, 0x07, 0x07, 0x08, 0xFA, 0x05, 0xF8, 0x05, 0x0A, 0xFA, 0xF8, 0xF7,
+0x07, 0xF9, 0x06, 0x07, 0x09, 0xFB, 0x09, 0x06, 0xFA, 0x05, 0xF7, 0xF9, 0x0A, 0xFD, 0x06, 0xF9,
+0x07, 0x07, 0xF9, 0x07, 0xFA, 0x08, 0x0B, 0x0A, 0xFA, 0x04, 0xFA, 0x04, 0x0B, 0xFD, 0xF3, 0xF6,
+0x06, 0xF8, 0x08, 0x06, 0x08, 0xF6, 0x07, 0x09, 0xFC, 0x06, 0xFE, 0xF9, 0x07, 0xFE, 0x07, 0xFA,
+0x07, 0x06, 0xFB, 0x06, 0xF8, 0x07, 0x08, 0x05, 0xFC, 0x06, 0xF6, 0x05, 0x07, 0xFD, 0xF5, 0xFB,
+0x05, 0xF9, 0x0A, 0x0B, 0x05, 0xF9, 0x07, 0x0B, 0xFA, 0x06, 0xF8, 0xF9, 0x08, 0xFF, 0x06, 0xFC,
+0x08, 0x05, 0xFA, 0x07, 0xFB, 0x07, 0x0A, 0x0C, 0xFA, 0x04, 0xFA, 0x03, 0x04, 0xFA, 0xFD, 0xF9,
+0x05, 0xF5, 0x04, 0x06, 0x07, 0xF9, 0x08, 0x08, 0xF8, 0x06, 0xFA, 0xFB, 0x08, 0xFF, 0x09, 0xFB,
+0x07, 0x06, 0xFB, 0x07, 0xFB, 0x09, 0x07, 0x0B, 0xFB, 0x06, 0xF6, 0x03, 0x07, 0xFC, 0xFB, 0xFB,
+0x06, 0xF6, 0x06, 0x07, 0x07, 0xF3, 0x09, 0x09, 0xFA, 0x05, 0xF9, 0xF9, 0x07, 0xFF, 0x06, 0xF9,
+0x07, 0x06, 0xF8, 0x07, 0xFB, 0x09, 0x0B, 0x09, 0xFE, 0x04, 0xF7, 0x04, 0x07, 0xFD, 0xFB, 0xFA,
+0x05, 0xF9, 0x07, 0x05, 0x08, 0xF8, 0x04, 0x0B, 0xF9, 0x06, 0xFA, 0xFA, 0x05, 0xFE, 0x07, 0xF9,
+0x07, 0x09, 0xF8, 0x05, 0xFA, 0x07, 0x0A, 0x09, 0xFC, 0x06, 0xFA, 0x04, 0x07, 0xFA, 0xFA, 0xF8,
+0x05, 0xF5, 0x07, 0x07, 0x07, 0xF7, 0x05, 0x0C, 0xFC, 0x06, 0xF8, 0xF9, 0x0B, 0xFF, 0x08, 0xF7,
+0x06, 0x09, 0xF8, 0x06, 0xF8, 0x08, 0x08, 0x07, 0xFB, 0x05, 0xF6, 0x08, 0x07, 0xF7, 0xFA, 0xFA,
+0x05, 0xF9, 0x06, 0x07, 0x09, 0xFA, 0x07, 0x08, 0xF9, 0x05, 0xFC, 0xF9, 0x08, 0xFE, 0x08, 0xFB,
+0x04, 0x0C, 0xF6, 0x04, 0xFA, 0x08, 0x06, 0x04, 0xFB, 0x05, 0xFB, 0x06, 0x06, 0xFD, 0xF3, 0xF7,
+0x04, 0xF8, 0x07, 0x02, 0x0A, 0xFB, 0x0B, 0x0D, 0xF9, 0x04, 0xF3, 0xF9, 0x08, 0xFD, 0x07, 0xF9,
+0x08, 0x08, 0xFB, 0x09, 0xF6, 0x09, 0x06, 0x08, 0x00, 0x04, 0xF8, 0x08, 0x08, 0xFC, 0xF6, 0xFA,
+0x03, 0xF9, 0x06, 0x07, 0x08, 0xF7, 0x07, 0x0A, 0xFA, 0x05, 0xFA, 0xFA, 0x0A, 0xFE, 0x0C, 0xF5,
+0x04, 0x09, 0xF5, 0x0C, 0xFC, 0x06, 0x0B, 0x07, 0xFC, 0x04, 0xF7, 0x00, 0x06, 0x03, 0xF8, 0xFC,
+0x03, 0xF5, 0x04, 0x07, 0x07, 0xF8, 0x04, 0x09, 0xF7, 0x06, 0xF9, 0xFC, 0x0B, 0xFE, 0x0C, 0xF9,
+0x06, 0x05, 0xF5, 0x07, 0xF9, 0x09, 0x09, 0x0A, 0xFE, 0x05, 0xF9, 0x06, 0x04, 0xFD, 0xF6, 0xF7,
+0x05, 0xF9, 0x07, 0x06, 0x09, 0xF8, 0x06, 0x06, 0xFB, 0x05, 0xF6, 0xF6, 0x07, 0xFF, 0x06, 0xF9,
+0x06, 0x06, 0xF8, 0x05, 0xFB, 0x07, 0x06, 0x0C, 0xFB, 0x03, 0xF3, 0x02, 0x08, 0xFC, 0xF7, 0xF8,
+0x05, 0xF7, 0x07, 0x0A, 0x0A, 0xFB, 0x04, 0x0A, 0xF8, 0x06, 0xF9, 0xFB, 0x07, 0xFF, 0x07, 0xFA,
+0x04, 0x08, 0xF8, 0x08, 0xFC, 0x07, 0x0A, 0x09, 0xFD, 0x05, 0xF6, 0x02, 0x06, 0x00, 0xF5, 0xF9,
+0x05, 0xF4, 0x09, 0x05, 0x0B, 0xF6, 0x0F, 0x0B, 0xFB, 0x07, 0xFA, 0xFB, 0x06, 0xFF, 0x05, 0xFB,
+0x05, 0x09, 0xF4, 0x0A, 0xFA, 0x06, 0x07, 0x0F, 0xFC, 0x04, 0xF9, 0x01, 0x06, 0xFE, 0xF2, 0xF9,
+0x03, 0xF9, 0x08, 0x04, 0x06, 0xF4, 0x0D, 0x0B, 0xFE, 0x07, 0xF8, 0xFC, 0x08, 0xFF, 0x09, 0xF9,
+0x05, 0x08, 0xF9, 0x08, 0xF9, 0x08, 0x05, 0x08, 0xFB, 0x05, 0xF7, 0x04, 0x08, 0xFD, 0xF8, 0xF9,
+0x07, 0xF9, 0x0A, 0x0A, 0x05, 0xF5, 0x08, 0x06, 0xF9, 0xFD, 0xF7, 0xFD, 0x07, 0xFB, 0x07, 0xFB,
+0x04, 0x06, 0xF6, 0x08, 0xFE, 0x05, 0x06, 0x0A, 0xFC, 0x04, 0xF8, 0x02, 0x05, 0xFB, 0xF9, 0xF6,
+0x08, 0xF6, 0x05, 0x03, 0x09, 0xFA, 0x0F, 0x0B, 0xFC, 0x04, 0xF5, 0xF6, 0x0B, 0xFD, 0x07, 0xF5,
+0x06, 0x09, 0xF8, 0x07, 0xFA, 0x08, 0x09, 0x0C, 0xFC, 0x02, 0xF4, 0x05, 0x06, 0xFD, 0xF4, 0xF7,
+0x07, 0xFC, 0x0A, 0x06, 0x0A, 0xF9, 0x09, 0x04, 0xFD, 0x07, 0xF7, 0xFA, 0x07, 0xFE, 0x08, 0xF8,
+0x02, 0x0A, 0xFA, 0x0A, 0xFC, 0x0A, 0x0D, 0x0B, 0xFE, 0x01, 0xFA, 0x02, 0x0B, 0xFC, 0xF8, 0xFC,
+0x04, 0xFA, 0x09, 0x07, 0x06, 0xF0, 0x08, 0x07, 0xFF, 0x07, 0xFA, 0xF6, 0x09, 0xFE, 0x07, 0xF6,
+0x04, 0x0A, 0xF4, 0x0E, 0xFD, 0x02, 0x09, 0x09, 0x01, 0xFD, 0xF6, 0x04, 0x0A, 0x00, 0xF4, 0xFC,
+0x05, 0xF3, 0x04, 0x07, 0x09, 0xF0, 0x08, 0x05, 0xFD, 0x07, 0xF9, 0xF8, 0x08, 0xFF, 0x08, 0xF8,
+0x07, 0x07, 0xF9, 0x07, 0xF9, 0x06, 0x09, 0x07, 0xF9, 0x06, 0xF8, 0x05, 0x06, 0xFA, 0xF8, 0xF9,
+0x06, 0xF9, 0x07, 0x07, 0x06, 0xF9, 0x07, 0x08, 0xFA, 0x05, 0xF9, 0xFA, 0x07, 0xFE, 0x07, 0xF8,
+0x07, 0x07, 0xF7, 0x08, 0xF8, 0x06, 0x08, 0x07, 0xF9, 0x07, 0xF9, 0x06, 0x07, 0xFA, 0xF9, 0xFA,
+0x07, 0xF8, 0x07, 0x07, 0x07, 0xF9, 0x08, 0x07, 0xF9, 0x05, 0xF9, 0xF9, 0x09, 0xFE, 0x08, 0xFA,
+0x07, 0x08, 0xF9, 0x08, 0xFA, 0x08, 0x08, 0x08, 0xFB, 0x05, 0xF9, 0x06, 0x08, 0xFB, 0xFA, 0xF9,
+0x05, 0xF9, 0x07, 0x07, 0x07, 0xF8, 0x08, 0x09, 0xF9, 0x06, 0xFA, 0xFA, 0x08, 0xFE, 0x08, 0xF9,
+0x08, 0x07, 0xF8, 0x07, 0xFA, 0x09, 0x07, 0x07, 0xFA, 0x08, 0xF9, 0x06, 0x08, 0xFA, 0xF8, 0xF8,
+0x07, 0xF8, 0x07, 0x07, 0x07, 0xF7, 0x06, 0x09, 0xFA, 0x06, 0xFA, 0xF9, 0x06, 0xFE, 0x08, 0xFA,
+0x07, 0x07, 0xF9, 0x08, 0xFA, 0x07, 0x09, 0x08, 0xF9, 0x08, 0xF9, 0x06, 0x08, 0xF9, 0xFA, 0xF8,
+0x06, 0xF9, 0x08, 0x08, 0x07, 0xF9, 0x06, 0x08, 0xF9, 0x04, 0xFA, 0xFA, 0x07, 0xFE, 0x07, 0xFA,
+0x06, 0x06, 0xF9, 0x07, 0xF8, 0x06, 0x09, 0x08, 0xF9, 0x06, 0xFA, 0x07, 0x07, 0xFA, 0xFA, 0xF9,
+0x05, 0xF8, 0x07, 0x07, 0x07, 0xF9, 0x07, 0x07, 0xF9, 0x05, 0xF9, 0xF9, 0x08, 0xFE, 0x08, 0xFA,
+0x06, 0x07, 0xF7, 0x07, 0xF8, 0x07, 0x08, 0x06, 0xFA, 0x07, 0xF9, 0x06, 0x06, 0xFA, 0xF8, 0xF9,
+0x06, 0xFA, 0x07, 0x08, 0x08, 0xF8, 0x07, 0x08, 0xF9, 0x06, 0xF9, 0xF8, 0x09, 0xFE, 0x09, 0xF9,
+0x07, 0x08, 0xF8, 0x06, 0xF9, 0x07, 0x08, 0x06, 0xFA, 0x06, 0xF8, 0x07, 0x08, 0xF9, 0xF9, 0xF8,
+0x05, 0xF9, 0x05, 0x07, 0x07, 0xF9, 0x07, 0x0A, 0xF9, 0x05, 0xF9, 0xF9, 0x08, 0xFE, 0x08, 0xFA,
+0x06, 0x0A, 0xF9, 0x09, 0xFA, 0x07, 0x06, 0x0C, 0xFC, 0x05, 0xF8, 0x05, 0x06, 0xFE, 0xF8, 0xFB,
+0x04, 0xF7, 0x05, 0x06, 0x07, 0xF9, 0x07, 0x0C, 0xFA, 0x06, 0xFD, 0xFB, 0x07, 0xFE, 0x07, 0xF9,
+0x06, 0x08, 0xF7, 0x07, 0xFA, 0x05, 0x05, 0x0B, 0xFC, 0x04, 0xFA, 0x04, 0x06, 0xFC, 0xF8, 0xFB,
+0x03, 0xF6, 0x01, 0x07, 0x05, 0xFB, 0x0C, 0x06, 0xF9, 0x06, 0xF9, 0xF9, 0x06, 0xFE, 0x06, 0xFA,
+0x06, 0x07, 0xFA, 0x07, 0xFB, 0x07, 0x09, 0x08, 0xFC, 0x06, 0xFA, 0x06, 0x08, 0xFC, 0xF9, 0xFA,
+0x03, 0xFA, 0x07, 0x06, 0x08, 0xF6, 0x06, 0x08, 0xFB, 0x07, 0xFA, 0xFC, 0x06, 0xFF, 0x06, 0xFA,
+0x05, 0x06, 0xF7, 0x07, 0xFB, 0x08, 0x06, 0x06, 0xFB, 0x05, 0xF7, 0x06, 0x08, 0xFD, 0xF6, 0xF8,
+0x05, 0xFA, 0x05, 0x06, 0x08, 0xF8, 0x07, 0x0A, 0xFA, 0x06, 0xF9, 0xFC, 0x06, 0xFE, 0x08, 0xFB,
+0x07, 0x06, 0xFA, 0x07, 0xFA, 0x06, 0x09, 0x07, 0xFB, 0x06, 0xF9, 0x05, 0x06, 0xFC, 0xF9, 0xF9,
+0x06, 0xFA, 0x07, 0x05, 0x06, 0xFA, 0x08, 0x0A, 0xFA, 0x03, 0xFB, 0xFA, 0x07, 0xFD, 0x06, 0xF7,
+0x04, 0x07, 0xF4, 0x06, 0xF8, 0x05, 0x0D, 0x05, 0xFD, 0x02, 0xF9, 0x07, 0x07, 0xFE, 0xFB, 0xFC,
+0x06, 0xF7, 0x08, 0x09, 0x0A, 0xFB, 0x06, 0x05, 0xFC, 0x06, 0xFA, 0xF9, 0x05, 0xFE, 0x07, 0xFC,
+0x05, 0x0A, 0xF6, 0x09, 0xFB, 0x06, 0x0A, 0x08, 0xFD, 0x03, 0xF6, 0x04, 0x08, 0xFD, 0xFA, 0xFC,
+0x04, 0xFB, 0x04, 0x07, 0x07, 0xF6, 0x05, 0x05, 0xFA, 0x06, 0xFB, 0xFB, 0x04, 0xFE, 0x07, 0xFA,
+0x06, 0x09, 0xF7, 0x0A, 0xFA, 0x05, 0x09, 0x08, 0xFB, 0x05, 0xF9, 0x06, 0x07, 0xFD, 0xF9, 0xF9,
+0x06, 0xF8, 0x06, 0x08, 0x07, 0xF9, 0x06, 0x09, 0xFC, 0x07, 0xFB, 0xF9, 0x07, 0xFF, 0x08, 0xFD,
+0x0A, 0x0C, 0xF2, 0x0A, 0xF6, 0x11, 0x11, 0x0E, 0xF5, 0x0A, 0xF2, 0x0B, 0x10, 0xF8, 0xF5, 0xF3,
+0x08, 0xF3, 0x0E, 0x0D, 0x0F, 0xEE, 0x0A, 0x0A, 0xF8, 0x07, 0xF4, 0xF5, 0x0D, 0xFB, 0x0F, 0xF2,
+0x0D, 0x0F, 0xF2, 0x0C, 0xF2, 0x0F, 0x11, 0x0F, 0xF6, 0x0C, 0xF0, 0x0A, 0x0E, 0xF5, 0xF5, 0xF5,
+0x0C, 0xEF, 0x0C, 0x0D, 0x11, 0xF3, 0x0D, 0x12, 0xF6, 0x06, 0xF4, 0xF4, 0x0E, 0xF9, 0x0C, 0xF4,
+0x0C, 0x0F, 0xF2, 0x0D, 0xF3, 0x0E, 0x0E, 0x0F, 0xF7, 0x09, 0xF5, 0x0A, 0x0D, 0xF5, 0xF3, 0xF5,
+0x0B, 0xF4, 0x0B, 0x0D, 0x0E, 0xF6, 0x0D, 0x0F, 0xF5, 0x03, 0xF4, 0xF5, 0x13, 0xF8, 0x0C, 0xF7,
+0x0D, 0x0E, 0xF3, 0x0B, 0xF4, 0x0E, 0x0D, 0x0F, 0xF4, 0x0F, 0xF4, 0x0B, 0x0E, 0xF5, 0xF4, 0xF3,
+0x0C, 0xF2, 0x0B, 0x0C, 0x0E, 0xF4, 0x0D, 0x0F, 0xF6, 0x06, 0xF4, 0xF4, 0x0F, 0xFD, 0x10, 0xF6,
+0x0D, 0x0D, 0xF1, 0x0E, 0xF2, 0x0E, 0x0E, 0x11, 0xF5, 0x0C, 0xF3, 0x0C, 0x0F, 0xF6, 0xF4, 0xF4,
+0x0B, 0xF3, 0x0C, 0x0B, 0x10, 0xF5, 0x0B, 0x0D, 0xF6, 0x07, 0xF3, 0xF4, 0x0E, 0xFC, 0x10, 0xF5,
+0x09, 0x0C, 0xF4, 0x10, 0xF3, 0x09, 0x0D, 0x12, 0xF4, 0x06, 0xEF, 0x0C, 0x10, 0xFA, 0xF3, 0xF7,
+0x0D, 0xF3, 0x0D, 0x0A, 0x0F, 0xF5, 0x0E, 0x0D, 0xF7, 0x04, 0xF4, 0xF2, 0x0C, 0xF8, 0x0F, 0xF6,
+0x0D, 0x0E, 0xF1, 0x0D, 0xF5, 0x13, 0x0C, 0x0A, 0xFB, 0x08, 0xEE, 0x07, 0x14, 0xFB, 0xF4, 0xEC,
+0x0B, 0xF5, 0x10, 0x0D, 0x0D, 0xED, 0x11, 0x0D, 0xF5, 0x07, 0xF5, 0xEF, 0x16, 0xFA, 0x0C, 0xEF,
+0x0A, 0x0C, 0xF0, 0x0B, 0xF4, 0x0E, 0x0C, 0x0D, 0xF5, 0x0B, 0xF7, 0x0A, 0x0E, 0xF7, 0xF5, 0xF4,
+0x0A, 0xF4, 0x0D, 0x0D, 0x0D, 0xF1, 0x0E, 0x0F, 0xF8, 0xFE, 0xF6, 0xF2, 0x0D, 0xFA, 0x0A, 0xF0,
+0x0F, 0x10, 0xF5, 0x11, 0xF4, 0x0E, 0x0F, 0x0C, 0xF5, 0x07, 0xF5, 0x0E, 0x0D, 0xFB, 0xF3, 0xF5,
+0x0E, 0xF2, 0x0B, 0x0C, 0x11, 0xEF, 0x0F, 0x0E, 0xF8, 0x07, 0xF2, 0xF2, 0x0F, 0xFB, 0x0C, 0xF3,
+0x0A, 0x0D, 0xF4, 0x0C, 0xF5, 0x0A, 0x0E, 0x0E, 0xF6, 0x0C, 0xF5, 0x0B, 0x0D, 0xF5, 0xF4, 0xF6,
+0x0B, 0xF5, 0x0C, 0x0D, 0x0C, 0xF6, 0x0B, 0x0D, 0xF4, 0xF0, 0xF5, 0xF5, 0x0C, 0xFA, 0x0C, 0xF8,
+0x0A, 0x0A, 0xF6, 0x0C, 0xF5, 0x0B, 0x09, 0x0B, 0xF6, 0x0A, 0xF7, 0x0C, 0x0B, 0xF5, 0xF4, 0xF6,
+0x0B, 0xF4, 0x0C, 0x0C, 0x0C, 0xF6, 0x0D, 0x0B, 0xF4, 0xEC, 0xF5, 0xF5, 0x0D, 0xFA, 0x0A, 0xFA,
+0x0C, 0x0D, 0xF3, 0x0C, 0xF4, 0x0D, 0x0F, 0x0F, 0xF6, 0x0A, 0xF4, 0x0D, 0x0D, 0xF7, 0xF4, 0xF5,
+0x0D, 0xF4, 0x0C, 0x0C, 0x0C, 0xF4, 0x0C, 0x0C, 0xF5, 0xF8, 0xF5, 0xF4, 0x0D, 0xF7, 0x0C, 0xF8,
+0x0C, 0x0D, 0xF4, 0x0B, 0xF1, 0x0E, 0x10, 0x10, 0xF5, 0x0C, 0xF4, 0x0D, 0x0E, 0xF5, 0xF4, 0xF4,
+0x0B, 0xF2, 0x0B, 0x0C, 0x0E, 0xF4, 0x0B, 0x0E, 0xF6, 0x06, 0xF5, 0xF1, 0x0F, 0xFB, 0x0E, 0xF7,
+0x0A, 0x0B, 0xF6, 0x0C, 0xF7, 0x0B, 0x0B, 0x0C, 0xF5, 0x09, 0xF6, 0x0C, 0x0B, 0xF5, 0xF6, 0xF7,
+0x0C, 0xF5, 0x0C, 0x0B, 0x0A, 0xF5, 0x0B, 0x0B, 0xF4, 0xEB, 0xF4, 0xF6, 0x0C, 0xF9, 0x09, 0xF7,
+0x0D, 0x0D, 0xF2, 0x0D, 0xF2, 0x0C, 0x0E, 0x11, 0xF6, 0x0B, 0xF3, 0x0F, 0x0E, 0xF9, 0xF2, 0xF7,
+0x0B, 0xF4, 0x0D, 0x0C, 0x0D, 0xF1, 0x0B, 0x0B, 0xF5, 0x08, 0xF5, 0xF4, 0x0B, 0xFD, 0x0D, 0xF6,
+0x0B, 0x0D, 0xF4, 0x0D, 0xF3, 0x0C, 0x0F, 0x0D, 0xF2, 0x0C, 0xF6, 0x0C, 0x0E, 0xF5, 0xF2, 0xF7,
+0x0D, 0xF0, 0x0F, 0x0D, 0x0D, 0xF3, 0x0E, 0x0A, 0xF7, 0xFD, 0xF7, 0xF4, 0x0D, 0xF9, 0x0E, 0xF5,
+0x0E, 0x0F, 0xF5, 0x0D, 0xF4, 0x0C, 0x0C, 0x0C, 0xF8, 0x0B, 0xF4, 0x0C, 0x0E, 0xF6, 0xF4, 0xF6,
+0x0B, 0xF3, 0x0B, 0x0D, 0x0D, 0xF3, 0x0F, 0x0E, 0xF4, 0xF8, 0xF3, 0xF5, 0x0F, 0xFB, 0x0D, 0xF8,
+0x0A, 0x0B, 0xF6, 0x0B, 0xF6, 0x0C, 0x09, 0x0C, 0xF5, 0x0C, 0xF7, 0x0E, 0x0B, 0xF3, 0xF5, 0xF6,
+0x0C, 0xF6, 0x0C, 0x0B, 0x0B, 0xF5, 0x09, 0x0B, 0xF5, 0xE6, 0xF6, 0xF6, 0x0D, 0xF9, 0x0B, 0xFC,
+0x0A, 0x0A, 0xF6, 0x0B, 0xF6, 0x0C, 0x0C, 0x0A, 0xF6, 0x0B, 0xF6, 0x0B, 0x0C, 0xF4, 0xF4, 0xF4,
+0x0B, 0xF7, 0x0C, 0x0D, 0x0C, 0xF4, 0x0B, 0x0B, 0xF5, 0xE5, 0xF6, 0xF5, 0x0E, 0xFA, 0x0B, 0xF9,
+0x0B, 0x0C, 0xF6, 0x0C, 0xF7, 0x0A, 0x0E, 0x0C, 0xF4, 0x0B, 0xF6, 0x0D, 0x0C, 0xF7, 0xF5, 0xF6,
+0x09, 0xF4, 0x0D, 0x0C, 0x0B, 0xF7, 0x0C, 0x0C, 0xF5, 0xE6, 0xF7, 0xF6, 0x0D, 0xFA, 0x0A, 0xF8,
+0x0B, 0x0C, 0xF4, 0x0B, 0xF4, 0x0D, 0x10, 0x0D, 0xF5, 0x0B, 0xF5, 0x0B, 0x0D, 0xF5, 0xF4, 0xF5,
+0x0A, 0xF3, 0x0C, 0x0B, 0x0D, 0xF2, 0x0C, 0x0D, 0xF5, 0xFB, 0xF6, 0xF5, 0x0C, 0xFA, 0x0A, 0xF5,
+0x0D, 0x0B, 0xF3, 0x0B, 0xF3, 0x0E, 0x0E, 0x0C, 0xF4, 0x0D, 0xF4, 0x0E, 0x0D, 0xF4, 0xF4, 0xF5,
+0x0C, 0xF3, 0x0D, 0x0C, 0x0D, 0xF6, 0x0C, 0x0C, 0xF5, 0x01, 0xF6, 0xF4, 0x0E, 0xFA, 0x0C, 0xF7,
+0x0C, 0x0D, 0xF3, 0x0C, 0xF3, 0x0C, 0x0F, 0x0D, 0xF4, 0x0D, 0xF3, 0x0C, 0x0D, 0xF5, 0xF5, 0xF6,
+0x0A, 0xF2, 0x0C, 0x0C, 0x0D, 0xF5, 0x0A, 0x0C, 0xF5, 0x07, 0xF4, 0xF4, 0x0E, 0xFC, 0x0C, 0xF8,
+0x0C, 0x0D, 0xF1, 0x0D, 0xF3, 0x0D, 0x10, 0x0B, 0xF4, 0x09, 0xF3, 0x0C, 0x0F, 0xF6, 0xF6, 0xF6,
+0x0D, 0xF3, 0x0A, 0x0A, 0x0D, 0xF2, 0x0E, 0x0F, 0xF6, 0xFD, 0xF4, 0xF4, 0x0F, 0xF9, 0x0C, 0xF4,
+0x0B, 0x0A, 0xF6, 0x0B, 0xF5, 0x0C, 0x0F, 0x0B, 0xF6, 0x0B, 0xF5, 0x0C, 0x0C, 0xF5, 0xF6, 0xF6,
+0x0B, 0xF6, 0x0C, 0x0C, 0x0C, 0xF6, 0x0C, 0x0C, 0xF4, 0xEA, 0xF7, 0xF6, 0x0D, 0xFA, 0x0B, 0xF6,
+0x0C, 0x0D, 0xF2, 0x0E, 0xF4, 0x0C, 0x0E, 0x0D, 0xF4, 0x0C, 0xF4, 0x0D, 0x0C, 0xF4, 0xF3, 0xF4,
+0x0D, 0xF4, 0x0D, 0x0A, 0x0D, 0xF6, 0x0C, 0x0C, 0xF4, 0x07, 0xF4, 0xF4, 0x0F, 0xFC, 0x0C, 0xF9,
+0x09, 0x0A, 0xF6, 0x0C, 0xF6, 0x0B, 0x0D, 0x0B, 0xF4, 0x0A, 0xF7, 0x0D, 0x0B, 0xF5, 0xF4, 0xF7,
+0x0B, 0xF5, 0x0C, 0x0C, 0x0B, 0xF7, 0x0A, 0x0C, 0xF5, 0xE1, 0xF5, 0xF5, 0x0D, 0xFA, 0x0B, 0xFC,
+0x0A, 0x0B, 0xF6, 0x0A, 0xF7, 0x0B, 0x0D, 0x0C, 0xF5, 0x0C, 0xF7, 0x0D, 0x0C, 0xF4, 0xF3, 0xF5,
+0x0A, 0xF4, 0x0C, 0x0C, 0x0B, 0xF4, 0x0D, 0x0A, 0xF3, 0xE4, 0xF6, 0xF7, 0x0C, 0xFA, 0x0A, 0xF8,
+0x0A, 0x0B, 0xF6, 0x0D, 0xF5, 0x0B, 0x0A, 0x0C, 0xF6, 0x0B, 0xF5, 0x0D, 0x0B, 0xF3, 0xF2, 0xF6,
+0x0B, 0xF4, 0x0E, 0x0E, 0x0B, 0xF7, 0x0B, 0x0C, 0xF5, 0xED, 0xF4, 0xF5, 0x0E, 0xFA, 0x0C, 0xF8,
+0x0A, 0x09, 0xF6, 0x0C, 0xF5, 0x0C, 0x09, 0x0B, 0xF5, 0x0C, 0xF6, 0x0E, 0x0B, 0xF4, 0xF6, 0xF6,
+0x0B, 0xF6, 0x0C, 0x0B, 0x0D, 0xF6, 0x0B, 0x0C, 0xF4, 0xE7, 0xF5, 0xF7, 0x0E, 0xFA, 0x0A, 0xF6,
+0x0C, 0x0E, 0xF5, 0x0E, 0xF6, 0x0D, 0x0E, 0x0B, 0xF7, 0x0A, 0xF5, 0x0D, 0x0F, 0xF6, 0xF1, 0xF5,
+0x0A, 0xF3, 0x0D, 0x0D, 0x0E, 0xF2, 0x0A, 0x10, 0xF6, 0x06, 0xF5, 0xF5, 0x10, 0xFC, 0x0D, 0xF7,
+0x0D, 0x0B, 0xF4, 0x0C, 0xF2, 0x0C, 0x0D, 0x0C, 0xF6, 0x0C, 0xF6, 0x0D, 0x0C, 0xF4, 0xF3, 0xF6,
+0x0B, 0xF4, 0x0C, 0x0A, 0x0C, 0xF4, 0x0D, 0x0C, 0xF6, 0xFA, 0xF4, 0xF3, 0x0C, 0xFB, 0x0D, 0xF9,
+0x0A, 0x0C, 0xF6, 0x0C, 0xF6, 0x0C, 0x0B, 0x0B, 0xF7, 0x0A, 0xF6, 0x0D, 0x0D, 0xF6, 0xF5, 0xF7,
+0x0B, 0xF4, 0x0D, 0x0C, 0x0D, 0xF2, 0x0B, 0x0C, 0xF5, 0xEA, 0xF5, 0xF7, 0x0E, 0xF9, 0x0C, 0xFA,
+0x0A, 0x0C, 0xF5, 0x0B, 0xF5, 0x0B, 0x0E, 0x0C, 0xF4, 0x0B, 0xF5, 0x0B, 0x0D, 0xF4, 0xF3, 0xF6,
+0x0A, 0xF7, 0x0D, 0x0A, 0x0A, 0xF6, 0x0C, 0x0C, 0xF5, 0xF3, 0xF5, 0xF6, 0x0D, 0xFA, 0x0C, 0xF9,
+0x0B, 0x0B, 0xF5, 0x0B, 0xF6, 0x0A, 0x0B, 0x09, 0xF5, 0x0A, 0xF7, 0x0E, 0x0B, 0xF3, 0xF5, 0xF6,
+0x0C, 0xF5, 0x0C, 0x0D, 0x0B, 0xF6, 0x0A, 0x09, 0xF4, 0xDE, 0xF5, 0xF7, 0x0D, 0xFA, 0x0B, 0xF8,
+0x09, 0x0B, 0xF6, 0x0C, 0xF6, 0x0A, 0x0C, 0x0A, 0xF6, 0x0B, 0xF6, 0x0D, 0x0B, 0xF5, 0xF4, 0xF6,
+0x0B, 0xF7, 0x0C, 0x0B, 0x0B, 0xF6, 0x0B, 0x0A, 0xF3, 0xD9, 0xF6, 0xF7, 0x0C, 0xFA, 0x0B, 0xFA,
+0x0A, 0x09, 0xF7, 0x0B, 0xF7, 0x0A, 0x0C, 0x0B, 0xF5, 0x0B, 0xF6, 0x0D, 0x0B, 0xF4, 0xF4, 0xF7,
+0x0B, 0xF6, 0x0C, 0x0B, 0x0A, 0xF5, 0x0C, 0x0C, 0xF4, 0xDB, 0xF6, 0xF8, 0x0D, 0xFA, 0x0A, 0xFA,
+0x0B, 0x09, 0xF6, 0x0A, 0xF8, 0x0A, 0x0C, 0x0B, 0xF5, 0x0C, 0xF8, 0x0E, 0x0A, 0xF4, 0xF3, 0xF7,
+0x0C, 0xF3, 0x0C, 0x0B, 0x0B, 0xF6, 0x0B, 0x0A, 0xF4, 0xDB, 0xF5, 0xF9, 0x0D, 0xFA, 0x0C, 0xF9,
+0x0A, 0x0B, 0xF2, 0x0B, 0xF6, 0x0D, 0x0F, 0x0D, 0xF6, 0x09, 0xF2, 0x0E, 0x10, 0xF9, 0xF5, 0xF5,
+0x0A, 0xF4, 0x0B, 0x0E, 0x0D, 0xF1, 0x0D, 0x0B, 0xF3, 0x08, 0xF4, 0xF5, 0x0F, 0xFC, 0x0E, 0xF7,
+0x0B, 0x0D, 0xF3, 0x0D, 0xF5, 0x0D, 0x0F, 0x0F, 0xF5, 0x0C, 0xF3, 0x0B, 0x0C, 0xF4, 0xF6, 0xF5,
+0x0B, 0xF3, 0x0C, 0x0B, 0x0D, 0xF3, 0x0C, 0x0E, 0xF5, 0x06, 0xF4, 0xF6, 0x11, 0xFB, 0x0E, 0xF6,
+0x0C, 0x0C, 0xF4, 0x0C, 0xF3, 0x0C, 0x0C, 0x0C, 0xF6, 0x09, 0xF4, 0x09, 0x0C, 0xF7, 0xF2, 0xF0,
+0x0A, 0xF5, 0x0B, 0x0C, 0x0C, 0xEE, 0x0C, 0x0F, 0xF6, 0x02, 0xF6, 0xF3, 0x10, 0xFB, 0x12, 0xF4,
+0x0C, 0x0B, 0xF5, 0x0C, 0xF5, 0x0C, 0x0C, 0x0A, 0xF6, 0x0B, 0xF7, 0x0C, 0x0C, 0xF4, 0xF3, 0xF7,
+0x0A, 0xF4, 0x0C, 0x0B, 0x0B, 0xF5, 0x0C, 0x0C, 0xF5, 0xE8, 0xF4, 0xF5, 0x0F, 0xF9, 0x0D, 0xFB,
+0x0B, 0x0B, 0xF5, 0x0B, 0xF5, 0x0C, 0x0C, 0x0A, 0xF6, 0x0B, 0xF6, 0x0D, 0x0C, 0xF4, 0xF4, 0xF6,
+0x0C, 0xF4, 0x0C, 0x0B, 0x0B, 0xF6, 0x0C, 0x0A, 0xF4, 0xE0, 0xF4, 0xF6, 0x0E, 0xFA, 0x0C, 0xF9,
+0x0B, 0x0A, 0xF4, 0x0C, 0xF6, 0x0B, 0x0B, 0x0C, 0xF5, 0x0A, 0xF6, 0x0D, 0x0B, 0xF4, 0xF4, 0xF6,
+0x0C, 0xF3, 0x0D, 0x0C, 0x0B, 0xF6, 0x0C, 0x0C, 0xF4, 0xE6, 0xF4, 0xF6, 0x0D, 0xFA, 0x0B, 0xF7,
+0x0A, 0x0C, 0xF6, 0x0D, 0xF5, 0x0C, 0x0F, 0x0A, 0xF5, 0x0B, 0xF5, 0x0D, 0x0D, 0xF5, 0xF5, 0xF6,
+0x0A, 0xF4, 0x0C, 0x0D, 0x0C, 0xF6, 0x0B, 0x0C, 0xF3, 0xEC, 0xF6, 0xF5, 0x0F, 0xFA, 0x0C, 0xF7,
+0x09, 0x0A, 0xF6, 0x0B, 0xF5, 0x0C, 0x0D, 0x0B, 0xF6, 0x0B, 0xF6, 0x0E, 0x0C, 0xF4, 0xF3, 0xF5,
+0x0C, 0xF5, 0x0C, 0x0B, 0x0B, 0xF5, 0x0C, 0x0C, 0xF5, 0xDE, 0xF7, 0xF6, 0x0F, 0xFA, 0x0A, 0xF8,
+0x0C, 0x0D, 0xF1, 0x0E, 0xF5, 0x0B, 0x0E, 0x0C, 0xF8, 0x0A, 0xF1, 0x0C, 0x0D, 0xF6, 0xF4, 0xF6,
+0x0A, 0xF3, 0x0B, 0x0A, 0x0E, 0xF3, 0x0A, 0x0F, 0xF5, 0xFA, 0xF5, 0xF3, 0x0D, 0xFB, 0x0F, 0xF9,
+0x0A, 0x0C, 0xF4, 0x0C, 0xF5, 0x0D, 0x0A, 0x0B, 0xF5, 0x0B, 0xF7, 0x0C, 0x0B, 0xF6, 0xF4, 0xF6,
+0x09, 0xF3, 0x0D, 0x0C, 0x0D, 0xF0, 0x0B, 0x0C, 0xF5, 0xEA, 0xF5, 0xF4, 0x0E, 0xFA, 0x0A, 0xF7,
+0x0A, 0x0C, 0xF3, 0x0D, 0xF6, 0x0C, 0x0C, 0x0E, 0xF5, 0x0A, 0xF4, 0x0B, 0x0D, 0xF4, 0xF5, 0xF6,
+0x0A, 0xF5, 0x0C, 0x0B, 0x0D, 0xF2, 0x0D, 0x0D, 0xF4, 0xF5, 0xF6, 0xF6, 0x0E, 0xF7, 0x0C, 0xF8,
+0x0A, 0x0B, 0xF5, 0x0C, 0xF4, 0x0D, 0x0C, 0x0C, 0xF5, 0x0C, 0xF7, 0x0D, 0x0B, 0xF4, 0xF5, 0xF5,
+0x0B, 0xF6, 0x0C, 0x0A, 0x0B, 0xF6, 0x0D, 0x0B, 0xF6, 0xE9, 0xF5, 0xF5, 0x0F, 0xFA, 0x0C, 0xF8,
+0x0B, 0x0B, 0xF5, 0x0B, 0xF4, 0x0D, 0x0B, 0x0A, 0xF4, 0x0C, 0xF5, 0x0D, 0x0C, 0xF3, 0xF5, 0xF5,
+0x0C, 0xF5, 0x0C, 0x0B, 0x0E, 0xF6, 0x0C, 0x0B, 0xF5, 0xEB, 0xF6, 0xF5, 0x0E, 0xFA, 0x0C, 0xFC,
+0x0B, 0x0C, 0xF5, 0x0B, 0xF6, 0x0A, 0x0B, 0x0B, 0xF5, 0x0C, 0xF6, 0x0D, 0x0C, 0xF5, 0xF3, 0xF8,
+0x0A, 0xF5, 0x0D, 0x0C, 0x0B, 0xF8, 0x0B, 0x0B, 0xF4, 0xE0, 0xF5, 0xF7, 0x0E, 0xF9, 0x0A, 0xFC,
+0x09, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0x0B, 0x0D, 0xF6, 0x0A, 0xF6, 0x0B, 0x0A, 0xF5, 0xF4, 0xF6,
+0x0B, 0xF5, 0x0E, 0x0C, 0x0B, 0xF4, 0x0D, 0x0D, 0xF5, 0xE4, 0xF6, 0xF4, 0x0E, 0xFB, 0x0A, 0xF9,
+0x0C, 0x0C, 0xF4, 0x0E, 0xF4, 0x0C, 0x0D, 0x0E, 0xF5, 0x0B, 0xF4, 0x0D, 0x0D, 0xF5, 0xF3, 0xF7,
+0x0B, 0xF3, 0x0D, 0x0D, 0x0C, 0xF4, 0x0C, 0x0D, 0xF4, 0xFE, 0xF3, 0xF4, 0x0D, 0xF8, 0x0C, 0xF9,
+0x0C, 0x0B, 0xF5, 0x0D, 0xF6, 0x0B, 0x0B, 0x0D, 0xF4, 0x0A, 0xF6, 0x0E, 0x0C, 0xF4, 0xF4, 0xF5,
+0x0C, 0xF5, 0x0D, 0x0D, 0x0B, 0xF6, 0x0D, 0x0B, 0xF5, 0xEF, 0xF5, 0xF5, 0x0D, 0xFA, 0x0B, 0xFA,
+0x0C, 0x0D, 0xF4, 0x0C, 0xF4, 0x0B, 0x0B, 0x0D, 0xF9, 0x09, 0xF5, 0x0B, 0x11, 0xF6, 0xF1, 0xF6,
+0x0D, 0xF3, 0x0C, 0x0F, 0x0E, 0xF2, 0x0C, 0x0E, 0xF7, 0xFF, 0xF3, 0xF4, 0x0D, 0xFA, 0x0D, 0xF7,
+0x09, 0x0A, 0xF4, 0x0C, 0xF6, 0x0B, 0x0B, 0x0C, 0xF5, 0x0D, 0xF7, 0x0D, 0x0C, 0xF4, 0xF5, 0xF6,
+0x0B, 0xF4, 0x0B, 0x0B, 0x0B, 0xF3, 0x0C, 0x0B, 0xF4, 0xFA, 0xF4, 0xF6, 0x0F, 0xF8, 0x0C, 0xF9,
+0x09, 0x0B, 0xF6, 0x0C, 0xF6, 0x0A, 0x0C, 0x0B, 0xF5, 0x0A, 0xF7, 0x0D, 0x0B, 0xF5, 0xF5, 0xF7,
+0x0B, 0xF6, 0x0C, 0x0C, 0x0C, 0xF6, 0x0B, 0x0A, 0xF4, 0xE6, 0xF6, 0xF6, 0x0D, 0xF9, 0x0A, 0xFB,
+0x0A, 0x0A, 0xF6, 0x0A, 0xF6, 0x09, 0x0B, 0x0A, 0xF6, 0x0A, 0xF7, 0x0B, 0x0B, 0xF4, 0xF5, 0xF8,
+0x0C, 0xF6, 0x0C, 0x0E, 0x0A, 0xF5, 0x0B, 0x0B, 0xF4, 0xE7, 0xF7, 0xF8, 0x0D, 0xF8, 0x08, 0xFA,
+0x0A, 0x0C, 0xF6, 0x0A, 0xF6, 0x0B, 0x0C, 0x0A, 0xF5, 0x0B, 0xF7, 0x0D, 0x0D, 0xF5, 0xF5, 0xF8,
+0x0C, 0xF6, 0x0C, 0x0C, 0x0A, 0xF7, 0x0B, 0x0A, 0xF5, 0xE4, 0xF7, 0xF6, 0x0F, 0xF9, 0x0C, 0xFB,
+0x0A, 0x0A, 0xF6, 0x0B, 0xF6, 0x0A, 0x0A, 0x0B, 0xF5, 0x0B, 0xF6, 0x0C, 0x0C, 0xF4, 0xF5, 0xF7,
+0x0A, 0xF5, 0x0D, 0x0C, 0x0C, 0xF5, 0x0D, 0x0C, 0xF5, 0xE6, 0xF6, 0xF6, 0x0E, 0xFA, 0x0B, 0xF9,
+0x0C, 0x0C, 0xF6, 0x0D, 0xF4, 0x0C, 0x09, 0x0C, 0xF5, 0x0D, 0xF6, 0x0D, 0x0C, 0xF4, 0xF5, 0xF4,
+0x0C, 0xF5, 0x0E, 0x0D, 0x0B, 0xF6, 0x0A, 0x0A, 0xF4, 0x08, 0xF4, 0xF5, 0x0E, 0xFC, 0x0E, 0xF8,
+0x0A, 0x0C, 0xF5, 0x0C, 0xF5, 0x0B, 0x0D, 0x0D, 0xF4, 0x0D, 0xF6, 0x0D, 0x0C, 0xF3, 0xF4, 0xF5,
+0x0B, 0xF4, 0x0E, 0x0D, 0x0E, 0xF4, 0x0C, 0x0D, 0xF4, 0x08, 0xF5, 0xF4, 0x10, 0xFD, 0x0C, 0xFA,
+0x0C, 0x0B, 0xF4, 0x0C, 0xF4, 0x0C, 0x0F, 0x0E, 0xF5, 0x0E, 0xF5, 0x0D, 0x0D, 0xF6, 0xF4, 0xF7,
+0x0C, 0xF4, 0x0D, 0x0A, 0x0D, 0xF3, 0x0B, 0x0D, 0xF6, 0x08, 0xF5, 0xF3, 0x0D, 0xFE, 0x0C, 0xF8,
+0x00, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0xFD, 0xFE, 0xFD, 0xFF, 0x02, 0x00, 0xFF, 0x01, 0x02, 0x00,
+0x02, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0xFE, 0x01, 0x07, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0xFE, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0x00,
+0x02, 0x00, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0xFD, 0x01, 0x06, 0x00, 0x00, 0x00, 0xFC, 0x02, 0x03,
+0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x02, 0xFF, 0x01, 0x00, 0xFE, 0x00, 0xFE,
+0x03, 0xFF, 0x02, 0x03, 0x02, 0x03, 0x00, 0xFE, 0xFF, 0x05, 0xFF, 0xFE, 0x01, 0x05, 0x01, 0x04,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0xFE,
+0x02, 0xFF, 0xFF, 0x01, 0x00, 0x03, 0x00, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0x02, 0x04, 0x01, 0x02,
+0x01, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
+0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0x02, 0x03, 0x01, 0x01,
+0x02, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0xFF, 0xFE, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFE,
+0x03, 0x00, 0x01, 0x02, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0x00, 0x04, 0x04, 0x01, 0x02,
+0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x01, 0x01, 0xFE,
+0x02, 0x02, 0x01, 0x00, 0xFF, 0x02, 0xFF, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFD, 0x01, 0x02,
+0x00, 0x00, 0x01, 0x01, 0x02, 0xFF, 0x00, 0xFE, 0xFE, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+0x03, 0x00, 0x00, 0x00, 0xFE, 0x04, 0x00, 0xFF, 0x02, 0x08, 0x01, 0xFF, 0x01, 0x00, 0xFF, 0x02,
+0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFE, 0xFE, 0xFE, 0xFF, 0x01, 0xFF, 0xFD, 0x01, 0x01, 0x00,
+0x02, 0x02, 0x00, 0x02, 0x01, 0x01, 0x00, 0xFE, 0x00, 0x0B, 0x01, 0x01, 0x03, 0x07, 0x01, 0x02,
+0x01, 0x02, 0x02, 0xFF, 0x01, 0xFF, 0xFD, 0xFD, 0xFD, 0x01, 0xFE, 0x00, 0xFE, 0x02, 0x02, 0xFF,
+0x02, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x00, 0xFC, 0xFF, 0x0C, 0xFF, 0xFF, 0x01, 0x09, 0x00, 0x03,
+0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFE, 0xFE, 0xFD, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x01, 0xFF,
+0x03, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x03,
+0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0xFF,
+0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0x06, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x02,
+0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+0x02, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x06, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x03,
+0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFD, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x00,
+0x02, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x0C, 0xFF, 0xFF, 0x03, 0x0A, 0x01, 0x04,
+0x01, 0x01, 0x02, 0xFF, 0x01, 0x00, 0xFD, 0xFD, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFF,
+0x03, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFF, 0x03, 0x08, 0x00, 0x03,
+0xFE, 0xFF, 0x02, 0xFF, 0x03, 0x00, 0xF9, 0xFD, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00,
+0x01, 0x02, 0x00, 0x01, 0x00, 0x01, 0xFE, 0xFD, 0xFF, 0x15, 0x01, 0x00, 0xFC, 0x05, 0xFE, 0x02,
+0x01, 0xFF, 0x02, 0xFF, 0x01, 0xFD, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x01, 0x02, 0x00,
+0x03, 0x02, 0x00, 0x00, 0x01, 0x02, 0xFD, 0xFD, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02,
+0x01, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF,
+0x02, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0xFD, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x04, 0x00, 0x04,
+0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+0x02, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x0E, 0x00, 0xFF, 0xFF, 0x01, 0x01, 0x00,
+0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFD, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x01, 0xFF,
+0x02, 0x00, 0xFF, 0x00, 0xFF, 0x03, 0xFF, 0xFD, 0x00, 0x0E, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0xFE,
+0x00, 0x01, 0x01, 0xFE, 0x00, 0xFF, 0xFE, 0xFF, 0xFD, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE,
+0x02, 0xFF, 0xFF, 0x01, 0xFF, 0x02, 0x00, 0xFD, 0xFF, 0x0E, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02,
+0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0xFC, 0xFD, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00,
+0x02, 0x02, 0x00, 0x01, 0xFF, 0x03, 0xFF, 0xFE, 0x01, 0x11, 0xFF, 0x01, 0x02, 0x07, 0x00, 0x03,
+0x01, 0xFF, 0x01, 0xFE, 0x02, 0x01, 0xFC, 0xFD, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x02, 0x01, 0xFF,
+0x04, 0x0A, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x02, 0x15, 0x01, 0xFF, 0x03, 0x06, 0x01, 0x02,
+0xFF, 0xFF, 0x03, 0x00, 0x02, 0xFF, 0xFB, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x01, 0xFF,
+0x01, 0x02, 0xFF, 0x00, 0xFD, 0x05, 0xFF, 0xFB, 0x01, 0x14, 0x00, 0x01, 0x03, 0x04, 0xFF, 0x03,
+0x01, 0x00, 0x01, 0x00, 0x02, 0xFE, 0xFC, 0xFD, 0xFF, 0xFF, 0x02, 0xFE, 0xFE, 0x01, 0x01, 0xFE,
+0x02, 0x01, 0x01, 0x00, 0xFF, 0x02, 0xFF, 0xFE, 0x00, 0x11, 0x00, 0x01, 0x02, 0x08, 0x00, 0x03,
+0x01, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0xFE, 0xFE, 0xFD, 0x01, 0x00, 0xFF, 0xFE, 0xFE, 0x02, 0x00,
+0x03, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xFF, 0xFB, 0xFF, 0x0D, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x02,
+0x00, 0x00, 0x01, 0xFE, 0x00, 0xFE, 0x01, 0xFE, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0xFF, 0x02, 0x01,
+0x00, 0xFE, 0xFE, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0x00, 0x0A, 0x01, 0x00, 0xFC, 0xFA, 0xFF, 0x01,
+0x01, 0xFF, 0x01, 0xFE, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x01, 0x00, 0xFF, 0xFE, 0xFF, 0x01, 0x01,
+0x02, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0xFD, 0xFF, 0x09, 0xFF, 0x00, 0xFE, 0xFA, 0x00, 0xFE,
+0x00, 0x01, 0x01, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x02, 0xFF,
+0x02, 0xFE, 0xFF, 0x00, 0xFF, 0x02, 0xFF, 0xFE, 0x00, 0x0C, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0xFE,
+0x00, 0xFF, 0x01, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x02, 0x02, 0xFF,
+0x03, 0x02, 0xFF, 0x01, 0xFE, 0x02, 0xFF, 0xFC, 0x01, 0x10, 0x00, 0x00, 0x01, 0x06, 0xFF, 0x01,
+0x01, 0xFD, 0x04, 0xFF, 0x00, 0xFF, 0xFD, 0xFC, 0xFD, 0x00, 0x01, 0x00, 0xFF, 0x02, 0x02, 0x00,
+0x03, 0x04, 0xFF, 0x01, 0xFF, 0x04, 0xFF, 0xFD, 0x01, 0x15, 0x00, 0x00, 0x02, 0x07, 0xFF, 0x03,
+0xFF, 0xFB, 0x03, 0xFF, 0x00, 0x00, 0xFD, 0xFE, 0xFE, 0xFF, 0x01, 0xFE, 0xFD, 0x03, 0x03, 0xFE,
+0x02, 0x06, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFA, 0x00, 0x14, 0x01, 0x01, 0x04, 0x07, 0x00, 0x01,
+0x00, 0xFF, 0x03, 0xFF, 0x01, 0x00, 0xFD, 0xFE, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x02, 0x02, 0x00,
+0x02, 0x01, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x10, 0x01, 0x00, 0x02, 0x04, 0x00, 0x02,
+0x00, 0xFF, 0x01, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x0B, 0x01, 0x00, 0x00, 0xFB, 0x01, 0x03,
+0xFF, 0x00, 0x00, 0xFF, 0x01, 0xFE, 0x01, 0xFF, 0x00, 0xFE, 0xFF, 0xFD, 0xFF, 0x00, 0x01, 0x00,
+0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0x03, 0x04, 0x00, 0x08, 0x03, 0x00, 0xFA, 0xF7, 0x01, 0x05,
+0xFF, 0x00, 0x02, 0xFF, 0x01, 0xFE, 0x05, 0xFD, 0xFF, 0x01, 0xFE, 0xFF, 0xFE, 0x00, 0xFE, 0x01,
+0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0xFF, 0x02, 0x00, 0x06, 0x02, 0x00, 0xF9, 0xF7, 0x01, 0x02,
+0x00, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0xFF, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x02, 0xFF,
+0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0x01, 0xFF, 0x08, 0x02, 0x00, 0xFE, 0xFA, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x02, 0x00,
+0x02, 0x02, 0xFF, 0x00, 0x00, 0x04, 0xFE, 0xFD, 0x01, 0x10, 0x00, 0x00, 0x03, 0x05, 0xFE, 0x02,
+0x00, 0xFF, 0x04, 0xFF, 0x01, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0x02, 0xFF,
+0x02, 0x02, 0xFF, 0x01, 0xFD, 0x05, 0xFF, 0xFD, 0xFF, 0x14, 0x00, 0x00, 0x04, 0x04, 0xFE, 0x02,
+0x00, 0xFE, 0x06, 0xFF, 0x02, 0x00, 0xFC, 0xFD, 0x00, 0x01, 0x01, 0xFD, 0xFF, 0x02, 0x03, 0x00,
+0x03, 0x01, 0x00, 0x01, 0xFC, 0x03, 0xFE, 0xF9, 0x01, 0x14, 0xFF, 0x03, 0x05, 0x04, 0xFE, 0x01,
+0x00, 0xFE, 0x01, 0x00, 0x01, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x01, 0x01, 0x00,
+0x00, 0x02, 0xFF, 0xFE, 0xFE, 0x05, 0xFD, 0xFD, 0x00, 0x10, 0x00, 0x00, 0x04, 0x03, 0x01, 0x01,
+0xFF, 0xFF, 0x02, 0xFD, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFE,
+0x01, 0xFE, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0xFF, 0x01, 0x0C, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x02,
+0xFF, 0x01, 0x02, 0x01, 0x01, 0xFE, 0xFC, 0xFE, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF,
+0x01, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0x08, 0x00, 0x02, 0x02, 0xF9, 0x01, 0x01,
+0x02, 0x02, 0x02, 0xFD, 0xFE, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0xFC, 0xFF, 0x07, 0x02, 0xFE, 0x00, 0xF8, 0xFE, 0xFE,
+0x01, 0xFF, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0xFD, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x05, 0x02,
+0x01, 0x04, 0xFE, 0xFD, 0xFF, 0xFD, 0xFF, 0x01, 0x00, 0x0C, 0xFE, 0xFF, 0x01, 0xFF, 0xFE, 0x04,
+0x01, 0xFE, 0x03, 0xFE, 0x00, 0xFF, 0xFC, 0xFD, 0xFE, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x01, 0x00, 0xFE, 0x04, 0xFE, 0xFD, 0x00, 0x10, 0xFF, 0x00, 0x04, 0x03, 0xFF, 0x01,
+0x00, 0xFD, 0x01, 0xFF, 0x01, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x02, 0x03, 0xFF,
+0x00, 0x02, 0x00, 0xFF, 0xFE, 0x05, 0x00, 0x00, 0x02, 0x14, 0x02, 0x00, 0x02, 0x06, 0xFE, 0x01,
+0x01, 0xF9, 0x05, 0x01, 0x02, 0x00, 0xFD, 0xFC, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0xFE,
+0x02, 0x03, 0xFF, 0xFF, 0xFC, 0x02, 0xFE, 0xF9, 0x02, 0x14, 0x00, 0x01, 0x05, 0x06, 0xFF, 0xFF,
+0xFF, 0xFD, 0x03, 0xFE, 0x00, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x03, 0x02, 0x00,
+0x01, 0x03, 0xFF, 0xFF, 0xFE, 0x04, 0xFF, 0xFE, 0x00, 0x12, 0x00, 0xFF, 0x05, 0x03, 0xFB, 0x00,
+0xFE, 0x01, 0x04, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0xFE, 0xFF, 0x02, 0x00, 0x00, 0x03, 0x00, 0xFE,
+0x00, 0x01, 0xFF, 0x00, 0xFE, 0x04, 0xFF, 0xFE, 0x02, 0x10, 0x00, 0x00, 0x04, 0x07, 0x00, 0x04,
+0x01, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0x02, 0xFE, 0xFE, 0x02, 0x01, 0xFF,
+0x01, 0x02, 0xFF, 0xFF, 0xFC, 0x04, 0xFE, 0xFD, 0x01, 0x0D, 0x01, 0x01, 0x07, 0x02, 0xFD, 0xFF,
+0x00, 0xFD, 0x08, 0xFC, 0xFD, 0x02, 0xFE, 0xFA, 0xFF, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x05, 0xFF,
+0x01, 0x06, 0xFD, 0x00, 0xFB, 0x02, 0x00, 0xFF, 0x00, 0x0D, 0x00, 0xFD, 0x08, 0x03, 0xFF, 0xFA,
+0x02, 0x03, 0x09, 0xFD, 0xFF, 0x02, 0xFF, 0xFB, 0xFD, 0x02, 0x02, 0xFF, 0x01, 0x01, 0x04, 0xFD,
+0x04, 0x06, 0xFE, 0x01, 0xFF, 0x03, 0xFF, 0xFA, 0x02, 0x10, 0x01, 0x00, 0x07, 0x02, 0xFA, 0x00,
+0x01, 0x00, 0x04, 0x00, 0x02, 0xFE, 0xFE, 0xFB, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x03, 0x02, 0xFF,
+0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFB, 0x00, 0x12, 0x00, 0x01, 0x04, 0x05, 0xFD, 0x03,
+0xFF, 0xFF, 0x02, 0xFF, 0x02, 0x00, 0xFE, 0xFC, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x03, 0x02, 0xFF,
+0x02, 0x02, 0x00, 0x00, 0xFE, 0x05, 0xFE, 0xFC, 0x01, 0x15, 0x00, 0xFF, 0x03, 0x06, 0xFD, 0x01,
+0x00, 0xFD, 0x06, 0xFE, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0x02, 0x03, 0x01,
+0x02, 0x09, 0xFC, 0xFD, 0xFE, 0x03, 0xFC, 0xFE, 0x02, 0x1A, 0x00, 0x04, 0x02, 0x00, 0xFE, 0x00,
+0x01, 0x00, 0x01, 0xFF, 0x02, 0x03, 0xFC, 0xF6, 0xFC, 0x01, 0x02, 0xFD, 0x00, 0x03, 0x01, 0x01,
+0x05, 0x0C, 0xFC, 0x00, 0xFA, 0x05, 0xFC, 0xFB, 0x03, 0x14, 0x00, 0x00, 0x03, 0x02, 0xFE, 0xFF,
+0x00, 0xFC, 0x07, 0xFE, 0x01, 0x02, 0xF7, 0xFE, 0xFD, 0x01, 0x02, 0xFE, 0xFE, 0x02, 0x03, 0x00,
+0x00, 0x04, 0xFE, 0x02, 0xFF, 0x03, 0xFD, 0xFD, 0x00, 0x13, 0x00, 0x02, 0x03, 0x03, 0xFF, 0x02,
+0x00, 0xFB, 0x02, 0xFE, 0x02, 0x00, 0xFC, 0xFB, 0xFE, 0xFF, 0x02, 0xFD, 0xFF, 0x01, 0x01, 0x00,
+0x01, 0x06, 0x00, 0x00, 0xFE, 0x04, 0xFD, 0xFC, 0x00, 0x11, 0xFF, 0x00, 0x03, 0x02, 0x01, 0x00,
+0x02, 0xFF, 0x03, 0xFD, 0x01, 0xFD, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x02, 0x00, 0xFD,
+0x02, 0x06, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xFC, 0x02, 0x10, 0x00, 0xFE, 0x03, 0x01, 0xFB, 0x00,
+0x01, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x02, 0x01, 0x00,
+0x02, 0x06, 0x00, 0x00, 0xF8, 0x08, 0xFD, 0xFC, 0xFF, 0x13, 0xFF, 0x00, 0x04, 0x02, 0xFD, 0x02,
+0x00, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x02, 0x02, 0x01,
+0x02, 0x05, 0xFE, 0x00, 0xFF, 0x04, 0xFF, 0xFC, 0x01, 0x14, 0x00, 0x00, 0x03, 0x03, 0xFC, 0x02,
+0x01, 0xFF, 0x0A, 0xFE, 0x02, 0xFF, 0xFE, 0xFE, 0xFD, 0xFF, 0x04, 0xFF, 0xFD, 0x03, 0x01, 0x00,
+0x03, 0x03, 0xFF, 0x00, 0xFF, 0x04, 0xFF, 0xFE, 0x02, 0x18, 0x01, 0x02, 0x06, 0x03, 0xFA, 0x02,
+0xB9, 0xB8, 0x4F, 0xB8, 0x48, 0xBE, 0xAD, 0xAF, 0x53, 0xAC, 0x4A, 0xAD, 0xBA, 0x5E, 0x4B, 0x3F,
+0xB8, 0x4F, 0xB7, 0xBA, 0xB7, 0x53, 0xB6, 0xAC, 0x54, 0x56, 0x43, 0x47, 0xC3, 0x55, 0xB7, 0x4F,
+0x4B, 0x4A, 0xAF, 0x46, 0xB4, 0x43, 0x52, 0x53, 0xAF, 0x58, 0xB6, 0x4C, 0x47, 0xA8, 0xB9, 0xC2,
+0x47, 0xB0, 0x46, 0x43, 0x4B, 0xAF, 0x47, 0x54, 0xB2, 0xA8, 0xBE, 0xB5, 0x3C, 0xAC, 0x4B, 0xB1,
+};
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef OPENINGBOOK_H
+#define OPENINGBOOK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "chessMoves.h"
+
+// The book format is private to this firmware. Entries are 16 bytes, big-endian
+//   key (8), move (2), weight (2), learn (4, unused)
+// sorted by key. The move is packed as bits 0-2 destination file, 3-5 destination
+// rank, 6-8 source file, 9-11 source rank (rank 0 = rank 1), 12-14 promotion
+// (0 none, 1 knight, 2 bishop, 3 rook, 4 queen), with castling written as the king
+// taking its own rook (e1h1). Layout and move packing follow Polyglot, but the keys
+// are this engine's Zobrist keys (zobrist.h), so Polyglot books and tools do not
+// work with it: books are built from PGN with tools/book_gen.cpp.
+#define CHESS_BOOK_ENTRY_BYTES 16
+
+/**
+ * @brief Packs a move in the book's move format.
+ */
+inline uint16_t encodeBookMove(ChessMove move) {
+    static const uint8_t promotionCodes[7] = {0, 0, 2, 1, 3, 4, 0}; // indexed by piece type
+    int from = moveFrom(move);
+    int to = moveTo(move);
+    if (moveKind(move) == MOVE_CASTLE) {
+        to = to > from ? from + 3 : from - 4; // king takes its own rook
+    }
+    int promotion = moveKind(move) == MOVE_PROMOTION ? promotionCodes[movePromotion(move)] : 0;
+    return (uint16_t)((to % 8) | ((7 - to / 8) << 3) | ((from % 8) << 6) | ((7 - from / 8) << 9) | (promotion << 12));
+}
+
+/**
+ * @brief Read-only opening book over a block of sorted entries, e.g. a const array
+ * in flash. Lookups are a binary search over the block in place: nothing is copied
+ * and nothing is allocated.
+ */
+class OpeningBook {
+  private:
+    const uint8_t *_data;
+    uint32_t _count;
+
+    static uint64_t readBig(const uint8_t *bytes, int count) {
+        uint64_t value = 0;
+        for (int i = 0; i < count; i++) {
+            value = (value << 8) | bytes[i];
+        }
+        return value;
+    }
+
+    const uint8_t *entry(uint32_t index) const { return _data + (size_t)index * CHESS_BOOK_ENTRY_BYTES; }
+
+    // Index of the first entry whose key is not below key.
+    uint32_t lowerBound(uint64_t key) const {
+        uint32_t low = 0, high = _count;
+        while (low < high) {
+            uint32_t middle = low + (high - low) / 2;
+            if (readBig(entry(middle), 8) < key) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+  public:
+    OpeningBook(const uint8_t *data, size_t bytes) : _data(data), _count((uint32_t)(bytes / CHESS_BOOK_ENTRY_BYTES)) {}
+
+    uint32_t size() const { return _count; }
+
+    uint64_t keyAt(uint32_t index) const { return readBig(entry(index), 8); }
+    uint16_t moveAt(uint32_t index) const { return (uint16_t)readBig(entry(index) + 8, 2); }
+    uint16_t weightAt(uint32_t index) const { return (uint16_t)readBig(entry(index) + 10, 2); }
+
+    /**
+     * @brief Turns a book move into the matching legal move of a position.
+     * @return The move, or 0 if no legal move matches (e.g. a key collision).
+     */
+    static ChessMove legalMove(const ChessPosition &position, uint16_t bookMove) {
+        ChessMoveList legal;
+        generateLegalMoves(position, position.sideToMove(), legal);
+        for (ChessMove move : legal) {
+            if (encodeBookMove(move) == bookMove) {
+                return move;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Picks a book move for a position, each with probability proportional to its weight.
+     * @param position Position to look up.
+     * @param random Any 32-bit value; the same value picks the same move.
+     * @return A legal move, or 0 if the position is not in the book.
+     */
+    ChessMove probe(const ChessPosition &position, uint32_t random) const {
+        uint64_t key = position.key();
+        uint32_t first = lowerBound(key);
+        uint32_t total = 0;
+        uint32_t last = first;
+        for (; last < _count && keyAt(last) == key; last++) {
+            total += weightAt(last);
+        }
+        if (total == 0) {
+            return 0;
+        }
+        uint32_t pick = random % total;
+        for (uint32_t i = first; i < last; i++) {
+            uint16_t weight = weightAt(i);
+            if (pick < weight) {
+                return legalMove(position, moveAt(i));
+            }
+            pick -= weight;
+        }
+        return 0;
+    }
+};
+
+#endif
@@ -0,0 +1,542 @@
+#ifndef OPENINGBOOKDATA_H
+#define OPENINGBOOKDATA_H
+
+#include <stdint.h>
+
+// Generated by tools/book_gen.cpp (first 16 plies of 43 games): 531 entries, 8496 bytes.
+// Private book format keyed with the engine's Zobrist keys; see openingBook.h. Do not edit.
+alignas(8) const uint8_t openingBookData[] = {
+0x00, 0x61, 0x5F, 0x50, 0xAE, 0xBC, 0xF0, 0xB3, 0x05, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x93, 0x28, 0xCE, 0xFB, 0x99, 0xD1, 0xC8, 0x02, 0xD1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xCB, 0x7D, 0xE9, 0xA4, 0xB8, 0xCC, 0xB7, 0x0D, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xE5, 0xE7, 0x32, 0xB3, 0xFD, 0x55, 0x69, 0x03, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x3F, 0xB0, 0x38, 0xCE, 0xB4, 0x8F, 0xD3, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x03, 0x16, 0x35, 0xB5, 0x2D, 0x7D, 0x00, 0x6B, 0x02, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x03, 0x73, 0xDF, 0x3E, 0x77, 0xE5, 0x3B, 0xD4, 0x03, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x04, 0x1B, 0x5E, 0x09, 0x80, 0xFB, 0x43, 0x0E, 0x0C, 0xAA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x04, 0x45, 0xD4, 0xD1, 0x79, 0xE9, 0x13, 0x89, 0x0C, 0x61, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x04, 0xDF, 0xE2, 0xD9, 0x2C, 0x61, 0x6B, 0x56, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x05, 0x3E, 0x8C, 0x90, 0xD6, 0xC0, 0x23, 0x17, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x05, 0xB6, 0x08, 0x8B, 0xC6, 0xB8, 0x00, 0xB6, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x05, 0xCA, 0x1C, 0xC8, 0x50, 0xCB, 0xF3, 0xC8, 0x00, 0x52, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x05, 0xCA, 0x1C, 0xC8, 0x50, 0xCB, 0xF3, 0xC8, 0x00, 0x4B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x05, 0xCA, 0x1C, 0xC8, 0x50, 0xCB, 0xF3, 0xC8, 0x07, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x05, 0xEB, 0x7C, 0x11, 0x3B, 0x16, 0x5D, 0xB0, 0x05, 0x5B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x07, 0x04, 0x15, 0x4B, 0x20, 0x06, 0x61, 0xED, 0x0F, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x08, 0x09, 0x1D, 0xCD, 0x29, 0x13, 0x8F, 0x51, 0x04, 0x9B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x09, 0x74, 0x2D, 0x91, 0xF3, 0x94, 0x83, 0x30, 0x01, 0x4C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x09, 0xB1, 0xDB, 0xEF, 0xF3, 0x73, 0x7F, 0x85, 0x0F, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0A, 0x38, 0x0D, 0x64, 0x9A, 0x04, 0x23, 0x23, 0x0A, 0xA3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0A, 0x71, 0x0E, 0x07, 0x1F, 0x78, 0x52, 0x5E, 0x0C, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0A, 0x71, 0x0E, 0x07, 0x1F, 0x78, 0x52, 0x5E, 0x0D, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0A, 0x9A, 0x77, 0x59, 0xDD, 0xE8, 0x50, 0xE6, 0x03, 0x96, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0B, 0x77, 0x00, 0x93, 0xCD, 0x2F, 0x20, 0x8D, 0x09, 0x6E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0C, 0x1C, 0x7F, 0xB1, 0xDE, 0x2A, 0x8D, 0x5A, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0C, 0x6E, 0xB2, 0x9D, 0x64, 0xD4, 0x6C, 0xEC, 0x08, 0xE9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0C, 0xE5, 0x0F, 0xE7, 0x8C, 0x70, 0x1B, 0x65, 0x0A, 0xB4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0D, 0x03, 0x49, 0x7D, 0xB4, 0x36, 0x0D, 0x6B, 0x00, 0x94, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0D, 0xE8, 0xA0, 0xC1, 0x8E, 0x10, 0xAE, 0xAE, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x0F, 0x4C, 0x9B, 0xBF, 0x6E, 0xA5, 0x1C, 0x99, 0x0E, 0xA5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x10, 0xD1, 0x94, 0x42, 0xCD, 0x3B, 0xA3, 0xD7, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x11, 0xA8, 0x32, 0x00, 0x35, 0x50, 0x87, 0x97, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x11, 0xD2, 0x19, 0xA7, 0x89, 0x66, 0xC1, 0x92, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x11, 0xD2, 0xC8, 0xCC, 0x64, 0x53, 0x1A, 0x47, 0x0C, 0xEA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x12, 0x79, 0x89, 0x0E, 0xAF, 0xFD, 0x24, 0xC3, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x12, 0x94, 0xBB, 0x1D, 0x30, 0x76, 0xAE, 0xB6, 0x06, 0xA3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x12, 0xA3, 0x36, 0x34, 0x8B, 0xE8, 0xEF, 0x5D, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x12, 0xFC, 0x00, 0x24, 0xE2, 0xFB, 0x98, 0x8E, 0x01, 0x53, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x13, 0x3A, 0x38, 0x0C, 0x7B, 0x48, 0x0D, 0x94, 0x02, 0xD3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x13, 0xDD, 0x6F, 0x41, 0x5B, 0x6D, 0x19, 0xA2, 0x0F, 0x59, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x13, 0xEA, 0x38, 0x7B, 0xC8, 0x89, 0x4E, 0x92, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x14, 0x80, 0x72, 0xC6, 0xC2, 0xD1, 0xC1, 0x4C, 0x03, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x15, 0x7A, 0x87, 0xD1, 0x0C, 0xF7, 0x43, 0x27, 0x00, 0xCA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x16, 0x2F, 0x8A, 0x4C, 0xBE, 0x4B, 0x8E, 0xBB, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x18, 0x0E, 0x64, 0x8D, 0x2A, 0xDD, 0xFA, 0x4A, 0x0F, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x18, 0x93, 0x73, 0x72, 0xB5, 0x0F, 0x45, 0xF2, 0x0F, 0x6B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x18, 0xC5, 0x26, 0xC1, 0xA0, 0x69, 0xDB, 0x92, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x18, 0xE5, 0xBA, 0x7C, 0xAC, 0x65, 0x93, 0x26, 0x06, 0xE4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x18, 0xF3, 0x45, 0xB5, 0xAD, 0xDA, 0x18, 0x6E, 0x05, 0x5B, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x19, 0x13, 0xAE, 0x7A, 0x03, 0x64, 0xD9, 0x2C, 0x01, 0x4C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x19, 0x21, 0xA1, 0xDD, 0x98, 0xFE, 0x5E, 0x26, 0x0C, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x19, 0x59, 0x30, 0x0B, 0x02, 0x7D, 0xEC, 0x17, 0x06, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x19, 0xD3, 0x89, 0x53, 0x48, 0x1C, 0x36, 0xA5, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1A, 0xA5, 0x67, 0xDA, 0xF9, 0x60, 0x53, 0x45, 0x08, 0x9B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1B, 0x26, 0x63, 0x80, 0x49, 0x47, 0xAD, 0xF2, 0x04, 0x9C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1B, 0xB7, 0xE5, 0x4E, 0xFD, 0x38, 0x45, 0x77, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1B, 0xC6, 0x16, 0x60, 0x6B, 0x34, 0xFE, 0x2E, 0x0F, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1B, 0xD9, 0xC4, 0xDD, 0x32, 0xCB, 0x02, 0xBE, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1C, 0x59, 0x2D, 0x75, 0x35, 0xC2, 0x94, 0x9C, 0x0E, 0xB1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1C, 0x7B, 0x18, 0x3F, 0x91, 0x9B, 0x53, 0x6A, 0x0D, 0xEF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1C, 0x89, 0xA1, 0x15, 0x3E, 0x0A, 0x87, 0x14, 0x08, 0x9B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1C, 0xB5, 0xF8, 0x76, 0xF9, 0xC3, 0x91, 0x2C, 0x0A, 0xA0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1C, 0xC1, 0x28, 0x9D, 0x5E, 0x19, 0x12, 0x23, 0x03, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1E, 0x05, 0x4C, 0x97, 0x4C, 0xCB, 0x71, 0x54, 0x0E, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1E, 0x1D, 0xE5, 0x3A, 0x9B, 0x05, 0x16, 0x38, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1E, 0xE0, 0x79, 0xC8, 0x8B, 0xBE, 0xDA, 0x1A, 0x06, 0xA1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1F, 0x11, 0xE5, 0xDD, 0x10, 0x0F, 0x45, 0x77, 0x0F, 0x59, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1F, 0x2B, 0x18, 0x54, 0x9E, 0x55, 0x46, 0x85, 0x0D, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1F, 0x41, 0xAF, 0x19, 0xD9, 0x98, 0xB0, 0xAC, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1F, 0x4E, 0x51, 0xC4, 0xDB, 0x4D, 0xE6, 0x04, 0x04, 0xDA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1F, 0x75, 0x6C, 0xF3, 0xEA, 0xCF, 0xAE, 0xFC, 0x08, 0x9B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x1F, 0xEF, 0x25, 0x0D, 0xA9, 0xFD, 0x3C, 0x65, 0x0F, 0x59, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x21, 0x62, 0xC3, 0xAC, 0xF3, 0xB3, 0xCA, 0xFE, 0x02, 0xDB, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x21, 0x62, 0xC3, 0xAC, 0xF3, 0xB3, 0xCA, 0xFE, 0x01, 0x61, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x6A, 0x13, 0x68, 0x46, 0x12, 0xC0, 0x12, 0x00, 0x52, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x7A, 0x32, 0xD0, 0x84, 0x59, 0x73, 0x29, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x02, 0x53, 0x59, 0x3A, 0x55, 0x4F, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x24, 0x16, 0x4C, 0xED, 0xBB, 0x6B, 0x0E, 0x20, 0x06, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x24, 0xCC, 0xEA, 0xDE, 0x51, 0x48, 0xF3, 0xB2, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x26, 0x8A, 0x12, 0xDE, 0x34, 0xAF, 0xF6, 0xC6, 0x0B, 0x63, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x26, 0xC1, 0x88, 0x42, 0x06, 0xFD, 0x8F, 0x21, 0x02, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x27, 0x6C, 0x79, 0xD0, 0x73, 0x46, 0xC3, 0x47, 0x0E, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x28, 0x2D, 0x9C, 0x0D, 0xC2, 0x5A, 0xD7, 0x29, 0x02, 0xDB, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+0x29, 0xF4, 0x8E, 0xDD, 0xFA, 0x4A, 0x4E, 0x5D, 0x00, 0x52, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x29, 0xF4, 0x8E, 0xDD, 0xFA, 0x4A, 0x4E, 0x5D, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x2A, 0x7B, 0x90, 0x66, 0xD9, 0x4C, 0xC3, 0xB3, 0x00, 0xA6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x2A, 0x82, 0x81, 0x32, 0xE4, 0x97, 0x93, 0xAC, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x2A, 0xA5, 0x26, 0x84, 0xA6, 0xD4, 0xE0, 0x31, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x2D, 0x78, 0x16, 0x4B, 0x45, 0x2A, 0x87, 0xE4, 0x06, 0xA1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x2D, 0xF7, 0xCD, 0xBA, 0x0C, 0xBE, 0x8F, 0x3F, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x2E, 0xC7, 0xE1, 0xC6, 0x95, 0xC8, 0xBF, 0x86, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x2E, 0xEF, 0xBC, 0xAD, 0xEC, 0xB8, 0xFD, 0xAC, 0x0E, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x31, 0x26, 0xA8, 0x58, 0xCC, 0x88, 0x36, 0xC2, 0x00, 0xA6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x31, 0xC4, 0xAE, 0x0E, 0xB5, 0x7B, 0x80, 0xC7, 0x07, 0xE7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x31, 0xCD, 0xC9, 0x06, 0xB6, 0x50, 0xE3, 0xB9, 0x08, 0xE9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x32, 0x6A, 0x8E, 0x55, 0xB4, 0x71, 0xFC, 0x6D, 0x0A, 0xE4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x33, 0x5A, 0x0C, 0xA7, 0x8D, 0x9E, 0xEB, 0x75, 0x0D, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x33, 0xF3, 0x09, 0x8B, 0x65, 0xE3, 0x9F, 0xAA, 0x02, 0x9A, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+0x35, 0x19, 0xAE, 0xCA, 0x01, 0x54, 0xEE, 0x2E, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x35, 0x2A, 0x68, 0x52, 0x86, 0x52, 0xAD, 0xF7, 0x0D, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x35, 0x37, 0xA2, 0x3A, 0x5D, 0x46, 0x08, 0xE7, 0x00, 0x8B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x35, 0x49, 0xE4, 0x22, 0x4F, 0xEB, 0x10, 0xB6, 0x06, 0xEA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x35, 0x5B, 0xAA, 0x0D, 0x86, 0x20, 0xDF, 0x26, 0x07, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x35, 0xA4, 0x78, 0xEE, 0xAB, 0xC1, 0x35, 0x12, 0x01, 0x4E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x35, 0xC9, 0x62, 0xEA, 0xE4, 0xB4, 0x71, 0xF5, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x36, 0x67, 0x2A, 0x86, 0x66, 0xCE, 0x28, 0xEA, 0x0A, 0xA0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x36, 0xE4, 0xED, 0x7F, 0x6C, 0x88, 0x2B, 0xBF, 0x01, 0x95, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x37, 0x8E, 0x0B, 0xDE, 0x2F, 0x4B, 0x76, 0x4E, 0x07, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x38, 0x30, 0x66, 0x98, 0xAE, 0x46, 0xAB, 0xEF, 0x0C, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x39, 0x05, 0xE8, 0x76, 0xAF, 0xD6, 0x2D, 0x20, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x39, 0x56, 0xF2, 0x2A, 0xAC, 0xA5, 0xB8, 0xDA, 0x00, 0x8B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x39, 0x88, 0x51, 0x8F, 0xED, 0xD1, 0x13, 0xA8, 0x07, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x3C, 0x8B, 0xC9, 0x12, 0x11, 0x6F, 0x45, 0xCC, 0x08, 0xB0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x3C, 0xA1, 0x9E, 0xC8, 0x98, 0xD7, 0x80, 0xA0, 0x0D, 0x6D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x3D, 0x4D, 0x0B, 0x73, 0x3D, 0x25, 0xBB, 0x59, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x3D, 0xA4, 0x9C, 0x9B, 0x2C, 0xCA, 0xD0, 0x7E, 0x02, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x3E, 0x74, 0xFB, 0xDC, 0xF3, 0x52, 0xB4, 0x90, 0x05, 0x5B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x40, 0x2D, 0x0F, 0x6C, 0x6E, 0x66, 0xEE, 0x80, 0x06, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x40, 0x38, 0x3C, 0xE0, 0x2E, 0x3A, 0xA6, 0x34, 0x02, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x40, 0xE4, 0x20, 0xCD, 0x64, 0x82, 0xED, 0xD6, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x40, 0xFB, 0xBE, 0xAC, 0x6F, 0x9D, 0xB0, 0x42, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x41, 0x04, 0x4D, 0xAD, 0xC0, 0x55, 0xBA, 0x35, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x41, 0x67, 0x83, 0x3F, 0x37, 0x8A, 0xAC, 0xA0, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x41, 0xA0, 0xB1, 0xCD, 0xC9, 0x72, 0x5F, 0x90, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x41, 0xD7, 0xCE, 0x86, 0xD2, 0x12, 0xDE, 0xF9, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x43, 0x00, 0x6C, 0xC5, 0x93, 0x07, 0xBC, 0x30, 0x0C, 0xAA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x43, 0x54, 0x15, 0xD5, 0xEC, 0x86, 0xD0, 0xA4, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x43, 0xC7, 0xD7, 0x5B, 0x52, 0x9D, 0xA2, 0x0D, 0x0C, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x43, 0xD5, 0xC2, 0xCD, 0xB4, 0x97, 0x62, 0x38, 0x02, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x44, 0x19, 0xEE, 0x2B, 0xF3, 0x68, 0x43, 0xBA, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x44, 0xB5, 0x90, 0x21, 0xF9, 0xD3, 0xFD, 0x38, 0x06, 0xE2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x45, 0x14, 0x65, 0x2C, 0x31, 0xA1, 0xDF, 0xF9, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x45, 0x38, 0x2D, 0x7D, 0xC4, 0xFC, 0x6E, 0xAE, 0x0A, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x45, 0x64, 0xA5, 0x0A, 0x21, 0xFF, 0x1D, 0x42, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x47, 0x91, 0xFB, 0x9A, 0x51, 0x61, 0xB3, 0x5E, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x48, 0x3C, 0xE7, 0xA1, 0x68, 0x5A, 0xAE, 0x2E, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x48, 0x5A, 0xAB, 0x8C, 0x67, 0xB7, 0x99, 0xFA, 0x0F, 0x62, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x48, 0x75, 0x19, 0xE7, 0x2D, 0xB1, 0x7E, 0xAA, 0x0C, 0x61, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x48, 0xB0, 0x85, 0x74, 0x58, 0xF3, 0xB8, 0xA1, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x4B, 0x43, 0xC2, 0xC8, 0x44, 0x1D, 0xAD, 0x0E, 0x02, 0xDB, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x4B, 0xBA, 0x45, 0x04, 0xF3, 0x52, 0xF4, 0x6F, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x4B, 0xF0, 0x36, 0xB9, 0x3F, 0xCE, 0x69, 0x8B, 0x07, 0x23, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x4D, 0x91, 0xA0, 0x0D, 0xF9, 0xD2, 0xD7, 0x15, 0x00, 0x52, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x4D, 0xA7, 0xA3, 0x5F, 0x07, 0x9E, 0xD5, 0x25, 0x00, 0x94, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x4F, 0x3A, 0xEE, 0x2E, 0xD3, 0x1C, 0x35, 0x8F, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x4F, 0x45, 0x32, 0xAC, 0xE5, 0x23, 0xF8, 0xD0, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x4F, 0x89, 0x77, 0x0E, 0xE4, 0xCA, 0xE6, 0xCA, 0x0F, 0x62, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x4F, 0x8D, 0x34, 0xEC, 0x75, 0x66, 0x80, 0x6F, 0x02, 0x9A, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+0x4F, 0x8D, 0x34, 0xEC, 0x75, 0x66, 0x80, 0x6F, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x51, 0x10, 0x8A, 0xE9, 0x3A, 0x3D, 0x42, 0x72, 0x00, 0x9D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x51, 0x5E, 0x30, 0x20, 0x95, 0x49, 0xDB, 0xC4, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x51, 0xB4, 0x76, 0x89, 0x33, 0x1A, 0xA7, 0xD7, 0x0F, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x51, 0xCE, 0xCE, 0x5F, 0x3C, 0xA0, 0x76, 0xEB, 0x01, 0x4C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x51, 0xEA, 0x5B, 0x1D, 0x0B, 0x65, 0xF6, 0xEF, 0x0E, 0xA5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x56, 0x7A, 0xAB, 0xA8, 0x4C, 0x38, 0x8D, 0x02, 0xD3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x53, 0x67, 0x18, 0xB8, 0xA9, 0x3D, 0xAB, 0x1B, 0x01, 0x4C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x53, 0xE8, 0x51, 0x2C, 0x02, 0x2B, 0x72, 0x6E, 0x0E, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x54, 0x75, 0x40, 0xBB, 0x45, 0x07, 0x5B, 0xEF, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x54, 0x9F, 0x4D, 0xAB, 0x96, 0x65, 0xC9, 0x06, 0x0C, 0xEB, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x54, 0x9F, 0x4D, 0xAB, 0x96, 0x65, 0xC9, 0x06, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x54, 0x9F, 0x4D, 0xAB, 0x96, 0x65, 0xC9, 0x06, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x54, 0xFA, 0xF6, 0xF4, 0x32, 0x07, 0x30, 0x74, 0x02, 0xD3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x54, 0xFE, 0x50, 0xBD, 0xFE, 0x27, 0x47, 0x1C, 0x01, 0x53, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x55, 0x43, 0x86, 0x88, 0xCF, 0x10, 0xAF, 0x8A, 0x06, 0xA3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x55, 0x8A, 0xB3, 0xBA, 0xEA, 0xCF, 0x51, 0x98, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x55, 0x8A, 0xB3, 0xBA, 0xEA, 0xCF, 0x51, 0x98, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x55, 0xEB, 0x15, 0x63, 0x06, 0x8D, 0x3D, 0x8C, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x56, 0x07, 0x47, 0xD9, 0x02, 0x25, 0x6F, 0x3C, 0x0C, 0x69, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x56, 0x72, 0xF6, 0xFE, 0x55, 0x86, 0xF7, 0xE8, 0x09, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x56, 0xAB, 0xB7, 0xF5, 0x65, 0x15, 0x2D, 0x2C, 0x08, 0xDC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x56, 0xD8, 0x42, 0xD0, 0xA9, 0x0D, 0x41, 0x2C, 0x00, 0x4B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x56, 0xEA, 0x24, 0xA3, 0x79, 0xAC, 0x0F, 0xE8, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x57, 0x77, 0x0E, 0xEF, 0xB6, 0xCA, 0xE8, 0x53, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x58, 0x4A, 0x71, 0x7C, 0x6E, 0xB6, 0xE1, 0xD1, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x58, 0x62, 0x65, 0x9E, 0x96, 0x65, 0x55, 0xAB, 0x08, 0x9B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x58, 0xEC, 0x7E, 0xF2, 0xBB, 0x36, 0x6A, 0x0E, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x59, 0x19, 0x1D, 0x09, 0x46, 0xCA, 0x79, 0xE7, 0x00, 0xD1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x59, 0x65, 0x9F, 0x59, 0x8D, 0x44, 0x06, 0x2F, 0x03, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5A, 0x68, 0x75, 0xD8, 0x9F, 0x0A, 0xDB, 0xDA, 0x00, 0x94, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5A, 0xD9, 0x51, 0xAC, 0x4D, 0xE2, 0x8B, 0xE1, 0x06, 0x91, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5B, 0x03, 0xCA, 0xFB, 0x5F, 0xFC, 0x6B, 0xC2, 0x00, 0x9D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5B, 0x13, 0xAA, 0x4F, 0x43, 0x44, 0xF0, 0x5D, 0x0F, 0x3B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5B, 0x67, 0xB4, 0xD8, 0xD3, 0x25, 0x50, 0x7D, 0x07, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5B, 0xB4, 0x10, 0x39, 0xF9, 0x86, 0xDE, 0x22, 0x03, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5D, 0x92, 0x37, 0x53, 0xE1, 0xDF, 0xD0, 0x5D, 0x0E, 0xA5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5D, 0xAB, 0x16, 0xD6, 0xE6, 0xAC, 0xD4, 0xD4, 0x0C, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5E, 0xB0, 0x1C, 0x8B, 0xB0, 0xF4, 0x6F, 0x0F, 0x0A, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5F, 0x7F, 0x0F, 0x35, 0x81, 0x41, 0x90, 0x54, 0x01, 0x5A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x5F, 0xCB, 0x68, 0x91, 0xB4, 0x3F, 0x00, 0xCB, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x60, 0x25, 0x24, 0x6F, 0xFA, 0x3A, 0x26, 0x83, 0x07, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x60, 0x73, 0xF9, 0x3B, 0x0A, 0x26, 0x0C, 0x0C, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x61, 0x0A, 0x91, 0x41, 0xE4, 0x21, 0x74, 0xF1, 0x02, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x61, 0x4F, 0x0A, 0x3C, 0xF0, 0xAD, 0xEF, 0x44, 0x07, 0xB6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x61, 0x5C, 0xC4, 0xF2, 0xF1, 0x47, 0xEA, 0x91, 0x02, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x61, 0x62, 0xA1, 0x7C, 0xCE, 0x9D, 0xCF, 0x3F, 0x0C, 0xAA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x61, 0x66, 0x07, 0x2A, 0x76, 0x8C, 0x94, 0x92, 0x07, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x61, 0xB0, 0x32, 0x2E, 0x2D, 0xFF, 0xDA, 0x5E, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x61, 0xE7, 0x3F, 0xBA, 0xF1, 0x7C, 0xE9, 0xCF, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x62, 0x40, 0x5B, 0x64, 0xEE, 0x33, 0xBC, 0x39, 0x01, 0x5A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x62, 0x6A, 0xB4, 0x29, 0xE7, 0xF7, 0xA4, 0x8E, 0x03, 0x1C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+0x62, 0x6A, 0xB4, 0x29, 0xE7, 0xF7, 0xA4, 0x8E, 0x02, 0xDB, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+0x62, 0x6A, 0xB4, 0x29, 0xE7, 0xF7, 0xA4, 0x8E, 0x02, 0x9A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x62, 0x6A, 0xB4, 0x29, 0xE7, 0xF7, 0xA4, 0x8E, 0x01, 0x95, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x62, 0xD0, 0xB7, 0xC4, 0xA1, 0x63, 0x54, 0x7E, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x63, 0x07, 0x69, 0x50, 0x1E, 0x9E, 0xDB, 0xF8, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x63, 0x47, 0x50, 0xBE, 0xF1, 0xD5, 0xAB, 0x96, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x64, 0x31, 0x30, 0x02, 0xA6, 0xA2, 0x3D, 0xC4, 0x0E, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x64, 0x3B, 0xF3, 0xEF, 0x7C, 0xDF, 0x83, 0xC3, 0x09, 0x9F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x64, 0x4A, 0x9B, 0xE4, 0xDC, 0x25, 0x1B, 0x10, 0x0E, 0xF2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x64, 0x4D, 0xF3, 0x52, 0x7B, 0x91, 0x03, 0xDE, 0x06, 0xD1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x64, 0x55, 0xBC, 0x07, 0x50, 0x86, 0x84, 0x6F, 0x09, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x65, 0x2C, 0x1A, 0x45, 0xA8, 0xED, 0xA0, 0x2F, 0x02, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x65, 0x79, 0x7A, 0x6E, 0x22, 0x5A, 0x5A, 0x20, 0x02, 0x9A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x66, 0xA4, 0x42, 0x0D, 0xD6, 0x8C, 0x89, 0xEF, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x66, 0xA4, 0x42, 0x0D, 0xD6, 0x8C, 0x89, 0xEF, 0x07, 0x23, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x66, 0xA4, 0x42, 0x0D, 0xD6, 0x8C, 0x89, 0xEF, 0x07, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x67, 0xCE, 0xA4, 0xAC, 0x95, 0x4F, 0xD4, 0x1E, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x67, 0xE7, 0x8E, 0x1A, 0xDC, 0xB6, 0xE9, 0x8D, 0x06, 0xA3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x68, 0x06, 0xB3, 0x40, 0x76, 0x6E, 0xB9, 0x7F, 0x0A, 0xE4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x68, 0xDC, 0xDA, 0x82, 0x78, 0xA5, 0x8F, 0x78, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x69, 0xB6, 0x68, 0x4A, 0x7A, 0xDF, 0x84, 0xB1, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x6B, 0x8C, 0x7B, 0x35, 0xB0, 0x86, 0xF7, 0x74, 0x03, 0x55, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x6B, 0xE0, 0x6B, 0x3D, 0xFE, 0xD3, 0x15, 0xC0, 0x02, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x6B, 0xFE, 0xFC, 0x30, 0x34, 0x3E, 0x43, 0xD6, 0x01, 0x4E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x6E, 0xDD, 0x15, 0xE5, 0x39, 0x3F, 0x35, 0x04, 0x0F, 0xAD, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x6F, 0x12, 0xCB, 0x2E, 0x1D, 0x56, 0xF2, 0xD3, 0x0D, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x6F, 0x7B, 0xA2, 0xBA, 0x27, 0xC5, 0xDD, 0x78, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x6F, 0x88, 0x71, 0xDC, 0x7D, 0x8B, 0x95, 0x69, 0x0A, 0xE5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x70, 0x19, 0x56, 0x45, 0x55, 0x79, 0xC7, 0x6A, 0x03, 0xDF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x70, 0x78, 0x69, 0xCF, 0xD5, 0x98, 0xAD, 0xA6, 0x0E, 0xA8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x70, 0x92, 0x1B, 0x82, 0xB7, 0xBB, 0x9B, 0x18, 0x08, 0xD2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x72, 0x29, 0xB0, 0xE9, 0x55, 0x0C, 0x54, 0x53, 0x06, 0xE2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x73, 0x81, 0xFF, 0xBB, 0x4C, 0xCE, 0xCC, 0xDA, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x73, 0xC5, 0x2C, 0x41, 0xAF, 0xF3, 0x70, 0xDA, 0x0A, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x73, 0xFE, 0xE6, 0x85, 0x3E, 0x36, 0x33, 0x3B, 0x0E, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x74, 0x17, 0x0A, 0x3C, 0xF3, 0xDE, 0x75, 0x48, 0x0E, 0x6A, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+0x74, 0x17, 0x0A, 0x3C, 0xF3, 0xDE, 0x75, 0x48, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x74, 0xEC, 0x67, 0x5C, 0xE4, 0x51, 0x6F, 0x31, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x75, 0x18, 0x69, 0x35, 0xD6, 0x2B, 0x56, 0x91, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x76, 0xE4, 0x4A, 0x3E, 0xCD, 0x6D, 0x4F, 0x23, 0x02, 0x9A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x76, 0xFA, 0xB1, 0x69, 0x30, 0x3D, 0x4B, 0xA6, 0x08, 0x9B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x77, 0x46, 0x23, 0x99, 0xEE, 0xCE, 0x29, 0xC8, 0x0D, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x77, 0xC2, 0x3E, 0x3F, 0xAB, 0x62, 0x8C, 0x2B, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x79, 0x15, 0x57, 0xC6, 0x48, 0x15, 0x4F, 0xA1, 0x0D, 0x22, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7A, 0x8F, 0xD7, 0x86, 0x7C, 0x53, 0x31, 0x68, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7B, 0xBD, 0xFE, 0x3F, 0x36, 0x48, 0x22, 0x2D, 0x0C, 0x28, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x7B, 0xBD, 0xFE, 0x3F, 0x36, 0x48, 0x22, 0x2D, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7C, 0x29, 0xB3, 0xB5, 0xFB, 0x9B, 0x83, 0xFD, 0x00, 0x4B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7C, 0xCF, 0xB9, 0x45, 0x9D, 0x06, 0x7D, 0x18, 0x08, 0x58, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7C, 0xCF, 0xB9, 0x45, 0x9D, 0x06, 0x7D, 0x18, 0x08, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7D, 0x7B, 0x33, 0x41, 0xC6, 0xF4, 0x6A, 0x91, 0x0E, 0x9E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7E, 0x10, 0x5A, 0x61, 0x1B, 0x11, 0xD0, 0xF2, 0x0B, 0x5C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7E, 0xB1, 0x52, 0x33, 0x88, 0x2A, 0xDA, 0xA3, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7E, 0xDF, 0x49, 0x3C, 0x84, 0x54, 0x7A, 0xD3, 0x0C, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7E, 0xFF, 0x27, 0x4E, 0x81, 0x90, 0x46, 0x81, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x7F, 0x08, 0xC8, 0x04, 0x2B, 0x7A, 0x16, 0x9B, 0x08, 0xDA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x80, 0xA3, 0x91, 0xF5, 0xBE, 0x1F, 0x4B, 0xA9, 0x0F, 0xAD, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x81, 0x28, 0x56, 0x98, 0xC4, 0x11, 0x48, 0x71, 0x03, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x81, 0x66, 0x23, 0xE5, 0xCD, 0xAB, 0xD4, 0x53, 0x01, 0x53, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x81, 0xA1, 0x63, 0x2F, 0x02, 0xA2, 0xE3, 0xC7, 0x0B, 0x63, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x84, 0x27, 0x24, 0x90, 0x8C, 0x6E, 0x2C, 0x2B, 0x0F, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x84, 0x3C, 0xE7, 0x64, 0xB9, 0xB9, 0x92, 0x06, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x85, 0x17, 0xA0, 0xC8, 0x0E, 0xEC, 0x88, 0x02, 0x02, 0x9A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x85, 0x59, 0xA5, 0x9B, 0xFF, 0xEF, 0x19, 0xA3, 0x08, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x85, 0xAA, 0x8E, 0x56, 0x4A, 0x24, 0xFB, 0x39, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x86, 0xEB, 0x18, 0xA7, 0xB0, 0xD1, 0x3C, 0x10, 0x07, 0x56, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x87, 0x61, 0xD4, 0xD2, 0x1E, 0x1F, 0x56, 0xD4, 0x0F, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x87, 0xBF, 0x26, 0xE8, 0x87, 0x0A, 0xC2, 0x63, 0x03, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x87, 0xC5, 0x28, 0xB2, 0x17, 0x38, 0xB3, 0x71, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x87, 0xED, 0x81, 0x2D, 0x75, 0x4C, 0x73, 0x13, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x89, 0x43, 0x40, 0xB8, 0x45, 0xD0, 0xE7, 0x4F, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x89, 0x8B, 0x9A, 0x6E, 0x39, 0xEC, 0x84, 0xC8, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8B, 0xF4, 0x39, 0x72, 0x27, 0x98, 0x3B, 0xF4, 0x0C, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8B, 0xF4, 0x39, 0x72, 0x27, 0x98, 0x3B, 0xF4, 0x0F, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8C, 0x56, 0x8E, 0x6D, 0x09, 0x4F, 0xC2, 0x2A, 0x02, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8D, 0x72, 0x98, 0xAD, 0x69, 0x53, 0x2F, 0x49, 0x08, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8D, 0xC1, 0x00, 0x47, 0x73, 0x80, 0x99, 0x55, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8E, 0x8B, 0x51, 0xED, 0xD8, 0x46, 0xA9, 0x89, 0x0C, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8E, 0xD5, 0x1C, 0x0B, 0x86, 0xB9, 0x54, 0x40, 0x0E, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8F, 0x72, 0xDA, 0x17, 0x08, 0xFB, 0xEC, 0xC9, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8F, 0xA7, 0x39, 0x7E, 0xC0, 0x38, 0x86, 0x21, 0x0B, 0x63, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x8F, 0xE9, 0xC8, 0xFD, 0xF1, 0x49, 0xC0, 0xFE, 0x0E, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x91, 0x18, 0xCC, 0x91, 0xB2, 0x27, 0xDC, 0xBF, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x91, 0x3A, 0x8B, 0x16, 0x9D, 0xEE, 0x14, 0x11, 0x0F, 0xAD, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+0x91, 0x3A, 0x8B, 0x16, 0x9D, 0xEE, 0x14, 0x11, 0x0C, 0xE3, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+0x91, 0x3A, 0x8B, 0x16, 0x9D, 0xEE, 0x14, 0x11, 0x0D, 0x65, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x91, 0xCE, 0x7D, 0x51, 0xB3, 0xDC, 0x82, 0x7D, 0x03, 0x96, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x92, 0x10, 0xD9, 0xC4, 0x9B, 0x4D, 0xB7, 0x0E, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x92, 0xA3, 0xDC, 0xB8, 0xB2, 0x15, 0x37, 0xA4, 0x05, 0x5B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x92, 0xAD, 0x44, 0x29, 0x31, 0xE0, 0x08, 0x91, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x92, 0xF2, 0xCA, 0xBB, 0x85, 0xB5, 0x70, 0xA5, 0x0C, 0xEA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x93, 0x3C, 0x49, 0xFA, 0x14, 0x7D, 0x8F, 0x8C, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x93, 0xEF, 0x2A, 0xC5, 0x34, 0x85, 0xBD, 0x79, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x94, 0x21, 0xA6, 0xD1, 0xED, 0xE0, 0xED, 0xC6, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x94, 0x71, 0x2D, 0x1C, 0xD7, 0xC7, 0x12, 0xE0, 0x0E, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x94, 0x9E, 0x9B, 0x93, 0xEF, 0x56, 0x64, 0x81, 0x0D, 0x2C, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x94, 0x9E, 0x9B, 0x93, 0xEF, 0x56, 0x64, 0x81, 0x0C, 0xA2, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x94, 0x9E, 0x9B, 0x93, 0xEF, 0x56, 0x64, 0x81, 0x0D, 0xAE, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x94, 0xDA, 0x07, 0x1B, 0xA7, 0x11, 0x70, 0xD8, 0x03, 0x96, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x95, 0x47, 0x89, 0x43, 0xD7, 0x46, 0xFD, 0xF5, 0x0D, 0x24, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+0x95, 0x47, 0x89, 0x43, 0xD7, 0x46, 0xFD, 0xF5, 0x0C, 0xA2, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+0x95, 0x47, 0x89, 0x43, 0xD7, 0x46, 0xFD, 0xF5, 0x0D, 0x2C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+0x95, 0x47, 0x89, 0x43, 0xD7, 0x46, 0xFD, 0xF5, 0x0C, 0xAA, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x95, 0x47, 0x89, 0x43, 0xD7, 0x46, 0xFD, 0xF5, 0x0C, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x95, 0x47, 0x89, 0x43, 0xD7, 0x46, 0xFD, 0xF5, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x95, 0x47, 0x89, 0x43, 0xD7, 0x46, 0xFD, 0xF5, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x95, 0x75, 0x10, 0x46, 0x7A, 0x09, 0xA5, 0xDF, 0x0B, 0x63, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x96, 0x1F, 0x18, 0x24, 0xFC, 0xDA, 0x19, 0x05, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x97, 0x33, 0x9A, 0xB4, 0x23, 0x78, 0x9D, 0x75, 0x02, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x97, 0x80, 0x66, 0xBF, 0xB7, 0xE6, 0x9B, 0x0D, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x97, 0xE9, 0x97, 0xFE, 0x22, 0x94, 0x4C, 0xD8, 0x0B, 0x5C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x98, 0x80, 0x9D, 0x4C, 0x47, 0x5F, 0xDF, 0x90, 0x0F, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x99, 0x34, 0x6C, 0x97, 0xC1, 0x01, 0xEC, 0x76, 0x0F, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9A, 0x20, 0x99, 0x6B, 0xB7, 0x90, 0x40, 0x72, 0x02, 0x9A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9A, 0x5B, 0x2E, 0x4B, 0xFA, 0x02, 0x63, 0x30, 0x0D, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9B, 0x41, 0xD3, 0x12, 0x15, 0xDC, 0x98, 0x13, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9B, 0xB0, 0xB1, 0x30, 0xDE, 0x29, 0xEF, 0x29, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9B, 0xC5, 0xB8, 0x0B, 0x4D, 0x83, 0xF9, 0xC4, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9B, 0xCC, 0xF9, 0x0D, 0x7B, 0x24, 0x03, 0x43, 0x08, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9C, 0xBE, 0xBE, 0x77, 0xD0, 0x6A, 0x5C, 0x76, 0x0C, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9D, 0x04, 0x27, 0x4E, 0x00, 0x5C, 0xEC, 0xCB, 0x02, 0xD2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9D, 0x2B, 0x91, 0x7B, 0x01, 0x16, 0x85, 0x41, 0x06, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9D, 0xEF, 0xC6, 0x76, 0x3D, 0xF8, 0xC2, 0xD1, 0x0D, 0xEF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9E, 0x61, 0xCE, 0xB5, 0x7A, 0x82, 0x54, 0x44, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9F, 0x98, 0xE0, 0xC8, 0x5B, 0x4A, 0xE4, 0x8F, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x9F, 0xB3, 0xF2, 0x57, 0x28, 0xDD, 0x2E, 0x4B, 0x0C, 0x69, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA0, 0x68, 0xF6, 0xC6, 0x6C, 0xDC, 0xEE, 0xAD, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA0, 0xC1, 0xDB, 0x72, 0x08, 0xC6, 0x65, 0x0E, 0x08, 0xDC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA1, 0x21, 0x1F, 0x69, 0x08, 0x8E, 0x2D, 0xA1, 0x0E, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA1, 0x38, 0xC9, 0xD6, 0xE2, 0xBB, 0x43, 0x15, 0x01, 0x53, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA1, 0x6B, 0xB9, 0x85, 0x7E, 0xD0, 0xFD, 0xAF, 0x06, 0xA3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA1, 0x86, 0x8A, 0x9F, 0x55, 0xA4, 0x74, 0x57, 0x03, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA1, 0xAB, 0x3D, 0xD3, 0x4B, 0x05, 0x38, 0xFF, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA2, 0x01, 0xA6, 0x70, 0xE7, 0x89, 0x8F, 0xFE, 0x06, 0xA1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA2, 0x5A, 0xAA, 0x53, 0x03, 0x94, 0x5A, 0x73, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA3, 0x56, 0xFA, 0x46, 0x5D, 0x18, 0xD6, 0x8E, 0x0F, 0xB4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA3, 0x9A, 0x85, 0x85, 0x5A, 0x5A, 0xE1, 0x99, 0x0F, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA3, 0xB2, 0xE8, 0xFF, 0x90, 0x82, 0x19, 0xC3, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA4, 0xE7, 0xDA, 0x91, 0x26, 0x29, 0x8B, 0x75, 0x03, 0x55, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA5, 0x22, 0xC9, 0xC1, 0x2F, 0x9F, 0x47, 0x77, 0x01, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+0xA5, 0x22, 0xC9, 0xC1, 0x2F, 0x9F, 0x47, 0x77, 0x01, 0x5A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0xA5, 0x22, 0xC9, 0xC1, 0x2F, 0x9F, 0x47, 0x77, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA5, 0x22, 0xC9, 0xC1, 0x2F, 0x9F, 0x47, 0x77, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA5, 0x5B, 0x96, 0xFB, 0x1B, 0xE0, 0xF6, 0xB7, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA5, 0x9B, 0x23, 0x46, 0x4C, 0x1F, 0x40, 0x9D, 0x03, 0x5D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA5, 0xBA, 0x1B, 0x9C, 0x03, 0xB5, 0xBF, 0x77, 0x08, 0x9B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA6, 0x16, 0x60, 0x44, 0xD4, 0x6C, 0xE0, 0xED, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA6, 0x4A, 0x8E, 0xAC, 0x49, 0xF5, 0x1C, 0x20, 0x0C, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA6, 0xA7, 0x79, 0xDC, 0x60, 0xB5, 0x4C, 0x45, 0x0C, 0x61, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA7, 0xA6, 0xEF, 0xF1, 0x2E, 0x0D, 0x37, 0x9C, 0x02, 0x9A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xA7, 0xF5, 0x28, 0x5C, 0x36, 0xB1, 0x7E, 0x7E, 0x0E, 0xED, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAA, 0x3C, 0x64, 0xB5, 0x43, 0x0C, 0x33, 0x7C, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAA, 0x9C, 0x03, 0x64, 0x3C, 0xE4, 0x0B, 0x59, 0x00, 0xA6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAA, 0xCE, 0xDD, 0x9F, 0xEC, 0x9D, 0xE7, 0x02, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAB, 0x09, 0x2C, 0x68, 0xED, 0x98, 0xD2, 0x6E, 0x00, 0xA6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAB, 0x32, 0x5A, 0xA1, 0xEC, 0x7C, 0xE5, 0x34, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAB, 0x62, 0xF6, 0x09, 0xB7, 0xDE, 0x56, 0x69, 0x02, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAB, 0xBC, 0x41, 0xCD, 0xC1, 0x2F, 0xDA, 0x91, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAD, 0x9E, 0xB8, 0x57, 0xE0, 0x5C, 0x62, 0xA8, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAD, 0xE0, 0x23, 0xB4, 0xCA, 0xED, 0xDF, 0x90, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAD, 0xF5, 0x0F, 0x99, 0x9C, 0xB1, 0x18, 0x87, 0x03, 0x96, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAE, 0x49, 0x18, 0x07, 0xF8, 0x4A, 0x9A, 0x5C, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAE, 0xB9, 0x43, 0xFD, 0xA6, 0xEF, 0x63, 0x99, 0x0D, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAE, 0xD5, 0xFD, 0x2C, 0x26, 0x27, 0x06, 0xE1, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAF, 0xC9, 0x23, 0x7A, 0x9E, 0xF4, 0xC5, 0x81, 0x0C, 0x61, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xAF, 0xC9, 0x23, 0x7A, 0x9E, 0xF4, 0xC5, 0x81, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB1, 0x23, 0xBA, 0xE6, 0x30, 0x84, 0xC5, 0x29, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB1, 0x46, 0x3A, 0xC6, 0xD6, 0x67, 0x3E, 0x33, 0x03, 0x96, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB2, 0x32, 0x3D, 0xE2, 0x59, 0x54, 0xB6, 0x0F, 0x0B, 0x63, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB2, 0x37, 0xBC, 0x00, 0x4D, 0x93, 0x1C, 0x3F, 0x09, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB2, 0x98, 0x9E, 0x53, 0xFE, 0xF6, 0x0B, 0x40, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB2, 0xA5, 0xBE, 0xBE, 0x5D, 0x3B, 0x9C, 0xD6, 0x01, 0x4E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB3, 0xCE, 0x36, 0x24, 0x0D, 0xCF, 0xA1, 0x1C, 0x06, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB3, 0xE5, 0x74, 0x39, 0x7D, 0x22, 0x66, 0x41, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB6, 0x1D, 0xF0, 0xB0, 0x0B, 0xD2, 0x41, 0x47, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB6, 0x34, 0x9A, 0x35, 0x5B, 0xE6, 0xAD, 0xDD, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB6, 0xB6, 0x3F, 0x64, 0x5C, 0x32, 0xB8, 0xF6, 0x0F, 0xB4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB7, 0x49, 0xD1, 0x14, 0x89, 0x71, 0xF3, 0x25, 0x07, 0x2B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB8, 0x13, 0xFD, 0xF7, 0x3E, 0x04, 0x1D, 0x91, 0x0C, 0xE3, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+0xB8, 0x2C, 0x5B, 0x05, 0x67, 0x03, 0xEC, 0x36, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB8, 0x46, 0x8A, 0x4C, 0x14, 0xE0, 0xBD, 0xAE, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB8, 0x94, 0x19, 0x1E, 0xF7, 0x82, 0xA8, 0xCF, 0x08, 0xDA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB9, 0x3D, 0x16, 0x63, 0xC1, 0x23, 0xA6, 0xC3, 0x00, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB9, 0x50, 0x31, 0xE0, 0x34, 0x3E, 0x7D, 0xF3, 0x0C, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xB9, 0xD6, 0x3D, 0xEB, 0x2F, 0xA1, 0xB9, 0x28, 0x02, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBA, 0x0C, 0xA4, 0x5C, 0x58, 0x64, 0x50, 0x29, 0x02, 0xD3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBA, 0x1F, 0x97, 0x7F, 0x3D, 0x6E, 0xD4, 0x89, 0x01, 0x4E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBA, 0x24, 0xDF, 0xA9, 0xD7, 0x25, 0x07, 0x10, 0x09, 0x2D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBC, 0x38, 0x87, 0xBB, 0xED, 0xAB, 0x52, 0x97, 0x0E, 0xF2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBC, 0x3B, 0x08, 0x4F, 0x14, 0x4D, 0x29, 0xA9, 0x05, 0x5B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBC, 0xD3, 0xC3, 0x8D, 0x28, 0x6C, 0x3C, 0x13, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBC, 0xDF, 0xEC, 0x59, 0x3E, 0xFE, 0x37, 0xEB, 0x00, 0x4B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBD, 0xE3, 0x2E, 0x68, 0xBF, 0xB8, 0x03, 0xA7, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBE, 0x00, 0xBF, 0x50, 0x97, 0x93, 0xD0, 0x09, 0x01, 0x53, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBE, 0x22, 0x5C, 0x5E, 0x98, 0x96, 0x3A, 0x71, 0x0E, 0xA8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBF, 0x66, 0xEA, 0xF7, 0x5D, 0xC6, 0x9F, 0xC4, 0x02, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xBF, 0xD7, 0x3E, 0x68, 0x38, 0xBD, 0xBC, 0x41, 0x01, 0x53, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC0, 0x37, 0xCD, 0xE8, 0x83, 0xDA, 0x5A, 0x95, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC0, 0x68, 0x1B, 0x7D, 0x78, 0x6C, 0xC3, 0x5F, 0x01, 0x4E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC1, 0x8E, 0xD2, 0x23, 0x09, 0xD8, 0x20, 0x2D, 0x01, 0x61, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC2, 0x14, 0xE8, 0x76, 0xA8, 0xEF, 0xA1, 0x0B, 0x0E, 0xA8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC2, 0x34, 0x93, 0xA0, 0x31, 0xE5, 0xB7, 0x55, 0x03, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC2, 0x50, 0x76, 0xB6, 0x21, 0x49, 0x15, 0x5E, 0x01, 0x95, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+0xC2, 0xAD, 0xE5, 0xE5, 0x9F, 0x71, 0x25, 0x07, 0x01, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC3, 0x2E, 0xBD, 0x27, 0x09, 0x71, 0x62, 0x74, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC3, 0xAF, 0x85, 0xB7, 0x8E, 0x81, 0x1F, 0x29, 0x0F, 0x59, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC3, 0xAF, 0x85, 0xB7, 0x8E, 0x81, 0x1F, 0x29, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC4, 0x01, 0xAA, 0x95, 0x65, 0xFD, 0x15, 0xF4, 0x0F, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC5, 0x07, 0x26, 0x31, 0x6D, 0x42, 0x5F, 0xA5, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC5, 0x07, 0x26, 0x31, 0x6D, 0x42, 0x5F, 0xA5, 0x0D, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC5, 0x07, 0x26, 0x31, 0x6D, 0x42, 0x5F, 0xA5, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC5, 0x49, 0x90, 0x95, 0xD0, 0xBB, 0x96, 0x3E, 0x00, 0xCA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC5, 0x49, 0x90, 0x95, 0xD0, 0xBB, 0x96, 0x3E, 0x03, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC7, 0x17, 0xE5, 0xF1, 0x90, 0x3F, 0x89, 0xD7, 0x0C, 0xAA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC7, 0x1F, 0x02, 0x5B, 0x3C, 0xE3, 0x96, 0x84, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC7, 0x8E, 0x38, 0x15, 0x17, 0x65, 0xDC, 0x4E, 0x0E, 0xF3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC9, 0x37, 0x7E, 0xAD, 0xCC, 0x33, 0xC8, 0x6D, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xC9, 0xF9, 0x6E, 0x82, 0xF8, 0x4C, 0xB6, 0x16, 0x02, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xCA, 0x15, 0x58, 0x1F, 0x80, 0xA8, 0x04, 0xC3, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xCA, 0x2A, 0x30, 0x3A, 0x22, 0x55, 0x31, 0xA4, 0x02, 0x51, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xCA, 0x7C, 0x96, 0x0A, 0x2C, 0x0C, 0x57, 0x42, 0x02, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xCA, 0xC4, 0x2C, 0xD6, 0xF6, 0x6F, 0x3C, 0xCF, 0x06, 0x93, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xCA, 0xEC, 0x07, 0x20, 0xEE, 0x8A, 0x30, 0x81, 0x00, 0x94, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xCC, 0x14, 0x97, 0x78, 0xC1, 0x32, 0xBE, 0xBF, 0x00, 0x52, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0xCC, 0x23, 0x04, 0xE7, 0xD8, 0xFE, 0x3A, 0xC8, 0x0C, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD0, 0x2A, 0x0E, 0xBD, 0x4F, 0x37, 0xCC, 0xAD, 0x0F, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD0, 0x64, 0xDE, 0xFC, 0xDD, 0x10, 0x31, 0x4A, 0x05, 0x5B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD1, 0x40, 0x37, 0x9E, 0x51, 0x22, 0x53, 0x31, 0x01, 0x4C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD1, 0x75, 0x4B, 0x70, 0x04, 0x24, 0x75, 0x4B, 0x03, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD1, 0x89, 0xD8, 0x26, 0x47, 0xD8, 0xB4, 0x08, 0x0C, 0x69, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD2, 0x23, 0xF6, 0x48, 0xF1, 0x3C, 0x32, 0x54, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD2, 0x32, 0xFC, 0x93, 0x89, 0xAA, 0x7A, 0x61, 0x08, 0x9B, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0xD2, 0x5B, 0x61, 0xF6, 0x4B, 0xDB, 0x34, 0x64, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD2, 0x70, 0x1B, 0xE2, 0xC8, 0x54, 0x63, 0x88, 0x0F, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD2, 0xA2, 0x2D, 0xD3, 0x85, 0x6F, 0xA4, 0xE3, 0x0B, 0x63, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD3, 0x7E, 0x35, 0x99, 0x09, 0xFC, 0xE1, 0xCA, 0x00, 0x94, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD3, 0xCB, 0xD6, 0xF4, 0xBF, 0xCD, 0xAD, 0x56, 0x02, 0xD3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD4, 0x2D, 0xC8, 0xA3, 0x35, 0x60, 0xC4, 0x98, 0x0C, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD4, 0x2D, 0xC8, 0xA3, 0x35, 0x60, 0xC4, 0x98, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD4, 0x97, 0xCB, 0x4E, 0x73, 0xF4, 0x34, 0x68, 0x0E, 0xE9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD4, 0xC6, 0xAF, 0x4B, 0x55, 0xA2, 0x03, 0xBC, 0x0B, 0x23, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD5, 0xB4, 0xD5, 0xD5, 0xCE, 0xBF, 0xCC, 0xF3, 0x05, 0x5B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD6, 0x48, 0x18, 0x33, 0x1A, 0x7A, 0xE5, 0x1B, 0x01, 0x5A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD6, 0x74, 0x67, 0xAA, 0xD0, 0x47, 0xC6, 0xEF, 0x00, 0xDE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD6, 0xDE, 0x88, 0xA1, 0x0B, 0xD3, 0xFE, 0xF3, 0x05, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD7, 0x2D, 0x5A, 0xCC, 0x5C, 0x2C, 0x6E, 0xBE, 0x01, 0x5A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD8, 0x46, 0x55, 0x1B, 0x84, 0x5E, 0xBA, 0xD3, 0x00, 0x9D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD8, 0xD2, 0x80, 0xDE, 0x07, 0xB5, 0x58, 0x50, 0x04, 0xDA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD9, 0x3C, 0xDE, 0x30, 0xF5, 0x52, 0xBD, 0x6E, 0x0E, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD9, 0x4F, 0x35, 0x8A, 0x99, 0xFF, 0x64, 0xFD, 0x0B, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD9, 0x54, 0x4A, 0x77, 0xD3, 0xAC, 0x24, 0xA8, 0x00, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xD9, 0x74, 0x7C, 0xA2, 0xCE, 0x45, 0xA9, 0x96, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDA, 0x01, 0x00, 0x35, 0x73, 0xE8, 0x36, 0x4D, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDA, 0x1F, 0x15, 0x82, 0x13, 0xA0, 0x13, 0xF5, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDB, 0x55, 0x36, 0x82, 0xB6, 0x96, 0x48, 0x0C, 0x03, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDB, 0x7D, 0xA3, 0x32, 0xB8, 0x43, 0x67, 0xB6, 0x0C, 0xE3, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+0xDC, 0x60, 0x84, 0x0F, 0xF1, 0x3D, 0x5E, 0x2D, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDD, 0x17, 0x6E, 0x3A, 0xA5, 0xB9, 0x51, 0x20, 0x0C, 0x69, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDD, 0xFB, 0xC1, 0x4A, 0x8F, 0xED, 0x4E, 0xE8, 0x0E, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDE, 0x41, 0xCF, 0xCA, 0xA4, 0xF9, 0xD9, 0x69, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDE, 0x8D, 0x70, 0xAD, 0x39, 0xFF, 0x79, 0x80, 0x0E, 0xA5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDE, 0xF4, 0xA2, 0x6F, 0x88, 0x4E, 0xD1, 0x96, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDF, 0x2A, 0x4E, 0x2A, 0xFB, 0x2F, 0x96, 0xE5, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDF, 0x61, 0x8D, 0x63, 0x59, 0x32, 0x08, 0xA1, 0x0C, 0xEB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDF, 0xB6, 0x10, 0x2C, 0x96, 0x56, 0xDA, 0x44, 0x08, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xDF, 0xC0, 0x85, 0xD4, 0xD7, 0x51, 0x6B, 0x23, 0x01, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE0, 0x06, 0x25, 0x41, 0x96, 0xC9, 0xE2, 0xE4, 0x0B, 0x23, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE0, 0x96, 0xDE, 0xCF, 0x9C, 0x19, 0xBE, 0x5C, 0x00, 0xCB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE0, 0xBA, 0x07, 0x44, 0xB2, 0x90, 0xFE, 0x0D, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE1, 0xAE, 0x36, 0xEF, 0x23, 0x03, 0xB6, 0x67, 0x05, 0x5B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE2, 0x70, 0x43, 0xEF, 0xE4, 0xF5, 0xA6, 0x9D, 0x0F, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE2, 0xA1, 0x7D, 0xDF, 0xA1, 0x23, 0x2A, 0x17, 0x01, 0x5A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE2, 0xD8, 0x31, 0x21, 0x44, 0xF2, 0xA9, 0x10, 0x01, 0x95, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+0xE2, 0xD8, 0x31, 0x21, 0x44, 0xF2, 0xA9, 0x10, 0x02, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE3, 0x01, 0x23, 0xF1, 0x7C, 0xE2, 0x30, 0x64, 0x06, 0xE3, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0xE3, 0x4E, 0x86, 0x78, 0x3C, 0x56, 0xA0, 0x12, 0x0E, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE3, 0x69, 0x4A, 0x69, 0xBF, 0xCC, 0xB3, 0x5A, 0x0C, 0xAA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE3, 0xAD, 0x4F, 0xAC, 0xF2, 0x60, 0x98, 0x37, 0x0A, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE3, 0xCD, 0xCF, 0x30, 0x38, 0x58, 0x31, 0x8E, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE3, 0xCF, 0x25, 0xE8, 0xF3, 0xB4, 0x82, 0xC4, 0x03, 0x96, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE4, 0x0F, 0x8A, 0x17, 0x98, 0x58, 0x2C, 0xF3, 0x08, 0xDA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE4, 0x0F, 0x8A, 0x17, 0x98, 0x58, 0x2C, 0xF3, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE4, 0xA3, 0xF1, 0x98, 0x87, 0xC9, 0xDB, 0x69, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE5, 0xAF, 0x2D, 0xA6, 0xD0, 0xBC, 0x12, 0x78, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE6, 0xE2, 0x25, 0xBE, 0xAD, 0x73, 0xBE, 0xD2, 0x0E, 0xA5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE7, 0xAD, 0x27, 0x97, 0xD9, 0xF2, 0x96, 0xF9, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE8, 0x21, 0x14, 0x6F, 0x30, 0x77, 0x81, 0xB4, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE8, 0xE0, 0xA6, 0xF4, 0xFF, 0xD3, 0x7B, 0x44, 0x0C, 0xAA, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0xE8, 0xE0, 0xA6, 0xF4, 0xFF, 0xD3, 0x7B, 0x44, 0x0D, 0x2C, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0xE8, 0xE0, 0xA6, 0xF4, 0xFF, 0xD3, 0x7B, 0x44, 0x08, 0xDA, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE8, 0xE2, 0x9A, 0x88, 0xAF, 0xD7, 0xE9, 0x35, 0x0C, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE9, 0x77, 0x02, 0x80, 0x7A, 0x3A, 0x2B, 0xAB, 0x07, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xE9, 0xF5, 0x58, 0xE5, 0x83, 0x79, 0xE3, 0xDA, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xEB, 0xEC, 0x15, 0xF7, 0x6E, 0xA8, 0x4B, 0x58, 0x0C, 0xE3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xEC, 0x25, 0x53, 0xCC, 0x90, 0xD6, 0x1E, 0x63, 0x02, 0xDB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xEC, 0xAB, 0x43, 0x70, 0xBD, 0x45, 0x86, 0x86, 0x0D, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xED, 0x27, 0x70, 0x43, 0x30, 0x54, 0x07, 0xD4, 0x0F, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xED, 0x4C, 0x0F, 0x07, 0x24, 0x94, 0xE5, 0xD0, 0x04, 0xDC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xEE, 0x0D, 0x0D, 0xF6, 0xBC, 0x21, 0x81, 0xC7, 0x0D, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xEE, 0x19, 0xC5, 0x5E, 0x2B, 0xE1, 0x06, 0xB7, 0x06, 0xD2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xEF, 0x08, 0x1A, 0x79, 0x4E, 0x2F, 0x03, 0x67, 0x06, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xEF, 0x90, 0xDD, 0xF2, 0x04, 0x99, 0xB6, 0x00, 0x08, 0x68, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xEF, 0x91, 0x17, 0xA2, 0x24, 0x00, 0xA2, 0xBC, 0x0F, 0x59, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0xF0, 0x18, 0x76, 0x2F, 0xF7, 0x93, 0xA0, 0x32, 0x0E, 0xB1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF2, 0xBB, 0x7D, 0x42, 0xD2, 0xE5, 0x84, 0xE8, 0x0B, 0xB7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF2, 0xF9, 0xC2, 0x6E, 0x9C, 0x54, 0x5D, 0xF8, 0x06, 0xA3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF3, 0x4F, 0xF1, 0x2D, 0x58, 0x18, 0x41, 0x16, 0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF4, 0xB5, 0x42, 0xFA, 0xD7, 0x22, 0xD6, 0x9F, 0x08, 0x9B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF5, 0x13, 0x69, 0x5F, 0x3E, 0x11, 0xB0, 0xB2, 0x0F, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF5, 0xBE, 0x8C, 0x72, 0x4E, 0xC7, 0x63, 0xE8, 0x01, 0x4E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF6, 0x33, 0x74, 0x69, 0xCA, 0x0A, 0xBB, 0xCF, 0x0F, 0x62, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF6, 0x33, 0x74, 0x69, 0xCA, 0x0A, 0xBB, 0xCF, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF6, 0x61, 0xD6, 0xCB, 0xFC, 0xCC, 0xD5, 0x20, 0x08, 0x9A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF6, 0x91, 0x75, 0x6A, 0xA3, 0xAB, 0x9C, 0xFC, 0x0D, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF6, 0xA3, 0x5C, 0x47, 0xB6, 0x15, 0x8D, 0xC0, 0x0F, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF6, 0xBC, 0xC2, 0x26, 0xBD, 0x0A, 0xD0, 0x54, 0x01, 0x95, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF6, 0xD0, 0x50, 0x4A, 0xE6, 0x4E, 0xDE, 0xB3, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF7, 0xA9, 0xF8, 0xBC, 0x3F, 0xF3, 0xBE, 0x20, 0x0E, 0x9E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF7, 0xC8, 0xDA, 0x58, 0x83, 0x4C, 0x0C, 0x12, 0x0D, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF8, 0x0E, 0x1A, 0xD9, 0xC3, 0xB0, 0xD5, 0x38, 0x0E, 0xB1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF8, 0xED, 0x62, 0x75, 0x9B, 0x4F, 0xB8, 0x2C, 0x07, 0x23, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF9, 0x7D, 0x92, 0xA4, 0x01, 0x8B, 0x55, 0x99, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF9, 0xAE, 0xBC, 0x08, 0x50, 0xE0, 0x8B, 0x32, 0x06, 0xE1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xF9, 0xCA, 0x48, 0x66, 0xA7, 0xF1, 0xE0, 0x79, 0x0F, 0xAD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xFA, 0x36, 0x37, 0xEB, 0xFB, 0x5A, 0xDB, 0x91, 0x0E, 0xF3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xFB, 0xCF, 0xB8, 0xF6, 0x54, 0x0F, 0xD8, 0xD3, 0x08, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xFC, 0x31, 0x3B, 0x6F, 0x17, 0x49, 0xC7, 0x12, 0x0E, 0xAC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xFE, 0xB8, 0x9F, 0xFE, 0xF4, 0x09, 0x1E, 0x31, 0x0C, 0xA2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xEF, 0xBB, 0x32, 0x7C, 0xE0, 0x17, 0xFA, 0x08, 0x6A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFD, 0xF4, 0x52, 0xEA, 0x64, 0xAF, 0xA4, 0x0E, 0xB3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef PIECESQUARE_H
+#define PIECESQUARE_H
+
+#include <stdint.h>
+#include <array>
+
+// Material values in centipawns, indexed by piece type (CHESS_PAWN .. CHESS_KING).
+#define CHESS_VALUE_PAWN 100
+#define CHESS_VALUE_BISHOP 330
+#define CHESS_VALUE_KNIGHT 320
+#define CHESS_VALUE_ROOK 500
+#define CHESS_VALUE_QUEEN 900
+
+// Game phase of the full starting material: minor pieces count 1, rooks 2 and
+// queens 4. The evaluation blends the middlegame and endgame scores by how much
+// of it is left.
+#define CHESS_PHASE_TOTAL 24
+
+/**
+ * @brief A middlegame and an endgame score packed in one integer, so both are
+ * updated with a single addition. The endgame half sits in the upper 16 bits.
+ */
+typedef int32_t EvalScore;
+
+constexpr EvalScore makeEvalScore(int middlegame, int endgame) {
+    return (EvalScore)((uint32_t)endgame << 16) + middlegame;
+}
+
+inline int evalMiddlegame(EvalScore score) { return (int16_t)(uint16_t)(uint32_t)score; }
+inline int evalEndgame(EvalScore score) { return (int16_t)(uint16_t)((uint32_t)(score + 0x8000) >> 16); }
+
+#include "pieceSquareData.h"
+
+// Material and piece-square bonuses. pieceSquareData.h holds them for both game
+// phases: material by piece type, and piece-square tables written for white and
+// laid out like the board (a8 first, h1 last); black uses them mirrored top to
+// bottom (square ^ 56). tools/texel_tune.cpp tunes them and rewrites that file.
+// ChessPosition adds and removes the combined per-piece scores in setPiece(), the
+// same way it keeps its Zobrist key, so the evaluation reads a running total
+// instead of scanning the board.
+namespace chessEvalTables {
+
+// Nominal values for move ordering and material counts, independent of tuning.
+constexpr int16_t pieceValue[7] = {0, CHESS_VALUE_PAWN, CHESS_VALUE_BISHOP, CHESS_VALUE_KNIGHT,
+                                   CHESS_VALUE_ROOK, CHESS_VALUE_QUEEN, 0};
+// Share of CHESS_PHASE_TOTAL each piece type stands for.
+constexpr uint8_t phaseWeight[7] = {0, 0, 1, 1, 2, 4, 0};
+
+// Packed score of every (piece, square) pair from white's point of view: material
+// plus the bonus, negated for black pieces.
+constexpr std::array<EvalScore, 12 * 64> pieceSquareScoreTable() {
+    std::array<EvalScore, 12 * 64> table = {};
+    for (int index = 0; index < 12; index++) {
+        const int type = index % 6 + 1;
+        const int sign = index < 6 ? 1 : -1;
+        for (int square = 0; square < 64; square++) {
+            const int tableSquare = sign > 0 ? square : square ^ 56;
+            table[index * 64 + square] =
+                makeEvalScore(sign * (materialMiddlegame[type] + pieceSquareMiddlegame[type][tableSquare]),
+                              sign * (materialEndgame[type] + pieceSquareEndgame[type][tableSquare]));
+        }
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 12> phaseTable() {
+    std::array<uint8_t, 12> table = {};
+    for (int index = 0; index < 12; index++) {
+        table[index] = phaseWeight[index % 6 + 1];
+    }
+    return table;
+}
+
+// Indexed [pieceBoardIndex(piece) * 64 + square].
+inline constexpr std::array<EvalScore, 12 * 64> pieceSquareScores = pieceSquareScoreTable();
+// Indexed by pieceBoardIndex(piece).
+inline constexpr std::array<uint8_t, 12> piecePhase = phaseTable();
+
+} // namespace chessEvalTables
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef PIECESQUAREDATA_H
+#define PIECESQUAREDATA_H
+
+#include <stdint.h>
+
+// Hand-written values, the starting point of tools/texel_tune.cpp. Tuned values only replace
+// them once deeper searches still beat shallower ones with them. Layout in pieceSquare.h.
+namespace chessEvalTables {
+
+constexpr int16_t materialMiddlegame[7] = {0, 100, 330, 320, 500, 900, 0};
+constexpr int16_t materialEndgame[7] = {0, 120, 330, 320, 500, 900, 0};
+
+constexpr int16_t pieceSquareMiddlegame[7][64] = {
+    {}, // (no piece)
+    { // pawn
+           0,    0,    0,    0,    0,    0,    0,    0,
+          50,   50,   50,   50,   50,   50,   50,   50,
+          10,   10,   20,   30,   30,   20,   10,   10,
+           5,    5,   10,   25,   25,   10,    5,    5,
+           0,    0,    0,   20,   20,    0,    0,    0,
+           5,   -5,  -10,    0,    0,  -10,   -5,    5,
+           5,   10,   10,  -20,  -20,   10,   10,    5,
+           0,    0,    0,    0,    0,    0,    0,    0,
+    },
+    { // bishop
+         -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20,
+         -10,    0,    0,    0,    0,    0,    0,  -10,
+         -10,    0,    5,   10,   10,    5,    0,  -10,
+         -10,    5,    5,   10,   10,    5,    5,  -10,
+         -10,    0,   10,   10,   10,   10,    0,  -10,
+         -10,   10,   10,   10,   10,   10,   10,  -10,
+         -10,    5,    0,    0,    0,    0,    5,  -10,
+         -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20,
+    },
+    { // knight
+         -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50,
+         -40,  -20,    0,    0,    0,    0,  -20,  -40,
+         -30,    0,   10,   15,   15,   10,    0,  -30,
+         -30,    5,   15,   20,   20,   15,    5,  -30,
+         -30,    0,   15,   20,   20,   15,    0,  -30,
+         -30,    5,   10,   15,   15,   10,    5,  -30,
+         -40,  -20,    0,    5,    5,    0,  -20,  -40,
+         -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50,
+    },
+    { // rook
+           0,    0,    0,    0,    0,    0,    0,    0,
+           5,   10,   10,   10,   10,   10,   10,    5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+           0,    0,    0,    5,    5,    0,    0,    0,
+    },
+    { // queen
+         -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20,
+         -10,    0,    0,    0,    0,    0,    0,  -10,
+         -10,    0,    5,    5,    5,    5,    0,  -10,
+          -5,    0,    5,    5,    5,    5,    0,   -5,
+           0,    0,    5,    5,    5,    5,    0,   -5,
+         -10,    5,    5,    5,    5,    5,    0,  -10,
+         -10,    0,    5,    0,    0,    0,    0,  -10,
+         -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20,
+    },
+    { // king
+         -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+         -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+         -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+         -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+         -20,  -30,  -30,  -40,  -40,  -30,  -30,  -20,
+         -10,  -20,  -20,  -20,  -20,  -20,  -20,  -10,
+          20,   20,    0,    0,    0,    0,   20,   20,
+          20,   30,   10,    0,    0,   10,   30,   20,
+    },
+};
+
+constexpr int16_t pieceSquareEndgame[7][64] = {
+    {}, // (no piece)
+    { // pawn
+           0,    0,    0,    0,    0,    0,    0,    0,
+          90,   90,   90,   90,   90,   90,   90,   90,
+          60,   60,   60,   60,   60,   60,   60,   60,
+          35,   35,   35,   35,   35,   35,   35,   35,
+          20,   20,   20,   20,   20,   20,   20,   20,
+          10,   10,   10,   10,   10,   10,   10,   10,
+           0,    0,    0,    0,    0,    0,    0,    0,
+           0,    0,    0,    0,    0,    0,    0,    0,
+    },
+    { // bishop
+         -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20,
+         -10,    0,    0,    0,    0,    0,    0,  -10,
+         -10,    0,    5,   10,   10,    5,    0,  -10,
+         -10,    5,    5,   10,   10,    5,    5,  -10,
+         -10,    0,   10,   10,   10,   10,    0,  -10,
+         -10,   10,   10,   10,   10,   10,   10,  -10,
+         -10,    5,    0,    0,    0,    0,    5,  -10,
+         -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20,
+    },
+    { // knight
+         -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50,
+         -40,  -20,    0,    0,    0,    0,  -20,  -40,
+         -30,    0,   10,   15,   15,   10,    0,  -30,
+         -30,    5,   15,   20,   20,   15,    5,  -30,
+         -30,    0,   15,   20,   20,   15,    0,  -30,
+         -30,    5,   10,   15,   15,   10,    5,  -30,
+         -40,  -20,    0,    5,    5,    0,  -20,  -40,
+         -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50,
+    },
+    { // rook
+           0,    0,    0,    0,    0,    0,    0,    0,
+          15,   15,   15,   15,   15,   15,   15,   15,
+           0,    0,    0,    0,    0,    0,    0,    0,
+           0,    0,    0,    0,    0,    0,    0,    0,
+           0,    0,    0,    0,    0,    0,    0,    0,
+           0,    0,    0,    0,    0,    0,    0,    0,
+           0,    0,    0,    0,    0,    0,    0,    0,
+           0,    0,    0,    0,    0,    0,    0,    0,
+    },
+    { // queen
+         -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20,
+         -10,    0,    0,    0,    0,    0,    0,  -10,
+         -10,    0,    5,    5,    5,    5,    0,  -10,
+          -5,    0,    5,    5,    5,    5,    0,   -5,
+           0,    0,    5,    5,    5,    5,    0,   -5,
+         -10,    5,    5,    5,    5,    5,    0,  -10,
+         -10,    0,    5,    0,    0,    0,    0,  -10,
+         -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20,
+    },
+    { // king
+         -50,  -40,  -30,  -20,  -20,  -30,  -40,  -50,
+         -30,  -20,  -10,    0,    0,  -10,  -20,  -30,
+         -30,  -10,   20,   30,   30,   20,  -10,  -30,
+         -30,  -10,   30,   40,   40,   30,  -10,  -30,
+         -30,  -10,   30,   40,   40,   30,  -10,  -30,
+         -30,  -10,   20,   30,   30,   20,  -10,  -30,
+         -30,  -30,    0,    0,    0,    0,  -30,  -30,
+         -50,  -30,  -30,  -30,  -30,  -30,  -30,  -50,
+    },
+};
+
+} // namespace chessEvalTables
+
+#endif
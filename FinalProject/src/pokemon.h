@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "move.h"
+#include "sprite.h"
 
 
 class Pokemon{
@@ -13,9 +14,7 @@ class Pokemon{
     int _level;
     Move _moveSet[4];
 
-    const uint16_t* _sprite;
-    int _spriteWidth;
-    int _spriteHeight;
+    const Sprite* _sprite;
 
 
     public:
@@ -27,16 +26,16 @@ class Pokemon{
     * @param name Name of the Pokemon
     * @param maxHealth Maximum health of the Pokemon
     * @param level Level of the Pokemon
+    * @param moves The four moves of the Pokemon
+    * @param sprite Handle to the Pokemon's sprite in flash
     */
-    Pokemon(const char * name, int maxHealth, int level, Move moves[], const uint16_t* sprite, int spriteWidth, int spriteHeight){
+    Pokemon(const char * name, int maxHealth, int level, Move moves[], const Sprite* sprite){
         _name = name;
         _maxHealth = maxHealth;
         _health = _maxHealth;
         _level = level;
 
         _sprite = sprite;
-        _spriteWidth = spriteWidth;
-        _spriteHeight = spriteHeight;
 
 
         for (int i = 0; i < 4; i++) {
@@ -51,16 +50,16 @@ class Pokemon{
         return const_cast<char*>(static_cast<const char*>(getName()));
     }
 
-    const uint16_t* getSprite(){
+    const Sprite* getSprite(){
         return _sprite;
     }
 
     int getSpriteWidth(){
-        return _spriteWidth;
+        return _sprite->width;
     }
 
     int getSpriteHeight(){
-        return _spriteHeight;
+        return _sprite->height;
     }
 
     int getHealth(){
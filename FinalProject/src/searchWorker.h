@@ -0,0 +1,347 @@
+#ifndef SEARCHWORKER_H
+#define SEARCHWORKER_H
+
+#include <stdint.h>
+#include "chessSearch.h"
+
+#ifdef ESP_PLATFORM
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#else
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+// The search task runs on the core the Arduino loop does not use (the loop runs on
+// core 1). Its stack only holds the recursion frames; move lists live in ChessSearch.
+#define SEARCH_WORKER_CORE 0
+#define SEARCH_WORKER_STACK 12288
+#define SEARCH_WORKER_PRIORITY 1
+// A search hands the CPU to the idle task for a tick this often, so the task
+// watchdog on the worker's core stays fed during long searches.
+#define SEARCH_WORKER_YIELD_MS 100
+
+/**
+ * @brief Latest news from a running search, for the UI to show.
+ */
+struct SearchProgress {
+    uint32_t id = 0;     // request the numbers belong to, 0 before the first
+    int depth = 0;       // last completed depth
+    ChessMove move = 0;  // best move at that depth
+    int score = 0;
+    uint32_t nodes = 0;
+    bool running = false;
+};
+
+/**
+ * @brief Runs ChessSearch on a background task so the UI loop never blocks.
+ * start() copies a request (position and limits) into the worker's request slot and
+ * queues its id; the worker copies the slot into its own request, searches, and puts
+ * the result on the result queue, where poll() picks it up. A request holds a whole
+ * ChessPosition, so neither side keeps one on its task stack or in a queue. Requests are numbered. cancel() marks every request up to the
+ * newest as cancelled; the search notices within 1024 nodes, and results of
+ * cancelled or superseded requests are dropped instead of delivered. After each
+ * completed depth the worker publishes a SearchProgress snapshot. On the ESP32
+ * the worker is a FreeRTOS task pinned to SEARCH_WORKER_CORE with queues of
+ * depth one; on the host it is a std::thread with the same protocol, so the
+ * searches (and their node-limited results) are the same.
+ */
+class SearchWorker {
+  private:
+    struct Request {
+        uint32_t id;
+        bool clearTable;
+        ChessPosition position;
+        ChessSearchLimits limits;
+    };
+
+    struct Result {
+        uint32_t id;
+        ChessSearchResult result;
+    };
+
+    // Newest request from start(), and the copy the worker searches. The slot is only
+    // touched under the slot lock; the worker's copy only by the worker.
+    Request _next = {};
+    Request _active = {};
+
+    ChessSearch *_engine = nullptr;
+    volatile uint32_t _lastId = 0;        // newest request handed to start()
+    volatile uint32_t _cancelledUpTo = 0; // requests with an id up to this are cancelled
+    volatile uint32_t _runningId = 0;     // request the worker is searching, 0 if idle
+    uint32_t _collectedId = 0;            // newest request whose result poll() returned
+    uint32_t _lastYield = 0;
+    SearchProgress _progress;
+
+#ifdef ESP_PLATFORM
+    QueueHandle_t _requests = nullptr;
+    QueueHandle_t _results = nullptr;
+    SemaphoreHandle_t _slotLock = nullptr;
+    portMUX_TYPE _progressLock = portMUX_INITIALIZER_UNLOCKED;
+
+    void lockProgress() { taskENTER_CRITICAL(&_progressLock); }
+    void unlockProgress() { taskEXIT_CRITICAL(&_progressLock); }
+
+    static void taskMain(void *self) {
+        SearchWorker *worker = (SearchWorker *)self;
+        uint32_t id;
+        while (true) {
+            if (xQueueReceive(worker->_requests, &id, portMAX_DELAY) != pdTRUE) {
+                continue;
+            }
+            xSemaphoreTake(worker->_slotLock, portMAX_DELAY);
+            bool fresh = worker->takeRequest();
+            xSemaphoreGive(worker->_slotLock);
+            if (fresh) {
+                Result result = worker->run(worker->_active);
+                if (result.id) {
+                    xQueueOverwrite(worker->_results, &result);
+                }
+            }
+        }
+    }
+
+    static uint32_t now() { return xTaskGetTickCount() * portTICK_PERIOD_MS; }
+    static void pause() { vTaskDelay(1); }
+#else
+    std::mutex _lock;
+    std::condition_variable _wake;
+    std::deque<uint32_t> _requests;
+    std::deque<Result> _results;
+    std::thread _thread;
+    bool _quit = false;
+
+    void lockProgress() { _lock.lock(); }
+    void unlockProgress() { _lock.unlock(); }
+
+    void threadMain() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> guard(_lock);
+                _wake.wait(guard, [this] { return _quit || !_requests.empty(); });
+                if (_quit) {
+                    return;
+                }
+                _requests.pop_front();
+                if (!takeRequest()) {
+                    continue;
+                }
+            }
+            Result result = run(_active);
+            if (result.id) {
+                std::lock_guard<std::mutex> guard(_lock);
+                _results.clear(); // depth one, like the FreeRTOS queue
+                _results.push_back(result);
+            }
+        }
+    }
+
+    static uint32_t now() { return 0; }
+    static void pause() {}
+#endif
+
+    // Copies the request slot into the worker's request. False if the slot holds nothing
+    // newer: start() may have replaced the request before the worker saw the first id.
+    bool takeRequest() {
+        if (_next.id <= _active.id) {
+            return false;
+        }
+        _active = _next;
+        return true;
+    }
+
+    // Search one request. Returns a result with id 0 if it was cancelled.
+    Result run(const Request &request) {
+        Result result = {0, ChessSearchResult()};
+        if (request.id <= _cancelledUpTo) {
+            return result;
+        }
+        _runningId = request.id;
+        lockProgress();
+        _progress = SearchProgress();
+        _progress.id = request.id;
+        _progress.running = true;
+        unlockProgress();
+
+        if (request.clearTable && _engine->table()) {
+            _engine->table()->clear();
+        }
+        ChessSearchLimits limits = request.limits;
+        limits.shouldStop = [](void *self) { return ((SearchWorker *)self)->shouldStop(); };
+        limits.onIteration = [](const ChessSearchResult &r, void *self) { ((SearchWorker *)self)->publish(r); };
+        limits.context = this;
+        _lastYield = now();
+        ChessSearchResult searched = _engine->search(request.position, limits);
+
+        lockProgress();
+        _progress.running = false;
+        unlockProgress();
+        _runningId = 0;
+        if (request.id > _cancelledUpTo && request.id == _lastId) {
+            result.id = request.id;
+            result.result = searched;
+        }
+        return result;
+    }
+
+    void fillRequest(uint32_t id, const ChessPosition &position, const ChessSearchLimits &limits, bool clearTable) {
+        _next.id = id;
+        _next.clearTable = clearTable;
+        _next.position = position;
+        _next.limits = limits;
+    }
+
+    bool shouldStop() {
+        if (now() - _lastYield >= SEARCH_WORKER_YIELD_MS) {
+            pause();
+            _lastYield = now();
+        }
+        return _runningId <= _cancelledUpTo || _runningId != _lastId;
+    }
+
+    void publish(const ChessSearchResult &result) {
+        lockProgress();
+        _progress.depth = result.depth;
+        _progress.move = result.move;
+        _progress.score = result.score;
+        _progress.nodes = result.nodes;
+        unlockProgress();
+    }
+
+  public:
+    SearchWorker() = default;
+    SearchWorker(const SearchWorker &) = delete;
+    SearchWorker &operator=(const SearchWorker &) = delete;
+
+#ifndef ESP_PLATFORM
+    ~SearchWorker() {
+        if (_thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                _quit = true;
+                _cancelledUpTo = _lastId;
+            }
+            _wake.notify_all();
+            _thread.join();
+        }
+    }
+#endif
+
+    /**
+     * @brief Starts the worker for an engine. Safe to call again; later calls do nothing.
+     * @return True once the worker is running.
+     */
+    bool begin(ChessSearch *engine) {
+        if (_engine) {
+            return true;
+        }
+#ifdef ESP_PLATFORM
+        _requests = xQueueCreate(1, sizeof(uint32_t));
+        _results = xQueueCreate(1, sizeof(Result));
+        _slotLock = xSemaphoreCreateMutex();
+        if (!_requests || !_results || !_slotLock) {
+            return false;
+        }
+        _engine = engine;
+        if (xTaskCreatePinnedToCore(taskMain, "chessSearch", SEARCH_WORKER_STACK, this, SEARCH_WORKER_PRIORITY,
+                                    nullptr, SEARCH_WORKER_CORE) != pdPASS) {
+            _engine = nullptr;
+            return false;
+        }
+#else
+        _engine = engine;
+        _thread = std::thread(&SearchWorker::threadMain, this);
+#endif
+        return true;
+    }
+
+    /**
+     * @brief Queues a search, cancelling any search still running or waiting.
+     * @param clearTable Clear the engine's transposition table first (new game). The
+     * worker does it, since only the worker touches the engine and its table.
+     * @return Id of the request, 0 if the worker is not running.
+     */
+    uint32_t start(const ChessPosition &position, const ChessSearchLimits &limits, bool clearTable = false) {
+        if (!_engine) {
+            return 0;
+        }
+        cancel();
+        uint32_t id = _lastId + 1;
+#ifdef ESP_PLATFORM
+        xSemaphoreTake(_slotLock, portMAX_DELAY);
+        fillRequest(id, position, limits, clearTable);
+        _lastId = id;
+        xSemaphoreGive(_slotLock);
+        xQueueReset(_results);
+        xQueueOverwrite(_requests, &id);
+#else
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            fillRequest(id, position, limits, clearTable);
+            _lastId = id;
+            _results.clear();
+            _requests.clear();
+            _requests.push_back(id);
+        }
+        _wake.notify_one();
+#endif
+        return id;
+    }
+
+    /**
+     * @brief Cancels the running and queued searches; their results are never delivered.
+     */
+    void cancel() { _cancelledUpTo = _lastId; }
+
+    /**
+     * @brief Takes the result of the newest request if it has finished.
+     * @return True if result was filled.
+     */
+    bool poll(ChessSearchResult &result) {
+        if (!_engine) {
+            return false;
+        }
+        Result finished;
+#ifdef ESP_PLATFORM
+        if (xQueueReceive(_results, &finished, 0) != pdTRUE) {
+            return false;
+        }
+#else
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            if (_results.empty()) {
+                return false;
+            }
+            finished = _results.front();
+            _results.pop_front();
+        }
+#endif
+        if (finished.id != _lastId || finished.id <= _cancelledUpTo) {
+            return false;
+        }
+        _collectedId = finished.id;
+        result = finished.result;
+        return true;
+    }
+
+    /**
+     * @brief Whether a search has been requested and its result not yet collected or cancelled.
+     */
+    bool pending() const { return _lastId > _cancelledUpTo && _lastId > _collectedId; }
+
+    /**
+     * @brief Snapshot of the current search's progress.
+     */
+    SearchProgress progress() {
+        lockProgress();
+        SearchProgress snapshot = _progress;
+        unlockProgress();
+        return snapshot;
+    }
+};
+
+#endif
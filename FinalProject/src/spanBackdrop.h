@@ -0,0 +1,225 @@
+#ifndef SPANBACKDROP_H
+#define SPANBACKDROP_H
+
+#include <Arduino.h>
+
+// Most color runs a backdrop row can hold. The battle backdrop needs five
+// (grass, platform, grass, platform, grass) on the rows where both platforms overlap.
+#define SPAN_BACKDROP_MAX_RUNS 8
+
+/**
+ * @brief Walks the rows of a filled ellipse and reports the half-width of each.
+ * Follows the midpoint boundary with integers only: for row dy the half-width is the
+ * largest dx with dx^2 * ry^2 + dy^2 * rx^2 <= rx^2 * ry^2, and since it never grows
+ * as dy grows, each row continues the search where the previous one stopped.
+ * @param rx Horizontal radius.
+ * @param ry Vertical radius.
+ * @param span Called as span(dy, halfWidth) for dy = 0 .. ry; rows cy - dy and cy + dy
+ *             both cover cx - halfWidth .. cx + halfWidth.
+ */
+template <typename SpanFn>
+void forEachEllipseSpan(int rx, int ry, SpanFn span) {
+    const int32_t rx2 = (int32_t)rx * rx;
+    const int32_t ry2 = (int32_t)ry * ry;
+    const int32_t limit = rx2 * ry2;
+    int dx = rx;
+
+    for (int dy = 0; dy <= ry; dy++) {
+        int32_t rowTerm = (int32_t)dy * dy * rx2;
+        while (dx > 0 && (int32_t)dx * dx * ry2 + rowTerm > limit) {
+            dx--;
+        }
+        span(dy, dx);
+    }
+}
+
+/**
+ * @brief Draws a filled ellipse as one horizontal span per row.
+ * @param display Display to draw on (Adafruit_ILI9341 or anything with the same write API).
+ * @param cx Center x.
+ * @param cy Center y.
+ * @param rx Horizontal radius.
+ * @param ry Vertical radius.
+ * @param color Fill color.
+ */
+template <typename Display>
+void fillEllipseSpans(Display &display, int cx, int cy, int rx, int ry, uint16_t color) {
+    if (rx < 0 || ry < 0) {
+        return;
+    }
+    display.startWrite();
+    forEachEllipseSpan(rx, ry, [&](int dy, int hw) {
+        display.writeFastHLine(cx - hw, cy - dy, 2 * hw + 1, color);
+        if (dy != 0) {
+            display.writeFastHLine(cx - hw, cy + dy, 2 * hw + 1, color);
+        }
+    });
+    display.endWrite();
+}
+
+/**
+ * @brief A static background kept as a short list of color runs per row.
+ * Scenes made of a few flat shapes (the battle sky, grass and platforms) cost a
+ * handful of runs per row instead of a full bitmap, so the cache lives in internal
+ * RAM and any rectangle of it can be put back on the screen with one address
+ * window and a sequence of solid-color bursts, without recomputing the shapes.
+ */
+class SpanBackdrop {
+  private:
+    struct Run {
+        int16_t end; // exclusive
+        uint16_t color;
+    };
+
+    int16_t _width;
+    int16_t _height;
+    Run *_runs;
+    uint8_t *_runCount;
+    bool _overflow = false;
+
+    // Replaces columns [x0, x1) of a row with one run, splitting the runs it cuts
+    // and merging neighbours of the same color.
+    void paintRow(int16_t y, int16_t x0, int16_t x1, uint16_t color) {
+        Run *row = &_runs[y * SPAN_BACKDROP_MAX_RUNS];
+        Run merged[SPAN_BACKDROP_MAX_RUNS + 2];
+        int count = 0;
+
+        auto append = [&](int16_t end, uint16_t c) {
+            if (count > 0 && merged[count - 1].color == c) {
+                merged[count - 1].end = end;
+            } else {
+                merged[count++] = {end, c};
+            }
+        };
+
+        for (int i = 0; i < _runCount[y]; i++) {
+            int16_t start = i == 0 ? 0 : row[i - 1].end;
+            if (row[i].end <= x0) {
+                append(row[i].end, row[i].color);
+            } else if (start < x0) {
+                append(x0, row[i].color);
+            }
+        }
+        append(x1, color);
+        for (int i = 0; i < _runCount[y]; i++) {
+            if (row[i].end > x1) {
+                append(row[i].end, row[i].color);
+            }
+        }
+
+        if (count > SPAN_BACKDROP_MAX_RUNS) {
+            _overflow = true;
+            return;
+        }
+        memcpy(row, merged, count * sizeof(Run));
+        _runCount[y] = count;
+    }
+
+  public:
+    /**
+     * @brief Allocates an empty (black) backdrop.
+     * @param w Width in pixels.
+     * @param h Height in pixels.
+     */
+    SpanBackdrop(int16_t w, int16_t h) : _width(w), _height(h) {
+        _runs = (Run *)malloc((size_t)h * SPAN_BACKDROP_MAX_RUNS * sizeof(Run));
+        _runCount = (uint8_t *)malloc(h);
+        if (!_runs || !_runCount) {
+            _overflow = true;
+            return;
+        }
+        clear(0);
+    }
+
+    ~SpanBackdrop() {
+        free(_runs);
+        free(_runCount);
+    }
+
+    SpanBackdrop(const SpanBackdrop &) = delete;
+    SpanBackdrop &operator=(const SpanBackdrop &) = delete;
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    /**
+     * @brief Whether every shape fit in the run budget (and the storage was allocated).
+     * A backdrop that is not valid must not be drawn; callers fall back to drawing the shapes.
+     */
+    bool valid() const { return !_overflow; }
+
+    /**
+     * @brief Fills the whole backdrop with one color.
+     */
+    void clear(uint16_t color) {
+        if (!_runs) {
+            return;
+        }
+        for (int16_t y = 0; y < _height; y++) {
+            _runs[y * SPAN_BACKDROP_MAX_RUNS] = {_width, color};
+            _runCount[y] = 1;
+        }
+    }
+
+    /**
+     * @brief Fills a rectangle, clipped to the backdrop.
+     */
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        int16_t x0 = max<int16_t>(x, 0), x1 = min<int16_t>(x + w, _width);
+        int16_t y0 = max<int16_t>(y, 0), y1 = min<int16_t>(y + h, _height);
+        if (!_runs || x0 >= x1) {
+            return;
+        }
+        for (int16_t row = y0; row < y1; row++) {
+            paintRow(row, x0, x1, color);
+        }
+    }
+
+    /**
+     * @brief Fills an ellipse with the same spans fillEllipseSpans() draws, clipped to the backdrop.
+     */
+    void fillEllipse(int cx, int cy, int rx, int ry, uint16_t color) {
+        if (rx < 0 || ry < 0) {
+            return;
+        }
+        forEachEllipseSpan(rx, ry, [&](int dy, int hw) {
+            fillRect(cx - hw, cy - dy, 2 * hw + 1, 1, color);
+            if (dy != 0) {
+                fillRect(cx - hw, cy + dy, 2 * hw + 1, 1, color);
+            }
+        });
+    }
+
+    /**
+     * @brief Copies a rectangle of the backdrop to the same place on a display.
+     * The rectangle is clipped to the backdrop and sent as one address window; each
+     * run crossing a row goes out as a single solid-color burst.
+     * @param display Display to draw on (Adafruit_ILI9341 or anything with the same write API).
+     */
+    template <typename Display>
+    void restore(Display &display, int16_t x, int16_t y, int16_t w, int16_t h) const {
+        int16_t x0 = max<int16_t>(x, 0), x1 = min<int16_t>(x + w, min(_width, display.width()));
+        int16_t y0 = max<int16_t>(y, 0), y1 = min<int16_t>(y + h, min(_height, display.height()));
+        if (!_runs || x0 >= x1 || y0 >= y1) {
+            return;
+        }
+
+        display.startWrite();
+        display.setAddrWindow(x0, y0, x1 - x0, y1 - y0);
+        for (int16_t row = y0; row < y1; row++) {
+            const Run *runs = &_runs[row * SPAN_BACKDROP_MAX_RUNS];
+            int16_t start = 0;
+            for (int i = 0; i < _runCount[row] && start < x1; i++) {
+                int16_t from = max(start, x0);
+                int16_t to = min(runs[i].end, x1);
+                if (to > from) {
+                    display.writeColor(runs[i].color, to - from);
+                }
+                start = runs[i].end;
+            }
+        }
+        display.endWrite();
+    }
+};
+
+#endif
@@ -0,0 +1,515 @@
+#ifndef SPIPIPELINE_H
+#define SPIPIPELINE_H
+
+#include <Arduino.h>
+#include <Adafruit_ILI9341.h>
+#if defined(ESP32)
+#include <esp_heap_caps.h>
+#endif
+
+// The ESP-IDF DMA path has not been run on a device yet: it shares the Arduino SPI
+// bus with the library and switches DMA off by hand after each transfer. Until it is
+// verified, strips are pushed synchronously on the ESP32 unless PIPELINE_SPI_DMA is
+// defined (see platformio.ini).
+#if defined(PIPELINE_SPI_DMA) && defined(ESP32)
+#define PIPELINE_DMA 1
+#include <driver/spi_master.h>
+#include <hal/spi_ll.h>
+#endif
+
+// Pixels per strip buffer. Two of these live in DMA-capable internal RAM.
+#define PIPELINE_STRIP_PIXELS 2048
+// Windows (and leftover strips) smaller than this bypass the strips: queueing a
+// transfer for them costs more than the bus time it would hide.
+#define PIPELINE_MIN_ASYNC_PIXELS 64
+// SPI host behind the Arduino SPI object (FSPI) and the clock used when begin() gets 0,
+// matching the library's default for the ESP32.
+#define PIPELINE_SPI_HOST SPI2_HOST
+#define PIPELINE_SPI_FREQ 40000000
+
+/**
+ * @brief One unit of work for the bus: an optional address window followed by pixels.
+ */
+struct PipelineJob {
+    bool hasWindow;
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t *pixels;
+    uint32_t count;
+};
+
+/**
+ * @brief ILI9341 driver with a double-buffered output pipeline.
+ * Pixel writes (writePixels(), writeColor(), fills, and everything built on them: the
+ * sprite blitters, fillRect-heavy scenes, text) are composed into one of two strip
+ * buffers, already byte-swapped for the panel. A full strip, or the pixels of one address
+ * window, is handed to the bus while the CPU composes the next strip into the other
+ * buffer. Only one transfer is in flight at a time, so a strip is never overwritten
+ * while it is being sent. endWrite() does not wait for the bus, so a primitive's transfer
+ * also overlaps the CPU work leading up to the next one; dmaWait() (called from
+ * presentFrame() once per loop) waits for the bus and ends the SPI transaction.
+ *
+ * On the ESP32 a strip is pushed through the library's blocking writePixels() by
+ * default, so only the composing (byte swapping, run-length fills) is shared. Built with
+ * PIPELINE_SPI_DMA, each strip instead goes out as an ESP-IDF SPI DMA transaction
+ * (spi_device_queue_trans()) on the bus the Arduino SPI driver already set up; address
+ * windows and commands still go through the library, between transfers. CS stays low
+ * from the library's open transaction, so the DMA device does not drive it. Elsewhere
+ * it uses the library's own non-blocking writePixels() and dmaWait(), which the host
+ * stand-in turns into a simulated DMA queue (see tools/pipeline_bench.cpp).
+ *
+ * Everything that reaches the bus without going through the primitives above (commands,
+ * reads, scrolling, pushColor(), drawRGBBitmap()) is wrapped so that the pending window
+ * and strip are sent first and the bus is idle before the library touches it.
+ */
+class PipelinedTFT : public Adafruit_ILI9341 {
+  private:
+    uint16_t *_strips[2] = {nullptr, nullptr};
+    uint8_t _current = 0;
+    uint32_t _fill = 0;
+    bool _enabled = false;
+    bool _inFlight = false;
+    // The SPI transaction is kept open between primitives so one primitive's transfer can
+    // overlap composing the next; dmaWait() closes it.
+    bool _transactionOpen = false;
+    // Set for a small window whose pixels bypass the strips.
+    bool _direct = false;
+    // Color each strip is already filled with and for how many pixels, so repeated
+    // fills of one color do not rewrite the strip.
+    uint16_t _stripColor[2] = {0, 0};
+    uint32_t _stripColorCount[2] = {0, 0};
+
+    // Window set since the last submit, sent ahead of the strip's pixels.
+    bool _hasWindow = false;
+    uint16_t _winX = 0, _winY = 0, _winW = 0, _winH = 0;
+
+#ifdef PIPELINE_DMA
+    spi_device_handle_t _dma = nullptr;
+    spi_transaction_t _trans;
+
+    /**
+     * @brief Registers a DMA device on the panel's bus; returns false if the driver
+     * refuses, in which case output stays synchronous.
+     */
+    bool attachDma(uint32_t freq) {
+        spi_bus_config_t bus = {};
+        bus.mosi_io_num = MOSI;
+        bus.miso_io_num = -1;
+        bus.sclk_io_num = SCK;
+        bus.quadwp_io_num = -1;
+        bus.quadhd_io_num = -1;
+        bus.max_transfer_sz = PIPELINE_STRIP_PIXELS * sizeof(uint16_t);
+        esp_err_t err = spi_bus_initialize(PIPELINE_SPI_HOST, &bus, SPI_DMA_CH_AUTO);
+        if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+            return false;
+        }
+        spi_device_interface_config_t dev = {};
+        dev.mode = 0;
+        dev.clock_speed_hz = freq;
+        dev.spics_io_num = -1;
+        dev.queue_size = 2;
+        dev.flags = SPI_DEVICE_NO_DUMMY;
+        return spi_bus_add_device(PIPELINE_SPI_HOST, &dev, &_dma) == ESP_OK;
+    }
+#endif
+
+    bool pipelined() const { return _enabled && _strips[0] != nullptr; }
+
+    /**
+     * @brief Sends a job on the calling core and returns when it is on the wire.
+     */
+    void sendJob(const PipelineJob &job) {
+        if (job.hasWindow) {
+            Adafruit_ILI9341::setAddrWindow(job.x, job.y, job.w, job.h);
+        }
+        if (job.count > 0) {
+            Adafruit_ILI9341::writePixels(job.pixels, job.count, true, true);
+        }
+    }
+
+    void startTransfer(const PipelineJob &job) {
+        if (job.count < PIPELINE_MIN_ASYNC_PIXELS) {
+            sendJob(job);
+            return;
+        }
+#if defined(PIPELINE_DMA)
+        // The previous transfer has finished, so the window commands can use the bus.
+        if (job.hasWindow) {
+            Adafruit_ILI9341::setAddrWindow(job.x, job.y, job.w, job.h);
+        }
+        memset(&_trans, 0, sizeof(_trans));
+        _trans.tx_buffer = job.pixels;
+        _trans.length = job.count * 16;
+        spi_device_queue_trans(_dma, &_trans, portMAX_DELAY);
+#elif defined(ESP32)
+        sendJob(job);
+        return;
+#else
+        if (job.hasWindow) {
+            Adafruit_ILI9341::setAddrWindow(job.x, job.y, job.w, job.h);
+        }
+        Adafruit_ILI9341::writePixels(job.pixels, job.count, false, true);
+#endif
+        _inFlight = true;
+    }
+
+    void waitTransfer() {
+        if (!_inFlight) {
+            return;
+        }
+#ifdef PIPELINE_DMA
+        spi_transaction_t *done;
+        spi_device_get_trans_result(_dma, &done, portMAX_DELAY);
+        // Hand the bus back to the CPU FIFO the Arduino driver writes through.
+        spi_ll_dma_tx_enable(SPI_LL_GET_HW(PIPELINE_SPI_HOST), false);
+#else
+        Adafruit_ILI9341::dmaWait();
+#endif
+        _inFlight = false;
+    }
+
+    /**
+     * @brief Hands the strip being composed (and any pending window) to the bus and
+     * switches to the other strip.
+     */
+    void submitStrip() {
+        if (_fill == 0 && !_hasWindow) {
+            return;
+        }
+        PipelineJob job = {_hasWindow, _winX, _winY, _winW, _winH, _strips[_current], _fill};
+        waitTransfer();
+        startTransfer(job);
+        _hasWindow = false;
+        _current ^= 1;
+        _fill = 0;
+    }
+
+    /**
+     * @brief Sends everything composed so far and waits for the bus to go idle.
+     */
+    void drain() {
+        submitStrip();
+        waitTransfer();
+    }
+
+    static uint16_t toPanel(uint16_t color) { return (uint16_t)((color << 8) | (color >> 8)); }
+
+    void appendPixels(const uint16_t *colors, uint32_t len, bool bigEndian) {
+        while (len > 0) {
+            uint32_t n = min(len, (uint32_t)(PIPELINE_STRIP_PIXELS - _fill));
+            uint16_t *dst = &_strips[_current][_fill];
+            _stripColorCount[_current] = 0;
+            if (bigEndian) {
+                memcpy(dst, colors, n * sizeof(uint16_t));
+            } else {
+                for (uint32_t i = 0; i < n; i++) {
+                    dst[i] = toPanel(colors[i]);
+                }
+            }
+            _fill += n;
+            colors += n;
+            len -= n;
+            if (_fill == PIPELINE_STRIP_PIXELS) {
+                submitStrip();
+            }
+        }
+    }
+
+    void appendColor(uint16_t color, uint32_t len) {
+        uint16_t swapped = toPanel(color);
+        while (len > 0) {
+            uint32_t n = min(len, (uint32_t)(PIPELINE_STRIP_PIXELS - _fill));
+            if (_fill == 0 && _stripColorCount[_current] > 0 && _stripColor[_current] == swapped) {
+                // Strip already holds this color from an earlier fill.
+                n = min(n, _stripColorCount[_current]);
+            } else {
+                uint16_t *dst = &_strips[_current][_fill];
+                for (uint32_t i = 0; i < n; i++) {
+                    dst[i] = swapped;
+                }
+                if (_fill == 0) {
+                    _stripColor[_current] = swapped;
+                    _stripColorCount[_current] = n;
+                } else {
+                    _stripColorCount[_current] = 0;
+                }
+            }
+            _fill += n;
+            len -= n;
+            if (_fill == PIPELINE_STRIP_PIXELS) {
+                submitStrip();
+            }
+        }
+    }
+
+  public:
+    PipelinedTFT(int8_t cs, int8_t dc, int8_t rst = -1) : Adafruit_ILI9341(cs, dc, rst) {}
+
+    /**
+     * @brief Initializes the panel, allocates the strip buffers and, with PIPELINE_SPI_DMA,
+     * attaches the DMA device. If either fails every write goes straight to the bus.
+     */
+    void begin(uint32_t freq = 0) override {
+        Adafruit_ILI9341::begin(freq);
+        if (_strips[0] == nullptr) {
+            size_t bytes = PIPELINE_STRIP_PIXELS * sizeof(uint16_t);
+#if defined(ESP32)
+            _strips[0] = (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+            _strips[1] = (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+            bool ready = _strips[0] != nullptr && _strips[1] != nullptr;
+#ifdef PIPELINE_DMA
+            ready = ready && (_dma != nullptr || attachDma(freq ? freq : PIPELINE_SPI_FREQ));
+#endif
+            if (!ready) {
+                free(_strips[0]);
+                free(_strips[1]);
+                _strips[0] = _strips[1] = nullptr;
+            }
+#else
+            _strips[0] = (uint16_t *)malloc(bytes);
+            _strips[1] = (uint16_t *)malloc(bytes);
+            if (_strips[0] == nullptr || _strips[1] == nullptr) {
+                free(_strips[0]);
+                free(_strips[1]);
+                _strips[0] = _strips[1] = nullptr;
+            }
+#endif
+        }
+        _enabled = true;
+    }
+
+    /**
+     * @brief Switches between pipelined and plain synchronous output.
+     */
+    void setPipelineEnabled(bool enabled) {
+        dmaWait();
+        _enabled = enabled;
+    }
+
+    bool pipelineEnabled() const { return pipelined(); }
+
+    /**
+     * @brief Blocks until everything written so far has reached the panel and ends the
+     * SPI transaction. Call before anything else uses the bus.
+     */
+    void dmaWait() {
+        drain();
+        if (_transactionOpen) {
+            _transactionOpen = false;
+            Adafruit_ILI9341::endWrite();
+        }
+    }
+
+    void startWrite() override {
+        if (!pipelined()) {
+            Adafruit_ILI9341::startWrite();
+            return;
+        }
+        if (!_transactionOpen) {
+            _transactionOpen = true;
+            Adafruit_ILI9341::startWrite();
+        }
+    }
+
+    /**
+     * @brief Hands what was composed to the bus without waiting for it; the transaction
+     * stays open for the next primitive.
+     */
+    void endWrite() override {
+        if (!pipelined()) {
+            Adafruit_ILI9341::endWrite();
+            return;
+        }
+        submitStrip();
+    }
+
+    void setRotation(uint8_t r) override {
+        dmaWait();
+        Adafruit_ILI9341::setRotation(r);
+    }
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override {
+        if (!pipelined()) {
+            Adafruit_ILI9341::setAddrWindow(x, y, w, h);
+            return;
+        }
+        submitStrip();
+        _direct = (uint32_t)w * h < PIPELINE_MIN_ASYNC_PIXELS;
+        if (_direct) {
+            waitTransfer();
+            Adafruit_ILI9341::setAddrWindow(x, y, w, h);
+            return;
+        }
+        _hasWindow = true;
+        _winX = x;
+        _winY = y;
+        _winW = w;
+        _winH = h;
+    }
+
+    void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool bigEndian = false) {
+        if (!pipelined() || _direct) {
+            Adafruit_ILI9341::writePixels(colors, len, block, bigEndian);
+            return;
+        }
+        appendPixels(colors, len, bigEndian);
+    }
+
+    void writeColor(uint16_t color, uint32_t len) {
+        if (!pipelined() || _direct) {
+            Adafruit_ILI9341::writeColor(color, len);
+            return;
+        }
+        appendColor(color, len);
+    }
+
+    void writePixel(uint16_t color) {
+        if (!pipelined() || _direct) {
+            Adafruit_ILI9341::writePixel(color);
+            return;
+        }
+        appendColor(color, 1);
+    }
+
+    void pushColor(uint16_t color) {
+        if (!pipelined()) {
+            Adafruit_ILI9341::pushColor(color);
+            return;
+        }
+        startWrite();
+        writeColor(color, 1);
+        endWrite();
+    }
+
+    /**
+     * @brief Same clipping as the library's version, but the rows go into the strips.
+     */
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h) {
+        if (!pipelined()) {
+            Adafruit_ILI9341::drawRGBBitmap(x, y, pcolors, w, h);
+            return;
+        }
+        int16_t x2 = x + w - 1, y2 = y + h - 1;
+        if (w <= 0 || h <= 0 || x >= _width || y >= _height || x2 < 0 || y2 < 0) {
+            return;
+        }
+        int16_t stride = w;
+        if (x < 0) {
+            pcolors -= x;
+            x = 0;
+        }
+        if (y < 0) {
+            pcolors -= (int32_t)y * stride;
+            y = 0;
+        }
+        w = min(x2, (int16_t)(_width - 1)) - x + 1;
+        h = min(y2, (int16_t)(_height - 1)) - y + 1;
+        startWrite();
+        setAddrWindow(x, y, w, h);
+        for (int16_t j = 0; j < h; j++, pcolors += stride) {
+            writePixels(pcolors, w);
+        }
+        endWrite();
+    }
+
+    void writeCommand(uint8_t cmd) {
+        drain();
+        Adafruit_ILI9341::writeCommand(cmd);
+    }
+
+    // These open their own SPI transaction, so the pipeline's has to be closed first.
+    void sendCommand(uint8_t commandByte, const uint8_t *dataBytes = nullptr, uint8_t numDataBytes = 0) {
+        dmaWait();
+        Adafruit_ILI9341::sendCommand(commandByte, dataBytes, numDataBytes);
+    }
+
+    uint8_t readcommand8(uint8_t commandByte, uint8_t index = 0) {
+        dmaWait();
+        return Adafruit_ILI9341::readcommand8(commandByte, index);
+    }
+
+    void invertDisplay(bool invert) {
+        dmaWait();
+        Adafruit_ILI9341::invertDisplay(invert);
+    }
+
+    void scrollTo(uint16_t y) {
+        dmaWait();
+        Adafruit_ILI9341::scrollTo(y);
+    }
+
+    void setScrollMargins(uint16_t top, uint16_t bottom) {
+        dmaWait();
+        Adafruit_ILI9341::setScrollMargins(top, bottom);
+    }
+
+    void writePixel(int16_t x, int16_t y, uint16_t color) override {
+        if (!pipelined()) {
+            Adafruit_ILI9341::writePixel(x, y, color);
+            return;
+        }
+        if (x >= 0 && x < _width && y >= 0 && y < _height) {
+            setAddrWindow(x, y, 1, 1);
+            writeColor(color, 1);
+        }
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (!pipelined()) {
+            Adafruit_ILI9341::drawPixel(x, y, color);
+            return;
+        }
+        startWrite();
+        writePixel(x, y, color);
+        endWrite();
+    }
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        if (!pipelined()) {
+            Adafruit_ILI9341::writeFillRect(x, y, w, h, color);
+            return;
+        }
+        if (w < 0) { x += w + 1; w = -w; }
+        if (h < 0) { y += h + 1; h = -h; }
+        int16_t x2 = x + w - 1, y2 = y + h - 1;
+        if (w == 0 || h == 0 || x >= _width || y >= _height || x2 < 0 || y2 < 0) {
+            return;
+        }
+        x = max(x, (int16_t)0);
+        y = max(y, (int16_t)0);
+        x2 = min(x2, (int16_t)(_width - 1));
+        y2 = min(y2, (int16_t)(_height - 1));
+        setAddrWindow(x, y, x2 - x + 1, y2 - y + 1);
+        writeColor(color, (uint32_t)(x2 - x + 1) * (y2 - y + 1));
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        if (!pipelined()) {
+            Adafruit_ILI9341::fillRect(x, y, w, h, color);
+            return;
+        }
+        startWrite();
+        writeFillRect(x, y, w, h, color);
+        endWrite();
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        writeFillRect(x, y, w, 1, color);
+    }
+
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+        writeFillRect(x, y, 1, h, color);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        fillRect(x, y, w, 1, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+        fillRect(x, y, 1, h, color);
+    }
+};
+
+#endif
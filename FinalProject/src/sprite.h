@@ -0,0 +1,23 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <Arduino.h>
+
+// Storage formats a Sprite can point at. Both treat 0x0000 as transparent.
+enum SpriteFormat : uint8_t {
+    SPRITE_RLE565, // run-length encoded RGB565 stream (see blitRLESprite())
+    SPRITE_PAL4    // color table plus packed 4-bit indices, index 0 transparent
+};
+
+// Handle to a sprite stored in flash. Pokemon and chessPiece keep a pointer to one
+// of these instead of a raw pixel array and its size.
+struct Sprite {
+    uint8_t format;
+    uint8_t width;
+    uint8_t height;
+    uint8_t paletteSize;     // SPRITE_PAL4 only
+    const uint16_t *palette; // SPRITE_PAL4 only, entry 0 is the transparent key
+    const void *data;        // indices (two per byte, high nibble first, rows byte aligned) or RLE stream
+};
+
+#endif
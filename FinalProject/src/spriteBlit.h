@@ -0,0 +1,378 @@
+#ifndef SPRITEBLIT_H
+#define SPRITEBLIT_H
+
+#include <Arduino.h>
+#include "sprite.h"
+
+// Longest run of pixels staged on the stack before it is pushed. Wider runs are
+// sent as several bursts into the same address window.
+#define SPRITE_BLIT_MAX_RUN 64
+
+/**
+ * @brief Pushes a block of opaque pixels through the open address window.
+ * @param display Display the window was opened on.
+ * @param src Pixels in PROGMEM.
+ * @param count Number of pixels to push.
+ */
+template <typename Display>
+void pushProgmemPixels(Display &display, const uint16_t *src, int count) {
+    uint16_t buffer[SPRITE_BLIT_MAX_RUN];
+
+    while (count > 0) {
+        int chunk = min(count, SPRITE_BLIT_MAX_RUN);
+        for (int i = 0; i < chunk; i++) {
+            buffer[i] = pgm_read_word(&src[i]);
+        }
+        display.writePixels(buffer, chunk);
+        src += chunk;
+        count -= chunk;
+    }
+}
+
+/**
+ * @brief Draws a sprite with a transparent key color, one address window per opaque run.
+ * Each row is scanned for runs of opaque pixels and every run goes out as a single
+ * windowed burst, all inside one SPI transaction. Consecutive rows with no transparent
+ * pixels are merged into one rectangular window. Output is clipped to the screen the
+ * same way drawPixel() clips.
+ * @param display Display to draw on (Adafruit_ILI9341 or anything with the same write API).
+ * @param x Horizontal starting position.
+ * @param y Vertical starting position.
+ * @param bitmap Pointer to the 16-bit color bitmap array in PROGMEM.
+ * @param w Width of the sprite.
+ * @param h Height of the sprite.
+ * @param transparentColor The color value to be treated as transparent (not drawn).
+ */
+template <typename Display>
+void blitSpriteTransparent(Display &display, int x, int y, const uint16_t *bitmap, int w, int h, uint16_t transparentColor) {
+    // Visible part of the sprite, in sprite coordinates.
+    int colStart = max(0, -x);
+    int colEnd = min(w, (int)display.width() - x);
+    int rowStart = max(0, -y);
+    int rowEnd = min(h, (int)display.height() - y);
+    if (colStart >= colEnd || rowStart >= rowEnd) {
+        return;
+    }
+    int visibleWidth = colEnd - colStart;
+
+    display.startWrite();
+    int j = rowStart;
+    while (j < rowEnd) {
+        const uint16_t *row = &bitmap[j * w];
+
+        // Find the first transparent pixel in the visible part of the row.
+        int i = colStart;
+        while (i < colEnd && pgm_read_word(&row[i]) != transparentColor) {
+            i++;
+        }
+
+        if (i == colEnd) {
+            // Fully opaque row: extend the window over every following opaque row.
+            int rows = 1;
+            while (j + rows < rowEnd) {
+                const uint16_t *next = &bitmap[(j + rows) * w];
+                int k = colStart;
+                while (k < colEnd && pgm_read_word(&next[k]) != transparentColor) {
+                    k++;
+                }
+                if (k != colEnd) {
+                    break;
+                }
+                rows++;
+            }
+            display.setAddrWindow(x + colStart, y + j, visibleWidth, rows);
+            for (int r = 0; r < rows; r++) {
+                pushProgmemPixels(display, &bitmap[(j + r) * w + colStart], visibleWidth);
+            }
+            j += rows;
+            continue;
+        }
+
+        // Mixed row: one window per opaque run.
+        i = colStart;
+        while (i < colEnd) {
+            while (i < colEnd && pgm_read_word(&row[i]) == transparentColor) {
+                i++;
+            }
+            int runStart = i;
+            while (i < colEnd && pgm_read_word(&row[i]) != transparentColor) {
+                i++;
+            }
+            if (i > runStart) {
+                display.setAddrWindow(x + runStart, y + j, i - runStart, 1);
+                pushProgmemPixels(display, &row[runStart], i - runStart);
+            }
+        }
+        j++;
+    }
+    display.endWrite();
+}
+
+/**
+ * @brief Reads the width of an RLE sprite (see blitRLESprite()).
+ */
+inline int rleSpriteWidth(const uint16_t *rle) {
+    return pgm_read_word(&rle[0]);
+}
+
+/**
+ * @brief Reads the height of an RLE sprite (see blitRLESprite()).
+ */
+inline int rleSpriteHeight(const uint16_t *rle) {
+    return pgm_read_word(&rle[1]);
+}
+
+/**
+ * @brief Draws a run-length encoded sprite straight from PROGMEM.
+ * The stream is decoded as it is read and each opaque run is pushed as one windowed burst,
+ * so nothing is expanded into RAM. Consecutive fully opaque rows share one window.
+ *
+ * Layout (written by tools/sprite_encode.py --format rle): word 0 is the width, word 1 the height, then each
+ * row is a list of segments until the row's width is covered. A segment is one word
+ * (skip << 8) | run, meaning skip transparent pixels followed by run opaque pixels, and is
+ * followed by the run's RGB565 values.
+ * @param display Display to draw on.
+ * @param x Horizontal starting position.
+ * @param y Vertical starting position.
+ * @param rle Pointer to the encoded sprite in PROGMEM.
+ */
+template <typename Display>
+void blitRLESprite(Display &display, int x, int y, const uint16_t *rle) {
+    int w = rleSpriteWidth(rle);
+    int h = rleSpriteHeight(rle);
+    const uint16_t *p = &rle[2];
+
+    // Visible part of the sprite, in sprite coordinates.
+    int colStart = max(0, -x);
+    int colEnd = min(w, (int)display.width() - x);
+    int rowStart = max(0, -y);
+    int rowEnd = min(h, (int)display.height() - y);
+    if (colStart >= colEnd || rowStart >= rowEnd) {
+        return;
+    }
+    bool fullWidth = (colStart == 0 && colEnd == w);
+    uint16_t opaqueRow = (uint16_t)w; // skip 0, run w
+
+    display.startWrite();
+    int j = 0;
+    while (j < rowEnd) {
+        bool rowVisible = (j >= rowStart);
+
+        if (rowVisible && fullWidth && pgm_read_word(p) == opaqueRow) {
+            // Merge this and every following fully opaque row into one window.
+            int rows = 1;
+            while (j + rows < rowEnd && pgm_read_word(p + rows * (w + 1)) == opaqueRow) {
+                rows++;
+            }
+            display.setAddrWindow(x, y + j, w, rows);
+            for (int r = 0; r < rows; r++) {
+                pushProgmemPixels(display, p + 1, w);
+                p += w + 1;
+            }
+            j += rows;
+            continue;
+        }
+
+        int col = 0;
+        while (col < w) {
+            uint16_t segment = pgm_read_word(p++);
+            col += segment >> 8;
+            int run = segment & 0xFF;
+            if (rowVisible && run > 0) {
+                int start = max(col, colStart);
+                int end = min(col + run, colEnd);
+                if (start < end) {
+                    display.setAddrWindow(x + start, y + j, end - start, 1);
+                    pushProgmemPixels(display, p + (start - col), end - start);
+                }
+            }
+            p += run;
+            col += run;
+        }
+        j++;
+    }
+    display.endWrite();
+}
+
+/**
+ * @brief Reads the palette index of one pixel from a packed 4-bit row.
+ */
+inline uint8_t pal4Index(const uint8_t *row, int i) {
+    uint8_t pair = pgm_read_byte(&row[i >> 1]);
+    return (i & 1) ? (pair & 0x0F) : (pair >> 4);
+}
+
+/**
+ * @brief Checks that a packed 4-bit row has no transparent (index 0) pixels in [start, end).
+ */
+inline bool pal4RowOpaque(const uint8_t *row, int start, int end) {
+    for (int i = start; i < end; i++) {
+        if (pal4Index(row, i) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Expands pixels of a packed 4-bit row through a palette and pushes them
+ * through the open address window.
+ */
+template <typename Display>
+void pushPal4Pixels(Display &display, const uint8_t *row, int start, int count, const uint16_t *palette) {
+    uint16_t buffer[SPRITE_BLIT_MAX_RUN];
+
+    while (count > 0) {
+        int chunk = min(count, SPRITE_BLIT_MAX_RUN);
+        for (int i = 0; i < chunk; i++) {
+            buffer[i] = palette[pal4Index(row, start + i)];
+        }
+        display.writePixels(buffer, chunk);
+        start += chunk;
+        count -= chunk;
+    }
+}
+
+/**
+ * @brief Draws a SPRITE_PAL4 sprite, expanding the 4-bit indices through its palette on the fly.
+ * Index 0 is transparent. Opaque runs go out as one windowed burst each and consecutive
+ * fully opaque rows share a window, as in blitSpriteTransparent().
+ * @param display Display to draw on.
+ * @param x Horizontal starting position.
+ * @param y Vertical starting position.
+ * @param sprite Sprite handle with format SPRITE_PAL4.
+ */
+template <typename Display>
+void blitPal4Sprite(Display &display, int x, int y, const Sprite &sprite) {
+    int w = sprite.width;
+    int h = sprite.height;
+    int stride = (w + 1) / 2;
+    const uint8_t *indices = (const uint8_t *)sprite.data;
+
+    // Visible part of the sprite, in sprite coordinates.
+    int colStart = max(0, -x);
+    int colEnd = min(w, (int)display.width() - x);
+    int rowStart = max(0, -y);
+    int rowEnd = min(h, (int)display.height() - y);
+    if (colStart >= colEnd || rowStart >= rowEnd) {
+        return;
+    }
+    int visibleWidth = colEnd - colStart;
+
+    uint16_t palette[16];
+    for (int k = 0; k < sprite.paletteSize && k < 16; k++) {
+        palette[k] = pgm_read_word(&sprite.palette[k]);
+    }
+
+    display.startWrite();
+    int j = rowStart;
+    while (j < rowEnd) {
+        const uint8_t *row = &indices[j * stride];
+
+        if (pal4RowOpaque(row, colStart, colEnd)) {
+            int rows = 1;
+            while (j + rows < rowEnd && pal4RowOpaque(&indices[(j + rows) * stride], colStart, colEnd)) {
+                rows++;
+            }
+            display.setAddrWindow(x + colStart, y + j, visibleWidth, rows);
+            for (int r = 0; r < rows; r++) {
+                pushPal4Pixels(display, &indices[(j + r) * stride], colStart, visibleWidth, palette);
+            }
+            j += rows;
+            continue;
+        }
+
+        int i = colStart;
+        while (i < colEnd) {
+            while (i < colEnd && pal4Index(row, i) == 0) {
+                i++;
+            }
+            int runStart = i;
+            while (i < colEnd && pal4Index(row, i) != 0) {
+                i++;
+            }
+            if (i > runStart) {
+                display.setAddrWindow(x + runStart, y + j, i - runStart, 1);
+                pushPal4Pixels(display, row, runStart, i - runStart, palette);
+            }
+        }
+        j++;
+    }
+    display.endWrite();
+}
+
+/**
+ * @brief Draws a sprite through its handle, whatever format it is stored in.
+ * @param display Display to draw on.
+ * @param x Horizontal starting position.
+ * @param y Vertical starting position.
+ * @param sprite Sprite handle.
+ */
+template <typename Display>
+void blitSprite(Display &display, int x, int y, const Sprite &sprite) {
+    switch (sprite.format) {
+        case SPRITE_PAL4:
+            blitPal4Sprite(display, x, y, sprite);
+            break;
+        case SPRITE_RLE565:
+            blitRLESprite(display, x, y, (const uint16_t *)sprite.data);
+            break;
+    }
+}
+
+/**
+ * @brief Display stand-in that lets the blitters draw into a RAM buffer instead of the
+ * screen, e.g. to composite a sprite over a background once and reuse the result.
+ * Pixels are stored row-major with a stride of the canvas width.
+ */
+class SpriteCanvas {
+  private:
+    uint16_t *_buffer;
+    int16_t _width;
+    int16_t _height;
+    int16_t _winX0 = 0, _winX1 = 0, _winY0 = 0, _winY1 = 0;
+    int16_t _curX = 0, _curY = 0;
+
+  public:
+    SpriteCanvas(uint16_t *buffer, int16_t w, int16_t h) : _buffer(buffer), _width(w), _height(h) {}
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    void startWrite() {}
+    void endWrite() {}
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+        _winX0 = x;
+        _winY0 = y;
+        _winX1 = x + w - 1;
+        _winY1 = y + h - 1;
+        _curX = x;
+        _curY = y;
+    }
+
+    void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool bigEndian = false) {
+        (void)block;
+        (void)bigEndian;
+        for (uint32_t k = 0; k < len; k++) {
+            _buffer[(int32_t)_curY * _width + _curX] = colors[k];
+            if (++_curX > _winX1) {
+                _curX = _winX0;
+                if (++_curY > _winY1) {
+                    _curY = _winY0;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Fills the whole canvas with one color.
+     */
+    void fill(uint16_t color) {
+        for (int32_t i = 0; i < (int32_t)_width * _height; i++) {
+            _buffer[i] = color;
+        }
+    }
+};
+
+#endif
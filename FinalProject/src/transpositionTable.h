@@ -0,0 +1,152 @@
+#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "chessPosition.h"
+
+// Bound stored with a score: exact, or the true score is at most / at least it.
+#define TT_EXACT 0
+#define TT_UPPER 1
+#define TT_LOWER 2
+
+/**
+ * @brief One remembered search result.
+ */
+struct TTEntry {
+    uint32_t check;    // upper half of the Zobrist key; 0 = empty
+    ChessMove move;    // best or refuting move, 0 if none
+    int16_t score;
+    int8_t depth;
+    uint8_t boundAge;  // bits 0-1 bound (TT_*), bits 2-7 search generation
+};
+
+/**
+ * @brief Hash table of search results, indexed by the low bits of the Zobrist key.
+ * Each bucket holds two entries: a depth-preferred one, replaced only by a result
+ * at least as deep or left over from an earlier search, and an always-replace one
+ * that takes everything else. Deep results survive while recent shallow ones
+ * still find a place. The table does not allocate: the caller hands it a block
+ * (PSRAM on the ESP32), and the bucket count is the largest power of two that fits.
+ * Lookups, stores and their results are plain integer work, so a host build with
+ * the same table size fills it identically.
+ */
+class TranspositionTable {
+  private:
+    struct Bucket {
+        TTEntry deep;
+        TTEntry recent;
+    };
+
+    Bucket *_buckets = nullptr;
+    uint32_t _mask = 0;
+    uint8_t _generation = 0;
+
+    static uint32_t check(uint64_t key) {
+        uint32_t c = (uint32_t)(key >> 32);
+        return c ? c : 1; // keep 0 for empty entries
+    }
+
+    static uint8_t age(const TTEntry &entry) { return entry.boundAge >> 2; }
+
+  public:
+    // Counters for the host benchmark; reset by clear() and resetStats().
+    uint32_t probes = 0;
+    uint32_t hits = 0;
+    uint32_t stores = 0;
+
+    /**
+     * @brief Uses a block of memory for the table and clears it.
+     * @param memory Block to use; must outlive the table. Null disables the table.
+     * @param bytes Size of the block.
+     */
+    void attach(void *memory, size_t bytes) {
+        size_t count = memory ? bytes / sizeof(Bucket) : 0;
+        size_t buckets = 1;
+        while (buckets * 2 <= count) {
+            buckets *= 2;
+        }
+        _buckets = count ? (Bucket *)memory : nullptr;
+        _mask = count ? (uint32_t)(buckets - 1) : 0;
+        clear();
+    }
+
+    bool enabled() const { return _buckets != nullptr; }
+
+    /**
+     * @brief Size of the table in bytes (0 when disabled).
+     */
+    size_t bytes() const { return _buckets ? ((size_t)_mask + 1) * sizeof(Bucket) : 0; }
+
+    /**
+     * @brief Forgets every entry, e.g. for a new game.
+     */
+    void clear() {
+        if (_buckets) {
+            memset(_buckets, 0, bytes());
+        }
+        _generation = 0;
+        resetStats();
+    }
+
+    void resetStats() { probes = hits = stores = 0; }
+
+    /**
+     * @brief Starts a new search: entries from earlier searches become replaceable.
+     */
+    void newSearch() { _generation = (_generation + 1) & 63; }
+
+    /**
+     * @brief Looks a position up.
+     * @return The entry stored for the key, or null.
+     */
+    const TTEntry *probe(uint64_t key) {
+        if (!_buckets) {
+            return nullptr;
+        }
+        probes++;
+        Bucket &bucket = _buckets[(uint32_t)key & _mask];
+        uint32_t c = check(key);
+        const TTEntry *entry = bucket.deep.check == c ? &bucket.deep : bucket.recent.check == c ? &bucket.recent : nullptr;
+        hits += entry != nullptr;
+        return entry;
+    }
+
+    /**
+     * @brief Stores a search result for a position.
+     * @param key Zobrist key of the position.
+     * @param move Best move found (0 keeps the move already stored for this key).
+     * @param score Score, with mate scores already made relative to this position.
+     * @param depth Depth the score was searched to.
+     * @param bound TT_EXACT, TT_UPPER or TT_LOWER.
+     */
+    void store(uint64_t key, ChessMove move, int score, int depth, int bound) {
+        if (!_buckets) {
+            return;
+        }
+        stores++;
+        Bucket &bucket = _buckets[(uint32_t)key & _mask];
+        uint32_t c = check(key);
+        TTEntry *slot;
+        if (bucket.deep.check == c || bucket.deep.check == 0 || depth >= bucket.deep.depth ||
+            age(bucket.deep) != _generation) {
+            if (bucket.deep.check != c && bucket.deep.check != 0) {
+                bucket.recent = bucket.deep; // the displaced deep result still gets a slot
+            }
+            slot = &bucket.deep;
+        } else {
+            slot = &bucket.recent;
+        }
+        if (move == 0 && slot->check == c) {
+            move = slot->move;
+        }
+        slot->check = c;
+        slot->move = move;
+        slot->score = (int16_t)score;
+        slot->depth = (int8_t)depth;
+        slot->boundAge = (uint8_t)(bound | (_generation << 2));
+    }
+};
+
+#endif
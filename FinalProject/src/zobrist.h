@@ -0,0 +1,43 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <stdint.h>
+#include <array>
+
+// Zobrist hashing: every (piece, square) pair, castling-rights combination, en
+// passant file and the side to move gets a fixed random 64-bit key, and a
+// position's key is the XOR of the keys of what is on it. A move only changes a
+// few terms, so ChessPosition updates its key with a handful of XORs. The keys
+// are generated at compile time from a fixed seed, so they are the same on the
+// ESP32 and the host and live in flash.
+namespace zobrist {
+
+// SplitMix64 step: a well-mixed 64-bit value for each index.
+constexpr uint64_t splitMix(uint64_t index) {
+    uint64_t z = 0x5A17C0DEF00DBA5Eull + (index + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+template <int N>
+constexpr std::array<uint64_t, N> keyTable(int offset) {
+    std::array<uint64_t, N> table = {};
+    for (int i = 0; i < N; i++) {
+        table[i] = splitMix(offset + i);
+    }
+    return table;
+}
+
+// Indexed [pieceBoardIndex(piece) * 64 + square].
+inline constexpr std::array<uint64_t, 12 * 64> pieces = keyTable<12 * 64>(0);
+// Indexed by the CASTLE_* bit set.
+inline constexpr std::array<uint64_t, 16> castling = keyTable<16>(12 * 64);
+// Indexed by the column of the en passant square.
+inline constexpr std::array<uint64_t, 8> enPassant = keyTable<8>(12 * 64 + 16);
+// XORed in when black is to move.
+inline constexpr uint64_t blackToMove = splitMix(12 * 64 + 16 + 8);
+
+} // namespace zobrist
+
+#endif
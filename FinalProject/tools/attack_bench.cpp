@@ -0,0 +1,264 @@
+/**
+ * @file attack_bench.cpp
+ * @brief Host benchmark of chess rule queries: the old 8x8 array scan against the bitboards.
+ *
+ * A fixed set of random positions (both kings plus a random mix of other pieces)
+ * is loaded into both representations. The array side is a copy of the original
+ * main.cpp code: isSquareAttacked() runs isValidMove() from every enemy piece and
+ * walks sliding paths square by square with isPathClear(). The bitboard side is
+ * ChessPosition from src/chessPosition.h. The report gives queries per second for
+ * isSquareAttacked() over every square and for isInCheck(), and checks that both
+ * agree wherever the old code's semantics are exact (squares holding a defender,
+ * which includes every king). The last row times the end-of-move game state check:
+ * the old checkGameState() scan of every source/destination pair against one
+ * generateLegalMoves() call from src/chessMoves.h.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -Isrc tools/attack_bench.cpp -o /tmp/attack_bench && /tmp/attack_bench
+ */
+
+#include <array>
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "chessMoves.h"
+
+typedef std::array<std::array<int, 8>, 8> Board;
+
+// --- Original array implementation (main.cpp before the bitboards) ---
+namespace arrayBoard {
+
+Board chessBoard;
+
+int getPieceAt(int index) {
+  return chessBoard[index / 8][index % 8];
+}
+
+bool isPathClear(int startIdx, int endIdx) {
+  int startRow = startIdx / 8, startCol = startIdx % 8;
+  int endRow = endIdx / 8, endCol = endIdx % 8;
+  int dRow = (endRow - startRow) == 0 ? 0 : (endRow - startRow) > 0 ? 1 : -1;
+  int dCol = (endCol - startCol) == 0 ? 0 : (endCol - startCol) > 0 ? 1 : -1;
+  int currentRow = startRow + dRow, currentCol = startCol + dCol;
+  while (currentRow != endRow || currentCol != endCol) {
+    if (chessBoard[currentRow][currentCol] != 0) return false;
+    currentRow += dRow;
+    currentCol += dCol;
+  }
+  return true;
+}
+
+bool isValidMove(int fromIdx, int toInx) {
+  int piece = getPieceAt(fromIdx);
+  int target = getPieceAt(toInx);
+  if (target != 0 && ((piece > 0 && target > 0) || (piece < 0 && target < 0))) return false;
+  int startRow = fromIdx / 8, startCol = fromIdx % 8;
+  int dRow = toInx / 8 - startRow, dCol = toInx % 8 - startCol;
+  int absRow = abs(dRow), absCol = abs(dCol);
+  switch (abs(piece)) {
+    case 1: {
+      int direction = (piece > 0) ? -1 : 1;
+      int startRowLimit = (piece > 0) ? 6 : 1;
+      if (dCol == 0 && dRow == direction && target == 0) return true;
+      if (dCol == 0 && dRow == direction * 2 && startRow == startRowLimit && target == 0 &&
+          chessBoard[startRow + direction][startCol] == 0)
+        return true;
+      if (absCol == 1 && dRow == direction) return target != 0;
+      return false;
+    }
+    case 2: return absRow == absCol && isPathClear(fromIdx, toInx);
+    case 3: return (absRow == 2 && absCol == 1) || (absRow == 1 && absCol == 2);
+    case 4: return (dRow == 0 || dCol == 0) && isPathClear(fromIdx, toInx);
+    case 5: return (dRow == 0 || dCol == 0 || absRow == absCol) && isPathClear(fromIdx, toInx);
+    case 6: return absRow <= 1 && absCol <= 1;
+  }
+  return false;
+}
+
+int findKingLocation(int color) {
+  int targetKing = (color > 0) ? 6 : -6;
+  for (int i = 0; i < 8; i++)
+    for (int j = 0; j < 8; j++)
+      if (chessBoard[i][j] == targetKing) return i * 8 + j;
+  return -1;
+}
+
+bool isSquareAttacked(int targetIdx, int defenderColor) {
+  for (int i = 0; i < 64; i++) {
+    int piece = chessBoard[i / 8][i % 8];
+    if (piece == 0) continue;
+    if ((defenderColor > 0 && piece > 0) || (defenderColor < 0 && piece < 0)) continue;
+    if (isValidMove(i, targetIdx)) return true;
+  }
+  return false;
+}
+
+bool isInCheck(int color) {
+  int kingIdx = findKingLocation(color);
+  return kingIdx != -1 && isSquareAttacked(kingIdx, color);
+}
+
+// As it was: the move is never applied, so this only asks whether the mover is in check now.
+bool isMoveSafe(int fromIdx, int toIdx) {
+  int movingPiece = getPieceAt(fromIdx);
+  (void)toIdx;
+  return !isInCheck((movingPiece > 0) ? 1 : -1);
+}
+
+int checkGameState(int color) {
+  bool hasLegalMoves = false;
+  for (int src = 0; src < 64 && !hasLegalMoves; src++) {
+    int piece = getPieceAt(src);
+    if (piece == 0 || (color == 1 && piece < 0) || (color == -1 && piece > 0)) continue;
+    for (int dst = 0; dst < 64; dst++) {
+      if (src != dst && isValidMove(src, dst) && isMoveSafe(src, dst)) {
+        hasLegalMoves = true;
+        break;
+      }
+    }
+  }
+  if (hasLegalMoves) return 0;
+  return isInCheck(color) ? 1 : 2;
+}
+
+} // namespace arrayBoard
+
+// --- Position generator ---
+static uint32_t rngState = 12345;
+static uint32_t nextRandom(uint32_t bound) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState % bound;
+}
+
+static Board randomBoard() {
+  Board board = {};
+  auto place = [&](int piece) {
+    while (true) {
+      int square = nextRandom(64);
+      int row = square / 8;
+      if (board[row][square % 8] != 0) continue;
+      if (abs(piece) == CHESS_PAWN && (row == 0 || row == 7)) continue;
+      board[row][square % 8] = piece;
+      return;
+    }
+  };
+  place(CHESS_KING);
+  place(-CHESS_KING);
+  int extra = 6 + nextRandom(21);
+  static const int mix[] = {1, 1, 1, 1, 2, 3, 4, 5};
+  for (int i = 0; i < extra; i++) {
+    int piece = mix[nextRandom(8)];
+    place(nextRandom(2) ? piece : -piece);
+  }
+  return board;
+}
+
+template <typename Fn>
+static double timeQueries(Fn fn, long &queries) {
+  auto start = std::chrono::steady_clock::now();
+  queries = fn();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+  const int positionCount = 2000;
+  const int rounds = 20;
+  std::vector<Board> boards;
+  std::vector<ChessPosition> positions(positionCount);
+  for (int i = 0; i < positionCount; i++) {
+    boards.push_back(randomBoard());
+    positions[i].setBoard(boards.back());
+  }
+
+  // Agreement where the old semantics are exact: squares holding a defender piece.
+  long checked = 0, mismatches = 0;
+  for (int i = 0; i < positionCount; i++) {
+    arrayBoard::chessBoard = boards[i];
+    for (int square = 0; square < 64; square++) {
+      int piece = positions[i].pieceAt(square);
+      if (piece == 0) continue;
+      int defender = piece > 0 ? 1 : -1;
+      checked++;
+      if (arrayBoard::isSquareAttacked(square, defender) != positions[i].isAttacked(square, -defender)) mismatches++;
+    }
+    for (int color = -1; color <= 1; color += 2) {
+      checked++;
+      if (arrayBoard::isInCheck(color) != positions[i].inCheck(color)) mismatches++;
+    }
+  }
+
+  volatile long sink = 0;
+  long arrayQueries, bitboardQueries, arrayChecks, bitboardChecks;
+  double arraySeconds = timeQueries([&] {
+    long n = 0;
+    for (int r = 0; r < rounds; r++)
+      for (int i = 0; i < positionCount; i++) {
+        arrayBoard::chessBoard = boards[i];
+        for (int square = 0; square < 64; square++, n += 2)
+          sink = sink + arrayBoard::isSquareAttacked(square, 1) + arrayBoard::isSquareAttacked(square, -1);
+      }
+    return n;
+  }, arrayQueries);
+  double bitboardSeconds = timeQueries([&] {
+    long n = 0;
+    for (int r = 0; r < rounds; r++)
+      for (int i = 0; i < positionCount; i++)
+        for (int square = 0; square < 64; square++, n += 2)
+          sink = sink + positions[i].isAttacked(square, -1) + positions[i].isAttacked(square, 1);
+    return n;
+  }, bitboardQueries);
+  double arrayCheckSeconds = timeQueries([&] {
+    long n = 0;
+    for (int r = 0; r < rounds * 20; r++)
+      for (int i = 0; i < positionCount; i++, n += 2) {
+        arrayBoard::chessBoard = boards[i];
+        sink = sink + arrayBoard::isInCheck(1) + arrayBoard::isInCheck(-1);
+      }
+    return n;
+  }, arrayChecks);
+  double bitboardCheckSeconds = timeQueries([&] {
+    long n = 0;
+    for (int r = 0; r < rounds * 20; r++)
+      for (int i = 0; i < positionCount; i++, n += 2)
+        sink = sink + positions[i].inCheck(1) + positions[i].inCheck(-1);
+    return n;
+  }, bitboardChecks);
+
+  long arrayStates, generatorStates;
+  double arrayStateSeconds = timeQueries([&] {
+    long n = 0;
+    for (int i = 0; i < positionCount; i++, n += 2) {
+      arrayBoard::chessBoard = boards[i];
+      sink = sink + arrayBoard::checkGameState(1) + arrayBoard::checkGameState(-1);
+    }
+    return n;
+  }, arrayStates);
+  double generatorStateSeconds = timeQueries([&] {
+    long n = 0;
+    ChessMoveList moves;
+    for (int r = 0; r < rounds; r++)
+      for (int i = 0; i < positionCount; i++, n += 2) {
+        generateLegalMoves(positions[i], 1, moves);
+        sink = sink + moves.count;
+        generateLegalMoves(positions[i], -1, moves);
+        sink = sink + moves.count;
+      }
+    return n;
+  }, generatorStates);
+
+  printf("Rule queries on %d random positions (host)\n", positionCount);
+  printf("%-20s | %14s %14s | %8s\n", "query", "array /s", "bitboard /s", "speedup");
+  double arrayRate = arrayQueries / arraySeconds, bitboardRate = bitboardQueries / bitboardSeconds;
+  double arrayCheckRate = arrayChecks / arrayCheckSeconds, bitboardCheckRate = bitboardChecks / bitboardCheckSeconds;
+  printf("%-20s | %14.0f %14.0f | %7.1fx\n", "isSquareAttacked", arrayRate, bitboardRate, bitboardRate / arrayRate);
+  printf("%-20s | %14.0f %14.0f | %7.1fx\n", "isInCheck", arrayCheckRate, bitboardCheckRate,
+         bitboardCheckRate / arrayCheckRate);
+  double arrayStateRate = arrayStates / arrayStateSeconds, generatorStateRate = generatorStates / generatorStateSeconds;
+  printf("%-20s | %14.0f %14.0f | %7.1fx\n", "checkGameState", arrayStateRate, generatorStateRate,
+         generatorStateRate / arrayStateRate);
+  printf("\n%ld comparisons, %ld mismatches\n", checked, mismatches);
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,337 @@
+/**
+ * @file bitbase_gen.cpp
+ * @brief Generates the KPK and KRK win/draw bitbases (src/bitbaseData.h) by retrograde analysis.
+ *
+ * Every placement of the three pieces with either side to move is one entry,
+ * with the strong side (king and pawn, rook or queen) as white. A position is
+ * won when white can force mate or a won promotion, and the analysis finds them
+ * by iterating to a fixed point:
+ *  - White to move wins if some move reaches a won position. A promotion to a
+ *    queen or rook continues in the KQK or KRK table; a knight or bishop draws.
+ *  - Black to move wins for white if black is mated, or if black has moves,
+ *    none of them captures white's piece, and all of them reach won positions.
+ *  - Everything that never becomes won is a draw (stalemates, lost pieces, and
+ *    positions where black can hold forever).
+ * Each pass reads the previous pass's results and writes new ones, so the
+ * result does not depend on how the positions are split between threads, and
+ * the output is the same for any --threads count. Moves come from the firmware's
+ * own generator (chessMoves.h). KQK is only computed as the target of queen
+ * promotions; KRK and KPK are written to the header.
+ *
+ * Checks before writing:
+ *  - Every legal position is probed through src/bitbase.h, in the packed form
+ *    the firmware uses and with the colors swapped, and must match the full
+ *    table. This covers the symmetry reductions and the probe code.
+ *  - Positions with well-known results (opposition, rook pawn, stalemate, a
+ *    hanging rook, the square of the pawn) must come out as expected.
+ * The report also lists the legal positions and wins per table and side to
+ * move, like perft counts, plus a checksum of the output for comparing runs.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -pthread -Isrc tools/bitbase_gen.cpp -o /tmp/bitbase_gen
+ *   /tmp/bitbase_gen [--threads N] [-o src/bitbaseData.h]
+ */
+
+#include <atomic>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "chessMoves.h"
+
+// The tables are about to be rewritten: probe the ones built here, not the
+// header on disk (bitbase.h reads kpkBits and krkBits through this guard).
+#define BITBASEDATA_H
+static uint8_t kpkBits[2 * 24 * 64 * 64 / 8];
+static uint8_t krkBits[2 * 10 * 64 * 64 / 8];
+#include "bitbase.h"
+
+#define TABLE_SIZE (2 * 64 * 64 * 64)
+
+// Index into a full table: side to move (0 white), white king, black king, white piece.
+static inline int fullIndex(int toMove, int whiteKing, int blackKing, int piece) {
+  return ((toMove * 64 + whiteKing) * 64 + blackKing) * 64 + piece;
+}
+
+struct Table {
+  int piece;                  // CHESS_PAWN, CHESS_ROOK or CHESS_QUEEN
+  std::vector<uint8_t> legal; // 1 for a legal placement
+  std::vector<uint8_t> win;   // 1 if white wins
+  int passes = 0;
+};
+
+static Table kqk, krk, kpk;
+
+// Puts a placement on the board. Returns false if it is not a legal position.
+static bool setUp(ChessPosition &position, int piece, int toMove, int whiteKing, int blackKing, int square) {
+  if (whiteKing == blackKing || whiteKing == square || blackKing == square) {
+    return false;
+  }
+  if (kingAttacks(whiteKing) & squareBit(blackKing)) {
+    return false;
+  }
+  if (piece == CHESS_PAWN && (square < 8 || square >= 56)) {
+    return false;
+  }
+  position.clear();
+  position.setPiece(whiteKing, CHESS_KING);
+  position.setPiece(blackKing, -CHESS_KING);
+  position.setPiece(square, piece);
+  position.setSideToMove(toMove == 0 ? 1 : -1);
+  return !position.inCheck(toMove == 0 ? -1 : 1); // the side that just moved cannot be in check
+}
+
+// One position's value, given the previous pass's results.
+static uint8_t evaluate(ChessPosition &position, ChessMoveList &moves, const std::vector<uint8_t> &previous,
+                        int toMove, int whiteKing, int blackKing, int square) {
+  generateLegalMoves(position, position.sideToMove(), moves);
+  if (toMove == 0) {
+    for (ChessMove move : moves) {
+      int from = moveFrom(move), to = moveTo(move);
+      if (from == whiteKing) {
+        if (previous[fullIndex(1, to, blackKing, square)]) {
+          return 1;
+        }
+      } else if (moveKind(move) == MOVE_PROMOTION) {
+        int promoted = movePromotion(move);
+        const Table *next = promoted == CHESS_QUEEN ? &kqk : promoted == CHESS_ROOK ? &krk : nullptr;
+        if (next && next->win[fullIndex(1, whiteKing, blackKing, to)]) {
+          return 1;
+        }
+      } else if (previous[fullIndex(1, whiteKing, blackKing, to)]) {
+        return 1;
+      }
+    }
+    return 0;
+  }
+  if (moves.count == 0) {
+    return position.inCheck(-1) ? 1 : 0;
+  }
+  for (ChessMove move : moves) {
+    int to = moveTo(move);
+    if (to == square || !previous[fullIndex(0, whiteKing, to, square)]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void solve(Table &table, int piece, int threads) {
+  table.piece = piece;
+  table.legal.assign(TABLE_SIZE, 0);
+  table.win.assign(TABLE_SIZE, 0);
+  std::vector<uint8_t> next(TABLE_SIZE, 0);
+
+  auto forRange = [&](auto work) {
+    std::vector<std::thread> pool;
+    std::atomic<int> changes(0);
+    for (int t = 0; t < threads; t++) {
+      pool.emplace_back([&, t] {
+        static thread_local ChessPosition position;
+        static thread_local ChessMoveList moves;
+        int begin = (int)((int64_t)TABLE_SIZE * t / threads);
+        int end = (int)((int64_t)TABLE_SIZE * (t + 1) / threads);
+        changes += work(position, moves, begin, end);
+      });
+    }
+    for (std::thread &thread : pool) {
+      thread.join();
+    }
+    return changes.load();
+  };
+
+  forRange([&](ChessPosition &position, ChessMoveList &, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      table.legal[i] = setUp(position, piece, i >> 18, (i >> 12) & 63, (i >> 6) & 63, i & 63);
+    }
+    return 0;
+  });
+
+  while (true) {
+    table.passes++;
+    int changes = forRange([&](ChessPosition &position, ChessMoveList &moves, int begin, int end) {
+      int changed = 0;
+      for (int i = begin; i < end; i++) {
+        uint8_t value = table.win[i];
+        if (!value && table.legal[i]) {
+          int toMove = i >> 18, whiteKing = (i >> 12) & 63, blackKing = (i >> 6) & 63, square = i & 63;
+          setUp(position, piece, toMove, whiteKing, blackKing, square);
+          value = evaluate(position, moves, table.win, toMove, whiteKing, blackKing, square);
+          changed += value;
+        }
+        next[i] = value;
+      }
+      return changed;
+    });
+    table.win.swap(next);
+    if (changes == 0) {
+      break;
+    }
+  }
+}
+
+static void report(const char *name, const Table &table) {
+  long legal[2] = {0, 0}, wins[2] = {0, 0};
+  for (int i = 0; i < TABLE_SIZE; i++) {
+    legal[i >> 18] += table.legal[i];
+    wins[i >> 18] += table.win[i];
+  }
+  printf("%s: %d passes | white to move %7ld legal %7ld won | black to move %7ld legal %7ld won\n", name,
+         table.passes, legal[0], wins[0], legal[1], wins[1]);
+}
+
+static void setBit(uint8_t *bits, uint32_t index, bool value) {
+  if (value) {
+    bits[index >> 3] |= (uint8_t)(1 << (index & 7));
+  }
+}
+
+static void pack() {
+  memset(kpkBits, 0, sizeof(kpkBits));
+  memset(krkBits, 0, sizeof(krkBits));
+  for (int toMove = 0; toMove < 2; toMove++) {
+    for (int pawnIndex = 0; pawnIndex < 24; pawnIndex++) {
+      int pawn = (pawnIndex / 4 + 1) * 8 + pawnIndex % 4;
+      for (int strongKing = 0; strongKing < 64; strongKing++) {
+        for (int weakKing = 0; weakKing < 64; weakKing++) {
+          uint32_t index = ((toMove * 24 + pawnIndex) * 64 + strongKing) * 64 + weakKing;
+          setBit(kpkBits, index, kpk.win[fullIndex(toMove, strongKing, weakKing, pawn)]);
+        }
+      }
+    }
+    for (int square = 0; square < 64; square++) {
+      int triangle = bitbase::triangleIndex(square);
+      if (triangle < 0) {
+        continue;
+      }
+      for (int rook = 0; rook < 64; rook++) {
+        for (int weakKing = 0; weakKing < 64; weakKing++) {
+          uint32_t index = ((toMove * 10 + triangle) * 64 + rook) * 64 + weakKing;
+          setBit(krkBits, index, krk.win[fullIndex(toMove, square, weakKing, rook)]);
+        }
+      }
+    }
+  }
+}
+
+// Probes every legal position through bitbase.h, as given and with the colors swapped.
+static int checkProbes(const Table &table) {
+  int errors = 0;
+  ChessPosition position, swapped;
+  for (int i = 0; i < TABLE_SIZE; i++) {
+    if (!table.legal[i]) {
+      continue;
+    }
+    int toMove = i >> 18, whiteKing = (i >> 12) & 63, blackKing = (i >> 6) & 63, square = i & 63;
+    setUp(position, table.piece, toMove, whiteKing, blackKing, square);
+    swapped.clear();
+    swapped.setPiece(whiteKing ^ 56, -CHESS_KING);
+    swapped.setPiece(blackKing ^ 56, CHESS_KING);
+    swapped.setPiece(square ^ 56, -table.piece);
+    swapped.setSideToMove(toMove == 0 ? -1 : 1);
+    int expected = table.win[i] ? BITBASE_WIN : BITBASE_DRAW;
+    errors += probeBitbase(position) != expected;
+    errors += probeBitbase(swapped) != expected;
+  }
+  return errors;
+}
+
+struct SpotCheck {
+  const char *fen;
+  int expected;
+  const char *why;
+};
+
+static const SpotCheck spotChecks[] = {
+  {"8/8/4K3/4P3/8/8/8/4k3 w - - 0 1", BITBASE_WIN, "king on the sixth in front of the pawn"},
+  {"4k3/8/4K3/4P3/8/8/8/8 b - - 0 1", BITBASE_WIN, "king on the sixth in front of the pawn"},
+  {"4k3/8/4K3/4P3/8/8/8/8 w - - 0 1", BITBASE_WIN, "king on the sixth in front of the pawn"},
+  {"k7/8/8/8/8/8/P7/K7 w - - 0 1", BITBASE_DRAW, "defending king in the rook pawn's corner"},
+  {"k7/8/8/8/8/8/P7/K7 b - - 0 1", BITBASE_DRAW, "defending king in the rook pawn's corner"},
+  {"k7/P7/1K6/8/8/8/8/8 b - - 0 1", BITBASE_DRAW, "stalemate"},
+  {"8/8/8/8/3kP3/8/8/K7 b - - 0 1", BITBASE_DRAW, "pawn hangs"},
+  {"8/P7/8/8/8/8/8/K6k w - - 0 1", BITBASE_WIN, "pawn promotes"},
+  {"7k/8/8/8/P7/8/8/K7 b - - 0 1", BITBASE_WIN, "king outside the square of the pawn"},
+  {"4k3/4P3/4K3/8/8/8/8/8 b - - 0 1", BITBASE_DRAW, "stalemate in front of the pawn"},
+  {"8/8/8/8/8/8/1R6/k6K b - - 0 1", BITBASE_DRAW, "rook hangs"},
+  {"8/8/8/8/8/8/1R6/k6K w - - 0 1", BITBASE_WIN, "rook saved"},
+  {"k7/1RK5/8/8/8/8/8/8 b - - 0 1", BITBASE_DRAW, "stalemate"},
+  {"k7/8/1K6/8/8/8/8/7R w - - 0 1", BITBASE_WIN, "mate in one"},
+  {"8/8/8/4k3/8/8/8/R3K3 b - - 0 1", BITBASE_WIN, "plain KRK"},
+};
+
+int main(int argc, char **argv) {
+  int threads = (int)std::thread::hardware_concurrency();
+  const char *outputPath = "src/bitbaseData.h";
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      outputPath = argv[++i];
+    } else {
+      fprintf(stderr, "usage: bitbase_gen [--threads N] [-o header.h]\n");
+      return 2;
+    }
+  }
+  if (threads < 1) {
+    threads = 1;
+  }
+  printf("%d threads\n", threads);
+
+  solve(kqk, CHESS_QUEEN, threads);
+  report("KQK", kqk);
+  solve(krk, CHESS_ROOK, threads);
+  report("KRK", krk);
+  solve(kpk, CHESS_PAWN, threads);
+  report("KPK", kpk);
+  pack();
+
+  int errors = checkProbes(krk) + checkProbes(kpk);
+  printf("probe check: %d mismatches\n", errors);
+  for (const SpotCheck &check : spotChecks) {
+    ChessPosition position;
+    position.setFen(check.fen);
+    int result = probeBitbase(position);
+    bool ok = result == check.expected;
+    errors += !ok;
+    printf("  %-40s %-4s %-45s %s\n", check.fen, result == BITBASE_WIN ? "win" : "draw", check.why, ok ? "ok" : "WRONG");
+  }
+  if (errors) {
+    fprintf(stderr, "%d errors, header not written\n", errors);
+    return 1;
+  }
+
+  uint32_t checksum = 2166136261u; // FNV-1a over both tables
+  for (uint8_t byte : kpkBits) {
+    checksum = (checksum ^ byte) * 16777619u;
+  }
+  for (uint8_t byte : krkBits) {
+    checksum = (checksum ^ byte) * 16777619u;
+  }
+
+  FILE *header = fopen(outputPath, "w");
+  if (!header) {
+    fprintf(stderr, "cannot write %s\n", outputPath);
+    return 1;
+  }
+  fprintf(header, "#ifndef BITBASEDATA_H\n#define BITBASEDATA_H\n\n#include <stdint.h>\n\n");
+  fprintf(header, "// Generated by tools/bitbase_gen.cpp; layout in bitbase.h. Checksum %08X. Do not edit.\n", checksum);
+  const struct {
+    const char *name;
+    const uint8_t *bits;
+    size_t size;
+  } tables[] = {{"kpkBits", kpkBits, sizeof(kpkBits)}, {"krkBits", krkBits, sizeof(krkBits)}};
+  for (const auto &table : tables) {
+    fprintf(header, "const uint8_t %s[%zu] = {\n", table.name, table.size);
+    for (size_t i = 0; i < table.size; i++) {
+      fprintf(header, "0x%02X,%s", table.bits[i], i % 16 == 15 ? "\n" : " ");
+    }
+    fprintf(header, "};\n\n");
+  }
+  fprintf(header, "#endif\n");
+  fclose(header);
+  printf("wrote %s: %zu bytes, checksum %08X\n", outputPath, sizeof(kpkBits) + sizeof(krkBits), checksum);
+  return 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file book_gen.cpp
+ * @brief Builds the opening book (src/openingBookData.h) from PGN games.
+ *
+ * Replays the first plies of every game with the engine's own move generator,
+ * and for each position reached records the move played. Identical (position,
+ * move) pairs are merged and their weights added up: a move from a game its side
+ * went on to win counts 2, a draw or a game without a result ("*", as in the
+ * hand-written tools/openings.pgn) counts 1, and a loss counts 0. Moves that end
+ * with weight 0 are left out. Weights above 65535 are scaled down to fit.
+ *
+ * The book is sorted by key and written in the firmware's own format described in
+ * src/openingBook.h (Polyglot's entry layout, keyed with the engine's Zobrist keys,
+ * so not readable by Polyglot tools). --bin also writes the raw entries, for
+ * inspection. If the book would exceed the size cap, the lowest-weight entries
+ * are dropped. The default cap of 64 KB (4096 entries) is a small share of the
+ * 3 MB app partition of the default 8 MB partition table the firmware is built
+ * with, so the book cannot crowd out the sprites. Before writing, every entry is read back through OpeningBook and must
+ * turn into a legal move of its position.
+ *
+ * PGN support: tag pairs, move numbers, comments ({...} and ;...), variations
+ * (skipped), NAGs ($n), check and annotation marks, and castling as O-O or 0-0.
+ * A move that does not parse or is not legal stops that game with a warning.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -Isrc tools/book_gen.cpp -o /tmp/book_gen
+ *   /tmp/book_gen [--plies N] [--max-bytes N] [--bin book.bin] [-o src/openingBookData.h] tools/openings.pgn ...
+ */
+
+#include <algorithm>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openingBook.h"
+#include "pgn.h"
+
+#define BOOK_DEFAULT_PLIES 16
+#define BOOK_DEFAULT_MAX_BYTES 65536
+
+static const char *startFen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+struct BookEntry {
+  uint64_t key;
+  uint16_t move;
+  uint32_t weight;
+};
+
+static void putBig(std::vector<uint8_t> &out, uint64_t value, int bytes) {
+  for (int i = bytes - 1; i >= 0; i--) {
+    out.push_back((uint8_t)(value >> (8 * i)));
+  }
+}
+
+int main(int argc, char **argv) {
+  int plies = BOOK_DEFAULT_PLIES;
+  size_t maxBytes = BOOK_DEFAULT_MAX_BYTES;
+  const char *headerPath = "src/openingBookData.h";
+  const char *binPath = nullptr;
+  std::vector<const char *> inputs;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--plies") && i + 1 < argc) {
+      plies = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--max-bytes") && i + 1 < argc) {
+      maxBytes = (size_t)atol(argv[++i]);
+    } else if (!strcmp(argv[i], "--bin") && i + 1 < argc) {
+      binPath = argv[++i];
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      headerPath = argv[++i];
+    } else {
+      inputs.push_back(argv[i]);
+    }
+  }
+  if (inputs.empty()) {
+    fprintf(stderr, "usage: book_gen [--plies N] [--max-bytes N] [--bin book.bin] [-o header.h] games.pgn ...\n");
+    return 2;
+  }
+
+  // Merge (key, move) pairs; the position is kept for the read-back check.
+  std::map<std::pair<uint64_t, uint16_t>, uint32_t> weights;
+  std::map<uint64_t, ChessPosition> positions;
+  int gameCount = 0, rejected = 0;
+  for (const char *path : inputs) {
+    std::string text;
+    if (!readFile(path, text)) {
+      fprintf(stderr, "cannot read %s\n", path);
+      return 1;
+    }
+    for (const PgnGame &game : readPgn(text)) {
+      gameCount++;
+      int winner = game.result == "1-0" ? 1 : game.result == "0-1" ? -1 : 0;
+      ChessPosition position;
+      position.setFen(startFen);
+      for (int ply = 0; ply < plies && ply < (int)game.moves.size(); ply++) {
+        ChessMove move = parseSan(position, game.moves[ply]);
+        if (move == 0) {
+          fprintf(stderr, "%s: game %d: cannot play \"%s\" at ply %d\n", path, gameCount, game.moves[ply].c_str(),
+                  ply + 1);
+          rejected++;
+          break;
+        }
+        uint32_t weight = winner == 0 ? 1 : winner == position.sideToMove() ? 2 : 0;
+        weights[{position.key(), encodeBookMove(move)}] += weight;
+        positions.emplace(position.key(), position);
+        position.makeMove(move);
+      }
+    }
+  }
+
+  std::vector<BookEntry> entries;
+  uint32_t heaviest = 0;
+  for (const auto &item : weights) {
+    if (item.second > 0) {
+      entries.push_back({item.first.first, item.first.second, item.second});
+      heaviest = std::max(heaviest, item.second);
+    }
+  }
+  if (heaviest > 65535) {
+    for (BookEntry &entry : entries) {
+      entry.weight = std::max<uint32_t>(1, (uint32_t)((uint64_t)entry.weight * 65535 / heaviest));
+    }
+  }
+  size_t dropped = 0;
+  size_t capacity = maxBytes / CHESS_BOOK_ENTRY_BYTES;
+  if (entries.size() > capacity) {
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const BookEntry &a, const BookEntry &b) { return a.weight > b.weight; });
+    dropped = entries.size() - capacity;
+    entries.resize(capacity);
+  }
+  if (entries.empty()) {
+    fprintf(stderr, "no book entries\n");
+    return 1;
+  }
+  std::sort(entries.begin(), entries.end(), [](const BookEntry &a, const BookEntry &b) {
+    return a.key != b.key ? a.key < b.key : a.weight != b.weight ? a.weight > b.weight : a.move < b.move;
+  });
+
+  std::vector<uint8_t> blob;
+  for (const BookEntry &entry : entries) {
+    putBig(blob, entry.key, 8);
+    putBig(blob, entry.move, 2);
+    putBig(blob, entry.weight, 2);
+    putBig(blob, 0, 4);
+  }
+
+  // Read back through the firmware's lookup code.
+  OpeningBook book(blob.data(), blob.size());
+  int bad = 0;
+  for (uint32_t i = 0; i < book.size(); i++) {
+    const ChessPosition &position = positions.at(book.keyAt(i));
+    bad += OpeningBook::legalMove(position, book.moveAt(i)) == 0;
+    bad += book.probe(position, i) == 0;
+  }
+  if (bad) {
+    fprintf(stderr, "%d entries failed the read-back check\n", bad);
+    return 1;
+  }
+
+  FILE *header = fopen(headerPath, "w");
+  if (!header) {
+    fprintf(stderr, "cannot write %s\n", headerPath);
+    return 1;
+  }
+  fprintf(header, "#ifndef OPENINGBOOKDATA_H\n#define OPENINGBOOKDATA_H\n\n#include <stdint.h>\n\n");
+  fprintf(header, "// Generated by tools/book_gen.cpp (first %d plies of %d games): %zu entries, %zu bytes.\n", plies,
+          gameCount, entries.size(), blob.size());
+  fprintf(header, "// Private book format keyed with the engine's Zobrist keys; see openingBook.h. Do not edit.\n");
+  fprintf(header, "alignas(8) const uint8_t openingBookData[] = {\n");
+  for (size_t i = 0; i < blob.size(); i++) {
+    fprintf(header, "0x%02X,%s", blob[i], i % CHESS_BOOK_ENTRY_BYTES == CHESS_BOOK_ENTRY_BYTES - 1 ? "\n" : " ");
+  }
+  fprintf(header, "};\n\n#endif\n");
+  fclose(header);
+
+  if (binPath) {
+    FILE *bin = fopen(binPath, "wb");
+    if (!bin || fwrite(blob.data(), 1, blob.size(), bin) != blob.size()) {
+      fprintf(stderr, "cannot write %s\n", binPath);
+      return 1;
+    }
+    fclose(bin);
+  }
+
+  printf("%d games, %d stopped early, %zu positions, %zu entries (%zu bytes, cap %zu), %zu dropped by the cap\n",
+         gameCount, rejected, positions.size(), entries.size(), blob.size(), maxBytes, dropped);
+  return 0;
+}
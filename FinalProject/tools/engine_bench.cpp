@@ -0,0 +1,211 @@
+/**
+ * @file engine_bench.cpp
+ * @brief Host report of the chess engine's speed, determinism and strength per node budget.
+ *
+ * Builds only the Arduino-free chess headers (src/chessSearch.h and what it
+ * includes). Three parts:
+ *  - Search speed: each test position is searched with the device's node
+ *    budget; the report lists the depth reached, nodes, nodes per second and
+ *    the move chosen. Every search is run twice and must return the same move,
+ *    score and node count, which is what makes the device and host agree.
+ *  - Transposition table: each test position is searched to a fixed depth
+ *    without and with the table; the report lists the nodes of both, the node
+ *    reduction and the table's hit rate (probes that found the position).
+ *  - Tactics: a few positions with one clearly best move (mates, winning
+ *    captures) that the default budget must find.
+ *  - Budget scaling: matches between the engine at budget N and at 4N from a
+ *    set of short openings, each opening played with both colors. Games end on
+ *    mate, stalemate, or after CHESS_BENCH_MAX_PLIES plies, where the material
+ *    balance decides (a margin of a minor piece or more wins). A repeated
+ *    position scores as a draw inside the search, so games rarely shuffle.
+ *
+ * Like the firmware, the searches other than the no-table column use a
+ * CHESS_TT_BYTES transposition table, cleared before each game.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -Isrc tools/engine_bench.cpp -o /tmp/engine_bench && /tmp/engine_bench
+ * Add -DUSE_NNUE_EVAL to search with the network evaluator (its scalar kernels).
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chessSearch.h"
+
+// Node budget and table size the firmware uses (CHESS_ENGINE_NODES and CHESS_TT_BYTES in main.cpp).
+#define CHESS_BENCH_DEVICE_NODES 60000
+#define CHESS_TT_BYTES (3u << 20)
+#define CHESS_BENCH_TT_DEPTH 6
+#define CHESS_BENCH_MAX_PLIES 160
+
+static const char *speedPositions[] = {
+  "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+  "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+  "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+  "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+  "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+  "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+};
+
+struct Tactic {
+  const char *name;
+  const char *fen;
+  const char *best; // expected move in UCI notation
+};
+
+static const Tactic tactics[] = {
+  {"back rank mate", "6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1", "d1d8"},
+  {"scholar's mate", "r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5Q2/PPPP1PPP/RNB1K1NR w KQkq - 0 1", "f3f7"},
+  {"hanging queen", "rnb1kbnr/pppp1ppp/8/4p1q1/3P4/2N5/PPP1PPPP/R1BQKBNR w KQkq - 0 1", "c1g5"},
+  {"knight fork", "r3k3/8/8/1N6/8/8/8/4K3 w - - 0 1", "b5c7"},
+  {"mate in two", "r1b1kb1r/pppp1ppp/5q2/4n3/3KP3/2N3PN/PPP4P/R1BQ1B1R b kq - 0 1", "f8c5"},
+};
+
+static const char *openings[] = {
+  "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1",
+  "rnbqkbnr/pppppppp/8/8/3P4/8/PPP1PPPP/RNBQKBNR b KQkq - 0 1",
+  "rnbqkbnr/pp1ppppp/8/2p5/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 0 2",
+  "rnbqkbnr/pppp1ppp/4p3/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 0 2",
+  "rnbqkb1r/pppppppp/5n2/8/2P5/8/PP1PPPPP/RNBQKBNR w KQkq - 1 2",
+  "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+};
+
+static const char *moveName(ChessMove move) {
+  static char name[6];
+  static const char letters[7] = {0, 'p', 'b', 'n', 'r', 'q', 'k'};
+  int from = moveFrom(move), to = moveTo(move);
+  name[0] = 'a' + from % 8;
+  name[1] = '8' - from / 8;
+  name[2] = 'a' + to % 8;
+  name[3] = '8' - to / 8;
+  name[4] = moveKind(move) == MOVE_PROMOTION ? letters[movePromotion(move)] : 0;
+  name[5] = 0;
+  return name;
+}
+
+static int materialBalance(const ChessPosition &position) {
+  int balance = 0;
+  for (int square = 0; square < 64; square++) {
+    int piece = position.pieceAt(square);
+    if (piece != 0 && abs(piece) != CHESS_KING) {
+      balance += (piece > 0 ? 1 : -1) * chessEvalTables::pieceValue[abs(piece)];
+    }
+  }
+  return balance;
+}
+
+// Plays one game; returns 1 if white wins, -1 if black wins, 0 for a draw.
+static int playGame(ChessSearch &engine, TranspositionTable &table, const char *fen, uint32_t whiteNodes,
+                    uint32_t blackNodes) {
+  table.clear();
+  ChessPosition position;
+  position.setFen(fen);
+  for (int ply = 0; ply < CHESS_BENCH_MAX_PLIES; ply++) {
+    ChessSearchLimits limits;
+    limits.maxNodes = position.sideToMove() > 0 ? whiteNodes : blackNodes;
+    ChessSearchResult result = engine.search(position, limits);
+    if (result.move == 0) {
+      return position.inCheck(position.sideToMove()) ? -position.sideToMove() : 0;
+    }
+    position.makeMove(result.move);
+    if (position.repetitions() >= 2) {
+      return 0;
+    }
+  }
+  int balance = materialBalance(position);
+  return balance >= CHESS_VALUE_KNIGHT ? 1 : balance <= -CHESS_VALUE_KNIGHT ? -1 : 0;
+}
+
+int main() {
+  static ChessSearch engine; // about 55 KB: keep it off the stack
+  static TranspositionTable table;
+  void *tableMemory = malloc(CHESS_TT_BYTES);
+  table.attach(tableMemory, CHESS_TT_BYTES);
+  engine.setTable(&table);
+
+  printf("Search with the device budget of %d nodes (host)\n", CHESS_BENCH_DEVICE_NODES);
+  printf("%-10s | %5s %8s %10s %7s | %-6s %s\n", "position", "depth", "nodes", "nodes/s", "score", "move", "repeatable");
+  uint64_t totalNodes = 0;
+  double totalSeconds = 0;
+  int unrepeatable = 0;
+  for (size_t i = 0; i < sizeof(speedPositions) / sizeof(speedPositions[0]); i++) {
+    ChessPosition position;
+    position.setFen(speedPositions[i]);
+    ChessSearchLimits limits;
+    limits.maxNodes = CHESS_BENCH_DEVICE_NODES;
+    table.clear();
+    auto start = std::chrono::steady_clock::now();
+    ChessSearchResult result = engine.search(position, limits);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    table.clear();
+    ChessSearchResult again = engine.search(position, limits);
+    bool same = again.move == result.move && again.score == result.score && again.nodes == result.nodes &&
+                again.depth == result.depth;
+    unrepeatable += !same;
+    totalNodes += result.nodes;
+    totalSeconds += seconds;
+    printf("%-10zu | %5d %8u %10.0f %7d | %-6s %s\n", i + 1, result.depth, result.nodes, result.nodes / seconds,
+           result.score, moveName(result.move), same ? "yes" : "NO");
+  }
+  printf("average %.0f nodes/s\n\n", totalNodes / totalSeconds);
+
+  printf("Transposition table (%u KB) at fixed depth %d\n", (unsigned)(table.bytes() / 1024), CHESS_BENCH_TT_DEPTH);
+  printf("%-10s | %10s %10s | %9s | %8s %s\n", "position", "no table", "table", "reduction", "hit rate", "same move");
+  uint64_t plainTotal = 0, tableTotal = 0;
+  for (size_t i = 0; i < sizeof(speedPositions) / sizeof(speedPositions[0]); i++) {
+    ChessPosition position;
+    position.setFen(speedPositions[i]);
+    ChessSearchLimits limits;
+    limits.maxDepth = CHESS_BENCH_TT_DEPTH;
+    engine.setTable(nullptr);
+    ChessSearchResult plain = engine.search(position, limits);
+    engine.setTable(&table);
+    table.clear();
+    ChessSearchResult hashed = engine.search(position, limits);
+    plainTotal += plain.nodes;
+    tableTotal += hashed.nodes;
+    printf("%-10zu | %10u %10u | %8.1f%% | %7.1f%% %s\n", i + 1, plain.nodes, hashed.nodes,
+           100.0 * (1.0 - (double)hashed.nodes / plain.nodes), 100.0 * table.hits / table.probes,
+           plain.move == hashed.move ? "yes" : "no");
+  }
+  printf("total      | %10llu %10llu | %8.1f%%\n\n", (unsigned long long)plainTotal, (unsigned long long)tableTotal,
+         100.0 * (1.0 - (double)tableTotal / plainTotal));
+
+  printf("Tactics at %d nodes\n", CHESS_BENCH_DEVICE_NODES);
+  int missed = 0;
+  for (const Tactic &t : tactics) {
+    ChessPosition position;
+    position.setFen(t.fen);
+    ChessSearchLimits limits;
+    limits.maxNodes = CHESS_BENCH_DEVICE_NODES;
+    table.clear();
+    ChessSearchResult result = engine.search(position, limits);
+    bool found = strcmp(moveName(result.move), t.best) == 0;
+    missed += !found;
+    printf("%-16s | depth %2d score %6d | %-6s (expected %s) %s\n", t.name, result.depth, result.score,
+           moveName(result.move), t.best, found ? "" : "MISSED");
+  }
+
+  printf("\nBudget scaling: N against 4N, every opening with both colors\n");
+  printf("%8s %8s | %5s %5s %5s | %s\n", "N", "4N", "wins", "draws", "losses", "score of 4N");
+  static const uint32_t budgets[] = {1000, 4000, 16000};
+  for (uint32_t n : budgets) {
+    int wins = 0, draws = 0, losses = 0;
+    for (const char *fen : openings) {
+      for (int strongIsWhite = 0; strongIsWhite <= 1; strongIsWhite++) {
+        int outcome = strongIsWhite ? playGame(engine, table, fen, 4 * n, n)
+                                    : -playGame(engine, table, fen, n, 4 * n);
+        wins += outcome > 0;
+        draws += outcome == 0;
+        losses += outcome < 0;
+      }
+    }
+    printf("%8u %8u | %5d %5d %5d | %.1f%%\n", n, 4 * n, wins, draws, losses,
+           100.0 * (wins + 0.5 * draws) / (wins + draws + losses));
+  }
+  free(tableMemory);
+  printf("\n%d unrepeatable searches, %d missed tactics\n", unrepeatable, missed);
+  return unrepeatable == 0 && missed == 0 ? 0 : 1;
+}
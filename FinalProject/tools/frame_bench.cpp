@@ -0,0 +1,123 @@
+/**
+ * @file frame_bench.cpp
+ * @brief Host report of SPI traffic per frame with and without the frame buffer.
+ *
+ * main.cpp is compiled with USE_FRAMEBUFFER against the host stand-ins and a
+ * fixed sequence of frames from the menu, battle and chess scenes is drawn
+ * twice: once straight to the panel (frame buffer switched off) and once into
+ * the frame buffer followed by flush(). For every frame the report lists SPI
+ * transactions, address windows, bytes and modelled bus time for both modes,
+ * the number of dirty rectangles flushed, and whether the panel ended up
+ * pixel-identical.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -Itools/host -Isrc tools/frame_bench.cpp -o /tmp/frame_bench && /tmp/frame_bench
+ */
+
+#define USE_FRAMEBUFFER
+#include "main.cpp"
+
+#include <functional>
+#include <vector>
+
+struct Frame {
+  const char *name;
+  std::function<void()> draw;
+};
+
+static std::vector<Frame> frames() {
+  return {
+    {"menu", [] { drawMenu(); drawMenuCursor(-1, 0); }},
+    {"menu cursor", [] { drawMenuCursor(0, 1); }},
+    {"battle scene", [] { resetPokemonBattler(); }},
+    {"battle message", [] { drawBattleMessage("Leafle used Tackle!"); }},
+    {"battle HP", [] {
+      // Every animation step of the drain, sent as it would be frame by frame.
+      enemyPokemon.takeDamage(3);
+      playerPokemon.takeDamage(2);
+      updateHPUI();
+      while (stepHPUI()) presentFrame();
+    }},
+    {"battle redraw", [] { drawBattleScene(); drawPokemonBattlerUI(); }},
+    {"chess board", [] { buildChessTiles(); drawChessBoard(); drawChessCursor(52, -1); }},
+    {"chess cursor", [] { drawChessCursor(44, 52); }},
+    {"chess move e2e4", [] {
+      playChessMove(52, 36);
+      updateChessBoard();
+      drawChessCursor(36, 44);
+    }},
+  };
+}
+
+struct FrameStats {
+  HostSpiStats spi;
+  int dirty = 0;
+  std::vector<uint16_t> panel;
+};
+
+static std::vector<uint16_t> snapshot() {
+  std::vector<uint16_t> panel((size_t)tft.width() * tft.height());
+  for (int y = 0; y < tft.height(); y++)
+    for (int x = 0; x < tft.width(); x++) panel[(size_t)y * tft.width() + x] = tft.panelPixel(x, y);
+  return panel;
+}
+
+// Runs the whole sequence from the same starting state and records each frame.
+static std::vector<FrameStats> runSequence(bool buffered) {
+  auto initialBoard = chessBoard;
+  syncChessPosition();
+  randomSeed(1);
+  tft.setFrameBufferEnabled(buffered);
+  tft.fillScreen(BLACK);
+  presentFrame();
+
+  std::vector<FrameStats> stats;
+  for (const Frame &frame : frames()) {
+    FrameStats s;
+    tft.spiStats.reset();
+    frame.draw();
+    s.dirty = tft.dirtyCount();
+    presentFrame();
+    s.spi = tft.spiStats;
+    s.panel = snapshot();
+    stats.push_back(s);
+  }
+  chessBoard = initialBoard;
+  return stats;
+}
+
+int main() {
+  tft.begin();
+  tft.setRotation(3);
+
+  std::vector<FrameStats> direct = runSequence(false);
+  std::vector<FrameStats> buffered = runSequence(true);
+  std::vector<Frame> sequence = frames();
+
+  printf("Bytes sent per frame: direct drawing vs frame buffer + dirty-rect flush\n");
+  printf("%-16s | %6s %6s %8s %9s | %5s %6s %8s %9s | %s\n", "frame", "trans", "wins", "bytes", "bus us", "rects",
+         "wins", "bytes", "bus us", "speedup");
+  uint64_t directBytes = 0, bufferedBytes = 0;
+  double directUs = 0, bufferedUs = 0;
+  bool allMatch = true;
+  for (size_t i = 0; i < sequence.size(); i++) {
+    const HostSpiStats &d = direct[i].spi;
+    const HostSpiStats &b = buffered[i].spi;
+    bool match = direct[i].panel == buffered[i].panel;
+    allMatch = allMatch && match;
+    directBytes += d.bytes;
+    bufferedBytes += b.bytes;
+    directUs += d.estimatedMicros();
+    bufferedUs += b.estimatedMicros();
+    printf("%-16s | %6llu %6llu %8llu %9.0f | %5d %6llu %8llu %9.0f | %6.1fx%s\n", sequence[i].name,
+           (unsigned long long)d.transactions, (unsigned long long)d.windows, (unsigned long long)d.bytes,
+           d.estimatedMicros(), buffered[i].dirty, (unsigned long long)b.windows, (unsigned long long)b.bytes,
+           b.estimatedMicros(), b.estimatedMicros() > 0 ? d.estimatedMicros() / b.estimatedMicros() : 0.0,
+           match ? "" : "  MISMATCH");
+  }
+  printf("%-16s | %6s %6s %8llu %9.0f | %5s %6s %8llu %9.0f | %6.1fx\n", "total", "", "",
+         (unsigned long long)directBytes, directUs, "", "", (unsigned long long)bufferedBytes, bufferedUs,
+         directUs / bufferedUs);
+  printf("\n%s\n", allMatch ? "panel identical after every frame" : "PANEL MISMATCH");
+  return allMatch ? 0 : 1;
+}
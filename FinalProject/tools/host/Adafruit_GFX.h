@@ -0,0 +1,241 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+// Host stand-in for Adafruit GFX. The drawing algorithms follow the library's
+// structure (same virtual primitives, same startWrite()/endWrite() nesting and
+// the same classic-font drawChar() that paints one pixel or one scaled rect
+// per glyph dot) so the SPI traffic counted by the ILI9341 stand-in matches
+// what the firmware sends on the device.
+
+#include <Arduino.h>
+
+// Classic 5x7 ASCII glyphs, column-major, LSB at the top (same layout as the
+// library's glcdfont.c). Characters outside 0x20-0x7E render as blanks.
+static const uint8_t hostClassicFont[95][5] PROGMEM = {
+  {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00},
+  {0x14, 0x7F, 0x14, 0x7F, 0x14}, {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},
+  {0x36, 0x49, 0x56, 0x20, 0x50}, {0x00, 0x08, 0x07, 0x03, 0x00}, {0x00, 0x1C, 0x22, 0x41, 0x00},
+  {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x2A, 0x1C, 0x7F, 0x1C, 0x2A}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+  {0x00, 0x80, 0x70, 0x30, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x00, 0x60, 0x60, 0x00},
+  {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},
+  {0x72, 0x49, 0x49, 0x49, 0x46}, {0x21, 0x41, 0x49, 0x4D, 0x33}, {0x18, 0x14, 0x12, 0x7F, 0x10},
+  {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x31}, {0x41, 0x21, 0x11, 0x09, 0x07},
+  {0x36, 0x49, 0x49, 0x49, 0x36}, {0x46, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x00, 0x14, 0x00, 0x00},
+  {0x00, 0x40, 0x34, 0x00, 0x00}, {0x00, 0x08, 0x14, 0x22, 0x41}, {0x14, 0x14, 0x14, 0x14, 0x14},
+  {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x59, 0x09, 0x06}, {0x3E, 0x41, 0x5D, 0x59, 0x4E},
+  {0x7C, 0x12, 0x11, 0x12, 0x7C}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+  {0x7F, 0x41, 0x41, 0x41, 0x3E}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01},
+  {0x3E, 0x41, 0x41, 0x51, 0x73}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},
+  {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40},
+  {0x7F, 0x02, 0x1C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+  {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46},
+  {0x26, 0x49, 0x49, 0x49, 0x32}, {0x03, 0x01, 0x7F, 0x01, 0x03}, {0x3F, 0x40, 0x40, 0x40, 0x3F},
+  {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, {0x63, 0x14, 0x08, 0x14, 0x63},
+  {0x03, 0x04, 0x78, 0x04, 0x03}, {0x61, 0x59, 0x49, 0x4D, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x41},
+  {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x41, 0x7F}, {0x04, 0x02, 0x01, 0x02, 0x04},
+  {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x03, 0x07, 0x08, 0x00}, {0x20, 0x54, 0x54, 0x78, 0x40},
+  {0x7F, 0x28, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x28}, {0x38, 0x44, 0x44, 0x28, 0x7F},
+  {0x38, 0x54, 0x54, 0x54, 0x18}, {0x00, 0x08, 0x7E, 0x09, 0x02}, {0x18, 0xA4, 0xA4, 0x9C, 0x78},
+  {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x40, 0x3D, 0x00},
+  {0x7F, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x78, 0x04, 0x78},
+  {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0xFC, 0x18, 0x24, 0x24, 0x18},
+  {0x18, 0x24, 0x24, 0x18, 0xFC}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x24},
+  {0x04, 0x04, 0x3F, 0x44, 0x24}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C},
+  {0x3C, 0x40, 0x30, 0x40, 0x3C}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x4C, 0x90, 0x90, 0x90, 0x7C},
+  {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x77, 0x00, 0x00},
+  {0x00, 0x41, 0x36, 0x08, 0x00}, {0x02, 0x01, 0x02, 0x04, 0x02},
+};
+
+class Adafruit_GFX : public Print {
+  protected:
+    int16_t WIDTH;
+    int16_t HEIGHT;
+    int16_t _width;
+    int16_t _height;
+    uint8_t rotation = 0;
+    int16_t cursor_x = 0;
+    int16_t cursor_y = 0;
+    uint16_t textcolor = 0xFFFF;
+    uint16_t textbgcolor = 0xFFFF;
+    uint8_t textsize_x = 1;
+    uint8_t textsize_y = 1;
+    bool wrap = true;
+
+  public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void startWrite() {}
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      fillRect(x, y, w, h, color);
+    }
+    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      drawFastVLine(x, y, h, color);
+    }
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      drawFastHLine(x, y, w, color);
+    }
+    virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+      bool steep = abs(y1 - y0) > abs(x1 - x0);
+      if (steep) { std::swap(x0, y0); std::swap(x1, y1); }
+      if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+      int16_t dx = x1 - x0;
+      int16_t dy = abs(y1 - y0);
+      int16_t err = dx / 2;
+      int16_t ystep = (y0 < y1) ? 1 : -1;
+      for (; x0 <= x1; x0++) {
+        if (steep) writePixel(y0, x0, color);
+        else writePixel(x0, y0, color);
+        err -= dy;
+        if (err < 0) { y0 += ystep; err += dx; }
+      }
+    }
+    virtual void endWrite() {}
+
+    virtual void setRotation(uint8_t r) {
+      rotation = r & 3;
+      if (rotation & 1) { _width = HEIGHT; _height = WIDTH; }
+      else { _width = WIDTH; _height = HEIGHT; }
+    }
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      startWrite();
+      writeLine(x, y, x, y + h - 1, color);
+      endWrite();
+    }
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      startWrite();
+      writeLine(x, y, x + w - 1, y, color);
+      endWrite();
+    }
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      startWrite();
+      for (int16_t i = x; i < x + w; i++) writeFastVLine(i, y, h, color);
+      endWrite();
+    }
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+      if (x0 == x1) {
+        if (y0 > y1) std::swap(y0, y1);
+        drawFastVLine(x0, y0, y1 - y0 + 1, color);
+      } else if (y0 == y1) {
+        if (x0 > x1) std::swap(x0, x1);
+        drawFastHLine(x0, y0, x1 - x0 + 1, color);
+      } else {
+        startWrite();
+        writeLine(x0, y0, x1, y1, color);
+        endWrite();
+      }
+    }
+    virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      startWrite();
+      writeFastHLine(x, y, w, color);
+      writeFastHLine(x, y + h - 1, w, color);
+      writeFastVLine(x, y, h, color);
+      writeFastVLine(x + w - 1, y, h, color);
+      endWrite();
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+      int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+      startWrite();
+      writePixel(x0, y0 + r, color);
+      writePixel(x0, y0 - r, color);
+      writePixel(x0 + r, y0, color);
+      writePixel(x0 - r, y0, color);
+      while (x < y) {
+        if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+        x++; ddF_x += 2; f += ddF_x;
+        writePixel(x0 + x, y0 + y, color);
+        writePixel(x0 - x, y0 + y, color);
+        writePixel(x0 + x, y0 - y, color);
+        writePixel(x0 - x, y0 - y, color);
+        writePixel(x0 + y, y0 + x, color);
+        writePixel(x0 - y, y0 + x, color);
+        writePixel(x0 + y, y0 - x, color);
+        writePixel(x0 - y, y0 - x, color);
+      }
+      endWrite();
+    }
+
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
+      startWrite();
+      for (int16_t j = 0; j < h; j++, y++)
+        for (int16_t i = 0; i < w; i++) writePixel(x + i, y, pgm_read_word(&bitmap[j * w + i]));
+      endWrite();
+    }
+
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
+      if ((x >= _width) || (y >= _height) || ((x + 6 * size_x - 1) < 0) || ((y + 8 * size_y - 1) < 0)) return;
+      startWrite();
+      for (int8_t i = 0; i < 5; i++) {
+        uint8_t line = (c >= 0x20 && c <= 0x7E) ? pgm_read_byte(&hostClassicFont[c - 0x20][i]) : 0;
+        for (int8_t j = 0; j < 8; j++, line >>= 1) {
+          if (line & 1) {
+            if (size_x == 1 && size_y == 1) writePixel(x + i, y + j, color);
+            else writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, color);
+          } else if (bg != color) {
+            if (size_x == 1 && size_y == 1) writePixel(x + i, y + j, bg);
+            else writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
+          }
+        }
+      }
+      if (bg != color) {
+        if (size_x == 1 && size_y == 1) writeFastVLine(x + 5, y, 8, bg);
+        else writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+      }
+      endWrite();
+    }
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+      drawChar(x, y, c, color, bg, size, size);
+    }
+
+    size_t write(uint8_t c) override {
+      if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      } else if (c != '\r') {
+        if (wrap && ((cursor_x + textsize_x * 6) > _width)) {
+          cursor_x = 0;
+          cursor_y += textsize_y * 8;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        cursor_x += textsize_x * 6;
+      }
+      return 1;
+    }
+    using Print::write;
+
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+    void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+    void setTextSize(uint8_t s) { textsize_x = textsize_y = (s > 0) ? s : 1; }
+    void setTextWrap(bool w) { wrap = w; }
+    void setFont() {}
+    int16_t getCursorX() const { return cursor_x; }
+    int16_t getCursorY() const { return cursor_y; }
+    uint8_t getRotation() const { return rotation; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+};
+
+class GFXcanvas16 : public Adafruit_GFX {
+  private:
+    uint16_t *buffer;
+
+  public:
+    GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+      buffer = (uint16_t *)calloc((size_t)w * h, sizeof(uint16_t));
+    }
+    ~GFXcanvas16() { free(buffer); }
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      if (buffer && x >= 0 && y >= 0 && x < _width && y < _height) buffer[x + y * WIDTH] = color;
+    }
+    void fillScreen(uint16_t color) override {
+      if (buffer) for (uint32_t i = 0; i < (uint32_t)WIDTH * HEIGHT; i++) buffer[i] = color;
+    }
+    uint16_t *getBuffer() const { return buffer; }
+};
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef HOST_ADAFRUIT_ILI9341_H
+#define HOST_ADAFRUIT_ILI9341_H
+
+// Host stand-in for Adafruit_SPITFT / Adafruit_ILI9341. Nothing is sent
+// anywhere: every transaction, address window and data byte the real driver
+// would put on the SPI bus is counted in spiStats, and the pixels land in a
+// shadow panel so two drawing paths can be compared for identical output.
+
+#include <Adafruit_GFX.h>
+#include <chrono>
+#include <vector>
+
+#define ILI9341_TFTWIDTH 240
+#define ILI9341_TFTHEIGHT 320
+
+// Bus model used to turn the counters into an estimated time on the device:
+// 40 MHz SPI clock, plus a fixed software cost for each transaction
+// (SPI.beginTransaction + CS) and each address window (three commands with DC
+// toggling). The constants are rough ESP32-S3 figures; only ratios matter.
+#define HOST_SPI_HZ 40000000.0
+#define HOST_SPI_TRANSACTION_US 1.5
+#define HOST_SPI_WINDOW_US 1.0
+// CASET + 4 bytes, PASET + 4 bytes, RAMWR.
+#define HOST_SPI_WINDOW_BYTES 11
+
+struct HostSpiStats {
+  uint64_t transactions = 0;
+  uint64_t windows = 0;
+  uint64_t bytes = 0;
+
+  void reset() { *this = HostSpiStats(); }
+  double estimatedMicros() const {
+    return bytes * 8.0 * 1e6 / HOST_SPI_HZ + transactions * HOST_SPI_TRANSACTION_US + windows * HOST_SPI_WINDOW_US;
+  }
+};
+
+// DMA simulation: writePixels(..., block = false) queues the transfer on a
+// virtual bus and returns at once; dmaWait() and every blocking bus operation
+// wait for the bus first. CPU time between bus calls is taken from the host
+// clock, scaled by HOST_CPU_SCALE as a rough host-to-ESP32-S3 factor, with the
+// stand-in's own bookkeeping excluded. HOST_DMA_QUEUE_US is the cost of
+// handing a transfer to the DMA side.
+#define HOST_CPU_SCALE 10.0
+#define HOST_DMA_QUEUE_US 2.0
+// CPU work the library does around each blocking transfer on the ESP32:
+// writePixels() byte-swaps the caller's buffer before sending and swaps it back
+// afterwards unless it is already big-endian, and writeColor() goes out as
+// writePixels() calls of 32 pixels from a small temporary buffer. Charged to
+// the CPU for blocking calls and to the bus side for queued ones.
+#define HOST_WRITEPIXELS_CALL_US 0.3
+#define HOST_SWAP_US_PER_PIXEL 0.02
+#define HOST_WRITECOLOR_CHUNK 32
+
+struct HostTimeline {
+  double now = 0;        // virtual time on the CPU side, in us
+  double busFreeAt = 0;  // when the bus finishes its queued work
+  double busBusy = 0;    // total bus time
+  double cpuBusy = 0;    // total CPU time outside bus calls
+  double cpuWaiting = 0; // CPU time spent waiting for the bus
+  std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
+
+  void reset() {
+    *this = HostTimeline();
+  }
+  // Charges the host time since the last bus call as CPU work.
+  void enter() {
+    auto t = std::chrono::steady_clock::now();
+    double us = std::chrono::duration<double, std::micro>(t - last).count() * HOST_CPU_SCALE;
+    now += us;
+    cpuBusy += us;
+  }
+  void leave() { last = std::chrono::steady_clock::now(); }
+  void waitBus() {
+    if (busFreeAt > now) {
+      cpuWaiting += busFreeAt - now;
+      now = busFreeAt;
+    }
+  }
+  void blocking(double cpuUs, double busUs) {
+    waitBus();
+    now += cpuUs + busUs;
+    cpuBusy += cpuUs;
+    busFreeAt = now;
+    busBusy += busUs;
+  }
+  void queued(double cpuUs, double busUs) {
+    waitBus();
+    now += HOST_DMA_QUEUE_US;
+    cpuBusy += HOST_DMA_QUEUE_US;
+    busFreeAt = now + cpuUs + busUs;
+    busBusy += busUs;
+  }
+};
+
+class Adafruit_SPITFT : public Adafruit_GFX {
+  protected:
+    int _nesting = 0;
+    int16_t _winX0 = 0, _winY0 = 0, _winX1 = 0, _winY1 = 0;
+    int16_t _curX = 0, _curY = 0;
+    std::vector<uint16_t> _panel;
+
+    void panelWrite(uint16_t color) {
+      if (_curX >= 0 && _curY >= 0 && _curX < _width && _curY < _height) {
+        _panel[_curY * 320 + _curX] = color;
+      }
+      if (++_curX > _winX1) {
+        _curX = _winX0;
+        if (++_curY > _winY1) _curY = _winY0;
+      }
+    }
+
+    // Runs one bus operation and charges its modelled time (plus the library's
+    // CPU work around it) to the timeline.
+    template <typename Fn>
+    void busOp(bool queued, double cpuUs, Fn fn) {
+      timeline.enter();
+      double before = spiStats.estimatedMicros();
+      fn();
+      double us = spiStats.estimatedMicros() - before;
+      if (queued) timeline.queued(cpuUs, us);
+      else timeline.blocking(cpuUs, us);
+      timeline.leave();
+    }
+    static double writePixelsCpu(uint32_t len, bool bigEndian) {
+      return HOST_WRITEPIXELS_CALL_US + (bigEndian ? 0.0 : len * HOST_SWAP_US_PER_PIXEL);
+    }
+
+  public:
+    HostSpiStats spiStats;
+    HostTimeline timeline;
+
+    Adafruit_SPITFT(uint16_t w, uint16_t h) : Adafruit_GFX(w, h), _panel(320 * 320, 0) {}
+
+    virtual void begin(uint32_t freq = 0) = 0;
+    virtual void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) = 0;
+
+    // Readback of the shadow panel; host only.
+    uint16_t panelPixel(int16_t x, int16_t y) const { return _panel[y * 320 + x]; }
+
+    void startWrite() override {
+      if (_nesting++ == 0) busOp(false, 0.0, [&] { spiStats.transactions++; });
+    }
+    void endWrite() override {
+      if (_nesting > 0) _nesting--;
+    }
+
+    void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool bigEndian = false) {
+      busOp(!block, writePixelsCpu(len, bigEndian), [&] {
+        spiStats.bytes += 2ull * len;
+        for (uint32_t i = 0; i < len; i++) {
+          uint16_t c = colors[i];
+          panelWrite(bigEndian ? (uint16_t)((c << 8) | (c >> 8)) : c);
+        }
+      });
+    }
+    void writeColor(uint16_t color, uint32_t len) {
+      uint32_t calls = (len + HOST_WRITECOLOR_CHUNK - 1) / HOST_WRITECOLOR_CHUNK;
+      double cpu = calls * writePixelsCpu(std::min(len, (uint32_t)HOST_WRITECOLOR_CHUNK), false);
+      busOp(false, cpu, [&] {
+        spiStats.bytes += 2ull * len;
+        for (uint32_t i = 0; i < len; i++) panelWrite(color);
+      });
+    }
+    void writePixel(uint16_t color) {
+      busOp(false, 0.0, [&] {
+        spiStats.bytes += 2;
+        panelWrite(color);
+      });
+    }
+    void dmaWait() {
+      timeline.enter();
+      timeline.waitBus();
+      timeline.leave();
+    }
+    bool dmaBusy() const { return timeline.busFreeAt > timeline.now; }
+
+    void writePixel(int16_t x, int16_t y, uint16_t color) override {
+      if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
+        setAddrWindow(x, y, 1, 1);
+        writePixel(color);
+      }
+    }
+    void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      setAddrWindow(x, y, w, h);
+      writeColor(color, (uint32_t)w * h);
+    }
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+      if (w < 0) { x += w + 1; w = -w; }
+      if (h < 0) { y += h + 1; h = -h; }
+      int16_t x2 = x + w - 1, y2 = y + h - 1;
+      if (w == 0 || h == 0 || x >= _width || y >= _height || x2 < 0 || y2 < 0) return;
+      if (x < 0) x = 0;
+      if (y < 0) y = 0;
+      if (x2 >= _width) x2 = _width - 1;
+      if (y2 >= _height) y2 = _height - 1;
+      writeFillRectPreclipped(x, y, x2 - x + 1, y2 - y + 1, color);
+    }
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { writeFillRect(x, y, w, 1, color); }
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { writeFillRect(x, y, 1, h, color); }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
+        startWrite();
+        setAddrWindow(x, y, 1, 1);
+        writePixel(color);
+        endWrite();
+      }
+    }
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+      startWrite();
+      writeFillRect(x, y, w, h, color);
+      endWrite();
+    }
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { fillRect(x, y, w, 1, color); }
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { fillRect(x, y, 1, h, color); }
+
+    // Same structure as the library: the window goes through the virtual
+    // setAddrWindow(), the rows through this class's own writePixels().
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h) {
+      int16_t x2, y2;
+      if (x >= _width || y >= _height || (x2 = x + w - 1) < 0 || (y2 = y + h - 1) < 0) return;
+      int16_t bx1 = 0, by1 = 0, saveW = w;
+      if (x < 0) { w += x; bx1 = -x; x = 0; }
+      if (y < 0) { h += y; by1 = -y; y = 0; }
+      if (x2 >= _width) w = _width - x;
+      if (y2 >= _height) h = _height - y;
+      pcolors += by1 * saveW + bx1;
+      startWrite();
+      setAddrWindow(x, y, w, h);
+      while (h--) {
+        writePixels(pcolors, w);
+        pcolors += saveW;
+      }
+      endWrite();
+    }
+    void pushColor(uint16_t color) {
+      startWrite();
+      writePixel(color);
+      endWrite();
+    }
+    void writeCommand(uint8_t cmd) {
+      (void)cmd;
+      busOp(false, 0.0, [&] { spiStats.bytes += 1; });
+    }
+    // Commands open their own transaction, as in the library.
+    void sendCommand(uint8_t commandByte, const uint8_t *dataBytes = nullptr, uint8_t numDataBytes = 0) {
+      (void)commandByte;
+      (void)dataBytes;
+      busOp(false, 0.0, [&] {
+        spiStats.transactions++;
+        spiStats.bytes += 1 + numDataBytes;
+      });
+    }
+    void invertDisplay(bool invert) { sendCommand(invert ? 0x21 : 0x20); }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+      return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+};
+
+class Adafruit_ILI9341 : public Adafruit_SPITFT {
+  public:
+    Adafruit_ILI9341(int8_t cs, int8_t dc, int8_t rst = -1)
+        : Adafruit_SPITFT(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT) {
+      (void)cs;
+      (void)dc;
+      (void)rst;
+    }
+
+    void begin(uint32_t freq = 0) override { (void)freq; }
+
+    void scrollTo(uint16_t y) {
+      uint8_t data[2] = {(uint8_t)(y >> 8), (uint8_t)y};
+      sendCommand(0x37, data, 2);
+    }
+    void setScrollMargins(uint16_t top, uint16_t bottom) {
+      uint8_t data[6] = {(uint8_t)(top >> 8), (uint8_t)top, 0, 0, (uint8_t)(bottom >> 8), (uint8_t)bottom};
+      sendCommand(0x33, data, 6);
+    }
+    uint8_t readcommand8(uint8_t commandByte, uint8_t index = 0) {
+      (void)commandByte;
+      (void)index;
+      busOp(false, 0.0, [&] {
+        spiStats.transactions++;
+        spiStats.bytes += 3;
+      });
+      return 0;
+    }
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override {
+      busOp(false, 0.0, [&] {
+        spiStats.windows++;
+        spiStats.bytes += HOST_SPI_WINDOW_BYTES;
+        _winX0 = x;
+        _winY0 = y;
+        _winX1 = x + w - 1;
+        _winY1 = y + h - 1;
+        _curX = x;
+        _curY = y;
+      });
+    }
+};
+
+#endif
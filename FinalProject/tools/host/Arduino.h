@@ -0,0 +1,123 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal stand-in for the Arduino core so the firmware headers (and main.cpp)
+// compile on Linux for the host-side benchmarks in tools/. Only the parts the
+// firmware actually uses are provided.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void * const *)(addr))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+using std::max;
+using std::min;
+template <typename T, typename L, typename H> inline T constrain(T x, L low, H high) { return x < low ? low : (x > high ? high : x); }
+
+inline unsigned long micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+// Host builds never want to actually sleep through debounce delays.
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned int) {}
+
+// Buttons are active-low with pull-ups, so an idle host reads every pin HIGH.
+inline void pinMode(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline void digitalWrite(uint8_t, uint8_t) {}
+
+// There is no separate PSRAM heap on the host.
+inline void *ps_malloc(size_t size) { return malloc(size); }
+
+inline long random(long howbig) { return howbig <= 0 ? 0 : rand() % howbig; }
+inline long random(long howsmall, long howbig) {
+  return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+inline void randomSeed(unsigned long seed) { srand((unsigned)seed); }
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    size_t write(const char *str) {
+      size_t n = 0;
+      while (*str) n += write((uint8_t)*str++);
+      return n;
+    }
+    size_t print(const char *str) { return write(str); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(const std::string &str) { return write(str.c_str()); }
+    size_t print(long n) {
+      char buf[24];
+      snprintf(buf, sizeof(buf), "%ld", n);
+      return write(buf);
+    }
+    size_t print(int n) { return print((long)n); }
+    size_t print(unsigned long n) {
+      char buf[24];
+      snprintf(buf, sizeof(buf), "%lu", n);
+      return write(buf);
+    }
+    size_t print(unsigned int n) { return print((unsigned long)n); }
+    size_t print(double n) {
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%.2f", n);
+      return write(buf);
+    }
+    template <typename T>
+    size_t println(T value) { return print(value) + write((uint8_t)'\n'); }
+    size_t println() { return write((uint8_t)'\n'); }
+};
+
+class String {
+  private:
+    std::string _s;
+
+  public:
+    String() {}
+    String(const char *s) : _s(s ? s : "") {}
+    String(const std::string &s) : _s(s) {}
+    String(int n) : _s(std::to_string(n)) {}
+    String(long n) : _s(std::to_string(n)) {}
+    String(unsigned long n) : _s(std::to_string(n)) {}
+    const char *c_str() const { return _s.c_str(); }
+    unsigned int length() const { return (unsigned int)_s.size(); }
+    String &operator+=(const String &o) { _s += o._s; return *this; }
+    friend String operator+(const String &a, const String &b) { return String(a._s + b._s); }
+    friend String operator+(const String &a, const char *b) { return String(a._s + b); }
+};
+
+// Serial is silent on the host. Reads report no data so the remote-move
+// paths in main.cpp stay idle.
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    size_t write(uint8_t) override { return 1; }
+    using Print::write;
+};
+
+inline HardwareSerial Serial;
+
+#endif
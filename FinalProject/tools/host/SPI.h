@@ -0,0 +1,6 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+// Host stand-in: the SPI bus is modelled inside the Adafruit_ILI9341 stand-in.
+
+#endif
@@ -0,0 +1,366 @@
+/**
+ * @file nnue_gen.cpp
+ * @brief Builds the network blob for the NNUE evaluator (src/nnueData.h) by fitting it to the
+ * current hand-written evaluation.
+ *
+ * The project has no game database to learn from, so the network is distilled from
+ * evaluatePosition(): material plus the tapered piece-square tables. Three-piece
+ * endings are left to the bitbases, which the evaluation still asks first.
+ *  - Positions come from games played from the start position by a noisy one-ply
+ *    player. It mostly plays the move the evaluation likes best and sometimes a
+ *    random one, so pieces get traded and hung and every game phase shows up. Each
+ *    sampled position is labelled with evaluatePosition() for the side to move.
+ *  - A float copy of the network in src/nnue.h (same features, same clamped
+ *    activation, scaled to 0..1) is trained on the squared error in pawns with Adam.
+ *    The weights are held inside the range the int8 and int16 formats can store.
+ *  - The weights are rounded into the blob, and the held-out positions are scored
+ *    again through nnue.h's own scalar kernels, so the reported error is what the
+ *    firmware will see.
+ * Everything uses fixed seeds and one thread, so the same options give the same blob.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -Isrc tools/nnue_gen.cpp -o /tmp/nnue_gen
+ *   /tmp/nnue_gen [--positions N] [--epochs N] [-o src/nnueData.h]
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// The blob is about to be rewritten: score with the one built here, not the header
+// on disk (nnue.h reads nnueNetworkData through this guard).
+#define NNUEDATA_H
+extern uint8_t nnueNetworkData[];
+#include "nnue.h"
+alignas(16) uint8_t nnueNetworkData[NNUE_NETWORK_BYTES];
+
+#include "chessEval.h"
+#include "chessMoves.h"
+
+// Largest feature count of one perspective: every piece but its own king.
+#define MAX_ACTIVE 31
+
+struct Sample {
+  uint16_t features[2][MAX_ACTIVE]; // [0] side to move, [1] the other side
+  uint8_t count[2];
+  int16_t label;                    // evaluatePosition(), side to move's view
+};
+
+static uint64_t rngState = 0x6E6E75652D67656Eull;
+
+static uint64_t nextRandom() {
+  uint64_t z = (rngState += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+static double uniform() { return (nextRandom() >> 11) * (1.0 / 9007199254740992.0); }
+
+// Active features of both sides, side to move first.
+static void extractFeatures(const ChessPosition &position, Sample &sample) {
+  const int stm = position.sideToMove();
+  for (int view = 0; view < 2; view++) {
+    const int perspective = view == 0 ? stm : -stm;
+    const int king = position.kingSquare(perspective);
+    int count = 0;
+    Bitboard pieces = position.occupied() & ~position.pieces(CHESS_KING * perspective);
+    while (pieces) {
+      int square = popLowestSquare(pieces);
+      sample.features[view][count++] = nnue::featureIndex(perspective, king, position.pieceAt(square), square);
+    }
+    sample.count[view] = count;
+  }
+}
+
+static void generatePositions(size_t wanted, std::vector<Sample> &samples) {
+  while (samples.size() < wanted) {
+    ChessPosition position;
+    position.setFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    for (int ply = 0; ply < 300 && samples.size() < wanted; ply++) {
+      ChessMoveList moves;
+      generateLegalMoves(position, position.sideToMove(), moves);
+      if (moves.count == 0 || position.repetitions() >= 2 || position.halfmoveClock() >= 100 ||
+          popCount(position.occupied()) <= 3) {
+        break;
+      }
+      if (ply >= 4 && !position.inCheck(position.sideToMove()) && nextRandom() % 3 == 0) {
+        Sample sample;
+        extractFeatures(position, sample);
+        sample.label = (int16_t)evaluatePosition(position);
+        samples.push_back(sample);
+      }
+      ChessMove chosen = moves.moves[nextRandom() % moves.count];
+      if (nextRandom() % 4 != 0) {
+        int best = -1000000;
+        for (ChessMove move : moves) {
+          position.makeMove(move);
+          int score = -evaluatePosition(position) + (int)(nextRandom() % 60);
+          position.unmakeMove();
+          if (score > best) {
+            best = score;
+            chosen = move;
+          }
+        }
+      }
+      position.makeMove(chosen);
+    }
+  }
+}
+
+// Float network. Activations are clamp(accumulator, 0, 1); the integer network
+// stores 127 times the first layer and 100 * 2^NNUE_OUTPUT_SHIFT / 127 times the
+// output weights (in pawns), so the shifted dot product comes out in centipawns.
+#define WEIGHT_LIMIT 1.0f        // int8 feature weights: 127 * 1.0
+#define BIAS_LIMIT 100.0f        // int16 biases, far inside the range
+#define OUTPUT_LIMIT 2.5f        // int8 output weights: 2.5 pawns * 6400 / 127 = 126
+#define OUTPUT_SCALE (100.0f * (1 << NNUE_OUTPUT_SHIFT) / NNUE_ACTIVATION_MAX)
+
+struct Parameter {
+  std::vector<float> value, gradient, m, v;
+  float limit;
+
+  void init(size_t count, float limit_) {
+    value.assign(count, 0);
+    gradient.assign(count, 0);
+    m.assign(count, 0);
+    v.assign(count, 0);
+    limit = limit_;
+  }
+
+  // One Adam step on [first, first + count), clearing the gradient.
+  void step(size_t first, size_t count, float rate, int t) {
+    const float beta1 = 0.9f, beta2 = 0.999f;
+    const float correction1 = 1 - powf(beta1, t), correction2 = 1 - powf(beta2, t);
+    for (size_t i = first; i < first + count; i++) {
+      float g = gradient[i];
+      gradient[i] = 0;
+      m[i] = beta1 * m[i] + (1 - beta1) * g;
+      v[i] = beta2 * v[i] + (1 - beta2) * g * g;
+      float x = value[i] - rate * (m[i] / correction1) / (sqrtf(v[i] / correction2) + 1e-8f);
+      value[i] = x > limit ? limit : x < -limit ? -limit : x;
+    }
+  }
+};
+
+static Parameter featureWeights, biases, outputWeights, outputBias;
+
+static float forward(const Sample &sample, float accumulators[2][NNUE_HIDDEN]) {
+  float output = outputBias.value[0];
+  for (int view = 0; view < 2; view++) {
+    float *accumulator = accumulators[view];
+    for (int j = 0; j < NNUE_HIDDEN; j++) {
+      accumulator[j] = biases.value[j];
+    }
+    for (int i = 0; i < sample.count[view]; i++) {
+      const float *row = &featureWeights.value[(size_t)sample.features[view][i] * NNUE_HIDDEN];
+      for (int j = 0; j < NNUE_HIDDEN; j++) {
+        accumulator[j] += row[j];
+      }
+    }
+    for (int j = 0; j < NNUE_HIDDEN; j++) {
+      float a = accumulator[j] < 0 ? 0 : accumulator[j] > 1 ? 1 : accumulator[j];
+      output += a * outputWeights.value[view * NNUE_HIDDEN + j];
+    }
+  }
+  return output;
+}
+
+// Adds the gradient of the squared error of one sample; returns the error in pawns.
+static float backward(const Sample &sample, std::vector<uint8_t> &touched) {
+  float accumulators[2][NNUE_HIDDEN];
+  float error = forward(sample, accumulators) - sample.label / 100.0f;
+  float g = 2 * error;
+  outputBias.gradient[0] += g;
+  for (int view = 0; view < 2; view++) {
+    float hidden[NNUE_HIDDEN];
+    for (int j = 0; j < NNUE_HIDDEN; j++) {
+      float x = accumulators[view][j];
+      float a = x < 0 ? 0 : x > 1 ? 1 : x;
+      outputWeights.gradient[view * NNUE_HIDDEN + j] += g * a;
+      hidden[j] = (x > 0 && x < 1) ? g * outputWeights.value[view * NNUE_HIDDEN + j] : 0;
+      biases.gradient[j] += hidden[j];
+    }
+    for (int i = 0; i < sample.count[view]; i++) {
+      size_t feature = sample.features[view][i];
+      touched[feature] = 1;
+      float *row = &featureWeights.gradient[feature * NNUE_HIDDEN];
+      for (int j = 0; j < NNUE_HIDDEN; j++) {
+        row[j] += hidden[j];
+      }
+    }
+  }
+  return error;
+}
+
+static void train(const std::vector<Sample> &samples, size_t trainCount, int epochs) {
+  featureWeights.init((size_t)NNUE_FEATURES * NNUE_HIDDEN, WEIGHT_LIMIT);
+  biases.init(NNUE_HIDDEN, BIAS_LIMIT);
+  outputWeights.init(2 * NNUE_HIDDEN, OUTPUT_LIMIT);
+  outputBias.init(1, 1000);
+  for (float &w : featureWeights.value) {
+    w = (float)(uniform() - 0.5) * 0.1f;
+  }
+  for (float &b : biases.value) {
+    b = 0.5f;
+  }
+  for (int j = 0; j < 2 * NNUE_HIDDEN; j++) {
+    outputWeights.value[j] = (float)(uniform() - 0.5) * (j < NNUE_HIDDEN ? 1.0f : -1.0f);
+  }
+
+  std::vector<size_t> order(trainCount);
+  for (size_t i = 0; i < trainCount; i++) {
+    order[i] = i;
+  }
+  std::vector<uint8_t> touched(NNUE_FEATURES);
+  const int batch = 256;
+  int t = 0;
+  for (int epoch = 0; epoch < epochs; epoch++) {
+    for (size_t i = trainCount - 1; i > 0; i--) {
+      size_t j = nextRandom() % (i + 1);
+      size_t swap = order[i];
+      order[i] = order[j];
+      order[j] = swap;
+    }
+    // Linear decay to a twentieth of the starting rate over the run.
+    const float rate = 0.002f * (1.0f - 0.95f * epoch / (epochs > 1 ? epochs - 1 : 1));
+    double squared = 0;
+    for (size_t start = 0; start < trainCount; start += batch) {
+      size_t end = start + batch < trainCount ? start + batch : trainCount;
+      for (size_t i = start; i < end; i++) {
+        float error = backward(samples[order[i]], touched);
+        squared += error * error;
+      }
+      t++;
+      // Gradients are means over the batch; rows no sample touched are left alone.
+      float scale = 1.0f / (end - start);
+      outputBias.gradient[0] *= scale;
+      for (float &g : outputWeights.gradient) g *= scale;
+      for (float &g : biases.gradient) g *= scale;
+      outputBias.step(0, 1, rate, t);
+      outputWeights.step(0, 2 * NNUE_HIDDEN, rate, t);
+      biases.step(0, NNUE_HIDDEN, rate, t);
+      for (int feature = 0; feature < NNUE_FEATURES; feature++) {
+        if (touched[feature]) {
+          touched[feature] = 0;
+          for (int j = 0; j < NNUE_HIDDEN; j++) {
+            featureWeights.gradient[(size_t)feature * NNUE_HIDDEN + j] *= scale;
+          }
+          featureWeights.step((size_t)feature * NNUE_HIDDEN, NNUE_HIDDEN, rate, t);
+        }
+      }
+    }
+    printf("epoch %2d: training error %.1f cp (rms)\n", epoch + 1, 100 * sqrt(squared / trainCount));
+    fflush(stdout);
+  }
+}
+
+static int roundClamp(double x, int limit) {
+  long value = lround(x);
+  return value > limit ? limit : value < -limit ? -limit : (int)value;
+}
+
+static void quantize() {
+  memset(nnueNetworkData, 0, sizeof(nnueNetworkData));
+  uint8_t *header = nnueNetworkData;
+  memcpy(header, "NNUE", 4);
+  header[4] = NNUE_VERSION;
+  header[5] = NNUE_HIDDEN;
+  header[6] = NNUE_KING_BUCKETS;
+  header[7] = NNUE_PIECE_KINDS;
+  header[8] = NNUE_OUTPUT_SHIFT;
+  int32_t bias = roundClamp(outputBias.value[0] * 100 * (1 << NNUE_OUTPUT_SHIFT), 1 << 30);
+  memcpy(header + 12, &bias, 4);
+  int16_t *hiddenBiases = (int16_t *)(nnueNetworkData + NNUE_BIAS_OFFSET);
+  for (int j = 0; j < NNUE_HIDDEN; j++) {
+    hiddenBiases[j] = (int16_t)roundClamp(biases.value[j] * NNUE_ACTIVATION_MAX, 32000);
+  }
+  int8_t *weights = (int8_t *)(nnueNetworkData + NNUE_WEIGHT_OFFSET);
+  for (size_t i = 0; i < featureWeights.value.size(); i++) {
+    weights[i] = (int8_t)roundClamp(featureWeights.value[i] * NNUE_ACTIVATION_MAX, 127);
+  }
+  int8_t *output = (int8_t *)(nnueNetworkData + NNUE_OUTPUT_OFFSET);
+  for (int j = 0; j < 2 * NNUE_HIDDEN; j++) {
+    output[j] = (int8_t)roundClamp(outputWeights.value[j] * OUTPUT_SCALE, 127);
+  }
+}
+
+// Integer evaluation through nnue.h, as the firmware computes it from scratch.
+static int integerEvaluate(const Sample &sample) {
+  alignas(16) int16_t accumulators[2][NNUE_HIDDEN];
+  for (int view = 0; view < 2; view++) {
+    memcpy(accumulators[view], nnue::biases(), sizeof(accumulators[view]));
+    for (int i = 0; i < sample.count[view]; i++) {
+      nnue::addRowScalar(accumulators[view], nnue::featureRow(sample.features[view][i]));
+    }
+  }
+  return nnue::evaluate(accumulators[0], accumulators[1]);
+}
+
+static void writeHeader(const char *path, size_t positions, double meanError) {
+  FILE *out = fopen(path, "w");
+  if (!out) {
+    perror(path);
+    exit(1);
+  }
+  fprintf(out, "#ifndef NNUEDATA_H\n#define NNUEDATA_H\n\n#include <stdint.h>\n\n");
+  fprintf(out, "// Generated by tools/nnue_gen.cpp from %zu positions (held-out mean error %.1f cp);\n", positions,
+          meanError);
+  fprintf(out, "// layout in nnue.h. Do not edit.\n");
+  fprintf(out, "alignas(16) const uint8_t nnueNetworkData[%d] = {\n", NNUE_NETWORK_BYTES);
+  for (int i = 0; i < NNUE_NETWORK_BYTES; i++) {
+    fprintf(out, "0x%02X,%s", nnueNetworkData[i], (i % 16 == 15 || i == NNUE_NETWORK_BYTES - 1) ? "\n" : " ");
+  }
+  fprintf(out, "};\n\n#endif\n");
+  fclose(out);
+}
+
+int main(int argc, char **argv) {
+  size_t positions = 1000000;
+  int epochs = 12;
+  const char *outPath = "src/nnueData.h";
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--positions") == 0 && i + 1 < argc) {
+      positions = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--epochs") == 0 && i + 1 < argc) {
+      epochs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      outPath = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--positions N] [--epochs N] [-o src/nnueData.h]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::vector<Sample> samples;
+  samples.reserve(positions);
+  generatePositions(positions, samples);
+  size_t trainCount = positions - positions / 20;
+  printf("%zu positions, %zu for training, %zu held out\n", samples.size(), trainCount, samples.size() - trainCount);
+
+  train(samples, trainCount, epochs);
+  quantize();
+  if (!nnue::networkMatches()) {
+    fprintf(stderr, "blob header does not match nnue.h\n");
+    return 1;
+  }
+
+  double floatError = 0, intError = 0, worst = 0;
+  for (size_t i = trainCount; i < samples.size(); i++) {
+    float accumulators[2][NNUE_HIDDEN];
+    floatError += fabs(forward(samples[i], accumulators) * 100 - samples[i].label);
+    double error = fabs((double)integerEvaluate(samples[i]) - samples[i].label);
+    intError += error;
+    worst = error > worst ? error : worst;
+  }
+  size_t held = samples.size() - trainCount;
+  printf("held out: float mean error %.1f cp, int8 network mean error %.1f cp, worst %.0f cp\n", floatError / held,
+         intError / held, worst);
+
+  writeHeader(outPath, positions, intError / held);
+  printf("wrote %s (%d bytes of network)\n", outPath, NNUE_NETWORK_BYTES);
+  return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file perft.cpp
+ * @brief Host perft suite: counts move-tree leaves to check and time the chess move generator.
+ *
+ * Builds only the Arduino-free chess headers (src/bitboard.h, chessPosition.h,
+ * chessMoves.h). perft(d) walks every legal move sequence of length d with
+ * generateLegalMoves() and ChessPosition::makeMove()/unmakeMove(), counting the
+ * leaves; the last ply is counted from the move list without playing it. Node
+ * counts of the standard test positions are well known, so any rule bug
+ * (castling through check, en passant pins, promotions...) shows up as a
+ * mismatch. The report lists nodes and nodes per second per position, and the
+ * exit code is 1 if any count is wrong. With --keys every interior node also
+ * compares the incrementally updated Zobrist key, piece-square score and game
+ * phase with a full recompute, after makeMove() and again after unmakeMove().
+ * Built with -DUSE_NNUE_EVAL it compares both network accumulators as well.
+ *
+ * Divide mode prints the leaf count under each root move. Comparing it against
+ * another engine's divide output narrows a wrong count down to one move; repeat
+ * from the position after that move until the bug is isolated.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -Isrc tools/perft.cpp -o /tmp/perft && /tmp/perft
+ * Options:
+ *   /tmp/perft --deep                  one ply deeper on every position (slower)
+ *   /tmp/perft --keys                  also check the incremental key and evaluation at every node
+ *   /tmp/perft "<fen>" <depth>         count a single position
+ *   /tmp/perft --divide "<fen>" <depth>  per root move counts
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chessMoves.h"
+
+struct PerftCase {
+  const char *name;
+  const char *fen;
+  int depth;
+  uint64_t nodes;
+  uint64_t deeperNodes; // at depth + 1, for --deep
+};
+
+// Reference counts from the Chess Programming Wiki "Perft Results" page.
+static const PerftCase cases[] = {
+  {"startpos", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 5, 4865609, 119060324},
+  {"kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 4, 4085603, 193690690},
+  {"position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 6, 11030083, 178633661},
+  {"position 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 5, 15833292, 706045033},
+  {"position 4 mirrored", "r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1", 5, 15833292,
+   706045033},
+  {"position 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 4, 2103487, 89941194},
+  {"position 6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 4, 3894594,
+   164075551},
+};
+
+static bool verifyKeys = false;
+static uint64_t keyErrors = 0;
+static uint64_t evalErrors = 0;
+
+// Whether the running evaluation terms match a recompute from the board.
+static bool evalTermsMatch(const ChessPosition &position) {
+#ifdef USE_NNUE_EVAL
+  const NnueAccumulator &accumulator = position.nnueAccumulator();
+  for (int side = 0; side < 2; side++) {
+    int16_t values[NNUE_HIDDEN];
+    position.computeNnueAccumulator(side == 0 ? 1 : -1, values);
+    if (memcmp(values, accumulator.values[side], sizeof(values)) != 0) {
+      return false;
+    }
+  }
+#endif
+  return position.pieceSquareScore() == position.computePieceSquareScore() &&
+         position.phase() == position.computePhase();
+}
+
+static uint64_t perft(ChessPosition &position, int depth) {
+  ChessMoveList moves;
+  generateLegalMoves(position, position.sideToMove(), moves);
+  if (depth <= 1) {
+    return depth == 1 ? moves.count : 1;
+  }
+  uint64_t nodes = 0;
+  for (ChessMove move : moves) {
+    uint64_t before = position.key();
+    EvalScore scoreBefore = position.pieceSquareScore();
+    position.makeMove(move);
+    if (verifyKeys) {
+      keyErrors += position.key() != position.computeKey();
+      evalErrors += !evalTermsMatch(position);
+    }
+    nodes += perft(position, depth - 1);
+    position.unmakeMove();
+    if (verifyKeys) {
+      keyErrors += position.key() != before;
+      evalErrors += position.pieceSquareScore() != scoreBefore || !evalTermsMatch(position);
+    }
+  }
+  return nodes;
+}
+
+// Long algebraic notation as used by UCI engines, e.g. e2e4 or e7e8q.
+static const char *moveName(ChessMove move) {
+  static char name[6];
+  int from = moveFrom(move), to = moveTo(move);
+  name[0] = 'a' + from % 8;
+  name[1] = '8' - from / 8;
+  name[2] = 'a' + to % 8;
+  name[3] = '8' - to / 8;
+  name[4] = 0;
+  if (moveKind(move) == MOVE_PROMOTION) {
+    static const char letters[7] = {0, 'p', 'b', 'n', 'r', 'q', 'k'};
+    name[4] = letters[movePromotion(move)];
+  }
+  name[5] = 0;
+  return name;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static int divide(const char *fen, int depth) {
+  ChessPosition position;
+  if (!position.setFen(fen) || depth < 1) {
+    fprintf(stderr, "bad position or depth\n");
+    return 2;
+  }
+  ChessMoveList moves;
+  generateLegalMoves(position, position.sideToMove(), moves);
+  auto start = std::chrono::steady_clock::now();
+  uint64_t total = 0;
+  for (ChessMove move : moves) {
+    position.makeMove(move);
+    uint64_t nodes = perft(position, depth - 1);
+    position.unmakeMove();
+    printf("%s: %llu\n", moveName(move), (unsigned long long)nodes);
+    total += nodes;
+  }
+  double seconds = secondsSince(start);
+  printf("\n%d moves, %llu nodes, %.0f nodes/s\n", moves.count, (unsigned long long)total, total / seconds);
+  return 0;
+}
+
+static int single(const char *fen, int depth) {
+  ChessPosition position;
+  if (!position.setFen(fen) || depth < 0) {
+    fprintf(stderr, "bad position or depth\n");
+    return 2;
+  }
+  auto start = std::chrono::steady_clock::now();
+  uint64_t nodes = perft(position, depth);
+  double seconds = secondsSince(start);
+  printf("perft(%d) = %llu  %.3f s  %.0f nodes/s\n", depth, (unsigned long long)nodes, seconds, nodes / seconds);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  bool deep = false;
+  if (argc >= 2 && strcmp(argv[1], "--divide") == 0) {
+    return argc == 4 ? divide(argv[2], atoi(argv[3])) : 2;
+  }
+  if (argc == 3) {
+    return single(argv[1], atoi(argv[2]));
+  }
+  if (argc == 2 && strcmp(argv[1], "--deep") == 0) {
+    deep = true;
+  } else if (argc == 2 && strcmp(argv[1], "--keys") == 0) {
+    verifyKeys = true;
+  } else if (argc != 1) {
+    fprintf(stderr, "usage: %s [--deep | --keys] | \"<fen>\" <depth> | --divide \"<fen>\" <depth>\n", argv[0]);
+    return 2;
+  }
+
+  printf("%-20s %5s | %12s %12s | %8s %12s\n", "position", "depth", "nodes", "expected", "seconds", "nodes/s");
+  uint64_t totalNodes = 0;
+  double totalSeconds = 0;
+  int failures = 0;
+  for (const PerftCase &c : cases) {
+    ChessPosition position;
+    position.setFen(c.fen);
+    int depth = deep ? c.depth + 1 : c.depth;
+    uint64_t expected = deep ? c.deeperNodes : c.nodes;
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t nodes = perft(position, depth);
+    double seconds = secondsSince(start);
+    totalNodes += nodes;
+    totalSeconds += seconds;
+    bool ok = nodes == expected;
+    failures += !ok;
+    printf("%-20s %5d | %12llu %12llu | %8.3f %12.0f %s\n", c.name, depth, (unsigned long long)nodes,
+           (unsigned long long)expected, seconds, nodes / seconds, ok ? "" : "MISMATCH");
+  }
+  printf("\ntotal %llu nodes in %.3f s, %.0f nodes/s, %d mismatches\n", (unsigned long long)totalNodes, totalSeconds,
+         totalNodes / totalSeconds, failures);
+  if (verifyKeys) {
+    printf("%llu Zobrist key errors, %llu evaluation term errors\n", (unsigned long long)keyErrors,
+           (unsigned long long)evalErrors);
+  }
+  return failures == 0 && keyErrors == 0 && evalErrors == 0 ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+#ifndef PGN_H
+#define PGN_H
+
+// PGN reading shared by the host tools that learn from games (book_gen.cpp,
+// texel_tune.cpp): splitting a file into games and playing their SAN moves with
+// the engine's own move generator.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "chessMoves.h"
+
+// Matches a SAN move ("Nbxd7+", "exd8=Q", "O-O-O") against the legal moves.
+static ChessMove parseSan(const ChessPosition &position, const std::string &text) {
+  std::string san;
+  for (char c : text) {
+    if (c != '+' && c != '#' && c != '!' && c != '?') {
+      san += c;
+    }
+  }
+  ChessMoveList legal;
+  generateLegalMoves(position, position.sideToMove(), legal);
+  if (san == "O-O" || san == "0-0" || san == "O-O-O" || san == "0-0-0") {
+    bool kingSide = san.size() == 3;
+    for (ChessMove move : legal) {
+      if (moveKind(move) == MOVE_CASTLE && (moveTo(move) > moveFrom(move)) == kingSide) {
+        return move;
+      }
+    }
+    return 0;
+  }
+
+  int piece = CHESS_PAWN;
+  size_t start = 0;
+  static const char pieceLetters[] = " PBNRQK";
+  if (!san.empty() && strchr("KQRBN", san[0])) {
+    piece = (int)(strchr(pieceLetters, san[0]) - pieceLetters);
+    start = 1;
+  }
+  int promotion = 0;
+  size_t equals = san.find('=');
+  if (equals != std::string::npos && equals + 1 < san.size()) {
+    promotion = (int)(strchr(pieceLetters, san[equals + 1]) - pieceLetters);
+    san.erase(equals);
+  } else if (piece == CHESS_PAWN && san.size() >= 3 && strchr("QRBN", san.back())) {
+    promotion = (int)(strchr(pieceLetters, san.back()) - pieceLetters);
+    san.pop_back();
+  }
+  if (san.size() < start + 2) {
+    return 0;
+  }
+  int toFile = san[san.size() - 2] - 'a';
+  int toRank = san[san.size() - 1] - '1';
+  if (toFile < 0 || toFile > 7 || toRank < 0 || toRank > 7) {
+    return 0;
+  }
+  int to = (7 - toRank) * 8 + toFile;
+  int fromFile = -1, fromRank = -1;
+  for (size_t i = start; i + 2 < san.size(); i++) {
+    if (san[i] >= 'a' && san[i] <= 'h') {
+      fromFile = san[i] - 'a';
+    } else if (san[i] >= '1' && san[i] <= '8') {
+      fromRank = san[i] - '1';
+    } else if (san[i] != 'x') {
+      return 0;
+    }
+  }
+
+  ChessMove found = 0;
+  for (ChessMove move : legal) {
+    int from = moveFrom(move);
+    if (moveTo(move) != to || abs(position.pieceAt(from)) != piece || moveKind(move) == MOVE_CASTLE) {
+      continue;
+    }
+    if ((fromFile >= 0 && from % 8 != fromFile) || (fromRank >= 0 && 7 - from / 8 != fromRank)) {
+      continue;
+    }
+    if ((moveKind(move) == MOVE_PROMOTION ? movePromotion(move) : 0) != promotion) {
+      continue;
+    }
+    if (found) {
+      return 0; // ambiguous
+    }
+    found = move;
+  }
+  return found;
+}
+
+// Splits PGN text into games: each is its result and its main-line move tokens.
+struct PgnGame {
+  std::vector<std::string> moves;
+  std::string result = "*";
+};
+
+static bool isResult(const std::string &token) {
+  return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*";
+}
+
+static std::vector<PgnGame> readPgn(const std::string &text) {
+  std::vector<PgnGame> games;
+  PgnGame game;
+  bool inMoves = false;
+  int variationDepth = 0;
+  size_t i = 0;
+  while (i < text.size()) {
+    char c = text[i];
+    if (c == '{') {
+      size_t end = text.find('}', i);
+      i = end == std::string::npos ? text.size() : end + 1;
+    } else if (c == ';' || (c == '%' && (i == 0 || text[i - 1] == '\n'))) {
+      size_t end = text.find('\n', i);
+      i = end == std::string::npos ? text.size() : end + 1;
+    } else if (c == '[' && variationDepth == 0) {
+      if (inMoves) {
+        games.push_back(game); // a game that ended without a result token
+        game = PgnGame();
+        inMoves = false;
+      }
+      size_t end = text.find(']', i);
+      i = end == std::string::npos ? text.size() : end + 1;
+    } else if (c == '(') {
+      variationDepth++;
+      i++;
+    } else if (c == ')') {
+      variationDepth -= variationDepth > 0;
+      i++;
+    } else if (isspace((unsigned char)c)) {
+      i++;
+    } else {
+      size_t end = i;
+      while (end < text.size() && !isspace((unsigned char)text[end]) && !strchr("{}();[", text[end])) {
+        end++;
+      }
+      std::string token = text.substr(i, end - i);
+      i = end;
+      if (variationDepth > 0 || token[0] == '$') {
+        continue;
+      }
+      if (isResult(token)) {
+        game.result = token;
+        games.push_back(game);
+        game = PgnGame();
+        inMoves = false;
+        continue;
+      }
+      size_t dots = token.find_last_of('.');
+      if (dots != std::string::npos) {
+        token = token.substr(dots + 1); // "12." or "12...Nf6"
+      }
+      if (!token.empty()) {
+        game.moves.push_back(token);
+        inMoves = true;
+      }
+    }
+  }
+  if (inMoves) {
+    games.push_back(game);
+  }
+  return games;
+}
+
+static bool readFile(const char *path, std::string &text) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+  char buffer[65536];
+  size_t count;
+  while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    text.append(buffer, count);
+  }
+  fclose(file);
+  return true;
+}
+
+#endif
@@ -0,0 +1,309 @@
+/**
+ * @file sprite_bench.cpp
+ * @brief Host benchmark for the sprite blitters.
+ *
+ * The sprites in src/ are stored as Sprite handles (paletted 4-bit); each is
+ * expanded back to a raw RGB565 array, and re-encoded as RLE, so every storage
+ * format can be measured on the same pixels.
+ *
+ * Part 1 draws every sprite with the original per-pixel loop (one drawPixel()
+ * transaction per opaque pixel) and with blitSpriteTransparent(), reporting SPI
+ * transactions, address windows, bytes and the modelled time on the bus.
+ *
+ * Part 2 compares the raw span blitter, blitRLESprite() and blitPal4Sprite():
+ * flash size (which is also the flash read per blit), CPU time to decode + push
+ * into a null sink, and bus time. Every path is checked to leave identical
+ * pixels on the panel.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -Itools/host -Isrc tools/sprite_bench.cpp -o /tmp/sprite_bench && /tmp/sprite_bench
+ */
+
+#include <Arduino.h>
+#include <Adafruit_ILI9341.h>
+#include <chrono>
+#include <vector>
+
+#include "spriteBlit.h"
+#include "Icons.h"
+#include "leafle.h"
+#include "finpup.h"
+#include "katanid.h"
+#include "kitflare.h"
+#include "mantiscyth.h"
+#include "hammerfat.h"
+#include "anchorjaw.h"
+#include "omenmask.h"
+#include "spiritail.h"
+#include "charmander.h"
+#include "pikachu.h"
+#include "White_King.h"
+#include "White_Queen.h"
+#include "White_Rook.h"
+#include "White_Bishop.h"
+#include "White_Knight.h"
+#include "White_Pawn.h"
+#include "Black_King.h"
+#include "Black_Queen.h"
+#include "Black_Rook.h"
+#include "Black_Bishop.h"
+#include "Black_Knight.h"
+#include "Black_Pawn.h"
+
+struct SpriteEntry {
+  const char *name;
+  const Sprite *sprite;
+};
+
+static const SpriteEntry sprites[] = {
+  {"TIC_TAC_TOE_ICON_BITS", &TIC_TAC_TOE_ICON_BITS},
+  {"POKEMON_ICON_BITS", &POKEMON_ICON_BITS},
+  {"CHESS_ICON_BITS", &CHESS_ICON_BITS},
+  {"SETTINGS_ICON_BITS", &SETTINGS_ICON_BITS},
+  {"leafle_sprite", &leafle_sprite},
+  {"finpup_sprite", &finpup_sprite},
+  {"katanid_sprite", &katanid_sprite},
+  {"kitflare_sprite", &kitflare_sprite},
+  {"mantiscythe_sprite", &mantiscythe_sprite},
+  {"hammerfat_sprite", &hammerfat_sprite},
+  {"anchorjaw_sprite", &anchorjaw_sprite},
+  {"omenmask_sprite", &omenmask_sprite},
+  {"spiritail_sprite", &spiritail_sprite},
+  {"charmanderSprite", &charmanderSprite},
+  {"sprite (pikachu)", &sprite},
+  {"whiteKingSprite", &whiteKingSprite},
+  {"whiteQueenSprite", &whiteQueenSprite},
+  {"whiteRookSprite", &whiteRookSprite},
+  {"whiteBishopSprite", &whiteBishopSprite},
+  {"whiteKnightSprite", &whiteKnightSprite},
+  {"whitePawnSprite", &whitePawnSprite},
+  {"blackKingSprite", &blackKingSprite},
+  {"blackQueenSprite", &blackQueenSprite},
+  {"blackRookSprite", &blackRookSprite},
+  {"blackBishopSprite", &blackBishopSprite},
+  {"blackKnightSprite", &blackKnightSprite},
+  {"blackPawnSprite", &blackPawnSprite},
+};
+
+// Expands a sprite back into a raw array (transparent key 0x0000).
+static std::vector<uint16_t> decodeSprite(const Sprite &sprite) {
+  int w = sprite.width, h = sprite.height;
+  std::vector<uint16_t> raw((size_t)w * h, 0x0000);
+  if (sprite.format == SPRITE_PAL4) {
+    const uint8_t *indices = (const uint8_t *)sprite.data;
+    for (int j = 0; j < h; j++)
+      for (int i = 0; i < w; i++) raw[(size_t)j * w + i] = sprite.palette[pal4Index(&indices[j * ((w + 1) / 2)], i)];
+    return raw;
+  }
+  const uint16_t *p = (const uint16_t *)sprite.data + 2;
+  for (int j = 0; j < h; j++) {
+    int col = 0;
+    while (col < w) {
+      uint16_t segment = *p++;
+      col += segment >> 8;
+      for (int k = 0; k < (segment & 0xFF); k++) raw[(size_t)j * w + col++] = *p++;
+    }
+  }
+  return raw;
+}
+
+// Same encoding as tools/sprite_encode.py --format rle.
+static std::vector<uint16_t> encodeRLE(const std::vector<uint16_t> &raw, int w, int h) {
+  std::vector<uint16_t> out = {(uint16_t)w, (uint16_t)h};
+  for (int j = 0; j < h; j++) {
+    int i = 0;
+    while (i < w) {
+      int skip = 0;
+      while (i < w && raw[(size_t)j * w + i] == 0x0000) { skip++; i++; }
+      int start = i;
+      while (i < w && raw[(size_t)j * w + i] != 0x0000) i++;
+      out.push_back((uint16_t)((skip << 8) | (i - start)));
+      out.insert(out.end(), raw.begin() + (size_t)j * w + start, raw.begin() + (size_t)j * w + i);
+    }
+  }
+  return out;
+}
+
+static size_t pal4FlashBytes(const Sprite &sprite) {
+  return sprite.paletteSize * 2 + (size_t)((sprite.width + 1) / 2) * sprite.height;
+}
+
+// Accepts the display write API and does nothing but fold the pixels into a
+// checksum, so CPU time measures only the decode + staging work.
+struct NullDisplay {
+  uint32_t checksum = 0;
+  int16_t width() const { return 320; }
+  int16_t height() const { return 240; }
+  void startWrite() {}
+  void endWrite() {}
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) { checksum += x + y * 3 + w * 5 + h * 7; }
+  void writePixels(uint16_t *colors, uint32_t len, bool = true, bool = false) {
+    for (uint32_t i = 0; i < len; i++) checksum = checksum * 31 + colors[i];
+  }
+};
+
+template <typename Fn>
+static double nanosPerCall(Fn fn) {
+  const int iterations = 2000;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+// The original drawSpriteWithTransparency() body.
+static void perPixelBlit(Adafruit_ILI9341 &tft, int x, int y, const uint16_t *bitmap, int w, int h, uint16_t transparentColor) {
+  for (int j = 0; j < h; j++) {
+    for (int i = 0; i < w; i++) {
+      uint16_t color = pgm_read_word(&bitmap[j * w + i]);
+      if (color != transparentColor) {
+        tft.drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+}
+
+static bool samePanels(const Adafruit_ILI9341 &a, const Adafruit_ILI9341 &b) {
+  for (int y = 0; y < a.height(); y++) {
+    for (int x = 0; x < a.width(); x++) {
+      if (a.panelPixel(x, y) != b.panelPixel(x, y)) return false;
+    }
+  }
+  return true;
+}
+
+static void freshDisplay(Adafruit_ILI9341 &tft) {
+  tft.begin();
+  tft.setRotation(3);
+  tft.fillScreen(0x7D1F);
+  tft.spiStats.reset();
+}
+
+int main() {
+  printf("Part 1: per-pixel drawPixel() vs span blitter (raw data)\n");
+  printf("%-22s %5s | %8s %8s %8s %9s | %6s %6s %8s %9s | %6s\n", "sprite", "size", "txn", "windows",
+         "bytes", "est us", "txn", "windows", "bytes", "est us", "speed");
+  printf("%-22s %5s | %-36s | %-33s |\n", "", "", "per-pixel drawPixel()", "blitSpriteTransparent()");
+
+  HostSpiStats totalOld, totalNew;
+  bool allMatch = true;
+  for (const SpriteEntry &entry : sprites) {
+    std::vector<uint16_t> raw = decodeSprite(*entry.sprite);
+    const uint16_t *data = raw.data();
+    int w = entry.sprite->width, h = entry.sprite->height;
+    Adafruit_ILI9341 reference(5, 4), blitted(5, 4);
+    freshDisplay(reference);
+    freshDisplay(blitted);
+
+    // Place the sprite partly off the right edge too, so clipping is exercised.
+    perPixelBlit(reference, 20, 20, data, w, h, 0x0000);
+    perPixelBlit(reference, 320 - w / 2, 100, data, w, h, 0x0000);
+    blitSpriteTransparent(blitted, 20, 20, data, w, h, 0x0000);
+    blitSpriteTransparent(blitted, 320 - w / 2, 100, data, w, h, 0x0000);
+
+    bool match = samePanels(reference, blitted);
+    allMatch = allMatch && match;
+
+    // Time one unclipped blit of each kind.
+    freshDisplay(reference);
+    freshDisplay(blitted);
+    perPixelBlit(reference, 20, 20, data, w, h, 0x0000);
+    blitSpriteTransparent(blitted, 20, 20, data, w, h, 0x0000);
+    const HostSpiStats &o = reference.spiStats;
+    const HostSpiStats &n = blitted.spiStats;
+    totalOld.transactions += o.transactions; totalOld.windows += o.windows; totalOld.bytes += o.bytes;
+    totalNew.transactions += n.transactions; totalNew.windows += n.windows; totalNew.bytes += n.bytes;
+
+    char size[12];
+    snprintf(size, sizeof(size), "%dx%d", w, h);
+    printf("%-22s %5s | %8llu %8llu %8llu %9.1f | %6llu %6llu %8llu %9.1f | %5.1fx%s\n", entry.name, size,
+           (unsigned long long)o.transactions, (unsigned long long)o.windows, (unsigned long long)o.bytes,
+           o.estimatedMicros(), (unsigned long long)n.transactions, (unsigned long long)n.windows,
+           (unsigned long long)n.bytes, n.estimatedMicros(), o.estimatedMicros() / n.estimatedMicros(),
+           match ? "" : "  MISMATCH");
+  }
+  printf("%-22s %5s | %8llu %8llu %8llu %9.1f | %6llu %6llu %8llu %9.1f | %5.1fx\n", "total", "",
+         (unsigned long long)totalOld.transactions, (unsigned long long)totalOld.windows,
+         (unsigned long long)totalOld.bytes, totalOld.estimatedMicros(), (unsigned long long)totalNew.transactions,
+         (unsigned long long)totalNew.windows, (unsigned long long)totalNew.bytes, totalNew.estimatedMicros(),
+         totalOld.estimatedMicros() / totalNew.estimatedMicros());
+
+  // The 32 piece blits of a starting-position drawChessBoard().
+  const Sprite *backRank[8] = {&blackRookSprite, &blackKnightSprite, &blackBishopSprite, &blackQueenSprite,
+                               &blackKingSprite, &blackBishopSprite, &blackKnightSprite, &blackRookSprite};
+  const Sprite *whiteRank[8] = {&whiteRookSprite, &whiteKnightSprite, &whiteBishopSprite, &whiteQueenSprite,
+                                &whiteKingSprite, &whiteBishopSprite, &whiteKnightSprite, &whiteRookSprite};
+  std::vector<uint16_t> blackPawnRaw = decodeSprite(blackPawnSprite), whitePawnRaw = decodeSprite(whitePawnSprite);
+  Adafruit_ILI9341 reference(5, 4), blitted(5, 4);
+  freshDisplay(reference);
+  freshDisplay(blitted);
+  for (int col = 0; col < 8; col++) {
+    std::vector<uint16_t> backRaw = decodeSprite(*backRank[col]), whiteRaw = decodeSprite(*whiteRank[col]);
+    const uint16_t *column[4] = {backRaw.data(), blackPawnRaw.data(), whitePawnRaw.data(), whiteRaw.data()};
+    const int rows[4] = {0, 1, 6, 7};
+    for (int k = 0; k < 4; k++) {
+      int x = 40 + col * 30 + 2;
+      int y = rows[k] * 30 + 2;
+      perPixelBlit(reference, x, y, column[k], 26, 26, 0x0000);
+      blitSpriteTransparent(blitted, x, y, column[k], 26, 26, 0x0000);
+    }
+  }
+  bool boardMatch = samePanels(reference, blitted);
+  allMatch = allMatch && boardMatch;
+  printf("\nstart-position pieces (32 blits): per-pixel %llu txn, %.0f us | span %llu txn, %.0f us | %.1fx%s\n",
+         (unsigned long long)reference.spiStats.transactions, reference.spiStats.estimatedMicros(),
+         (unsigned long long)blitted.spiStats.transactions, blitted.spiStats.estimatedMicros(),
+         reference.spiStats.estimatedMicros() / blitted.spiStats.estimatedMicros(), boardMatch ? "" : "  MISMATCH");
+
+  printf("\nPart 2: raw span blit vs RLE vs PAL4 (decode + blit)\n");
+  printf("%-22s | %6s %6s %6s | %7s %7s %7s | %8s %8s %8s\n", "sprite", "flash", "flash", "flash", "cpu ns",
+         "cpu ns", "cpu ns", "bus us", "bus us", "bus us");
+  printf("%-22s | %6s %6s %6s | %7s %7s %7s | %8s %8s %8s\n", "", "raw", "rle", "pal4", "raw", "rle", "pal4", "raw",
+         "rle", "pal4");
+  size_t flashTotal[3] = {0, 0, 0};
+  double cpuTotal[3] = {0, 0, 0}, busTotal[3] = {0, 0, 0};
+  for (const SpriteEntry &entry : sprites) {
+    const Sprite &pal4 = *entry.sprite;
+    int w = pal4.width, h = pal4.height;
+    std::vector<uint16_t> raw = decodeSprite(pal4);
+    std::vector<uint16_t> rle = encodeRLE(raw, w, h);
+
+    Adafruit_ILI9341 panels[3] = {Adafruit_ILI9341(5, 4), Adafruit_ILI9341(5, 4), Adafruit_ILI9341(5, 4)};
+    auto drawAll = [&](int x, int y) {
+      blitSpriteTransparent(panels[0], x, y, raw.data(), w, h, 0x0000);
+      blitRLESprite(panels[1], x, y, rle.data());
+      blitPal4Sprite(panels[2], x, y, pal4);
+    };
+    double bus[3];
+    for (int k = 0; k < 3; k++) freshDisplay(panels[k]);
+    drawAll(20, 20);
+    for (int k = 0; k < 3; k++) bus[k] = panels[k].spiStats.estimatedMicros();
+    drawAll(-w / 3, 240 - h / 2);
+    drawAll(300, -h / 2);
+    bool match = samePanels(panels[0], panels[1]) && samePanels(panels[0], panels[2]);
+    allMatch = allMatch && match;
+
+    NullDisplay sink;
+    double cpu[3] = {
+      nanosPerCall([&] { blitSpriteTransparent(sink, 20, 20, raw.data(), w, h, 0x0000); }),
+      nanosPerCall([&] { blitRLESprite(sink, 20, 20, rle.data()); }),
+      nanosPerCall([&] { blitPal4Sprite(sink, 20, 20, pal4); }),
+    };
+    size_t flash[3] = {raw.size() * 2, rle.size() * 2, pal4FlashBytes(pal4)};
+    for (int k = 0; k < 3; k++) {
+      flashTotal[k] += flash[k];
+      cpuTotal[k] += cpu[k];
+      busTotal[k] += bus[k];
+    }
+    printf("%-22s | %6zu %6zu %6zu | %7.0f %7.0f %7.0f | %8.1f %8.1f %8.1f%s\n", entry.name, flash[0], flash[1],
+           flash[2], cpu[0], cpu[1], cpu[2], bus[0], bus[1], bus[2], match ? "" : "  MISMATCH");
+  }
+  printf("%-22s | %6zu %6zu %6zu | %7.0f %7.0f %7.0f | %8.1f %8.1f %8.1f\n", "total", flashTotal[0], flashTotal[1],
+         flashTotal[2], cpuTotal[0], cpuTotal[1], cpuTotal[2], busTotal[0], busTotal[1], busTotal[2]);
+  printf("flash vs raw: rle %.0f%%, pal4 %.0f%% (%.1fx smaller); decode+push CPU vs raw: rle %.0f%%, pal4 %.0f%%\n",
+         100.0 * flashTotal[1] / flashTotal[0], 100.0 * flashTotal[2] / flashTotal[0],
+         (double)flashTotal[0] / flashTotal[2], 100.0 * cpuTotal[1] / cpuTotal[0], 100.0 * cpuTotal[2] / cpuTotal[0]);
+
+  printf("\n%s\n", allMatch ? "output identical on all sprites" : "OUTPUT MISMATCH");
+  return allMatch ? 0 : 1;
+}
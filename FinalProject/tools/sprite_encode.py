@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Re-encode the sprite arrays in the src/ headers as Sprite handles (sprite.h).
+
+Usage (from FinalProject/):
+    python3 tools/sprite_encode.py [--format pal4|rle] src/leafle.h src/White_Rook.h ...
+    python3 tools/sprite_encode.py [--format pal4|rle] --size 56x56 PokemonSprite1.c > out.txt
+
+Input arrays may be raw RGB565 (`const uint16_t name [] PROGMEM = {...};`, as
+written by ImageConverter 565) or an RLE stream from an earlier run. Each one
+is replaced in place by flash data plus a `const Sprite name` handle, and the
+header's create...() call is pointed at the handle. Handles that are already
+in the requested format are left alone.
+
+pal4 (default): a color table whose entry 0 is the transparent key, followed by
+    the pixels as 4-bit indices, two per byte, high nibble first, each row
+    starting on a byte boundary. Sprites with more than 15 opaque colors fall
+    back to rle.
+
+rle: word 0 width, word 1 height, then per row segments of
+        (skip << 8) | run    transparent pixels to skip, opaque pixels that follow
+        run x RGB565         the opaque pixels
+    until the row's width is covered (see blitRLESprite() in spriteBlit.h).
+
+The sprite size is read from the create...() call (..., width, height), from
+an existing handle, or from --size.
+"""
+
+import re
+import sys
+
+TRANSPARENT = 0x0000
+RLE_MARKER = "// RLE sprite"
+PAL4_MARKER = "// PAL4 sprite"
+
+RAW_RE = re.compile(r"(?:%s[^\n]*\n)?const uint16_t\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};" % RLE_MARKER, re.S)
+HANDLE_RE = re.compile(
+    r"// (?:RLE|PAL4) sprite[^\n]*\n"
+    r"(?:const uint(?:8|16)_t\s+\w+\s*\[\]\s*PROGMEM\s*=\s*\{.*?\};\n)+"
+    r"const Sprite (\w+) = \{(SPRITE_\w+), (\d+), (\d+), [^\n]*\};", re.S)
+
+
+def encode_rle(pixels, width, height):
+    if width > 255 or height > 255:
+        raise ValueError("sprites are limited to 255x255")
+    out = [width, height]
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        x = 0
+        while x < width:
+            skip = 0
+            while x < width and row[x] == TRANSPARENT:
+                skip += 1
+                x += 1
+            start = x
+            while x < width and row[x] != TRANSPARENT:
+                x += 1
+            out.append((skip << 8) | (x - start))
+            out.extend(row[start:x])
+    return out
+
+
+def decode_rle(words):
+    width, height = words[0], words[1]
+    pixels = []
+    pos = 2
+    for _ in range(height):
+        col = 0
+        while col < width:
+            skip, run = words[pos] >> 8, words[pos] & 0xFF
+            pos += 1
+            pixels.extend([TRANSPARENT] * skip)
+            pixels.extend(words[pos:pos + run])
+            pos += run
+            col += skip + run
+    return pixels
+
+
+def encode_pal4(pixels, width, height):
+    palette = [TRANSPARENT] + sorted(set(p for p in pixels if p != TRANSPARENT), key=lambda c: -pixels.count(c))
+    if len(palette) > 16:
+        return None
+    index = {c: i for i, c in enumerate(palette)}
+    data = []
+    for y in range(height):
+        row = [index[p] for p in pixels[y * width:(y + 1) * width]]
+        if width % 2:
+            row.append(0)
+        data.extend((row[i] << 4) | row[i + 1] for i in range(0, len(row), 2))
+    return palette, data
+
+
+def decode_pal4(palette, data, width, height):
+    stride = (width + 1) // 2
+    pixels = []
+    for y in range(height):
+        for x in range(width):
+            byte = data[y * stride + x // 2]
+            pixels.append(palette[(byte >> 4) if x % 2 == 0 else (byte & 0x0F)])
+    return pixels
+
+
+def rows(values, fmt, per_line):
+    return "\n".join(", ".join(fmt % v for v in values[i:i + per_line]) + ","
+                     for i in range(0, len(values), per_line))
+
+
+def format_sprite(name, pixels, width, height, fmt):
+    pal4 = encode_pal4(pixels, width, height) if fmt == "pal4" else None
+    if pal4:
+        palette, data = pal4
+        assert decode_pal4(palette, data, width, height) == pixels
+        return "\n".join([
+            "%s %dx%d, %d colors, %d bytes (raw: %d bytes)" % (PAL4_MARKER, width, height, len(palette) - 1,
+                                                               2 * len(palette) + len(data), 2 * width * height),
+            "const uint16_t %s_palette [] PROGMEM = {" % name,
+            rows(palette, "0x%04X", 16),
+            "};",
+            "const uint8_t %s_indices [] PROGMEM = {" % name,
+            rows(data, "0x%02X", 28),
+            "};",
+            "const Sprite %s = {SPRITE_PAL4, %d, %d, %d, %s_palette, %s_indices};" % (
+                name, width, height, len(palette), name, name),
+        ]), 2 * len(palette) + len(data)
+    words = encode_rle(pixels, width, height)
+    assert decode_rle(words) == pixels
+    return "\n".join([
+        "%s %dx%d, %d words (raw: %d words)" % (RLE_MARKER, width, height, len(words), width * height),
+        "const uint16_t %s_rle [] PROGMEM = {" % name,
+        rows(words, "0x%04X", 16),
+        "};",
+        "const Sprite %s = {SPRITE_RLE565, %d, %d, 0, nullptr, %s_rle};" % (name, width, height, name),
+    ]), 2 * len(words)
+
+
+def parse_values(body):
+    body = re.sub(r"//[^\n]*", "", body)
+    return [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{1,4}", body)]
+
+
+def sprite_size(text, name):
+    m = re.search(r"\b%s\s*,\s*(\d+)\s*,\s*(\d+)\s*\)" % re.escape(name), text)
+    if m:
+        return int(m.group(1)), int(m.group(2))
+    # Chess pieces and menu icons have fixed sizes.
+    if re.search(r"(white|black)\w*Sprite$", name):
+        return 26, 26
+    if name.endswith("_ICON_BITS"):
+        return 16, 16
+    raise ValueError("cannot tell the size of %s" % name)
+
+
+def handle_pixels(block, width, height):
+    arrays = dict(re.findall(r"const uint(?:8|16)_t\s+\w+_(palette|indices|rle)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};",
+                             block, re.S))
+    if "rle" in arrays:
+        return decode_rle(parse_values(arrays["rle"]))
+    return decode_pal4(parse_values(arrays["palette"]), parse_values(arrays["indices"]), width, height)
+
+
+def convert_header(path, fmt):
+    text = open(path).read()
+    wanted = "SPRITE_PAL4" if fmt == "pal4" else "SPRITE_RLE565"
+
+    def replace_handle(m):
+        name, current, width, height = m.group(1), m.group(2), int(m.group(3)), int(m.group(4))
+        if current == wanted:
+            return m.group(0)
+        pixels = handle_pixels(m.group(0), width, height)
+        out, size = format_sprite(name, pixels, width, height, fmt)
+        print("%s: %s %dx%d -> %d bytes" % (path, name, width, height, size), file=sys.stderr)
+        return out
+
+    def replace_array(m):
+        name = m.group(1)
+        values = parse_values(m.group(2))
+        if m.group(0).startswith(RLE_MARKER):
+            width, height = values[0], values[1]
+            pixels = decode_rle(values)
+        else:
+            width, height = sprite_size(text, name)
+            pixels = values[:width * height]
+        out, size = format_sprite(name, pixels, width, height, fmt)
+        print("%s: %s %dx%d %d -> %d bytes" % (path, name, width, height, 2 * width * height, size), file=sys.stderr)
+        # Point the create...() call at the handle.
+        converted.append(name)
+        return out
+
+    # Handles are converted first and parked behind placeholders so their own
+    # arrays are not mistaken for raw input.
+    handles = []
+
+    def park_handle(m):
+        handles.append(replace_handle(m))
+        return "\0%d\0" % (len(handles) - 1)
+
+    converted = []
+    new_text = HANDLE_RE.sub(park_handle, text)
+    new_text = RAW_RE.sub(replace_array, new_text)
+    new_text = re.sub(r"\0(\d+)\0", lambda m: handles[int(m.group(1))], new_text)
+    for name in converted:
+        new_text = re.sub(r"\b%s\s*,\s*\d+\s*,\s*\d+\s*\)" % re.escape(name), "&%s)" % name, new_text)
+        new_text = re.sub(r",\s*%s\s*\)" % re.escape(name), ", &%s)" % name, new_text)
+    if converted and '#include "sprite.h"' not in new_text:
+        new_text = new_text.replace("#include <Arduino.h>\n", '#include <Arduino.h>\n#include "sprite.h"\n', 1)
+    if new_text != text:
+        open(path, "w").write(new_text)
+
+
+def main(argv):
+    fmt = "pal4"
+    if len(argv) >= 2 and argv[0] == "--format":
+        fmt = argv[1]
+        argv = argv[2:]
+    if fmt not in ("pal4", "rle"):
+        print("unknown format %s" % fmt, file=sys.stderr)
+        return 1
+    if len(argv) >= 3 and argv[0] == "--size":
+        width, height = (int(v) for v in argv[1].split("x"))
+        for path in argv[2:]:
+            text = open(path).read()
+            m = re.search(r"PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+            name = re.sub(r"\W", "_", path.rsplit("/", 1)[-1].rsplit(".", 1)[0])
+            print(format_sprite(name, parse_values(m.group(1))[:width * height], width, height, fmt)[0])
+        return 0
+    if not argv:
+        print(__doc__, file=sys.stderr)
+        return 1
+    for path in argv:
+        convert_header(path, fmt)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,699 @@
+/**
+ * @file texel_tune.cpp
+ * @brief Tunes the material and piece-square values (src/pieceSquareData.h) on game results
+ * with Texel's method.
+ *
+ * The evaluation maps to a predicted score through a logistic curve,
+ *   predicted = 1 / (1 + 10^(-K * eval / 400)),
+ * and the tuner looks for the values that minimise the mean squared difference
+ * between that prediction and the real result of the game each position came from
+ * (1 white won, 0.5 draw, 0 black won). The evaluation is linear in every value it
+ * tunes: material and piece-square bonus per piece type, square and game phase,
+ * blended by the phase exactly as evaluatePosition() does.
+ *  - Positions come from self-play, PGN games or EPD files. Self-play games start
+ *    with TUNE_RANDOM_PLIES random moves, then ChessSearch plays both sides with a
+ *    fixed node budget and a fresh transposition table per game. A game ends on
+ *    mate, stalemate, repetition, the fifty-move rule, a three-piece ending (scored
+ *    by evaluateKnownEnding()), once one side has been TUNE_RESIGN_SCORE ahead for
+ *    TUNE_RESIGN_PLIES plies, or as a draw after TUNE_MAX_PLIES plies.
+ *  - Only quiet positions are kept: not in check, past the opening plies, not a
+ *    three-piece ending, and no capture or promotion sequence changes the static
+ *    evaluation. The rest would teach the values about the exchange in progress.
+ *  - Each position is stored as its phase, result and a short list of
+ *    (piece, square) features, the same indices as chessEvalTables::pieceSquareScores.
+ *  - K is fitted first (golden-section search), with the values in the header.
+ *    Then full-batch gradient descent (Adam) runs over all positions. A small
+ *    penalty (--lambda) on the squared distance from the header's values keeps
+ *    squares that pieces rarely reach from drifting on a handful of positions. A much
+ *    stronger one (--material-lambda) holds each piece's average value (material
+ *    plus the mean of its table) near the header's. Without it the fit trades
+ *    material for square bonuses that only pay off in the positions self-play
+ *    reaches (a 65-centipawn middlegame pawn), and deeper searches gain less over
+ *    shallower ones in engine_bench's budget scaling. Check that scaling before
+ *    committing a new header.
+ *  - The work is spread over --threads threads (default: every core). Self-play
+ *    games are handed out one at a time and merged in game order; the positions are
+ *    split into TUNE_CHUNKS fixed chunks whose sums are added up in order. The
+ *    output is the same for any thread count.
+ *  - One block of TUNE_HOLD_OUT_BLOCK positions in twenty is held out of the
+ *    training and only scored, before and after, to show the new values generalise.
+ *    Positions are stored in game order, so the blocks are mostly whole games.
+ *  - The average piece-square bonus of each piece type is moved into its material
+ *    value before rounding, so the tables stay centred and readable.
+ *
+ * Build and run from FinalProject/:
+ *   g++ -std=gnu++17 -O2 -pthread -Isrc tools/texel_tune.cpp -o /tmp/texel_tune
+ *   /tmp/texel_tune [--threads N] [--selfplay GAMES] [--nodes N] [--save games.epd] [--iterations N] [--rate R]
+ *                   [--lambda L] [--material-lambda L] [-o src/pieceSquareData.h] [games.pgn | positions.epd ...]
+ * EPD lines are a FEN followed by the result, as "[1.0]", "[0.5]", "[0.0]" or a
+ * quoted "1-0", "1/2-1/2", "0-1" (the c9 opcode). --save writes the self-play
+ * positions that passed the filter in the first form, for later runs.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chessSearch.h"
+#include "pgn.h"
+
+#define TUNE_RANDOM_PLIES 8
+#define TUNE_MAX_PLIES 400
+#define TUNE_RESIGN_SCORE 1000
+#define TUNE_RESIGN_PLIES 8
+#define TUNE_TT_BYTES (1u << 20)
+#define TUNE_QUIET_DEPTH 8
+#define TUNE_CHUNKS 64
+#define TUNE_HOLD_OUT_BLOCK 256
+#define TUNE_DEFAULT_LAMBDA 4e-9
+#define TUNE_DEFAULT_MATERIAL_LAMBDA 1e-5
+
+// Tuned values: piece-square bonuses [phase][type][square], then material [phase][type],
+// phase 0 being the middlegame.
+#define TUNE_PST_VALUES (2 * 7 * 64)
+#define TUNE_VALUES (TUNE_PST_VALUES + 2 * 7)
+
+static const char *startFen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+static int pstValue(int phase, int type, int square) { return (phase * 7 + type) * 64 + square; }
+static int materialValue(int phase, int type) { return TUNE_PST_VALUES + phase * 7 + type; }
+// Squares a piece type can stand on (pawns never stand on the first or last row).
+static void tableSquares(int type, int &first, int &last) {
+  first = type == CHESS_PAWN ? 8 : 0;
+  last = type == CHESS_PAWN ? 56 : 64;
+}
+
+// What a piece is worth on average over its squares: material plus the table's mean.
+static double averageValue(const double *values, int phase, int type) {
+  int first, last;
+  tableSquares(type, first, last);
+  double sum = 0;
+  for (int square = first; square < last; square++) {
+    sum += values[pstValue(phase, type, square)];
+  }
+  return values[materialValue(phase, type)] + sum / (last - first);
+}
+
+struct TuningPosition {
+  uint32_t first; // offset of its features in Dataset::features
+  uint8_t count;
+  uint8_t phase;  // clamped to CHESS_PHASE_TOTAL
+  float result;   // white's score
+};
+
+struct Dataset {
+  std::vector<TuningPosition> positions;
+  std::vector<uint16_t> features; // pieceBoardIndex(piece) * 64 + square
+  std::vector<std::string> fens;  // only kept for --save
+
+  void append(const Dataset &other) {
+    for (TuningPosition position : other.positions) {
+      position.first += (uint32_t)features.size();
+      positions.push_back(position);
+    }
+    features.insert(features.end(), other.features.begin(), other.features.end());
+    fens.insert(fens.end(), other.fens.begin(), other.fens.end());
+  }
+};
+
+// Captures and promotions only, with stand-pat: the score once the exchanges settle.
+static int captureSearch(ChessPosition &position, int alpha, int beta, int depth) {
+  int standPat = evaluatePosition(position);
+  if (standPat >= beta || depth == 0) {
+    return standPat;
+  }
+  alpha = std::max(alpha, standPat);
+  ChessMoveList moves;
+  generateLegalMoves(position, position.sideToMove(), moves);
+  for (ChessMove move : moves) {
+    if (position.pieceAt(moveTo(move)) == 0 && moveKind(move) != MOVE_PROMOTION &&
+        moveKind(move) != MOVE_EN_PASSANT) {
+      continue;
+    }
+    position.makeMove(move);
+    int score = -captureSearch(position, -beta, -alpha, depth - 1);
+    position.unmakeMove();
+    if (score >= beta) {
+      return score;
+    }
+    alpha = std::max(alpha, score);
+  }
+  return alpha;
+}
+
+static bool isQuiet(ChessPosition &position) {
+  if (position.inCheck(position.sideToMove()) || popCount(position.occupied()) <= 3) {
+    return false;
+  }
+  return captureSearch(position, -CHESS_INFINITY, CHESS_INFINITY, TUNE_QUIET_DEPTH) == evaluatePosition(position);
+}
+
+static std::string fenOf(const ChessPosition &position) {
+  static const char letters[] = "kqrnbp.PBNRQK";
+  std::string fen;
+  for (int row = 0; row < 8; row++) {
+    int empty = 0;
+    for (int col = 0; col < 8; col++) {
+      int piece = position.pieceAt(row * 8 + col);
+      if (piece == 0) {
+        empty++;
+        continue;
+      }
+      if (empty) {
+        fen += (char)('0' + empty);
+        empty = 0;
+      }
+      fen += letters[piece + 6];
+    }
+    if (empty) {
+      fen += (char)('0' + empty);
+    }
+    fen += row < 7 ? '/' : ' ';
+  }
+  fen += position.sideToMove() > 0 ? "w " : "b ";
+  uint8_t rights = position.castlingRights();
+  if (rights & CASTLE_WHITE_KING) fen += 'K';
+  if (rights & CASTLE_WHITE_QUEEN) fen += 'Q';
+  if (rights & CASTLE_BLACK_KING) fen += 'k';
+  if (rights & CASTLE_BLACK_QUEEN) fen += 'q';
+  if (!rights) fen += '-';
+  int square = position.enPassantSquare();
+  if (square >= 0 && square < 64) {
+    fen += ' ';
+    fen += (char)('a' + square % 8);
+    fen += (char)('8' - square / 8);
+  } else {
+    fen += " -";
+  }
+  return fen;
+}
+
+// Records the position with its features; its result is filled in once known.
+static void record(Dataset &data, const ChessPosition &position, float result, bool keepFen) {
+  TuningPosition entry;
+  entry.first = (uint32_t)data.features.size();
+  Bitboard pieces = position.occupied();
+  while (pieces) {
+    int square = popLowestSquare(pieces);
+    data.features.push_back((uint16_t)(pieceBoardIndex(position.pieceAt(square)) * 64 + square));
+  }
+  entry.count = (uint8_t)(data.features.size() - entry.first);
+  entry.phase = (uint8_t)std::min(position.computePhase(), CHESS_PHASE_TOTAL);
+  entry.result = result;
+  data.positions.push_back(entry);
+  if (keepFen) {
+    data.fens.push_back(fenOf(position));
+  }
+}
+
+static uint64_t splitMix(uint64_t &state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+// Plays one self-play game and returns its quiet positions labelled with the result.
+static Dataset playGame(int game, ChessSearch &engine, TranspositionTable &table, uint32_t nodes, bool keepFens) {
+  Dataset data;
+  uint64_t seed = 0x7465786C00000000ull + (uint64_t)game;
+  table.clear();
+  ChessPosition position;
+  position.setFen(startFen);
+  float result = 0.5f;
+  int leader = 0, leadPlies = 0;
+  for (int ply = 0; ply < TUNE_MAX_PLIES; ply++) {
+    ChessMoveList moves;
+    generateLegalMoves(position, position.sideToMove(), moves);
+    if (moves.count == 0) {
+      result = !position.inCheck(position.sideToMove()) ? 0.5f : position.sideToMove() > 0 ? 0.0f : 1.0f;
+      break;
+    }
+    if (position.repetitions() >= 2 || position.halfmoveClock() >= 100 || popCount(position.occupied()) <= 2) {
+      break;
+    }
+    int known;
+    if (evaluateKnownEnding(position, known)) {
+      result = known > 0 ? 1.0f : known < 0 ? 0.0f : 0.5f;
+      break;
+    }
+    if (ply < TUNE_RANDOM_PLIES) {
+      position.makeMove(moves.moves[splitMix(seed) % moves.count]);
+      continue;
+    }
+    if (isQuiet(position)) {
+      record(data, position, 0.5f, keepFens);
+    }
+    ChessSearchLimits limits;
+    limits.maxNodes = nodes;
+    ChessSearchResult searched = engine.search(position, limits);
+    int whiteScore = searched.score * position.sideToMove();
+    int ahead = whiteScore >= TUNE_RESIGN_SCORE ? 1 : whiteScore <= -TUNE_RESIGN_SCORE ? -1 : 0;
+    leadPlies = ahead != 0 && ahead == leader ? leadPlies + 1 : 1;
+    leader = ahead;
+    if (leader != 0 && leadPlies >= TUNE_RESIGN_PLIES) {
+      result = leader > 0 ? 1.0f : 0.0f;
+      break;
+    }
+    position.makeMove(searched.move);
+  }
+  for (TuningPosition &entry : data.positions) {
+    entry.result = result;
+  }
+  return data;
+}
+
+static void selfPlay(int games, uint32_t nodes, int threads, bool keepFens, Dataset &data) {
+  std::vector<Dataset> results(games);
+  std::atomic<int> next(0);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back([&] {
+      std::unique_ptr<ChessSearch> engine(new ChessSearch()); // about 55 KB each
+      std::unique_ptr<uint8_t[]> memory(new uint8_t[TUNE_TT_BYTES]);
+      TranspositionTable table;
+      table.attach(memory.get(), TUNE_TT_BYTES);
+      engine->setTable(&table);
+      for (int game; (game = next++) < games;) {
+        results[game] = playGame(game, *engine, table, nodes, keepFens);
+      }
+    });
+  }
+  for (std::thread &thread : pool) {
+    thread.join();
+  }
+  for (const Dataset &game : results) {
+    data.append(game);
+  }
+}
+
+static bool readPgnPositions(const char *path, const std::string &text, Dataset &data) {
+  int gameCount = 0, skipped = 0;
+  for (const PgnGame &game : readPgn(text)) {
+    gameCount++;
+    if (game.result == "*") {
+      skipped++;
+      continue;
+    }
+    float result = game.result == "1-0" ? 1.0f : game.result == "0-1" ? 0.0f : 0.5f;
+    ChessPosition position;
+    position.setFen(startFen);
+    for (int ply = 0; ply < (int)game.moves.size(); ply++) {
+      ChessMove move = parseSan(position, game.moves[ply]);
+      if (move == 0) {
+        fprintf(stderr, "%s: game %d: cannot play \"%s\" at ply %d\n", path, gameCount, game.moves[ply].c_str(),
+                ply + 1);
+        break;
+      }
+      if (ply >= TUNE_RANDOM_PLIES && isQuiet(position)) {
+        record(data, position, result, false);
+      }
+      position.makeMove(move);
+    }
+  }
+  printf("%s: %d games, %d without a result skipped\n", path, gameCount, skipped);
+  return gameCount > 0;
+}
+
+static bool readEpdPositions(const char *path, const std::string &text, Dataset &data) {
+  size_t lines = 0, bad = 0;
+  size_t start = 0;
+  while (start < text.size()) {
+    size_t end = text.find('\n', start);
+    end = end == std::string::npos ? text.size() : end;
+    std::string line = text.substr(start, end - start);
+    start = end + 1;
+    if (line.find_first_not_of(" \t\r") == std::string::npos) {
+      continue;
+    }
+    lines++;
+    float result = -1;
+    size_t cut = line.find('[');
+    if (cut != std::string::npos) {
+      result = (float)atof(line.c_str() + cut + 1);
+    } else if ((cut = line.find('"')) != std::string::npos) {
+      result = line.compare(cut + 1, 3, "1-0") == 0 ? 1.0f : line.compare(cut + 1, 3, "0-1") == 0 ? 0.0f : 0.5f;
+      size_t opcode = line.rfind(" c9", cut);
+      cut = opcode != std::string::npos ? opcode : cut;
+    }
+    ChessPosition position;
+    if (cut == std::string::npos || result < 0 || result > 1 || !position.setFen(line.substr(0, cut).c_str())) {
+      bad++;
+      continue;
+    }
+    if (isQuiet(position)) {
+      record(data, position, result, false);
+    }
+  }
+  printf("%s: %zu positions, %zu unreadable\n", path, lines, bad);
+  return lines > bad;
+}
+
+// Runs work(chunk, begin, end) for each of TUNE_CHUNKS fixed slices of count items.
+template <typename Work> static void forChunks(int threads, size_t count, Work work) {
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back([&, t] {
+      for (int chunk = t; chunk < TUNE_CHUNKS; chunk += threads) {
+        work(chunk, count * chunk / TUNE_CHUNKS, count * (chunk + 1) / TUNE_CHUNKS);
+      }
+    });
+  }
+  for (std::thread &thread : pool) {
+    thread.join();
+  }
+}
+
+struct Tuner {
+  const Dataset &data;
+  std::vector<uint32_t> train, test; // indices into data.positions
+  int threads;
+  double values[TUNE_VALUES];
+  double start[TUNE_VALUES]; // the values in the header, which the penalty pulls towards
+
+  Tuner(const Dataset &data, int threads) : data(data), threads(threads) {
+    for (uint32_t i = 0; i < data.positions.size(); i++) {
+      (i / TUNE_HOLD_OUT_BLOCK % 20 == 19 ? test : train).push_back(i);
+    }
+    for (int type = 0; type < 7; type++) {
+      values[materialValue(0, type)] = chessEvalTables::materialMiddlegame[type];
+      values[materialValue(1, type)] = chessEvalTables::materialEndgame[type];
+      for (int square = 0; square < 64; square++) {
+        values[pstValue(0, type, square)] = chessEvalTables::pieceSquareMiddlegame[type][square];
+        values[pstValue(1, type, square)] = chessEvalTables::pieceSquareEndgame[type][square];
+      }
+    }
+    memcpy(start, values, sizeof(values));
+  }
+
+  // Where a feature's middlegame values sit; the endgame ones follow at the same offsets in phase 1.
+  static void featureValues(uint16_t feature, int &pst, int &material, int &sign) {
+    int index = feature / 64, square = feature % 64;
+    int type = index % 6 + 1;
+    sign = index < 6 ? 1 : -1;
+    pst = pstValue(0, type, sign > 0 ? square : square ^ 56);
+    material = materialValue(0, type);
+  }
+
+  double evaluate(const TuningPosition &position) const {
+    double middlegame = 0, endgame = 0;
+    for (int i = 0; i < position.count; i++) {
+      int pst, material, sign;
+      featureValues(data.features[position.first + i], pst, material, sign);
+      middlegame += sign * (values[material] + values[pst]);
+      endgame += sign * (values[material + 7] + values[pst + 7 * 64]);
+    }
+    return (middlegame * position.phase + endgame * (CHESS_PHASE_TOTAL - position.phase)) / CHESS_PHASE_TOTAL;
+  }
+
+  static double predict(double k, double eval) { return 1.0 / (1.0 + pow(10.0, -k * eval / 400.0)); }
+
+  double error(double k, const std::vector<uint32_t> &set) const {
+    double sums[TUNE_CHUNKS] = {};
+    forChunks(threads, set.size(), [&](int chunk, size_t begin, size_t end) {
+      double sum = 0;
+      for (size_t i = begin; i < end; i++) {
+        const TuningPosition &position = data.positions[set[i]];
+        double difference = position.result - predict(k, evaluate(position));
+        sum += difference * difference;
+      }
+      sums[chunk] = sum;
+    });
+    double total = 0;
+    for (double sum : sums) {
+      total += sum;
+    }
+    return set.empty() ? 0 : total / set.size();
+  }
+
+  double fitK() const {
+    const double golden = (sqrt(5.0) - 1) / 2;
+    double low = 0.1, high = 4.0;
+    double a = high - golden * (high - low), b = low + golden * (high - low);
+    double errorA = error(a, train), errorB = error(b, train);
+    while (high - low > 0.001) {
+      if (errorA < errorB) {
+        high = b, b = a, errorB = errorA;
+        a = high - golden * (high - low);
+        errorA = error(a, train);
+      } else {
+        low = a, a = b, errorA = errorB;
+        b = low + golden * (high - low);
+        errorB = error(b, train);
+      }
+    }
+    return (low + high) / 2;
+  }
+
+  // Gradient of the training error plus lambda times the squared distance of every
+  // value from its starting value, plus materialLambda times the squared distance of
+  // every piece's average value from its starting one. The position sums are added per
+  // chunk and then in chunk order.
+  void gradient(double k, double lambda, double materialLambda, std::vector<double> &total) const {
+    std::vector<std::vector<double>> chunks(TUNE_CHUNKS, std::vector<double>(TUNE_VALUES, 0.0));
+    forChunks(threads, train.size(), [&](int chunk, size_t begin, size_t end) {
+      std::vector<double> &sum = chunks[chunk];
+      for (size_t i = begin; i < end; i++) {
+        const TuningPosition &position = data.positions[train[i]];
+        double predicted = predict(k, evaluate(position));
+        // d(error)/d(eval) without the factor 2 K ln(10) / 400 / positions, applied below.
+        double slope = (predicted - position.result) * predicted * (1 - predicted);
+        double middlegame = slope * position.phase / CHESS_PHASE_TOTAL;
+        double endgame = slope - middlegame;
+        for (int j = 0; j < position.count; j++) {
+          int pst, material, sign;
+          featureValues(data.features[position.first + j], pst, material, sign);
+          sum[pst] += sign * middlegame;
+          sum[material] += sign * middlegame;
+          sum[pst + 7 * 64] += sign * endgame;
+          sum[material + 7] += sign * endgame;
+        }
+      }
+    });
+    total.assign(TUNE_VALUES, 0.0);
+    for (const std::vector<double> &sum : chunks) {
+      for (int i = 0; i < TUNE_VALUES; i++) {
+        total[i] += sum[i];
+      }
+    }
+    const double scale = 2 * k * log(10.0) / 400 / train.size();
+    for (int i = 0; i < TUNE_VALUES; i++) {
+      total[i] = total[i] * scale + 2 * lambda * (values[i] - start[i]);
+    }
+    // The average value moves with the material value and with the mean of the table,
+    // so anchoring it keeps the tables from taking over what material stands for.
+    for (int phase = 0; phase < 2; phase++) {
+      for (int type = CHESS_PAWN; type < CHESS_KING; type++) {
+        int first, last;
+        tableSquares(type, first, last);
+        double pull = 2 * materialLambda * (averageValue(values, phase, type) - averageValue(start, phase, type));
+        total[materialValue(phase, type)] += pull;
+        for (int square = first; square < last; square++) {
+          total[pstValue(phase, type, square)] += pull / (last - first);
+        }
+      }
+    }
+    // The kings' material is not a value of the evaluation.
+    total[materialValue(0, CHESS_KING)] = total[materialValue(1, CHESS_KING)] = 0;
+  }
+
+  // Full-batch Adam with the step size decaying linearly to a tenth.
+  void run(double k, int iterations, double rate, double lambda, double materialLambda) {
+    std::vector<double> grad, m(TUNE_VALUES, 0.0), v(TUNE_VALUES, 0.0);
+    const double beta1 = 0.9, beta2 = 0.999;
+    for (int step = 1; step <= iterations; step++) {
+      gradient(k, lambda, materialLambda, grad);
+      double stepRate = rate * (1.0 - 0.9 * (step - 1) / std::max(1, iterations - 1));
+      for (int i = 0; i < TUNE_VALUES; i++) {
+        m[i] = beta1 * m[i] + (1 - beta1) * grad[i];
+        v[i] = beta2 * v[i] + (1 - beta2) * grad[i] * grad[i];
+        double mHat = m[i] / (1 - pow(beta1, step)), vHat = v[i] / (1 - pow(beta2, step));
+        values[i] -= stepRate * mHat / (sqrt(vHat) + 1e-12);
+      }
+      if (step % 100 == 0 || step == iterations) {
+        printf("  iteration %4d: training error %.6f\n", step, error(k, train));
+      }
+    }
+  }
+
+  // Moves each table's average into the material value (the kings have none, and a
+  // constant on both kings cancels out), then rounds everything.
+  void centreAndRound() {
+    for (int phase = 0; phase < 2; phase++) {
+      for (int type = 1; type <= CHESS_KING; type++) {
+        int first, last;
+        tableSquares(type, first, last);
+        double mean = 0;
+        for (int square = first; square < last; square++) {
+          mean += values[pstValue(phase, type, square)];
+        }
+        mean /= last - first;
+        for (int square = first; square < last; square++) {
+          values[pstValue(phase, type, square)] -= mean;
+        }
+        if (type != CHESS_KING) {
+          values[materialValue(phase, type)] += mean;
+        }
+      }
+    }
+    for (double &value : values) {
+      value = round(value);
+    }
+  }
+};
+
+static void writeHeader(const char *path, const Tuner &tuner, double k, double before, double after) {
+  FILE *out = fopen(path, "w");
+  if (!out) {
+    perror(path);
+    exit(1);
+  }
+  static const char *names[7] = {"", "pawn", "bishop", "knight", "rook", "queen", "king"};
+  fprintf(out, "#ifndef PIECESQUAREDATA_H\n#define PIECESQUAREDATA_H\n\n#include <stdint.h>\n\n");
+  fprintf(out, "// Generated by tools/texel_tune.cpp from %zu positions (K %.3f, held-out error %.5f before,\n",
+          tuner.data.positions.size(), k, before);
+  fprintf(out, "// %.5f after). Layout in pieceSquare.h. Do not edit.\n", after);
+  fprintf(out, "namespace chessEvalTables {\n\n");
+  const char *phaseNames[2] = {"Middlegame", "Endgame"};
+  for (int phase = 0; phase < 2; phase++) {
+    fprintf(out, "constexpr int16_t material%s[7] = {", phaseNames[phase]);
+    for (int type = 0; type < 7; type++) {
+      fprintf(out, "%s%d", type ? ", " : "", (int)tuner.values[materialValue(phase, type)]);
+    }
+    fprintf(out, "};\n");
+  }
+  for (int phase = 0; phase < 2; phase++) {
+    fprintf(out, "\nconstexpr int16_t pieceSquare%s[7][64] = {\n    {}, // (no piece)\n", phaseNames[phase]);
+    for (int type = 1; type < 7; type++) {
+      fprintf(out, "    { // %s\n", names[type]);
+      for (int row = 0; row < 8; row++) {
+        fprintf(out, "       ");
+        for (int col = 0; col < 8; col++) {
+          fprintf(out, " %4d,", (int)tuner.values[pstValue(phase, type, row * 8 + col)]);
+        }
+        fprintf(out, "\n");
+      }
+      fprintf(out, "    },\n");
+    }
+    fprintf(out, "};\n");
+  }
+  fprintf(out, "\n} // namespace chessEvalTables\n\n#endif\n");
+  fclose(out);
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+  int threads = (int)std::thread::hardware_concurrency();
+  int games = 0;
+  uint32_t nodes = 2000;
+  int iterations = 300;
+  double rate = 1.0;
+  double lambda = TUNE_DEFAULT_LAMBDA;
+  double materialLambda = TUNE_DEFAULT_MATERIAL_LAMBDA;
+  const char *savePath = nullptr;
+  const char *outPath = "src/pieceSquareData.h";
+  std::vector<const char *> inputs;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--selfplay") && i + 1 < argc) {
+      games = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--nodes") && i + 1 < argc) {
+      nodes = (uint32_t)atol(argv[++i]);
+    } else if (!strcmp(argv[i], "--save") && i + 1 < argc) {
+      savePath = argv[++i];
+    } else if (!strcmp(argv[i], "--iterations") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--rate") && i + 1 < argc) {
+      rate = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--lambda") && i + 1 < argc) {
+      lambda = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--material-lambda") && i + 1 < argc) {
+      materialLambda = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      outPath = argv[++i];
+    } else if (argv[i][0] != '-') {
+      inputs.push_back(argv[i]);
+    } else {
+      fprintf(stderr, "usage: texel_tune [--threads N] [--selfplay GAMES] [--nodes N] [--save games.epd] "
+                      "[--iterations N] [--rate R] [--lambda L] [--material-lambda L] [-o header.h] "
+                      "[games.pgn | positions.epd ...]\n");
+      return 2;
+    }
+  }
+  threads = std::max(threads, 1);
+  if (games == 0 && inputs.empty()) {
+    fprintf(stderr, "nothing to tune on: give --selfplay GAMES, PGN or EPD files\n");
+    return 2;
+  }
+  printf("%d threads\n", threads);
+
+  Dataset data;
+  if (games > 0) {
+    auto start = std::chrono::steady_clock::now();
+    selfPlay(games, nodes, threads, savePath != nullptr, data);
+    double seconds = secondsSince(start);
+    printf("self-play: %d games at %u nodes per move, %zu quiet positions, %.1f s (%.1f games/s)\n", games, nodes,
+           data.positions.size(), seconds, games / seconds);
+    if (savePath) {
+      FILE *save = fopen(savePath, "w");
+      if (!save) {
+        perror(savePath);
+        return 1;
+      }
+      for (size_t i = 0; i < data.positions.size(); i++) {
+        fprintf(save, "%s [%.1f]\n", data.fens[i].c_str(), data.positions[i].result);
+      }
+      fclose(save);
+      printf("wrote %s\n", savePath);
+    }
+  }
+  for (const char *path : inputs) {
+    std::string text;
+    if (!readFile(path, text)) {
+      fprintf(stderr, "cannot read %s\n", path);
+      return 1;
+    }
+    size_t extension = strlen(path) >= 4 ? strlen(path) - 4 : 0;
+    bool ok = strcmp(path + extension, ".pgn") == 0 ? readPgnPositions(path, text, data)
+                                                    : readEpdPositions(path, text, data);
+    if (!ok) {
+      fprintf(stderr, "no positions in %s\n", path);
+      return 1;
+    }
+  }
+
+  Tuner tuner(data, threads);
+  if (tuner.train.empty() || tuner.test.empty()) {
+    fprintf(stderr, "too few positions (%zu)\n", data.positions.size());
+    return 1;
+  }
+  printf("%zu quiet positions, %zu for training, %zu held out\n", data.positions.size(), tuner.train.size(),
+         tuner.test.size());
+
+  auto start = std::chrono::steady_clock::now();
+  double k = tuner.fitK();
+  double trainBefore = tuner.error(k, tuner.train), testBefore = tuner.error(k, tuner.test);
+  printf("K = %.3f; error before: training %.6f, held out %.6f\n", k, trainBefore, testBefore);
+  tuner.run(k, iterations, rate, lambda, materialLambda);
+  tuner.centreAndRound();
+  double trainAfter = tuner.error(k, tuner.train), testAfter = tuner.error(k, tuner.test);
+  double seconds = secondsSince(start);
+  printf("error after: training %.6f, held out %.6f (%.1f s, %.0f positions/s per iteration)\n", trainAfter,
+         testAfter, seconds, (double)tuner.train.size() * iterations / seconds);
+
+  writeHeader(outPath, tuner, k, testBefore, testAfter);
+  printf("wrote %s\n", outPath);
+  return 0;
+}